@@ -0,0 +1,38 @@
+#ifndef ADAPTIVE_SAMPLER_H
+#define ADAPTIVE_SAMPLER_H
+
+// Chu kỳ lấy mẫu thích nghi cho một kênh cảm biến. Sau mỗi lần đọc, nơi gọi đưa
+// vào độ thay đổi chuẩn hóa (|giá trị mới - cũ| / deadband): trong deadband thì chu
+// kỳ giãn ADAPTIVE_GROWTH lần, vượt deadband thì chu kỳ co tỉ lệ nghịch với tốc độ
+// thay đổi để mỗi chu kỳ chỉ đổi khoảng một deadband. Luôn nằm trong [min, max].
+// Không phụ thuộc Arduino.
+
+#include <stdint.h>
+
+#define ADAPTIVE_GROWTH 1.5f
+
+// |now - last| / deadband; vô cực nếu một trong hai không hợp lệ (NaN)
+float adaptiveChange(float now, float last, float deadband);
+
+class AdaptiveInterval {
+    public:
+        AdaptiveInterval(uint32_t minMs, uint32_t maxMs);
+
+        // Bắt đầu ở chu kỳ nhỏ nhất, đến hạn ngay
+        void reset();
+        bool due(uint32_t nowMs) const;
+        // Gọi sau mỗi lần đọc. change vô cực/NaN (lỗi cảm biến) về chu kỳ nhỏ nhất
+        void update(uint32_t nowMs, float change);
+
+        uint32_t intervalMs() const { return interval; }
+        uint32_t reads() const { return count; }
+
+    private:
+        uint32_t minInterval;
+        uint32_t maxInterval;
+        uint32_t interval;
+        uint32_t nextMs;
+        uint32_t count;
+};
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef ADC_FILTER_H
+#define ADC_FILTER_H
+
+// Lọc bền cho luồng mẫu ADC tốc độ cao (DMA): mỗi khối ADC_FILTER_BLOCK mẫu cho
+// một trung bình cắt (bỏ ADC_FILTER_TRIM mẫu mỗi đầu), giá trị ra là trung vị của
+// ADC_FILTER_BLOCKS khối gần nhất nên cả nhiễu trắng lẫn xung đột biến vài mili
+// giây đều bị loại. Không phụ thuộc Arduino.
+
+#include <stdint.h>
+
+#define ADC_FILTER_BLOCK 64
+#define ADC_FILTER_TRIM 16              // 25% mỗi đầu: trung bình của khoảng tứ phân vị
+#define ADC_FILTER_BLOCKS 9
+#define ADC_FILTER_NOISE_ALPHA 0.05f    // hệ số trung bình trượt của ước lượng nhiễu
+
+// Điểm hiệu chuẩn: số đọc raw và giá trị raw đúng (đo với điện áp chuẩn)
+struct AdcCalibrationPoint {
+    float measured;
+    float actual;
+};
+
+// Đường cong hiệu chuẩn tuyến tính từng đoạn, measured tăng dần (ít nhất 2 điểm).
+// Ngoài khoảng thì ngoại suy theo đoạn đầu/cuối
+class AdcCalibration {
+    public:
+        AdcCalibration(const AdcCalibrationPoint* points, uint8_t count);
+
+        float apply(float raw) const;
+        // Hệ số góc tại raw, để đổi độ lệch (nhiễu) sang thang đã hiệu chuẩn
+        float slope(float raw) const;
+
+    private:
+        uint8_t segment(float raw) const;
+
+        const AdcCalibrationPoint* curve;
+        uint8_t size;
+};
+
+// Sắp xếp ADC_FILTER_BLOCK mẫu tại chỗ rồi tính trung bình cắt (bỏ ADC_FILTER_TRIM
+// mẫu mỗi đầu) và độ lệch chuẩn ước lượng từ IQR
+void adcBlockStats(uint16_t* block, float& trimmedMean, float& sigma);
+
+class RobustAdcFilter {
+    public:
+        RobustAdcFilter();
+
+        // Thêm một mẫu raw; true khi vừa đóng một khối (value/noise mới)
+        bool add(uint16_t raw);
+        void reset();
+
+        bool ready() const { return meanCount > 0; }
+        // Trung vị các trung bình cắt gần nhất (raw), NaN khi chưa đủ một khối
+        float value() const;
+        // Độ lệch chuẩn ước lượng bền của từng mẫu: (Q3 - Q1) / 1.349 mỗi khối,
+        // trung bình trượt qua các khối
+        float noise() const { return noiseEstimate; }
+        uint32_t blocks() const { return blockTotal; }
+
+    private:
+        void closeBlock();
+
+        uint16_t block[ADC_FILTER_BLOCK];
+        uint16_t fill;
+        float means[ADC_FILTER_BLOCKS];
+        uint8_t meanPos;
+        uint8_t meanCount;
+        float noiseEstimate;
+        uint32_t blockTotal;
+};
+
+#endif
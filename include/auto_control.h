@@ -2,14 +2,17 @@
 #define AUTO_CONTROL_H
 
 #include "config.h"
-#include "model_final.h"
 
 void setupAutoControl();
 void handleAutoIrrigation();
 void handleAutoCanopy();
+// Quyết định mái che ngay (không chờ AUTO_CONTROL_INTERVAL), gọi khi mưa đổi trạng thái
+void updateCanopy();
 void checkWeatherConditions();
 void checkAutoTurnOff();  
 void setPumpState(bool state);
 void setCanopyState(bool state);
+// Van vùng z qua chuỗi thanh ghi dịch (MODEL_ZONE_COUNT > 1); vùng 0 theo bơm
+void setZoneValve(uint8_t zone, bool open);
 
 #endif
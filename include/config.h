@@ -20,6 +20,7 @@
 #include <WiFiClientSecure.h>
 #include <UniversalTelegramBot.h>
 #include <ArduinoJson.h>
+#include "zone_state.h"
 
 // Các chân pin
 #define DHTPIN 4
@@ -54,7 +55,16 @@
 
 #define EEPROM_AUTOMODE_ADDR 3500
 #define EEPROM_MAGIC_NUMBER 0x1AA1 // 2 bytes
-#define EEPROM_SAVE_INTERVAL 300000 // 5 minutes
+
+// Bản ghi offline (StoredData) nằm trong FlashLog trên phân vùng riêng (partitions.csv),
+// EEPROM chỉ còn giữ autoMode. Bản ghi cũ trong vùng dữ liệu EEPROM ở trên được
+// chuyển sang log một lần lúc khởi động
+#define RECORD_PARTITION_LABEL "records"
+#define RECORD_PARTITION_SUBTYPE 0x40
+#define RECORD_SECTOR_SIZE 4096
+#define RECORD_SAVE_INTERVAL 300000 // 5 minutes
+// Số bản ghi tải lên mỗi lần gọi uploadStoredDataToFirebase (500 ms mỗi bản ghi)
+#define RECORD_UPLOAD_BATCH 40
 
 // Thời gian watchdog timeout
 #define WDT_TIMEOUT 30
@@ -100,14 +110,104 @@ extern const int TELEGRAM_CHAT_COUNT;
 #define LUX_LOW_THRESHOLD 10000
 #define LUX_HIGH_THRESHOLD 20000
 
+// Chế độ suy luận mô hình: bỏ comment để duyệt cây bằng chỉ số bin số nguyên
+// và cộng lá fixed-point (model_quantized.h) thay cho so sánh float (model_table.h).
+// Lá Q16 làm lệch quyết định sát ngưỡng: 70 / 29 triệu điểm lưới của model_bench
+// (~2.4 phần triệu) khác model_final.h; tools/model_bench.cpp lỗi nếu vượt 5 phần triệu
+// #define MODEL_INFERENCE_QUANTIZED
+// Hoặc dùng bảng nén model_compact.h (~6.8 KB thay vì ~18 KB). Đây là bản xấp xỉ,
+// tắt mặc định: lá làm tròn về palette 256 giá trị nên 9782 / 29 triệu điểm lưới
+// (~0.034%) và 1 vector của model/golden_vectors.csv khác model_final.h. model_bench
+// chỉ giới hạn tỉ lệ lật (400 phần triệu), không kiểm tra tương đương
+// #define MODEL_INFERENCE_COMPACT
+// Hoặc suy luận hoàn toàn bằng số nguyên (model_fixed.h): đầu vào Q20, lá Q24, không
+// float hay expf trên đường suy luận nên chạy được trên chip không có FPU
+// #define MODEL_INFERENCE_FIXED
+// Chỉ engine chọn ở trên được link vào firmware. Bật để có lệnh 'm' so sánh mọi định
+// dạng (nested-if, unrolled, fixed, quantized, compact...) trên thiết bị; các bảng đó
+// chiếm thêm flash nên chỉ dùng cho bản đo (env esp32doit-devkit-v1-bench)
+// #define MODEL_BENCHMARK
+
+// Mô hình nạp lúc chạy (LittleFS). File tạm chỉ đổi tên thành MODEL_FILE_PATH
+// khi đã tải đủ và kiểm tra CRC xong
+#define MODEL_FILE_PATH "/model.bin"
+#define MODEL_TMP_PATH "/model.tmp"
+#define MODEL_URL_PATH "/model.url"     // url của file đang dùng, tránh tải lại
+#define MODEL_SWEEP_SLICE_MS 20         // thời gian quét WCET tối đa mỗi vòng loop
+
+// Vùng tưới: vùng z chạy mô hình MODEL_ZONE_MODELS[z] trong model_pool.h (sinh bởi
+// tools/model_export.py --zone-model), nhiều vùng có thể dùng chung một mô hình.
+// Vùng 0 điều khiển bơm. Nhiều hơn 1 vùng thì mọi mô hình chạy chung một lượt
+// (ModelRegistry) thay cho cache lá và bảng vùng của mô hình đơn
+#define MODEL_ZONE_COUNT 1
+#define MODEL_ZONE_MODELS { 0 }
+
 // Các thời gian interval
-#define SENSOR_READ_INTERVAL 5000
 #define FIREBASE_UPLOAD_INTERVAL 300000 // 5 minutes (Lúc demo để 15 giây = 15000)
 #define AUTO_CONTROL_INTERVAL 600000 // 10 minutes (Lúc demo để 30 giây = 30000)
 #define STATUS_UPDATE_INTERVAL 300000 // 5 minutes (Lúc demo để 15 giây = 15000)
 #define HEALTH_CHECK_INTERVAL 600000 // 10 minutes (Lúc demo để 30 giây = 30000)
 #define PUMP_INTERVAL 300000 // 5 minutes (Lúc demo để 10 giây = 10000)
 #define WEATHER_UPDATE_INTERVAL 600000 // 10 minutes (Lúc demo để 30 giây = 30000)
+// Nhịp chạy mô hình, độc lập với lịch lấy mẫu thích nghi (cache lá giữ chi phí thấp)
+#define MODEL_UPDATE_INTERVAL 5000
+
+// Task đọc cảm biến: chạy trên core 0 (loop() chạy trên core 1) theo lịch thích nghi
+// của sensor_scheduler.h, gửi mẫu cho loop qua ring SPSC nên TLS hay Telegram chặn
+// loop không làm trễ việc lấy mẫu
+#define SENSOR_TASK_CORE 0
+#define SENSOR_TASK_PRIORITY 2
+#define SENSOR_TASK_STACK 4096
+// Lũy thừa của 2; tối đa một mẫu mỗi nhịp SENSOR_TICK_MS (1 giây) nên giữ được ~128
+// giây loop bị chặn, đủ cho một lượt tải bản ghi offline (~20 giây) cộng TLS chậm
+#define SENSOR_RING_SIZE 128
+
+// Nguồn số đọc (sensor_hal.h): cảm biến thật, hoặc mô phỏng tất định theo seed để
+// chạy thử cả hệ thống không cần cảm biến
+#define SENSOR_BACKEND_HARDWARE 0
+#define SENSOR_BACKEND_SIMULATED 1
+#define SENSOR_BACKEND SENSOR_BACKEND_HARDWARE
+#define SENSOR_SIM_SEED 1
+// Bỏ comment để in mỗi mẫu thành một dòng CSV trên serial: lưu log lại là có trace
+// cho tools/sensor_replay.cpp
+// #define SENSOR_TRACE_SERIAL
+
+// BH1750 đo one-time hai pha (light_sensor.h). Dải được nâng khi số đếm thô vượt
+// UP_RATIO thang đo, hạ khi dải nhạy hơn chỉ dùng tới DOWN_RATIO thang
+#define LIGHT_I2C_ADDRESS 0x23
+#define LIGHT_RANGE_UP_RATIO 0.9f
+#define LIGHT_RANGE_DOWN_RATIO 0.5f
+
+// Độ ẩm đất: ADC1 chạy liên tục qua DMA (GPIO34 = ADC1 kênh 6), task riêng trên
+// SENSOR_TASK_CORE lọc luồng mẫu (adc_filter.h); task cảm biến chỉ đọc kết quả.
+// Chế độ liên tục của ESP32 không chạy dưới 20 kHz
+#define SOIL_ADC_CHANNEL 6
+#define SOIL_ADC_SAMPLE_HZ 20000
+#define SOIL_ADC_FRAME_BYTES 256        // 128 mẫu mỗi lần DMA báo
+#define SOIL_ADC_BUFFER_BYTES 2048
+#define SOIL_ADC_TASK_PRIORITY 1
+#define SOIL_ADC_TASK_STACK 3072
+// Hiệu chuẩn: { raw đọc được, raw đúng } tăng dần, đo bằng điện áp chuẩn ở chân
+// SOIL_PIN. Mặc định giữ nguyên số đọc (thang mô hình đã học)
+#define SOIL_CALIBRATION { { 0.0f, 0.0f }, { 4095.0f, 4095.0f } }
+
+// Nhiều vùng (MODEL_ZONE_COUNT > 1): đầu dò đất vùng z nối kênh z % 16 của mux 16
+// kênh (CD74HC4067) thứ z / 16, đầu ra các mux chung SOIL_PIN; task ADC DMA quét
+// lần lượt các vùng (zone_scanner.h). Van vùng z là bit z của chuỗi thanh ghi dịch
+// 74HC595 (bit 1 = mở). Vùng 0 vẫn là bơm PUMP_PIN
+#define ZONE_MUX_SELECT_PINS { 13, 14, 16, 17 }   // S0-S3, chung cho mọi mux
+#define ZONE_MUX_ENABLE_PINS { 5, 18, 19, 23 }    // EN (mức thấp) của mux 0-3
+#define ZONE_VALVE_DATA_PIN 25
+#define ZONE_VALVE_CLOCK_PIN 32
+#define ZONE_VALVE_LATCH_PIN 15
+#define ZONE_READING_RING_SIZE 128      // lũy thừa của 2
+
+// Mưa: ngắt cạnh trên RAIN_PIN, mức được chốt khi không có cạnh nào trong
+// RAIN_DEBOUNCE_MS (timer phần cứng RAIN_TIMER_NUM)
+#define RAIN_DEBOUNCE_MS 50
+#define RAIN_TIMER_NUM 1
+#define RAIN_EVENT_RING_SIZE 16         // lũy thừa của 2
+#define RAIN_WET_HOURS 24               // số giờ giữ thời gian ướt
 #define WIFI_RECONNECT_INTERVAL 300000 // 5 minutes 
 
 // Các biến toàn cục
@@ -130,6 +230,7 @@ struct SensorData {
     float temperature = 0;
     float humidity = 0;
     int soilMoisture = 0;
+    float soilNoise = 0;           // nhiễu ước lượng của số đọc đất (thang 0-1023)
     float lightLevel = 0;
     bool rainDetected = false;
     unsigned long lastRead = 0;
@@ -171,8 +272,21 @@ struct ModelPredict {
     bool needIrrigation = false;
     unsigned long lastUpdate = 0;
     bool initialized = false;
+    uint16_t treesEvaluated = 0;        // số cây đã duyệt ở lần suy luận gần nhất (0 = tra bảng vùng)
+    uint32_t inferenceCount = 0;
+    uint32_t treesEvaluatedTotal = 0;
+    uint32_t modelVersion = 0;          // 0 = mô hình built-in
+    uint32_t cacheHits = 0;             // số cây dùng lại lá của lần trước (predictIncremental)
+    uint32_t cacheMisses = 0;           // số cây phải duyệt lại
+    uint8_t poolModel = 0;              // mô hình của vùng trong model_pool.h
+    uint32_t explainCycles = 0;         // chu kỳ CPU của lần giải thích gần nhất (vùng 0)
+    bool sensorFault = false;           // đầu vào mô hình lỗi kéo dài: needIrrigation = false an toàn
 };
-extern ModelPredict modelPredict;
+extern ModelPredict modelPredict[MODEL_ZONE_COUNT];
+
+// Độ ẩm đất và van của từng vùng. Một vùng: vùng 0 lấy theo sensorData
+typedef ZoneStateT<MODEL_ZONE_COUNT> ZoneState;
+extern ZoneState zoneState;
 
 struct WeatherData {
     float rainNext1h = 0.0;        // Lượng mưa dự báo trong 1 giờ tới (mm)
@@ -0,0 +1,34 @@
+#ifndef CONTROL_RULES_H
+#define CONTROL_RULES_H
+
+// Luật quyết định bơm và mái che, tách khỏi auto_control.cpp (Firebase, GPIO) để
+// host chạy đúng cùng luật khi mô phỏng/phát lại trace. Không phụ thuộc Arduino.
+
+#define CANOPY_RAIN_CLOSE_MM 5.0f       // mưa hiện tại + dự báo từ mức này thì đóng mái che
+
+struct ControlInputs {
+    bool needIrrigation;        // kết quả mô hình vùng 0
+    bool sensorFault;           // cảm biến đầu vào mô hình lỗi kéo dài: không có quyết định
+    float rainNext1h;           // mm dự báo trong 1 giờ tới
+    bool rainDetected;
+    float lightLevel;           // lux
+};
+
+enum IrrigationAction {
+    IRRIGATION_KEEP,
+    IRRIGATION_START,
+    IRRIGATION_STOP_MODEL,      // mô hình không còn khuyến nghị tưới
+    IRRIGATION_STOP_FORECAST,   // dự báo có mưa trong 1 giờ tới
+    IRRIGATION_STOP_SENSOR      // cảm biến đầu vào lỗi: tắt cho an toàn
+};
+
+enum CanopyDecision {
+    CANOPY_OPEN,
+    CANOPY_CLOSE_LIGHT,         // không mưa và ánh sáng trên luxHigh
+    CANOPY_CLOSE_RAIN           // đang mưa và dự báo từ CANOPY_RAIN_CLOSE_MM
+};
+
+IrrigationAction decideIrrigation(const ControlInputs& in, bool pumpOn);
+CanopyDecision decideCanopy(const ControlInputs& in, float luxHigh);
+
+#endif
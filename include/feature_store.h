@@ -0,0 +1,159 @@
+#ifndef FEATURE_STORE_H
+#define FEATURE_STORE_H
+
+// Đặc trưng theo cửa sổ trượt cho mô hình (xu hướng độ ẩm đất, ánh sáng từ lúc
+// mặt trời mọc, mưa 24 giờ), cập nhật O(1) mỗi mẫu. Không phụ thuộc Arduino:
+// thời gian truyền vào bằng millis, mọi bộ đệm có kích thước cố định nên bộ nhớ
+// biết trước lúc biên dịch (sizeof(FeatureStore)).
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Bố cục vector đặc trưng. Đổi thứ tự hay ý nghĩa thì tăng phiên bản;
+// tools/model_export.py đọc hai macro này, mô hình dùng MODEL_FEATURE_COUNT mục đầu
+#define FEATURE_LAYOUT_VERSION 1
+#define FEATURE_LAYOUT_NAMES { \
+    "soil", "temperature", "humidity", \
+    "soil_slope_1h", "soil_range_1h", "temperature_mean_1h", "temperature_max_1h", \
+    "humidity_min_1h", "light_mean_since_sunrise", "rain_minutes_24h" }
+
+enum FeatureIndex {
+    FEATURE_SOIL = 0,               // giá trị tức thời (lần đọc gần nhất)
+    FEATURE_TEMPERATURE,
+    FEATURE_HUMIDITY,
+    FEATURE_SOIL_SLOPE_1H,          // soil/giờ theo hồi quy tuyến tính, âm khi đất đang khô
+    FEATURE_SOIL_RANGE_1H,          // max - min trong 1 giờ
+    FEATURE_TEMPERATURE_MEAN_1H,
+    FEATURE_TEMPERATURE_MAX_1H,
+    FEATURE_HUMIDITY_MIN_1H,
+    FEATURE_LIGHT_MEAN_SINCE_SUNRISE,
+    FEATURE_RAIN_MINUTES_24H,       // số phút có mưa trong 24 giờ
+    FEATURE_COUNT
+};
+
+// Cửa sổ 1 giờ, mỗi ô là trung bình các lần đọc trong 1 phút
+#define FEATURE_SLOT_MS 60000ul
+#define FEATURE_WINDOW_MS 3600000ul
+#define FEATURE_WINDOW_SLOTS (FEATURE_WINDOW_MS / FEATURE_SLOT_MS)
+
+// Mưa: 1 bit mỗi phút trong 24 giờ
+#define FEATURE_RAIN_SLOTS 1440
+
+// Mặt trời mọc: lux vượt ngưỡng sau ít nhất FEATURE_NIGHT_MS tối liên tục
+#define FEATURE_SUNRISE_LUX 50.0f
+#define FEATURE_NIGHT_MS (2 * 3600000ul)
+
+// Giới hạn RAM của FeatureStore (static_assert)
+#define FEATURE_STORE_MAX_BYTES 3072
+
+// Cửa sổ trượt theo thời gian: tổng, min/max (hàng đợi đơn điệu) và độ dốc
+// (tổng hồi quy chạy). Mỗi add/expire là O(1) khấu hao.
+template <uint16_t N>
+class RollingWindow {
+    public:
+        explicit RollingWindow(uint32_t spanMs);
+
+        // Thêm mẫu mới nhất (thời gian không giảm) rồi bỏ các mẫu cũ hơn spanMs
+        void add(uint32_t timeMs, float value);
+        void expire(uint32_t nowMs);
+        void reset();
+
+        uint16_t count() const { return size; }
+        // NaN khi cửa sổ rỗng (slope cần ít nhất 2 mẫu khác thời điểm)
+        float mean() const;
+        float min() const;
+        float max() const;
+        float slopePerHour() const;
+
+    private:
+        void evictOldest();
+        void recompute();
+
+        uint32_t span;
+        uint32_t times[N];
+        float values[N];
+        uint16_t head;          // ô của mẫu cũ nhất
+        uint16_t size;
+        // Chỉ số ô trong ring, hàng đợi cũng là ring N phần tử
+        uint16_t minQueue[N];
+        uint16_t maxQueue[N];
+        uint16_t minHead, minSize;
+        uint16_t maxHead, maxSize;
+        // Tổng hồi quy theo giờ kể từ origin. Cộng trừ liên tục làm trôi sai số
+        // nên cứ N lần bỏ mẫu thì tính lại từ đầu (vẫn O(1) khấu hao)
+        uint32_t origin;
+        uint16_t evictions;
+        double sumT, sumV, sumTT, sumTV;
+};
+
+// Số phút có mưa trong FEATURE_RAIN_SLOTS phút gần nhất, 1 bit mỗi phút
+class RainHistory {
+    public:
+        RainHistory();
+
+        void update(uint32_t nowMs, bool raining);
+        void reset();
+
+        uint16_t wetMinutes() const { return wet; }
+
+    private:
+        uint32_t bits[(FEATURE_RAIN_SLOTS + 31) / 32];
+        uint32_t minute;        // phút hiện tại (millis / FEATURE_SLOT_MS)
+        uint16_t pos;           // bit của phút hiện tại
+        uint16_t wet;
+        bool started;
+};
+
+struct FeatureSample {
+    float soil;
+    float temperature;          // NaN nếu DHT lỗi
+    float humidity;
+    float light;                // âm nếu BH1750 lỗi
+    bool raining;
+};
+
+class FeatureStore {
+    public:
+        FeatureStore();
+
+        // Gọi sau mỗi lần đọc cảm biến. Lần đọc được gộp theo phút rồi mới
+        // đưa vào cửa sổ 1 giờ
+        void add(uint32_t nowMs, const FeatureSample& sample);
+        void reset();
+
+        // Ghi FEATURE_COUNT giá trị theo FeatureIndex. Đặc trưng chưa đủ dữ liệu
+        // là NaN; trả về số đặc trưng hợp lệ
+        int vector(float* out) const;
+
+        uint16_t windowSamples() const { return soil.count(); }
+        uint32_t sinceSunriseMs(uint32_t nowMs) const { return nowMs - sunriseMs; }
+        bool sunriseSeen() const { return sunriseDetected; }
+
+    private:
+        struct MinuteMean {
+            float sum;
+            uint16_t count;
+        };
+        void closeMinute();
+
+        RollingWindow<FEATURE_WINDOW_SLOTS> soil;
+        RollingWindow<FEATURE_WINDOW_SLOTS> temperature;
+        RollingWindow<FEATURE_WINDOW_SLOTS> humidity;
+        RainHistory rain;
+        MinuteMean pending[3];  // soil, nhiệt độ, độ ẩm của phút đang gom
+        uint32_t pendingMinute;
+        bool hasPending;
+        FeatureSample latest;
+        bool hasLatest;
+        // Ánh sáng từ lúc mặt trời mọc (hoặc từ lúc khởi động nếu chưa thấy)
+        double lightSum;
+        uint32_t lightCount;
+        uint32_t darkSinceMs;
+        uint32_t sunriseMs;
+        bool dark;
+        bool sunriseDetected;
+};
+
+const char* featureName(int index);
+
+#endif
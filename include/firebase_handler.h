@@ -2,11 +2,17 @@
 #define FIREBASE_HANDLER_H
 
 #include "config.h"
+#include "model_explain.h"
 
 void setupFirebase();
 void uploadSensorData();
+#if MODEL_ZONE_COUNT > 1
+// Độ ẩm, van và quyết định của từng vùng tại ROOT/zones/<zz> (gọi từ uploadSensorData)
+void uploadZoneData(const String& timestamp);
+#endif
 void uploadSystemStatus();
-void uploadAlerts(String alertType, String message);
+// explanation: đóng góp của từng đặc trưng khi cảnh báo do mô hình quyết định
+void uploadAlerts(String alertType, String message, const ModelExplanation* explanation = nullptr);
 void uploadControlStatus();
 void processData(AsyncResult &aResult);
 void processControlCommands(AsyncResult &aResult);
@@ -0,0 +1,106 @@
+#ifndef FLASH_LOG_H
+#define FLASH_LOG_H
+
+// Log bản ghi chỉ ghi nối trên flash NOR (phân vùng riêng), thay cho việc ghi lại
+// cả sector EEPROM giả lập mỗi bản ghi. Mỗi sector bắt đầu bằng header (magic, số
+// thứ tự, số lần xóa), sau đó là các ô bản ghi cố định:
+//
+//   [crc32 của payload][payload, đệm tới 4 byte][dấu đã lấy: 0xFFFFFFFF / 0]
+//
+// Bản ghi nối vào sector đầu (head); đầy thì mở sector kế tiếp theo vòng (xóa rồi
+// ghi header với số thứ tự + 1), nên mọi sector bị xóa đều nhau. Lấy bản ghi cũ nhất
+// (tail) chỉ xóa bit trong dấu đã lấy, không xóa sector. Lúc khởi động head/tail
+// được dựng lại từ header các sector và tìm nhị phân trong sector. Ghi dở khi mất
+// điện cho crc sai và bị bỏ qua. Không phụ thuộc Arduino: flash đi qua FlashDevice.
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define FLASH_LOG_MAGIC 0x31474C46u     // "FLG1"
+#define FLASH_LOG_HEADER_BYTES 16
+#define FLASH_LOG_MAX_RECORD 64
+
+// Flash NOR: xóa cả sector về 0xFF, ghi chỉ đổi bit 1 -> 0
+class FlashDevice {
+    public:
+        virtual ~FlashDevice() {}
+
+        virtual uint32_t sectorSize() const = 0;
+        virtual uint16_t sectorCount() const = 0;
+        virtual bool read(uint32_t address, void* data, uint32_t length) = 0;
+        virtual bool write(uint32_t address, const void* data, uint32_t length) = 0;
+        virtual bool erase(uint16_t sector) = 0;
+};
+
+class FlashLog {
+    public:
+        // recordSize byte mỗi bản ghi (tối đa FLASH_LOG_MAX_RECORD), cần ít nhất 2 sector
+        FlashLog(FlashDevice& device, uint16_t recordSize);
+
+        // Dựng lại head/tail từ flash; phân vùng trống hoặc hỏng thì định dạng lại.
+        // false nếu flash lỗi hoặc cấu hình không hợp lệ
+        bool begin();
+
+        // Nối một bản ghi. Log đầy thì sector cũ nhất bị xóa (mất các bản ghi chưa lấy
+        // trong đó, tính vào dropped)
+        bool append(const void* record);
+        // Bản ghi cũ nhất chưa lấy; false khi hết. Ô hỏng (ghi dở) tự bị bỏ qua
+        bool peek(void* record);
+        // Đánh dấu bản ghi cũ nhất đã lấy (sau peek thành công)
+        bool consume();
+
+        uint32_t pending() const;       // số ô chưa lấy (kể cả ô hỏng chưa gặp)
+        // Số bản ghi giữ được chắc chắn (sector đầu đang ghi dở không tính)
+        uint32_t capacity() const { return (uint32_t)slots * (sectors - 1); }
+        uint16_t slotsPerSector() const { return slots; }
+
+        uint32_t appends() const { return appendCount; }
+        uint32_t erases() const { return eraseCount; }
+        uint32_t dropped() const { return droppedCount; }
+        uint32_t corrupt() const { return corruptCount; }
+        // Số lần xóa lớn nhất của một sector (từ header lúc begin, cập nhật khi xóa)
+        uint32_t maxWear() const { return wearMax; }
+        // Số lần đọc flash của lần begin() cuối
+        uint32_t recoveryReads() const { return readsAtBegin; }
+
+    private:
+        struct Header {
+            uint32_t magic;
+            uint32_t sequence;
+            uint32_t eraseCount;
+            uint32_t crc;
+        };
+
+        bool readHeader(uint16_t sector, Header& header);
+        bool openSector(uint16_t sector, uint32_t sequence);
+        uint32_t slotAddress(uint16_t sector, uint16_t slot) const;
+        bool slotEmpty(uint16_t sector, uint16_t slot);
+        bool slotConsumed(uint16_t sector, uint16_t slot);
+        void normalizeTail();
+        bool countedRead(uint32_t address, void* data, uint32_t length);
+
+        FlashDevice& flash;
+        uint16_t payloadSize;
+        uint16_t slotSize;
+        uint16_t slots;
+        uint16_t sectors;
+        bool ready;
+        // Vị trí: sector vật lý, số thứ tự của sector đó, ô trong sector
+        uint16_t headSector;
+        uint32_t headSequence;
+        uint16_t headSlot;
+        uint16_t tailSector;
+        uint32_t tailSequence;
+        uint16_t tailSlot;
+        uint32_t appendCount;
+        uint32_t eraseCount;
+        uint32_t droppedCount;
+        uint32_t corruptCount;
+        uint32_t wearMax;
+        uint32_t reads;
+        uint32_t readsAtBegin;
+};
+
+uint32_t flashLogCrc32(const void* data, size_t length);
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef FLASH_PARTITION_H
+#define FLASH_PARTITION_H
+
+// FlashDevice trên một phân vùng data của ESP32 (partitions.csv), dùng cho FlashLog.
+// Địa chỉ tính từ đầu phân vùng; esp_partition_* kiểm tra giới hạn và mã hóa flash.
+
+#include "config.h"
+#include "flash_log.h"
+#include "esp_partition.h"
+
+class PartitionFlash : public FlashDevice {
+    public:
+        PartitionFlash();
+
+        // false nếu bảng phân vùng không có phân vùng RECORD_PARTITION_LABEL
+        bool begin();
+
+        uint32_t sectorSize() const override { return RECORD_SECTOR_SIZE; }
+        uint16_t sectorCount() const override;
+        bool read(uint32_t address, void* data, uint32_t length) override;
+        bool write(uint32_t address, const void* data, uint32_t length) override;
+        bool erase(uint16_t sector) override;
+
+    private:
+        const esp_partition_t* partition;
+};
+
+#endif
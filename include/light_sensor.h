@@ -0,0 +1,51 @@
+#ifndef LIGHT_SENSOR_H
+#define LIGHT_SENSOR_H
+
+// BH1750 đo theo hai pha ở chế độ one-time: trigger() gửi một byte lệnh rồi trả về
+// ngay, nơi gọi làm việc khác (DHT11, đất) và chỉ collect() sau thời gian chuyển đổi
+// tối đa của dải hiện tại. Dải (chế độ + MTreg) tự đổi theo số đếm thô: nắng gắt
+// thì giảm MTreg để không tràn thang trên LUX_HIGH_THRESHOLD, trời tối thì dùng
+// HIGH_RES_MODE_2 với MTreg lớn để tăng độ phân giải.
+
+#include "config.h"
+
+struct LightRange {
+    BH1750::Mode mode;
+    uint8_t mtreg;
+};
+
+class LightSensor {
+    public:
+        explicit LightSensor(BH1750& meter);
+
+        // Cấu hình dải mặc định và bắt đầu lần đo đầu tiên
+        bool begin();
+
+        // Bắt đầu một lần đo ở dải hiện tại; false nếu I2C không ACK
+        bool trigger();
+        // ms còn lại tới khi chắc chắn có kết quả (0: đọc được)
+        uint32_t remainingMs() const;
+        // Lux của lần đo (âm nếu lỗi). Chọn dải cho lần sau; true ở rangeRaised nếu số
+        // đếm chạm trần và đã nâng dải, khi đó nên đo lại ngay
+        float collect(bool& rangeRaised);
+
+        uint8_t range() const { return current; }
+        uint8_t mtreg() const;
+        float fullScaleLux() const;
+        uint32_t rangeSwitches() const { return switches; }
+        // Thời gian các lệnh I2C tích lũy từ lần gọi trước (micro giây)
+        uint32_t takeBusUs();
+
+    private:
+        bool applyRange();
+
+        BH1750& meter;
+        uint8_t current;
+        bool rangeDirty;
+        uint32_t startMs;
+        uint32_t conversionMs;
+        uint32_t busUs;
+        uint32_t switches;
+};
+
+#endif
@@ -0,0 +1,15 @@
+#ifndef MODEL_BATCH_H
+#define MODEL_BATCH_H
+
+// Suy luận theo lô để chạy lại dữ liệu sensors/history trên host.
+// TreeEnsemble::predictBatch dùng được cả trên ESP32 (nhánh scalar).
+
+#include "model_engine.h"
+
+#ifndef ARDUINO
+// Chia lô cho nhiều luồng, mỗi luồng gọi predictBatch trên một đoạn liền nhau.
+// threads = 0: dùng số lõi của máy.
+void predictBatchParallel(const TreeEnsemble& engine, const float* X, size_t n, uint8_t* out, unsigned threads = 0);
+#endif
+
+#endif
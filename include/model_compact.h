@@ -0,0 +1,266 @@
+// model_compact.h
+// Sinh tự động bởi tools/model_export.py từ irrigation_xgb.json - không sửa tay.
+
+#ifndef MODEL_COMPACT_H
+#define MODEL_COMPACT_H
+
+#include "model_engine.h"
+
+// 1101 split -> 1100 node sau khi gộp cây con trùng, 1142 lá -> palette 256 giá trị
+// Sai số lá lớn nhất 39 / 2^16
+#define MODEL_COMPACT_NODE_COUNT 1100
+#define MODEL_COMPACT_PALETTE_SIZE 256
+
+static const float MODEL_COMPACT_SOIL_THRESHOLDS[109] = {
+    252.730637f, 257.416229f, 283.323853f, 296.413544f, 314.835846f, 321.81543f, 330.207428f, 341.632965f,
+    345.389679f, 349.312317f, 351.355896f, 359.514069f, 363.807678f, 367.197571f, 375.313019f, 386.113647f,
+    397.247711f, 405.567444f, 407.900116f, 414.901276f, 417.264038f, 419.505035f, 423.757202f, 430.821411f,
+    435.861267f, 437.694153f, 440.630371f, 443.64624f, 447.999878f, 450.725037f, 458.729126f, 463.607178f,
+    467.623199f, 471.12204f, 479.104919f, 481.389587f, 484.002502f, 500.492676f, 504.642822f, 519.741882f,
+    527.904602f, 531.149597f, 534.459778f, 538.327454f, 541.012268f, 544.882202f, 552.700989f, 560.389099f,
+    563.617065f, 568.22876f, 571.920654f, 576.561096f, 581.963745f, 585.01825f, 590.554199f, 597.551147f,
+    601.795471f, 604.238281f, 616.029846f, 619.163086f, 622.761047f, 625.170166f, 637.041443f, 638.904846f,
+    645.976685f, 648.651367f, 658.263f, 667.424072f, 688.57074f, 695.823792f, 701.65979f, 710.787048f,
+    718.093689f, 721.237366f, 723.110596f, 726.876038f, 729.404663f, 732.35437f, 734.138062f, 738.240356f,
+    741.785583f, 757.170593f, 763.647339f, 768.336487f, 770.63739f, 775.067749f, 776.132446f, 782.425354f,
+    785.920593f, 790.879639f, 794.703064f, 819.484436f, 822.795776f, 827.341675f, 832.5177f, 839.991638f,
+    841.305298f, 856.504456f, 858.644775f, 862.270081f, 870.471802f, 882.741455f, 892.300537f, 902.922058f,
+    906.185242f, 921.656555f, 939.830566f, 944.020081f, 947.555847f,
+};
+
+static const float MODEL_COMPACT_TEMPERATURE_THRESHOLDS[106] = {
+    19.2320633f, 20.0188656f, 20.1292877f, 20.2102623f, 20.3994579f, 20.6348743f, 20.7292194f, 20.7989597f,
+    20.8813152f, 21.0124493f, 21.1400452f, 21.2505245f, 21.3451176f, 21.4206963f, 22.2793179f, 22.5222015f,
+    22.5935783f, 22.6435928f, 22.7132282f, 22.9432659f, 23.2289524f, 23.5818996f, 23.9091587f, 24.0817528f,
+    24.2286224f, 24.3926964f, 24.7294979f, 24.8134098f, 24.8679314f, 24.9743233f, 25.0434551f, 25.1329422f,
+    25.2266598f, 25.3599434f, 25.5413857f, 25.6510048f, 25.7303886f, 25.9988403f, 26.1693649f, 26.2437935f,
+    26.3607903f, 26.7441292f, 27.5947475f, 27.744463f, 28.2634487f, 28.5101128f, 28.5788841f, 28.6260338f,
+    28.8836689f, 28.9362946f, 29.6646404f, 29.7018929f, 29.7924881f, 30.0575085f, 30.1104145f, 30.2116146f,
+    30.2948437f, 30.384491f, 30.5218792f, 30.6314411f, 30.7131329f, 30.8253994f, 30.8926163f, 31.1099033f,
+    31.3860989f, 31.5423393f, 31.5958576f, 31.9208717f, 32.1663895f, 32.2109337f, 32.3084106f, 32.5350685f,
+    32.6003685f, 32.6594925f, 32.8193092f, 33.2605438f, 33.3304367f, 33.4218636f, 33.5487595f, 33.7817535f,
+    33.8789864f, 34.1479378f, 34.6546669f, 34.8325424f, 34.8576279f, 34.9676857f, 35.1345978f, 35.2870636f,
+    35.3305435f, 35.5903358f, 36.1142883f, 36.2934189f, 36.5741768f, 36.8433037f, 37.0409698f, 37.1719971f,
+    37.4105377f, 37.7319069f, 37.8016739f, 38.1835022f, 38.3000298f, 38.3529434f, 38.5422096f, 38.9004784f,
+    38.9854584f, 39.1129875f,
+};
+
+static const float MODEL_COMPACT_HUMIDITY_THRESHOLDS[122] = {
+    40.0642738f, 40.3054695f, 40.4365158f, 40.996048f, 41.4611816f, 41.6887894f, 41.8031082f, 42.1177483f,
+    42.3556175f, 42.4820442f, 42.7032928f, 43.2635002f, 43.5045547f, 43.9408569f, 44.4773293f, 44.8780136f,
+    45.089489f, 45.686657f, 45.7290306f, 45.8896484f, 46.0391083f, 46.442112f, 46.7297173f, 46.8502693f,
+    47.0088196f, 47.1228828f, 48.0908966f, 48.2610779f, 48.5084915f, 49.2791176f, 49.6210556f, 49.6859665f,
+    50.2390213f, 50.8559914f, 51.1242714f, 51.3940468f, 51.5628548f, 51.6752129f, 51.8712692f, 52.2610207f,
+    52.7929726f, 52.9265976f, 53.4475784f, 53.7436066f, 54.2410927f, 54.3874397f, 54.5997162f, 54.9958763f,
+    55.1740875f, 55.3870468f, 55.5911179f, 55.9880295f, 56.2749748f, 56.4054871f, 56.715847f, 57.2381172f,
+    57.5607338f, 57.7745628f, 57.912468f, 58.0878334f, 58.2117615f, 58.3609047f, 58.911232f, 59.2451096f,
+    59.4178658f, 59.7402267f, 60.7390938f, 61.101387f, 61.2290306f, 61.4699364f, 61.7001305f, 61.8882256f,
+    62.0385475f, 62.1497269f, 62.6410065f, 62.937542f, 63.2933426f, 63.4145584f, 63.751545f, 65.1251373f,
+    65.2610092f, 65.4638367f, 65.8288727f, 66.0044632f, 66.1435776f, 66.7874527f, 67.8146362f, 67.9678268f,
+    68.1291199f, 68.5820541f, 69.0979462f, 69.243866f, 69.2937241f, 69.4708176f, 70.4786758f, 70.602066f,
+    71.1944275f, 71.6289825f, 72.2822266f, 72.4277267f, 72.5990067f, 72.9267349f, 73.2763596f, 73.4998932f,
+    73.7191849f, 73.8990784f, 74.1281662f, 74.5640182f, 76.1152267f, 76.4636459f, 77.484726f, 77.688858f,
+    78.0548477f, 78.5994492f, 78.6886444f, 78.805069f, 79.2100067f, 79.6292648f, 79.7098465f, 80.5668564f,
+    81.2489395f, 82.4489441f,
+};
+
+static const int16_t MODEL_COMPACT_PALETTE[MODEL_COMPACT_PALETTE_SIZE] = {
+    -17857, -17705, -15635, -15525, -14688, -14160, -13943, -13847, -13600, -13372, -13070, -12974, -12711, -12458, -12192, -12016,
+    -11779, -11686, -11575, -11470, -11345, -11219, -11019, -10932, -10849, -10735, -10570, -10439, -10374, -10255, -10111, -9993,
+    -9852, -9774, -9688, -9621, -9532, -9441, -9352, -9223, -9129, -9026, -8913, -8848, -8733, -8644, -8550, -8473,
+    -8373, -8284, -8208, -8107, -8023, -7938, -7854, -7779, -7693, -7601, -7514, -7422, -7332, -7226, -7140, -6978,
+    -6881, -6794, -6718, -6622, -6520, -6405, -6301, -6209, -6106, -5975, -5903, -5792, -5711, -5586, -5516, -5399,
+    -5309, -5237, -5145, -4994, -4886, -4777, -4705, -4568, -4478, -4380, -4261, -4156, -4034, -3931, -3866, -3769,
+    -3642, -3559, -3459, -3318, -3228, -3158, -3038, -2930, -2810, -2744, -2557, -2494, -2387, -2277, -2200, -2123,
+    -2032, -1893, -1818, -1727, -1580, -1464, -1382, -1311, -1236, -1140, -1043, -956, -870, -786, -698, -609,
+    -511, -422, -337, -257, -174, -17, 53, 149, 249, 321, 409, 489, 575, 686, 771, 855,
+    942, 1028, 1123, 1213, 1311, 1390, 1487, 1551, 1674, 1759, 1858, 1939, 2047, 2161, 2247, 2323,
+    2465, 2586, 2683, 2772, 2858, 2954, 3098, 3186, 3303, 3375, 3473, 3589, 3672, 3744, 3842, 3964,
+    4066, 4151, 4237, 4336, 4431, 4511, 4597, 4723, 4899, 4985, 5129, 5208, 5310, 5430, 5507, 5596,
+    5683, 5774, 5874, 5957, 6040, 6130, 6224, 6301, 6414, 6501, 6588, 6667, 6745, 6854, 6959, 7071,
+    7147, 7257, 7364, 7455, 7563, 7635, 7740, 7832, 7903, 8024, 8099, 8168, 8314, 8380, 8496, 8582,
+    8659, 8911, 9036, 9120, 9206, 9327, 9411, 9613, 9684, 9771, 9922, 10101, 10175, 10380, 10540, 10613,
+    10732, 10873, 11100, 11394, 11543, 11628, 11762, 11908, 12079, 12256, 12406, 12637, 13543, 13990, 14095, 14268,
+};
+
+static const uint32_t MODEL_COMPACT_NODES[MODEL_COMPACT_NODE_COUNT] = {
+    0x00800098, 0x0038004c, 0x00180210, 0x00300195, 0x002a3e0d, 0x00dc1309, 0x01c766f6, 0x00580129,
+    0x00140072, 0x008c006c, 0x06cd4a64, 0x0070011e, 0x07e4017d, 0x0437a2b6, 0x00782749, 0x03df2b82,
+    0x00e000f4, 0x00c00119, 0x00b0013a, 0x00a800cc, 0x02272a2e, 0x033f7ac6, 0x00b80ad1, 0x0754bac8,
+    0x07ec0165, 0x00d8016e, 0x0627e2d2, 0x0524e2c4, 0x01180049, 0x0108013c, 0x010000c6, 0x041f26f8,
+    0x04947fb6, 0x01105e05, 0x02f7c7a8, 0x01380150, 0x0130015a, 0x0757ff28, 0x0785aebd, 0x01417a02,
+    0x048ffbb0, 0x01d000cc, 0x01800058, 0x01600e10, 0x01780191, 0x01723a0d, 0x015c2b09, 0x01af5afe,
+    0x01b0013d, 0x01a8013a, 0x01a00115, 0x0166922e, 0x02ef7331, 0x003d6a5c, 0x01bbe6d6, 0x01c80171,
+    0x049c5288, 0x044fcfde, 0x02300079, 0x0218013c, 0x020000e6, 0x01f8010c, 0x0256c2f8, 0x07768e45,
+    0x021001b6, 0x00edc74a, 0x00f753d6, 0x0220ce09, 0x029401b0, 0x07d78f8c, 0x025800f4, 0x07b400e5,
+    0x025000ee, 0x0457c6c5, 0x010df30e, 0x0261e602, 0x02700172, 0x0477efb0, 0x07d6db38, 0x030800b4,
+    0x02c0004c, 0x02901a10, 0x02a8012a, 0x066c011e, 0x04f4b791, 0x02b80048, 0x02d43395, 0x04fcc77e,
+    0x02e80145, 0x006c0122, 0x02e00115, 0x010dea3e, 0x06ed9a70, 0x02f3bafe, 0x03000195, 0x04ad0688,
+    0x076e9e6c, 0x036000f4, 0x034800fd, 0x033000a6, 0x032baa5d, 0x0614da69, 0x034000ad, 0x01f42255,
+    0x01b6bf26, 0x07a40139, 0x071400c8, 0x026f02c0, 0x03980049, 0x03880160, 0x038000d6, 0x02cf0a39,
+    0x0455373c, 0x03915a09, 0x0327bba8, 0x03b80150, 0x03b0015a, 0x06b7df28, 0x070daabd, 0x03c18602,
+    0x0477d7b0, 0x04780098, 0x0420004c, 0x03f00010, 0x005c001e, 0x0594636d, 0x0408012a, 0x063c011e,
+    0x01ae1218, 0x04180048, 0x02ec4f95, 0x04ecdae9, 0x0450013d, 0x044800ae, 0x044000d5, 0x00764e3d,
+    0x05ad9e5a, 0x035c572d, 0x04700182, 0x0468017d, 0x03ef62b6, 0x0796aa54, 0x05b4ae8c, 0x04d000f4,
+    0x04b80119, 0x04a8013a, 0x04a000d0, 0x02e74a26, 0x035746c6, 0x04b04ad1, 0x07052ac8, 0x04c3bf4a,
+    0x07640171, 0x0544deb0, 0x05080049, 0x04f80160, 0x04f0009e, 0x0725ef28, 0x01a5ef44, 0x05016609,
+    0x0337a3a8, 0x079c0161, 0x0520014c, 0x04c79372, 0x02efb3b0, 0x05f000b4, 0x05800058, 0x05580010,
+    0x05483b91, 0x0552d626, 0x03745a08, 0x05700191, 0x056a6a0d, 0x024c8309, 0x057b82f6, 0x010e63a1,
+    0x05b8011d, 0x05a0003e, 0x05991a0e, 0x03df3661, 0x05b000cd, 0x00dd8a1d, 0x012e3701, 0x05d80122,
+    0x05d000b6, 0x07667e12, 0x06be42e2, 0x05e80171, 0x03ac775d, 0x0736428c, 0x064800ad, 0x0630013c,
+    0x061800a6, 0x0774008d, 0x063dfed0, 0x062800f4, 0x026c4255, 0x0286634a, 0x0638aa05, 0x039c01b0,
+    0x072efa31, 0x07840161, 0x067000f0, 0x0668013a, 0x06d682fd, 0x053c92d1, 0x0679ca02, 0x05af8b4d,
+    0x07000098, 0x06a00010, 0x009c001e, 0x058c976d, 0x06c80109, 0x06b37201, 0x06c00018, 0x01860f6a,
+    0x011dc206, 0x06e80050, 0x06e00141, 0x0605c731, 0x044ca795, 0x06f80149, 0x00e69b0a, 0x0527aab6,
+    0x076800f4, 0x07480119, 0x0730013a, 0x07280026, 0x045f6ae0, 0x050d9ad0, 0x074000d1, 0x029456e0,
+    0x0644e35e, 0x074c0165, 0x0760016e, 0x06ce86a8, 0x04ad27ba, 0x07a00049, 0x07880160, 0x019c01ce,
+    0x069de7b6, 0x0798005e, 0x02bf2374, 0x072da609, 0x075c0161, 0x07b8014c, 0x049f6f5a, 0x02ef87b0,
+    0x0840008c, 0x07e80010, 0x07d85b91, 0x07e2ce26, 0x03bc8208, 0x08280195, 0x081000da, 0x0808010d,
+    0x01af5a01, 0x05e5ba58, 0x0820014e, 0x0454fe80, 0x012d7e14, 0x083383a5, 0x083b62e6, 0x03ecce40,
+    0x089800d8, 0x08800145, 0x0870013a, 0x086800a5, 0x015dde9a, 0x0366b6bc, 0x087866e1, 0x016efb01,
+    0x07640171, 0x08935efa, 0x05cc5b7e, 0x08d80079, 0x08c00128, 0x08b800e6, 0x06661f0c, 0x0226d611,
+    0x08d00009, 0x0374ab4a, 0x02cf3bb0, 0x07440161, 0x08f00172, 0x031f6b59, 0x06ddfb34, 0x0968008c,
+    0x09200010, 0x09106b91, 0x091abe26, 0x03c49a08, 0x09580195, 0x094800da, 0x0940010d, 0x01e74a01,
+    0x04ecf22a, 0x00d401c2, 0x057cffba, 0x030c01b2, 0x06d6263c, 0x09d000f4, 0x09b000ed, 0x099800ca,
+    0x099000d0, 0x02d67e2e, 0x037f3eec, 0x09a8013a, 0x04d4a702, 0x032c6ee0, 0x0714015d, 0x09c800c8,
+    0x01c65ac0, 0x051f7376, 0x0a080079, 0x09f8013c, 0x09f000e6, 0x0635a62d, 0x0115ea61, 0x0a00da05,
+    0x02e72fb0, 0x0a11a202, 0x0a200164, 0x053f775a, 0x048787b0, 0x0aa000b4, 0x0a480010, 0x00f4001e,
+    0x0584d36d, 0x0a700111, 0x0a5b3a01, 0x0a680126, 0x064d3716, 0x02d4a6e5, 0x0a880048, 0x0a838f21,
+    0x01bdb6b2, 0x0a980122, 0x072ea37d, 0x0484cb35, 0x0af800ad, 0x0ae0013c, 0x0ac800a6, 0x073c008a,
+    0x0386e676, 0x0ad800a1, 0x03b4a2dc, 0x007dcec8, 0x0ae8ee05, 0x03bc01b0, 0x068eae31, 0x071c0169,
+    0x0b2000f4, 0x0b18013a, 0x04e78ec5, 0x067d5bde, 0x0b29c60a, 0x06fefb6c, 0x0ba8008c, 0x0b580010,
+    0x0b487f91, 0x0b50b600, 0x026f32c2, 0x0b900195, 0x0b80014e, 0x0b78010d, 0x021e223d, 0x02be36d6,
+    0x00fc005c, 0x03fcde48, 0x0b9b5fa5, 0x0ba33ae6, 0x03ccf640, 0x06f40161, 0x0be000d4, 0x0bd0013a,
+    0x086800a5, 0x025e563e, 0x0bd896e1, 0x0226f301, 0x0c000150, 0x0bf80152, 0x06164259, 0x05d596d1,
+    0x02d401b0, 0x0685de25, 0x0c780088, 0x0c380010, 0x0c288b91, 0x0c30c600, 0x027f16c2, 0x0c600195,
+    0x0c580142, 0x05a4013e, 0x030ed20d, 0x01ddca14, 0x031c01b2, 0x0c737ba5, 0x030f2ee6, 0x06d40161,
+    0x0cc000f4, 0x0ca800d2, 0x0ca0008d, 0x0246365d, 0x06de868e, 0x0cb800ed, 0x037cf6e0, 0x03970709,
+    0x0ce00049, 0x0cd80160, 0x017e0fce, 0x064dc25e, 0x0cf00172, 0x02bf2359, 0x0635b720, 0x0d400058,
+    0x0d089a0c, 0x0d300199, 0x0d18863a, 0x0d280136, 0x05f58f1e, 0x032cb634, 0x0d3baef6, 0x01a627a1,
+    0x0da800d8, 0x0d80013d, 0x0d700142, 0x0d68002e, 0x0636120e, 0x03bcbe56, 0x014c01a6, 0x05751792,
+    0x0d9000b6, 0x071e6212, 0x0da00181, 0x046cfe84, 0x04cf5bca, 0x0de00079, 0x0dc80114, 0x0dc38211,
+    0x02576ae4, 0x0dd80009, 0x0384bb5e, 0x03fee3d6, 0x06bc0161, 0x0df80172, 0x02df1359, 0x068e1764,
+    0x0e680058, 0x0e20000c, 0x0134001a, 0x04253f25, 0x0e48010d, 0x0e30a26e, 0x0e400126, 0x01f64e44,
+    0x0374c6e5, 0x0e535f21, 0x0e600048, 0x020df6c2, 0x05e58aea, 0x0ee000f4, 0x0eb0013d, 0x0e9800ca,
+    0x0e900092, 0x007e467e, 0x049fa2a6, 0x0ea80102, 0x0374b701, 0x02c7370a, 0x0ec800d6, 0x0ec2520e,
+    0x06fe7660, 0x0ed80171, 0x054d5aac, 0x03ef43de, 0x0f1800b5, 0x0f080140, 0x0f00014a, 0x03d6d31c,
+    0x00a5e295, 0x0f110a05, 0x0326fbb0, 0x0f215e0a, 0x0f30016c, 0x05174324, 0x050f63ac, 0x0f90008c,
+    0x0f600010, 0x0f50a391, 0x0f58ee00, 0x03eebe66, 0x013c01c2, 0x0f800195, 0x060401ba, 0x03167e18,
+    0x0f8b6fa5, 0x032f0ee6, 0x10000161, 0x0fd000d4, 0x0fc0013a, 0x0fb800bc, 0x06b5fab4, 0x01769e32,
+    0x0fc8bee1, 0x028eeb01, 0x0ff00150, 0x0fe800aa, 0x04571330, 0x05e5d6e5, 0x0ff9460a, 0x0605be25,
+    0x06d40175, 0x10135356, 0x065c0160, 0x02265ac8, 0x10880058, 0x1040000c, 0x014c001a, 0x04155af9,
+    0x1068010d, 0x1050b66e, 0x10600126, 0x021e5a44, 0x038ce2e5, 0x10734b21, 0x10800048, 0x04e55399,
+    0x05cd9aea, 0x10f80169, 0x10c800d8, 0x10b800d6, 0x10b000f5, 0x02fe862e, 0x066e1652, 0x10c09ef2,
+    0x026e2f42, 0x10e80150, 0x10e000e5, 0x03c6ceaa, 0x03372f34, 0x10f15a0a, 0x05f5c625, 0x1118008c,
+    0x026c0182, 0x06cc017d, 0x04067678, 0x11235bda, 0x065da779, 0x11a00058, 0x1140000c, 0x0155961a,
+    0x1168010d, 0x1150c26e, 0x11600126, 0x022e5244, 0x039ceee5, 0x11880141, 0x118000ae, 0x02f6d21c,
+    0x078dba2c, 0x11980191, 0x051d3650, 0x028782f6, 0x12200169, 0x11e800f4, 0x11d000d6, 0x11c800f5,
+    0x04cd7ab0, 0x055f8268, 0x11e00080, 0x016e0260, 0x04457aed, 0x12080049, 0x12000160, 0x01a5fbce,
+    0x05dd925e, 0x12180172, 0x053f4b1c, 0x05c5c338, 0x1240008c, 0x02940182, 0x06b4017d, 0x04067278,
+    0x124b4fda, 0x064daf79, 0x12a00058, 0x1268000c, 0x01659e1a, 0x01ac01c2, 0x1290010d, 0x12880096,
+    0x01666619, 0x02765726, 0x129b1721, 0x051daf99, 0x12f80169, 0x12e0013c, 0x12c8014a, 0x005c0134,
+    0x05be1af4, 0x12d800c1, 0x014dbe99, 0x04dd4ea0, 0x12e91a05, 0x12f1620a, 0x031ed3b0, 0x1318008c,
+    0x02ac0182, 0x069c017d, 0x040e6a78, 0x132347da, 0x0635b779, 0x13900050, 0x1340000c, 0x016da61a,
+    0x1368012a, 0x071c011e, 0x13600199, 0x03a4ce3a, 0x03f776c2, 0x13800034, 0x03b40199, 0x01859e7d,
+    0x01cc0155, 0x062d12dd, 0x14000169, 0x13c800d8, 0x13b80145, 0x019401a6, 0x037eb226, 0x13c37660,
+    0x039ef2d6, 0x13e80079, 0x13e00114, 0x02cf6a11, 0x050d1609, 0x13f8017a, 0x050f0b1c, 0x0605ef5c,
+    0x142001da, 0x14137286, 0x061c00be, 0x05cd832c, 0x14298aa4, 0x0466f75c, 0x14480010, 0x1440b791,
+    0x022e96c2, 0x14a000b4, 0x14780111, 0x1462fe05, 0x14700018, 0x0575d271, 0x03a54ab9, 0x149801d2,
+    0x14900088, 0x056df795, 0x03ff074e, 0x037ce785, 0x14d80079, 0x14c80114, 0x14c00011, 0x070e0ae8,
+    0x01ae0700, 0x14d12609, 0x03669bd6, 0x14f00169, 0x14eba2b8, 0x0525bad8, 0x14fb5f18, 0x06257f2c,
+    0x15200010, 0x1510bf91, 0x023c00c2, 0x057e1a04, 0x157000b4, 0x156801d2, 0x15500111, 0x15480018,
+    0x0695ae8e, 0x03e56eb9, 0x15600020, 0x02163e92, 0x05963f89, 0x0384c385, 0x15a80169, 0x15980150,
+    0x1590007e, 0x03a6e330, 0x04a5cead, 0x15a12602, 0x0585b625, 0x15b35718, 0x15b98b2c, 0x045f1bde,
+    0x15e00010, 0x15d0c391, 0x024c00c2, 0x05661a04, 0x162800b4, 0x162001d2, 0x16080111, 0x1602f605,
+    0x03cd5a96, 0x161800d6, 0x055dca36, 0x0464b2ea, 0x038ccf85, 0x16680169, 0x16500158, 0x1648007e,
+    0x06be766a, 0x04659649, 0x166001b0, 0x05757e0a, 0x0474cb26, 0x16734f18, 0x1679972c, 0x045f0fde,
+    0x16980010, 0x1690c791, 0x05053200, 0x170800f4, 0x16d8013a, 0x16c000f9, 0x00ac00d9, 0x04ddc292,
+    0x16d00058, 0x05ddcb1e, 0x047ef6ba, 0x16f000d1, 0x018c0099, 0x06555e91, 0x170000f1, 0x06be3e90,
+    0x0465838e, 0x17380049, 0x1730003d, 0x1728002d, 0x02b68615, 0x05958b10, 0x0394fabe, 0x175000fc,
+    0x174b6f86, 0x05f5eaa9, 0x17600108, 0x0216678a, 0x062e7fe2, 0x17880010, 0x1778cb91, 0x026400c2,
+    0x04569a42, 0x17d00098, 0x01d401d2, 0x17b80109, 0x17b00018, 0x0675be8e, 0x0215ba84, 0x17c800b2,
+    0x05759236, 0x051dc39e, 0x18100175, 0x17f80164, 0x17f00152, 0x0497162e, 0x03f48f66, 0x18080082,
+    0x01fe5f0d, 0x05de5689, 0x181b5324, 0x1821e750, 0x04e72b9d, 0x18480010, 0x1838cf91, 0x027400c2,
+    0x053e1e04, 0x189000d8, 0x188801d2, 0x18780195, 0x187000bc, 0x05f5f2b4, 0x041d12b1, 0x06740050,
+    0x032ea6fe, 0x039cff85, 0x18b80161, 0x024c01b0, 0x18b001a0, 0x02464b98, 0x063dee5e, 0x18d00160,
+    0x18cb4318, 0x05d54f8d, 0x04bf4f9d, 0x18e8000c, 0x01a60a1a, 0x19300138, 0x002c0134, 0x191800e5,
+    0x1910014a, 0x01162ad9, 0x03b523a2, 0x19280088, 0x034e5eb2, 0x05d66ad8, 0x19395209, 0x195801b0,
+    0x195001a0, 0x031e8798, 0x065dc62a, 0x0474e726, 0x1970000c, 0x01ae0e1a, 0x19c80199, 0x199800b4,
+    0x01f401d2, 0x05c401be, 0x0205f7aa, 0x19b80079, 0x19b00065, 0x0575f396, 0x00fe2b2e, 0x19c37eb8,
+    0x04d5a6cc, 0x19d36af6, 0x19e00050, 0x03e54f62, 0x045f1f6c, 0x19f8000c, 0x01b60e1a, 0x1a600199,
+    0x1a400158, 0x1a280146, 0x1a20009c, 0x045dbf05, 0x03be771c, 0x1a380166, 0x0135e752, 0x03beeb72,
+    0x068c01e2, 0x1a5801c6, 0x05257221, 0x00edd66d, 0x1a6b5ef6, 0x1a780050, 0x03ed5b62, 0x04570f6c,
+    0x1a980010, 0x1a90df91, 0x02ae92c2, 0x1ad80138, 0x00740134, 0x1ac000c9, 0x1abb3605, 0x02f60f4a,
+    0x1ad00088, 0x0236127c, 0x05f66704, 0x1b180161, 0x1b000109, 0x1af80089, 0x03f6cb44, 0x04cf0b72,
+    0x1b100106, 0x02fc0770, 0x031edb4d, 0x1b233b32, 0x1b297f72, 0x061e2f60, 0x1b40000c, 0x01c61a1a,
+    0x1ba00195, 0x1b7000f4, 0x1b6800ec, 0x1b630205, 0x040d4a29, 0x01dddede, 0x1b8800fc, 0x1b820a35,
+    0x052f7386, 0x1b980108, 0x01f6378a, 0x02d64bb0, 0x1bb8006c, 0x1bb316f6, 0x01f687a1, 0x04474788,
+    0x1bd80010, 0x1bd0e791, 0x036e7a66, 0x1c480195, 0x1c180164, 0x1c000146, 0x06a4013e, 0x046da22d,
+    0x1c100166, 0x018df352, 0x01b60754, 0x1c30014a, 0x01f401b0, 0x03767709, 0x1c4000a5, 0x02cec26d,
+    0x04ef4b9c, 0x1c58006c, 0x02d6dba5, 0x04473f88, 0x1c70000c, 0x01de1e1e, 0x1cd80199, 0x1ca8008c,
+    0x1c98003d, 0x06b40064, 0x02aeba30, 0x1ca0e675, 0x03af2a81, 0x1cc8002d, 0x1cc0001d, 0x03aec69a,
+    0x04d4df78, 0x028401b0, 0x05d637a0, 0x1ce346f6, 0x1cf0006c, 0x021e83a1, 0x044f1368, 0x1d08000c,
+    0x01e61e1e, 0x1d780199, 0x1d4800cc, 0x1d3800bc, 0x1d3000b4, 0x021603d2, 0x0615e251, 0x051c015e,
+    0x0115d666, 0x1d600049, 0x0254003d, 0x03eede46, 0x1d70007a, 0x067e2e4a, 0x0494ee96, 0x1d833ef6,
+    0x1d899650, 0x044ee768, 0x1da80010, 0x1da0f391, 0x03ae66a2, 0x1de80195, 0x1dd00138, 0x00840134,
+    0x1dcb1609, 0x0435462d, 0x1dd92e02, 0x1de16209, 0x03466fb0, 0x1df8006c, 0x02eec7a5, 0x04472b80,
+    0x1e10000c, 0x01fe0a22, 0x1e780199, 0x1e400024, 0x1e3800ce, 0x05fc008e, 0x02769e4a, 0x01ce327d,
+    0x1e6000b5, 0x1e58002e, 0x06ae2616, 0x042d9ad4, 0x1e700052, 0x00fe1a3e, 0x05be3b6c, 0x1e8332f6,
+    0x1e90006c, 0x02467ba1, 0x043ef768, 0x1ea10a00, 0x1ee00191, 0x1eb13610, 0x1ec80018, 0x1ec1c68e,
+    0x03ffa2a1, 0x1ed80024, 0x0196e64e, 0x0486131d, 0x1eeb2af6, 0x1ef80074, 0x029617a1, 0x043eeb68,
+    0x1f180010, 0x1f10ff91, 0x03be5aa2, 0x1f700195, 0x1f480150, 0x1f400148, 0x1f3b1205, 0x033e1bda,
+    0x037c8a55, 0x1f6801e2, 0x1f6001c6, 0x06463361, 0x00d63b80, 0x06466be6, 0x1f80006c, 0x0316b3a5,
+    0x0457137c, 0x1f911600, 0x1fc80191, 0x1fa14a10, 0x1fb00018, 0x03d70ace, 0x1fc00024, 0x01b6da4e,
+    0x044dee62, 0x1fd316f6, 0x1fe00074, 0x02ae13a1, 0x05be1f9a, 0x1ff11a00, 0x2038003e, 0x20300190,
+    0x20180058, 0x0574003a, 0x04a4fb79, 0x20280061, 0x072e960e, 0x05950285, 0x03e4d216, 0x20580062,
+    0x05a40151, 0x048c0184, 0x03549252, 0x2078007e, 0x207000ac, 0x05ad5ef5, 0x06b60e4d, 0x2088008e,
+    0x02264a41, 0x042736a2, 0x20992200, 0x20d000ce, 0x20c800be, 0x014c00ba, 0x20c00198, 0x05a61e96,
+    0x03c44fa0, 0x053fa6ca, 0x21080194, 0x20f00028, 0x20ea367d, 0x03fcebae, 0x210000b5, 0x029e0a9d,
+    0x039e674d, 0x21180112, 0x0246e7a4, 0x212343ae, 0x058d83a0, 0x21380010, 0x04351391, 0x21a00195,
+    0x217000f4, 0x216800ec, 0x2160012a, 0x0626131a, 0x03fd4234, 0x03b502a9, 0x218800fc, 0x21820e35,
+    0x05176386, 0x21980104, 0x0196478a, 0x045d6e02, 0x21b0006c, 0x0326afa5, 0x044f0778, 0x21c12e00,
+    0x2208003e, 0x22000190, 0x21e80058, 0x021c0038, 0x05cdca32, 0x21f80061, 0x070e8a94, 0x05751e85,
+    0x03f50616, 0x22280062, 0x058c0151, 0x04940184, 0x0364be52, 0x2248007e, 0x224000ac, 0x05856af5,
+    0x06960e4d, 0x2258008e, 0x03c4f6f4, 0x042712a2,
+};
+
+static const uint16_t MODEL_COMPACT_TREE_ROOTS[41] = {
+    0, 41, 79, 121, 165, 208, 248, 287, 325, 358, 386, 415, 448, 487, 516, 549,
+    586, 613, 646, 672, 696, 720, 749, 773, 795, 812, 829, 848, 870, 888, 908, 927,
+    946, 960, 979, 992, 1009, 1021, 1042, 1061, 1079,
+};
+
+static const uint8_t MODEL_COMPACT_TREE_CLASS[41] = {
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0,
+};
+
+static const int32_t MODEL_COMPACT_MARGIN_MIN[42] = {
+    -395929, -381661, -366136, -354228, -341254, -330522, -319052, -308877, -298307, -288694, -278701, -270205, -260431, -250747, -241524, -233500,
+    -224587, -217132, -208488, -198804, -190331, -182499, -171280, -163717, -155610, -148943, -138950, -131118, -113413, -105099, -96815, -89075,
+    -79387, -72799, -62806, -53122, -42552, -36422, -26890, -17119, -8911, 0,
+};
+
+static const int32_t MODEL_COMPACT_MARGIN_MAX[42] = {
+    400235, 382378, 369741, 355798, 344404, 332212, 322111, 311092, 302056, 290040, 281544, 271856, 261755, 249739, 241571, 232348,
+    221475, 208501, 199381, 190737, 183102, 174369, 166201, 156580, 149125, 134965, 126383, 116128, 109169, 101476, 93913, 86134,
+    79063, 67284, 59649, 51441, 45027, 37173, 27846, 16376, 8473, 0,
+};
+
+static const ModelCompactTables MODEL_COMPACT = {
+    MODEL_COMPACT_NODES,
+    MODEL_COMPACT_TREE_ROOTS,
+    MODEL_COMPACT_TREE_CLASS,
+    MODEL_COMPACT_NODE_COUNT,
+    41,
+    { MODEL_COMPACT_SOIL_THRESHOLDS, MODEL_COMPACT_TEMPERATURE_THRESHOLDS, MODEL_COMPACT_HUMIDITY_THRESHOLDS },
+    { 109, 106, 122 },
+    MODEL_COMPACT_PALETTE,
+    MODEL_COMPACT_PALETTE_SIZE,
+    10509,
+    MODEL_COMPACT_MARGIN_MIN,
+    MODEL_COMPACT_MARGIN_MAX,
+};
+
+#endif
@@ -0,0 +1,287 @@
+#ifndef MODEL_ENGINE_H
+#define MODEL_ENGINE_H
+
+// Engine suy luận cây quyết định dạng bảng (không phụ thuộc Arduino,
+// build được trên host để so sánh với model_final.h).
+
+#include <stdint.h>
+#include <stddef.h>
+#include <limits>
+
+#define MODEL_FEATURE_COUNT 3   // soil, temperature, humidity
+#define MODEL_CLASS_COUNT 2
+#define MODEL_LEAF 0xFF         // feature của node lá
+
+// Chỉ dừng sớm khi còn cách ngưỡng logit ít nhất chừng này, để sai số làm tròn
+// float không làm đổi kết quả so với cộng đủ các cây
+#define MODEL_EARLY_EXIT_MARGIN 1e-3f
+
+// Số mẫu trong một khối của predictBatch
+#define MODEL_BATCH_LANES 8
+
+// Số cây tối đa ModelLeafCache nhớ được; mô hình lớn hơn thì luôn duyệt lại
+#define MODEL_CACHE_MAX_TREES 64
+
+// Fixed-point: đầu vào và ngưỡng split dạng Q20 (|x| < 2048; số nguyên và mọi float
+// có |x| >= 8 đều biểu diễn đúng), lá và votes dạng Q24 (41 lá |v| < 0.5 vừa int32)
+#define MODEL_FIXED_INPUT_Q_BITS 20
+#define MODEL_FIXED_LEAF_Q_BITS 24
+
+// Kiểu số của TreeEnsemble, chọn lúc biên dịch. Duyệt cây, dừng sớm và cache lá
+// dùng chung; chỉ khác kiểu ngưỡng/lá/votes và bước quyết định (decide).
+struct ModelFloat {
+    typedef float Value;
+    static constexpr float earlyExitMargin = MODEL_EARLY_EXIT_MARGIN;
+    static constexpr float lowest() { return -std::numeric_limits<float>::infinity(); }
+    static constexpr float highest() { return std::numeric_limits<float>::infinity(); }
+};
+
+// Chỉ cộng và so sánh số nguyên: không cần FPU hay libm, host và ESP32 cho cùng kết quả
+struct ModelFixed {
+    typedef int32_t Value;
+    static constexpr int32_t earlyExitMargin = 0;   // tổng số nguyên không có sai số
+    static constexpr int32_t lowest() { return INT32_MIN; }
+    static constexpr int32_t highest() { return INT32_MAX; }
+};
+
+// 8 bytes/node. Bảng sinh theo thứ tự preorder nên con trái luôn là node kế tiếp.
+template <typename Value>
+struct ModelNodeT {
+    uint8_t feature;    // chỉ số feature, MODEL_LEAF nếu là lá
+    uint16_t right;     // chỉ số node con phải (x[feature] > value)
+    Value value;        // ngưỡng split (x <= value đi trái) hoặc giá trị lá
+};
+
+typedef ModelNodeT<float> ModelNode;
+typedef ModelNodeT<int32_t> ModelFixedNode;     // ngưỡng Q20, lá Q24
+
+// Mô tả một ensemble nằm trong flash (const) hoặc RAM.
+template <typename Value>
+struct ModelTablesT {
+    const ModelNodeT<Value>* nodes;
+    const uint16_t* treeRoots;
+    const uint8_t* treeClass;   // cây cộng vào votes[treeClass[i]]
+    uint16_t nodeCount;
+    uint16_t treeCount;
+    float threshold;            // ngưỡng xác suất lớp 1 (engine fixed không dùng)
+    Value logitThreshold;       // logit(threshold)
+    // Khoảng votes[1] - votes[0] còn cộng thêm được từ cây i đến hết (treeCount + 1
+    // phần tử), dùng để dừng sớm. nullptr thì luôn cộng đủ các cây.
+    const Value* marginMin;
+    const Value* marginMax;
+};
+
+typedef ModelTablesT<float> ModelTables;
+typedef ModelTablesT<int32_t> ModelFixedTables;
+
+// Bộ nhớ đệm cho predictIncremental, nằm trong RAM (~1.8 KB). Với mỗi cây nhớ lá
+// ở lần suy luận trước và hộp đầu vào dẫn tới lá đó: mọi x có lo < x <= hi theo
+// từng feature đều rơi vào cùng lá. Lưu theo feature để chỉ quét feature đã đổi.
+// Gọi invalidate() khi đổi bảng mô hình.
+template <typename Value>
+struct ModelLeafCacheT {
+    Value lo[MODEL_FEATURE_COUNT][MODEL_CACHE_MAX_TREES];
+    Value hi[MODEL_FEATURE_COUNT][MODEL_CACHE_MAX_TREES];
+    Value leaf[MODEL_CACHE_MAX_TREES];
+    Value x[MODEL_FEATURE_COUNT];   // đầu vào lần trước
+    int prediction = 0;             // kết quả ứng với các lá đang nhớ
+    bool valid = false;
+    uint32_t hits = 0;      // số cây dùng lại lá cũ
+    uint32_t misses = 0;    // số cây phải duyệt lại
+
+    void invalidate() { valid = false; }
+};
+
+typedef ModelLeafCacheT<float> ModelLeafCache;
+typedef ModelLeafCacheT<int32_t> ModelFixedLeafCache;
+
+template <typename Number>
+class BasicTreeEnsemble {
+    public:
+        typedef typename Number::Value Value;
+        typedef ModelTablesT<Value> Tables;
+        typedef ModelLeafCacheT<Value> LeafCache;
+
+        explicit BasicTreeEnsemble(const Tables& tables);
+
+        // Cùng giao diện với Eloquent::ML::Port::XGBClassifier::predict: cộng đủ các
+        // cây như predictFull; treesEvaluated nhận số cây đã duyệt.
+        int predict(const Value* x, uint16_t* treesEvaluated = nullptr) const;
+
+        // Luôn cộng đủ các cây như model_final.h
+        int predictFull(const Value* x) const;
+
+        // Dừng ngay khi các cây còn lại không thể đổi kết quả (marginMin/marginMax).
+        // Khoảng min/max lá theo cây quá rộng với mô hình built-in: trên lưới vẫn duyệt
+        // ~39.6/41 cây mà hai phép so mỗi cây làm chậm hơn predictFull, nên chỉ dùng
+        // khi bảng có khoảng đủ hẹp
+        int predictEarlyExit(const Value* x, uint16_t* treesEvaluated = nullptr) const;
+
+        // Như predictFull nhưng chỉ duyệt lại các cây mà x đã ra khỏi hộp của lá
+        // cũ trong cache; treesEvaluated nhận số cây phải duyệt lại.
+        int predictIncremental(const Value* x, LeafCache& cache, uint16_t* treesEvaluated = nullptr) const;
+
+        // Suy luận nhiều mẫu: X gồm n mẫu liên tiếp (soil, temp, hum), out nhận 0/1.
+        // Duyệt từng cây cho cả khối MODEL_BATCH_LANES mẫu (SIMD nếu có), kết quả
+        // trùng với predictFull. Chỉ có cho ModelFloat, cài đặt trong model_batch.cpp.
+        void predictBatch(const Value* X, size_t n, uint8_t* out) const;
+
+        // Float: exp + ngưỡng xác suất giống model_final.h.
+        // Fixed: votes[1] - votes[0] >= logitThreshold, không cần exp
+        int decide(const Value* votes) const;
+
+        // Tổng điểm (logit) của từng lớp
+        void votes(const Value* x, Value* out) const;
+
+        Value leafValue(uint16_t tree, const Value* x) const;
+
+        // Duyệt cây và ghi lá cùng hộp đầu vào dẫn tới lá vào cache
+        void leafBox(uint16_t tree, const Value* x, LeafCache& cache) const;
+
+        // Số byte bảng chiếm trong flash
+        size_t flashBytes() const;
+
+        const Tables& tables() const { return model; }
+
+    private:
+        Tables model;
+};
+
+typedef BasicTreeEnsemble<ModelFloat> TreeEnsemble;
+typedef BasicTreeEnsemble<ModelFixed> FixedTreeEnsemble;
+
+template <> int TreeEnsemble::decide(const float* votes) const;
+template <> int FixedTreeEnsemble::decide(const int32_t* votes) const;
+template <> void TreeEnsemble::predictBatch(const float* X, size_t n, uint8_t* out) const;
+
+// Hai biến thể được tạo sẵn trong model_engine.cpp
+extern template class BasicTreeEnsemble<ModelFloat>;
+extern template class BasicTreeEnsemble<ModelFixed>;
+
+// Đổi số đọc cảm biến sang Q20 (làm tròn, bão hòa ngoài |x| < 2048). Soil là số
+// nguyên nên không qua float
+inline int32_t modelFixedInput(int value) {
+    const int limit = 1 << (31 - MODEL_FIXED_INPUT_Q_BITS);
+    if (value >= limit) return INT32_MAX;
+    if (value <= -limit) return INT32_MIN;
+    return (int32_t)value * (1 << MODEL_FIXED_INPUT_Q_BITS);
+}
+int32_t modelFixedInput(float value);
+
+// Đổi bảng float (mô hình nạp từ file) sang fixed-point, làm tròn giống
+// tools/model_export.py nên MODEL_TABLE đổi ra đúng MODEL_FIXED. nodes cần nodeCount
+// phần tử, margins cần 2 * (treeCount + 1). Không dừng sớm nếu các cây không liền nhau.
+ModelFixedTables toFixedTables(const ModelTables& tables, ModelFixedNode* nodes, int32_t* margins);
+
+// 4 bytes/node: so sánh chỉ số bin (uint8) thay cho float, lá là số fixed-point.
+struct ModelQuantNode {
+    uint8_t feature;    // chỉ số feature, MODEL_LEAF nếu là lá
+    uint8_t bin;        // đi trái nếu bin(x) <= bin
+    int16_t value;      // split: chỉ số node con phải, lá: giá trị dạng Q
+};
+
+struct ModelQuantTables {
+    const ModelQuantNode* nodes;
+    const uint16_t* treeRoots;
+    const uint8_t* treeClass;
+    uint16_t nodeCount;
+    uint16_t treeCount;
+    const float* thresholds[MODEL_FEATURE_COUNT];   // ngưỡng duy nhất, tăng dần
+    uint8_t thresholdCount[MODEL_FEATURE_COUNT];
+    int32_t logitThreshold;     // lớp 1 khi votes[1] - votes[0] >= logitThreshold
+    const int32_t* marginMin;   // như ModelTables, dạng Q
+    const int32_t* marginMax;
+};
+
+class QuantizedEnsemble {
+    public:
+        explicit QuantizedEnsemble(const ModelQuantTables& tables);
+
+        int predict(const float* x, uint16_t* treesEvaluated = nullptr) const;
+
+        // Ánh xạ mỗi feature một lần sang chỉ số bin
+        void quantize(const float* x, uint8_t* bins) const;
+        int predictBins(const uint8_t* bins, uint16_t* treesEvaluated = nullptr) const;
+        int16_t leafValue(uint16_t tree, const uint8_t* bins) const;
+
+        size_t flashBytes() const;
+
+    private:
+        ModelQuantTables model;
+};
+
+// Node split nén vào một uint32: lá không có node riêng mà nằm ngay trong node cha
+// dưới dạng chỉ số palette. Con trái không phải lá luôn là node kế tiếp; con phải
+// và gốc cây có thể trỏ tới cây con đã xuất hiện ở cây khác (DAG).
+//   bit 0-1 feature, 2-8 bin (đi trái nếu bin(x) <= bin), 9 con trái là lá,
+//   10-17 palette của lá trái, 18 con phải là lá, 19-31 node hoặc palette bên phải
+#define MODEL_COMPACT_FEATURE(n) ((n) & 0x3)
+#define MODEL_COMPACT_BIN(n) (((n) >> 2) & 0x7F)
+#define MODEL_COMPACT_LEFT_LEAF (1u << 9)
+#define MODEL_COMPACT_LEFT(n) (((n) >> 10) & 0xFF)
+#define MODEL_COMPACT_RIGHT_LEAF (1u << 18)
+#define MODEL_COMPACT_RIGHT(n) ((n) >> 19)
+#define MODEL_COMPACT_ROOT_LEAF 0x8000  // gốc là lá: 15 bit thấp là chỉ số palette
+
+struct ModelCompactTables {
+    const uint32_t* nodes;
+    const uint16_t* treeRoots;
+    const uint8_t* treeClass;
+    uint16_t nodeCount;
+    uint16_t treeCount;
+    const float* thresholds[MODEL_FEATURE_COUNT];   // như ModelQuantTables
+    uint8_t thresholdCount[MODEL_FEATURE_COUNT];
+    const int16_t* palette;     // giá trị lá dạng Q (MODEL_QUANTIZED_Q_BITS)
+    uint16_t paletteSize;
+    int32_t logitThreshold;
+    const int32_t* marginMin;
+    const int32_t* marginMax;
+};
+
+// Dạng nén của QuantizedEnsemble: cùng cách chia bin, lá làm tròn về palette. Xấp xỉ
+// chứ không tương đương: lệch sát ngưỡng nhiều hơn hẳn bản quantized (xem config.h)
+class CompactEnsemble {
+    public:
+        explicit CompactEnsemble(const ModelCompactTables& tables);
+
+        int predict(const float* x, uint16_t* treesEvaluated = nullptr) const;
+
+        void quantize(const float* x, uint8_t* bins) const;
+        int predictBins(const uint8_t* bins, uint16_t* treesEvaluated = nullptr) const;
+        uint8_t leafIndex(uint16_t tree, const uint8_t* bins) const;
+
+        size_t flashBytes() const;
+
+    private:
+        ModelCompactTables model;
+};
+
+// Bảng vùng quyết định: mỗi feature chia thành các bin bởi các ngưỡng (đã làm tròn
+// xuống số nguyên), kết quả của mỗi ô (soil, temp, hum) là 1 bit. Các hàng bit theo
+// trục độ ẩm được gộp trùng: ô (soil, temp) trỏ tới một hàng trong bảng rows.
+struct ModelRegions {
+    const int16_t* thresholds[MODEL_FEATURE_COUNT];   // tăng dần, x <= t[i] thuộc bin i
+    uint16_t thresholdCount[MODEL_FEATURE_COUNT];
+    const uint16_t* rowIndex;   // [soilBin * tempBins + tempBin] -> chỉ số hàng
+    const uint8_t* rows;        // rowCount * rowBytes, bit humBin của hàng
+    uint16_t rowCount;
+    uint8_t rowBytes;
+};
+
+class RegionModel {
+    public:
+        explicit RegionModel(const ModelRegions& regions);
+
+        // Chỉ chính xác khi x nằm trên lưới số nguyên (soil, nhiệt độ và độ ẩm DHT11).
+        // Trả về false nếu không tra được, khi đó dùng TreeEnsemble.
+        bool lookup(const float* x, int& prediction) const;
+
+        uint16_t bin(uint8_t feature, int value) const;
+
+        size_t flashBytes() const;
+
+    private:
+        ModelRegions model;
+};
+
+#endif
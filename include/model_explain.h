@@ -0,0 +1,38 @@
+#ifndef MODEL_EXPLAIN_H
+#define MODEL_EXPLAIN_H
+
+// Giải thích quyết định của TreeEnsemble theo đường đi (Saabas): mỗi bước từ node
+// cha xuống node con làm giá trị kỳ vọng của cây đổi một lượng, lượng đó tính cho
+// feature của node cha. Bảng delta (một float mỗi node, song song với bảng node)
+// tính sẵn lúc export (MODEL_TABLE_EXPLAIN) nên lúc chạy chỉ duyệt cây và cộng.
+// Không phụ thuộc Arduino.
+
+#include "model_engine.h"
+
+// Đóng góp vào margin votes[1] - votes[0] (dương: nghiêng về tưới)
+struct ModelExplanation {
+    float bias;                                 // margin kỳ vọng của mô hình
+    float contributions[MODEL_FEATURE_COUNT];   // soil, temperature, humidity
+    float margin;                               // bias + tổng đóng góp
+    int prediction;                             // trùng TreeEnsemble::predictFull
+};
+
+class TreeExplainer {
+    public:
+        // deltas có tables.nodeCount phần tử, phải sống lâu hơn explainer
+        TreeExplainer(const ModelTables& tables, const float* deltas);
+
+        // Một lượt duyệt mọi cây: vừa ra quyết định vừa tách margin theo feature
+        int explain(const float* x, ModelExplanation& out) const;
+
+    private:
+        ModelTables model;
+        const float* nodeDeltas;
+};
+
+// Bảng delta cho mô hình nạp lúc chạy (file mô hình không có cover): hai nhánh
+// nặng như nhau, giống tools/model_export.py khi mô hình không có cover.
+// deltas cần tables.nodeCount phần tử
+void modelExplainDeltas(const ModelTables& tables, float* deltas);
+
+#endif
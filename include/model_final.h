@@ -1,3 +1,6 @@
+// model_final.h
+// Sinh tự động bởi tools/model_export.py từ irrigation_xgb.json - không sửa tay.
+
 #pragma once
 #include <cstdarg>
 #include <math.h>
@@ -12,20 +15,20 @@ namespace Eloquent {
                     int predict(float *x) {
                         float votes[2] = { 0.0f };
                         // tree #1
-                        if (x[0] <= 504.64285) {
-                            if (x[0] <= 414.90128) {
-                                if (x[0] <= 314.83585) {
+                        if (x[0] < 504.64285f) {
+                            if (x[0] < 414.9013f) {
+                                if (x[0] < 314.83588f) {
                                     votes[0] += -0.27247614;
                                 }
 
                                 else {
-                                    if (x[1] <= 38.352947) {
-                                        if (x[1] <= 20.210264) {
+                                    if (x[1] < 38.352947f) {
+                                        if (x[1] < 20.210264f) {
                                             votes[0] += 0.012848446;
                                         }
 
                                         else {
-                                            if (x[1] <= 31.595858) {
+                                            if (x[1] < 31.59586f) {
                                                 votes[0] += -0.2241167;
                                             }
 
@@ -36,7 +39,7 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 58.360905) {
+                                        if (x[2] < 58.36091f) {
                                             votes[0] += 0.12185374;
                                         }
 
@@ -48,10 +51,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 32.81931) {
-                                    if (x[2] <= 48.508495) {
-                                        if (x[0] <= 443.64627) {
-                                            if (x[0] <= 437.69418) {
+                                if (x[1] < 32.819313f) {
+                                    if (x[2] < 48.508495f) {
+                                        if (x[0] < 443.64627f) {
+                                            if (x[0] < 437.69418f) {
                                                 votes[0] += -0.07791445;
                                             }
 
@@ -71,9 +74,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 61.888226) {
-                                        if (x[1] <= 37.172) {
-                                            if (x[2] <= 54.38744) {
+                                    if (x[2] < 61.88823f) {
+                                        if (x[1] < 37.172f) {
+                                            if (x[2] < 54.387444f) {
                                                 votes[0] += 0.14727987;
                                             }
 
@@ -88,12 +91,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 34.65467) {
+                                        if (x[1] < 34.65467f) {
                                             votes[0] += -0.20404615;
                                         }
 
                                         else {
-                                            if (x[2] <= 71.19443) {
+                                            if (x[2] < 71.194435f) {
                                                 votes[0] += 0.10088513;
                                             }
 
@@ -107,11 +110,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[0] <= 625.17017) {
-                                if (x[1] <= 32.308414) {
-                                    if (x[2] <= 63.751545) {
-                                        if (x[0] <= 576.5611) {
-                                            if (x[2] <= 43.263504) {
+                            if (x[0] < 625.1702f) {
+                                if (x[1] < 32.308414f) {
+                                    if (x[2] < 63.75155f) {
+                                        if (x[0] < 576.56116f) {
+                                            if (x[2] < 43.263504f) {
                                                 votes[0] += 0.10042804;
                                             }
 
@@ -121,7 +124,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 55.38705) {
+                                            if (x[2] < 55.38705f) {
                                                 votes[0] += 0.13014854;
                                             }
 
@@ -132,12 +135,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 29.79249) {
+                                        if (x[1] < 29.79249f) {
                                             votes[0] += -0.23892926;
                                         }
 
                                         else {
-                                            if (x[0] <= 571.9207) {
+                                            if (x[0] < 571.9207f) {
                                                 votes[0] += -0.12988545;
                                             }
 
@@ -149,9 +152,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 35.590336) {
-                                        if (x[2] <= 69.24387) {
-                                            if (x[2] <= 56.274975) {
+                                    if (x[1] < 35.59034f) {
+                                        if (x[2] < 69.24387f) {
+                                            if (x[2] < 56.27498f) {
                                                 votes[0] += 0.18431294;
                                             }
 
@@ -161,7 +164,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 568.22876) {
+                                            if (x[0] < 568.2288f) {
                                                 votes[0] += -0.116872855;
                                             }
 
@@ -178,10 +181,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 22.71323) {
-                                    if (x[0] <= 738.2404) {
-                                        if (x[2] <= 55.38705) {
-                                            if (x[0] <= 637.0415) {
+                                if (x[1] < 22.71323f) {
+                                    if (x[0] < 738.2404f) {
+                                        if (x[2] < 55.38705f) {
+                                            if (x[0] < 637.0415f) {
                                                 votes[0] += 0.09964342;
                                             }
 
@@ -191,7 +194,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 76.463646) {
+                                            if (x[2] < 76.46365f) {
                                                 votes[0] += -0.15270218;
                                             }
 
@@ -202,12 +205,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 20.018867) {
+                                        if (x[1] < 20.018867f) {
                                             votes[0] += -0.16680549;
                                         }
 
                                         else {
-                                            if (x[0] <= 939.83057) {
+                                            if (x[0] < 939.8306f) {
                                                 votes[0] += 0.16623563;
                                             }
 
@@ -219,9 +222,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[0] <= 770.6374) {
-                                        if (x[2] <= 67.81464) {
-                                            if (x[0] <= 723.1106) {
+                                    if (x[0] < 770.63745f) {
+                                        if (x[2] < 67.814644f) {
+                                            if (x[0] < 723.11066f) {
                                                 votes[0] += 0.21771982;
                                             }
 
@@ -231,7 +234,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 28.626034) {
+                                            if (x[1] < 28.626036f) {
                                                 votes[0] += -0.038529165;
                                             }
 
@@ -242,12 +245,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 40.064274) {
+                                        if (x[2] < 40.064278f) {
                                             votes[0] += -0.05932828;
                                         }
 
                                         else {
-                                            if (x[0] <= 947.55585) {
+                                            if (x[0] < 947.5559f) {
                                                 votes[0] += 0.21507554;
                                             }
 
@@ -261,20 +264,20 @@ namespace Eloquent {
                         }
 
                         // tree #2
-                        if (x[0] <= 576.5611) {
-                            if (x[0] <= 423.75723) {
-                                if (x[0] <= 314.83585) {
+                        if (x[0] < 576.56116f) {
+                            if (x[0] < 423.75723f) {
+                                if (x[0] < 314.83588f) {
                                     votes[1] += -0.23688537;
                                 }
 
                                 else {
-                                    if (x[1] <= 38.30003) {
-                                        if (x[1] <= 20.210264) {
+                                    if (x[1] < 38.300034f) {
+                                        if (x[1] < 20.210264f) {
                                             votes[1] += 0.011957414;
                                         }
 
                                         else {
-                                            if (x[1] <= 31.595858) {
+                                            if (x[1] < 31.59586f) {
                                                 votes[1] += -0.19942814;
                                             }
 
@@ -285,7 +288,7 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 59.24511) {
+                                        if (x[2] < 59.245113f) {
                                             votes[1] += 0.11795902;
                                         }
 
@@ -297,10 +300,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 33.781754) {
-                                    if (x[2] <= 63.751545) {
-                                        if (x[1] <= 32.210934) {
-                                            if (x[2] <= 43.263504) {
+                                if (x[1] < 33.781757f) {
+                                    if (x[2] < 63.75155f) {
+                                        if (x[1] < 32.210938f) {
+                                            if (x[2] < 43.263504f) {
                                                 votes[1] += 0.043174032;
                                             }
 
@@ -310,7 +313,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 33.33044) {
+                                            if (x[1] < 33.33044f) {
                                                 votes[1] += 0.12727617;
                                             }
 
@@ -321,7 +324,7 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 430.82144) {
+                                        if (x[0] < 430.82144f) {
                                             votes[1] += -0.06524862;
                                         }
 
@@ -332,13 +335,13 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 56.40549) {
+                                    if (x[2] < 56.40549f) {
                                         votes[1] += 0.18700914;
                                     }
 
                                     else {
-                                        if (x[1] <= 36.57418) {
-                                            if (x[0] <= 479.10492) {
+                                        if (x[1] < 36.57418f) {
+                                            if (x[0] < 479.10495f) {
                                                 votes[1] += -0.17295505;
                                             }
 
@@ -348,7 +351,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 80.566864) {
+                                            if (x[2] < 80.566864f) {
                                                 votes[1] += 0.17365964;
                                             }
 
@@ -362,11 +365,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[1] <= 25.043457) {
-                                if (x[0] <= 738.2404) {
-                                    if (x[2] <= 57.774563) {
-                                        if (x[0] <= 667.4241) {
-                                            if (x[0] <= 637.0415) {
+                            if (x[1] < 25.043457f) {
+                                if (x[0] < 738.2404f) {
+                                    if (x[2] < 57.774567f) {
+                                        if (x[0] < 667.42413f) {
+                                            if (x[0] < 637.0415f) {
                                                 votes[1] += 0.061889134;
                                             }
 
@@ -376,7 +379,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 22.643593) {
+                                            if (x[1] < 22.643595f) {
                                                 votes[1] += 0.041729957;
                                             }
 
@@ -387,8 +390,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 76.463646) {
-                                            if (x[2] <= 65.82888) {
+                                        if (x[2] < 76.46365f) {
+                                            if (x[2] < 65.82888f) {
                                                 votes[1] += -0.029380718;
                                             }
 
@@ -398,7 +401,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 79.62927) {
+                                            if (x[2] < 79.62927f) {
                                                 votes[1] += 0.11558181;
                                             }
 
@@ -410,13 +413,13 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 20.129288) {
+                                    if (x[1] < 20.12929f) {
                                         votes[1] += -0.123714544;
                                     }
 
                                     else {
-                                        if (x[0] <= 947.55585) {
-                                            if (x[0] <= 862.27014) {
+                                        if (x[0] < 947.5559f) {
+                                            if (x[0] < 862.27014f) {
                                                 votes[1] += 0.13871954;
                                             }
 
@@ -433,10 +436,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[0] <= 625.17017) {
-                                    if (x[1] <= 30.384491) {
-                                        if (x[2] <= 58.087837) {
-                                            if (x[1] <= 28.936296) {
+                                if (x[0] < 625.1702f) {
+                                    if (x[1] < 30.384493f) {
+                                        if (x[2] < 58.087837f) {
+                                            if (x[1] < 28.936296f) {
                                                 votes[1] += 0.16608328;
                                             }
 
@@ -446,7 +449,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 61.10139) {
+                                            if (x[2] < 61.10139f) {
                                                 votes[1] += -0.013326456;
                                             }
 
@@ -462,13 +465,13 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 40.064274) {
+                                    if (x[2] < 40.064278f) {
                                         votes[1] += -0.01733249;
                                     }
 
                                     else {
-                                        if (x[2] <= 69.29373) {
-                                            if (x[0] <= 947.55585) {
+                                        if (x[2] < 69.29373f) {
+                                            if (x[0] < 947.5559f) {
                                                 votes[1] += 0.19282117;
                                             }
 
@@ -478,7 +481,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 734.1381) {
+                                            if (x[0] < 734.1381f) {
                                                 votes[1] += 0.06955996;
                                             }
 
@@ -492,16 +495,16 @@ namespace Eloquent {
                         }
 
                         // tree #3
-                        if (x[0] <= 544.88226) {
-                            if (x[0] <= 414.90128) {
-                                if (x[0] <= 314.83585) {
+                        if (x[0] < 544.88226f) {
+                            if (x[0] < 414.9013f) {
+                                if (x[0] < 314.83588f) {
                                     votes[0] += -0.21274711;
                                 }
 
                                 else {
-                                    if (x[2] <= 62.64101) {
-                                        if (x[2] <= 61.888226) {
-                                            if (x[1] <= 38.30003) {
+                                    if (x[2] < 62.64101f) {
+                                        if (x[2] < 61.88823f) {
+                                            if (x[1] < 38.300034f) {
                                                 votes[0] += -0.13191551;
                                             }
 
@@ -516,8 +519,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 407.90012) {
-                                            if (x[1] <= 38.352947) {
+                                        if (x[0] < 407.90015f) {
+                                            if (x[1] < 38.352947f) {
                                                 votes[0] += -0.19394775;
                                             }
 
@@ -527,7 +530,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 70.60207) {
+                                            if (x[2] < 70.60207f) {
                                                 votes[0] += -0.12666844;
                                             }
 
@@ -540,10 +543,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 34.14794) {
-                                    if (x[2] <= 62.03855) {
-                                        if (x[1] <= 32.210934) {
-                                            if (x[2] <= 44.878017) {
+                                if (x[1] < 34.14794f) {
+                                    if (x[2] < 62.03855f) {
+                                        if (x[1] < 32.210938f) {
+                                            if (x[2] < 44.878017f) {
                                                 votes[0] += -0.016439948;
                                             }
 
@@ -553,7 +556,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 447.9999) {
+                                            if (x[0] < 447.9999f) {
                                                 votes[0] += -0.045824297;
                                             }
 
@@ -569,13 +572,13 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 59.24511) {
+                                    if (x[2] < 59.245113f) {
                                         votes[0] += 0.16131853;
                                     }
 
                                     else {
-                                        if (x[1] <= 38.352947) {
-                                            if (x[0] <= 479.10492) {
+                                        if (x[1] < 38.352947f) {
+                                            if (x[0] < 479.10495f) {
                                                 votes[0] += -0.103896804;
                                             }
 
@@ -585,7 +588,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 443.64627) {
+                                            if (x[0] < 443.64627f) {
                                                 votes[0] += 0.048914015;
                                             }
 
@@ -599,15 +602,15 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[0] <= 625.17017) {
-                                if (x[1] <= 31.109905) {
-                                    if (x[2] <= 52.926598) {
-                                        if (x[1] <= 24.081753) {
+                            if (x[0] < 625.1702f) {
+                                if (x[1] < 31.109905f) {
+                                    if (x[2] < 52.9266f) {
+                                        if (x[1] < 24.081755f) {
                                             votes[0] += 0.15086347;
                                         }
 
                                         else {
-                                            if (x[1] <= 24.729498) {
+                                            if (x[1] < 24.7295f) {
                                                 votes[0] += -0.11938041;
                                             }
 
@@ -618,8 +621,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 27.744463) {
-                                            if (x[1] <= 23.5819) {
+                                        if (x[1] < 27.744465f) {
+                                            if (x[1] < 23.581902f) {
                                                 votes[0] += -0.20751917;
                                             }
 
@@ -629,7 +632,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 62.149727) {
+                                            if (x[2] < 62.14973f) {
                                                 votes[0] += 0.060124923;
                                             }
 
@@ -641,9 +644,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 33.548763) {
-                                        if (x[0] <= 571.9207) {
-                                            if (x[0] <= 563.61707) {
+                                    if (x[1] < 33.548763f) {
+                                        if (x[0] < 571.9207f) {
+                                            if (x[0] < 563.6171f) {
                                                 votes[0] += 0.0862702;
                                             }
 
@@ -664,10 +667,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 22.71323) {
-                                    if (x[0] <= 785.92065) {
-                                        if (x[2] <= 56.40549) {
-                                            if (x[1] <= 22.279318) {
+                                if (x[1] < 22.71323f) {
+                                    if (x[0] < 785.92065f) {
+                                        if (x[2] < 56.40549f) {
+                                            if (x[1] < 22.27932f) {
                                                 votes[0] += 0.08928442;
                                             }
 
@@ -677,7 +680,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 738.2404) {
+                                            if (x[0] < 738.2404f) {
                                                 votes[0] += -0.085104674;
                                             }
 
@@ -688,12 +691,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 20.129288) {
+                                        if (x[1] < 20.12929f) {
                                             votes[0] += -0.072089456;
                                         }
 
                                         else {
-                                            if (x[0] <= 939.83057) {
+                                            if (x[0] < 939.8306f) {
                                                 votes[0] += 0.1605395;
                                             }
 
@@ -705,9 +708,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[0] <= 770.6374) {
-                                        if (x[2] <= 67.81464) {
-                                            if (x[0] <= 723.1106) {
+                                    if (x[0] < 770.63745f) {
+                                        if (x[2] < 67.814644f) {
+                                            if (x[0] < 723.11066f) {
                                                 votes[0] += 0.18170488;
                                             }
 
@@ -717,7 +720,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 28.626034) {
+                                            if (x[1] < 28.626036f) {
                                                 votes[0] += -0.039278634;
                                             }
 
@@ -728,12 +731,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 40.064274) {
+                                        if (x[2] < 40.064278f) {
                                             votes[0] += -0.05404171;
                                         }
 
                                         else {
-                                            if (x[0] <= 947.55585) {
+                                            if (x[0] < 947.5559f) {
                                                 votes[0] += 0.17742762;
                                             }
 
@@ -747,11 +750,11 @@ namespace Eloquent {
                         }
 
                         // tree #4
-                        if (x[0] <= 504.64285) {
-                            if (x[0] <= 414.90128) {
-                                if (x[0] <= 314.83585) {
-                                    if (x[2] <= 42.117752) {
-                                        if (x[1] <= 36.29342) {
+                        if (x[0] < 504.64285f) {
+                            if (x[0] < 414.9013f) {
+                                if (x[0] < 314.83588f) {
+                                    if (x[2] < 42.117752f) {
+                                        if (x[1] < 36.293423f) {
                                             votes[1] += -0.16554816;
                                         }
 
@@ -766,9 +769,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 62.64101) {
-                                        if (x[2] <= 61.888226) {
-                                            if (x[0] <= 330.20743) {
+                                    if (x[2] < 62.64101f) {
+                                        if (x[2] < 61.88823f) {
+                                            if (x[0] < 330.20746f) {
                                                 votes[1] += -0.0022082927;
                                             }
 
@@ -783,8 +786,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 407.90012) {
-                                            if (x[1] <= 38.352947) {
+                                        if (x[0] < 407.90015f) {
+                                            if (x[1] < 38.352947f) {
                                                 votes[1] += -0.1752834;
                                             }
 
@@ -794,7 +797,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 30.521881) {
+                                            if (x[1] < 30.521881f) {
                                                 votes[1] += -0.119428866;
                                             }
 
@@ -807,10 +810,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 33.781754) {
-                                    if (x[2] <= 53.743607) {
-                                        if (x[1] <= 30.05751) {
-                                            if (x[1] <= 22.522203) {
+                                if (x[1] < 33.781757f) {
+                                    if (x[2] < 53.74361f) {
+                                        if (x[1] < 30.05751f) {
+                                            if (x[1] < 22.522203f) {
                                                 votes[1] += 0.018863982;
                                             }
 
@@ -820,7 +823,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 46.72972) {
+                                            if (x[2] < 46.72972f) {
                                                 votes[1] += -0.044991154;
                                             }
 
@@ -831,7 +834,7 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 33.260544) {
+                                        if (x[1] < 33.260548f) {
                                             votes[1] += -0.1715794;
                                         }
 
@@ -842,9 +845,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 71.19443) {
-                                        if (x[1] <= 37.172) {
-                                            if (x[2] <= 54.38744) {
+                                    if (x[2] < 71.194435f) {
+                                        if (x[1] < 37.172f) {
+                                            if (x[2] < 54.387444f) {
                                                 votes[1] += 0.12095408;
                                             }
 
@@ -854,7 +857,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 419.50504) {
+                                            if (x[0] < 419.50507f) {
                                                 votes[1] += 0.052999064;
                                             }
 
@@ -865,7 +868,7 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 481.3896) {
+                                        if (x[0] < 481.38962f) {
                                             votes[1] += -0.13506967;
                                         }
 
@@ -878,11 +881,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[0] <= 625.17017) {
-                                if (x[1] <= 32.308414) {
-                                    if (x[2] <= 63.751545) {
-                                        if (x[0] <= 581.9638) {
-                                            if (x[2] <= 42.482048) {
+                            if (x[0] < 625.1702f) {
+                                if (x[1] < 32.308414f) {
+                                    if (x[2] < 63.75155f) {
+                                        if (x[0] < 581.9638f) {
+                                            if (x[2] < 42.482048f) {
                                                 votes[1] += 0.11243314;
                                             }
 
@@ -892,7 +895,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 55.38705) {
+                                            if (x[2] < 55.38705f) {
                                                 votes[1] += 0.11092521;
                                             }
 
@@ -903,12 +906,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 29.79249) {
+                                        if (x[1] < 29.79249f) {
                                             votes[1] += -0.17662002;
                                         }
 
                                         else {
-                                            if (x[0] <= 571.9207) {
+                                            if (x[0] < 571.9207f) {
                                                 votes[1] += -0.08974017;
                                             }
 
@@ -920,13 +923,13 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 65.82888) {
+                                    if (x[2] < 65.82888f) {
                                         votes[1] += 0.16193983;
                                     }
 
                                     else {
-                                        if (x[1] <= 36.57418) {
-                                            if (x[0] <= 541.0123) {
+                                        if (x[1] < 36.57418f) {
+                                            if (x[0] < 541.0123f) {
                                                 votes[1] += -0.11821649;
                                             }
 
@@ -943,10 +946,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 22.71323) {
-                                    if (x[0] <= 785.92065) {
-                                        if (x[2] <= 52.261024) {
-                                            if (x[0] <= 723.1106) {
+                                if (x[1] < 22.71323f) {
+                                    if (x[0] < 785.92065f) {
+                                        if (x[2] < 52.261024f) {
+                                            if (x[0] < 723.11066f) {
                                                 votes[1] += -0.014058669;
                                             }
 
@@ -956,7 +959,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 757.1706) {
+                                            if (x[0] < 757.17065f) {
                                                 votes[1] += -0.014918326;
                                             }
 
@@ -967,12 +970,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 20.129288) {
+                                        if (x[1] < 20.12929f) {
                                             votes[1] += -0.06681424;
                                         }
 
                                         else {
-                                            if (x[0] <= 939.83057) {
+                                            if (x[0] < 939.8306f) {
                                                 votes[1] += 0.14760664;
                                             }
 
@@ -984,9 +987,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 35.330547) {
-                                        if (x[0] <= 768.3365) {
-                                            if (x[2] <= 69.29373) {
+                                    if (x[1] < 35.330547f) {
+                                        if (x[0] < 768.33655f) {
+                                            if (x[2] < 69.29373f) {
                                                 votes[1] += 0.14107229;
                                             }
 
@@ -996,7 +999,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 947.55585) {
+                                            if (x[0] < 947.5559f) {
                                                 votes[1] += 0.15539765;
                                             }
 
@@ -1014,20 +1017,20 @@ namespace Eloquent {
                         }
 
                         // tree #5
-                        if (x[0] <= 544.88226) {
-                            if (x[0] <= 423.75723) {
-                                if (x[0] <= 314.83585) {
-                                    if (x[1] <= 38.30003) {
+                        if (x[0] < 544.88226f) {
+                            if (x[0] < 423.75723f) {
+                                if (x[0] < 314.83588f) {
+                                    if (x[1] < 38.300034f) {
                                         votes[0] += -0.18658286;
                                     }
 
                                     else {
-                                        if (x[2] <= 42.482048) {
+                                        if (x[2] < 42.482048f) {
                                             votes[0] += 0.0684329;
                                         }
 
                                         else {
-                                            if (x[0] <= 283.32388) {
+                                            if (x[0] < 283.32388f) {
                                                 votes[0] += -0.16786511;
                                             }
 
@@ -1039,13 +1042,13 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 38.30003) {
-                                        if (x[1] <= 20.210264) {
+                                    if (x[1] < 38.300034f) {
+                                        if (x[1] < 20.210264f) {
                                             votes[0] += 0.028081942;
                                         }
 
                                         else {
-                                            if (x[1] <= 31.595858) {
+                                            if (x[1] < 31.59586f) {
                                                 votes[0] += -0.15087399;
                                             }
 
@@ -1056,12 +1059,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 58.360905) {
+                                        if (x[2] < 58.36091f) {
                                             votes[0] += 0.13155358;
                                         }
 
                                         else {
-                                            if (x[1] <= 38.985462) {
+                                            if (x[1] < 38.985462f) {
                                                 votes[0] += 0.024970643;
                                             }
 
@@ -1074,14 +1077,14 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 32.53507) {
-                                    if (x[2] <= 44.878017) {
-                                        if (x[2] <= 40.99605) {
+                                if (x[1] < 32.535072f) {
+                                    if (x[2] < 44.878017f) {
+                                        if (x[2] < 40.99605f) {
                                             votes[0] += -0.09602905;
                                         }
 
                                         else {
-                                            if (x[1] <= 24.228624) {
+                                            if (x[1] < 24.228624f) {
                                                 votes[0] += 0.10439738;
                                             }
 
@@ -1092,8 +1095,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 29.701893) {
-                                            if (x[1] <= 20.79896) {
+                                        if (x[1] < 29.701895f) {
+                                            if (x[1] < 20.798962f) {
                                                 votes[0] += -0.053262673;
                                             }
 
@@ -1103,7 +1106,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 31.386099) {
+                                            if (x[1] < 31.3861f) {
                                                 votes[0] += 0.011060926;
                                             }
 
@@ -1115,9 +1118,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 62.03855) {
-                                        if (x[2] <= 54.38744) {
-                                            if (x[2] <= 41.461185) {
+                                    if (x[2] < 62.03855f) {
+                                        if (x[2] < 54.387444f) {
+                                            if (x[2] < 41.461185f) {
                                                 votes[0] += 0.03572113;
                                             }
 
@@ -1127,7 +1130,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 57.560734) {
+                                            if (x[2] < 57.560738f) {
                                                 votes[0] += 0.014136592;
                                             }
 
@@ -1138,8 +1141,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 36.57418) {
-                                            if (x[1] <= 35.287067) {
+                                        if (x[1] < 36.57418f) {
+                                            if (x[1] < 35.287067f) {
                                                 votes[0] += -0.15602978;
                                             }
 
@@ -1149,7 +1152,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 481.3896) {
+                                            if (x[0] < 481.38962f) {
                                                 votes[0] += 0.013899552;
                                             }
 
@@ -1163,11 +1166,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[1] <= 27.744463) {
-                                if (x[0] <= 738.2404) {
-                                    if (x[2] <= 52.926598) {
-                                        if (x[1] <= 25.651005) {
-                                            if (x[0] <= 581.9638) {
+                            if (x[1] < 27.744465f) {
+                                if (x[0] < 738.2404f) {
+                                    if (x[2] < 52.9266f) {
+                                        if (x[1] < 25.651007f) {
+                                            if (x[0] < 581.9638f) {
                                                 votes[0] += -0.009499964;
                                             }
 
@@ -1182,8 +1185,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 625.17017) {
-                                            if (x[1] <= 23.5819) {
+                                        if (x[0] < 625.1702f) {
+                                            if (x[1] < 23.581902f) {
                                                 votes[0] += -0.17958044;
                                             }
 
@@ -1193,7 +1196,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 65.82888) {
+                                            if (x[2] < 65.82888f) {
                                                 votes[0] += 0.026144205;
                                             }
 
@@ -1205,13 +1208,13 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 20.018867) {
+                                    if (x[1] < 20.018867f) {
                                         votes[0] += -0.13644718;
                                     }
 
                                     else {
-                                        if (x[0] <= 947.55585) {
-                                            if (x[1] <= 21.345118) {
+                                        if (x[0] < 947.5559f) {
+                                            if (x[1] < 21.34512f) {
                                                 votes[0] += 0.08444961;
                                             }
 
@@ -1228,10 +1231,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 35.330547) {
-                                    if (x[0] <= 622.76105) {
-                                        if (x[2] <= 63.751545) {
-                                            if (x[1] <= 31.109905) {
+                                if (x[1] < 35.330547f) {
+                                    if (x[0] < 622.7611f) {
+                                        if (x[2] < 63.75155f) {
+                                            if (x[1] < 31.109905f) {
                                                 votes[0] += 0.038011044;
                                             }
 
@@ -1241,7 +1244,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 29.79249) {
+                                            if (x[1] < 29.79249f) {
                                                 votes[0] += -0.1458144;
                                             }
 
@@ -1252,12 +1255,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 40.064274) {
+                                        if (x[2] < 40.064278f) {
                                             votes[0] += -0.0278251;
                                         }
 
                                         else {
-                                            if (x[1] <= 34.832546) {
+                                            if (x[1] < 34.832546f) {
                                                 votes[0] += 0.13840906;
                                             }
 
@@ -1275,10 +1278,10 @@ namespace Eloquent {
                         }
 
                         // tree #6
-                        if (x[0] <= 504.64285) {
-                            if (x[0] <= 314.83585) {
-                                if (x[2] <= 42.117752) {
-                                    if (x[1] <= 36.29342) {
+                        if (x[0] < 504.64285f) {
+                            if (x[0] < 314.83588f) {
+                                if (x[2] < 42.117752f) {
+                                    if (x[1] < 36.293423f) {
                                         votes[1] += -0.14432243;
                                     }
 
@@ -1293,14 +1296,14 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 31.595858) {
-                                    if (x[1] <= 19.232065) {
+                                if (x[1] < 31.59586f) {
+                                    if (x[1] < 19.232065f) {
                                         votes[1] += 0.12640242;
                                     }
 
                                     else {
-                                        if (x[0] <= 330.20743) {
-                                            if (x[2] <= 69.09795) {
+                                        if (x[0] < 330.20746f) {
+                                            if (x[2] < 69.09795f) {
                                                 votes[1] += -0.003919607;
                                             }
 
@@ -1310,7 +1313,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 40.30547) {
+                                            if (x[2] < 40.305473f) {
                                                 votes[1] += -0.030452425;
                                             }
 
@@ -1322,9 +1325,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[0] <= 417.26404) {
-                                        if (x[1] <= 33.87899) {
-                                            if (x[1] <= 33.33044) {
+                                    if (x[0] < 417.26407f) {
+                                        if (x[1] < 33.87899f) {
+                                            if (x[1] < 33.33044f) {
                                                 votes[1] += -0.028820576;
                                             }
 
@@ -1334,7 +1337,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 38.352947) {
+                                            if (x[1] < 38.352947f) {
                                                 votes[1] += -0.13796015;
                                             }
 
@@ -1345,8 +1348,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 34.65467) {
-                                            if (x[2] <= 60.739094) {
+                                        if (x[1] < 34.65467f) {
+                                            if (x[2] < 60.739098f) {
                                                 votes[1] += 0.04700872;
                                             }
 
@@ -1356,7 +1359,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 54.38744) {
+                                            if (x[2] < 54.387444f) {
                                                 votes[1] += 0.1519445;
                                             }
 
@@ -1370,11 +1373,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[0] <= 625.17017) {
-                                if (x[1] <= 32.308414) {
-                                    if (x[2] <= 63.751545) {
-                                        if (x[2] <= 42.482048) {
-                                            if (x[0] <= 601.79553) {
+                            if (x[0] < 625.1702f) {
+                                if (x[1] < 32.308414f) {
+                                    if (x[2] < 63.75155f) {
+                                        if (x[2] < 42.482048f) {
+                                            if (x[0] < 601.79553f) {
                                                 votes[1] += 0.1237691;
                                             }
 
@@ -1384,7 +1387,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 581.9638) {
+                                            if (x[0] < 581.9638f) {
                                                 votes[1] += -0.04689087;
                                             }
 
@@ -1395,8 +1398,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 29.79249) {
-                                            if (x[0] <= 601.79553) {
+                                        if (x[1] < 29.79249f) {
+                                            if (x[0] < 601.79553f) {
                                                 votes[1] += -0.17094104;
                                             }
 
@@ -1406,7 +1409,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 67.96783) {
+                                            if (x[2] < 67.967834f) {
                                                 votes[1] += -0.11762299;
                                             }
 
@@ -1418,9 +1421,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 35.590336) {
-                                        if (x[2] <= 69.24387) {
-                                            if (x[0] <= 534.4598) {
+                                    if (x[1] < 35.59034f) {
+                                        if (x[2] < 69.24387f) {
+                                            if (x[0] < 534.45984f) {
                                                 votes[1] += 0.038984217;
                                             }
 
@@ -1430,7 +1433,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 77.48473) {
+                                            if (x[2] < 77.48473f) {
                                                 votes[1] += -0.09097303;
                                             }
 
@@ -1447,10 +1450,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 22.71323) {
-                                    if (x[0] <= 785.92065) {
-                                        if (x[2] <= 78.80507) {
-                                            if (x[2] <= 76.463646) {
+                                if (x[1] < 22.71323f) {
+                                    if (x[0] < 785.92065f) {
+                                        if (x[2] < 78.80508f) {
+                                            if (x[2] < 76.46365f) {
                                                 votes[1] += -0.017663255;
                                             }
 
@@ -1465,8 +1468,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 46.85027) {
-                                            if (x[0] <= 827.3417) {
+                                        if (x[2] < 46.850273f) {
+                                            if (x[0] < 827.34174f) {
                                                 votes[1] += 0.09759715;
                                             }
 
@@ -1476,7 +1479,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 20.129288) {
+                                            if (x[1] < 20.12929f) {
                                                 votes[1] += -0.042082924;
                                             }
 
@@ -1488,9 +1491,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 35.330547) {
-                                        if (x[0] <= 768.3365) {
-                                            if (x[2] <= 67.81464) {
+                                    if (x[1] < 35.330547f) {
+                                        if (x[0] < 768.33655f) {
+                                            if (x[2] < 67.814644f) {
                                                 votes[1] += 0.12481816;
                                             }
 
@@ -1500,7 +1503,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 947.55585) {
+                                            if (x[0] < 947.5559f) {
                                                 votes[1] += 0.13571069;
                                             }
 
@@ -1518,19 +1521,19 @@ namespace Eloquent {
                         }
 
                         // tree #7
-                        if (x[0] <= 481.3896) {
-                            if (x[0] <= 314.83585) {
-                                if (x[1] <= 38.30003) {
+                        if (x[0] < 481.38962f) {
+                            if (x[0] < 314.83588f) {
+                                if (x[1] < 38.300034f) {
                                     votes[0] += -0.16839556;
                                 }
 
                                 else {
-                                    if (x[2] <= 42.482048) {
+                                    if (x[2] < 42.482048f) {
                                         votes[0] += 0.06574459;
                                     }
 
                                     else {
-                                        if (x[0] <= 283.32388) {
+                                        if (x[0] < 283.32388f) {
                                             votes[0] += -0.14975989;
                                         }
 
@@ -1542,10 +1545,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 38.352947) {
-                                    if (x[2] <= 56.71585) {
-                                        if (x[1] <= 31.920872) {
-                                            if (x[1] <= 19.232065) {
+                                if (x[1] < 38.352947f) {
+                                    if (x[2] < 56.71585f) {
+                                        if (x[1] < 31.920874f) {
+                                            if (x[1] < 19.232065f) {
                                                 votes[0] += 0.118695445;
                                             }
 
@@ -1555,7 +1558,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 423.75723) {
+                                            if (x[0] < 423.75723f) {
                                                 votes[0] += -0.033825077;
                                             }
 
@@ -1566,8 +1569,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 66.00447) {
-                                            if (x[0] <= 467.6232) {
+                                        if (x[2] < 66.00447f) {
+                                            if (x[0] < 467.62323f) {
                                                 votes[0] += -0.10661259;
                                             }
 
@@ -1577,7 +1580,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 321.81546) {
+                                            if (x[0] < 321.81546f) {
                                                 votes[0] += -0.057035267;
                                             }
 
@@ -1589,17 +1592,17 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 39.112988) {
+                                    if (x[1] < 39.11299f) {
                                         votes[0] += 0.13173963;
                                     }
 
                                     else {
-                                        if (x[2] <= 57.774563) {
+                                        if (x[2] < 57.774567f) {
                                             votes[0] += 0.12008663;
                                         }
 
                                         else {
-                                            if (x[0] <= 397.24774) {
+                                            if (x[0] < 397.24774f) {
                                                 votes[0] += -0.12402795;
                                             }
 
@@ -1613,11 +1616,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[0] <= 590.5542) {
-                                if (x[1] <= 34.14794) {
-                                    if (x[2] <= 63.751545) {
-                                        if (x[1] <= 26.744131) {
-                                            if (x[2] <= 51.871273) {
+                            if (x[0] < 590.55426f) {
+                                if (x[1] < 34.14794f) {
+                                    if (x[2] < 63.75155f) {
+                                        if (x[1] < 26.744131f) {
+                                            if (x[2] < 51.871273f) {
                                                 votes[0] += -0.019851474;
                                             }
 
@@ -1627,7 +1630,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 560.3891) {
+                                            if (x[0] < 560.38916f) {
                                                 votes[0] += 0.057017278;
                                             }
 
@@ -1638,12 +1641,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 30.294844) {
+                                        if (x[1] < 30.294846f) {
                                             votes[0] += -0.16379754;
                                         }
 
                                         else {
-                                            if (x[1] <= 31.386099) {
+                                            if (x[1] < 31.3861f) {
                                                 votes[0] += 0.084165774;
                                             }
 
@@ -1655,13 +1658,13 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 36.57418) {
-                                        if (x[2] <= 58.911232) {
+                                    if (x[1] < 36.57418f) {
+                                        if (x[2] < 58.911236f) {
                                             votes[0] += 0.11974676;
                                         }
 
                                         else {
-                                            if (x[2] <= 70.60207) {
+                                            if (x[2] < 70.60207f) {
                                                 votes[0] += -0.16828126;
                                             }
 
@@ -1678,10 +1681,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 25.043457) {
-                                    if (x[0] <= 723.1106) {
-                                        if (x[2] <= 57.774563) {
-                                            if (x[0] <= 667.4241) {
+                                if (x[1] < 25.043457f) {
+                                    if (x[0] < 723.11066f) {
+                                        if (x[2] < 57.774567f) {
+                                            if (x[0] < 667.42413f) {
                                                 votes[0] += 0.0027024213;
                                             }
 
@@ -1691,7 +1694,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 20.399458) {
+                                            if (x[1] < 20.39946f) {
                                                 votes[0] += 0.069179974;
                                             }
 
@@ -1702,8 +1705,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 20.129288) {
-                                            if (x[2] <= 65.82888) {
+                                        if (x[1] < 20.12929f) {
+                                            if (x[2] < 65.82888f) {
                                                 votes[0] += -0.13627502;
                                             }
 
@@ -1713,7 +1716,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 947.55585) {
+                                            if (x[0] < 947.5559f) {
                                                 votes[0] += 0.10569749;
                                             }
 
@@ -1725,9 +1728,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 35.330547) {
-                                        if (x[2] <= 69.29373) {
-                                            if (x[1] <= 35.1346) {
+                                    if (x[1] < 35.330547f) {
+                                        if (x[2] < 69.29373f) {
+                                            if (x[1] < 35.1346f) {
                                                 votes[0] += 0.12407698;
                                             }
 
@@ -1737,7 +1740,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 732.3544) {
+                                            if (x[0] < 732.35443f) {
                                                 votes[0] += -0.010407429;
                                             }
 
@@ -1755,19 +1758,19 @@ namespace Eloquent {
                         }
 
                         // tree #8
-                        if (x[0] <= 481.3896) {
-                            if (x[0] <= 314.83585) {
-                                if (x[1] <= 38.30003) {
+                        if (x[0] < 481.38962f) {
+                            if (x[0] < 314.83588f) {
+                                if (x[1] < 38.300034f) {
                                     votes[1] += -0.16178904;
                                 }
 
                                 else {
-                                    if (x[2] <= 42.482048) {
+                                    if (x[2] < 42.482048f) {
                                         votes[1] += 0.06075792;
                                     }
 
                                     else {
-                                        if (x[0] <= 283.32388) {
+                                        if (x[0] < 283.32388f) {
                                             votes[1] += -0.14311562;
                                         }
 
@@ -1779,10 +1782,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 38.352947) {
-                                    if (x[2] <= 56.71585) {
-                                        if (x[1] <= 31.920872) {
-                                            if (x[1] <= 19.232065) {
+                                if (x[1] < 38.352947f) {
+                                    if (x[2] < 56.71585f) {
+                                        if (x[1] < 31.920874f) {
+                                            if (x[1] < 19.232065f) {
                                                 votes[1] += 0.11188896;
                                             }
 
@@ -1792,7 +1795,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 42.703293) {
+                                            if (x[2] < 42.703297f) {
                                                 votes[1] += -0.112300865;
                                             }
 
@@ -1803,8 +1806,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 78.054855) {
-                                            if (x[2] <= 77.48473) {
+                                        if (x[2] < 78.054855f) {
+                                            if (x[2] < 77.48473f) {
                                                 votes[1] += -0.10634868;
                                             }
 
@@ -1820,8 +1823,8 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 76.115234) {
-                                        if (x[0] <= 386.11365) {
+                                    if (x[2] < 76.115234f) {
+                                        if (x[0] < 386.11368f) {
                                             votes[1] += 0.005359534;
                                         }
 
@@ -1838,11 +1841,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[0] <= 625.17017) {
-                                if (x[1] <= 30.631443) {
-                                    if (x[2] <= 55.591118) {
-                                        if (x[0] <= 581.9638) {
-                                            if (x[2] <= 43.263504) {
+                            if (x[0] < 625.1702f) {
+                                if (x[1] < 30.631443f) {
+                                    if (x[2] < 55.59112f) {
+                                        if (x[0] < 581.9638f) {
+                                            if (x[2] < 43.263504f) {
                                                 votes[1] += 0.035477318;
                                             }
 
@@ -1852,7 +1855,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 619.1631) {
+                                            if (x[0] < 619.16315f) {
                                                 votes[1] += 0.108415954;
                                             }
 
@@ -1863,8 +1866,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 63.751545) {
-                                            if (x[2] <= 59.417866) {
+                                        if (x[2] < 63.75155f) {
+                                            if (x[2] < 59.41787f) {
                                                 votes[1] += -0.13746125;
                                             }
 
@@ -1874,7 +1877,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 601.79553) {
+                                            if (x[0] < 601.79553f) {
                                                 votes[1] += -0.15880452;
                                             }
 
@@ -1886,9 +1889,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 35.287067) {
-                                        if (x[0] <= 571.9207) {
-                                            if (x[0] <= 563.61707) {
+                                    if (x[1] < 35.287067f) {
+                                        if (x[0] < 571.9207f) {
+                                            if (x[0] < 563.6171f) {
                                                 votes[1] += 0.02277898;
                                             }
 
@@ -1898,7 +1901,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 69.47082) {
+                                            if (x[2] < 69.470825f) {
                                                 votes[1] += 0.12627117;
                                             }
 
@@ -1915,10 +1918,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 25.043457) {
-                                    if (x[0] <= 738.2404) {
-                                        if (x[2] <= 57.774563) {
-                                            if (x[1] <= 21.250526) {
+                                if (x[1] < 25.043457f) {
+                                    if (x[0] < 738.2404f) {
+                                        if (x[2] < 57.774567f) {
+                                            if (x[1] < 21.250526f) {
                                                 votes[1] += -0.042332925;
                                             }
 
@@ -1928,7 +1931,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 24.228624) {
+                                            if (x[1] < 24.228624f) {
                                                 votes[1] += -0.015946038;
                                             }
 
@@ -1939,12 +1942,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 20.018867) {
+                                        if (x[1] < 20.018867f) {
                                             votes[1] += -0.1196693;
                                         }
 
                                         else {
-                                            if (x[0] <= 947.55585) {
+                                            if (x[0] < 947.5559f) {
                                                 votes[1] += 0.10161382;
                                             }
 
@@ -1956,13 +1959,13 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 40.064274) {
+                                    if (x[2] < 40.064278f) {
                                         votes[1] += -0.043430127;
                                     }
 
                                     else {
-                                        if (x[0] <= 790.87964) {
-                                            if (x[2] <= 67.81464) {
+                                        if (x[0] < 790.8797f) {
+                                            if (x[2] < 67.814644f) {
                                                 votes[1] += 0.12827113;
                                             }
 
@@ -1972,7 +1975,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 947.55585) {
+                                            if (x[0] < 947.5559f) {
                                                 votes[1] += 0.13619137;
                                             }
 
@@ -1986,10 +1989,10 @@ namespace Eloquent {
                         }
 
                         // tree #9
-                        if (x[0] <= 544.88226) {
-                            if (x[0] <= 314.83585) {
-                                if (x[2] <= 42.117752) {
-                                    if (x[1] <= 36.29342) {
+                        if (x[0] < 544.88226f) {
+                            if (x[0] < 314.83588f) {
+                                if (x[2] < 42.117752f) {
+                                    if (x[1] < 36.293423f) {
                                         votes[0] += -0.122038834;
                                     }
 
@@ -2004,14 +2007,14 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 32.16639) {
-                                    if (x[1] <= 19.232065) {
+                                if (x[1] < 32.166393f) {
+                                    if (x[1] < 19.232065f) {
                                         votes[0] += 0.1058244;
                                     }
 
                                     else {
-                                        if (x[2] <= 62.149727) {
-                                            if (x[2] <= 61.46994) {
+                                        if (x[2] < 62.14973f) {
+                                            if (x[2] < 61.46994f) {
                                                 votes[0] += -0.08521436;
                                             }
 
@@ -2021,7 +2024,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 30.384491) {
+                                            if (x[1] < 30.384493f) {
                                                 votes[0] += -0.13767748;
                                             }
 
@@ -2033,13 +2036,13 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[0] <= 407.90012) {
-                                        if (x[1] <= 32.600372) {
+                                    if (x[0] < 407.90015f) {
+                                        if (x[1] < 32.600372f) {
                                             votes[0] += 0.1397063;
                                         }
 
                                         else {
-                                            if (x[2] <= 54.241096) {
+                                            if (x[2] < 54.241096f) {
                                                 votes[0] += -0.034619424;
                                             }
 
@@ -2050,8 +2053,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 62.03855) {
-                                            if (x[1] <= 37.172) {
+                                        if (x[2] < 62.03855f) {
+                                            if (x[1] < 37.172f) {
                                                 votes[0] += 0.050773446;
                                             }
 
@@ -2061,7 +2064,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 33.421864) {
+                                            if (x[1] < 33.421867f) {
                                                 votes[0] += -0.12488229;
                                             }
 
@@ -2075,11 +2078,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[1] <= 27.744463) {
-                                if (x[0] <= 738.2404) {
-                                    if (x[2] <= 52.926598) {
-                                        if (x[2] <= 51.124275) {
-                                            if (x[2] <= 49.27912) {
+                            if (x[1] < 27.744465f) {
+                                if (x[0] < 738.2404f) {
+                                    if (x[2] < 52.9266f) {
+                                        if (x[2] < 51.124275f) {
+                                            if (x[2] < 49.27912f) {
                                                 votes[0] += 0.07562505;
                                             }
 
@@ -2094,8 +2097,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 26.360792) {
-                                            if (x[0] <= 597.5512) {
+                                        if (x[1] < 26.360792f) {
+                                            if (x[0] < 597.5512f) {
                                                 votes[0] += -0.13872556;
                                             }
 
@@ -2105,7 +2108,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 571.9207) {
+                                            if (x[0] < 571.9207f) {
                                                 votes[0] += -0.026861323;
                                             }
 
@@ -2117,13 +2120,13 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 20.018867) {
+                                    if (x[1] < 20.018867f) {
                                         votes[0] += -0.113025226;
                                     }
 
                                     else {
-                                        if (x[0] <= 947.55585) {
-                                            if (x[1] <= 21.345118) {
+                                        if (x[0] < 947.5559f) {
+                                            if (x[1] < 21.34512f) {
                                                 votes[0] += 0.05428037;
                                             }
 
@@ -2140,10 +2143,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 36.114292) {
-                                    if (x[0] <= 625.17017) {
-                                        if (x[2] <= 63.751545) {
-                                            if (x[1] <= 28.936296) {
+                                if (x[1] < 36.114292f) {
+                                    if (x[0] < 625.1702f) {
+                                        if (x[2] < 63.75155f) {
+                                            if (x[1] < 28.936296f) {
                                                 votes[0] += 0.13861167;
                                             }
 
@@ -2153,7 +2156,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 80.566864) {
+                                            if (x[2] < 80.566864f) {
                                                 votes[0] += -0.07148862;
                                             }
 
@@ -2164,12 +2167,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 40.436516) {
+                                        if (x[2] < 40.43652f) {
                                             votes[0] += -0.028657032;
                                         }
 
                                         else {
-                                            if (x[0] <= 819.48444) {
+                                            if (x[0] < 819.4845f) {
                                                 votes[0] += 0.08408058;
                                             }
 
@@ -2187,19 +2190,19 @@ namespace Eloquent {
                         }
 
                         // tree #10
-                        if (x[0] <= 481.3896) {
-                            if (x[0] <= 314.83585) {
-                                if (x[1] <= 38.30003) {
+                        if (x[0] < 481.38962f) {
+                            if (x[0] < 314.83588f) {
+                                if (x[1] < 38.300034f) {
                                     votes[1] += -0.15199828;
                                 }
 
                                 else {
-                                    if (x[0] <= 252.73064) {
+                                    if (x[0] < 252.73065f) {
                                         votes[1] += -0.1314642;
                                     }
 
                                     else {
-                                        if (x[2] <= 55.17409) {
+                                        if (x[2] < 55.17409f) {
                                             votes[1] += 0.10320916;
                                         }
 
@@ -2211,10 +2214,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 38.352947) {
-                                    if (x[2] <= 66.00447) {
-                                        if (x[1] <= 31.920872) {
-                                            if (x[1] <= 22.522203) {
+                                if (x[1] < 38.352947f) {
+                                    if (x[2] < 66.00447f) {
+                                        if (x[1] < 31.920874f) {
+                                            if (x[1] < 22.522203f) {
                                                 votes[1] += 0.0032333771;
                                             }
 
@@ -2224,7 +2227,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 56.40549) {
+                                            if (x[2] < 56.40549f) {
                                                 votes[1] += 0.010481084;
                                             }
 
@@ -2235,8 +2238,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 430.82144) {
-                                            if (x[0] <= 407.90012) {
+                                        if (x[0] < 430.82144f) {
+                                            if (x[0] < 407.90015f) {
                                                 votes[1] += -0.118930705;
                                             }
 
@@ -2252,17 +2255,17 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 39.112988) {
+                                    if (x[1] < 39.11299f) {
                                         votes[1] += 0.11924196;
                                     }
 
                                     else {
-                                        if (x[2] <= 57.774563) {
+                                        if (x[2] < 57.774567f) {
                                             votes[1] += 0.106692284;
                                         }
 
                                         else {
-                                            if (x[0] <= 397.24774) {
+                                            if (x[0] < 397.24774f) {
                                                 votes[1] += -0.10978054;
                                             }
 
@@ -2276,11 +2279,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[1] <= 35.330547) {
-                                if (x[0] <= 585.0183) {
-                                    if (x[2] <= 63.751545) {
-                                        if (x[1] <= 26.744131) {
-                                            if (x[2] <= 44.878017) {
+                            if (x[1] < 35.330547f) {
+                                if (x[0] < 585.0183f) {
+                                    if (x[2] < 63.75155f) {
+                                        if (x[1] < 26.744131f) {
+                                            if (x[2] < 44.878017f) {
                                                 votes[1] += 0.020792441;
                                             }
 
@@ -2290,7 +2293,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 560.3891) {
+                                            if (x[0] < 560.38916f) {
                                                 votes[1] += 0.056784626;
                                             }
 
@@ -2301,12 +2304,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 30.294844) {
+                                        if (x[1] < 30.294846f) {
                                             votes[1] += -0.14359666;
                                         }
 
                                         else {
-                                            if (x[1] <= 31.386099) {
+                                            if (x[1] < 31.3861f) {
                                                 votes[1] += 0.08157983;
                                             }
 
@@ -2318,9 +2321,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[0] <= 770.6374) {
-                                        if (x[2] <= 66.143585) {
-                                            if (x[1] <= 23.90916) {
+                                    if (x[0] < 770.63745f) {
+                                        if (x[2] < 66.143585f) {
+                                            if (x[1] < 23.90916f) {
                                                 votes[1] += 0.01421836;
                                             }
 
@@ -2330,7 +2333,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 29.79249) {
+                                            if (x[1] < 29.79249f) {
                                                 votes[1] += -0.04776362;
                                             }
 
@@ -2341,8 +2344,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 947.55585) {
-                                            if (x[1] <= 21.01245) {
+                                        if (x[0] < 947.5559f) {
+                                            if (x[1] < 21.012451f) {
                                                 votes[1] += -0.020389937;
                                             }
 
@@ -2364,19 +2367,19 @@ namespace Eloquent {
                         }
 
                         // tree #11
-                        if (x[0] <= 479.10492) {
-                            if (x[0] <= 314.83585) {
-                                if (x[1] <= 38.30003) {
+                        if (x[0] < 479.10495f) {
+                            if (x[0] < 314.83588f) {
+                                if (x[1] < 38.300034f) {
                                     votes[0] += -0.1481515;
                                 }
 
                                 else {
-                                    if (x[0] <= 252.73064) {
+                                    if (x[0] < 252.73065f) {
                                         votes[0] += -0.12673236;
                                     }
 
                                     else {
-                                        if (x[2] <= 55.17409) {
+                                        if (x[2] < 55.17409f) {
                                             votes[0] += 0.09347275;
                                         }
 
@@ -2388,10 +2391,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 38.352947) {
-                                    if (x[2] <= 65.26101) {
-                                        if (x[2] <= 65.12514) {
-                                            if (x[1] <= 20.210264) {
+                                if (x[1] < 38.352947f) {
+                                    if (x[2] < 65.26102f) {
+                                        if (x[2] < 65.125145f) {
+                                            if (x[1] < 20.210264f) {
                                                 votes[0] += 0.06775654;
                                             }
 
@@ -2406,7 +2409,7 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 321.81546) {
+                                        if (x[0] < 321.81546f) {
                                             votes[0] += -0.027358484;
                                         }
 
@@ -2417,13 +2420,13 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 76.115234) {
-                                        if (x[1] <= 39.112988) {
+                                    if (x[2] < 76.115234f) {
+                                        if (x[1] < 39.11299f) {
                                             votes[0] += 0.12913802;
                                         }
 
                                         else {
-                                            if (x[2] <= 57.774563) {
+                                            if (x[2] < 57.774567f) {
                                                 votes[0] += 0.10176581;
                                             }
 
@@ -2441,11 +2444,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[1] <= 35.330547) {
-                                if (x[0] <= 625.17017) {
-                                    if (x[2] <= 56.274975) {
-                                        if (x[1] <= 25.651005) {
-                                            if (x[1] <= 24.081753) {
+                            if (x[1] < 35.330547f) {
+                                if (x[0] < 625.1702f) {
+                                    if (x[2] < 56.27498f) {
+                                        if (x[1] < 25.651007f) {
+                                            if (x[1] < 24.081755f) {
                                                 votes[0] += 0.011062268;
                                             }
 
@@ -2455,7 +2458,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 51.39405) {
+                                            if (x[2] < 51.39405f) {
                                                 votes[0] += 0.039084256;
                                             }
 
@@ -2466,8 +2469,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 30.631443) {
-                                            if (x[0] <= 601.79553) {
+                                        if (x[1] < 30.631443f) {
+                                            if (x[0] < 601.79553f) {
                                                 votes[0] += -0.11073674;
                                             }
 
@@ -2477,7 +2480,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 31.595858) {
+                                            if (x[1] < 31.59586f) {
                                                 votes[0] += 0.08756584;
                                             }
 
@@ -2489,9 +2492,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 22.71323) {
-                                        if (x[0] <= 785.92065) {
-                                            if (x[2] <= 78.80507) {
+                                    if (x[1] < 22.71323f) {
+                                        if (x[0] < 785.92065f) {
+                                            if (x[2] < 78.80508f) {
                                                 votes[0] += -0.0041118916;
                                             }
 
@@ -2501,7 +2504,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 46.85027) {
+                                            if (x[2] < 46.850273f) {
                                                 votes[0] += -0.030426646;
                                             }
 
@@ -2512,8 +2515,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 69.29373) {
-                                            if (x[1] <= 35.1346) {
+                                        if (x[2] < 69.29373f) {
+                                            if (x[1] < 35.1346f) {
                                                 votes[0] += 0.0976464;
                                             }
 
@@ -2523,7 +2526,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 718.0937) {
+                                            if (x[0] < 718.09375f) {
                                                 votes[0] += -0.034850337;
                                             }
 
@@ -2541,20 +2544,20 @@ namespace Eloquent {
                         }
 
                         // tree #12
-                        if (x[0] <= 423.75723) {
-                            if (x[0] <= 296.41357) {
+                        if (x[0] < 423.75723f) {
+                            if (x[0] < 296.41357f) {
                                 votes[1] += -0.14283024;
                             }
 
                             else {
-                                if (x[1] <= 38.542213) {
-                                    if (x[2] <= 44.47733) {
+                                if (x[1] < 38.542213f) {
+                                    if (x[2] < 44.477333f) {
                                         votes[1] += -0.14864588;
                                     }
 
                                     else {
-                                        if (x[2] <= 63.414562) {
-                                            if (x[2] <= 61.888226) {
+                                        if (x[2] < 63.414562f) {
+                                            if (x[2] < 61.88823f) {
                                                 votes[1] += -0.050176814;
                                             }
 
@@ -2564,7 +2567,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 367.1976) {
+                                            if (x[0] < 367.1976f) {
                                                 votes[1] += -0.13160388;
                                             }
 
@@ -2576,12 +2579,12 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 58.360905) {
+                                    if (x[2] < 58.36091f) {
                                         votes[1] += 0.15426448;
                                     }
 
                                     else {
-                                        if (x[1] <= 38.985462) {
+                                        if (x[1] < 38.985462f) {
                                             votes[1] += 0.0045359065;
                                         }
 
@@ -2594,11 +2597,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[0] <= 590.5542) {
-                                if (x[1] <= 33.781754) {
-                                    if (x[2] <= 65.26101) {
-                                        if (x[2] <= 43.263504) {
-                                            if (x[2] <= 40.99605) {
+                            if (x[0] < 590.55426f) {
+                                if (x[1] < 33.781757f) {
+                                    if (x[2] < 65.26102f) {
+                                        if (x[2] < 43.263504f) {
+                                            if (x[2] < 40.99605f) {
                                                 votes[1] += -0.0022318445;
                                             }
 
@@ -2608,7 +2611,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 46.442112) {
+                                            if (x[2] < 46.442116f) {
                                                 votes[1] += -0.12885642;
                                             }
 
@@ -2619,8 +2622,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 73.89908) {
-                                            if (x[2] <= 72.59901) {
+                                        if (x[2] < 73.899086f) {
+                                            if (x[2] < 72.599014f) {
                                                 votes[1] += -0.09715805;
                                             }
 
@@ -2636,8 +2639,8 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 54.38744) {
-                                        if (x[2] <= 41.461185) {
+                                    if (x[2] < 54.387444f) {
+                                        if (x[2] < 41.461185f) {
                                             votes[1] += 0.025503132;
                                         }
 
@@ -2647,8 +2650,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 37.410538) {
-                                            if (x[0] <= 471.12207) {
+                                        if (x[1] < 37.41054f) {
+                                            if (x[0] < 471.12207f) {
                                                 votes[1] += -0.10594808;
                                             }
 
@@ -2658,7 +2661,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 78.68865) {
+                                            if (x[2] < 78.68865f) {
                                                 votes[1] += 0.11849128;
                                             }
 
@@ -2671,14 +2674,14 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 25.043457) {
-                                    if (x[0] <= 695.8238) {
-                                        if (x[1] <= 20.399458) {
+                                if (x[1] < 25.043457f) {
+                                    if (x[0] < 695.82385f) {
+                                        if (x[1] < 20.39946f) {
                                             votes[1] += 0.13174072;
                                         }
 
                                         else {
-                                            if (x[0] <= 604.23834) {
+                                            if (x[0] < 604.23834f) {
                                                 votes[1] += 0.123072274;
                                             }
 
@@ -2689,8 +2692,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 20.129288) {
-                                            if (x[2] <= 67.96783) {
+                                        if (x[1] < 20.12929f) {
+                                            if (x[2] < 67.967834f) {
                                                 votes[1] += -0.13050842;
                                             }
 
@@ -2700,7 +2703,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 79.62927) {
+                                            if (x[2] < 79.62927f) {
                                                 votes[1] += 0.075165264;
                                             }
 
@@ -2712,9 +2715,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 35.330547) {
-                                        if (x[2] <= 69.29373) {
-                                            if (x[1] <= 35.1346) {
+                                    if (x[1] < 35.330547f) {
+                                        if (x[2] < 69.29373f) {
+                                            if (x[1] < 35.1346f) {
                                                 votes[1] += 0.091757305;
                                             }
 
@@ -2724,7 +2727,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 790.87964) {
+                                            if (x[0] < 790.8797f) {
                                                 votes[1] += -0.00066518603;
                                             }
 
@@ -2742,10 +2745,10 @@ namespace Eloquent {
                         }
 
                         // tree #13
-                        if (x[0] <= 423.75723) {
-                            if (x[0] <= 296.41357) {
-                                if (x[2] <= 41.80311) {
-                                    if (x[1] <= 32.659496) {
+                        if (x[0] < 423.75723f) {
+                            if (x[0] < 296.41357f) {
+                                if (x[2] < 41.803112f) {
+                                    if (x[1] < 32.659496f) {
                                         votes[0] += -0.08288956;
                                     }
 
@@ -2760,14 +2763,14 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 31.920872) {
-                                    if (x[2] <= 48.26108) {
+                                if (x[1] < 31.920874f) {
+                                    if (x[2] < 48.26108f) {
                                         votes[0] += -0.13956483;
                                     }
 
                                     else {
-                                        if (x[2] <= 62.149727) {
-                                            if (x[0] <= 405.56747) {
+                                        if (x[2] < 62.14973f) {
+                                            if (x[0] < 405.56747f) {
                                                 votes[0] += 0.018834477;
                                             }
 
@@ -2777,7 +2780,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 30.384491) {
+                                            if (x[1] < 30.384493f) {
                                                 votes[0] += -0.12594096;
                                             }
 
@@ -2789,13 +2792,13 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 32.600372) {
+                                    if (x[1] < 32.600372f) {
                                         votes[0] += 0.11892971;
                                     }
 
                                     else {
-                                        if (x[0] <= 407.90012) {
-                                            if (x[2] <= 55.17409) {
+                                        if (x[0] < 407.90015f) {
+                                            if (x[2] < 55.17409f) {
                                                 votes[0] += -0.012507849;
                                             }
 
@@ -2805,7 +2808,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 57.912468) {
+                                            if (x[2] < 57.91247f) {
                                                 votes[0] += -0.0523884;
                                             }
 
@@ -2819,11 +2822,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[0] <= 625.17017) {
-                                if (x[1] <= 33.781754) {
-                                    if (x[2] <= 55.591118) {
-                                        if (x[2] <= 51.562855) {
-                                            if (x[2] <= 49.68597) {
+                            if (x[0] < 625.1702f) {
+                                if (x[1] < 33.781757f) {
+                                    if (x[2] < 55.59112f) {
+                                        if (x[2] < 51.56286f) {
+                                            if (x[2] < 49.68597f) {
                                                 votes[0] += 0.015148195;
                                             }
 
@@ -2833,7 +2836,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 52.926598) {
+                                            if (x[2] < 52.9266f) {
                                                 votes[0] += 0.14746398;
                                             }
 
@@ -2844,8 +2847,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 59.417866) {
-                                            if (x[1] <= 31.386099) {
+                                        if (x[2] < 59.41787f) {
+                                            if (x[1] < 31.3861f) {
                                                 votes[0] += -0.1313682;
                                             }
 
@@ -2855,7 +2858,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 60.739094) {
+                                            if (x[2] < 60.739098f) {
                                                 votes[0] += 0.10511611;
                                             }
 
@@ -2867,13 +2870,13 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 56.40549) {
-                                        if (x[2] <= 40.99605) {
+                                    if (x[2] < 56.40549f) {
+                                        if (x[2] < 40.99605f) {
                                             votes[0] += 0.020161673;
                                         }
 
                                         else {
-                                            if (x[0] <= 435.86127) {
+                                            if (x[0] < 435.8613f) {
                                                 votes[0] += 0.033154175;
                                             }
 
@@ -2884,8 +2887,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 36.57418) {
-                                            if (x[0] <= 538.3275) {
+                                        if (x[1] < 36.57418f) {
+                                            if (x[0] < 538.3275f) {
                                                 votes[0] += -0.07162178;
                                             }
 
@@ -2895,7 +2898,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 80.566864) {
+                                            if (x[2] < 80.566864f) {
                                                 votes[0] += 0.10934051;
                                             }
 
@@ -2908,10 +2911,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 28.510113) {
-                                    if (x[0] <= 741.78564) {
-                                        if (x[2] <= 65.82888) {
-                                            if (x[0] <= 710.7871) {
+                                if (x[1] < 28.510115f) {
+                                    if (x[0] < 741.78564f) {
+                                        if (x[2] < 65.82888f) {
+                                            if (x[0] < 710.7871f) {
                                                 votes[0] += 0.06813066;
                                             }
 
@@ -2921,7 +2924,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 25.998842) {
+                                            if (x[1] < 25.998842f) {
                                                 votes[0] += -0.018472485;
                                             }
 
@@ -2932,12 +2935,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 20.018867) {
+                                        if (x[1] < 20.018867f) {
                                             votes[0] += -0.10278097;
                                         }
 
                                         else {
-                                            if (x[0] <= 947.55585) {
+                                            if (x[0] < 947.5559f) {
                                                 votes[0] += 0.083906956;
                                             }
 
@@ -2949,13 +2952,13 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 40.436516) {
+                                    if (x[2] < 40.43652f) {
                                         votes[0] += -0.06926004;
                                     }
 
                                     else {
-                                        if (x[0] <= 819.48444) {
-                                            if (x[0] <= 721.23737) {
+                                        if (x[0] < 819.4845f) {
+                                            if (x[0] < 721.2374f) {
                                                 votes[0] += 0.10932055;
                                             }
 
@@ -2965,7 +2968,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 944.0201) {
+                                            if (x[0] < 944.02014f) {
                                                 votes[0] += 0.120229036;
                                             }
 
@@ -2979,19 +2982,19 @@ namespace Eloquent {
                         }
 
                         // tree #14
-                        if (x[0] <= 481.3896) {
-                            if (x[0] <= 314.83585) {
-                                if (x[1] <= 38.30003) {
+                        if (x[0] < 481.38962f) {
+                            if (x[0] < 314.83588f) {
+                                if (x[1] < 38.300034f) {
                                     votes[1] += -0.13985391;
                                 }
 
                                 else {
-                                    if (x[0] <= 252.73064) {
+                                    if (x[0] < 252.73065f) {
                                         votes[1] += -0.11306367;
                                     }
 
                                     else {
-                                        if (x[2] <= 47.122883) {
+                                        if (x[2] < 47.122887f) {
                                             votes[1] += 0.06077265;
                                         }
 
@@ -3003,10 +3006,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[2] <= 78.054855) {
-                                    if (x[1] <= 38.352947) {
-                                        if (x[2] <= 77.48473) {
-                                            if (x[0] <= 330.20743) {
+                                if (x[2] < 78.054855f) {
+                                    if (x[1] < 38.352947f) {
+                                        if (x[2] < 77.48473f) {
+                                            if (x[0] < 330.20746f) {
                                                 votes[1] += 0.035740558;
                                             }
 
@@ -3021,12 +3024,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 39.112988) {
+                                        if (x[1] < 39.11299f) {
                                             votes[1] += 0.1249067;
                                         }
 
                                         else {
-                                            if (x[2] <= 57.774563) {
+                                            if (x[2] < 57.774567f) {
                                                 votes[1] += 0.090438716;
                                             }
 
@@ -3044,11 +3047,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[1] <= 35.330547) {
-                                if (x[0] <= 585.0183) {
-                                    if (x[2] <= 63.751545) {
-                                        if (x[0] <= 560.3891) {
-                                            if (x[0] <= 544.88226) {
+                            if (x[1] < 35.330547f) {
+                                if (x[0] < 585.0183f) {
+                                    if (x[2] < 63.75155f) {
+                                        if (x[0] < 560.38916f) {
+                                            if (x[0] < 544.88226f) {
                                                 votes[1] += -0.010971435;
                                             }
 
@@ -3058,7 +3061,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 43.504555) {
+                                            if (x[2] < 43.50456f) {
                                                 votes[1] += 0.048598517;
                                             }
 
@@ -3069,12 +3072,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 30.294844) {
+                                        if (x[1] < 30.294846f) {
                                             votes[1] += -0.12904051;
                                         }
 
                                         else {
-                                            if (x[1] <= 31.386099) {
+                                            if (x[1] < 31.3861f) {
                                                 votes[1] += 0.078723535;
                                             }
 
@@ -3086,9 +3089,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[0] <= 770.6374) {
-                                        if (x[2] <= 53.447582) {
-                                            if (x[0] <= 729.4047) {
+                                    if (x[0] < 770.63745f) {
+                                        if (x[2] < 53.447582f) {
+                                            if (x[0] < 729.4047f) {
                                                 votes[1] += 0.09197409;
                                             }
 
@@ -3098,7 +3101,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 30.384491) {
+                                            if (x[1] < 30.384493f) {
                                                 votes[1] += -0.02175696;
                                             }
 
@@ -3109,12 +3112,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 40.436516) {
+                                        if (x[2] < 40.43652f) {
                                             votes[1] += -0.0803437;
                                         }
 
                                         else {
-                                            if (x[1] <= 21.01245) {
+                                            if (x[1] < 21.012451f) {
                                                 votes[1] += -0.032232687;
                                             }
 
@@ -3127,14 +3130,14 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 36.843307) {
-                                    if (x[2] <= 66.78746) {
+                                if (x[1] < 36.843307f) {
+                                    if (x[2] < 66.78746f) {
                                         votes[1] += 0.11594593;
                                     }
 
                                     else {
-                                        if (x[0] <= 785.92065) {
-                                            if (x[0] <= 571.9207) {
+                                        if (x[0] < 785.92065f) {
+                                            if (x[0] < 571.9207f) {
                                                 votes[1] += 0.022819817;
                                             }
 
@@ -3156,10 +3159,10 @@ namespace Eloquent {
                         }
 
                         // tree #15
-                        if (x[0] <= 423.75723) {
-                            if (x[0] <= 296.41357) {
-                                if (x[2] <= 41.80311) {
-                                    if (x[1] <= 30.892618) {
+                        if (x[0] < 423.75723f) {
+                            if (x[0] < 296.41357f) {
+                                if (x[2] < 41.803112f) {
+                                    if (x[1] < 30.892618f) {
                                         votes[0] += -0.07162317;
                                     }
 
@@ -3174,14 +3177,14 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 31.920872) {
-                                    if (x[2] <= 48.26108) {
+                                if (x[1] < 31.920874f) {
+                                    if (x[2] < 48.26108f) {
                                         votes[0] += -0.13234167;
                                     }
 
                                     else {
-                                        if (x[2] <= 62.149727) {
-                                            if (x[0] <= 405.56747) {
+                                        if (x[2] < 62.14973f) {
+                                            if (x[0] < 405.56747f) {
                                                 votes[0] += 0.022160139;
                                             }
 
@@ -3191,7 +3194,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 30.384491) {
+                                            if (x[1] < 30.384493f) {
                                                 votes[0] += -0.117899954;
                                             }
 
@@ -3203,13 +3206,13 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 32.600372) {
+                                    if (x[1] < 32.600372f) {
                                         votes[0] += 0.112132825;
                                     }
 
                                     else {
-                                        if (x[0] <= 407.90012) {
-                                            if (x[1] <= 38.542213) {
+                                        if (x[0] < 407.90015f) {
+                                            if (x[1] < 38.542213f) {
                                                 votes[0] += -0.074315146;
                                             }
 
@@ -3219,7 +3222,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 57.912468) {
+                                            if (x[2] < 57.91247f) {
                                                 votes[0] += -0.046325006;
                                             }
 
@@ -3233,11 +3236,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[1] <= 36.114292) {
-                                if (x[0] <= 590.5542) {
-                                    if (x[2] <= 56.40549) {
-                                        if (x[1] <= 30.825401) {
-                                            if (x[2] <= 43.263504) {
+                            if (x[1] < 36.114292f) {
+                                if (x[0] < 590.55426f) {
+                                    if (x[2] < 56.40549f) {
+                                        if (x[1] < 30.825401f) {
+                                            if (x[2] < 43.263504f) {
                                                 votes[0] += 0.039611887;
                                             }
 
@@ -3247,7 +3250,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 46.03911) {
+                                            if (x[2] < 46.039112f) {
                                                 votes[0] += -0.00082448975;
                                             }
 
@@ -3258,12 +3261,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 58.211765) {
+                                        if (x[2] < 58.211765f) {
                                             votes[0] += -0.14122976;
                                         }
 
                                         else {
-                                            if (x[2] <= 65.26101) {
+                                            if (x[2] < 65.26102f) {
                                                 votes[0] += 0.0070140595;
                                             }
 
@@ -3275,9 +3278,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[0] <= 770.6374) {
-                                        if (x[1] <= 30.384491) {
-                                            if (x[2] <= 53.447582) {
+                                    if (x[0] < 770.63745f) {
+                                        if (x[1] < 30.384493f) {
+                                            if (x[2] < 53.447582f) {
                                                 votes[0] += 0.0665858;
                                             }
 
@@ -3287,7 +3290,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 732.3544) {
+                                            if (x[0] < 732.35443f) {
                                                 votes[0] += 0.1021147;
                                             }
 
@@ -3298,12 +3301,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 40.436516) {
+                                        if (x[2] < 40.43652f) {
                                             votes[0] += -0.072100386;
                                         }
 
                                         else {
-                                            if (x[1] <= 21.01245) {
+                                            if (x[1] < 21.012451f) {
                                                 votes[0] += -0.02861841;
                                             }
 
@@ -3316,10 +3319,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[0] <= 481.3896) {
-                                    if (x[2] <= 71.19443) {
-                                        if (x[1] <= 37.172) {
-                                            if (x[0] <= 458.72913) {
+                                if (x[0] < 481.38962f) {
+                                    if (x[2] < 71.194435f) {
+                                        if (x[1] < 37.172f) {
+                                            if (x[0] < 458.72916f) {
                                                 votes[0] += 0.032688867;
                                             }
 
@@ -3339,12 +3342,12 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 79.709854) {
+                                    if (x[2] < 79.709854f) {
                                         votes[0] += 0.11811884;
                                     }
 
                                     else {
-                                        if (x[1] <= 37.04097) {
+                                        if (x[1] < 37.040974f) {
                                             votes[0] += -0.04199489;
                                         }
 
@@ -3357,9 +3360,9 @@ namespace Eloquent {
                         }
 
                         // tree #16
-                        if (x[0] <= 423.75723) {
-                            if (x[0] <= 296.41357) {
-                                if (x[2] <= 41.80311) {
+                        if (x[0] < 423.75723f) {
+                            if (x[0] < 296.41357f) {
+                                if (x[2] < 41.803112f) {
                                     votes[1] += -0.04804757;
                                 }
 
@@ -3369,14 +3372,14 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 31.920872) {
-                                    if (x[2] <= 48.26108) {
+                                if (x[1] < 31.920874f) {
+                                    if (x[2] < 48.26108f) {
                                         votes[1] += -0.12742692;
                                     }
 
                                     else {
-                                        if (x[2] <= 62.149727) {
-                                            if (x[0] <= 405.56747) {
+                                        if (x[2] < 62.14973f) {
+                                            if (x[0] < 405.56747f) {
                                                 votes[1] += 0.019407392;
                                             }
 
@@ -3386,7 +3389,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 30.384491) {
+                                            if (x[1] < 30.384493f) {
                                                 votes[1] += -0.11315021;
                                             }
 
@@ -3398,9 +3401,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 33.87899) {
-                                        if (x[2] <= 53.743607) {
-                                            if (x[0] <= 341.63297) {
+                                    if (x[1] < 33.87899f) {
+                                        if (x[2] < 53.74361f) {
+                                            if (x[0] < 341.633f) {
                                                 votes[1] += 0.06783298;
                                             }
 
@@ -3410,7 +3413,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 359.51407) {
+                                            if (x[0] < 359.5141f) {
                                                 votes[1] += -0.03381888;
                                             }
 
@@ -3421,8 +3424,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 38.30003) {
-                                            if (x[0] <= 417.26404) {
+                                        if (x[1] < 38.300034f) {
+                                            if (x[0] < 417.26407f) {
                                                 votes[1] += -0.08535993;
                                             }
 
@@ -3432,7 +3435,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 58.360905) {
+                                            if (x[2] < 58.36091f) {
                                                 votes[1] += 0.13200665;
                                             }
 
@@ -3446,11 +3449,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[1] <= 36.114292) {
-                                if (x[0] <= 625.17017) {
-                                    if (x[2] <= 56.40549) {
-                                        if (x[1] <= 30.825401) {
-                                            if (x[0] <= 541.0123) {
+                            if (x[1] < 36.114292f) {
+                                if (x[0] < 625.1702f) {
+                                    if (x[2] < 56.40549f) {
+                                        if (x[1] < 30.825401f) {
+                                            if (x[0] < 541.0123f) {
                                                 votes[1] += -0.058644608;
                                             }
 
@@ -3460,7 +3463,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 440.6304) {
+                                            if (x[0] < 440.6304f) {
                                                 votes[1] += 0.13250136;
                                             }
 
@@ -3471,8 +3474,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 467.6232) {
-                                            if (x[0] <= 435.86127) {
+                                        if (x[0] < 467.62323f) {
+                                            if (x[0] < 435.8613f) {
                                                 votes[1] += -0.008305804;
                                             }
 
@@ -3482,7 +3485,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 30.631443) {
+                                            if (x[1] < 30.631443f) {
                                                 votes[1] += -0.059019204;
                                             }
 
@@ -3494,9 +3497,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 22.71323) {
-                                        if (x[0] <= 785.92065) {
-                                            if (x[2] <= 78.80507) {
+                                    if (x[1] < 22.71323f) {
+                                        if (x[0] < 785.92065f) {
+                                            if (x[2] < 78.80508f) {
                                                 votes[1] += -0.01008016;
                                             }
 
@@ -3506,7 +3509,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 46.85027) {
+                                            if (x[2] < 46.850273f) {
                                                 votes[1] += -0.048880007;
                                             }
 
@@ -3517,8 +3520,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 69.29373) {
-                                            if (x[0] <= 710.7871) {
+                                        if (x[2] < 69.29373f) {
+                                            if (x[0] < 710.7871f) {
                                                 votes[1] += 0.11256431;
                                             }
 
@@ -3528,7 +3531,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 734.1381) {
+                                            if (x[0] < 734.1381f) {
                                                 votes[1] += -0.03157615;
                                             }
 
@@ -3541,10 +3544,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[0] <= 481.3896) {
-                                    if (x[2] <= 71.19443) {
-                                        if (x[1] <= 37.172) {
-                                            if (x[0] <= 458.72913) {
+                                if (x[0] < 481.38962f) {
+                                    if (x[2] < 71.194435f) {
+                                        if (x[1] < 37.172f) {
+                                            if (x[0] < 458.72916f) {
                                                 votes[1] += 0.030755443;
                                             }
 
@@ -3564,12 +3567,12 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 79.709854) {
+                                    if (x[2] < 79.709854f) {
                                         votes[1] += 0.11412429;
                                     }
 
                                     else {
-                                        if (x[1] <= 37.04097) {
+                                        if (x[1] < 37.040974f) {
                                             votes[1] += -0.03850609;
                                         }
 
@@ -3582,9 +3585,9 @@ namespace Eloquent {
                         }
 
                         // tree #17
-                        if (x[0] <= 423.75723) {
-                            if (x[0] <= 296.41357) {
-                                if (x[2] <= 41.80311) {
+                        if (x[0] < 423.75723f) {
+                            if (x[0] < 296.41357f) {
+                                if (x[2] < 41.803112f) {
                                     votes[0] += -0.04492055;
                                 }
 
@@ -3594,10 +3597,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[2] <= 78.054855) {
-                                    if (x[1] <= 31.920872) {
-                                        if (x[2] <= 51.675213) {
-                                            if (x[1] <= 20.729221) {
+                                if (x[2] < 78.054855f) {
+                                    if (x[1] < 31.920874f) {
+                                        if (x[2] < 51.675217f) {
+                                            if (x[1] < 20.729221f) {
                                                 votes[0] += 0.027369525;
                                             }
 
@@ -3607,7 +3610,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 62.149727) {
+                                            if (x[2] < 62.14973f) {
                                                 votes[0] += 0.021629315;
                                             }
 
@@ -3618,12 +3621,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 32.600372) {
+                                        if (x[1] < 32.600372f) {
                                             votes[0] += 0.094009414;
                                         }
 
                                         else {
-                                            if (x[1] <= 38.542213) {
+                                            if (x[1] < 38.542213f) {
                                                 votes[0] += -0.037841666;
                                             }
 
@@ -3641,11 +3644,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[1] <= 36.114292) {
-                                if (x[0] <= 738.2404) {
-                                    if (x[2] <= 65.82888) {
-                                        if (x[0] <= 732.3544) {
-                                            if (x[0] <= 625.17017) {
+                            if (x[1] < 36.114292f) {
+                                if (x[0] < 738.2404f) {
+                                    if (x[2] < 65.82888f) {
+                                        if (x[0] < 732.35443f) {
+                                            if (x[0] < 625.1702f) {
                                                 votes[0] += 0.0009638839;
                                             }
 
@@ -3660,8 +3663,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 28.883669) {
-                                            if (x[1] <= 26.169365) {
+                                        if (x[1] < 28.88367f) {
+                                            if (x[1] < 26.169367f) {
                                                 votes[0] += -0.032837287;
                                             }
 
@@ -3671,7 +3674,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 527.90466) {
+                                            if (x[0] < 527.90466f) {
                                                 votes[0] += -0.07585273;
                                             }
 
@@ -3683,17 +3686,17 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 20.018867) {
+                                    if (x[1] < 20.018867f) {
                                         votes[0] += -0.09615959;
                                     }
 
                                     else {
-                                        if (x[2] <= 40.436516) {
+                                        if (x[2] < 40.43652f) {
                                             votes[0] += -0.068928756;
                                         }
 
                                         else {
-                                            if (x[0] <= 947.55585) {
+                                            if (x[0] < 947.5559f) {
                                                 votes[0] += 0.06768577;
                                             }
 
@@ -3706,10 +3709,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[0] <= 481.3896) {
-                                    if (x[2] <= 71.19443) {
-                                        if (x[1] <= 37.172) {
-                                            if (x[0] <= 458.72913) {
+                                if (x[0] < 481.38962f) {
+                                    if (x[2] < 71.194435f) {
+                                        if (x[1] < 37.172f) {
+                                            if (x[0] < 458.72916f) {
                                                 votes[0] += 0.028941888;
                                             }
 
@@ -3729,12 +3732,12 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 79.709854) {
+                                    if (x[2] < 79.709854f) {
                                         votes[0] += 0.110173866;
                                     }
 
                                     else {
-                                        if (x[1] <= 37.04097) {
+                                        if (x[1] < 37.040974f) {
                                             votes[0] += -0.035320148;
                                         }
 
@@ -3747,9 +3750,9 @@ namespace Eloquent {
                         }
 
                         // tree #18
-                        if (x[0] <= 417.26404) {
-                            if (x[0] <= 296.41357) {
-                                if (x[2] <= 41.80311) {
+                        if (x[0] < 417.26407f) {
+                            if (x[0] < 296.41357f) {
+                                if (x[2] < 41.803112f) {
                                     votes[1] += -0.041979503;
                                 }
 
@@ -3759,10 +3762,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[2] <= 62.64101) {
-                                    if (x[2] <= 61.888226) {
-                                        if (x[1] <= 38.542213) {
-                                            if (x[2] <= 44.47733) {
+                                if (x[2] < 62.64101f) {
+                                    if (x[2] < 61.88823f) {
+                                        if (x[1] < 38.542213f) {
+                                            if (x[2] < 44.477333f) {
                                                 votes[1] += -0.124286756;
                                             }
 
@@ -3772,7 +3775,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 55.17409) {
+                                            if (x[2] < 55.17409f) {
                                                 votes[1] += 0.12791725;
                                             }
 
@@ -3788,9 +3791,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[0] <= 367.1976) {
-                                        if (x[1] <= 38.542213) {
-                                            if (x[1] <= 25.132944) {
+                                    if (x[0] < 367.1976f) {
+                                        if (x[1] < 38.542213f) {
+                                            if (x[1] < 25.132944f) {
                                                 votes[1] += -0.045235496;
                                             }
 
@@ -3805,8 +3808,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 34.967686) {
-                                            if (x[1] <= 30.211615) {
+                                        if (x[1] < 34.96769f) {
+                                            if (x[1] < 30.211617f) {
                                                 votes[1] += -0.09970317;
                                             }
 
@@ -3824,11 +3827,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[1] <= 36.114292) {
-                                if (x[0] <= 590.5542) {
-                                    if (x[1] <= 34.14794) {
-                                        if (x[2] <= 73.89908) {
-                                            if (x[2] <= 42.482048) {
+                            if (x[1] < 36.114292f) {
+                                if (x[0] < 590.55426f) {
+                                    if (x[1] < 34.14794f) {
+                                        if (x[2] < 73.899086f) {
+                                            if (x[2] < 42.482048f) {
                                                 votes[1] += 0.055548567;
                                             }
 
@@ -3843,12 +3846,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 435.86127) {
+                                        if (x[0] < 435.8613f) {
                                             votes[1] += 0.12745535;
                                         }
 
                                         else {
-                                            if (x[2] <= 56.40549) {
+                                            if (x[2] < 56.40549f) {
                                                 votes[1] += 0.0812176;
                                             }
 
@@ -3860,9 +3863,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 25.043457) {
-                                        if (x[0] <= 695.8238) {
-                                            if (x[1] <= 20.399458) {
+                                    if (x[1] < 25.043457f) {
+                                        if (x[0] < 695.82385f) {
+                                            if (x[1] < 20.39946f) {
                                                 votes[1] += 0.123296745;
                                             }
 
@@ -3872,7 +3875,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 20.129288) {
+                                            if (x[1] < 20.12929f) {
                                                 votes[1] += -0.09787064;
                                             }
 
@@ -3883,8 +3886,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 70.478676) {
-                                            if (x[0] <= 710.7871) {
+                                        if (x[2] < 70.47868f) {
+                                            if (x[0] < 710.7871f) {
                                                 votes[1] += 0.09011081;
                                             }
 
@@ -3894,7 +3897,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 782.4254) {
+                                            if (x[0] < 782.4254f) {
                                                 votes[1] += -0.014321339;
                                             }
 
@@ -3907,14 +3910,14 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[2] <= 79.709854) {
-                                    if (x[2] <= 50.855995) {
+                                if (x[2] < 79.709854f) {
+                                    if (x[2] < 50.855995f) {
                                         votes[1] += 0.12653252;
                                     }
 
                                     else {
-                                        if (x[2] <= 54.99588) {
-                                            if (x[0] <= 726.87604) {
+                                        if (x[2] < 54.99588f) {
+                                            if (x[0] < 726.8761f) {
                                                 votes[1] += -0.05613594;
                                             }
 
@@ -3930,12 +3933,12 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[0] <= 531.1496) {
+                                    if (x[0] < 531.14966f) {
                                         votes[1] += -0.052287098;
                                     }
 
                                     else {
-                                        if (x[0] <= 782.4254) {
+                                        if (x[0] < 782.4254f) {
                                             votes[1] += 0.08257494;
                                         }
 
@@ -3948,13 +3951,13 @@ namespace Eloquent {
                         }
 
                         // tree #19
-                        if (x[0] <= 314.83585) {
-                            if (x[1] <= 38.30003) {
+                        if (x[0] < 314.83588f) {
+                            if (x[1] < 38.300034f) {
                                 votes[0] += -0.13139465;
                             }
 
                             else {
-                                if (x[2] <= 55.17409) {
+                                if (x[2] < 55.17409f) {
                                     votes[0] += 0.045269333;
                                 }
 
@@ -3965,15 +3968,15 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[0] <= 544.88226) {
-                                if (x[1] <= 32.16639) {
-                                    if (x[1] <= 20.018867) {
+                            if (x[0] < 544.88226f) {
+                                if (x[1] < 32.166393f) {
+                                    if (x[1] < 20.018867f) {
                                         votes[0] += 0.08496691;
                                     }
 
                                     else {
-                                        if (x[0] <= 330.20743) {
-                                            if (x[1] <= 24.867933) {
+                                        if (x[0] < 330.20746f) {
+                                            if (x[1] < 24.867933f) {
                                                 votes[0] += -0.023587542;
                                             }
 
@@ -3983,7 +3986,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 28.578886) {
+                                            if (x[1] < 28.578886f) {
                                                 votes[0] += -0.078668356;
                                             }
 
@@ -3995,9 +3998,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 79.210014) {
-                                        if (x[0] <= 479.10492) {
-                                            if (x[1] <= 38.352947) {
+                                    if (x[2] < 79.210014f) {
+                                        if (x[0] < 479.10495f) {
+                                            if (x[1] < 38.352947f) {
                                                 votes[0] += -0.011595936;
                                             }
 
@@ -4007,7 +4010,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 66.00447) {
+                                            if (x[2] < 66.00447f) {
                                                 votes[0] += 0.088655606;
                                             }
 
@@ -4018,7 +4021,7 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 37.73191) {
+                                        if (x[1] < 37.73191f) {
                                             votes[0] += -0.116327986;
                                         }
 
@@ -4030,10 +4033,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 25.043457) {
-                                    if (x[0] <= 695.8238) {
-                                        if (x[1] <= 20.399458) {
-                                            if (x[0] <= 616.0299) {
+                                if (x[1] < 25.043457f) {
+                                    if (x[0] < 695.82385f) {
+                                        if (x[1] < 20.39946f) {
+                                            if (x[0] < 616.0299f) {
                                                 votes[0] += -0.0056384574;
                                             }
 
@@ -4043,7 +4046,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 645.9767) {
+                                            if (x[0] < 645.97675f) {
                                                 votes[0] += -0.0069644945;
                                             }
 
@@ -4054,12 +4057,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 20.129288) {
+                                        if (x[1] < 20.12929f) {
                                             votes[0] += -0.09091381;
                                         }
 
                                         else {
-                                            if (x[2] <= 79.62927) {
+                                            if (x[2] < 79.62927f) {
                                                 votes[0] += 0.04685601;
                                             }
 
@@ -4071,13 +4074,13 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 36.114292) {
-                                        if (x[0] <= 552.701) {
+                                    if (x[1] < 36.114292f) {
+                                        if (x[0] < 552.70105f) {
                                             votes[0] += 0.14816855;
                                         }
 
                                         else {
-                                            if (x[0] <= 590.5542) {
+                                            if (x[0] < 590.55426f) {
                                                 votes[0] += -0.033754233;
                                             }
 
@@ -4088,12 +4091,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 701.65985) {
+                                        if (x[0] < 701.65985f) {
                                             votes[0] += 0.11964049;
                                         }
 
                                         else {
-                                            if (x[0] <= 726.87604) {
+                                            if (x[0] < 726.8761f) {
                                                 votes[0] += -0.057960823;
                                             }
 
@@ -4107,14 +4110,14 @@ namespace Eloquent {
                         }
 
                         // tree #20
-                        if (x[0] <= 314.83585) {
-                            if (x[1] <= 38.30003) {
+                        if (x[0] < 314.83588f) {
+                            if (x[1] < 38.300034f) {
                                 votes[1] += -0.12982923;
                             }
 
                             else {
-                                if (x[2] <= 55.17409) {
-                                    if (x[0] <= 257.41623) {
+                                if (x[2] < 55.17409f) {
+                                    if (x[0] < 257.41626f) {
                                         votes[1] += 0.0011510197;
                                     }
 
@@ -4130,11 +4133,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[0] <= 544.88226) {
-                                if (x[2] <= 79.210014) {
-                                    if (x[1] <= 32.16639) {
-                                        if (x[0] <= 330.20743) {
-                                            if (x[2] <= 51.39405) {
+                            if (x[0] < 544.88226f) {
+                                if (x[2] < 79.210014f) {
+                                    if (x[1] < 32.166393f) {
+                                        if (x[0] < 330.20746f) {
+                                            if (x[2] < 51.39405f) {
                                                 votes[1] += -0.03825905;
                                             }
 
@@ -4144,7 +4147,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 28.578886) {
+                                            if (x[1] < 28.578886f) {
                                                 votes[1] += -0.06316772;
                                             }
 
@@ -4155,8 +4158,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 345.38968) {
-                                            if (x[2] <= 51.562855) {
+                                        if (x[0] < 345.3897f) {
+                                            if (x[2] < 51.56286f) {
                                                 votes[1] += 0.013575431;
                                             }
 
@@ -4166,7 +4169,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 37.801674) {
+                                            if (x[1] < 37.801678f) {
                                                 votes[1] += 0.012516691;
                                             }
 
@@ -4178,7 +4181,7 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 37.73191) {
+                                    if (x[1] < 37.73191f) {
                                         votes[1] += -0.12749326;
                                     }
 
@@ -4189,10 +4192,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 36.114292) {
-                                    if (x[0] <= 770.6374) {
-                                        if (x[2] <= 49.68597) {
-                                            if (x[0] <= 729.4047) {
+                                if (x[1] < 36.114292f) {
+                                    if (x[0] < 770.63745f) {
+                                        if (x[2] < 49.68597f) {
+                                            if (x[0] < 729.4047f) {
                                                 votes[1] += 0.07532879;
                                             }
 
@@ -4202,7 +4205,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 27.744463) {
+                                            if (x[1] < 27.744465f) {
                                                 votes[1] += -0.026248967;
                                             }
 
@@ -4213,12 +4216,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 40.064274) {
+                                        if (x[2] < 40.064278f) {
                                             votes[1] += -0.090632565;
                                         }
 
                                         else {
-                                            if (x[1] <= 21.01245) {
+                                            if (x[1] < 21.012451f) {
                                                 votes[1] += -0.034307007;
                                             }
 
@@ -4230,17 +4233,17 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[0] <= 701.65985) {
+                                    if (x[0] < 701.65985f) {
                                         votes[1] += 0.11695825;
                                     }
 
                                     else {
-                                        if (x[0] <= 726.87604) {
+                                        if (x[0] < 726.8761f) {
                                             votes[1] += -0.052808367;
                                         }
 
                                         else {
-                                            if (x[2] <= 80.566864) {
+                                            if (x[2] < 80.566864f) {
                                                 votes[1] += 0.09530828;
                                             }
 
@@ -4254,14 +4257,14 @@ namespace Eloquent {
                         }
 
                         // tree #21
-                        if (x[0] <= 314.83585) {
-                            if (x[1] <= 38.30003) {
+                        if (x[0] < 314.83588f) {
+                            if (x[1] < 38.300034f) {
                                 votes[0] += -0.12832879;
                             }
 
                             else {
-                                if (x[2] <= 55.17409) {
-                                    if (x[0] <= 257.41623) {
+                                if (x[2] < 55.17409f) {
+                                    if (x[0] < 257.41626f) {
                                         votes[0] += 0.0010752849;
                                     }
 
@@ -4277,15 +4280,15 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[0] <= 544.88226) {
-                                if (x[2] <= 79.210014) {
-                                    if (x[1] <= 32.16639) {
-                                        if (x[1] <= 20.018867) {
+                            if (x[0] < 544.88226f) {
+                                if (x[2] < 79.210014f) {
+                                    if (x[1] < 32.166393f) {
+                                        if (x[1] < 20.018867f) {
                                             votes[0] += 0.08336442;
                                         }
 
                                         else {
-                                            if (x[2] <= 51.675213) {
+                                            if (x[2] < 51.675217f) {
                                                 votes[0] += -0.071957126;
                                             }
 
@@ -4296,8 +4299,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 56.40549) {
-                                            if (x[2] <= 43.940857) {
+                                        if (x[2] < 56.40549f) {
+                                            if (x[2] < 43.94086f) {
                                                 votes[0] += -0.027699199;
                                             }
 
@@ -4307,7 +4310,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 57.912468) {
+                                            if (x[2] < 57.91247f) {
                                                 votes[0] += -0.13271233;
                                             }
 
@@ -4319,7 +4322,7 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 37.73191) {
+                                    if (x[1] < 37.73191f) {
                                         votes[0] += -0.12367006;
                                     }
 
@@ -4330,10 +4333,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 36.114292) {
-                                    if (x[0] <= 776.13245) {
-                                        if (x[2] <= 49.68597) {
-                                            if (x[2] <= 48.0909) {
+                                if (x[1] < 36.114292f) {
+                                    if (x[0] < 776.1325f) {
+                                        if (x[2] < 49.68597f) {
+                                            if (x[2] < 48.0909f) {
                                                 votes[0] += 0.03280374;
                                             }
 
@@ -4343,7 +4346,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 22.71323) {
+                                            if (x[1] < 22.71323f) {
                                                 votes[0] += -0.04786106;
                                             }
 
@@ -4354,8 +4357,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 947.55585) {
-                                            if (x[2] <= 40.436516) {
+                                        if (x[0] < 947.5559f) {
+                                            if (x[2] < 40.43652f) {
                                                 votes[0] += -0.057800196;
                                             }
 
@@ -4365,7 +4368,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 62.149727) {
+                                            if (x[2] < 62.14973f) {
                                                 votes[0] += -0.12540264;
                                             }
 
@@ -4377,17 +4380,17 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[0] <= 701.65985) {
+                                    if (x[0] < 701.65985f) {
                                         votes[0] += 0.11431017;
                                     }
 
                                     else {
-                                        if (x[0] <= 726.87604) {
+                                        if (x[0] < 726.8761f) {
                                             votes[0] += -0.048131708;
                                         }
 
                                         else {
-                                            if (x[2] <= 80.566864) {
+                                            if (x[2] < 80.566864f) {
                                                 votes[0] += 0.09137396;
                                             }
 
@@ -4401,13 +4404,13 @@ namespace Eloquent {
                         }
 
                         // tree #22
-                        if (x[0] <= 314.83585) {
-                            if (x[1] <= 38.30003) {
+                        if (x[0] < 314.83588f) {
+                            if (x[1] < 38.300034f) {
                                 votes[1] += -0.12686916;
                             }
 
                             else {
-                                if (x[0] <= 252.73064) {
+                                if (x[0] < 252.73065f) {
                                     votes[1] += -0.08720644;
                                 }
 
@@ -4418,11 +4421,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[0] <= 625.17017) {
-                                if (x[2] <= 63.751545) {
-                                    if (x[1] <= 30.892618) {
-                                        if (x[1] <= 30.110416) {
-                                            if (x[2] <= 51.562855) {
+                            if (x[0] < 625.1702f) {
+                                if (x[2] < 63.75155f) {
+                                    if (x[1] < 30.892618f) {
+                                        if (x[1] < 30.110416f) {
+                                            if (x[2] < 51.56286f) {
                                                 votes[1] += -0.031293657;
                                             }
 
@@ -4437,8 +4440,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 423.75723) {
-                                            if (x[2] <= 61.888226) {
+                                        if (x[0] < 423.75723f) {
+                                            if (x[2] < 61.88823f) {
                                                 votes[1] += -0.028107041;
                                             }
 
@@ -4448,7 +4451,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 54.59972) {
+                                            if (x[2] < 54.59972f) {
                                                 votes[1] += 0.08232731;
                                             }
 
@@ -4460,9 +4463,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 29.79249) {
-                                        if (x[1] <= 26.169365) {
-                                            if (x[1] <= 25.73039) {
+                                    if (x[1] < 29.79249f) {
+                                        if (x[1] < 26.169367f) {
+                                            if (x[1] < 25.73039f) {
                                                 votes[1] += -0.069473915;
                                             }
 
@@ -4477,8 +4480,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 30.713133) {
-                                            if (x[0] <= 484.00253) {
+                                        if (x[1] < 30.713135f) {
+                                            if (x[0] < 484.00253f) {
                                                 votes[1] += 0.012731038;
                                             }
 
@@ -4488,7 +4491,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 72.427734) {
+                                            if (x[2] < 72.427734f) {
                                                 votes[1] += -0.054990012;
                                             }
 
@@ -4501,10 +4504,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 22.71323) {
-                                    if (x[1] <= 22.522203) {
-                                        if (x[1] <= 21.250526) {
-                                            if (x[1] <= 20.634876) {
+                                if (x[1] < 22.71323f) {
+                                    if (x[1] < 22.522203f) {
+                                        if (x[1] < 21.250526f) {
+                                            if (x[1] < 20.634876f) {
                                                 votes[1] += 0.03912721;
                                             }
 
@@ -4514,7 +4517,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 688.57074) {
+                                            if (x[0] < 688.5708f) {
                                                 votes[1] += -0.052333947;
                                             }
 
@@ -4525,7 +4528,7 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 54.99588) {
+                                        if (x[2] < 54.99588f) {
                                             votes[1] += -0.108874775;
                                         }
 
@@ -4536,13 +4539,13 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[0] <= 638.90485) {
-                                        if (x[2] <= 71.62899) {
+                                    if (x[0] < 638.9049f) {
+                                        if (x[2] < 71.62899f) {
                                             votes[1] += 0.1245239;
                                         }
 
                                         else {
-                                            if (x[1] <= 27.594748) {
+                                            if (x[1] < 27.59475f) {
                                                 votes[1] += -0.015398273;
                                             }
 
@@ -4553,8 +4556,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 658.26306) {
-                                            if (x[2] <= 72.28223) {
+                                        if (x[0] < 658.26306f) {
+                                            if (x[2] < 72.282234f) {
                                                 votes[1] += 0.02673764;
                                             }
 
@@ -4564,7 +4567,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 81.24894) {
+                                            if (x[2] < 81.24895f) {
                                                 votes[1] += 0.03516402;
                                             }
 
@@ -4578,14 +4581,14 @@ namespace Eloquent {
                         }
 
                         // tree #23
-                        if (x[0] <= 314.83585) {
-                            if (x[1] <= 38.30003) {
+                        if (x[0] < 314.83588f) {
+                            if (x[1] < 38.300034f) {
                                 votes[0] += -0.12542893;
                             }
 
                             else {
-                                if (x[2] <= 55.17409) {
-                                    if (x[2] <= 45.08949) {
+                                if (x[2] < 55.17409f) {
+                                    if (x[2] < 45.089493f) {
                                         votes[0] += 0.047688913;
                                     }
 
@@ -4601,11 +4604,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[0] <= 504.64285) {
-                                if (x[2] <= 79.210014) {
-                                    if (x[1] <= 31.595858) {
-                                        if (x[0] <= 330.20743) {
-                                            if (x[2] <= 51.39405) {
+                            if (x[0] < 504.64285f) {
+                                if (x[2] < 79.210014f) {
+                                    if (x[1] < 31.59586f) {
+                                        if (x[0] < 330.20746f) {
+                                            if (x[2] < 51.39405f) {
                                                 votes[0] += -0.03187837;
                                             }
 
@@ -4615,7 +4618,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 471.12207) {
+                                            if (x[0] < 471.12207f) {
                                                 votes[0] += -0.03360174;
                                             }
 
@@ -4626,8 +4629,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 54.241096) {
-                                            if (x[2] <= 43.940857) {
+                                        if (x[2] < 54.241096f) {
+                                            if (x[2] < 43.94086f) {
                                                 votes[0] += -0.04881994;
                                             }
 
@@ -4637,7 +4640,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 73.4999) {
+                                            if (x[2] < 73.4999f) {
                                                 votes[0] += -0.031032318;
                                             }
 
@@ -4654,10 +4657,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 36.843307) {
-                                    if (x[0] <= 790.87964) {
-                                        if (x[2] <= 66.143585) {
-                                            if (x[2] <= 43.263504) {
+                                if (x[1] < 36.843307f) {
+                                    if (x[0] < 790.8797f) {
+                                        if (x[2] < 66.143585f) {
+                                            if (x[2] < 43.263504f) {
                                                 votes[0] += 0.09307572;
                                             }
 
@@ -4667,7 +4670,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 68.58206) {
+                                            if (x[2] < 68.58206f) {
                                                 votes[0] += -0.14651145;
                                             }
 
@@ -4678,8 +4681,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 50.239025) {
-                                            if (x[1] <= 31.920872) {
+                                        if (x[2] < 50.239025f) {
+                                            if (x[1] < 31.920874f) {
                                                 votes[0] += 0.023881666;
                                             }
 
@@ -4689,7 +4692,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 25.541386) {
+                                            if (x[1] < 25.541388f) {
                                                 votes[0] += 0.02061121;
                                             }
 
@@ -4701,17 +4704,17 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[0] <= 721.23737) {
+                                    if (x[0] < 721.2374f) {
                                         votes[0] += 0.11485263;
                                     }
 
                                     else {
-                                        if (x[0] <= 770.6374) {
+                                        if (x[0] < 770.63745f) {
                                             votes[0] += -0.017273882;
                                         }
 
                                         else {
-                                            if (x[1] <= 38.900482) {
+                                            if (x[1] < 38.900482f) {
                                                 votes[0] += 0.10067423;
                                             }
 
@@ -4725,14 +4728,14 @@ namespace Eloquent {
                         }
 
                         // tree #24
-                        if (x[0] <= 314.83585) {
-                            if (x[1] <= 38.30003) {
+                        if (x[0] < 314.83588f) {
+                            if (x[1] < 38.300034f) {
                                 votes[1] += -0.123988986;
                             }
 
                             else {
-                                if (x[2] <= 55.17409) {
-                                    if (x[0] <= 257.41623) {
+                                if (x[2] < 55.17409f) {
+                                    if (x[0] < 257.41626f) {
                                         votes[1] += 0.0020222466;
                                     }
 
@@ -4748,11 +4751,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[0] <= 590.5542) {
-                                if (x[2] <= 79.210014) {
-                                    if (x[1] <= 38.352947) {
-                                        if (x[0] <= 560.3891) {
-                                            if (x[0] <= 544.88226) {
+                            if (x[0] < 590.55426f) {
+                                if (x[2] < 79.210014f) {
+                                    if (x[1] < 38.352947f) {
+                                        if (x[0] < 560.38916f) {
+                                            if (x[0] < 544.88226f) {
                                                 votes[1] += -0.013471782;
                                             }
 
@@ -4762,7 +4765,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 28.26345) {
+                                            if (x[1] < 28.26345f) {
                                                 votes[1] += -0.09911925;
                                             }
 
@@ -4773,8 +4776,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 417.26404) {
-                                            if (x[2] <= 59.24511) {
+                                        if (x[0] < 417.26407f) {
+                                            if (x[2] < 59.245113f) {
                                                 votes[1] += 0.05142279;
                                             }
 
@@ -4790,7 +4793,7 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 37.73191) {
+                                    if (x[1] < 37.73191f) {
                                         votes[1] += -0.10624366;
                                     }
 
@@ -4801,10 +4804,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 35.330547) {
-                                    if (x[0] <= 947.55585) {
-                                        if (x[0] <= 906.1853) {
-                                            if (x[0] <= 892.30054) {
+                                if (x[1] < 35.330547f) {
+                                    if (x[0] < 947.5559f) {
+                                        if (x[0] < 906.1853f) {
+                                            if (x[0] < 892.3006f) {
                                                 votes[1] += 0.016999323;
                                             }
 
@@ -4814,7 +4817,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 46.85027) {
+                                            if (x[2] < 46.850273f) {
                                                 votes[1] += -0.014557687;
                                             }
 
@@ -4830,13 +4833,13 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[0] <= 785.92065) {
-                                        if (x[0] <= 701.65985) {
+                                    if (x[0] < 785.92065f) {
+                                        if (x[0] < 701.65985f) {
                                             votes[1] += 0.10848955;
                                         }
 
                                         else {
-                                            if (x[1] <= 38.183506) {
+                                            if (x[1] < 38.183506f) {
                                                 votes[1] += -0.07591977;
                                             }
 
@@ -4847,7 +4850,7 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 38.900482) {
+                                        if (x[1] < 38.900482f) {
                                             votes[1] += 0.11375318;
                                         }
 
@@ -4860,8 +4863,8 @@ namespace Eloquent {
                         }
 
                         // tree #25
-                        if (x[0] <= 296.41357) {
-                            if (x[2] <= 41.80311) {
+                        if (x[0] < 296.41357f) {
+                            if (x[2] < 41.803112f) {
                                 votes[0] += -0.0046393904;
                             }
 
@@ -4871,11 +4874,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[0] <= 734.1381) {
-                                if (x[0] <= 732.3544) {
-                                    if (x[1] <= 30.384491) {
-                                        if (x[2] <= 65.82888) {
-                                            if (x[1] <= 30.110416) {
+                            if (x[0] < 734.1381f) {
+                                if (x[0] < 732.35443f) {
+                                    if (x[1] < 30.384493f) {
+                                        if (x[2] < 65.82888f) {
+                                            if (x[1] < 30.110416f) {
                                                 votes[0] += 0.005682635;
                                             }
 
@@ -4885,7 +4888,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 73.71919) {
+                                            if (x[2] < 73.71919f) {
                                                 votes[0] += -0.093654886;
                                             }
 
@@ -4896,8 +4899,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 479.10492) {
-                                            if (x[2] <= 54.241096) {
+                                        if (x[0] < 479.10495f) {
+                                            if (x[2] < 54.241096f) {
                                                 votes[0] += 0.023237713;
                                             }
 
@@ -4907,7 +4910,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 590.5542) {
+                                            if (x[0] < 590.55426f) {
                                                 votes[0] += 0.028500626;
                                             }
 
@@ -4924,14 +4927,14 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 20.129288) {
+                                if (x[1] < 20.12929f) {
                                     votes[0] += -0.07479685;
                                 }
 
                                 else {
-                                    if (x[0] <= 947.55585) {
-                                        if (x[0] <= 906.1853) {
-                                            if (x[0] <= 892.30054) {
+                                    if (x[0] < 947.5559f) {
+                                        if (x[0] < 906.1853f) {
+                                            if (x[0] < 892.3006f) {
                                                 votes[0] += 0.039214376;
                                             }
 
@@ -4941,7 +4944,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 42.703293) {
+                                            if (x[2] < 42.703297f) {
                                                 votes[0] += -0.028544284;
                                             }
 
@@ -4952,7 +4955,7 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 62.149727) {
+                                        if (x[2] < 62.14973f) {
                                             votes[0] += -0.11616054;
                                         }
 
@@ -4965,8 +4968,8 @@ namespace Eloquent {
                         }
 
                         // tree #26
-                        if (x[0] <= 296.41357) {
-                            if (x[2] <= 41.80311) {
+                        if (x[0] < 296.41357f) {
+                            if (x[2] < 41.803112f) {
                                 votes[1] += -0.0043322765;
                             }
 
@@ -4976,11 +4979,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[1] <= 38.542213) {
-                                if (x[0] <= 544.88226) {
-                                    if (x[2] <= 79.210014) {
-                                        if (x[2] <= 77.68886) {
-                                            if (x[2] <= 74.12817) {
+                            if (x[1] < 38.542213f) {
+                                if (x[0] < 544.88226f) {
+                                    if (x[2] < 79.210014f) {
+                                        if (x[2] < 77.688866f) {
+                                            if (x[2] < 74.128174f) {
                                                 votes[1] += -0.0114240935;
                                             }
 
@@ -5000,9 +5003,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 25.043457) {
-                                        if (x[1] <= 24.392698) {
-                                            if (x[2] <= 72.926735) {
+                                    if (x[1] < 25.043457f) {
+                                        if (x[1] < 24.392698f) {
+                                            if (x[2] < 72.92674f) {
                                                 votes[1] += -0.013481825;
                                             }
 
@@ -5012,7 +5015,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 62.937542) {
+                                            if (x[2] < 62.937546f) {
                                                 votes[1] += 0.006779127;
                                             }
 
@@ -5023,12 +5026,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 552.701) {
+                                        if (x[0] < 552.70105f) {
                                             votes[1] += 0.13036251;
                                         }
 
                                         else {
-                                            if (x[0] <= 576.5611) {
+                                            if (x[0] < 576.56116f) {
                                                 votes[1] += -0.041642424;
                                             }
 
@@ -5041,13 +5044,13 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[2] <= 58.360905) {
+                                if (x[2] < 58.36091f) {
                                     votes[1] += 0.12395181;
                                 }
 
                                 else {
-                                    if (x[0] <= 417.26404) {
-                                        if (x[2] <= 68.12912) {
+                                    if (x[0] < 417.26407f) {
+                                        if (x[2] < 68.12913f) {
                                             votes[1] += -0.076578945;
                                         }
 
@@ -5057,7 +5060,7 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 819.48444) {
+                                        if (x[0] < 819.4845f) {
                                             votes[1] += 0.09573002;
                                         }
 
@@ -5070,8 +5073,8 @@ namespace Eloquent {
                         }
 
                         // tree #27
-                        if (x[0] <= 296.41357) {
-                            if (x[2] <= 41.80311) {
+                        if (x[0] < 296.41357f) {
+                            if (x[2] < 41.803112f) {
                                 votes[0] += -0.004045464;
                             }
 
@@ -5081,11 +5084,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[1] <= 38.542213) {
-                                if (x[0] <= 776.13245) {
-                                    if (x[2] <= 65.46384) {
-                                        if (x[0] <= 519.74194) {
-                                            if (x[1] <= 31.542341) {
+                            if (x[1] < 38.542213f) {
+                                if (x[0] < 776.1325f) {
+                                    if (x[2] < 65.463844f) {
+                                        if (x[0] < 519.74194f) {
+                                            if (x[1] < 31.542341f) {
                                                 votes[0] += -0.032315053;
                                             }
 
@@ -5095,7 +5098,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 710.7871) {
+                                            if (x[0] < 710.7871f) {
                                                 votes[0] += 0.03269787;
                                             }
 
@@ -5106,8 +5109,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 68.58206) {
-                                            if (x[2] <= 66.143585) {
+                                        if (x[2] < 68.58206f) {
+                                            if (x[2] < 66.143585f) {
                                                 votes[0] += -0.017159972;
                                             }
 
@@ -5117,7 +5120,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 69.29373) {
+                                            if (x[2] < 69.29373f) {
                                                 votes[0] += 0.07882445;
                                             }
 
@@ -5129,9 +5132,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 81.24894) {
-                                        if (x[2] <= 78.59945) {
-                                            if (x[1] <= 20.881317) {
+                                    if (x[2] < 81.24895f) {
+                                        if (x[2] < 78.59946f) {
+                                            if (x[1] < 20.881317f) {
                                                 votes[0] += -0.061766405;
                                             }
 
@@ -5141,7 +5144,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 24.81341) {
+                                            if (x[1] < 24.813412f) {
                                                 votes[0] += -0.02221585;
                                             }
 
@@ -5158,13 +5161,13 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[2] <= 58.360905) {
+                                if (x[2] < 58.36091f) {
                                     votes[0] += 0.119886264;
                                 }
 
                                 else {
-                                    if (x[0] <= 417.26404) {
-                                        if (x[2] <= 68.12912) {
+                                    if (x[0] < 417.26407f) {
+                                        if (x[2] < 68.12913f) {
                                             votes[0] += -0.07193659;
                                         }
 
@@ -5174,7 +5177,7 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 819.48444) {
+                                        if (x[0] < 819.4845f) {
                                             votes[0] += 0.091373004;
                                         }
 
@@ -5187,13 +5190,13 @@ namespace Eloquent {
                         }
 
                         // tree #28
-                        if (x[0] <= 314.83585) {
-                            if (x[1] <= 38.30003) {
+                        if (x[0] < 314.83588f) {
+                            if (x[1] < 38.300034f) {
                                 votes[1] += -0.11900538;
                             }
 
                             else {
-                                if (x[2] <= 55.17409) {
+                                if (x[2] < 55.17409f) {
                                     votes[1] += 0.04379776;
                                 }
 
@@ -5204,15 +5207,15 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[0] <= 734.1381) {
-                                if (x[0] <= 732.3544) {
-                                    if (x[1] <= 29.664642) {
-                                        if (x[1] <= 20.018867) {
+                            if (x[0] < 734.1381f) {
+                                if (x[0] < 732.35443f) {
+                                    if (x[1] < 29.664642f) {
+                                        if (x[1] < 20.018867f) {
                                             votes[1] += 0.104740225;
                                         }
 
                                         else {
-                                            if (x[2] <= 65.82888) {
+                                            if (x[2] < 65.82888f) {
                                                 votes[1] += -0.0041340054;
                                             }
 
@@ -5223,8 +5226,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 479.10492) {
-                                            if (x[0] <= 463.60718) {
+                                        if (x[0] < 479.10495f) {
+                                            if (x[0] < 463.6072f) {
                                                 votes[1] += -0.0029704005;
                                             }
 
@@ -5234,7 +5237,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 648.6514) {
+                                            if (x[0] < 648.6514f) {
                                                 votes[1] += 0.027156387;
                                             }
 
@@ -5251,10 +5254,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[1] <= 35.330547) {
-                                    if (x[1] <= 31.595858) {
-                                        if (x[1] <= 25.541386) {
-                                            if (x[0] <= 757.1706) {
+                                if (x[1] < 35.330547f) {
+                                    if (x[1] < 31.59586f) {
+                                        if (x[1] < 25.541388f) {
+                                            if (x[0] < 757.17065f) {
                                                 votes[1] += 0.06423342;
                                             }
 
@@ -5264,7 +5267,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 69.29373) {
+                                            if (x[2] < 69.29373f) {
                                                 votes[1] += 0.08979052;
                                             }
 
@@ -5275,8 +5278,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 59.740227) {
-                                            if (x[0] <= 822.7958) {
+                                        if (x[2] < 59.74023f) {
+                                            if (x[0] < 822.79584f) {
                                                 votes[1] += -0.27015674;
                                             }
 
@@ -5286,7 +5289,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 34.832546) {
+                                            if (x[1] < 34.832546f) {
                                                 votes[1] += 0.07071784;
                                             }
 
@@ -5298,17 +5301,17 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 63.293343) {
+                                    if (x[2] < 63.293346f) {
                                         votes[1] += 0.10644644;
                                     }
 
                                     else {
-                                        if (x[2] <= 69.29373) {
+                                        if (x[2] < 69.29373f) {
                                             votes[1] += -0.057412464;
                                         }
 
                                         else {
-                                            if (x[0] <= 785.92065) {
+                                            if (x[0] < 785.92065f) {
                                                 votes[1] += 0.0075787124;
                                             }
 
@@ -5322,8 +5325,8 @@ namespace Eloquent {
                         }
 
                         // tree #29
-                        if (x[0] <= 296.41357) {
-                            if (x[2] <= 41.80311) {
+                        if (x[0] < 296.41357f) {
+                            if (x[2] < 41.803112f) {
                                 votes[0] += 0.0004955154;
                             }
 
@@ -5333,15 +5336,15 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[1] <= 38.352947) {
-                                if (x[0] <= 625.17017) {
-                                    if (x[0] <= 619.1631) {
-                                        if (x[1] <= 20.018867) {
+                            if (x[1] < 38.352947f) {
+                                if (x[0] < 625.1702f) {
+                                    if (x[0] < 619.16315f) {
+                                        if (x[1] < 20.018867f) {
                                             votes[0] += 0.08720571;
                                         }
 
                                         else {
-                                            if (x[1] <= 21.140047) {
+                                            if (x[1] < 21.140047f) {
                                                 votes[0] += -0.07818962;
                                             }
 
@@ -5352,7 +5355,7 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 57.23812) {
+                                        if (x[2] < 57.23812f) {
                                             votes[0] += -0.020444363;
                                         }
 
@@ -5363,13 +5366,13 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[0] <= 638.90485) {
-                                        if (x[1] <= 21.420698) {
+                                    if (x[0] < 638.9049f) {
+                                        if (x[1] < 21.420698f) {
                                             votes[0] += -0.0047040004;
                                         }
 
                                         else {
-                                            if (x[2] <= 71.62899) {
+                                            if (x[2] < 71.62899f) {
                                                 votes[0] += 0.12664104;
                                             }
 
@@ -5380,8 +5383,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 658.26306) {
-                                            if (x[2] <= 72.28223) {
+                                        if (x[0] < 658.26306f) {
+                                            if (x[2] < 72.282234f) {
                                                 votes[0] += 0.010821279;
                                             }
 
@@ -5391,7 +5394,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 947.55585) {
+                                            if (x[0] < 947.5559f) {
                                                 votes[0] += 0.016756434;
                                             }
 
@@ -5404,13 +5407,13 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[0] <= 443.64627) {
-                                    if (x[2] <= 58.360905) {
+                                if (x[0] < 443.64627f) {
+                                    if (x[2] < 58.36091f) {
                                         votes[0] += 0.0937906;
                                     }
 
                                     else {
-                                        if (x[1] <= 38.985462) {
+                                        if (x[1] < 38.985462f) {
                                             votes[0] += 0.039593518;
                                         }
 
@@ -5421,7 +5424,7 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[0] <= 858.6448) {
+                                    if (x[0] < 858.64484f) {
                                         votes[0] += 0.11096347;
                                     }
 
@@ -5433,13 +5436,13 @@ namespace Eloquent {
                         }
 
                         // tree #30
-                        if (x[0] <= 314.83585) {
-                            if (x[1] <= 38.30003) {
+                        if (x[0] < 314.83588f) {
+                            if (x[1] < 38.300034f) {
                                 votes[1] += -0.11612501;
                             }
 
                             else {
-                                if (x[2] <= 47.122883) {
+                                if (x[2] < 47.122887f) {
                                     votes[1] += 0.034092072;
                                 }
 
@@ -5450,11 +5453,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[1] <= 38.352947) {
-                                if (x[0] <= 790.87964) {
-                                    if (x[2] <= 65.46384) {
-                                        if (x[2] <= 65.12514) {
-                                            if (x[1] <= 21.250526) {
+                            if (x[1] < 38.352947f) {
+                                if (x[0] < 790.8797f) {
+                                    if (x[2] < 65.463844f) {
+                                        if (x[2] < 65.125145f) {
+                                            if (x[1] < 21.250526f) {
                                                 votes[1] += -0.042931043;
                                             }
 
@@ -5469,8 +5472,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 68.58206) {
-                                            if (x[2] <= 66.143585) {
+                                        if (x[2] < 68.58206f) {
+                                            if (x[2] < 66.143585f) {
                                                 votes[1] += -0.013757014;
                                             }
 
@@ -5480,7 +5483,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 775.06775) {
+                                            if (x[0] < 775.0678f) {
                                                 votes[1] += -0.005915129;
                                             }
 
@@ -5492,9 +5495,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 65.82888) {
-                                        if (x[0] <= 947.55585) {
-                                            if (x[1] <= 31.595858) {
+                                    if (x[2] < 65.82888f) {
+                                        if (x[0] < 947.5559f) {
+                                            if (x[1] < 31.59586f) {
                                                 votes[1] += 0.03281727;
                                             }
 
@@ -5509,8 +5512,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 26.744131) {
-                                            if (x[1] <= 24.81341) {
+                                        if (x[1] < 26.744131f) {
+                                            if (x[1] < 24.813412f) {
                                                 votes[1] += 0.06151444;
                                             }
 
@@ -5520,7 +5523,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 902.92206) {
+                                            if (x[0] < 902.9221f) {
                                                 votes[1] += 0.112855196;
                                             }
 
@@ -5533,8 +5536,8 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[0] <= 443.64627) {
-                                    if (x[1] <= 39.112988) {
+                                if (x[0] < 443.64627f) {
+                                    if (x[1] < 39.11299f) {
                                         votes[1] += 0.07000875;
                                     }
 
@@ -5544,7 +5547,7 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[0] <= 858.6448) {
+                                    if (x[0] < 858.64484f) {
                                         votes[1] += 0.10810743;
                                     }
 
@@ -5556,8 +5559,8 @@ namespace Eloquent {
                         }
 
                         // tree #31
-                        if (x[0] <= 296.41357) {
-                            if (x[2] <= 42.117752) {
+                        if (x[0] < 296.41357f) {
+                            if (x[2] < 42.117752f) {
                                 votes[0] += 0.001813338;
                             }
 
@@ -5567,11 +5570,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[1] <= 38.542213) {
-                                if (x[0] <= 481.3896) {
-                                    if (x[1] <= 22.522203) {
-                                        if (x[0] <= 437.69418) {
-                                            if (x[0] <= 363.80768) {
+                            if (x[1] < 38.542213f) {
+                                if (x[0] < 481.38962f) {
+                                    if (x[1] < 22.522203f) {
+                                        if (x[0] < 437.69418f) {
+                                            if (x[0] < 363.8077f) {
                                                 votes[0] += 0.058797054;
                                             }
 
@@ -5586,12 +5589,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 24.974325) {
+                                        if (x[1] < 24.974325f) {
                                             votes[0] += -0.116504796;
                                         }
 
                                         else {
-                                            if (x[1] <= 25.22666) {
+                                            if (x[1] < 25.226662f) {
                                                 votes[0] += 0.1011166;
                                             }
 
@@ -5603,9 +5606,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 21.250526) {
-                                        if (x[1] <= 20.79896) {
-                                            if (x[2] <= 51.871273) {
+                                    if (x[1] < 21.250526f) {
+                                        if (x[1] < 20.798962f) {
+                                            if (x[2] < 51.871273f) {
                                                 votes[0] += 0.063398555;
                                             }
 
@@ -5615,7 +5618,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 832.51776) {
+                                            if (x[0] < 832.51776f) {
                                                 votes[0] += -0.119249;
                                             }
 
@@ -5626,8 +5629,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 947.55585) {
-                                            if (x[0] <= 906.1853) {
+                                        if (x[0] < 947.5559f) {
+                                            if (x[0] < 906.1853f) {
                                                 votes[0] += 0.010438357;
                                             }
 
@@ -5644,13 +5647,13 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[2] <= 58.360905) {
+                                if (x[2] < 58.36091f) {
                                     votes[0] += 0.11114481;
                                 }
 
                                 else {
-                                    if (x[0] <= 443.64627) {
-                                        if (x[1] <= 38.985462) {
+                                    if (x[0] < 443.64627f) {
+                                        if (x[1] < 38.985462f) {
                                             votes[0] += 0.038136683;
                                         }
 
@@ -5660,7 +5663,7 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 794.7031) {
+                                        if (x[0] < 794.7031f) {
                                             votes[0] += 0.092271544;
                                         }
 
@@ -5673,8 +5676,8 @@ namespace Eloquent {
                         }
 
                         // tree #32
-                        if (x[0] <= 296.41357) {
-                            if (x[2] <= 42.117752) {
+                        if (x[0] < 296.41357f) {
+                            if (x[2] < 42.117752f) {
                                 votes[1] += 0.0016957037;
                             }
 
@@ -5684,11 +5687,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[1] <= 38.542213) {
-                                if (x[0] <= 576.5611) {
-                                    if (x[0] <= 560.3891) {
-                                        if (x[0] <= 544.88226) {
-                                            if (x[2] <= 79.210014) {
+                            if (x[1] < 38.542213f) {
+                                if (x[0] < 576.56116f) {
+                                    if (x[0] < 560.38916f) {
+                                        if (x[0] < 544.88226f) {
+                                            if (x[2] < 79.210014f) {
                                                 votes[1] += -0.007934813;
                                             }
 
@@ -5698,7 +5701,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 23.228954) {
+                                            if (x[1] < 23.228954f) {
                                                 votes[1] += -0.018799491;
                                             }
 
@@ -5709,8 +5712,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 67.96783) {
-                                            if (x[2] <= 47.122883) {
+                                        if (x[2] < 67.967834f) {
+                                            if (x[2] < 47.122887f) {
                                                 votes[1] += -0.022515172;
                                             }
 
@@ -5726,9 +5729,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 22.71323) {
-                                        if (x[1] <= 22.522203) {
-                                            if (x[2] <= 45.686657) {
+                                    if (x[1] < 22.71323f) {
+                                        if (x[1] < 22.522203f) {
+                                            if (x[2] < 45.68666f) {
                                                 votes[1] += 0.071871094;
                                             }
 
@@ -5743,8 +5746,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 49.621056) {
-                                            if (x[2] <= 45.729034) {
+                                        if (x[2] < 49.62106f) {
+                                            if (x[2] < 45.729034f) {
                                                 votes[1] += 0.0077803587;
                                             }
 
@@ -5754,7 +5757,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 51.675213) {
+                                            if (x[2] < 51.675217f) {
                                                 votes[1] += -0.112890325;
                                             }
 
@@ -5767,17 +5770,17 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[2] <= 58.360905) {
+                                if (x[2] < 58.36091f) {
                                     votes[1] += 0.10730576;
                                 }
 
                                 else {
-                                    if (x[0] <= 417.26404) {
+                                    if (x[0] < 417.26407f) {
                                         votes[1] += -0.04789666;
                                     }
 
                                     else {
-                                        if (x[0] <= 794.7031) {
+                                        if (x[0] < 794.7031f) {
                                             votes[1] += 0.07659849;
                                         }
 
@@ -5790,13 +5793,13 @@ namespace Eloquent {
                         }
 
                         // tree #33
-                        if (x[0] <= 314.83585) {
-                            if (x[1] <= 38.30003) {
+                        if (x[0] < 314.83588f) {
+                            if (x[1] < 38.300034f) {
                                 votes[0] += -0.11169665;
                             }
 
                             else {
-                                if (x[2] <= 52.792973) {
+                                if (x[2] < 52.792976f) {
                                     votes[0] += 0.02629813;
                                 }
 
@@ -5807,15 +5810,15 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[1] <= 38.352947) {
-                                if (x[0] <= 734.1381) {
-                                    if (x[0] <= 732.3544) {
-                                        if (x[1] <= 20.129288) {
+                            if (x[1] < 38.352947f) {
+                                if (x[0] < 734.1381f) {
+                                    if (x[0] < 732.35443f) {
+                                        if (x[1] < 20.12929f) {
                                             votes[0] += 0.093624204;
                                         }
 
                                         else {
-                                            if (x[1] <= 21.250526) {
+                                            if (x[1] < 21.250526f) {
                                                 votes[0] += -0.07946882;
                                             }
 
@@ -5831,17 +5834,17 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 40.064274) {
+                                    if (x[2] < 40.064278f) {
                                         votes[0] += -0.08806367;
                                     }
 
                                     else {
-                                        if (x[1] <= 20.129288) {
+                                        if (x[1] < 20.12929f) {
                                             votes[0] += -0.06784317;
                                         }
 
                                         else {
-                                            if (x[0] <= 947.55585) {
+                                            if (x[0] < 947.5559f) {
                                                 votes[0] += 0.029105913;
                                             }
 
@@ -5854,8 +5857,8 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[0] <= 443.64627) {
-                                    if (x[1] <= 39.112988) {
+                                if (x[0] < 443.64627f) {
+                                    if (x[1] < 39.11299f) {
                                         votes[0] += 0.06324719;
                                     }
 
@@ -5865,7 +5868,7 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[0] <= 841.3053) {
+                                    if (x[0] < 841.30536f) {
                                         votes[0] += 0.100405835;
                                     }
 
@@ -5877,8 +5880,8 @@ namespace Eloquent {
                         }
 
                         // tree #34
-                        if (x[0] <= 296.41357) {
-                            if (x[2] <= 42.35562) {
+                        if (x[0] < 296.41357f) {
+                            if (x[2] < 42.35562f) {
                                 votes[1] += -0.0053903344;
                             }
 
@@ -5888,11 +5891,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[1] <= 38.542213) {
-                                if (x[0] <= 349.31232) {
-                                    if (x[2] <= 55.988033) {
-                                        if (x[2] <= 51.39405) {
-                                            if (x[2] <= 45.729034) {
+                            if (x[1] < 38.542213f) {
+                                if (x[0] < 349.31235f) {
+                                    if (x[2] < 55.988033f) {
+                                        if (x[2] < 51.39405f) {
+                                            if (x[2] < 45.729034f) {
                                                 votes[1] += 0.04915539;
                                             }
 
@@ -5907,7 +5910,7 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 25.132944) {
+                                        if (x[1] < 25.132944f) {
                                             votes[1] += 0.009253166;
                                         }
 
@@ -5918,9 +5921,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[1] <= 28.510113) {
-                                        if (x[2] <= 43.263504) {
-                                            if (x[2] <= 41.68879) {
+                                    if (x[1] < 28.510115f) {
+                                        if (x[2] < 43.263504f) {
+                                            if (x[2] < 41.688793f) {
                                                 votes[1] += 0.0050583277;
                                             }
 
@@ -5930,7 +5933,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 585.0183) {
+                                            if (x[0] < 585.0183f) {
                                                 votes[1] += -0.04583789;
                                             }
 
@@ -5941,8 +5944,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 46.03911) {
-                                            if (x[2] <= 44.878017) {
+                                        if (x[2] < 46.039112f) {
+                                            if (x[2] < 44.878017f) {
                                                 votes[1] += 0.00051363243;
                                             }
 
@@ -5952,7 +5955,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 819.48444) {
+                                            if (x[0] < 819.4845f) {
                                                 votes[1] += 0.011756349;
                                             }
 
@@ -5965,13 +5968,13 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[2] <= 58.360905) {
+                                if (x[2] < 58.36091f) {
                                     votes[1] += 0.10315731;
                                 }
 
                                 else {
-                                    if (x[0] <= 443.64627) {
-                                        if (x[1] <= 38.985462) {
+                                    if (x[0] < 443.64627f) {
+                                        if (x[1] < 38.985462f) {
                                             votes[1] += 0.033880197;
                                         }
 
@@ -5981,7 +5984,7 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 794.7031) {
+                                        if (x[0] < 794.7031f) {
                                             votes[1] += 0.08340471;
                                         }
 
@@ -5994,24 +5997,24 @@ namespace Eloquent {
                         }
 
                         // tree #35
-                        if (x[0] <= 252.73064) {
+                        if (x[0] < 252.73065f) {
                             votes[0] += -0.10271762;
                         }
 
                         else {
-                            if (x[1] <= 38.30003) {
-                                if (x[0] <= 314.83585) {
+                            if (x[1] < 38.300034f) {
+                                if (x[0] < 314.83588f) {
                                     votes[0] += -0.08497582;
                                 }
 
                                 else {
-                                    if (x[0] <= 330.20743) {
-                                        if (x[2] <= 51.39405) {
+                                    if (x[0] < 330.20746f) {
+                                        if (x[2] < 51.39405f) {
                                             votes[0] += -0.028658658;
                                         }
 
                                         else {
-                                            if (x[1] <= 26.360792) {
+                                            if (x[1] < 26.360792f) {
                                                 votes[0] += 0.14807777;
                                             }
 
@@ -6022,8 +6025,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 349.31232) {
-                                            if (x[2] <= 45.889652) {
+                                        if (x[0] < 349.31235f) {
+                                            if (x[2] < 45.889652f) {
                                                 votes[0] += 0.07615743;
                                             }
 
@@ -6033,7 +6036,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 32.53507) {
+                                            if (x[1] < 32.535072f) {
                                                 votes[0] += -0.0030822775;
                                             }
 
@@ -6046,13 +6049,13 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[2] <= 58.360905) {
+                                if (x[2] < 58.36091f) {
                                     votes[0] += 0.09994765;
                                 }
 
                                 else {
-                                    if (x[0] <= 450.72504) {
-                                        if (x[1] <= 38.985462) {
+                                    if (x[0] < 450.72507f) {
+                                        if (x[1] < 38.985462f) {
                                             votes[0] += -0.00015959355;
                                         }
 
@@ -6062,7 +6065,7 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 794.7031) {
+                                        if (x[0] < 794.7031f) {
                                             votes[0] += 0.07781068;
                                         }
 
@@ -6075,13 +6078,13 @@ namespace Eloquent {
                         }
 
                         // tree #36
-                        if (x[0] <= 314.83585) {
-                            if (x[1] <= 38.30003) {
+                        if (x[0] < 314.83588f) {
+                            if (x[1] < 38.300034f) {
                                 votes[1] += -0.10633085;
                             }
 
                             else {
-                                if (x[2] <= 52.792973) {
+                                if (x[2] < 52.792976f) {
                                     votes[1] += 0.0229347;
                                 }
 
@@ -6092,15 +6095,15 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[1] <= 38.352947) {
-                                if (x[0] <= 770.6374) {
-                                    if (x[0] <= 763.64734) {
-                                        if (x[1] <= 20.018867) {
+                            if (x[1] < 38.352947f) {
+                                if (x[0] < 770.63745f) {
+                                    if (x[0] < 763.6474f) {
+                                        if (x[1] < 20.018867f) {
                                             votes[1] += 0.09196263;
                                         }
 
                                         else {
-                                            if (x[2] <= 79.709854) {
+                                            if (x[2] < 79.709854f) {
                                                 votes[1] += 0.00058419316;
                                             }
 
@@ -6111,7 +6114,7 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 23.5819) {
+                                        if (x[1] < 23.581902f) {
                                             votes[1] += -0.14795417;
                                         }
 
@@ -6122,9 +6125,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 81.24894) {
-                                        if (x[2] <= 78.59945) {
-                                            if (x[1] <= 35.330547) {
+                                    if (x[2] < 81.24895f) {
+                                        if (x[2] < 78.59946f) {
+                                            if (x[1] < 35.330547f) {
                                                 votes[1] += 0.008368057;
                                             }
 
@@ -6134,7 +6137,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 841.3053) {
+                                            if (x[0] < 841.30536f) {
                                                 votes[1] += 0.012354074;
                                             }
 
@@ -6145,7 +6148,7 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 82.44895) {
+                                        if (x[2] < 82.44895f) {
                                             votes[1] += 0.027849773;
                                         }
 
@@ -6157,8 +6160,8 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[0] <= 443.64627) {
-                                    if (x[1] <= 39.112988) {
+                                if (x[0] < 443.64627f) {
+                                    if (x[1] < 39.11299f) {
                                         votes[1] += 0.056408744;
                                     }
 
@@ -6168,7 +6171,7 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[0] <= 839.99164) {
+                                    if (x[0] < 839.9917f) {
                                         votes[1] += 0.09253713;
                                     }
 
@@ -6180,19 +6183,19 @@ namespace Eloquent {
                         }
 
                         // tree #37
-                        if (x[0] <= 252.73064) {
+                        if (x[0] < 252.73065f) {
                             votes[0] += -0.098300554;
                         }
 
                         else {
-                            if (x[1] <= 38.30003) {
-                                if (x[0] <= 314.83585) {
+                            if (x[1] < 38.300034f) {
+                                if (x[0] < 314.83588f) {
                                     votes[0] += -0.07906341;
                                 }
 
                                 else {
-                                    if (x[0] <= 330.20743) {
-                                        if (x[2] <= 55.988033) {
+                                    if (x[0] < 330.20746f) {
+                                        if (x[2] < 55.988033f) {
                                             votes[0] += 0.09020273;
                                         }
 
@@ -6202,8 +6205,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 349.31232) {
-                                            if (x[2] <= 45.889652) {
+                                        if (x[0] < 349.31235f) {
+                                            if (x[2] < 45.889652f) {
                                                 votes[0] += 0.069740586;
                                             }
 
@@ -6213,7 +6216,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 47.008823) {
+                                            if (x[2] < 47.008823f) {
                                                 votes[0] += -0.014234513;
                                             }
 
@@ -6226,13 +6229,13 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[2] <= 58.360905) {
+                                if (x[2] < 58.36091f) {
                                     votes[0] += 0.09303256;
                                 }
 
                                 else {
-                                    if (x[0] <= 450.72504) {
-                                        if (x[1] <= 38.985462) {
+                                    if (x[0] < 450.72507f) {
+                                        if (x[1] < 38.985462f) {
                                             votes[0] += -0.0027829653;
                                         }
 
@@ -6242,7 +6245,7 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 73.27636) {
+                                        if (x[2] < 73.27637f) {
                                             votes[0] += 0.0024543505;
                                         }
 
@@ -6255,16 +6258,16 @@ namespace Eloquent {
                         }
 
                         // tree #38
-                        if (x[0] <= 252.73064) {
+                        if (x[0] < 252.73065f) {
                             votes[1] += -0.0958454;
                         }
 
                         else {
-                            if (x[2] <= 44.878017) {
-                                if (x[0] <= 870.47186) {
-                                    if (x[0] <= 423.75723) {
-                                        if (x[2] <= 44.47733) {
-                                            if (x[1] <= 37.04097) {
+                            if (x[2] < 44.878017f) {
+                                if (x[0] < 870.47186f) {
+                                    if (x[0] < 423.75723f) {
+                                        if (x[2] < 44.477333f) {
+                                            if (x[1] < 37.040974f) {
                                                 votes[1] += -0.10871038;
                                             }
 
@@ -6279,8 +6282,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 24.228624) {
-                                            if (x[2] <= 40.99605) {
+                                        if (x[1] < 24.228624f) {
+                                            if (x[2] < 40.99605f) {
                                                 votes[1] += 0.045139477;
                                             }
 
@@ -6290,7 +6293,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 25.359945) {
+                                            if (x[1] < 25.359945f) {
                                                 votes[1] += -0.10446398;
                                             }
 
@@ -6302,7 +6305,7 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 41.68879) {
+                                    if (x[2] < 41.688793f) {
                                         votes[1] += -0.12275802;
                                     }
 
@@ -6313,10 +6316,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[2] <= 47.008823) {
-                                    if (x[1] <= 34.85763) {
-                                        if (x[0] <= 856.5045) {
-                                            if (x[2] <= 46.03911) {
+                                if (x[2] < 47.008823f) {
+                                    if (x[1] < 34.85763f) {
+                                        if (x[0] < 856.5045f) {
+                                            if (x[2] < 46.039112f) {
                                                 votes[1] += -0.14506432;
                                             }
 
@@ -6336,9 +6339,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 49.68597) {
-                                        if (x[0] <= 538.3275) {
-                                            if (x[1] <= 30.825401) {
+                                    if (x[2] < 49.68597f) {
+                                        if (x[0] < 538.3275f) {
+                                            if (x[1] < 30.825401f) {
                                                 votes[1] += -0.06983275;
                                             }
 
@@ -6348,7 +6351,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 22.943266) {
+                                            if (x[1] < 22.943268f) {
                                                 votes[1] += -0.003950352;
                                             }
 
@@ -6359,8 +6362,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 51.39405) {
-                                            if (x[1] <= 22.59358) {
+                                        if (x[2] < 51.39405f) {
+                                            if (x[1] < 22.59358f) {
                                                 votes[1] += 0.017653037;
                                             }
 
@@ -6370,7 +6373,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 52.792973) {
+                                            if (x[2] < 52.792976f) {
                                                 votes[1] += 0.105087675;
                                             }
 
@@ -6384,16 +6387,16 @@ namespace Eloquent {
                         }
 
                         // tree #39
-                        if (x[0] <= 252.73064) {
+                        if (x[0] < 252.73065f) {
                             votes[0] += -0.09335441;
                         }
 
                         else {
-                            if (x[2] <= 55.988033) {
-                                if (x[2] <= 54.99588) {
-                                    if (x[2] <= 54.59972) {
-                                        if (x[0] <= 892.30054) {
-                                            if (x[2] <= 51.675213) {
+                            if (x[2] < 55.988033f) {
+                                if (x[2] < 54.99588f) {
+                                    if (x[2] < 54.59972f) {
+                                        if (x[0] < 892.3006f) {
+                                            if (x[2] < 51.675217f) {
                                                 votes[0] += 0.002323018;
                                             }
 
@@ -6403,7 +6406,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 906.1853) {
+                                            if (x[0] < 906.1853f) {
                                                 votes[0] += -0.17495991;
                                             }
 
@@ -6419,7 +6422,7 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 55.591118) {
+                                    if (x[2] < 55.59112f) {
                                         votes[0] += 0.1488615;
                                     }
 
@@ -6430,14 +6433,14 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[0] <= 882.7415) {
-                                    if (x[0] <= 351.3559) {
-                                        if (x[1] <= 25.132944) {
+                                if (x[0] < 882.7415f) {
+                                    if (x[0] < 351.35593f) {
+                                        if (x[1] < 25.132944f) {
                                             votes[0] += 0.011008208;
                                         }
 
                                         else {
-                                            if (x[2] <= 74.56402) {
+                                            if (x[2] < 74.564026f) {
                                                 votes[0] += -0.1148296;
                                             }
 
@@ -6448,8 +6451,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 28.510113) {
-                                            if (x[1] <= 26.243795) {
+                                        if (x[1] < 28.510115f) {
+                                            if (x[1] < 26.243795f) {
                                                 votes[0] += -0.004761885;
                                             }
 
@@ -6459,7 +6462,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 34.832546) {
+                                            if (x[1] < 34.832546f) {
                                                 votes[0] += 0.027396496;
                                             }
 
@@ -6471,8 +6474,8 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 61.229034) {
-                                        if (x[0] <= 921.6566) {
+                                    if (x[2] < 61.229034f) {
+                                        if (x[0] < 921.6566f) {
                                             votes[0] += 0.07646271;
                                         }
 
@@ -6482,12 +6485,12 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 74.56402) {
+                                        if (x[2] < 74.564026f) {
                                             votes[0] += 0.108928256;
                                         }
 
                                         else {
-                                            if (x[0] <= 906.1853) {
+                                            if (x[0] < 906.1853f) {
                                                 votes[0] += -0.05530731;
                                             }
 
@@ -6501,8 +6504,8 @@ namespace Eloquent {
                         }
 
                         // tree #40
-                        if (x[0] <= 314.83585) {
-                            if (x[1] <= 38.30003) {
+                        if (x[0] < 314.83588f) {
+                            if (x[1] < 38.300034f) {
                                 votes[1] += -0.09902888;
                             }
 
@@ -6512,11 +6515,11 @@ namespace Eloquent {
                         }
 
                         else {
-                            if (x[1] <= 38.352947) {
-                                if (x[0] <= 625.17017) {
-                                    if (x[0] <= 619.1631) {
-                                        if (x[2] <= 62.64101) {
-                                            if (x[2] <= 61.700134) {
+                            if (x[1] < 38.352947f) {
+                                if (x[0] < 625.1702f) {
+                                    if (x[0] < 619.16315f) {
+                                        if (x[2] < 62.64101f) {
+                                            if (x[2] < 61.700134f) {
                                                 votes[1] += -0.0029505328;
                                             }
 
@@ -6526,7 +6529,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[0] <= 367.1976) {
+                                            if (x[0] < 367.1976f) {
                                                 votes[1] += -0.08058362;
                                             }
 
@@ -6537,7 +6540,7 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 27.594748) {
+                                        if (x[1] < 27.59475f) {
                                             votes[1] += -0.10551035;
                                         }
 
@@ -6548,13 +6551,13 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[0] <= 638.90485) {
-                                        if (x[1] <= 21.420698) {
+                                    if (x[0] < 638.9049f) {
+                                        if (x[1] < 21.420698f) {
                                             votes[1] += -0.0042665973;
                                         }
 
                                         else {
-                                            if (x[2] <= 71.62899) {
+                                            if (x[2] < 71.62899f) {
                                                 votes[1] += 0.12047755;
                                             }
 
@@ -6565,8 +6568,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[0] <= 648.6514) {
-                                            if (x[2] <= 72.28223) {
+                                        if (x[0] < 648.6514f) {
+                                            if (x[2] < 72.282234f) {
                                                 votes[1] += 0.015296426;
                                             }
 
@@ -6576,7 +6579,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 40.064274) {
+                                            if (x[2] < 40.064278f) {
                                                 votes[1] += -0.06332358;
                                             }
 
@@ -6589,8 +6592,8 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[0] <= 443.64627) {
-                                    if (x[1] <= 39.112988) {
+                                if (x[0] < 443.64627f) {
+                                    if (x[1] < 39.11299f) {
                                         votes[1] += 0.054195266;
                                     }
 
@@ -6600,7 +6603,7 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[0] <= 832.51776) {
+                                    if (x[0] < 832.51776f) {
                                         votes[1] += 0.08788493;
                                     }
 
@@ -6612,16 +6615,16 @@ namespace Eloquent {
                         }
 
                         // tree #41
-                        if (x[0] <= 252.73064) {
+                        if (x[0] < 252.73065f) {
                             votes[0] += -0.08867838;
                         }
 
                         else {
-                            if (x[2] <= 44.878017) {
-                                if (x[0] <= 870.47186) {
-                                    if (x[0] <= 423.75723) {
-                                        if (x[0] <= 375.31302) {
-                                            if (x[2] <= 43.504555) {
+                            if (x[2] < 44.878017f) {
+                                if (x[0] < 870.47186f) {
+                                    if (x[0] < 423.75723f) {
+                                        if (x[0] < 375.31305f) {
+                                            if (x[2] < 43.50456f) {
                                                 votes[0] += -0.028102735;
                                             }
 
@@ -6636,8 +6639,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[1] <= 24.228624) {
-                                            if (x[0] <= 500.4927) {
+                                        if (x[1] < 24.228624f) {
+                                            if (x[0] < 500.4927f) {
                                                 votes[0] += 0.041422468;
                                             }
 
@@ -6647,7 +6650,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 25.359945) {
+                                            if (x[1] < 25.359945f) {
                                                 votes[0] += -0.09500738;
                                             }
 
@@ -6659,7 +6662,7 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 41.68879) {
+                                    if (x[2] < 41.688793f) {
                                         votes[0] += -0.10402947;
                                     }
 
@@ -6670,10 +6673,10 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[2] <= 47.008823) {
-                                    if (x[1] <= 34.85763) {
-                                        if (x[0] <= 856.5045) {
-                                            if (x[2] <= 46.03911) {
+                                if (x[2] < 47.008823f) {
+                                    if (x[1] < 34.85763f) {
+                                        if (x[0] < 856.5045f) {
+                                            if (x[2] < 46.039112f) {
                                                 votes[0] += -0.1294797;
                                             }
 
@@ -6693,9 +6696,9 @@ namespace Eloquent {
                                 }
 
                                 else {
-                                    if (x[2] <= 49.68597) {
-                                        if (x[0] <= 538.3275) {
-                                            if (x[1] <= 30.825401) {
+                                    if (x[2] < 49.68597f) {
+                                        if (x[0] < 538.3275f) {
+                                            if (x[1] < 30.825401f) {
                                                 votes[0] += -0.064445496;
                                             }
 
@@ -6705,7 +6708,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[1] <= 22.943266) {
+                                            if (x[1] < 22.943268f) {
                                                 votes[0] += -0.0038850624;
                                             }
 
@@ -6716,8 +6719,8 @@ namespace Eloquent {
                                     }
 
                                     else {
-                                        if (x[2] <= 51.39405) {
-                                            if (x[0] <= 625.17017) {
+                                        if (x[2] < 51.39405f) {
+                                            if (x[0] < 625.1702f) {
                                                 votes[0] += -0.10998804;
                                             }
 
@@ -6727,7 +6730,7 @@ namespace Eloquent {
                                         }
 
                                         else {
-                                            if (x[2] <= 52.792973) {
+                                            if (x[2] < 52.792976f) {
                                                 votes[0] += 0.09260302;
                                             }
 
@@ -6755,4 +6758,4 @@ namespace Eloquent {
                 };
             }
         }
-    }
\ No newline at end of file
+    }
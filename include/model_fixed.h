@@ -0,0 +1,2300 @@
+// model_fixed.h
+// Sinh tự động bởi tools/model_export.py từ irrigation_xgb.json - không sửa tay.
+
+#ifndef MODEL_FIXED_H
+#define MODEL_FIXED_H
+
+#include "model_engine.h"
+
+#if MODEL_FIXED_INPUT_Q_BITS != 20 || MODEL_FIXED_LEAF_Q_BITS != 24
+#error "model_fixed.h sinh với Q khác model_engine.h, chạy lại tools/model_export.py"
+#endif
+
+#define MODEL_FIXED_NODE_COUNT 2243
+// logit(0.540) = 0.160342650
+#define MODEL_FIXED_LOGIT_THRESHOLD 2690104
+
+// Node: { feature, right, value } - ngưỡng Q20 hoặc lá Q24
+static const ModelFixedNode MODEL_FIXED_NODES[MODEL_FIXED_NODE_COUNT] = {
+    { 0, 32, 529156352 },
+    { 0, 13, 435055520 },
+    { 0, 4, 330129312 },
+    { 255, 0, -4571391 },
+    { 1, 10, 40215976 },
+    { 1, 7, 21191996 },
+    { 255, 0, 215561 },
+    { 1, 9, 33130658 },
+    { 255, 0, -3760054 },
+    { 255, 0, -2677060 },
+    { 2, 12, 61195844 },
+    { 255, 0, 2044367 },
+    { 255, 0, -1960801 },
+    { 1, 21, 34413540 },
+    { 2, 20, 50864840 },
+    { 0, 19, 465196800 },
+    { 0, 18, 458955584 },
+    { 255, 0, -1307188 },
+    { 255, 0, 2044367 },
+    { 255, 0, -2991693 },
+    { 255, 0, -3996334 },
+    { 2, 27, 64894508 },
+    { 1, 26, 38977664 },
+    { 2, 25, 57029364 },
+    { 255, 0, 2470946 },
+    { 255, 0, 5440 },
+    { 255, 0, 3466886 },
+    { 1, 29, 36338052 },
+    { 255, 0, -3423326 },
+    { 2, 31, 74652768 },
+    { 255, 0, 1692572 },
+    { 255, 0, -253413 },
+    { 0, 56, 655538432 },
+    { 1, 47, 33877824 },
+    { 2, 42, 66848340 },
+    { 0, 39, 604568128 },
+    { 2, 38, 45365068 },
+    { 255, 0, 1684903 },
+    { 255, 0, -1665734 },
+    { 2, 41, 58077528 },
+    { 255, 0, 2183530 },
+    { 255, 0, -751462 },
+    { 1, 44, 31239688 },
+    { 255, 0, -4008568 },
+    { 0, 46, 599702272 },
+    { 255, 0, -2179116 },
+    { 255, 0, 2539271 },
+    { 1, 55, 37319172 },
+    { 2, 52, 72607456 },
+    { 2, 51, 59008588 },
+    { 255, 0, 3092258 },
+    { 255, 0, 1541671 },
+    { 0, 54, 595831040 },
+    { 255, 0, -1960801 },
+    { 255, 0, 734538 },
+    { 255, 0, 3581405 },
+    { 1, 70, 23816546 },
+    { 0, 65, 774101120 },
+    { 2, 62, 58077528 },
+    { 0, 61, 667986368 },
+    { 255, 0, 1671739 },
+    { 255, 0, -58667 },
+    { 2, 64, 80177944 },
+    { 255, 0, -2561918 },
+    { 255, 0, 279022 },
+    { 1, 67, 20991302 },
+    { 255, 0, -2798532 },
+    { 0, 69, 985483776 },
+    { 255, 0, 2788971 },
+    { 255, 0, -995363 },
+    { 0, 78, 808071872 },
+    { 2, 75, 71108800 },
+    { 0, 74, 758236416 },
+    { 255, 0, 3652733 },
+    { 255, 0, 2541970 },
+    { 1, 77, 30016572 },
+    { 255, 0, -646412 },
+    { 255, 0, 2743616 },
+    { 2, 80, 42010436 },
+    { 255, 0, -995363 },
+    { 0, 82, 993584320 },
+    { 255, 0, 3608369 },
+    { 255, 0, 254087 },
+    { 0, 117, 604568128 },
+    { 0, 96, 444341632 },
+    { 0, 87, 330129312 },
+    { 255, 0, -3974277 },
+    { 1, 93, 40160492 },
+    { 1, 90, 21191996 },
+    { 255, 0, 200612 },
+    { 1, 92, 33130658 },
+    { 255, 0, -3345849 },
+    { 255, 0, -2262919 },
+    { 2, 95, 62123000 },
+    { 255, 0, 1979024 },
+    { 255, 0, -2033113 },
+    { 1, 108, 35422736 },
+    { 2, 105, 66848340 },
+    { 1, 102, 33775612 },
+    { 2, 101, 45365068 },
+    { 255, 0, 724340 },
+    { 255, 0, -2227727 },
+    { 1, 104, 34949496 },
+    { 255, 0, 2135340 },
+    { 255, 0, -1006249 },
+    { 0, 107, 451748992 },
+    { 255, 0, -1094690 },
+    { 255, 0, -3544770 },
+    { 2, 110, 59145440 },
+    { 255, 0, 3137493 },
+    { 1, 114, 38350804 },
+    { 0, 113, 502377920 },
+    { 255, 0, -2901704 },
+    { 255, 0, 304298 },
+    { 2, 116, 84480472 },
+    { 255, 0, 2913525 },
+    { 255, 0, 78764 },
+    { 1, 141, 26259966 },
+    { 0, 134, 774101120 },
+    { 2, 127, 60581020 },
+    { 0, 124, 699844864 },
+    { 0, 123, 667986368 },
+    { 255, 0, 1038327 },
+    { 255, 0, -1512160 },
+    { 1, 126, 23743528 },
+    { 255, 0, 700113 },
+    { 255, 0, 2690302 },
+    { 2, 131, 80177944 },
+    { 2, 130, 69026576 },
+    { 255, 0, -492927 },
+    { 255, 0, -2629595 },
+    { 2, 133, 83497336 },
+    { 255, 0, 1939141 },
+    { 255, 0, -2583640 },
+    { 1, 136, 21107088 },
+    { 255, 0, -2075586 },
+    { 0, 140, 993584320 },
+    { 0, 139, 904155712 },
+    { 255, 0, 2327328 },
+    { 255, 0, 3173657 },
+    { 255, 0, -1326801 },
+    { 0, 151, 655538432 },
+    { 1, 150, 31860448 },
+    { 2, 147, 60909508 },
+    { 1, 146, 30341904 },
+    { 255, 0, 2786415 },
+    { 255, 0, 109419 },
+    { 2, 149, 64069448 },
+    { 255, 0, -223581 },
+    { 255, 0, -2510226 },
+    { 255, 0, 3011070 },
+    { 2, 153, 42010436 },
+    { 255, 0, -290791 },
+    { 2, 157, 72659736 },
+    { 0, 156, 993584320 },
+    { 255, 0, 3235003 },
+    { 255, 0, 197941 },
+    { 0, 159, 769799552 },
+    { 255, 0, 1167023 },
+    { 255, 0, 3178156 },
+    { 0, 196, 571350400 },
+    { 0, 177, 435055520 },
+    { 0, 164, 330129312 },
+    { 255, 0, -3569304 },
+    { 2, 170, 65683856 },
+    { 2, 169, 64894508 },
+    { 1, 168, 40160492 },
+    { 255, 0, -2213175 },
+    { 255, 0, 582016 },
+    { 255, 0, 1754745 },
+    { 0, 174, 427714272 },
+    { 1, 173, 40215976 },
+    { 255, 0, -3253903 },
+    { 255, 0, -1087179 },
+    { 2, 176, 74031632 },
+    { 255, 0, -2125144 },
+    { 255, 0, 594100 },
+    { 1, 187, 35806708 },
+    { 2, 186, 65052132 },
+    { 1, 183, 33775612 },
+    { 2, 182, 47058008 },
+    { 255, 0, -275817 },
+    { 255, 0, -2500550 },
+    { 0, 185, 469761920 },
+    { 255, 0, -768804 },
+    { 255, 0, 2138791 },
+    { 255, 0, -3189345 },
+    { 2, 189, 62123000 },
+    { 255, 0, 2706476 },
+    { 1, 193, 40215976 },
+    { 0, 192, 502377920 },
+    { 255, 0, -1743099 },
+    { 255, 0, 365817 },
+    { 0, 195, 465196800 },
+    { 255, 0, 820641 },
+    { 255, 0, 2657195 },
+    { 0, 218, 655538432 },
+    { 1, 211, 32621098 },
+    { 2, 204, 55497560 },
+    { 1, 201, 25251548 },
+    { 255, 0, 2531069 },
+    { 1, 203, 25930758 },
+    { 255, 0, -2002871 },
+    { 255, 0, 1493969 },
+    { 1, 208, 29092178 },
+    { 1, 207, 24727414 },
+    { 255, 0, -3481594 },
+    { 255, 0, -1837165 },
+    { 2, 210, 65168712 },
+    { 255, 0, 1008729 },
+    { 255, 0, -2019122 },
+    { 1, 217, 35178424 },
+    { 0, 216, 599702272 },
+    { 0, 215, 590995328 },
+    { 255, 0, 1447374 },
+    { 255, 0, -1425456 },
+    { 255, 0, 2311929 },
+    { 255, 0, 2955123 },
+    { 1, 232, 23816546 },
+    { 0, 227, 824097472 },
+    { 2, 224, 59145440 },
+    { 1, 223, 23361558 },
+    { 255, 0, 1497944 },
+    { 255, 0, -1112443 },
+    { 0, 226, 774101120 },
+    { 255, 0, -1427820 },
+    { 255, 0, 103760 },
+    { 1, 229, 21107088 },
+    { 255, 0, -1209460 },
+    { 0, 231, 985483776 },
+    { 255, 0, 2693406 },
+    { 255, 0, -836256 },
+    { 0, 240, 808071872 },
+    { 2, 237, 71108800 },
+    { 0, 236, 758236416 },
+    { 255, 0, 3048502 },
+    { 255, 0, 1983636 },
+    { 1, 239, 30016572 },
+    { 255, 0, -658986 },
+    { 255, 0, 2276425 },
+    { 2, 242, 42010436 },
+    { 255, 0, -906669 },
+    { 0, 244, 993584320 },
+    { 255, 0, 2976742 },
+    { 255, 0, 187690 },
+    { 0, 289, 529156352 },
+    { 0, 266, 435055520 },
+    { 0, 253, 330129312 },
+    { 2, 252, 44163660 },
+    { 1, 251, 38056408 },
+    { 255, 0, -2777437 },
+    { 255, 0, 1091943 },
+    { 255, 0, -3323191 },
+    { 2, 259, 65683856 },
+    { 2, 258, 64894508 },
+    { 0, 257, 346247584 },
+    { 255, 0, -37049 },
+    { 255, 0, -2040428 },
+    { 255, 0, 1620395 },
+    { 0, 263, 427714272 },
+    { 1, 262, 40215976 },
+    { 255, 0, -2940768 },
+    { 255, 0, -1009252 },
+    { 1, 265, 32004510 },
+    { 255, 0, -2003684 },
+    { 255, 0, 559949 },
+    { 1, 278, 35422736 },
+    { 2, 275, 56354256 },
+    { 1, 272, 31517582 },
+    { 1, 271, 23616240 },
+    { 255, 0, 316485 },
+    { 255, 0, -3114363 },
+    { 2, 274, 48999660 },
+    { 255, 0, -754826 },
+    { 255, 0, 1157028 },
+    { 1, 277, 34876208 },
+    { 255, 0, -2878625 },
+    { 255, 0, -639302 },
+    { 2, 286, 74652768 },
+    { 1, 283, 38977664 },
+    { 2, 282, 57029364 },
+    { 255, 0, 2029273 },
+    { 255, 0, -209907 },
+    { 0, 285, 439882912 },
+    { 255, 0, 889177 },
+    { 255, 0, 2841705 },
+    { 0, 288, 504773568 },
+    { 255, 0, -2266093 },
+    { 255, 0, 1169077 },
+    { 0, 311, 655538432 },
+    { 1, 304, 33877824 },
+    { 2, 299, 66848340 },
+    { 0, 296, 610233216 },
+    { 2, 295, 44545652 },
+    { 255, 0, 1886315 },
+    { 255, 0, -1026090 },
+    { 2, 298, 58077528 },
+    { 255, 0, 1861016 },
+    { 255, 0, -663119 },
+    { 1, 301, 31239688 },
+    { 255, 0, -2963192 },
+    { 0, 303, 599702272 },
+    { 255, 0, -1505590 },
+    { 255, 0, 2222892 },
+    { 2, 306, 69026576 },
+    { 255, 0, 2716900 },
+    { 1, 310, 38350804 },
+    { 0, 309, 567292480 },
+    { 255, 0, -1983344 },
+    { 255, 0, 839489 },
+    { 255, 0, 2609075 },
+    { 1, 325, 23816546 },
+    { 0, 320, 824097472 },
+    { 2, 317, 54799652 },
+    { 0, 316, 758236416 },
+    { 255, 0, -235865 },
+    { 255, 0, 2346953 },
+    { 0, 319, 793950912 },
+    { 255, 0, -250288 },
+    { 255, 0, -2044078 },
+    { 1, 322, 21107088 },
+    { 255, 0, -1120957 },
+    { 0, 324, 985483776 },
+    { 255, 0, 2476429 },
+    { 255, 0, -780033 },
+    { 1, 333, 37046760 },
+    { 0, 330, 805659200 },
+    { 2, 329, 72659736 },
+    { 255, 0, 2366800 },
+    { 255, 0, 430829 },
+    { 0, 332, 993584320 },
+    { 255, 0, 2607140 },
+    { 255, 0, -1015982 },
+    { 255, 0, 2920524 },
+    { 0, 384, 571350400 },
+    { 0, 355, 444341632 },
+    { 0, 344, 330129312 },
+    { 1, 339, 40160492 },
+    { 255, 0, -3130341 },
+    { 2, 341, 44545652 },
+    { 255, 0, 1148114 },
+    { 0, 343, 297086592 },
+    { 255, 0, -2816309 },
+    { 255, 0, -566920 },
+    { 1, 350, 40160492 },
+    { 1, 347, 21191996 },
+    { 255, 0, 471137 },
+    { 1, 349, 33130658 },
+    { 255, 0, -2531246 },
+    { 255, 0, -1531195 },
+    { 2, 352, 61195844 },
+    { 255, 0, 2207103 },
+    { 1, 354, 40879216 },
+    { 255, 0, 418938 },
+    { 255, 0, -2496743 },
+    { 1, 369, 34115492 },
+    { 2, 362, 47058008 },
+    { 2, 359, 42987472 },
+    { 255, 0, -1611100 },
+    { 1, 361, 25405552 },
+    { 255, 0, 1751497 },
+    { 255, 0, -248275 },
+    { 1, 366, 31144692 },
+    { 1, 365, 21809290 },
+    { 255, 0, -893599 },
+    { 255, 0, -2680531 },
+    { 1, 368, 32910710 },
+    { 255, 0, 185572 },
+    { 255, 0, -2424658 },
+    { 2, 377, 65052132 },
+    { 2, 374, 57029364 },
+    { 2, 373, 43475200 },
+    { 255, 0, 599301 },
+    { 255, 0, 2600457 },
+    { 2, 376, 60356804 },
+    { 255, 0, 237173 },
+    { 255, 0, 2009938 },
+    { 1, 381, 38350804 },
+    { 1, 380, 37001168 },
+    { 255, 0, -2617745 },
+    { 255, 0, -384299 },
+    { 0, 383, 504773568 },
+    { 255, 0, 233196 },
+    { 255, 0, 2409200 },
+    { 1, 406, 29092178 },
+    { 0, 399, 774101120 },
+    { 2, 392, 55497560 },
+    { 1, 391, 26897028 },
+    { 0, 390, 610233216 },
+    { 255, 0, -159383 },
+    { 255, 0, 1616288 },
+    { 255, 0, 2697287 },
+    { 0, 396, 655538432 },
+    { 1, 395, 24727414 },
+    { 255, 0, -3012860 },
+    { 255, 0, -1436209 },
+    { 2, 398, 69026576 },
+    { 255, 0, 438627 },
+    { 255, 0, -1368884 },
+    { 1, 401, 20991302 },
+    { 255, 0, -2289204 },
+    { 0, 405, 993584320 },
+    { 1, 404, 22381978 },
+    { 255, 0, 1416829 },
+    { 255, 0, 2393164 },
+    { 255, 0, -449658 },
+    { 1, 420, 37046760 },
+    { 0, 415, 653012288 },
+    { 2, 412, 66848340 },
+    { 1, 411, 32621098 },
+    { 255, 0, 637720 },
+    { 255, 0, 2069014 },
+    { 1, 414, 31239688 },
+    { 255, 0, -2446360 },
+    { 255, 0, 816194 },
+    { 2, 417, 42010436 },
+    { 255, 0, -466828 },
+    { 1, 419, 36524568 },
+    { 255, 0, 2322119 },
+    { 255, 0, 1146953 },
+    { 255, 0, 2751106 },
+    { 0, 453, 529156352 },
+    { 0, 428, 330129312 },
+    { 2, 427, 44163660 },
+    { 1, 426, 38056408 },
+    { 255, 0, -2421329 },
+    { 255, 0, 1055455 },
+    { 255, 0, -2931701 },
+    { 1, 438, 33130658 },
+    { 1, 431, 20166280 },
+    { 255, 0, 2120681 },
+    { 0, 435, 346247584 },
+    { 2, 434, 72454448 },
+    { 255, 0, -65760 },
+    { 255, 0, -2150763 },
+    { 2, 437, 42263348 },
+    { 255, 0, -510907 },
+    { 255, 0, -2467706 },
+    { 0, 446, 437533056 },
+    { 1, 443, 35524692 },
+    { 1, 442, 34949496 },
+    { 255, 0, -483529 },
+    { 255, 0, 1450326 },
+    { 1, 445, 40215976 },
+    { 255, 0, -2314587 },
+    { 255, 0, 89296 },
+    { 1, 450, 36338052 },
+    { 2, 449, 63689556 },
+    { 255, 0, 788675 },
+    { 255, 0, -2655685 },
+    { 2, 452, 57029364 },
+    { 255, 0, 2549206 },
+    { 255, 0, 739197 },
+    { 0, 479, 655538432 },
+    { 1, 470, 33877824 },
+    { 2, 463, 66848340 },
+    { 2, 460, 44545652 },
+    { 0, 459, 631028288 },
+    { 255, 0, 2076501 },
+    { 255, 0, 117045 },
+    { 0, 462, 610233216 },
+    { 255, 0, -786698 },
+    { 255, 0, 670217 },
+    { 1, 467, 31239688 },
+    { 0, 466, 631028288 },
+    { 255, 0, -2867915 },
+    { 255, 0, -1317579 },
+    { 2, 469, 71269432 },
+    { 255, 0, -1973386 },
+    { 255, 0, 1635581 },
+    { 1, 478, 37319172 },
+    { 2, 475, 72607456 },
+    { 0, 474, 560421696 },
+    { 255, 0, 654047 },
+    { 255, 0, 2044508 },
+    { 2, 477, 81248624 },
+    { 255, 0, -1526274 },
+    { 255, 0, 354609 },
+    { 255, 0, 2505228 },
+    { 1, 493, 23816546 },
+    { 0, 486, 824097472 },
+    { 2, 485, 82633104 },
+    { 2, 484, 80177944 },
+    { 255, 0, -296340 },
+    { 255, 0, 1918399 },
+    { 255, 0, -2065517 },
+    { 2, 490, 49126068 },
+    { 0, 489, 867530624 },
+    { 255, 0, 1637409 },
+    { 255, 0, -1177017 },
+    { 1, 492, 21107088 },
+    { 255, 0, -706034 },
+    { 255, 0, 2385700 },
+    { 1, 501, 37046760 },
+    { 0, 498, 805659200 },
+    { 2, 497, 71108800 },
+    { 255, 0, 2094101 },
+    { 255, 0, 316796 },
+    { 0, 500, 993584320 },
+    { 255, 0, 2276848 },
+    { 255, 0, -1002214 },
+    { 255, 0, 2576427 },
+    { 0, 534, 504773568 },
+    { 0, 511, 330129312 },
+    { 1, 506, 40160492 },
+    { 255, 0, -2825209 },
+    { 2, 508, 44545652 },
+    { 255, 0, 1103011 },
+    { 0, 510, 297086592 },
+    { 255, 0, -2512554 },
+    { 255, 0, -331895 },
+    { 1, 527, 40215976 },
+    { 2, 520, 59470876 },
+    { 1, 517, 33471460 },
+    { 1, 516, 20166280 },
+    { 255, 0, 1991379 },
+    { 255, 0, -2041494 },
+    { 0, 519, 444341632 },
+    { 255, 0, -567491 },
+    { 255, 0, 1350227 },
+    { 2, 524, 69210696 },
+    { 0, 523, 490338464 },
+    { 255, 0, -1788663 },
+    { 255, 0, 114163 },
+    { 0, 526, 337447936 },
+    { 255, 0, -956893 },
+    { 255, 0, -2417965 },
+    { 1, 529, 41012940 },
+    { 255, 0, 2210224 },
+    { 2, 531, 60581020 },
+    { 255, 0, 2014719 },
+    { 0, 533, 416544416 },
+    { 255, 0, -2080844 },
+    { 255, 0, -195743 },
+    { 0, 556, 619240960 },
+    { 1, 549, 35806708 },
+    { 2, 544, 66848340 },
+    { 1, 541, 28043252 },
+    { 2, 540, 54390968 },
+    { 255, 0, -333052 },
+    { 255, 0, -2267153 },
+    { 0, 543, 587610560 },
+    { 255, 0, 956591 },
+    { 255, 0, -603141 },
+    { 1, 546, 31766446 },
+    { 255, 0, -2748067 },
+    { 1, 548, 32910710 },
+    { 255, 0, 1412067 },
+    { 255, 0, -2210948 },
+    { 1, 555, 38350804 },
+    { 2, 552, 61772904 },
+    { 255, 0, 2009017 },
+    { 2, 554, 74031632 },
+    { 255, 0, -2823291 },
+    { 255, 0, 1284629 },
+    { 255, 0, 2595700 },
+    { 1, 572, 26259966 },
+    { 0, 565, 758236416 },
+    { 2, 562, 60581020 },
+    { 0, 561, 699844864 },
+    { 255, 0, 45339 },
+    { 255, 0, 1722205 },
+    { 1, 564, 21390382 },
+    { 255, 0, 1160647 },
+    { 255, 0, -1661236 },
+    { 1, 569, 21107088 },
+    { 2, 568, 69026576 },
+    { 255, 0, -2286316 },
+    { 255, 0, -556043 },
+    { 0, 571, 993584320 },
+    { 255, 0, 1773310 },
+    { 255, 0, -1119653 },
+    { 1, 580, 37046760 },
+    { 2, 577, 72659736 },
+    { 1, 576, 36841296 },
+    { 255, 0, 2081666 },
+    { 255, 0, -853467 },
+    { 0, 579, 767929216 },
+    { 255, 0, -174608 },
+    { 255, 0, 2086354 },
+    { 255, 0, 2472638 },
+    { 0, 609, 504773568 },
+    { 0, 590, 330129312 },
+    { 1, 585, 40160492 },
+    { 255, 0, -2714370 },
+    { 2, 587, 44545652 },
+    { 255, 0, 1019349 },
+    { 0, 589, 297086592 },
+    { 255, 0, -2401082 },
+    { 255, 0, -309666 },
+    { 1, 604, 40215976 },
+    { 2, 599, 59470876 },
+    { 1, 596, 33471460 },
+    { 1, 595, 20166280 },
+    { 255, 0, 1877185 },
+    { 255, 0, -1869764 },
+    { 2, 598, 44777648 },
+    { 255, 0, -1884096 },
+    { 255, 0, 560111 },
+    { 2, 603, 81846440 },
+    { 2, 602, 81248624 },
+    { 255, 0, -1784235 },
+    { 255, 0, 1009544 },
+    { 255, 0, -2697160 },
+    { 2, 608, 79812600 },
+    { 0, 607, 404869504 },
+    { 255, 0, 89918 },
+    { 255, 0, 2078763 },
+    { 255, 0, -915381 },
+    { 0, 635, 655538432 },
+    { 1, 626, 32119394 },
+    { 2, 619, 58291512 },
+    { 0, 616, 610233216 },
+    { 2, 615, 45365068 },
+    { 255, 0, 595211 },
+    { 255, 0, -1094565 },
+    { 0, 618, 649239552 },
+    { 255, 0, 1818918 },
+    { 255, 0, -546919 },
+    { 2, 623, 66848340 },
+    { 2, 622, 62304148 },
+    { 255, 0, -2306217 },
+    { 255, 0, 477193 },
+    { 0, 625, 631028288 },
+    { 255, 0, -2664298 },
+    { 255, 0, -816409 },
+    { 1, 634, 37001168 },
+    { 0, 631, 599702272 },
+    { 0, 630, 590995328 },
+    { 255, 0, 382168 },
+    { 255, 0, -1976987 },
+    { 2, 633, 72845432 },
+    { 255, 0, 2118479 },
+    { 255, 0, 705683 },
+    { 255, 0, 2304342 },
+    { 1, 649, 26259966 },
+    { 0, 644, 774101120 },
+    { 2, 641, 60581020 },
+    { 1, 640, 22282790 },
+    { 255, 0, -710229 },
+    { 255, 0, 1587899 },
+    { 1, 643, 25405552 },
+    { 255, 0, -267530 },
+    { 255, 0, -2472176 },
+    { 1, 646, 20991302 },
+    { 255, 0, -2007718 },
+    { 0, 648, 993584320 },
+    { 255, 0, 1704797 },
+    { 255, 0, -1038984 },
+    { 2, 651, 42010436 },
+    { 255, 0, -728637 },
+    { 0, 655, 829297408 },
+    { 2, 654, 71108800 },
+    { 255, 0, 2152033 },
+    { 255, 0, 806891 },
+    { 0, 657, 993584320 },
+    { 255, 0, 2284912 },
+    { 255, 0, 249132 },
+    { 0, 688, 571350400 },
+    { 0, 665, 330129312 },
+    { 2, 664, 44163660 },
+    { 1, 663, 38056408 },
+    { 255, 0, -2047472 },
+    { 255, 0, 1049763 },
+    { 255, 0, -2593000 },
+    { 1, 675, 33728904 },
+    { 1, 668, 20166280 },
+    { 255, 0, 1775439 },
+    { 2, 672, 65168712 },
+    { 2, 671, 64455900 },
+    { 255, 0, -1429660 },
+    { 255, 0, 1669732 },
+    { 1, 674, 31860448 },
+    { 255, 0, -2309845 },
+    { 255, 0, -1081038 },
+    { 0, 681, 427714272 },
+    { 1, 678, 34183964 },
+    { 255, 0, 2343883 },
+    { 2, 680, 56875908 },
+    { 255, 0, -580818 },
+    { 255, 0, -1999359 },
+    { 2, 685, 65052132 },
+    { 1, 684, 38977664 },
+    { 255, 0, 851837 },
+    { 255, 0, 2390843 },
+    { 1, 687, 35045364 },
+    { 255, 0, -2095177 },
+    { 255, 0, 248932 },
+    { 1, 710, 29092178 },
+    { 0, 703, 774101120 },
+    { 2, 696, 55497560 },
+    { 2, 695, 53607684 },
+    { 2, 694, 51672900 },
+    { 255, 0, 1268778 },
+    { 255, 0, -515600 },
+    { 255, 0, 2451025 },
+    { 1, 700, 27641292 },
+    { 0, 699, 626577792 },
+    { 255, 0, -2327429 },
+    { 255, 0, -356290 },
+    { 0, 702, 599702272 },
+    { 255, 0, -450658 },
+    { 255, 0, -3077364 },
+    { 1, 705, 20991302 },
+    { 255, 0, -1896249 },
+    { 0, 709, 993584320 },
+    { 1, 708, 22381978 },
+    { 255, 0, 910674 },
+    { 255, 0, 1857010 },
+    { 255, 0, -327908 },
+    { 1, 724, 37868576 },
+    { 0, 719, 655538432 },
+    { 2, 716, 66848340 },
+    { 1, 715, 30341904 },
+    { 255, 0, 2325518 },
+    { 255, 0, 517921 },
+    { 2, 718, 84480472 },
+    { 255, 0, -1199380 },
+    { 255, 0, 1819709 },
+    { 2, 721, 42400760 },
+    { 255, 0, -480785 },
+    { 0, 723, 859291712 },
+    { 255, 0, 1410638 },
+    { 255, 0, 2196407 },
+    { 255, 0, 2336571 },
+    { 0, 755, 504773568 },
+    { 0, 734, 330129312 },
+    { 1, 729, 40160492 },
+    { 255, 0, -2550108 },
+    { 0, 731, 265007280 },
+    { 255, 0, -2205603 },
+    { 2, 733, 57854224 },
+    { 255, 0, 1731562 },
+    { 255, 0, -1433124 },
+    { 1, 748, 40215976 },
+    { 2, 743, 69210696 },
+    { 1, 740, 33471460 },
+    { 1, 739, 23616240 },
+    { 255, 0, 54247 },
+    { 255, 0, -1690025 },
+    { 2, 742, 59145440 },
+    { 255, 0, 175843 },
+    { 255, 0, -1161796 },
+    { 0, 747, 451748992 },
+    { 0, 746, 427714272 },
+    { 255, 0, -1995326 },
+    { 255, 0, -146552 },
+    { 255, 0, -2553191 },
+    { 1, 750, 41012940 },
+    { 255, 0, 2000548 },
+    { 2, 752, 60581020 },
+    { 255, 0, 1790000 },
+    { 0, 754, 416544416 },
+    { 255, 0, -1841812 },
+    { 255, 0, -295740 },
+    { 1, 783, 37046760 },
+    { 0, 770, 613436096 },
+    { 2, 765, 66848340 },
+    { 1, 762, 28043252 },
+    { 2, 761, 47058008 },
+    { 255, 0, 348839 },
+    { 255, 0, -1485049 },
+    { 0, 764, 587610560 },
+    { 255, 0, 952688 },
+    { 255, 0, -619300 },
+    { 1, 767, 31766446 },
+    { 255, 0, -2409152 },
+    { 1, 769, 32910710 },
+    { 255, 0, 1368682 },
+    { 255, 0, -1675512 },
+    { 0, 778, 808071872 },
+    { 2, 775, 69356568 },
+    { 1, 774, 25070570 },
+    { 255, 0, 238545 },
+    { 255, 0, 1498910 },
+    { 1, 777, 31239688 },
+    { 255, 0, -801341 },
+    { 255, 0, 1305160 },
+    { 0, 782, 993584320 },
+    { 1, 781, 22033150 },
+    { 255, 0, -342086 },
+    { 255, 0, 1824848 },
+    { 255, 0, -1100236 },
+    { 255, 0, 2173078 },
+    { 0, 810, 502377920 },
+    { 0, 793, 330129312 },
+    { 1, 788, 40160492 },
+    { 255, 0, -2485570 },
+    { 0, 790, 265007280 },
+    { 255, 0, -2126216 },
+    { 2, 792, 57854224 },
+    { 255, 0, 1568213 },
+    { 255, 0, -1373705 },
+    { 1, 803, 40215976 },
+    { 2, 800, 68431128 },
+    { 2, 799, 68288656 },
+    { 1, 798, 21191996 },
+    { 255, 0, 1136766 },
+    { 255, 0, -907885 },
+    { 255, 0, 1125646 },
+    { 0, 802, 337447936 },
+    { 255, 0, -458999 },
+    { 255, 0, -1902471 },
+    { 2, 809, 79812600 },
+    { 1, 806, 41012940 },
+    { 255, 0, 2166577 },
+    { 2, 808, 60581020 },
+    { 255, 0, 1707347 },
+    { 255, 0, -912099 },
+    { 255, 0, -856882 },
+    { 1, 842, 37046760 },
+    { 0, 827, 655538432 },
+    { 2, 820, 59008588 },
+    { 1, 817, 26897028 },
+    { 1, 816, 25251548 },
+    { 255, 0, 185594 },
+    { 255, 0, -1557050 },
+    { 2, 819, 53890564 },
+    { 255, 0, 655725 },
+    { 255, 0, 2092369 },
+    { 1, 824, 32119394 },
+    { 0, 823, 631028288 },
+    { 255, 0, -1857854 },
+    { 255, 0, -552019 },
+    { 1, 826, 33130658 },
+    { 255, 0, 1469111 },
+    { 255, 0, -463969 },
+    { 1, 835, 23816546 },
+    { 0, 832, 824097472 },
+    { 2, 831, 82633104 },
+    { 255, 0, -68986 },
+    { 255, 0, -2160068 },
+    { 2, 834, 49126068 },
+    { 255, 0, -510474 },
+    { 255, 0, 1673219 },
+    { 2, 839, 72659736 },
+    { 1, 838, 36841296 },
+    { 255, 0, 1638235 },
+    { 255, 0, -1174580 },
+    { 0, 841, 752975808 },
+    { 255, 0, -584692 },
+    { 255, 0, 1584723 },
+    { 255, 0, 2064029 },
+    { 0, 861, 444341632 },
+    { 0, 846, 310812128 },
+    { 255, 0, -2396294 },
+    { 1, 856, 40414436 },
+    { 2, 849, 46637860 },
+    { 255, 0, -2493864 },
+    { 2, 853, 66494984 },
+    { 2, 852, 64894508 },
+    { 255, 0, -841827 },
+    { 255, 0, 1417857 },
+    { 0, 855, 385034560 },
+    { 255, 0, -2207947 },
+    { 255, 0, -807387 },
+    { 2, 858, 61195844 },
+    { 255, 0, 2588129 },
+    { 1, 860, 40879216 },
+    { 255, 0, 76100 },
+    { 255, 0, -2058907 },
+    { 0, 887, 619240960 },
+    { 1, 876, 35422736 },
+    { 2, 871, 68431128 },
+    { 2, 868, 45365068 },
+    { 2, 867, 42987472 },
+    { 255, 0, -37444 },
+    { 255, 0, 1602045 },
+    { 2, 870, 48698084 },
+    { 255, 0, -2161852 },
+    { 255, 0, -343814 },
+    { 2, 875, 77488800 },
+    { 2, 874, 76125576 },
+    { 255, 0, -1630042 },
+    { 255, 0, 977418 },
+    { 255, 0, -2314036 },
+    { 2, 880, 57029364 },
+    { 2, 879, 43475200 },
+    { 255, 0, 427872 },
+    { 255, 0, 2340689 },
+    { 1, 884, 39227792 },
+    { 0, 883, 494007264 },
+    { 255, 0, -1777514 },
+    { 255, 0, 165574 },
+    { 2, 886, 82511024 },
+    { 255, 0, 1987954 },
+    { 255, 0, 453682 },
+    { 1, 901, 26259966 },
+    { 0, 894, 729624128 },
+    { 1, 891, 21390382 },
+    { 255, 0, 2210243 },
+    { 0, 893, 633589760 },
+    { 255, 0, 2064810 },
+    { 255, 0, -1506381 },
+    { 1, 898, 21107088 },
+    { 2, 897, 71269432 },
+    { 255, 0, -2189568 },
+    { 255, 0, -512823 },
+    { 2, 900, 83497336 },
+    { 255, 0, 1261064 },
+    { 255, 0, -147246 },
+    { 1, 909, 37046760 },
+    { 2, 906, 72659736 },
+    { 1, 905, 36841296 },
+    { 255, 0, 1539432 },
+    { 255, 0, -1068004 },
+    { 0, 908, 829297408 },
+    { 255, 0, -11160 },
+    { 255, 0, 1850424 },
+    { 255, 0, 2003455 },
+    { 0, 936, 444341632 },
+    { 0, 917, 310812128 },
+    { 2, 916, 43833736 },
+    { 1, 915, 34245960 },
+    { 255, 0, -1390656 },
+    { 255, 0, -43321 },
+    { 255, 0, -2386281 },
+    { 1, 927, 33471460 },
+    { 2, 920, 50605408 },
+    { 255, 0, -2341509 },
+    { 2, 924, 65168712 },
+    { 0, 923, 425268288 },
+    { 255, 0, 315990 },
+    { 255, 0, -1818140 },
+    { 1, 926, 31860448 },
+    { 255, 0, -2112939 },
+    { 255, 0, -554032 },
+    { 1, 929, 34183964 },
+    { 255, 0, 1995309 },
+    { 0, 933, 427714272 },
+    { 2, 932, 57854224 },
+    { 255, 0, -209847 },
+    { 255, 0, -1733232 },
+    { 2, 935, 60725624 },
+    { 255, 0, -878932 },
+    { 255, 0, 1362385 },
+    { 0, 966, 655538432 },
+    { 1, 953, 35422736 },
+    { 2, 946, 58291512 },
+    { 2, 943, 54067572 },
+    { 2, 942, 52099512 },
+    { 255, 0, 254145 },
+    { 255, 0, -3074577 },
+    { 2, 945, 55497560 },
+    { 255, 0, 2474035 },
+    { 255, 0, 316013 },
+    { 2, 950, 62304148 },
+    { 1, 949, 32910710 },
+    { 255, 0, -2203993 },
+    { 255, 0, -572037 },
+    { 2, 952, 63689556 },
+    { 255, 0, 1763556 },
+    { 255, 0, -1136305 },
+    { 2, 959, 59145440 },
+    { 2, 956, 42987472 },
+    { 255, 0, 338257 },
+    { 0, 958, 457033664 },
+    { 255, 0, 556235 },
+    { 255, 0, 2198775 },
+    { 1, 963, 38350804 },
+    { 0, 962, 564477248 },
+    { 255, 0, -1201614 },
+    { 255, 0, 865430 },
+    { 2, 965, 84480472 },
+    { 255, 0, 1834429 },
+    { 255, 0, -196601 },
+    { 1, 980, 29895020 },
+    { 0, 975, 777818560 },
+    { 2, 972, 69026576 },
+    { 0, 971, 745314240 },
+    { 255, 0, 1143043 },
+    { 255, 0, -258401 },
+    { 1, 974, 27261760 },
+    { 255, 0, -309917 },
+    { 255, 0, -2906568 },
+    { 1, 977, 20991302 },
+    { 255, 0, -1724379 },
+    { 0, 979, 993584320 },
+    { 255, 0, 1407725 },
+    { 255, 0, -833939 },
+    { 2, 982, 42400760 },
+    { 255, 0, -1161991 },
+    { 0, 986, 859291712 },
+    { 0, 985, 756272192 },
+    { 255, 0, 1834095 },
+    { 255, 0, 681658 },
+    { 0, 988, 989876800 },
+    { 255, 0, 2017109 },
+    { 255, 0, 661458 },
+    { 0, 1011, 504773568 },
+    { 0, 998, 330129312 },
+    { 1, 993, 40160492 },
+    { 255, 0, -2346359 },
+    { 0, 995, 265007280 },
+    { 255, 0, -1896894 },
+    { 2, 997, 49411924 },
+    { 255, 0, 1019596 },
+    { 255, 0, -205947 },
+    { 2, 1010, 81846440 },
+    { 1, 1005, 40215976 },
+    { 2, 1004, 81248624 },
+    { 0, 1003, 346247584 },
+    { 255, 0, 599627 },
+    { 255, 0, -879577 },
+    { 255, 0, 1458264 },
+    { 1, 1007, 41012940 },
+    { 255, 0, 2095587 },
+    { 2, 1009, 60581020 },
+    { 255, 0, 1517310 },
+    { 255, 0, -815711 },
+    { 255, 0, -2352565 },
+    { 1, 1039, 37046760 },
+    { 0, 1026, 613436096 },
+    { 2, 1021, 66848340 },
+    { 0, 1018, 587610560 },
+    { 0, 1017, 571350400 },
+    { 255, 0, -184070 },
+    { 255, 0, 1984151 },
+    { 2, 1020, 45617832 },
+    { 255, 0, 815348 },
+    { 255, 0, -2198548 },
+    { 1, 1023, 31766446 },
+    { 255, 0, -2164941 },
+    { 1, 1025, 32910710 },
+    { 255, 0, 1320762 },
+    { 255, 0, -1349180 },
+    { 0, 1034, 808071872 },
+    { 2, 1031, 56043848 },
+    { 0, 1030, 764836224 },
+    { 255, 0, 1543069 },
+    { 255, 0, 98660 },
+    { 1, 1033, 31860448 },
+    { 255, 0, -365021 },
+    { 255, 0, 1355575 },
+    { 2, 1036, 42400760 },
+    { 255, 0, -1347944 },
+    { 1, 1038, 22033150 },
+    { 255, 0, -540775 },
+    { 255, 0, 1454941 },
+    { 1, 1047, 38633004 },
+    { 2, 1042, 70031720 },
+    { 255, 0, 1945250 },
+    { 0, 1046, 824097472 },
+    { 0, 1045, 599702272 },
+    { 255, 0, 382853 },
+    { 255, 0, -1663135 },
+    { 255, 0, 1697915 },
+    { 255, 0, 2076107 },
+    { 0, 1074, 444341632 },
+    { 0, 1055, 310812128 },
+    { 2, 1054, 43833736 },
+    { 1, 1053, 32393256 },
+    { 255, 0, -1201637 },
+    { 255, 0, -77673 },
+    { 255, 0, -2308415 },
+    { 1, 1065, 33471460 },
+    { 2, 1058, 50605408 },
+    { 255, 0, -2220325 },
+    { 2, 1062, 65168712 },
+    { 0, 1061, 425268288 },
+    { 255, 0, 371785 },
+    { 255, 0, -1703162 },
+    { 1, 1064, 31860448 },
+    { 255, 0, -1978033 },
+    { 255, 0, -483810 },
+    { 1, 1067, 34183964 },
+    { 255, 0, 1881277 },
+    { 0, 1071, 427714272 },
+    { 1, 1070, 40414436 },
+    { 255, 0, -1246801 },
+    { 255, 0, 527939 },
+    { 2, 1073, 60725624 },
+    { 255, 0, -777205 },
+    { 255, 0, 1267500 },
+    { 1, 1102, 37868576 },
+    { 0, 1089, 619240960 },
+    { 2, 1084, 59145440 },
+    { 1, 1081, 32322774 },
+    { 2, 1080, 45365068 },
+    { 255, 0, 664577 },
+    { 255, 0, -966023 },
+    { 2, 1083, 48275504 },
+    { 255, 0, -13833 },
+    { 255, 0, 1745933 },
+    { 2, 1086, 61039456 },
+    { 255, 0, -2369442 },
+    { 2, 1088, 68431128 },
+    { 255, 0, 117676 },
+    { 255, 0, -1423736 },
+    { 0, 1097, 808071872 },
+    { 1, 1094, 31860448 },
+    { 2, 1093, 56043848 },
+    { 255, 0, 1117124 },
+    { 255, 0, -320006 },
+    { 0, 1096, 767929216 },
+    { 255, 0, 1713200 },
+    { 255, 0, -773862 },
+    { 2, 1099, 42400760 },
+    { 255, 0, -1209644 },
+    { 1, 1101, 22033150 },
+    { 255, 0, -480137 },
+    { 255, 0, 1401702 },
+    { 0, 1110, 504773568 },
+    { 2, 1109, 74652768 },
+    { 1, 1108, 38977664 },
+    { 0, 1107, 481012352 },
+    { 255, 0, 548428 },
+    { 255, 0, -131116 },
+    { 255, 0, 2050536 },
+    { 255, 0, -1430042 },
+    { 2, 1112, 83581832 },
+    { 255, 0, 1981705 },
+    { 1, 1114, 38840272 },
+    { 255, 0, -704557 },
+    { 255, 0, 1715886 },
+    { 0, 1145, 444341632 },
+    { 0, 1120, 310812128 },
+    { 2, 1119, 43833736 },
+    { 255, 0, -806104 },
+    { 255, 0, -2274248 },
+    { 1, 1130, 33471460 },
+    { 2, 1123, 50605408 },
+    { 255, 0, -2137869 },
+    { 2, 1127, 65168712 },
+    { 0, 1126, 425268288 },
+    { 255, 0, 325602 },
+    { 255, 0, -1633392 },
+    { 1, 1129, 31860448 },
+    { 255, 0, -1898346 },
+    { 255, 0, -450742 },
+    { 1, 1138, 35524692 },
+    { 2, 1135, 56354256 },
+    { 0, 1134, 358228128 },
+    { 255, 0, 1138049 },
+    { 255, 0, -996649 },
+    { 0, 1137, 376977824 },
+    { 255, 0, -567387 },
+    { 255, 0, 2778264 },
+    { 1, 1142, 40160492 },
+    { 0, 1141, 437533056 },
+    { 255, 0, -1432102 },
+    { 255, 0, 719008 },
+    { 2, 1144, 61195844 },
+    { 255, 0, 2214704 },
+    { 255, 0, -1362138 },
+    { 1, 1177, 37868576 },
+    { 0, 1162, 655538432 },
+    { 2, 1155, 59145440 },
+    { 1, 1152, 32322774 },
+    { 0, 1151, 567292480 },
+    { 255, 0, -983893 },
+    { 255, 0, 441040 },
+    { 0, 1154, 462034432 },
+    { 255, 0, 2223004 },
+    { 255, 0, 914416 },
+    { 0, 1159, 490338464 },
+    { 0, 1158, 457033664 },
+    { 255, 0, -139348 },
+    { 255, 0, -2221780 },
+    { 1, 1161, 32119394 },
+    { 255, 0, -990178 },
+    { 255, 0, 69412 },
+    { 1, 1170, 23816546 },
+    { 0, 1167, 824097472 },
+    { 2, 1166, 82633104 },
+    { 255, 0, -169117 },
+    { 255, 0, -2058427 },
+    { 2, 1169, 49126068 },
+    { 255, 0, -820070 },
+    { 255, 0, 1342975 },
+    { 2, 1174, 72659736 },
+    { 0, 1173, 745314240 },
+    { 255, 0, 1888516 },
+    { 255, 0, 819398 },
+    { 0, 1176, 769799552 },
+    { 255, 0, -529760 },
+    { 255, 0, 1244489 },
+    { 0, 1185, 504773568 },
+    { 2, 1184, 74652768 },
+    { 1, 1183, 38977664 },
+    { 0, 1182, 481012352 },
+    { 255, 0, 515991 },
+    { 255, 0, -122470 },
+    { 255, 0, 1971808 },
+    { 255, 0, -1326203 },
+    { 2, 1187, 83581832 },
+    { 255, 0, 1914688 },
+    { 1, 1189, 38840272 },
+    { 255, 0, -646025 },
+    { 255, 0, 1655272 },
+    { 0, 1210, 444341632 },
+    { 0, 1195, 310812128 },
+    { 2, 1194, 43833736 },
+    { 255, 0, -753642 },
+    { 255, 0, -2243122 },
+    { 2, 1209, 81846440 },
+    { 1, 1204, 33471460 },
+    { 2, 1201, 54185388 },
+    { 1, 1200, 21736162 },
+    { 255, 0, 459184 },
+    { 255, 0, -2244662 },
+    { 2, 1203, 65168712 },
+    { 255, 0, 362880 },
+    { 255, 0, -1416063 },
+    { 1, 1206, 34183964 },
+    { 255, 0, 1577216 },
+    { 1, 1208, 40414436 },
+    { 255, 0, -634878 },
+    { 255, 0, 711137 },
+    { 255, 0, -2022425 },
+    { 1, 1232, 37868576 },
+    { 0, 1225, 774101120 },
+    { 2, 1218, 69026576 },
+    { 0, 1217, 767929216 },
+    { 0, 1216, 655538432 },
+    { 255, 0, 16171 },
+    { 255, 0, 1211489 },
+    { 255, 0, -3319210 },
+    { 1, 1222, 30286722 },
+    { 1, 1221, 27440568 },
+    { 255, 0, -550918 },
+    { 255, 0, -2313109 },
+    { 0, 1224, 553548096 },
+    { 255, 0, -1272598 },
+    { 255, 0, 498007 },
+    { 1, 1227, 20991302 },
+    { 255, 0, -1613290 },
+    { 2, 1229, 42400760 },
+    { 255, 0, -1156433 },
+    { 0, 1231, 993584320 },
+    { 255, 0, 1135579 },
+    { 255, 0, -854265 },
+    { 0, 1240, 504773568 },
+    { 2, 1239, 74652768 },
+    { 1, 1238, 38977664 },
+    { 0, 1237, 481012352 },
+    { 255, 0, 485564 },
+    { 255, 0, -114395 },
+    { 255, 0, 1898448 },
+    { 255, 0, -1231681 },
+    { 2, 1242, 83581832 },
+    { 255, 0, 1848411 },
+    { 1, 1244, 38840272 },
+    { 255, 0, -592574 },
+    { 255, 0, 1597309 },
+    { 0, 1271, 437533056 },
+    { 0, 1250, 310812128 },
+    { 2, 1249, 43833736 },
+    { 255, 0, -704299 },
+    { 255, 0, -2214358 },
+    { 2, 1260, 65683856 },
+    { 2, 1259, 64894508 },
+    { 1, 1256, 40414436 },
+    { 2, 1255, 46637860 },
+    { 255, 0, -2085186 },
+    { 255, 0, -400034 },
+    { 2, 1258, 57854224 },
+    { 255, 0, 2146095 },
+    { 255, 0, -187446 },
+    { 255, 0, 2338165 },
+    { 0, 1266, 385034560 },
+    { 1, 1265, 40414436 },
+    { 1, 1264, 26353800 },
+    { 255, 0, -758926 },
+    { 255, 0, -2133741 },
+    { 255, 0, -352241 },
+    { 1, 1270, 36666276 },
+    { 1, 1269, 31679174 },
+    { 255, 0, -1672742 },
+    { 255, 0, 1579276 },
+    { 255, 0, -1936977 },
+    { 1, 1299, 37868576 },
+    { 0, 1284, 619240960 },
+    { 1, 1279, 35806708 },
+    { 2, 1278, 77488800 },
+    { 2, 1277, 44545652 },
+    { 255, 0, 931950 },
+    { 255, 0, -550764 },
+    { 255, 0, -2095335 },
+    { 0, 1281, 457033664 },
+    { 255, 0, 2138346 },
+    { 2, 1283, 59145440 },
+    { 255, 0, 1362605 },
+    { 255, 0, -433338 },
+    { 1, 1292, 26259966 },
+    { 0, 1289, 729624128 },
+    { 1, 1288, 21390382 },
+    { 255, 0, 2068576 },
+    { 255, 0, -1119477 },
+    { 1, 1291, 21107088 },
+    { 255, 0, -1641997 },
+    { 255, 0, 656031 },
+    { 2, 1296, 73902248 },
+    { 0, 1295, 745314240 },
+    { 255, 0, 1511809 },
+    { 255, 0, 658802 },
+    { 0, 1298, 820432448 },
+    { 255, 0, -240272 },
+    { 255, 0, 1446646 },
+    { 2, 1307, 83581832 },
+    { 2, 1302, 53326372 },
+    { 255, 0, 2122864 },
+    { 2, 1306, 57667356 },
+    { 0, 1305, 762184768 },
+    { 255, 0, -941805 },
+    { 255, 0, 1271332 },
+    { 255, 0, 1520996 },
+    { 0, 1309, 556950720 },
+    { 255, 0, -877232 },
+    { 0, 1311, 820432448 },
+    { 255, 0, 1385378 },
+    { 255, 0, 155134 },
+    { 0, 1318, 330129312 },
+    { 1, 1315, 40160492 },
+    { 255, 0, -2204437 },
+    { 2, 1317, 57854224 },
+    { 255, 0, 759493 },
+    { 255, 0, -1640650 },
+    { 0, 1340, 571350400 },
+    { 1, 1329, 33728904 },
+    { 1, 1322, 20991302 },
+    { 255, 0, 1425508 },
+    { 0, 1326, 346247584 },
+    { 1, 1325, 26075916 },
+    { 255, 0, -395733 },
+    { 255, 0, 982544 },
+    { 1, 1328, 29967132 },
+    { 255, 0, -1319836 },
+    { 255, 0, -407333 },
+    { 2, 1337, 83057712 },
+    { 0, 1334, 502377920 },
+    { 1, 1333, 40215976 },
+    { 255, 0, -194548 },
+    { 255, 0, 964246 },
+    { 2, 1336, 69210696 },
+    { 255, 0, 1487394 },
+    { 255, 0, -165333 },
+    { 1, 1339, 39564772 },
+    { 255, 0, -1951660 },
+    { 255, 0, -551205 },
+    { 1, 1354, 26259966 },
+    { 0, 1349, 729624128 },
+    { 1, 1346, 21390382 },
+    { 0, 1345, 645954112 },
+    { 255, 0, -94598 },
+    { 255, 0, 2288066 },
+    { 0, 1348, 677355648 },
+    { 255, 0, -116845 },
+    { 255, 0, -2036563 },
+    { 1, 1351, 21107088 },
+    { 255, 0, -1525281 },
+    { 2, 1353, 83497336 },
+    { 255, 0, 786113 },
+    { 255, 0, -602821 },
+    { 1, 1360, 37868576 },
+    { 0, 1357, 579548992 },
+    { 255, 0, 2485856 },
+    { 0, 1359, 619240960 },
+    { 255, 0, -566302 },
+    { 255, 0, 738651 },
+    { 0, 1362, 735743616 },
+    { 255, 0, 2007234 },
+    { 0, 1364, 762184768 },
+    { 255, 0, -972421 },
+    { 255, 0, 1539105 },
+    { 0, 1373, 330129312 },
+    { 1, 1368, 40160492 },
+    { 255, 0, -2178173 },
+    { 2, 1372, 57854224 },
+    { 0, 1371, 269920480 },
+    { 255, 0, 19311 },
+    { 255, 0, 1020824 },
+    { 255, 0, -1585063 },
+    { 0, 1393, 571350400 },
+    { 2, 1390, 83057712 },
+    { 1, 1383, 33728904 },
+    { 0, 1380, 346247584 },
+    { 2, 1379, 53890564 },
+    { 255, 0, -641880 },
+    { 255, 0, 1892978 },
+    { 1, 1382, 29967132 },
+    { 255, 0, -1059779 },
+    { 255, 0, -214630 },
+    { 0, 1387, 362167328 },
+    { 2, 1386, 54067572 },
+    { 255, 0, 227758 },
+    { 255, 0, -1715742 },
+    { 1, 1389, 39637928 },
+    { 255, 0, 209995 },
+    { 255, 0, 1081901 },
+    { 1, 1392, 39564772 },
+    { 255, 0, -2138982 },
+    { 255, 0, -512435 },
+    { 1, 1407, 37868576 },
+    { 0, 1402, 808071872 },
+    { 2, 1399, 52099512 },
+    { 0, 1398, 764836224 },
+    { 255, 0, 1263807 },
+    { 255, 0, -412811 },
+    { 1, 1401, 29092178 },
+    { 255, 0, -440385 },
+    { 255, 0, 345657 },
+    { 2, 1404, 42010436 },
+    { 255, 0, -1520562 },
+    { 1, 1406, 22033150 },
+    { 255, 0, -575576 },
+    { 255, 0, 1040898 },
+    { 0, 1409, 735743616 },
+    { 255, 0, 1962234 },
+    { 0, 1411, 762184768 },
+    { 255, 0, -885977 },
+    { 2, 1413, 84480472 },
+    { 255, 0, 1599008 },
+    { 255, 0, 134898 },
+    { 0, 1422, 330129312 },
+    { 1, 1417, 40160492 },
+    { 255, 0, -2153000 },
+    { 2, 1421, 57854224 },
+    { 0, 1420, 269920480 },
+    { 255, 0, 18040 },
+    { 255, 0, 948231 },
+    { 255, 0, -1531352 },
+    { 0, 1440, 571350400 },
+    { 2, 1437, 83057712 },
+    { 1, 1430, 33728904 },
+    { 1, 1427, 20991302 },
+    { 255, 0, 1398623 },
+    { 2, 1429, 54185388 },
+    { 255, 0, -1207240 },
+    { 255, 0, -287118 },
+    { 2, 1434, 59145440 },
+    { 2, 1433, 46075328 },
+    { 255, 0, -464715 },
+    { 255, 0, 928209 },
+    { 2, 1436, 60725624 },
+    { 255, 0, -2226544 },
+    { 255, 0, 150823 },
+    { 1, 1439, 39564772 },
+    { 255, 0, -2074839 },
+    { 255, 0, -476371 },
+    { 1, 1456, 37868576 },
+    { 0, 1449, 813833856 },
+    { 2, 1446, 52099512 },
+    { 2, 1445, 50426960 },
+    { 255, 0, 550355 },
+    { 255, 0, 2007853 },
+    { 1, 1448, 23816546 },
+    { 255, 0, -802975 },
+    { 255, 0, 143773 },
+    { 0, 1453, 993584320 },
+    { 2, 1452, 42400760 },
+    { 255, 0, -969726 },
+    { 255, 0, 977187 },
+    { 2, 1455, 65168712 },
+    { 255, 0, -2103907 },
+    { 255, 0, 188721 },
+    { 0, 1458, 735743616 },
+    { 255, 0, 1917806 },
+    { 0, 1460, 762184768 },
+    { 255, 0, -807516 },
+    { 2, 1462, 84480472 },
+    { 255, 0, 1533001 },
+    { 255, 0, 126576 },
+    { 0, 1469, 330129312 },
+    { 1, 1466, 40160492 },
+    { 255, 0, -2128511 },
+    { 0, 1468, 265007280 },
+    { 255, 0, -1463081 },
+    { 255, 0, 622549 },
+    { 0, 1497, 655538432 },
+    { 2, 1484, 66848340 },
+    { 1, 1477, 32393256 },
+    { 1, 1476, 31573058 },
+    { 2, 1475, 54067572 },
+    { 255, 0, -525020 },
+    { 255, 0, 504686 },
+    { 255, 0, -2865142 },
+    { 0, 1481, 444341632 },
+    { 2, 1480, 64894508 },
+    { 255, 0, -471558 },
+    { 255, 0, 1323880 },
+    { 2, 1483, 57251952 },
+    { 255, 0, 1381223 },
+    { 255, 0, 223694 },
+    { 1, 1490, 31239688 },
+    { 1, 1489, 27440568 },
+    { 1, 1488, 26980268 },
+    { 255, 0, -1165579 },
+    { 255, 0, 1686047 },
+    { 255, 0, -2116055 },
+    { 1, 1494, 32205054 },
+    { 0, 1493, 507513408 },
+    { 255, 0, 213591 },
+    { 255, 0, 2011195 },
+    { 2, 1496, 75945976 },
+    { 255, 0, -922579 },
+    { 255, 0, 139527 },
+    { 1, 1509, 23816546 },
+    { 1, 1506, 23616240 },
+    { 1, 1503, 22282790 },
+    { 1, 1502, 21637234 },
+    { 255, 0, 656446 },
+    { 255, 0, -1209207 },
+    { 0, 1505, 722018752 },
+    { 255, 0, -878018 },
+    { 255, 0, 1086062 },
+    { 2, 1508, 57667356 },
+    { 255, 0, -1826616 },
+    { 255, 0, -470537 },
+    { 0, 1515, 669940288 },
+    { 2, 1512, 75108432 },
+    { 255, 0, 2089164 },
+    { 1, 1514, 28935190 },
+    { 255, 0, -258340 },
+    { 255, 0, 1408510 },
+    { 0, 1519, 690238784 },
+    { 2, 1518, 75793408 },
+    { 255, 0, 448583 },
+    { 255, 0, -1718603 },
+    { 2, 1521, 85195688 },
+    { 255, 0, 589954 },
+    { 255, 0, 1559606 },
+    { 0, 1530, 330129312 },
+    { 1, 1525, 40160492 },
+    { 255, 0, -2104348 },
+    { 2, 1529, 57854224 },
+    { 2, 1528, 47279756 },
+    { 255, 0, 800087 },
+    { 255, 0, 106314 },
+    { 255, 0, -1461012 },
+    { 0, 1548, 529156352 },
+    { 2, 1547, 83057712 },
+    { 1, 1540, 33130658 },
+    { 0, 1537, 346247584 },
+    { 2, 1536, 53890564 },
+    { 255, 0, -534830 },
+    { 255, 0, 1788531 },
+    { 0, 1539, 494007264 },
+    { 255, 0, -563744 },
+    { 255, 0, -1722905 },
+    { 2, 1544, 56875908 },
+    { 2, 1543, 46075328 },
+    { 255, 0, -819063 },
+    { 255, 0, 976094 },
+    { 2, 1546, 77070224 },
+    { 255, 0, -520636 },
+    { 255, 0, 703382 },
+    { 255, 0, -1920469 },
+    { 1, 1564, 38633004 },
+    { 0, 1557, 829297408 },
+    { 2, 1554, 69356568 },
+    { 2, 1553, 45365068 },
+    { 255, 0, 1561552 },
+    { 255, 0, 286308 },
+    { 2, 1556, 71913496 },
+    { 255, 0, -2458054 },
+    { 255, 0, -186911 },
+    { 2, 1561, 52679432 },
+    { 1, 1560, 33471460 },
+    { 255, 0, 400668 },
+    { 255, 0, -1787957 },
+    { 1, 1563, 26782084 },
+    { 255, 0, 345799 },
+    { 255, 0, 1327375 },
+    { 0, 1566, 756272192 },
+    { 255, 0, 1926907 },
+    { 0, 1568, 808071872 },
+    { 255, 0, -289808 },
+    { 1, 1570, 40790108 },
+    { 255, 0, 1689033 },
+    { 255, 0, 532281 },
+    { 0, 1579, 330129312 },
+    { 1, 1574, 40160492 },
+    { 255, 0, -2080190 },
+    { 2, 1578, 57854224 },
+    { 0, 1577, 269920480 },
+    { 255, 0, 33928 },
+    { 255, 0, 809256 },
+    { 255, 0, -1411069 },
+    { 0, 1597, 619240960 },
+    { 2, 1594, 83057712 },
+    { 1, 1589, 40215976 },
+    { 0, 1586, 587610560 },
+    { 0, 1585, 571350400 },
+    { 255, 0, -226019 },
+    { 255, 0, 1408271 },
+    { 1, 1588, 29636374 },
+    { 255, 0, -1662945 },
+    { 255, 0, -71858 },
+    { 0, 1593, 437533056 },
+    { 2, 1592, 62123000 },
+    { 255, 0, 862731 },
+    { 255, 0, -812794 },
+    { 255, 0, 1779698 },
+    { 1, 1596, 39564772 },
+    { 255, 0, -1782473 },
+    { 255, 0, -440938 },
+    { 1, 1607, 37046760 },
+    { 0, 1606, 993584320 },
+    { 0, 1603, 950204096 },
+    { 0, 1602, 935644928 },
+    { 255, 0, 285201 },
+    { 255, 0, -1561822 },
+    { 2, 1605, 49126068 },
+    { 255, 0, -244237 },
+    { 255, 0, 1605783 },
+    { 255, 0, -1538218 },
+    { 0, 1613, 824097472 },
+    { 0, 1610, 735743616 },
+    { 255, 0, 1820153 },
+    { 1, 1612, 40038304 },
+    { 255, 0, -1273722 },
+    { 255, 0, 1318192 },
+    { 1, 1615, 40790108 },
+    { 255, 0, 1908462 },
+    { 255, 0, 393664 },
+    { 0, 1620, 310812128 },
+    { 2, 1619, 43833736 },
+    { 255, 0, -77836 },
+    { 255, 0, -2063686 },
+    { 0, 1638, 769799552 },
+    { 0, 1637, 767929216 },
+    { 1, 1630, 31860448 },
+    { 2, 1627, 69026576 },
+    { 1, 1626, 31573058 },
+    { 255, 0, 95339 },
+    { 255, 0, -2476013 },
+    { 2, 1629, 77300168 },
+    { 255, 0, -1571268 },
+    { 255, 0, -347520 },
+    { 0, 1634, 502377920 },
+    { 2, 1633, 56875908 },
+    { 255, 0, 389864 },
+    { 255, 0, -704096 },
+    { 0, 1636, 619240960 },
+    { 255, 0, 478161 },
+    { 255, 0, 1313898 },
+    { 255, 0, -3625062 },
+    { 1, 1640, 21107088 },
+    { 255, 0, -1254883 },
+    { 0, 1648, 993584320 },
+    { 0, 1645, 950204096 },
+    { 0, 1644, 935644928 },
+    { 255, 0, 657908 },
+    { 255, 0, -853193 },
+    { 2, 1647, 44777648 },
+    { 255, 0, -478894 },
+    { 255, 0, 1699545 },
+    { 2, 1650, 65168712 },
+    { 255, 0, -1948851 },
+    { 255, 0, 196886 },
+    { 0, 1655, 310812128 },
+    { 2, 1654, 43833736 },
+    { 255, 0, -72684 },
+    { 255, 0, -2037363 },
+    { 1, 1677, 40414436 },
+    { 0, 1664, 571350400 },
+    { 2, 1663, 83057712 },
+    { 2, 1662, 81462672 },
+    { 2, 1661, 77729016 },
+    { 255, 0, -191664 },
+    { 255, 0, -1754980 },
+    { 255, 0, 1264212 },
+    { 255, 0, -1820847 },
+    { 1, 1672, 26259966 },
+    { 1, 1669, 25577596 },
+    { 2, 1668, 76469224 },
+    { 255, 0, -226187 },
+    { 255, 0, 985259 },
+    { 2, 1671, 65994796 },
+    { 255, 0, 113735 },
+    { 255, 0, -2566246 },
+    { 0, 1674, 579548992 },
+    { 255, 0, 2187120 },
+    { 0, 1676, 604568128 },
+    { 255, 0, -698644 },
+    { 255, 0, 465761 },
+    { 2, 1679, 61195844 },
+    { 255, 0, 2079566 },
+    { 0, 1683, 437533056 },
+    { 2, 1682, 71438560 },
+    { 255, 0, -1284782 },
+    { 255, 0, -224313 },
+    { 0, 1685, 859291712 },
+    { 255, 0, 1606083 },
+    { 255, 0, 118648 },
+    { 0, 1690, 310812128 },
+    { 2, 1689, 43833736 },
+    { 255, 0, -67872 },
+    { 255, 0, -2010335 },
+    { 1, 1716, 40414436 },
+    { 0, 1707, 813833856 },
+    { 2, 1700, 68643808 },
+    { 0, 1697, 544988864 },
+    { 1, 1696, 33074540 },
+    { 255, 0, -542157 },
+    { 255, 0, 132046 },
+    { 0, 1699, 745314240 },
+    { 255, 0, 548579 },
+    { 255, 0, -334504 },
+    { 2, 1704, 71913496 },
+    { 2, 1703, 69356568 },
+    { 255, 0, -287897 },
+    { 255, 0, -2401931 },
+    { 2, 1706, 72659736 },
+    { 255, 0, 1322455 },
+    { 255, 0, -331030 },
+    { 2, 1715, 85195688 },
+    { 2, 1712, 82417496 },
+    { 1, 1711, 21895646 },
+    { 255, 0, -1036268 },
+    { 255, 0, 726661 },
+    { 1, 1714, 26018746 },
+    { 255, 0, -372720 },
+    { 255, 0, -2632689 },
+    { 255, 0, 1867410 },
+    { 2, 1718, 61195844 },
+    { 255, 0, 2011358 },
+    { 0, 1722, 437533056 },
+    { 2, 1721, 71438560 },
+    { 255, 0, -1206896 },
+    { 255, 0, -210383 },
+    { 0, 1724, 859291712 },
+    { 255, 0, 1532985 },
+    { 255, 0, 111190 },
+    { 0, 1731, 330129312 },
+    { 1, 1728, 40160492 },
+    { 255, 0, -1996579 },
+    { 2, 1730, 57854224 },
+    { 255, 0, 734805 },
+    { 255, 0, -1213904 },
+    { 0, 1747, 769799552 },
+    { 0, 1746, 767929216 },
+    { 1, 1739, 31105630 },
+    { 1, 1736, 20991302 },
+    { 255, 0, 1757249 },
+    { 2, 1738, 69026576 },
+    { 255, 0, -69357 },
+    { 255, 0, -985704 },
+    { 0, 1743, 502377920 },
+    { 0, 1742, 486127360 },
+    { 255, 0, -49835 },
+    { 255, 0, -1618232 },
+    { 0, 1745, 680160256 },
+    { 255, 0, 455609 },
+    { 255, 0, 1415381 },
+    { 255, 0, -3111605 },
+    { 1, 1763, 37046760 },
+    { 1, 1756, 33130658 },
+    { 1, 1753, 26782084 },
+    { 0, 1752, 793950912 },
+    { 255, 0, 1077658 },
+    { 255, 0, -182971 },
+    { 2, 1755, 72659736 },
+    { 255, 0, 1506435 },
+    { 255, 0, 450452 },
+    { 2, 1760, 62642168 },
+    { 0, 1759, 862763904 },
+    { 255, 0, -4532478 },
+    { 255, 0, -967938 },
+    { 1, 1762, 36524568 },
+    { 255, 0, 1186449 },
+    { 255, 0, -855539 },
+    { 2, 1765, 66367880 },
+    { 255, 0, 1785875 },
+    { 2, 1767, 72659736 },
+    { 255, 0, -963221 },
+    { 0, 1769, 824097472 },
+    { 255, 0, 127150 },
+    { 255, 0, 1526157 },
+    { 0, 1774, 310812128 },
+    { 2, 1773, 43833736 },
+    { 255, 0, 8313 },
+    { 255, 0, -1961174 },
+    { 1, 1798, 40215976 },
+    { 0, 1785, 655538432 },
+    { 0, 1782, 649239552 },
+    { 1, 1779, 20991302 },
+    { 255, 0, 1463069 },
+    { 1, 1781, 22166944 },
+    { 255, 0, -1311804 },
+    { 255, 0, -103232 },
+    { 2, 1784, 60018516 },
+    { 255, 0, -343000 },
+    { 255, 0, -1903153 },
+    { 0, 1791, 669940288 },
+    { 1, 1788, 22461228 },
+    { 255, 0, -78920 },
+    { 2, 1790, 75108432 },
+    { 255, 0, 2124684 },
+    { 255, 0, 753022 },
+    { 0, 1795, 690238784 },
+    { 2, 1794, 75793408 },
+    { 255, 0, 181551 },
+    { 255, 0, -1833083 },
+    { 0, 1797, 993584320 },
+    { 255, 0, 281126 },
+    { 255, 0, -1085392 },
+    { 0, 1804, 465196800 },
+    { 2, 1801, 61195844 },
+    { 255, 0, 1573545 },
+    { 1, 1803, 40879216 },
+    { 255, 0, 664269 },
+    { 255, 0, -1825090 },
+    { 0, 1806, 900354304 },
+    { 255, 0, 1861658 },
+    { 255, 0, 61095 },
+    { 0, 1813, 330129312 },
+    { 1, 1810, 40160492 },
+    { 255, 0, -1948254 },
+    { 2, 1812, 49411924 },
+    { 255, 0, 571970 },
+    { 255, 0, -573116 },
+    { 1, 1841, 40215976 },
+    { 0, 1828, 829297408 },
+    { 2, 1821, 68643808 },
+    { 2, 1820, 68288656 },
+    { 1, 1819, 22282790 },
+    { 255, 0, -720263 },
+    { 255, 0, 176359 },
+    { 255, 0, 1940453 },
+    { 2, 1825, 71913496 },
+    { 2, 1824, 69356568 },
+    { 255, 0, -230804 },
+    { 255, 0, -2127431 },
+    { 0, 1827, 812717440 },
+    { 255, 0, -99239 },
+    { 255, 0, -2006440 },
+    { 2, 1834, 69026576 },
+    { 0, 1833, 993584320 },
+    { 1, 1832, 33130658 },
+    { 255, 0, 550582 },
+    { 255, 0, -572853 },
+    { 255, 0, -1837615 },
+    { 1, 1838, 28043252 },
+    { 1, 1837, 26018746 },
+    { 255, 0, 1032041 },
+    { 255, 0, -1130050 },
+    { 0, 1840, 946782400 },
+    { 255, 0, 1893396 },
+    { 255, 0, 546199 },
+    { 0, 1845, 465196800 },
+    { 1, 1844, 41012940 },
+    { 255, 0, 1174552 },
+    { 255, 0, -1085129 },
+    { 0, 1847, 900354304 },
+    { 255, 0, 1813742 },
+    { 255, 0, 57246 },
+    { 0, 1852, 310812128 },
+    { 2, 1851, 44163660 },
+    { 255, 0, 30423 },
+    { 255, 0, -1905830 },
+    { 1, 1878, 40414436 },
+    { 0, 1865, 504773568 },
+    { 1, 1860, 23616240 },
+    { 0, 1859, 458955584 },
+    { 0, 1858, 381480000 },
+    { 255, 0, 986451 },
+    { 255, 0, -1231917 },
+    { 255, 0, 1982349 },
+    { 1, 1862, 26187476 },
+    { 255, 0, -1954626 },
+    { 1, 1864, 26452070 },
+    { 255, 0, 1696455 },
+    { 255, 0, -375317 },
+    { 1, 1873, 22282790 },
+    { 1, 1870, 21809290 },
+    { 2, 1869, 54390968 },
+    { 255, 0, 1063651 },
+    { 255, 0, -370075 },
+    { 0, 1872, 872958080 },
+    { 255, 0, -2000666 },
+    { 255, 0, 478165 },
+    { 0, 1877, 993584320 },
+    { 0, 1876, 950204096 },
+    { 255, 0, 175127 },
+    { 255, 0, 1303561 },
+    { 255, 0, -1363206 },
+    { 2, 1880, 61195844 },
+    { 255, 0, 1864701 },
+    { 0, 1884, 465196800 },
+    { 1, 1883, 40879216 },
+    { 255, 0, 639827 },
+    { 255, 0, -1689237 },
+    { 0, 1886, 833306560 },
+    { 255, 0, 1548060 },
+    { 255, 0, 79542 },
+    { 0, 1891, 310812128 },
+    { 2, 1890, 44163660 },
+    { 255, 0, 28449 },
+    { 255, 0, -1872822 },
+    { 1, 1919, 40414436 },
+    { 0, 1906, 604568128 },
+    { 0, 1901, 587610560 },
+    { 0, 1898, 571350400 },
+    { 2, 1897, 83057712 },
+    { 255, 0, -133124 },
+    { 255, 0, -1714828 },
+    { 1, 1900, 24357322 },
+    { 255, 0, -315403 },
+    { 255, 0, 1510045 },
+    { 2, 1905, 71269432 },
+    { 2, 1904, 49411924 },
+    { 255, 0, -377742 },
+    { 255, 0, -2488109 },
+    { 255, 0, 707996 },
+    { 1, 1912, 23816546 },
+    { 1, 1911, 23616240 },
+    { 2, 1910, 47905932 },
+    { 255, 0, 1205797 },
+    { 255, 0, -194436 },
+    { 255, 0, -1516816 },
+    { 2, 1916, 52031448 },
+    { 2, 1915, 47950364 },
+    { 255, 0, 130533 },
+    { 255, 0, 1807662 },
+    { 2, 1918, 54185388 },
+    { 255, 0, -1893985 },
+    { 255, 0, 283343 },
+    { 2, 1921, 61195844 },
+    { 255, 0, 1800292 },
+    { 0, 1923, 437533056 },
+    { 255, 0, -803573 },
+    { 0, 1925, 833306560 },
+    { 255, 0, 1285109 },
+    { 255, 0, 74531 },
+    { 0, 1932, 330129312 },
+    { 1, 1929, 40160492 },
+    { 255, 0, -1873959 },
+    { 2, 1931, 55357444 },
+    { 255, 0, 441209 },
+    { 255, 0, -382731 },
+    { 1, 1948, 40215976 },
+    { 0, 1941, 769799552 },
+    { 0, 1940, 767929216 },
+    { 1, 1937, 21107088 },
+    { 255, 0, 1570754 },
+    { 1, 1939, 22282790 },
+    { 255, 0, -1333266 },
+    { 255, 0, 15148 },
+    { 255, 0, -3017675 },
+    { 2, 1943, 42010436 },
+    { 255, 0, -1477463 },
+    { 1, 1945, 21107088 },
+    { 255, 0, -1138220 },
+    { 0, 1947, 993584320 },
+    { 255, 0, 488316 },
+    { 255, 0, -718640 },
+    { 0, 1952, 465196800 },
+    { 1, 1951, 41012940 },
+    { 255, 0, 1061112 },
+    { 255, 0, -1005392 },
+    { 0, 1954, 882172544 },
+    { 255, 0, 1684530 },
+    { 255, 0, 72974 },
+    { 0, 1959, 310812128 },
+    { 2, 1958, 44413084 },
+    { 255, 0, -90435 },
+    { 255, 0, -1794998 },
+    { 1, 1985, 40414436 },
+    { 0, 1970, 366280512 },
+    { 2, 1967, 58707704 },
+    { 2, 1966, 53890564 },
+    { 2, 1965, 47950364 },
+    { 255, 0, 824691 },
+    { 255, 0, -1408147 },
+    { 255, 0, 1439976 },
+    { 1, 1969, 26353800 },
+    { 255, 0, 155242 },
+    { 255, 0, -1944298 },
+    { 1, 1978, 29895020 },
+    { 2, 1975, 45365068 },
+    { 2, 1974, 43713864 },
+    { 255, 0, 84865 },
+    { 255, 0, 1947258 },
+    { 0, 1977, 613436096 },
+    { 255, 0, -769032 },
+    { 255, 0, -12668 },
+    { 2, 1982, 48275504 },
+    { 2, 1981, 47058008 },
+    { 255, 0, 8617 },
+    { 255, 0, -2552404 },
+    { 0, 1984, 859291712 },
+    { 255, 0, 197239 },
+    { 255, 0, 1212905 },
+    { 2, 1987, 61195844 },
+    { 255, 0, 1730693 },
+    { 0, 1991, 465196800 },
+    { 1, 1990, 40879216 },
+    { 255, 0, 568415 },
+    { 255, 0, -1554971 },
+    { 0, 1993, 833306560 },
+    { 255, 0, 1399299 },
+    { 255, 0, 48245 },
+    { 0, 1996, 265007280 },
+    { 255, 0, -1723316 },
+    { 1, 2012, 40160492 },
+    { 0, 1999, 330129312 },
+    { 255, 0, -1425658 },
+    { 0, 2005, 346247584 },
+    { 2, 2002, 53890564 },
+    { 255, 0, -480813 },
+    { 1, 2004, 27641292 },
+    { 255, 0, 2484333 },
+    { 255, 0, -155528 },
+    { 0, 2009, 366280512 },
+    { 2, 2008, 48118784 },
+    { 255, 0, 1277710 },
+    { 255, 0, -2095077 },
+    { 1, 2011, 34115492 },
+    { 255, 0, -51712 },
+    { 255, 0, 242848 },
+    { 2, 2014, 61195844 },
+    { 255, 0, 1676843 },
+    { 0, 2018, 472619456 },
+    { 1, 2017, 40879216 },
+    { 255, 0, -2678 },
+    { 255, 0, -1308365 },
+    { 0, 2020, 833306560 },
+    { 255, 0, 1305447 },
+    { 255, 0, 45205 },
+    { 0, 2027, 330129312 },
+    { 1, 2024, 40160492 },
+    { 255, 0, -1783936 },
+    { 2, 2026, 55357444 },
+    { 255, 0, 384780 },
+    { 255, 0, -336185 },
+    { 1, 2049, 40215976 },
+    { 0, 2038, 808071872 },
+    { 0, 2035, 800742272 },
+    { 1, 2032, 20991302 },
+    { 255, 0, 1542877 },
+    { 2, 2034, 83581832 },
+    { 255, 0, 9801 },
+    { 255, 0, -740903 },
+    { 1, 2037, 24727414 },
+    { 255, 0, -2482259 },
+    { 255, 0, -541783 },
+    { 2, 2046, 85195688 },
+    { 2, 2043, 82417496 },
+    { 1, 2042, 37046760 },
+    { 255, 0, 140393 },
+    { 255, 0, 1633906 },
+    { 0, 2045, 882172544 },
+    { 255, 0, 207267 },
+    { 255, 0, -2714564 },
+    { 2, 2048, 86453984 },
+    { 255, 0, 467242 },
+    { 255, 0, 1650145 },
+    { 0, 2053, 465196800 },
+    { 1, 2052, 41012940 },
+    { 255, 0, 946382 },
+    { 255, 0, -892909 },
+    { 0, 2055, 880795072 },
+    { 255, 0, 1552515 },
+    { 255, 0, 96704 },
+    { 0, 2058, 265007280 },
+    { 255, 0, -1649210 },
+    { 1, 2072, 40160492 },
+    { 0, 2061, 330129312 },
+    { 255, 0, -1326464 },
+    { 0, 2065, 346247584 },
+    { 2, 2064, 58707704 },
+    { 255, 0, 1513351 },
+    { 255, 0, -264086 },
+    { 0, 2069, 366280512 },
+    { 2, 2068, 48118784 },
+    { 255, 0, 1170053 },
+    { 255, 0, -2020678 },
+    { 2, 2071, 49292320 },
+    { 255, 0, -238816 },
+    { 255, 0, 83038 },
+    { 2, 2074, 61195844 },
+    { 255, 0, 1560827 },
+    { 0, 2078, 472619456 },
+    { 1, 2077, 40879216 },
+    { 255, 0, -46690 },
+    { 255, 0, -1218959 },
+    { 2, 2080, 76835832 },
+    { 255, 0, 41177 },
+    { 255, 0, 1205334 },
+    { 0, 2083, 265007280 },
+    { 255, 0, -1608019 },
+    { 2, 2101, 47058008 },
+    { 0, 2098, 912755840 },
+    { 0, 2091, 444341632 },
+    { 2, 2090, 46637860 },
+    { 1, 2089, 38840272 },
+    { 255, 0, -1823858 },
+    { 255, 0, 337435 },
+    { 255, 0, 983301 },
+    { 1, 2095, 25405552 },
+    { 2, 2094, 42987472 },
+    { 255, 0, 757315 },
+    { 255, 0, 2382386 },
+    { 1, 2097, 26591828 },
+    { 255, 0, -1752615 },
+    { 255, 0, 1080152 },
+    { 2, 2100, 43713864 },
+    { 255, 0, -2059538 },
+    { 255, 0, -217743 },
+    { 2, 2109, 49292320 },
+    { 1, 2108, 36550872 },
+    { 0, 2107, 898110016 },
+    { 2, 2106, 48275504 },
+    { 255, 0, -2433776 },
+    { 255, 0, -661640 },
+    { 255, 0, 272062 },
+    { 255, 0, 1141589 },
+    { 2, 2117, 52099512 },
+    { 0, 2114, 564477248 },
+    { 1, 2113, 32322774 },
+    { 255, 0, -1171599 },
+    { 255, 0, 1162728 },
+    { 1, 2116, 24057758 },
+    { 255, 0, -66276 },
+    { 255, 0, 1972262 },
+    { 2, 2121, 53890564 },
+    { 1, 2120, 23691084 },
+    { 255, 0, 296169 },
+    { 255, 0, -1676798 },
+    { 2, 2123, 55357444 },
+    { 255, 0, 1763079 },
+    { 255, 0, -42221 },
+    { 0, 2126, 265007280 },
+    { 255, 0, -1566227 },
+    { 2, 2140, 58707704 },
+    { 2, 2137, 57667356 },
+    { 2, 2136, 57251952 },
+    { 0, 2133, 935644928 },
+    { 2, 2132, 54185388 },
+    { 255, 0, 38974 },
+    { 255, 0, 1134788 },
+    { 0, 2135, 950204096 },
+    { 255, 0, -2935340 },
+    { 255, 0, -318596 },
+    { 255, 0, -2315015 },
+    { 2, 2139, 58291512 },
+    { 255, 0, 2497482 },
+    { 255, 0, 808268 },
+    { 0, 2154, 925621504 },
+    { 0, 2147, 368423360 },
+    { 1, 2144, 26353800 },
+    { 255, 0, 184687 },
+    { 2, 2146, 78186040 },
+    { 255, 0, -1926521 },
+    { 255, 0, -155015 },
+    { 1, 2151, 29895020 },
+    { 1, 2150, 27518612 },
+    { 255, 0, -79891 },
+    { 255, 0, -1272162 },
+    { 1, 2153, 36524568 },
+    { 255, 0, 459637 },
+    { 255, 0, -437386 },
+    { 2, 2158, 64203292 },
+    { 0, 2157, 966426944 },
+    { 255, 0, 1282831 },
+    { 255, 0, -1569536 },
+    { 2, 2160, 78186040 },
+    { 255, 0, 1827513 },
+    { 0, 2162, 950204096 },
+    { 255, 0, -927903 },
+    { 255, 0, 1069483 },
+    { 0, 2167, 330129312 },
+    { 1, 2166, 40160492 },
+    { 255, 0, -1661429 },
+    { 255, 0, 17284 },
+    { 1, 2193, 40215976 },
+    { 0, 2180, 655538432 },
+    { 0, 2177, 649239552 },
+    { 2, 2174, 65683856 },
+    { 2, 2173, 64697276 },
+    { 255, 0, -49502 },
+    { 255, 0, 1541032 },
+    { 0, 2176, 385034560 },
+    { 255, 0, -1351969 },
+    { 255, 0, -148764 },
+    { 1, 2179, 28935190 },
+    { 255, 0, -1770170 },
+    { 255, 0, -363755 },
+    { 0, 2186, 669940288 },
+    { 1, 2183, 22461228 },
+    { 255, 0, -71582 },
+    { 2, 2185, 75108432 },
+    { 255, 0, 2021278 },
+    { 255, 0, 678591 },
+    { 0, 2190, 680160256 },
+    { 2, 2189, 75793408 },
+    { 255, 0, 256631 },
+    { 255, 0, -2107161 },
+    { 2, 2192, 42010436 },
+    { 255, 0, -1062393 },
+    { 255, 0, 115715 },
+    { 0, 2197, 465196800 },
+    { 1, 2196, 41012940 },
+    { 255, 0, 909246 },
+    { 255, 0, -827669 },
+    { 0, 2199, 872958080 },
+    { 255, 0, 1474465 },
+    { 255, 0, 73460 },
+    { 0, 2202, 265007280 },
+    { 255, 0, -1487776 },
+    { 2, 2220, 47058008 },
+    { 0, 2217, 912755840 },
+    { 0, 2210, 444341632 },
+    { 0, 2209, 393544224 },
+    { 2, 2208, 45617832 },
+    { 255, 0, -471486 },
+    { 255, 0, 1268730 },
+    { 255, 0, -1687173 },
+    { 1, 2214, 25405552 },
+    { 0, 2213, 524804608 },
+    { 255, 0, 694954 },
+    { 255, 0, 2274456 },
+    { 1, 2216, 26591828 },
+    { 255, 0, -1593959 },
+    { 255, 0, 991212 },
+    { 2, 2219, 43713864 },
+    { 255, 0, -1745325 },
+    { 255, 0, -188098 },
+    { 2, 2228, 49292320 },
+    { 1, 2227, 36550872 },
+    { 0, 2226, 898110016 },
+    { 2, 2225, 48275504 },
+    { 255, 0, -2172309 },
+    { 255, 0, -606365 },
+    { 255, 0, 287948 },
+    { 255, 0, 1069855 },
+    { 2, 2236, 52099512 },
+    { 0, 2233, 564477248 },
+    { 1, 2232, 32322774 },
+    { 255, 0, -1081216 },
+    { 255, 0, 1043876 },
+    { 1, 2235, 24057758 },
+    { 255, 0, -65181 },
+    { 255, 0, 1885420 },
+    { 2, 2240, 53890564 },
+    { 0, 2239, 655538432 },
+    { 255, 0, -1845293 },
+    { 255, 0, -322875 },
+    { 2, 2242, 55357444 },
+    { 255, 0, 1553621 },
+    { 255, 0, -43148 },
+};
+
+static const uint16_t MODEL_FIXED_TREE_ROOTS[41] = {
+    0, 83, 160, 245, 334, 421, 502, 581, 658, 725, 784, 843, 910, 989, 1048, 1115,
+    1190, 1245, 1312, 1365, 1414, 1463, 1522, 1571, 1616, 1651, 1686, 1725, 1770, 1807, 1848, 1887,
+    1926, 1955, 1994, 2021, 2056, 2081, 2124, 2163, 2200,
+};
+
+static const uint8_t MODEL_FIXED_TREE_CLASS[41] = {
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0,
+};
+
+static const int32_t MODEL_FIXED_MARGIN_MIN[42] = {
+    -101306281, -97653548, -93679271, -90630769, -87307578, -84556472, -81624771, -79029071, -76314701, -73863676, -71310485, -69143908, -66650044, -64176009, -61823444, -59772908,
+    -57498660, -55600212, -53385854, -50899998, -48721825, -46713972, -43848830, -41921923, -39841733, -38142188, -35575942, -33564584, -29032106, -26907422, -24779991, -22797642,
+    -20309533, -18625003, -16072599, -13588266, -10873702, -9312875, -6879099, -4381617, -2274456, 0,
+};
+
+static const int32_t MODEL_FIXED_MARGIN_MAX[42] = {
+    102463669, 97892278, 94657275, 91087971, 88167447, 85037106, 82460679, 79635470, 77331128, 74253764, 72080686, 69595116, 67006987, 63932410, 61836823, 59467381,
+    56689117, 53369907, 51031742, 48827305, 46865071, 44638527, 42549363, 40091309, 38182847, 34557785, 32370665, 29737976, 27952101, 25990927, 24050474, 22049808,
+    20242146, 17224471, 15277213, 13182136, 11531991, 9511313, 7128927, 4193587, 2172309, 0,
+};
+
+static const ModelFixedTables MODEL_FIXED = {
+    MODEL_FIXED_NODES,
+    MODEL_FIXED_TREE_ROOTS,
+    MODEL_FIXED_TREE_CLASS,
+    MODEL_FIXED_NODE_COUNT,
+    41,
+    0.54f,
+    MODEL_FIXED_LOGIT_THRESHOLD,
+    MODEL_FIXED_MARGIN_MIN,
+    MODEL_FIXED_MARGIN_MAX,
+};
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef MODEL_HANDLER_H
+#define MODEL_HANDLER_H
+
+#include "config.h"
+#include "model_explain.h"
+
+// Nạp mô hình từ LittleFS (MODEL_FILE_PATH) khi khởi động. Không có file hoặc
+// file hỏng thì dùng mô hình built-in (model_table.h)
+void setupModel();
+
+// Suy luận bằng mô hình đang dùng, cùng kết quả với XGBClassifier::predict
+int predictIrrigation(const float* features, uint16_t* treesEvaluated = nullptr);
+
+// Cùng mô hình đang dùng nhưng không đụng trạng thái của đường thật: không ghi cache
+// lá, không tính vào profile suy luận. Cho tự kiểm tra với vector tổng hợp
+int predictIrrigationStateless(const float* features);
+
+// Chạy mô hình của mọi vùng (MODEL_ZONE_MODELS) trên cùng vector đặc trưng,
+// decisions[z] nhận 0/1. Một vùng thì như predictIrrigation; nhiều vùng thì mỗi cây
+// khác nhau của các mô hình chỉ duyệt một lần
+void predictZones(const float* features, uint8_t* decisions, uint16_t* treesEvaluated = nullptr);
+// Chỉ mô hình của vùng zone, cho vector riêng của vùng (độ ẩm từ đầu dò của vùng).
+// Một vùng thì như predictIrrigation
+uint8_t predictZone(uint8_t zone, const float* features, uint16_t* treesEvaluated = nullptr);
+
+#if defined(MODEL_INFERENCE_FIXED)
+// Như predictIrrigation nhưng đầu vào đã ở dạng Q20 (modelFixedInput): cả đường
+// suy luận chỉ dùng số nguyên
+int predictIrrigationFixed(const int32_t* features, uint16_t* treesEvaluated = nullptr);
+#endif
+
+// Ghi giải thích của quyết định vùng 0 vừa ra trên features (vector của chính quyết
+// định đó); gọi sau mỗi lần suy luận vùng 0
+void recordIrrigationDecision(const float* features);
+// Tách margin của quyết định vùng 0 gần nhất (bản ghi của recordIrrigationDecision)
+// thành đóng góp của soil, nhiệt độ, độ ẩm. false nếu chưa có quyết định nào hoặc
+// mô hình nạp từ file không có bảng giải thích
+bool explainIrrigation(ModelExplanation& out);
+
+// Đặt lịch tải mô hình mới từ url (Firebase hoặc Telegram). Việc tải chạy trong
+// loop qua handleModelUpdate, không chạy trong callback. Trả về false nếu url
+// rỗng hoặc là file đang dùng
+bool requestModelUpdate(const String& url);
+void handleModelUpdate();
+
+// Xóa file mô hình và quay về mô hình built-in
+void useBuiltinModel();
+
+String getModelInfoText();
+
+// Quét một điểm trong mỗi ô giữa các ngưỡng split để tìm đường đi chậm nhất.
+// Chạy dần trong loop qua handleModelProfile, in kết quả khi xong
+void startModelWcetSweep();
+void handleModelProfile();
+
+// Histogram chu kỳ CPU (min/mean/p99/max) của suy luận thực tế và của lần quét
+void printModelProfile();
+void setModelProfileJson(FirebaseJson& json);
+
+#if defined(MODEL_BENCHMARK)
+// So sánh các engine với mô hình nested-if (chu kỳ CPU, flash)
+void benchmarkModel();
+#endif
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef MODEL_IMAGE_H
+#define MODEL_IMAGE_H
+
+// Định dạng file mô hình nạp lúc chạy (không phụ thuộc Arduino). File do
+// tools/model_export.py --image sinh ra, little-endian như ESP32 và x86:
+//
+//   ModelImageHeader (32 bytes)
+//   uint16_t treeRoots[treeCount]          (đệm tới bội 4)
+//   uint8_t  treeClass[treeCount]          (đệm tới bội 4)
+//   float    marginMin[treeCount + 1]
+//   float    marginMax[treeCount + 1]
+//   ModelNode nodes[nodeCount]             (ngưỡng split nằm ngay trong node)
+//
+// CRC32 (giống zlib.crc32) tính trên toàn bộ phần sau header. Các mảng nằm đúng
+// vị trí căn lề nên ModelTables trỏ thẳng vào buffer, không phải copy.
+
+#include "model_engine.h"
+
+#define MODEL_IMAGE_MAGIC 0x444D5249u    // "IRMD"
+#define MODEL_IMAGE_FORMAT_VERSION 1
+#define MODEL_IMAGE_MAX_SIZE 65536       // đủ cho ~8000 node, giới hạn RAM khi tải
+
+struct ModelImageHeader {
+    uint32_t magic;
+    uint16_t formatVersion;
+    uint8_t featureCount;
+    uint8_t classCount;
+    uint32_t modelVersion;      // phiên bản mô hình do người train đặt
+    uint16_t treeCount;
+    uint16_t nodeCount;
+    float threshold;
+    float logitThreshold;
+    uint32_t payloadSize;       // số byte sau header
+    uint32_t payloadCrc;
+};
+
+enum ModelImageStatus {
+    MODEL_IMAGE_OK = 0,
+    MODEL_IMAGE_TOO_SMALL,
+    MODEL_IMAGE_BAD_MAGIC,
+    MODEL_IMAGE_BAD_VERSION,
+    MODEL_IMAGE_BAD_SHAPE,      // số feature/lớp khác firmware
+    MODEL_IMAGE_BAD_SIZE,
+    MODEL_IMAGE_BAD_CRC,
+    MODEL_IMAGE_BAD_NODES,      // chỉ số node, feature hoặc lớp ngoài phạm vi
+    MODEL_IMAGE_IO_ERROR,
+};
+
+const char* modelImageStatusText(ModelImageStatus status);
+
+uint32_t modelImageCrc32(const uint8_t* data, size_t size, uint32_t crc = 0);
+
+// Số byte của file với số cây và số node cho trước
+size_t modelImageSize(uint16_t treeCount, uint16_t nodeCount);
+
+// Kiểm tra header, CRC và cấu trúc cây (con luôn đứng sau cha nên duyệt cây
+// luôn dừng). Thành công thì tables trỏ vào data, data phải sống lâu hơn tables
+// và căn lề 4 byte.
+ModelImageStatus parseModelImage(const uint8_t* data, size_t size, ModelTables& tables,
+                                 ModelImageHeader* header = nullptr);
+
+#ifndef ARDUINO
+// Trên host: mmap file mô hình và dùng trực tiếp
+class ModelImageFile {
+    public:
+        ModelImageFile();
+        ~ModelImageFile();
+
+        ModelImageStatus open(const char* path);
+        void close();
+
+        const ModelTables& tables() const { return model; }
+        const ModelImageHeader& header() const { return info; }
+
+        ModelImageFile(const ModelImageFile&) = delete;
+        ModelImageFile& operator=(const ModelImageFile&) = delete;
+
+    private:
+        void* data;
+        size_t size;
+        ModelTables model;
+        ModelImageHeader info;
+};
+#endif
+
+#endif
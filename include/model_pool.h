@@ -0,0 +1,20 @@
+// model_pool.h
+// Sinh tự động bởi tools/model_export.py từ irrigation_xgb.json - không sửa tay.
+
+#ifndef MODEL_POOL_H
+#define MODEL_POOL_H
+
+#include "model_table.h"
+
+// Mô hình của các vùng tưới (MODEL_ZONE_MODELS trong config.h). Mô hình 0 là
+// MODEL_TABLE; mọi mô hình trỏ vào bảng node chung MODEL_TABLE_NODES, cây
+// trùng nhau giữa các mô hình chỉ lưu một lần
+#define MODEL_POOL_MODEL_COUNT 1
+
+constexpr ModelTables MODEL_POOL_MODELS[MODEL_POOL_MODEL_COUNT] = {
+    MODEL_TABLE,
+};
+
+constexpr const char* MODEL_POOL_NAMES[MODEL_POOL_MODEL_COUNT] = { "default" };
+
+#endif
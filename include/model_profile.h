@@ -0,0 +1,104 @@
+#ifndef MODEL_PROFILE_H
+#define MODEL_PROFILE_H
+
+// Đo thời gian suy luận (chu kỳ CPU) và quét miền đầu vào tìm đường đi chậm nhất.
+// Không phụ thuộc Arduino ngoài bộ đếm chu kỳ.
+
+#include "model_engine.h"
+
+#if defined(ARDUINO)
+#include <Arduino.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <time.h>
+#endif
+
+// Histogram log-tuyến tính: mỗi lũy thừa của 2 chia thành 2^MODEL_PROFILE_SUB_BITS
+// bucket, nên p99 sai tối đa 1/4 độ rộng khoảng. 124 bucket = 496 bytes RAM
+#define MODEL_PROFILE_SUB_BITS 2
+#define MODEL_PROFILE_BUCKETS ((32 - MODEL_PROFILE_SUB_BITS + 1) << MODEL_PROFILE_SUB_BITS)
+
+// Số ngưỡng duy nhất tối đa mỗi feature khi quét miền (giới hạn bin uint8)
+#define MODEL_PROFILE_MAX_CUTS 256
+
+// Số lần đo lại một điểm vượt max hiện tại khi quét
+#define MODEL_PROFILE_REPEATS 4
+
+// ESP.getCycleCount trên ESP32, TSC trên x86, nano giây ở nơi khác
+inline uint32_t modelCycleCount() {
+#if defined(ARDUINO)
+    return ESP.getCycleCount();
+#elif defined(__x86_64__) || defined(__i386__)
+    return (uint32_t)__rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000000ull + ts.tv_nsec);
+#endif
+}
+
+// Đo fn(x) một lần; nếu vượt worst thì đo lại và lấy lần nhanh nhất, để ngắt hoặc
+// chuyển ngữ cảnh giữa chừng không bị tính là đường đi chậm nhất
+template <typename Fn>
+uint32_t measureCycles(Fn fn, const float* x, uint32_t worst) {
+    volatile int sink;
+    uint32_t start = modelCycleCount();
+    sink = fn(x);
+    uint32_t best = modelCycleCount() - start;
+    for (int i = 1; i < MODEL_PROFILE_REPEATS && best > worst; i++) {
+        start = modelCycleCount();
+        sink = fn(x);
+        uint32_t cycles = modelCycleCount() - start;
+        if (cycles < best) best = cycles;
+    }
+    (void)sink;
+    return best;
+}
+
+class CycleHistogram {
+    public:
+        CycleHistogram();
+
+        void record(uint32_t cycles);
+        void reset();
+
+        uint32_t count() const { return samples; }
+        uint32_t min() const { return samples ? minCycles : 0; }
+        uint32_t max() const { return maxCycles; }
+        uint32_t mean() const { return samples ? (uint32_t)(total / samples) : 0; }
+
+        // Cận trên của bucket chứa phân vị p (0..1), không vượt quá max()
+        uint32_t percentile(float p) const;
+
+    private:
+        uint32_t buckets[MODEL_PROFILE_BUCKETS];
+        uint32_t samples;
+        uint32_t minCycles;
+        uint32_t maxCycles;
+        uint64_t total;
+};
+
+// Mỗi feature chia thành các ô bởi các ngưỡng split của mô hình; mọi điểm trong
+// cùng một ô đi cùng đường ở mọi cây. Quét một điểm đại diện cho mỗi ô là duyệt
+// đủ mọi tổ hợp đường đi, tức là tìm được trường hợp chậm nhất.
+class ModelDomainSweep {
+    public:
+        explicit ModelDomainSweep(const ModelTables& tables);
+
+        uint32_t cellCount() const;
+
+        // Điểm đại diện của ô index (0..cellCount()-1): chính ngưỡng (đi trái), ô
+        // cuối là số float ngay sau ngưỡng lớn nhất. Ô liền nhau khác nhau ở độ ẩm.
+        void point(uint32_t index, float* x) const;
+
+        // false nếu có feature nhiều ngưỡng hơn MODEL_PROFILE_MAX_CUTS (quét thiếu)
+        bool complete() const { return full; }
+
+    private:
+        float cuts[MODEL_FEATURE_COUNT][MODEL_PROFILE_MAX_CUTS];
+        uint16_t cutCount[MODEL_FEATURE_COUNT];
+        bool full;
+};
+
+#endif
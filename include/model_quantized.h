@@ -0,0 +1,2352 @@
+// model_quantized.h
+// Sinh tự động bởi tools/model_export.py từ irrigation_xgb.json - không sửa tay.
+
+#ifndef MODEL_QUANTIZED_H
+#define MODEL_QUANTIZED_H
+
+#include "model_engine.h"
+
+#define MODEL_QUANTIZED_NODE_COUNT 2243
+#define MODEL_QUANTIZED_Q_BITS 16
+// logit(0.540) = 0.160342650
+#define MODEL_QUANTIZED_LOGIT_THRESHOLD 10509
+
+static const float MODEL_QUANTIZED_SOIL_THRESHOLDS[109] = {
+    252.730637f, 257.416229f, 283.323853f, 296.413544f, 314.835846f, 321.81543f, 330.207428f, 341.632965f,
+    345.389679f, 349.312317f, 351.355896f, 359.514069f, 363.807678f, 367.197571f, 375.313019f, 386.113647f,
+    397.247711f, 405.567444f, 407.900116f, 414.901276f, 417.264038f, 419.505035f, 423.757202f, 430.821411f,
+    435.861267f, 437.694153f, 440.630371f, 443.64624f, 447.999878f, 450.725037f, 458.729126f, 463.607178f,
+    467.623199f, 471.12204f, 479.104919f, 481.389587f, 484.002502f, 500.492676f, 504.642822f, 519.741882f,
+    527.904602f, 531.149597f, 534.459778f, 538.327454f, 541.012268f, 544.882202f, 552.700989f, 560.389099f,
+    563.617065f, 568.22876f, 571.920654f, 576.561096f, 581.963745f, 585.01825f, 590.554199f, 597.551147f,
+    601.795471f, 604.238281f, 616.029846f, 619.163086f, 622.761047f, 625.170166f, 637.041443f, 638.904846f,
+    645.976685f, 648.651367f, 658.263f, 667.424072f, 688.57074f, 695.823792f, 701.65979f, 710.787048f,
+    718.093689f, 721.237366f, 723.110596f, 726.876038f, 729.404663f, 732.35437f, 734.138062f, 738.240356f,
+    741.785583f, 757.170593f, 763.647339f, 768.336487f, 770.63739f, 775.067749f, 776.132446f, 782.425354f,
+    785.920593f, 790.879639f, 794.703064f, 819.484436f, 822.795776f, 827.341675f, 832.5177f, 839.991638f,
+    841.305298f, 856.504456f, 858.644775f, 862.270081f, 870.471802f, 882.741455f, 892.300537f, 902.922058f,
+    906.185242f, 921.656555f, 939.830566f, 944.020081f, 947.555847f,
+};
+
+static const float MODEL_QUANTIZED_TEMPERATURE_THRESHOLDS[106] = {
+    19.2320633f, 20.0188656f, 20.1292877f, 20.2102623f, 20.3994579f, 20.6348743f, 20.7292194f, 20.7989597f,
+    20.8813152f, 21.0124493f, 21.1400452f, 21.2505245f, 21.3451176f, 21.4206963f, 22.2793179f, 22.5222015f,
+    22.5935783f, 22.6435928f, 22.7132282f, 22.9432659f, 23.2289524f, 23.5818996f, 23.9091587f, 24.0817528f,
+    24.2286224f, 24.3926964f, 24.7294979f, 24.8134098f, 24.8679314f, 24.9743233f, 25.0434551f, 25.1329422f,
+    25.2266598f, 25.3599434f, 25.5413857f, 25.6510048f, 25.7303886f, 25.9988403f, 26.1693649f, 26.2437935f,
+    26.3607903f, 26.7441292f, 27.5947475f, 27.744463f, 28.2634487f, 28.5101128f, 28.5788841f, 28.6260338f,
+    28.8836689f, 28.9362946f, 29.6646404f, 29.7018929f, 29.7924881f, 30.0575085f, 30.1104145f, 30.2116146f,
+    30.2948437f, 30.384491f, 30.5218792f, 30.6314411f, 30.7131329f, 30.8253994f, 30.8926163f, 31.1099033f,
+    31.3860989f, 31.5423393f, 31.5958576f, 31.9208717f, 32.1663895f, 32.2109337f, 32.3084106f, 32.5350685f,
+    32.6003685f, 32.6594925f, 32.8193092f, 33.2605438f, 33.3304367f, 33.4218636f, 33.5487595f, 33.7817535f,
+    33.8789864f, 34.1479378f, 34.6546669f, 34.8325424f, 34.8576279f, 34.9676857f, 35.1345978f, 35.2870636f,
+    35.3305435f, 35.5903358f, 36.1142883f, 36.2934189f, 36.5741768f, 36.8433037f, 37.0409698f, 37.1719971f,
+    37.4105377f, 37.7319069f, 37.8016739f, 38.1835022f, 38.3000298f, 38.3529434f, 38.5422096f, 38.9004784f,
+    38.9854584f, 39.1129875f,
+};
+
+static const float MODEL_QUANTIZED_HUMIDITY_THRESHOLDS[122] = {
+    40.0642738f, 40.3054695f, 40.4365158f, 40.996048f, 41.4611816f, 41.6887894f, 41.8031082f, 42.1177483f,
+    42.3556175f, 42.4820442f, 42.7032928f, 43.2635002f, 43.5045547f, 43.9408569f, 44.4773293f, 44.8780136f,
+    45.089489f, 45.686657f, 45.7290306f, 45.8896484f, 46.0391083f, 46.442112f, 46.7297173f, 46.8502693f,
+    47.0088196f, 47.1228828f, 48.0908966f, 48.2610779f, 48.5084915f, 49.2791176f, 49.6210556f, 49.6859665f,
+    50.2390213f, 50.8559914f, 51.1242714f, 51.3940468f, 51.5628548f, 51.6752129f, 51.8712692f, 52.2610207f,
+    52.7929726f, 52.9265976f, 53.4475784f, 53.7436066f, 54.2410927f, 54.3874397f, 54.5997162f, 54.9958763f,
+    55.1740875f, 55.3870468f, 55.5911179f, 55.9880295f, 56.2749748f, 56.4054871f, 56.715847f, 57.2381172f,
+    57.5607338f, 57.7745628f, 57.912468f, 58.0878334f, 58.2117615f, 58.3609047f, 58.911232f, 59.2451096f,
+    59.4178658f, 59.7402267f, 60.7390938f, 61.101387f, 61.2290306f, 61.4699364f, 61.7001305f, 61.8882256f,
+    62.0385475f, 62.1497269f, 62.6410065f, 62.937542f, 63.2933426f, 63.4145584f, 63.751545f, 65.1251373f,
+    65.2610092f, 65.4638367f, 65.8288727f, 66.0044632f, 66.1435776f, 66.7874527f, 67.8146362f, 67.9678268f,
+    68.1291199f, 68.5820541f, 69.0979462f, 69.243866f, 69.2937241f, 69.4708176f, 70.4786758f, 70.602066f,
+    71.1944275f, 71.6289825f, 72.2822266f, 72.4277267f, 72.5990067f, 72.9267349f, 73.2763596f, 73.4998932f,
+    73.7191849f, 73.8990784f, 74.1281662f, 74.5640182f, 76.1152267f, 76.4636459f, 77.484726f, 77.688858f,
+    78.0548477f, 78.5994492f, 78.6886444f, 78.805069f, 79.2100067f, 79.6292648f, 79.7098465f, 80.5668564f,
+    81.2489395f, 82.4489441f,
+};
+
+// Node: { feature, bin, value } - value là node con phải (split) hoặc lá Q16
+static const ModelQuantNode MODEL_QUANTIZED_NODES[MODEL_QUANTIZED_NODE_COUNT] = {
+    { 0, 38, 32 },
+    { 0, 19, 13 },
+    { 0, 4, 4 },
+    { 255, 0, -17857 },
+    { 1, 101, 10 },
+    { 1, 3, 7 },
+    { 255, 0, 842 },
+    { 1, 66, 9 },
+    { 255, 0, -14688 },
+    { 255, 0, -10457 },
+    { 2, 61, 12 },
+    { 255, 0, 7986 },
+    { 255, 0, -7659 },
+    { 1, 74, 21 },
+    { 2, 28, 20 },
+    { 0, 27, 19 },
+    { 0, 25, 18 },
+    { 255, 0, -5106 },
+    { 255, 0, 7986 },
+    { 255, 0, -11686 },
+    { 255, 0, -15611 },
+    { 2, 71, 27 },
+    { 1, 95, 26 },
+    { 2, 45, 25 },
+    { 255, 0, 9652 },
+    { 255, 0, 21 },
+    { 255, 0, 13543 },
+    { 1, 82, 29 },
+    { 255, 0, -13372 },
+    { 2, 96, 31 },
+    { 255, 0, 6612 },
+    { 255, 0, -990 },
+    { 0, 61, 56 },
+    { 1, 70, 47 },
+    { 2, 78, 42 },
+    { 0, 51, 39 },
+    { 2, 11, 38 },
+    { 255, 0, 6582 },
+    { 255, 0, -6507 },
+    { 2, 49, 41 },
+    { 255, 0, 8529 },
+    { 255, 0, -2935 },
+    { 1, 52, 44 },
+    { 255, 0, -15658 },
+    { 0, 50, 46 },
+    { 255, 0, -8512 },
+    { 255, 0, 9919 },
+    { 1, 89, 55 },
+    { 2, 91, 52 },
+    { 2, 52, 51 },
+    { 255, 0, 12079 },
+    { 255, 0, 6022 },
+    { 0, 49, 54 },
+    { 255, 0, -7659 },
+    { 255, 0, 2869 },
+    { 255, 0, 13990 },
+    { 1, 18, 70 },
+    { 0, 79, 65 },
+    { 2, 49, 62 },
+    { 0, 62, 61 },
+    { 255, 0, 6530 },
+    { 255, 0, -229 },
+    { 2, 109, 64 },
+    { 255, 0, -10007 },
+    { 255, 0, 1090 },
+    { 1, 1, 67 },
+    { 255, 0, -10932 },
+    { 0, 106, 69 },
+    { 255, 0, 10894 },
+    { 255, 0, -3888 },
+    { 0, 84, 78 },
+    { 2, 86, 75 },
+    { 0, 74, 74 },
+    { 255, 0, 14268 },
+    { 255, 0, 9930 },
+    { 1, 47, 77 },
+    { 255, 0, -2525 },
+    { 255, 0, 10717 },
+    { 2, 0, 80 },
+    { 255, 0, -3888 },
+    { 0, 108, 82 },
+    { 255, 0, 14095 },
+    { 255, 0, 993 },
+    { 0, 51, 117 },
+    { 0, 22, 96 },
+    { 0, 4, 87 },
+    { 255, 0, -15525 },
+    { 1, 100, 93 },
+    { 1, 3, 90 },
+    { 255, 0, 784 },
+    { 1, 66, 92 },
+    { 255, 0, -13070 },
+    { 255, 0, -8840 },
+    { 2, 63, 95 },
+    { 255, 0, 7731 },
+    { 255, 0, -7942 },
+    { 1, 79, 108 },
+    { 2, 78, 105 },
+    { 1, 69, 102 },
+    { 2, 11, 101 },
+    { 255, 0, 2829 },
+    { 255, 0, -8702 },
+    { 1, 76, 104 },
+    { 255, 0, 8341 },
+    { 255, 0, -3931 },
+    { 0, 23, 107 },
+    { 255, 0, -4276 },
+    { 255, 0, -13847 },
+    { 2, 53, 110 },
+    { 255, 0, 12256 },
+    { 1, 92, 114 },
+    { 0, 34, 113 },
+    { 255, 0, -11335 },
+    { 255, 0, 1189 },
+    { 2, 119, 116 },
+    { 255, 0, 11381 },
+    { 255, 0, 308 },
+    { 1, 30, 141 },
+    { 0, 79, 134 },
+    { 2, 57, 127 },
+    { 0, 67, 124 },
+    { 0, 62, 123 },
+    { 255, 0, 4056 },
+    { 255, 0, -5907 },
+    { 1, 17, 126 },
+    { 255, 0, 2735 },
+    { 255, 0, 10509 },
+    { 2, 109, 131 },
+    { 2, 82, 130 },
+    { 255, 0, -1925 },
+    { 255, 0, -10272 },
+    { 2, 117, 133 },
+    { 255, 0, 7575 },
+    { 255, 0, -10092 },
+    { 1, 2, 136 },
+    { 255, 0, -8108 },
+    { 0, 108, 140 },
+    { 0, 99, 139 },
+    { 255, 0, 9091 },
+    { 255, 0, 12397 },
+    { 255, 0, -5183 },
+    { 0, 61, 151 },
+    { 1, 57, 150 },
+    { 2, 59, 147 },
+    { 1, 49, 146 },
+    { 255, 0, 10884 },
+    { 255, 0, 427 },
+    { 2, 67, 149 },
+    { 255, 0, -873 },
+    { 255, 0, -9806 },
+    { 255, 0, 11762 },
+    { 2, 0, 153 },
+    { 255, 0, -1136 },
+    { 2, 92, 157 },
+    { 0, 108, 156 },
+    { 255, 0, 12637 },
+    { 255, 0, 773 },
+    { 0, 78, 159 },
+    { 255, 0, 4559 },
+    { 255, 0, 12415 },
+    { 0, 45, 196 },
+    { 0, 19, 177 },
+    { 0, 4, 164 },
+    { 255, 0, -13943 },
+    { 2, 74, 170 },
+    { 2, 71, 169 },
+    { 1, 100, 168 },
+    { 255, 0, -8645 },
+    { 255, 0, 2274 },
+    { 255, 0, 6854 },
+    { 0, 18, 174 },
+    { 1, 101, 173 },
+    { 255, 0, -12711 },
+    { 255, 0, -4247 },
+    { 2, 95, 176 },
+    { 255, 0, -8301 },
+    { 255, 0, 2321 },
+    { 1, 81, 187 },
+    { 2, 72, 186 },
+    { 1, 69, 183 },
+    { 2, 15, 182 },
+    { 255, 0, -1077 },
+    { 255, 0, -9768 },
+    { 0, 28, 185 },
+    { 255, 0, -3003 },
+    { 255, 0, 8355 },
+    { 255, 0, -12458 },
+    { 2, 63, 189 },
+    { 255, 0, 10572 },
+    { 1, 101, 193 },
+    { 0, 34, 192 },
+    { 255, 0, -6809 },
+    { 255, 0, 1429 },
+    { 0, 27, 195 },
+    { 255, 0, 3206 },
+    { 255, 0, 10380 },
+    { 0, 61, 218 },
+    { 1, 63, 211 },
+    { 2, 41, 204 },
+    { 1, 23, 201 },
+    { 255, 0, 9887 },
+    { 1, 26, 203 },
+    { 255, 0, -7824 },
+    { 255, 0, 5836 },
+    { 1, 43, 208 },
+    { 1, 21, 207 },
+    { 255, 0, -13600 },
+    { 255, 0, -7176 },
+    { 2, 73, 210 },
+    { 255, 0, 3940 },
+    { 255, 0, -7887 },
+    { 1, 78, 217 },
+    { 0, 50, 216 },
+    { 0, 48, 215 },
+    { 255, 0, 5654 },
+    { 255, 0, -5568 },
+    { 255, 0, 9031 },
+    { 255, 0, 11543 },
+    { 1, 18, 232 },
+    { 0, 88, 227 },
+    { 2, 53, 224 },
+    { 1, 14, 223 },
+    { 255, 0, 5851 },
+    { 255, 0, -4345 },
+    { 0, 79, 226 },
+    { 255, 0, -5577 },
+    { 255, 0, 405 },
+    { 1, 2, 229 },
+    { 255, 0, -4724 },
+    { 0, 106, 231 },
+    { 255, 0, 10521 },
+    { 255, 0, -3267 },
+    { 0, 84, 240 },
+    { 2, 86, 237 },
+    { 0, 74, 236 },
+    { 255, 0, 11908 },
+    { 255, 0, 7749 },
+    { 1, 47, 239 },
+    { 255, 0, -2574 },
+    { 255, 0, 8892 },
+    { 2, 0, 242 },
+    { 255, 0, -3542 },
+    { 0, 108, 244 },
+    { 255, 0, 11628 },
+    { 255, 0, 733 },
+    { 0, 38, 289 },
+    { 0, 19, 266 },
+    { 0, 4, 253 },
+    { 2, 7, 252 },
+    { 1, 91, 251 },
+    { 255, 0, -10849 },
+    { 255, 0, 4265 },
+    { 255, 0, -12981 },
+    { 2, 74, 259 },
+    { 2, 71, 258 },
+    { 0, 6, 257 },
+    { 255, 0, -145 },
+    { 255, 0, -7970 },
+    { 255, 0, 6330 },
+    { 0, 18, 263 },
+    { 1, 101, 262 },
+    { 255, 0, -11487 },
+    { 255, 0, -3942 },
+    { 1, 58, 265 },
+    { 255, 0, -7827 },
+    { 255, 0, 2187 },
+    { 1, 79, 278 },
+    { 2, 43, 275 },
+    { 1, 53, 272 },
+    { 1, 15, 271 },
+    { 255, 0, 1236 },
+    { 255, 0, -12165 },
+    { 2, 22, 274 },
+    { 255, 0, -2949 },
+    { 255, 0, 4520 },
+    { 1, 75, 277 },
+    { 255, 0, -11245 },
+    { 255, 0, -2497 },
+    { 2, 96, 286 },
+    { 1, 95, 283 },
+    { 2, 45, 282 },
+    { 255, 0, 7927 },
+    { 255, 0, -820 },
+    { 0, 21, 285 },
+    { 255, 0, 3473 },
+    { 255, 0, 11100 },
+    { 0, 35, 288 },
+    { 255, 0, -8852 },
+    { 255, 0, 4567 },
+    { 0, 61, 311 },
+    { 1, 70, 304 },
+    { 2, 78, 299 },
+    { 0, 52, 296 },
+    { 2, 9, 295 },
+    { 255, 0, 7368 },
+    { 255, 0, -4008 },
+    { 2, 49, 298 },
+    { 255, 0, 7270 },
+    { 255, 0, -2590 },
+    { 1, 52, 301 },
+    { 255, 0, -11575 },
+    { 0, 50, 303 },
+    { 255, 0, -5881 },
+    { 255, 0, 8683 },
+    { 2, 82, 306 },
+    { 255, 0, 10613 },
+    { 1, 92, 310 },
+    { 0, 44, 309 },
+    { 255, 0, -7747 },
+    { 255, 0, 3279 },
+    { 255, 0, 10192 },
+    { 1, 18, 325 },
+    { 0, 88, 320 },
+    { 2, 39, 317 },
+    { 0, 74, 316 },
+    { 255, 0, -921 },
+    { 255, 0, 9168 },
+    { 0, 81, 319 },
+    { 255, 0, -978 },
+    { 255, 0, -7985 },
+    { 1, 2, 322 },
+    { 255, 0, -4379 },
+    { 0, 106, 324 },
+    { 255, 0, 9674 },
+    { 255, 0, -3047 },
+    { 1, 88, 333 },
+    { 0, 83, 330 },
+    { 2, 92, 329 },
+    { 255, 0, 9245 },
+    { 255, 0, 1683 },
+    { 0, 108, 332 },
+    { 255, 0, 10184 },
+    { 255, 0, -3969 },
+    { 255, 0, 11408 },
+    { 0, 45, 384 },
+    { 0, 22, 355 },
+    { 0, 4, 344 },
+    { 1, 100, 339 },
+    { 255, 0, -12228 },
+    { 2, 9, 341 },
+    { 255, 0, 4485 },
+    { 0, 2, 343 },
+    { 255, 0, -11001 },
+    { 255, 0, -2215 },
+    { 1, 100, 350 },
+    { 1, 3, 347 },
+    { 255, 0, 1840 },
+    { 1, 66, 349 },
+    { 255, 0, -9888 },
+    { 255, 0, -5981 },
+    { 2, 61, 352 },
+    { 255, 0, 8621 },
+    { 1, 104, 354 },
+    { 255, 0, 1636 },
+    { 255, 0, -9753 },
+    { 1, 71, 369 },
+    { 2, 15, 362 },
+    { 2, 3, 359 },
+    { 255, 0, -6293 },
+    { 1, 24, 361 },
+    { 255, 0, 6842 },
+    { 255, 0, -970 },
+    { 1, 51, 366 },
+    { 1, 7, 365 },
+    { 255, 0, -3491 },
+    { 255, 0, -10471 },
+    { 1, 64, 368 },
+    { 255, 0, 725 },
+    { 255, 0, -9471 },
+    { 2, 72, 377 },
+    { 2, 45, 374 },
+    { 2, 4, 373 },
+    { 255, 0, 2341 },
+    { 255, 0, 10158 },
+    { 2, 56, 376 },
+    { 255, 0, 926 },
+    { 255, 0, 7851 },
+    { 1, 92, 381 },
+    { 1, 87, 380 },
+    { 255, 0, -10226 },
+    { 255, 0, -1501 },
+    { 0, 35, 383 },
+    { 255, 0, 911 },
+    { 255, 0, 9411 },
+    { 1, 43, 406 },
+    { 0, 79, 399 },
+    { 2, 41, 392 },
+    { 1, 35, 391 },
+    { 0, 52, 390 },
+    { 255, 0, -623 },
+    { 255, 0, 6314 },
+    { 255, 0, 10536 },
+    { 0, 61, 396 },
+    { 1, 21, 395 },
+    { 255, 0, -11769 },
+    { 255, 0, -5610 },
+    { 2, 82, 398 },
+    { 255, 0, 1713 },
+    { 255, 0, -5347 },
+    { 1, 1, 401 },
+    { 255, 0, -8942 },
+    { 0, 108, 405 },
+    { 1, 12, 404 },
+    { 255, 0, 5534 },
+    { 255, 0, 9348 },
+    { 255, 0, -1756 },
+    { 1, 88, 420 },
+    { 0, 60, 415 },
+    { 2, 78, 412 },
+    { 1, 63, 411 },
+    { 255, 0, 2491 },
+    { 255, 0, 8082 },
+    { 1, 52, 414 },
+    { 255, 0, -9556 },
+    { 255, 0, 3188 },
+    { 2, 0, 417 },
+    { 255, 0, -1824 },
+    { 1, 83, 419 },
+    { 255, 0, 9071 },
+    { 255, 0, 4480 },
+    { 255, 0, 10747 },
+    { 0, 38, 453 },
+    { 0, 4, 428 },
+    { 2, 7, 427 },
+    { 1, 91, 426 },
+    { 255, 0, -9458 },
+    { 255, 0, 4123 },
+    { 255, 0, -11452 },
+    { 1, 66, 438 },
+    { 1, 0, 431 },
+    { 255, 0, 8284 },
+    { 0, 6, 435 },
+    { 2, 90, 434 },
+    { 255, 0, -257 },
+    { 255, 0, -8401 },
+    { 2, 1, 437 },
+    { 255, 0, -1996 },
+    { 255, 0, -9639 },
+    { 0, 20, 446 },
+    { 1, 80, 443 },
+    { 1, 76, 442 },
+    { 255, 0, -1889 },
+    { 255, 0, 5665 },
+    { 1, 101, 445 },
+    { 255, 0, -9041 },
+    { 255, 0, 349 },
+    { 1, 82, 450 },
+    { 2, 66, 449 },
+    { 255, 0, 3081 },
+    { 255, 0, -10374 },
+    { 2, 45, 452 },
+    { 255, 0, 9958 },
+    { 255, 0, 2887 },
+    { 0, 61, 479 },
+    { 1, 70, 470 },
+    { 2, 78, 463 },
+    { 2, 9, 460 },
+    { 0, 56, 459 },
+    { 255, 0, 8111 },
+    { 255, 0, 457 },
+    { 0, 52, 462 },
+    { 255, 0, -3073 },
+    { 255, 0, 2618 },
+    { 1, 52, 467 },
+    { 0, 56, 466 },
+    { 255, 0, -11203 },
+    { 255, 0, -5147 },
+    { 2, 87, 469 },
+    { 255, 0, -7709 },
+    { 255, 0, 6389 },
+    { 1, 89, 478 },
+    { 2, 91, 475 },
+    { 0, 42, 474 },
+    { 255, 0, 2555 },
+    { 255, 0, 7986 },
+    { 2, 110, 477 },
+    { 255, 0, -5962 },
+    { 255, 0, 1385 },
+    { 255, 0, 9786 },
+    { 1, 18, 493 },
+    { 0, 88, 486 },
+    { 2, 115, 485 },
+    { 2, 109, 484 },
+    { 255, 0, -1158 },
+    { 255, 0, 7494 },
+    { 255, 0, -8068 },
+    { 2, 23, 490 },
+    { 0, 93, 489 },
+    { 255, 0, 6396 },
+    { 255, 0, -4598 },
+    { 1, 2, 492 },
+    { 255, 0, -2758 },
+    { 255, 0, 9319 },
+    { 1, 88, 501 },
+    { 0, 83, 498 },
+    { 2, 86, 497 },
+    { 255, 0, 8180 },
+    { 255, 0, 1237 },
+    { 0, 108, 500 },
+    { 255, 0, 8894 },
+    { 255, 0, -3915 },
+    { 255, 0, 10064 },
+    { 0, 35, 534 },
+    { 0, 4, 511 },
+    { 1, 100, 506 },
+    { 255, 0, -11036 },
+    { 2, 9, 508 },
+    { 255, 0, 4309 },
+    { 0, 2, 510 },
+    { 255, 0, -9815 },
+    { 255, 0, -1296 },
+    { 1, 101, 527 },
+    { 2, 54, 520 },
+    { 1, 67, 517 },
+    { 1, 0, 516 },
+    { 255, 0, 7779 },
+    { 255, 0, -7975 },
+    { 0, 22, 519 },
+    { 255, 0, -2217 },
+    { 255, 0, 5274 },
+    { 2, 83, 524 },
+    { 0, 32, 523 },
+    { 255, 0, -6987 },
+    { 255, 0, 446 },
+    { 0, 5, 526 },
+    { 255, 0, -3738 },
+    { 255, 0, -9445 },
+    { 1, 105, 529 },
+    { 255, 0, 8634 },
+    { 2, 57, 531 },
+    { 255, 0, 7870 },
+    { 0, 16, 533 },
+    { 255, 0, -8128 },
+    { 255, 0, -765 },
+    { 0, 54, 556 },
+    { 1, 81, 549 },
+    { 2, 78, 544 },
+    { 1, 41, 541 },
+    { 2, 38, 540 },
+    { 255, 0, -1301 },
+    { 255, 0, -8856 },
+    { 0, 47, 543 },
+    { 255, 0, 3737 },
+    { 255, 0, -2356 },
+    { 1, 56, 546 },
+    { 255, 0, -10735 },
+    { 1, 64, 548 },
+    { 255, 0, 5516 },
+    { 255, 0, -8637 },
+    { 1, 92, 555 },
+    { 2, 62, 552 },
+    { 255, 0, 7848 },
+    { 2, 95, 554 },
+    { 255, 0, -11028 },
+    { 255, 0, 5018 },
+    { 255, 0, 10139 },
+    { 1, 30, 572 },
+    { 0, 74, 565 },
+    { 2, 57, 562 },
+    { 0, 67, 561 },
+    { 255, 0, 177 },
+    { 255, 0, 6727 },
+    { 1, 4, 564 },
+    { 255, 0, 4534 },
+    { 255, 0, -6489 },
+    { 1, 2, 569 },
+    { 2, 82, 568 },
+    { 255, 0, -8931 },
+    { 255, 0, -2172 },
+    { 0, 108, 571 },
+    { 255, 0, 6927 },
+    { 255, 0, -4374 },
+    { 1, 88, 580 },
+    { 2, 92, 577 },
+    { 1, 86, 576 },
+    { 255, 0, 8132 },
+    { 255, 0, -3334 },
+    { 0, 77, 579 },
+    { 255, 0, -682 },
+    { 255, 0, 8150 },
+    { 255, 0, 9659 },
+    { 0, 35, 609 },
+    { 0, 4, 590 },
+    { 1, 100, 585 },
+    { 255, 0, -10603 },
+    { 2, 9, 587 },
+    { 255, 0, 3982 },
+    { 0, 2, 589 },
+    { 255, 0, -9379 },
+    { 255, 0, -1210 },
+    { 1, 101, 604 },
+    { 2, 54, 599 },
+    { 1, 67, 596 },
+    { 1, 0, 595 },
+    { 255, 0, 7333 },
+    { 255, 0, -7304 },
+    { 2, 10, 598 },
+    { 255, 0, -7360 },
+    { 255, 0, 2188 },
+    { 2, 112, 603 },
+    { 2, 110, 602 },
+    { 255, 0, -6970 },
+    { 255, 0, 3944 },
+    { 255, 0, -10536 },
+    { 2, 108, 608 },
+    { 0, 15, 607 },
+    { 255, 0, 351 },
+    { 255, 0, 8120 },
+    { 255, 0, -3576 },
+    { 0, 61, 635 },
+    { 1, 59, 626 },
+    { 2, 50, 619 },
+    { 0, 52, 616 },
+    { 2, 11, 615 },
+    { 255, 0, 2325 },
+    { 255, 0, -4276 },
+    { 0, 59, 618 },
+    { 255, 0, 7105 },
+    { 255, 0, -2136 },
+    { 2, 78, 623 },
+    { 2, 64, 622 },
+    { 255, 0, -9009 },
+    { 255, 0, 1864 },
+    { 0, 56, 625 },
+    { 255, 0, -10407 },
+    { 255, 0, -3189 },
+    { 1, 87, 634 },
+    { 0, 50, 631 },
+    { 0, 48, 630 },
+    { 255, 0, 1493 },
+    { 255, 0, -7723 },
+    { 2, 93, 633 },
+    { 255, 0, 8275 },
+    { 255, 0, 2757 },
+    { 255, 0, 9001 },
+    { 1, 30, 649 },
+    { 0, 79, 644 },
+    { 2, 57, 641 },
+    { 1, 11, 640 },
+    { 255, 0, -2774 },
+    { 255, 0, 6203 },
+    { 1, 24, 643 },
+    { 255, 0, -1045 },
+    { 255, 0, -9657 },
+    { 1, 1, 646 },
+    { 255, 0, -7843 },
+    { 0, 108, 648 },
+    { 255, 0, 6659 },
+    { 255, 0, -4059 },
+    { 2, 0, 651 },
+    { 255, 0, -2846 },
+    { 0, 89, 655 },
+    { 2, 86, 654 },
+    { 255, 0, 8406 },
+    { 255, 0, 3152 },
+    { 0, 108, 657 },
+    { 255, 0, 8925 },
+    { 255, 0, 973 },
+    { 0, 45, 688 },
+    { 0, 4, 665 },
+    { 2, 7, 664 },
+    { 1, 91, 663 },
+    { 255, 0, -7998 },
+    { 255, 0, 4101 },
+    { 255, 0, -10129 },
+    { 1, 68, 675 },
+    { 1, 0, 668 },
+    { 255, 0, 6935 },
+    { 2, 73, 672 },
+    { 2, 69, 671 },
+    { 255, 0, -5585 },
+    { 255, 0, 6522 },
+    { 1, 57, 674 },
+    { 255, 0, -9023 },
+    { 255, 0, -4223 },
+    { 0, 18, 681 },
+    { 1, 72, 678 },
+    { 255, 0, 9156 },
+    { 2, 44, 680 },
+    { 255, 0, -2269 },
+    { 255, 0, -7810 },
+    { 2, 72, 685 },
+    { 1, 95, 684 },
+    { 255, 0, 3327 },
+    { 255, 0, 9339 },
+    { 1, 77, 687 },
+    { 255, 0, -8184 },
+    { 255, 0, 972 },
+    { 1, 43, 710 },
+    { 0, 79, 703 },
+    { 2, 41, 696 },
+    { 2, 34, 695 },
+    { 2, 29, 694 },
+    { 255, 0, 4956 },
+    { 255, 0, -2014 },
+    { 255, 0, 9574 },
+    { 1, 40, 700 },
+    { 0, 55, 699 },
+    { 255, 0, -9092 },
+    { 255, 0, -1392 },
+    { 0, 50, 702 },
+    { 255, 0, -1760 },
+    { 255, 0, -12021 },
+    { 1, 1, 705 },
+    { 255, 0, -7407 },
+    { 0, 108, 709 },
+    { 1, 12, 708 },
+    { 255, 0, 3557 },
+    { 255, 0, 7254 },
+    { 255, 0, -1281 },
+    { 1, 90, 724 },
+    { 0, 61, 719 },
+    { 2, 78, 716 },
+    { 1, 49, 715 },
+    { 255, 0, 9084 },
+    { 255, 0, 2023 },
+    { 2, 119, 718 },
+    { 255, 0, -4685 },
+    { 255, 0, 7108 },
+    { 2, 2, 721 },
+    { 255, 0, -1878 },
+    { 0, 91, 723 },
+    { 255, 0, 5510 },
+    { 255, 0, 8580 },
+    { 255, 0, 9127 },
+    { 0, 35, 755 },
+    { 0, 4, 734 },
+    { 1, 100, 729 },
+    { 255, 0, -9961 },
+    { 0, 0, 731 },
+    { 255, 0, -8616 },
+    { 2, 48, 733 },
+    { 255, 0, 6764 },
+    { 255, 0, -5598 },
+    { 1, 101, 748 },
+    { 2, 83, 743 },
+    { 1, 67, 740 },
+    { 1, 15, 739 },
+    { 255, 0, 212 },
+    { 255, 0, -6602 },
+    { 2, 53, 742 },
+    { 255, 0, 687 },
+    { 255, 0, -4538 },
+    { 0, 23, 747 },
+    { 0, 18, 746 },
+    { 255, 0, -7794 },
+    { 255, 0, -572 },
+    { 255, 0, -9973 },
+    { 1, 105, 750 },
+    { 255, 0, 7815 },
+    { 2, 57, 752 },
+    { 255, 0, 6992 },
+    { 0, 16, 754 },
+    { 255, 0, -7195 },
+    { 255, 0, -1155 },
+    { 1, 88, 783 },
+    { 0, 53, 770 },
+    { 2, 78, 765 },
+    { 1, 41, 762 },
+    { 2, 15, 761 },
+    { 255, 0, 1363 },
+    { 255, 0, -5801 },
+    { 0, 47, 764 },
+    { 255, 0, 3721 },
+    { 255, 0, -2419 },
+    { 1, 56, 767 },
+    { 255, 0, -9411 },
+    { 1, 64, 769 },
+    { 255, 0, 5346 },
+    { 255, 0, -6545 },
+    { 0, 84, 778 },
+    { 2, 84, 775 },
+    { 1, 22, 774 },
+    { 255, 0, 932 },
+    { 255, 0, 5855 },
+    { 1, 52, 777 },
+    { 255, 0, -3130 },
+    { 255, 0, 5098 },
+    { 0, 108, 782 },
+    { 1, 9, 781 },
+    { 255, 0, -1336 },
+    { 255, 0, 7128 },
+    { 255, 0, -4298 },
+    { 255, 0, 8489 },
+    { 0, 34, 810 },
+    { 0, 4, 793 },
+    { 1, 100, 788 },
+    { 255, 0, -9709 },
+    { 0, 0, 790 },
+    { 255, 0, -8306 },
+    { 2, 48, 792 },
+    { 255, 0, 6126 },
+    { 255, 0, -5366 },
+    { 1, 101, 803 },
+    { 2, 80, 800 },
+    { 2, 79, 799 },
+    { 1, 3, 798 },
+    { 255, 0, 4440 },
+    { 255, 0, -3546 },
+    { 255, 0, 4397 },
+    { 0, 5, 802 },
+    { 255, 0, -1793 },
+    { 255, 0, -7432 },
+    { 2, 108, 809 },
+    { 1, 105, 806 },
+    { 255, 0, 8463 },
+    { 2, 57, 808 },
+    { 255, 0, 6669 },
+    { 255, 0, -3563 },
+    { 255, 0, -3347 },
+    { 1, 88, 842 },
+    { 0, 61, 827 },
+    { 2, 52, 820 },
+    { 1, 35, 817 },
+    { 1, 23, 816 },
+    { 255, 0, 725 },
+    { 255, 0, -6082 },
+    { 2, 35, 819 },
+    { 255, 0, 2561 },
+    { 255, 0, 8173 },
+    { 1, 59, 824 },
+    { 0, 56, 823 },
+    { 255, 0, -7257 },
+    { 255, 0, -2156 },
+    { 1, 66, 826 },
+    { 255, 0, 5739 },
+    { 255, 0, -1812 },
+    { 1, 18, 835 },
+    { 0, 88, 832 },
+    { 2, 115, 831 },
+    { 255, 0, -269 },
+    { 255, 0, -8438 },
+    { 2, 23, 834 },
+    { 255, 0, -1994 },
+    { 255, 0, 6536 },
+    { 2, 92, 839 },
+    { 1, 86, 838 },
+    { 255, 0, 6399 },
+    { 255, 0, -4588 },
+    { 0, 72, 841 },
+    { 255, 0, -2284 },
+    { 255, 0, 6190 },
+    { 255, 0, 8063 },
+    { 0, 22, 861 },
+    { 0, 3, 846 },
+    { 255, 0, -9361 },
+    { 1, 102, 856 },
+    { 2, 14, 849 },
+    { 255, 0, -9742 },
+    { 2, 77, 853 },
+    { 2, 71, 852 },
+    { 255, 0, -3288 },
+    { 255, 0, 5539 },
+    { 0, 13, 855 },
+    { 255, 0, -8625 },
+    { 255, 0, -3154 },
+    { 2, 61, 858 },
+    { 255, 0, 10110 },
+    { 1, 104, 860 },
+    { 255, 0, 297 },
+    { 255, 0, -8043 },
+    { 0, 54, 887 },
+    { 1, 79, 876 },
+    { 2, 80, 871 },
+    { 2, 11, 868 },
+    { 2, 3, 867 },
+    { 255, 0, -146 },
+    { 255, 0, 6258 },
+    { 2, 21, 870 },
+    { 255, 0, -8445 },
+    { 255, 0, -1343 },
+    { 2, 105, 875 },
+    { 2, 100, 874 },
+    { 255, 0, -6367 },
+    { 255, 0, 3818 },
+    { 255, 0, -9039 },
+    { 2, 45, 880 },
+    { 2, 4, 879 },
+    { 255, 0, 1671 },
+    { 255, 0, 9143 },
+    { 1, 96, 884 },
+    { 0, 33, 883 },
+    { 255, 0, -6943 },
+    { 255, 0, 647 },
+    { 2, 114, 886 },
+    { 255, 0, 7765 },
+    { 255, 0, 1772 },
+    { 1, 30, 901 },
+    { 0, 69, 894 },
+    { 1, 4, 891 },
+    { 255, 0, 8634 },
+    { 0, 57, 893 },
+    { 255, 0, 8066 },
+    { 255, 0, -5884 },
+    { 1, 2, 898 },
+    { 2, 87, 897 },
+    { 255, 0, -8553 },
+    { 255, 0, -2003 },
+    { 2, 117, 900 },
+    { 255, 0, 4926 },
+    { 255, 0, -575 },
+    { 1, 88, 909 },
+    { 2, 92, 906 },
+    { 1, 86, 905 },
+    { 255, 0, 6013 },
+    { 255, 0, -4172 },
+    { 0, 89, 908 },
+    { 255, 0, -44 },
+    { 255, 0, 7228 },
+    { 255, 0, 7826 },
+    { 0, 22, 936 },
+    { 0, 3, 917 },
+    { 2, 6, 916 },
+    { 1, 73, 915 },
+    { 255, 0, -5432 },
+    { 255, 0, -169 },
+    { 255, 0, -9321 },
+    { 1, 67, 927 },
+    { 2, 27, 920 },
+    { 255, 0, -9147 },
+    { 2, 73, 924 },
+    { 0, 17, 923 },
+    { 255, 0, 1234 },
+    { 255, 0, -7102 },
+    { 1, 57, 926 },
+    { 255, 0, -8254 },
+    { 255, 0, -2164 },
+    { 1, 72, 929 },
+    { 255, 0, 7794 },
+    { 0, 18, 933 },
+    { 2, 48, 932 },
+    { 255, 0, -820 },
+    { 255, 0, -6770 },
+    { 2, 58, 935 },
+    { 255, 0, -3433 },
+    { 255, 0, 5322 },
+    { 0, 61, 966 },
+    { 1, 79, 953 },
+    { 2, 50, 946 },
+    { 2, 36, 943 },
+    { 2, 31, 942 },
+    { 255, 0, 993 },
+    { 255, 0, -12010 },
+    { 2, 41, 945 },
+    { 255, 0, 9664 },
+    { 255, 0, 1234 },
+    { 2, 64, 950 },
+    { 1, 64, 949 },
+    { 255, 0, -8609 },
+    { 255, 0, -2235 },
+    { 2, 66, 952 },
+    { 255, 0, 6889 },
+    { 255, 0, -4439 },
+    { 2, 53, 959 },
+    { 2, 3, 956 },
+    { 255, 0, 1321 },
+    { 0, 24, 958 },
+    { 255, 0, 2173 },
+    { 255, 0, 8589 },
+    { 1, 92, 963 },
+    { 0, 43, 962 },
+    { 255, 0, -4694 },
+    { 255, 0, 3381 },
+    { 2, 119, 965 },
+    { 255, 0, 7166 },
+    { 255, 0, -768 },
+    { 1, 45, 980 },
+    { 0, 80, 975 },
+    { 2, 82, 972 },
+    { 0, 71, 971 },
+    { 255, 0, 4465 },
+    { 255, 0, -1009 },
+    { 1, 37, 974 },
+    { 255, 0, -1211 },
+    { 255, 0, -11354 },
+    { 1, 1, 977 },
+    { 255, 0, -6736 },
+    { 0, 108, 979 },
+    { 255, 0, 5499 },
+    { 255, 0, -3258 },
+    { 2, 2, 982 },
+    { 255, 0, -4539 },
+    { 0, 91, 986 },
+    { 0, 73, 985 },
+    { 255, 0, 7164 },
+    { 255, 0, 2663 },
+    { 0, 107, 988 },
+    { 255, 0, 7879 },
+    { 255, 0, 2584 },
+    { 0, 35, 1011 },
+    { 0, 4, 998 },
+    { 1, 100, 993 },
+    { 255, 0, -9165 },
+    { 0, 0, 995 },
+    { 255, 0, -7410 },
+    { 2, 25, 997 },
+    { 255, 0, 3983 },
+    { 255, 0, -804 },
+    { 2, 112, 1010 },
+    { 1, 101, 1005 },
+    { 2, 110, 1004 },
+    { 0, 6, 1003 },
+    { 255, 0, 2342 },
+    { 255, 0, -3436 },
+    { 255, 0, 5696 },
+    { 1, 105, 1007 },
+    { 255, 0, 8186 },
+    { 2, 57, 1009 },
+    { 255, 0, 5927 },
+    { 255, 0, -3186 },
+    { 255, 0, -9190 },
+    { 1, 88, 1039 },
+    { 0, 53, 1026 },
+    { 2, 78, 1021 },
+    { 0, 47, 1018 },
+    { 0, 45, 1017 },
+    { 255, 0, -719 },
+    { 255, 0, 7751 },
+    { 2, 12, 1020 },
+    { 255, 0, 3185 },
+    { 255, 0, -8588 },
+    { 1, 56, 1023 },
+    { 255, 0, -8457 },
+    { 1, 64, 1025 },
+    { 255, 0, 5159 },
+    { 255, 0, -5270 },
+    { 0, 84, 1034 },
+    { 2, 42, 1031 },
+    { 0, 76, 1030 },
+    { 255, 0, 6028 },
+    { 255, 0, 385 },
+    { 1, 57, 1033 },
+    { 255, 0, -1426 },
+    { 255, 0, 5295 },
+    { 2, 2, 1036 },
+    { 255, 0, -5265 },
+    { 1, 9, 1038 },
+    { 255, 0, -2112 },
+    { 255, 0, 5683 },
+    { 1, 93, 1047 },
+    { 2, 85, 1042 },
+    { 255, 0, 7599 },
+    { 0, 88, 1046 },
+    { 0, 50, 1045 },
+    { 255, 0, 1496 },
+    { 255, 0, -6497 },
+    { 255, 0, 6632 },
+    { 255, 0, 8110 },
+    { 0, 22, 1074 },
+    { 0, 3, 1055 },
+    { 2, 6, 1054 },
+    { 1, 62, 1053 },
+    { 255, 0, -4694 },
+    { 255, 0, -303 },
+    { 255, 0, -9017 },
+    { 1, 67, 1065 },
+    { 2, 27, 1058 },
+    { 255, 0, -8673 },
+    { 2, 73, 1062 },
+    { 0, 17, 1061 },
+    { 255, 0, 1452 },
+    { 255, 0, -6653 },
+    { 1, 57, 1064 },
+    { 255, 0, -7727 },
+    { 255, 0, -1890 },
+    { 1, 72, 1067 },
+    { 255, 0, 7349 },
+    { 0, 18, 1071 },
+    { 1, 102, 1070 },
+    { 255, 0, -4870 },
+    { 255, 0, 2062 },
+    { 2, 58, 1073 },
+    { 255, 0, -3036 },
+    { 255, 0, 4951 },
+    { 1, 90, 1102 },
+    { 0, 54, 1089 },
+    { 2, 53, 1084 },
+    { 1, 61, 1081 },
+    { 2, 11, 1080 },
+    { 255, 0, 2596 },
+    { 255, 0, -3774 },
+    { 2, 20, 1083 },
+    { 255, 0, -54 },
+    { 255, 0, 6820 },
+    { 2, 60, 1086 },
+    { 255, 0, -9256 },
+    { 2, 80, 1088 },
+    { 255, 0, 460 },
+    { 255, 0, -5561 },
+    { 0, 84, 1097 },
+    { 1, 57, 1094 },
+    { 2, 42, 1093 },
+    { 255, 0, 4364 },
+    { 255, 0, -1250 },
+    { 0, 77, 1096 },
+    { 255, 0, 6692 },
+    { 255, 0, -3023 },
+    { 2, 2, 1099 },
+    { 255, 0, -4725 },
+    { 1, 9, 1101 },
+    { 255, 0, -1876 },
+    { 255, 0, 5475 },
+    { 0, 35, 1110 },
+    { 2, 96, 1109 },
+    { 1, 95, 1108 },
+    { 0, 30, 1107 },
+    { 255, 0, 2142 },
+    { 255, 0, -512 },
+    { 255, 0, 8010 },
+    { 255, 0, -5586 },
+    { 2, 118, 1112 },
+    { 255, 0, 7741 },
+    { 1, 94, 1114 },
+    { 255, 0, -2752 },
+    { 255, 0, 6703 },
+    { 0, 22, 1145 },
+    { 0, 3, 1120 },
+    { 2, 6, 1119 },
+    { 255, 0, -3149 },
+    { 255, 0, -8884 },
+    { 1, 67, 1130 },
+    { 2, 27, 1123 },
+    { 255, 0, -8351 },
+    { 2, 73, 1127 },
+    { 0, 17, 1126 },
+    { 255, 0, 1272 },
+    { 255, 0, -6380 },
+    { 1, 57, 1129 },
+    { 255, 0, -7415 },
+    { 255, 0, -1761 },
+    { 1, 80, 1138 },
+    { 2, 43, 1135 },
+    { 0, 7, 1134 },
+    { 255, 0, 4446 },
+    { 255, 0, -3893 },
+    { 0, 11, 1137 },
+    { 255, 0, -2216 },
+    { 255, 0, 10853 },
+    { 1, 100, 1142 },
+    { 0, 20, 1141 },
+    { 255, 0, -5594 },
+    { 255, 0, 2809 },
+    { 2, 61, 1144 },
+    { 255, 0, 8651 },
+    { 255, 0, -5321 },
+    { 1, 90, 1177 },
+    { 0, 61, 1162 },
+    { 2, 53, 1155 },
+    { 1, 61, 1152 },
+    { 0, 44, 1151 },
+    { 255, 0, -3843 },
+    { 255, 0, 1723 },
+    { 0, 26, 1154 },
+    { 255, 0, 8684 },
+    { 255, 0, 3572 },
+    { 0, 32, 1159 },
+    { 0, 24, 1158 },
+    { 255, 0, -544 },
+    { 255, 0, -8679 },
+    { 1, 59, 1161 },
+    { 255, 0, -3868 },
+    { 255, 0, 271 },
+    { 1, 18, 1170 },
+    { 0, 88, 1167 },
+    { 2, 115, 1166 },
+    { 255, 0, -661 },
+    { 255, 0, -8041 },
+    { 2, 23, 1169 },
+    { 255, 0, -3203 },
+    { 255, 0, 5246 },
+    { 2, 92, 1174 },
+    { 0, 71, 1173 },
+    { 255, 0, 7377 },
+    { 255, 0, 3201 },
+    { 0, 78, 1176 },
+    { 255, 0, -2069 },
+    { 255, 0, 4861 },
+    { 0, 35, 1185 },
+    { 2, 96, 1184 },
+    { 1, 95, 1183 },
+    { 0, 30, 1182 },
+    { 255, 0, 2016 },
+    { 255, 0, -478 },
+    { 255, 0, 7702 },
+    { 255, 0, -5180 },
+    { 2, 118, 1187 },
+    { 255, 0, 7479 },
+    { 1, 94, 1189 },
+    { 255, 0, -2524 },
+    { 255, 0, 6466 },
+    { 0, 22, 1210 },
+    { 0, 3, 1195 },
+    { 2, 6, 1194 },
+    { 255, 0, -2944 },
+    { 255, 0, -8762 },
+    { 2, 112, 1209 },
+    { 1, 67, 1204 },
+    { 2, 37, 1201 },
+    { 1, 6, 1200 },
+    { 255, 0, 1794 },
+    { 255, 0, -8768 },
+    { 2, 73, 1203 },
+    { 255, 0, 1417 },
+    { 255, 0, -5531 },
+    { 1, 72, 1206 },
+    { 255, 0, 6161 },
+    { 1, 102, 1208 },
+    { 255, 0, -2480 },
+    { 255, 0, 2778 },
+    { 255, 0, -7900 },
+    { 1, 90, 1232 },
+    { 0, 79, 1225 },
+    { 2, 82, 1218 },
+    { 0, 77, 1217 },
+    { 0, 61, 1216 },
+    { 255, 0, 63 },
+    { 255, 0, 4732 },
+    { 255, 0, -12966 },
+    { 1, 48, 1222 },
+    { 1, 38, 1221 },
+    { 255, 0, -2152 },
+    { 255, 0, -9036 },
+    { 0, 40, 1224 },
+    { 255, 0, -4971 },
+    { 255, 0, 1945 },
+    { 1, 1, 1227 },
+    { 255, 0, -6302 },
+    { 2, 2, 1229 },
+    { 255, 0, -4517 },
+    { 0, 108, 1231 },
+    { 255, 0, 4436 },
+    { 255, 0, -3337 },
+    { 0, 35, 1240 },
+    { 2, 96, 1239 },
+    { 1, 95, 1238 },
+    { 0, 30, 1237 },
+    { 255, 0, 1897 },
+    { 255, 0, -447 },
+    { 255, 0, 7416 },
+    { 255, 0, -4811 },
+    { 2, 118, 1242 },
+    { 255, 0, 7220 },
+    { 1, 94, 1244 },
+    { 255, 0, -2315 },
+    { 255, 0, 6239 },
+    { 0, 20, 1271 },
+    { 0, 3, 1250 },
+    { 2, 6, 1249 },
+    { 255, 0, -2751 },
+    { 255, 0, -8650 },
+    { 2, 74, 1260 },
+    { 2, 71, 1259 },
+    { 1, 102, 1256 },
+    { 2, 14, 1255 },
+    { 255, 0, -8145 },
+    { 255, 0, -1563 },
+    { 2, 48, 1258 },
+    { 255, 0, 8383 },
+    { 255, 0, -732 },
+    { 255, 0, 9133 },
+    { 0, 13, 1266 },
+    { 1, 102, 1265 },
+    { 1, 31, 1264 },
+    { 255, 0, -2965 },
+    { 255, 0, -8335 },
+    { 255, 0, -1376 },
+    { 1, 85, 1270 },
+    { 1, 55, 1269 },
+    { 255, 0, -6534 },
+    { 255, 0, 6169 },
+    { 255, 0, -7566 },
+    { 1, 90, 1299 },
+    { 0, 54, 1284 },
+    { 1, 81, 1279 },
+    { 2, 105, 1278 },
+    { 2, 9, 1277 },
+    { 255, 0, 3640 },
+    { 255, 0, -2151 },
+    { 255, 0, -8185 },
+    { 0, 24, 1281 },
+    { 255, 0, 8353 },
+    { 2, 53, 1283 },
+    { 255, 0, 5323 },
+    { 255, 0, -1693 },
+    { 1, 30, 1292 },
+    { 0, 69, 1289 },
+    { 1, 4, 1288 },
+    { 255, 0, 8080 },
+    { 255, 0, -4373 },
+    { 1, 2, 1291 },
+    { 255, 0, -6414 },
+    { 255, 0, 2563 },
+    { 2, 94, 1296 },
+    { 0, 71, 1295 },
+    { 255, 0, 5906 },
+    { 255, 0, 2573 },
+    { 0, 87, 1298 },
+    { 255, 0, -939 },
+    { 255, 0, 5651 },
+    { 2, 118, 1307 },
+    { 2, 33, 1302 },
+    { 255, 0, 8292 },
+    { 2, 47, 1306 },
+    { 0, 75, 1305 },
+    { 255, 0, -3679 },
+    { 255, 0, 4966 },
+    { 255, 0, 5941 },
+    { 0, 41, 1309 },
+    { 255, 0, -3427 },
+    { 0, 87, 1311 },
+    { 255, 0, 5412 },
+    { 255, 0, 606 },
+    { 0, 4, 1318 },
+    { 1, 100, 1315 },
+    { 255, 0, -8611 },
+    { 2, 48, 1317 },
+    { 255, 0, 2967 },
+    { 255, 0, -6409 },
+    { 0, 45, 1340 },
+    { 1, 68, 1329 },
+    { 1, 1, 1322 },
+    { 255, 0, 5568 },
+    { 0, 6, 1326 },
+    { 1, 28, 1325 },
+    { 255, 0, -1546 },
+    { 255, 0, 3838 },
+    { 1, 46, 1328 },
+    { 255, 0, -5156 },
+    { 255, 0, -1591 },
+    { 2, 116, 1337 },
+    { 0, 34, 1334 },
+    { 1, 101, 1333 },
+    { 255, 0, -760 },
+    { 255, 0, 3767 },
+    { 2, 83, 1336 },
+    { 255, 0, 5810 },
+    { 255, 0, -646 },
+    { 1, 97, 1339 },
+    { 255, 0, -7624 },
+    { 255, 0, -2153 },
+    { 1, 30, 1354 },
+    { 0, 69, 1349 },
+    { 1, 4, 1346 },
+    { 0, 58, 1345 },
+    { 255, 0, -370 },
+    { 255, 0, 8938 },
+    { 0, 64, 1348 },
+    { 255, 0, -456 },
+    { 255, 0, -7955 },
+    { 1, 2, 1351 },
+    { 255, 0, -5958 },
+    { 2, 117, 1353 },
+    { 255, 0, 3071 },
+    { 255, 0, -2355 },
+    { 1, 90, 1360 },
+    { 0, 46, 1357 },
+    { 255, 0, 9710 },
+    { 0, 54, 1359 },
+    { 255, 0, -2212 },
+    { 255, 0, 2885 },
+    { 0, 70, 1362 },
+    { 255, 0, 7841 },
+    { 0, 75, 1364 },
+    { 255, 0, -3799 },
+    { 255, 0, 6012 },
+    { 0, 4, 1373 },
+    { 1, 100, 1368 },
+    { 255, 0, -8508 },
+    { 2, 48, 1372 },
+    { 0, 1, 1371 },
+    { 255, 0, 75 },
+    { 255, 0, 3988 },
+    { 255, 0, -6192 },
+    { 0, 45, 1393 },
+    { 2, 116, 1390 },
+    { 1, 68, 1383 },
+    { 0, 6, 1380 },
+    { 2, 35, 1379 },
+    { 255, 0, -2507 },
+    { 255, 0, 7394 },
+    { 1, 46, 1382 },
+    { 255, 0, -4140 },
+    { 255, 0, -838 },
+    { 0, 8, 1387 },
+    { 2, 36, 1386 },
+    { 255, 0, 890 },
+    { 255, 0, -6702 },
+    { 1, 98, 1389 },
+    { 255, 0, 820 },
+    { 255, 0, 4226 },
+    { 1, 97, 1392 },
+    { 255, 0, -8355 },
+    { 255, 0, -2002 },
+    { 1, 90, 1407 },
+    { 0, 84, 1402 },
+    { 2, 31, 1399 },
+    { 0, 76, 1398 },
+    { 255, 0, 4937 },
+    { 255, 0, -1613 },
+    { 1, 43, 1401 },
+    { 255, 0, -1720 },
+    { 255, 0, 1350 },
+    { 2, 0, 1404 },
+    { 255, 0, -5940 },
+    { 1, 9, 1406 },
+    { 255, 0, -2248 },
+    { 255, 0, 4066 },
+    { 0, 70, 1409 },
+    { 255, 0, 7665 },
+    { 0, 75, 1411 },
+    { 255, 0, -3461 },
+    { 2, 119, 1413 },
+    { 255, 0, 6246 },
+    { 255, 0, 527 },
+    { 0, 4, 1422 },
+    { 1, 100, 1417 },
+    { 255, 0, -8410 },
+    { 2, 48, 1421 },
+    { 0, 1, 1420 },
+    { 255, 0, 70 },
+    { 255, 0, 3704 },
+    { 255, 0, -5982 },
+    { 0, 45, 1440 },
+    { 2, 116, 1437 },
+    { 1, 68, 1430 },
+    { 1, 1, 1427 },
+    { 255, 0, 5463 },
+    { 2, 37, 1429 },
+    { 255, 0, -4716 },
+    { 255, 0, -1122 },
+    { 2, 53, 1434 },
+    { 2, 13, 1433 },
+    { 255, 0, -1815 },
+    { 255, 0, 3626 },
+    { 2, 58, 1436 },
+    { 255, 0, -8697 },
+    { 255, 0, 589 },
+    { 1, 97, 1439 },
+    { 255, 0, -8105 },
+    { 255, 0, -1861 },
+    { 1, 90, 1456 },
+    { 0, 86, 1449 },
+    { 2, 31, 1446 },
+    { 2, 26, 1445 },
+    { 255, 0, 2150 },
+    { 255, 0, 7843 },
+    { 1, 18, 1448 },
+    { 255, 0, -3137 },
+    { 255, 0, 562 },
+    { 0, 108, 1453 },
+    { 2, 2, 1452 },
+    { 255, 0, -3788 },
+    { 255, 0, 3817 },
+    { 2, 73, 1455 },
+    { 255, 0, -8218 },
+    { 255, 0, 737 },
+    { 0, 70, 1458 },
+    { 255, 0, 7491 },
+    { 0, 75, 1460 },
+    { 255, 0, -3154 },
+    { 2, 119, 1462 },
+    { 255, 0, 5988 },
+    { 255, 0, 494 },
+    { 0, 4, 1469 },
+    { 1, 100, 1466 },
+    { 255, 0, -8314 },
+    { 0, 0, 1468 },
+    { 255, 0, -5715 },
+    { 255, 0, 2432 },
+    { 0, 61, 1497 },
+    { 2, 78, 1484 },
+    { 1, 62, 1477 },
+    { 1, 54, 1476 },
+    { 2, 36, 1475 },
+    { 255, 0, -2051 },
+    { 255, 0, 1971 },
+    { 255, 0, -11192 },
+    { 0, 22, 1481 },
+    { 2, 71, 1480 },
+    { 255, 0, -1842 },
+    { 255, 0, 5171 },
+    { 2, 46, 1483 },
+    { 255, 0, 5395 },
+    { 255, 0, 874 },
+    { 1, 52, 1490 },
+    { 1, 38, 1489 },
+    { 1, 36, 1488 },
+    { 255, 0, -4553 },
+    { 255, 0, 6586 },
+    { 255, 0, -8266 },
+    { 1, 60, 1494 },
+    { 0, 36, 1493 },
+    { 255, 0, 834 },
+    { 255, 0, 7856 },
+    { 2, 99, 1496 },
+    { 255, 0, -3604 },
+    { 255, 0, 545 },
+    { 1, 18, 1509 },
+    { 1, 15, 1506 },
+    { 1, 11, 1503 },
+    { 1, 5, 1502 },
+    { 255, 0, 2564 },
+    { 255, 0, -4723 },
+    { 0, 68, 1505 },
+    { 255, 0, -3430 },
+    { 255, 0, 4242 },
+    { 2, 47, 1508 },
+    { 255, 0, -7135 },
+    { 255, 0, -1838 },
+    { 0, 63, 1515 },
+    { 2, 97, 1512 },
+    { 255, 0, 8161 },
+    { 1, 42, 1514 },
+    { 255, 0, -1009 },
+    { 255, 0, 5502 },
+    { 0, 66, 1519 },
+    { 2, 98, 1518 },
+    { 255, 0, 1752 },
+    { 255, 0, -6713 },
+    { 2, 120, 1521 },
+    { 255, 0, 2305 },
+    { 255, 0, 6092 },
+    { 0, 4, 1530 },
+    { 1, 100, 1525 },
+    { 255, 0, -8220 },
+    { 2, 48, 1529 },
+    { 2, 16, 1528 },
+    { 255, 0, 3125 },
+    { 255, 0, 415 },
+    { 255, 0, -5707 },
+    { 0, 38, 1548 },
+    { 2, 116, 1547 },
+    { 1, 66, 1540 },
+    { 0, 6, 1537 },
+    { 2, 35, 1536 },
+    { 255, 0, -2089 },
+    { 255, 0, 6986 },
+    { 0, 33, 1539 },
+    { 255, 0, -2202 },
+    { 255, 0, -6730 },
+    { 2, 44, 1544 },
+    { 2, 13, 1543 },
+    { 255, 0, -3199 },
+    { 255, 0, 3813 },
+    { 2, 103, 1546 },
+    { 255, 0, -2034 },
+    { 255, 0, 2748 },
+    { 255, 0, -7502 },
+    { 1, 93, 1564 },
+    { 0, 89, 1557 },
+    { 2, 84, 1554 },
+    { 2, 11, 1553 },
+    { 255, 0, 6100 },
+    { 255, 0, 1118 },
+    { 2, 89, 1556 },
+    { 255, 0, -9602 },
+    { 255, 0, -730 },
+    { 2, 32, 1561 },
+    { 1, 67, 1560 },
+    { 255, 0, 1565 },
+    { 255, 0, -6984 },
+    { 1, 34, 1563 },
+    { 255, 0, 1351 },
+    { 255, 0, 5185 },
+    { 0, 73, 1566 },
+    { 255, 0, 7527 },
+    { 0, 84, 1568 },
+    { 255, 0, -1132 },
+    { 1, 103, 1570 },
+    { 255, 0, 6598 },
+    { 255, 0, 2079 },
+    { 0, 4, 1579 },
+    { 1, 100, 1574 },
+    { 255, 0, -8126 },
+    { 2, 48, 1578 },
+    { 0, 1, 1577 },
+    { 255, 0, 133 },
+    { 255, 0, 3161 },
+    { 255, 0, -5512 },
+    { 0, 54, 1597 },
+    { 2, 116, 1594 },
+    { 1, 101, 1589 },
+    { 0, 47, 1586 },
+    { 0, 45, 1585 },
+    { 255, 0, -883 },
+    { 255, 0, 5501 },
+    { 1, 44, 1588 },
+    { 255, 0, -6496 },
+    { 255, 0, -281 },
+    { 0, 20, 1593 },
+    { 2, 63, 1592 },
+    { 255, 0, 3370 },
+    { 255, 0, -3175 },
+    { 255, 0, 6952 },
+    { 1, 97, 1596 },
+    { 255, 0, -6963 },
+    { 255, 0, -1722 },
+    { 1, 88, 1607 },
+    { 0, 108, 1606 },
+    { 0, 104, 1603 },
+    { 0, 102, 1602 },
+    { 255, 0, 1114 },
+    { 255, 0, -6101 },
+    { 2, 23, 1605 },
+    { 255, 0, -954 },
+    { 255, 0, 6273 },
+    { 255, 0, -6009 },
+    { 0, 88, 1613 },
+    { 0, 70, 1610 },
+    { 255, 0, 7110 },
+    { 1, 99, 1612 },
+    { 255, 0, -4975 },
+    { 255, 0, 5149 },
+    { 1, 103, 1615 },
+    { 255, 0, 7455 },
+    { 255, 0, 1538 },
+    { 0, 3, 1620 },
+    { 2, 6, 1619 },
+    { 255, 0, -304 },
+    { 255, 0, -8061 },
+    { 0, 78, 1638 },
+    { 0, 77, 1637 },
+    { 1, 57, 1630 },
+    { 2, 82, 1627 },
+    { 1, 54, 1626 },
+    { 255, 0, 372 },
+    { 255, 0, -9672 },
+    { 2, 104, 1629 },
+    { 255, 0, -6138 },
+    { 255, 0, -1357 },
+    { 0, 34, 1634 },
+    { 2, 44, 1633 },
+    { 255, 0, 1523 },
+    { 255, 0, -2750 },
+    { 0, 54, 1636 },
+    { 255, 0, 1868 },
+    { 255, 0, 5132 },
+    { 255, 0, -14160 },
+    { 1, 2, 1640 },
+    { 255, 0, -4902 },
+    { 0, 108, 1648 },
+    { 0, 104, 1645 },
+    { 0, 102, 1644 },
+    { 255, 0, 2570 },
+    { 255, 0, -3333 },
+    { 2, 10, 1647 },
+    { 255, 0, -1871 },
+    { 255, 0, 6639 },
+    { 2, 73, 1650 },
+    { 255, 0, -7613 },
+    { 255, 0, 769 },
+    { 0, 3, 1655 },
+    { 2, 6, 1654 },
+    { 255, 0, -284 },
+    { 255, 0, -7958 },
+    { 1, 102, 1677 },
+    { 0, 45, 1664 },
+    { 2, 116, 1663 },
+    { 2, 111, 1662 },
+    { 2, 106, 1661 },
+    { 255, 0, -749 },
+    { 255, 0, -6855 },
+    { 255, 0, 4938 },
+    { 255, 0, -7113 },
+    { 1, 30, 1672 },
+    { 1, 25, 1669 },
+    { 2, 101, 1668 },
+    { 255, 0, -884 },
+    { 255, 0, 3849 },
+    { 2, 75, 1671 },
+    { 255, 0, 444 },
+    { 255, 0, -10024 },
+    { 0, 46, 1674 },
+    { 255, 0, 8543 },
+    { 0, 51, 1676 },
+    { 255, 0, -2729 },
+    { 255, 0, 1819 },
+    { 2, 61, 1679 },
+    { 255, 0, 8123 },
+    { 0, 20, 1683 },
+    { 2, 88, 1682 },
+    { 255, 0, -5019 },
+    { 255, 0, -876 },
+    { 0, 91, 1685 },
+    { 255, 0, 6274 },
+    { 255, 0, 463 },
+    { 0, 3, 1690 },
+    { 2, 6, 1689 },
+    { 255, 0, -265 },
+    { 255, 0, -7853 },
+    { 1, 102, 1716 },
+    { 0, 86, 1707 },
+    { 2, 81, 1700 },
+    { 0, 39, 1697 },
+    { 1, 65, 1696 },
+    { 255, 0, -2118 },
+    { 255, 0, 516 },
+    { 0, 71, 1699 },
+    { 255, 0, 2143 },
+    { 255, 0, -1307 },
+    { 2, 89, 1704 },
+    { 2, 84, 1703 },
+    { 255, 0, -1125 },
+    { 255, 0, -9383 },
+    { 2, 92, 1706 },
+    { 255, 0, 5166 },
+    { 255, 0, -1293 },
+    { 2, 120, 1715 },
+    { 2, 113, 1712 },
+    { 1, 8, 1711 },
+    { 255, 0, -4048 },
+    { 255, 0, 2839 },
+    { 1, 27, 1714 },
+    { 255, 0, -1456 },
+    { 255, 0, -10284 },
+    { 255, 0, 7295 },
+    { 2, 61, 1718 },
+    { 255, 0, 7857 },
+    { 0, 20, 1722 },
+    { 2, 88, 1721 },
+    { 255, 0, -4714 },
+    { 255, 0, -822 },
+    { 0, 91, 1724 },
+    { 255, 0, 5988 },
+    { 255, 0, 434 },
+    { 0, 4, 1731 },
+    { 1, 100, 1728 },
+    { 255, 0, -7799 },
+    { 2, 48, 1730 },
+    { 255, 0, 2870 },
+    { 255, 0, -4742 },
+    { 0, 78, 1747 },
+    { 0, 77, 1746 },
+    { 1, 50, 1739 },
+    { 1, 1, 1736 },
+    { 255, 0, 6864 },
+    { 2, 82, 1738 },
+    { 255, 0, -271 },
+    { 255, 0, -3850 },
+    { 0, 34, 1743 },
+    { 0, 31, 1742 },
+    { 255, 0, -195 },
+    { 255, 0, -6321 },
+    { 0, 65, 1745 },
+    { 255, 0, 1780 },
+    { 255, 0, 5529 },
+    { 255, 0, -12155 },
+    { 1, 88, 1763 },
+    { 1, 66, 1756 },
+    { 1, 34, 1753 },
+    { 0, 81, 1752 },
+    { 255, 0, 4210 },
+    { 255, 0, -715 },
+    { 2, 92, 1755 },
+    { 255, 0, 5885 },
+    { 255, 0, 1760 },
+    { 2, 65, 1760 },
+    { 0, 92, 1759 },
+    { 255, 0, -17705 },
+    { 255, 0, -3781 },
+    { 1, 83, 1762 },
+    { 255, 0, 4635 },
+    { 255, 0, -3342 },
+    { 2, 76, 1765 },
+    { 255, 0, 6976 },
+    { 2, 92, 1767 },
+    { 255, 0, -3763 },
+    { 0, 88, 1769 },
+    { 255, 0, 497 },
+    { 255, 0, 5962 },
+    { 0, 3, 1774 },
+    { 2, 6, 1773 },
+    { 255, 0, 32 },
+    { 255, 0, -7661 },
+    { 1, 101, 1798 },
+    { 0, 61, 1785 },
+    { 0, 59, 1782 },
+    { 1, 1, 1779 },
+    { 255, 0, 5715 },
+    { 1, 10, 1781 },
+    { 255, 0, -5124 },
+    { 255, 0, -403 },
+    { 2, 55, 1784 },
+    { 255, 0, -1340 },
+    { 255, 0, -7434 },
+    { 0, 63, 1791 },
+    { 1, 13, 1788 },
+    { 255, 0, -308 },
+    { 2, 97, 1790 },
+    { 255, 0, 8300 },
+    { 255, 0, 2941 },
+    { 0, 66, 1795 },
+    { 2, 98, 1794 },
+    { 255, 0, 709 },
+    { 255, 0, -7160 },
+    { 0, 108, 1797 },
+    { 255, 0, 1098 },
+    { 255, 0, -4240 },
+    { 0, 27, 1804 },
+    { 2, 61, 1801 },
+    { 255, 0, 6147 },
+    { 1, 104, 1803 },
+    { 255, 0, 2595 },
+    { 255, 0, -7129 },
+    { 0, 98, 1806 },
+    { 255, 0, 7272 },
+    { 255, 0, 239 },
+    { 0, 4, 1813 },
+    { 1, 100, 1810 },
+    { 255, 0, -7610 },
+    { 2, 25, 1812 },
+    { 255, 0, 2234 },
+    { 255, 0, -2239 },
+    { 1, 101, 1841 },
+    { 0, 89, 1828 },
+    { 2, 81, 1821 },
+    { 2, 79, 1820 },
+    { 1, 11, 1819 },
+    { 255, 0, -2814 },
+    { 255, 0, 689 },
+    { 255, 0, 7580 },
+    { 2, 89, 1825 },
+    { 2, 84, 1824 },
+    { 255, 0, -902 },
+    { 255, 0, -8310 },
+    { 0, 85, 1827 },
+    { 255, 0, -388 },
+    { 255, 0, -7838 },
+    { 2, 82, 1834 },
+    { 0, 108, 1833 },
+    { 1, 66, 1832 },
+    { 255, 0, 2151 },
+    { 255, 0, -2238 },
+    { 255, 0, -7178 },
+    { 1, 41, 1838 },
+    { 1, 27, 1837 },
+    { 255, 0, 4031 },
+    { 255, 0, -4414 },
+    { 0, 103, 1840 },
+    { 255, 0, 7396 },
+    { 255, 0, 2134 },
+    { 0, 27, 1845 },
+    { 1, 105, 1844 },
+    { 255, 0, 4588 },
+    { 255, 0, -4239 },
+    { 0, 98, 1847 },
+    { 255, 0, 7085 },
+    { 255, 0, 224 },
+    { 0, 3, 1852 },
+    { 2, 7, 1851 },
+    { 255, 0, 119 },
+    { 255, 0, -7445 },
+    { 1, 102, 1878 },
+    { 0, 35, 1865 },
+    { 1, 15, 1860 },
+    { 0, 25, 1859 },
+    { 0, 12, 1858 },
+    { 255, 0, 3853 },
+    { 255, 0, -4812 },
+    { 255, 0, 7744 },
+    { 1, 29, 1862 },
+    { 255, 0, -7635 },
+    { 1, 32, 1864 },
+    { 255, 0, 6627 },
+    { 255, 0, -1466 },
+    { 1, 11, 1873 },
+    { 1, 7, 1870 },
+    { 2, 38, 1869 },
+    { 255, 0, 4155 },
+    { 255, 0, -1446 },
+    { 0, 94, 1872 },
+    { 255, 0, -7815 },
+    { 255, 0, 1868 },
+    { 0, 108, 1877 },
+    { 0, 104, 1876 },
+    { 255, 0, 684 },
+    { 255, 0, 5092 },
+    { 255, 0, -5325 },
+    { 2, 61, 1880 },
+    { 255, 0, 7284 },
+    { 0, 27, 1884 },
+    { 1, 104, 1883 },
+    { 255, 0, 2499 },
+    { 255, 0, -6599 },
+    { 0, 90, 1886 },
+    { 255, 0, 6047 },
+    { 255, 0, 311 },
+    { 0, 3, 1891 },
+    { 2, 7, 1890 },
+    { 255, 0, 111 },
+    { 255, 0, -7316 },
+    { 1, 102, 1919 },
+    { 0, 51, 1906 },
+    { 0, 47, 1901 },
+    { 0, 45, 1898 },
+    { 2, 116, 1897 },
+    { 255, 0, -520 },
+    { 255, 0, -6699 },
+    { 1, 20, 1900 },
+    { 255, 0, -1232 },
+    { 255, 0, 5899 },
+    { 2, 87, 1905 },
+    { 2, 25, 1904 },
+    { 255, 0, -1476 },
+    { 255, 0, -9719 },
+    { 255, 0, 2766 },
+    { 1, 18, 1912 },
+    { 1, 15, 1911 },
+    { 2, 17, 1910 },
+    { 255, 0, 4710 },
+    { 255, 0, -760 },
+    { 255, 0, -5925 },
+    { 2, 30, 1916 },
+    { 2, 18, 1915 },
+    { 255, 0, 510 },
+    { 255, 0, 7061 },
+    { 2, 37, 1918 },
+    { 255, 0, -7398 },
+    { 255, 0, 1107 },
+    { 2, 61, 1921 },
+    { 255, 0, 7032 },
+    { 0, 20, 1923 },
+    { 255, 0, -3139 },
+    { 0, 90, 1925 },
+    { 255, 0, 5020 },
+    { 255, 0, 291 },
+    { 0, 4, 1932 },
+    { 1, 100, 1929 },
+    { 255, 0, -7320 },
+    { 2, 40, 1931 },
+    { 255, 0, 1723 },
+    { 255, 0, -1495 },
+    { 1, 101, 1948 },
+    { 0, 78, 1941 },
+    { 0, 77, 1940 },
+    { 1, 2, 1937 },
+    { 255, 0, 6136 },
+    { 1, 11, 1939 },
+    { 255, 0, -5208 },
+    { 255, 0, 59 },
+    { 255, 0, -11788 },
+    { 2, 0, 1943 },
+    { 255, 0, -5771 },
+    { 1, 2, 1945 },
+    { 255, 0, -4446 },
+    { 0, 108, 1947 },
+    { 255, 0, 1907 },
+    { 255, 0, -2807 },
+    { 0, 27, 1952 },
+    { 1, 105, 1951 },
+    { 255, 0, 4145 },
+    { 255, 0, -3927 },
+    { 0, 96, 1954 },
+    { 255, 0, 6580 },
+    { 255, 0, 285 },
+    { 0, 3, 1959 },
+    { 2, 8, 1958 },
+    { 255, 0, -353 },
+    { 255, 0, -7012 },
+    { 1, 102, 1985 },
+    { 0, 9, 1970 },
+    { 2, 51, 1967 },
+    { 2, 35, 1966 },
+    { 2, 18, 1965 },
+    { 255, 0, 3221 },
+    { 255, 0, -5501 },
+    { 255, 0, 5625 },
+    { 1, 31, 1969 },
+    { 255, 0, 606 },
+    { 255, 0, -7595 },
+    { 1, 45, 1978 },
+    { 2, 11, 1975 },
+    { 2, 5, 1974 },
+    { 255, 0, 332 },
+    { 255, 0, 7606 },
+    { 0, 53, 1977 },
+    { 255, 0, -3004 },
+    { 255, 0, -49 },
+    { 2, 20, 1982 },
+    { 2, 15, 1981 },
+    { 255, 0, 34 },
+    { 255, 0, -9970 },
+    { 0, 91, 1984 },
+    { 255, 0, 770 },
+    { 255, 0, 4738 },
+    { 2, 61, 1987 },
+    { 255, 0, 6761 },
+    { 0, 27, 1991 },
+    { 1, 104, 1990 },
+    { 255, 0, 2220 },
+    { 255, 0, -6074 },
+    { 0, 90, 1993 },
+    { 255, 0, 5466 },
+    { 255, 0, 188 },
+    { 0, 0, 1996 },
+    { 255, 0, -6732 },
+    { 1, 100, 2012 },
+    { 0, 4, 1999 },
+    { 255, 0, -5569 },
+    { 0, 6, 2005 },
+    { 2, 35, 2002 },
+    { 255, 0, -1878 },
+    { 1, 40, 2004 },
+    { 255, 0, 9704 },
+    { 255, 0, -608 },
+    { 0, 9, 2009 },
+    { 2, 19, 2008 },
+    { 255, 0, 4991 },
+    { 255, 0, -8184 },
+    { 1, 71, 2011 },
+    { 255, 0, -202 },
+    { 255, 0, 949 },
+    { 2, 61, 2014 },
+    { 255, 0, 6550 },
+    { 0, 29, 2018 },
+    { 1, 104, 2017 },
+    { 255, 0, -10 },
+    { 255, 0, -5111 },
+    { 0, 90, 2020 },
+    { 255, 0, 5099 },
+    { 255, 0, 177 },
+    { 0, 4, 2027 },
+    { 1, 100, 2024 },
+    { 255, 0, -6968 },
+    { 2, 40, 2026 },
+    { 255, 0, 1503 },
+    { 255, 0, -1313 },
+    { 1, 101, 2049 },
+    { 0, 84, 2038 },
+    { 0, 82, 2035 },
+    { 1, 1, 2032 },
+    { 255, 0, 6027 },
+    { 2, 118, 2034 },
+    { 255, 0, 38 },
+    { 255, 0, -2894 },
+    { 1, 21, 2037 },
+    { 255, 0, -9696 },
+    { 255, 0, -2116 },
+    { 2, 120, 2046 },
+    { 2, 113, 2043 },
+    { 1, 88, 2042 },
+    { 255, 0, 548 },
+    { 255, 0, 6382 },
+    { 0, 96, 2045 },
+    { 255, 0, 810 },
+    { 255, 0, -10604 },
+    { 2, 121, 2048 },
+    { 255, 0, 1825 },
+    { 255, 0, 6446 },
+    { 0, 27, 2053 },
+    { 1, 105, 2052 },
+    { 255, 0, 3697 },
+    { 255, 0, -3488 },
+    { 0, 95, 2055 },
+    { 255, 0, 6065 },
+    { 255, 0, 378 },
+    { 0, 0, 2058 },
+    { 255, 0, -6442 },
+    { 1, 100, 2072 },
+    { 0, 4, 2061 },
+    { 255, 0, -5181 },
+    { 0, 6, 2065 },
+    { 2, 51, 2064 },
+    { 255, 0, 5912 },
+    { 255, 0, -1032 },
+    { 0, 9, 2069 },
+    { 2, 19, 2068 },
+    { 255, 0, 4571 },
+    { 255, 0, -7893 },
+    { 2, 24, 2071 },
+    { 255, 0, -933 },
+    { 255, 0, 324 },
+    { 2, 61, 2074 },
+    { 255, 0, 6097 },
+    { 0, 29, 2078 },
+    { 1, 104, 2077 },
+    { 255, 0, -182 },
+    { 255, 0, -4762 },
+    { 2, 102, 2080 },
+    { 255, 0, 161 },
+    { 255, 0, 4708 },
+    { 0, 0, 2083 },
+    { 255, 0, -6281 },
+    { 2, 15, 2101 },
+    { 0, 100, 2098 },
+    { 0, 22, 2091 },
+    { 2, 14, 2090 },
+    { 1, 94, 2089 },
+    { 255, 0, -7124 },
+    { 255, 0, 1318 },
+    { 255, 0, 3841 },
+    { 1, 24, 2095 },
+    { 2, 3, 2094 },
+    { 255, 0, 2958 },
+    { 255, 0, 9306 },
+    { 1, 33, 2097 },
+    { 255, 0, -6846 },
+    { 255, 0, 4219 },
+    { 2, 5, 2100 },
+    { 255, 0, -8045 },
+    { 255, 0, -851 },
+    { 2, 24, 2109 },
+    { 1, 84, 2108 },
+    { 0, 97, 2107 },
+    { 2, 20, 2106 },
+    { 255, 0, -9507 },
+    { 255, 0, -2585 },
+    { 255, 0, 1063 },
+    { 255, 0, 4459 },
+    { 2, 31, 2117 },
+    { 0, 43, 2114 },
+    { 1, 61, 2113 },
+    { 255, 0, -4577 },
+    { 255, 0, 4542 },
+    { 1, 19, 2116 },
+    { 255, 0, -259 },
+    { 255, 0, 7704 },
+    { 2, 35, 2121 },
+    { 1, 16, 2120 },
+    { 255, 0, 1157 },
+    { 255, 0, -6550 },
+    { 2, 40, 2123 },
+    { 255, 0, 6887 },
+    { 255, 0, -165 },
+    { 0, 0, 2126 },
+    { 255, 0, -6118 },
+    { 2, 51, 2140 },
+    { 2, 47, 2137 },
+    { 2, 46, 2136 },
+    { 0, 102, 2133 },
+    { 2, 37, 2132 },
+    { 255, 0, 152 },
+    { 255, 0, 4433 },
+    { 0, 104, 2135 },
+    { 255, 0, -11466 },
+    { 255, 0, -1245 },
+    { 255, 0, -9043 },
+    { 2, 50, 2139 },
+    { 255, 0, 9756 },
+    { 255, 0, 3157 },
+    { 0, 101, 2154 },
+    { 0, 10, 2147 },
+    { 1, 31, 2144 },
+    { 255, 0, 721 },
+    { 2, 107, 2146 },
+    { 255, 0, -7525 },
+    { 255, 0, -606 },
+    { 1, 45, 2151 },
+    { 1, 39, 2150 },
+    { 255, 0, -312 },
+    { 255, 0, -4969 },
+    { 1, 83, 2153 },
+    { 255, 0, 1795 },
+    { 255, 0, -1709 },
+    { 2, 68, 2158 },
+    { 0, 105, 2157 },
+    { 255, 0, 5011 },
+    { 255, 0, -6131 },
+    { 2, 107, 2160 },
+    { 255, 0, 7139 },
+    { 0, 104, 2162 },
+    { 255, 0, -3625 },
+    { 255, 0, 4178 },
+    { 0, 4, 2167 },
+    { 1, 100, 2166 },
+    { 255, 0, -6490 },
+    { 255, 0, 68 },
+    { 1, 101, 2193 },
+    { 0, 61, 2180 },
+    { 0, 59, 2177 },
+    { 2, 74, 2174 },
+    { 2, 70, 2173 },
+    { 255, 0, -193 },
+    { 255, 0, 6020 },
+    { 0, 13, 2176 },
+    { 255, 0, -5281 },
+    { 255, 0, -581 },
+    { 1, 42, 2179 },
+    { 255, 0, -6915 },
+    { 255, 0, -1421 },
+    { 0, 63, 2186 },
+    { 1, 13, 2183 },
+    { 255, 0, -280 },
+    { 2, 97, 2185 },
+    { 255, 0, 7896 },
+    { 255, 0, 2651 },
+    { 0, 65, 2190 },
+    { 2, 98, 2189 },
+    { 255, 0, 1002 },
+    { 255, 0, -8231 },
+    { 2, 0, 2192 },
+    { 255, 0, -4150 },
+    { 255, 0, 452 },
+    { 0, 27, 2197 },
+    { 1, 105, 2196 },
+    { 255, 0, 3552 },
+    { 255, 0, -3233 },
+    { 0, 94, 2199 },
+    { 255, 0, 5760 },
+    { 255, 0, 287 },
+    { 0, 0, 2202 },
+    { 255, 0, -5812 },
+    { 2, 15, 2220 },
+    { 0, 100, 2217 },
+    { 0, 22, 2210 },
+    { 0, 14, 2209 },
+    { 2, 12, 2208 },
+    { 255, 0, -1842 },
+    { 255, 0, 4956 },
+    { 255, 0, -6591 },
+    { 1, 24, 2214 },
+    { 0, 37, 2213 },
+    { 255, 0, 2715 },
+    { 255, 0, 8885 },
+    { 1, 33, 2216 },
+    { 255, 0, -6226 },
+    { 255, 0, 3872 },
+    { 2, 5, 2219 },
+    { 255, 0, -6818 },
+    { 255, 0, -735 },
+    { 2, 24, 2228 },
+    { 1, 84, 2227 },
+    { 0, 97, 2226 },
+    { 2, 20, 2225 },
+    { 255, 0, -8486 },
+    { 255, 0, -2369 },
+    { 255, 0, 1125 },
+    { 255, 0, 4179 },
+    { 2, 31, 2236 },
+    { 0, 43, 2233 },
+    { 1, 61, 2232 },
+    { 255, 0, -4224 },
+    { 255, 0, 4078 },
+    { 1, 19, 2235 },
+    { 255, 0, -255 },
+    { 255, 0, 7365 },
+    { 2, 35, 2240 },
+    { 0, 61, 2239 },
+    { 255, 0, -7208 },
+    { 255, 0, -1261 },
+    { 2, 40, 2242 },
+    { 255, 0, 6069 },
+    { 255, 0, -169 },
+};
+
+static const uint16_t MODEL_QUANTIZED_TREE_ROOTS[41] = {
+    0, 83, 160, 245, 334, 421, 502, 581, 658, 725, 784, 843, 910, 989, 1048, 1115,
+    1190, 1245, 1312, 1365, 1414, 1463, 1522, 1571, 1616, 1651, 1686, 1725, 1770, 1807, 1848, 1887,
+    1926, 1955, 1994, 2021, 2056, 2081, 2124, 2163, 2200,
+};
+
+static const uint8_t MODEL_QUANTIZED_TREE_CLASS[41] = {
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0,
+};
+
+// Khoảng votes[1] - votes[0] còn có thể cộng thêm từ cây i đến hết
+static const int32_t MODEL_QUANTIZED_MARGIN_MIN[42] = {
+    -395727, -381459, -365934, -354026, -341045, -330298, -318846, -308707, -298104, -288530, -278557, -270094, -260352, -250688, -241498, -233488,
+    -224604, -217188, -208538, -198828, -190320, -182477, -171285, -163758, -155632, -148993, -138969, -131112, -113407, -105107, -96797, -89053,
+    -79334, -72754, -62784, -53080, -42476, -36379, -26872, -17116, -8885, 0,
+};
+
+static const int32_t MODEL_QUANTIZED_MARGIN_MAX[42] = {
+    400249, 382392, 369755, 355812, 344404, 332176, 322112, 311076, 302075, 290054, 281565, 271856, 261746, 249736, 241550, 232294,
+    221441, 208475, 199342, 190731, 183066, 174369, 166208, 156606, 149151, 134991, 126448, 116164, 109188, 101527, 93947, 86132,
+    79071, 67283, 59677, 51493, 45047, 37154, 27848, 16382, 8486, 0,
+};
+
+static const ModelQuantTables MODEL_QUANTIZED = {
+    MODEL_QUANTIZED_NODES,
+    MODEL_QUANTIZED_TREE_ROOTS,
+    MODEL_QUANTIZED_TREE_CLASS,
+    MODEL_QUANTIZED_NODE_COUNT,
+    41,
+    { MODEL_QUANTIZED_SOIL_THRESHOLDS, MODEL_QUANTIZED_TEMPERATURE_THRESHOLDS, MODEL_QUANTIZED_HUMIDITY_THRESHOLDS },
+    { 109, 106, 122 },
+    MODEL_QUANTIZED_LOGIT_THRESHOLD,
+    MODEL_QUANTIZED_MARGIN_MIN,
+    MODEL_QUANTIZED_MARGIN_MAX,
+};
+
+#endif
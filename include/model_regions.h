@@ -0,0 +1,738 @@
+// model_regions.h
+// Sinh tự động bởi tools/model_regions.cpp từ model_table.h - không sửa tay.
+
+#ifndef MODEL_REGIONS_H
+#define MODEL_REGIONS_H
+
+#include "model_engine.h"
+
+#define MODEL_REGIONS_ROW_COUNT 538
+#define MODEL_REGIONS_ROW_BYTES 6
+
+static const int16_t MODEL_REGIONS_SOIL_THRESHOLDS[109] = {
+    252, 257, 283, 296, 314, 321, 330, 341, 345, 349, 351, 359, 363, 367, 375, 386,
+    397, 405, 407, 414, 417, 419, 423, 430, 435, 437, 440, 443, 447, 450, 458, 463,
+    467, 471, 479, 481, 484, 500, 504, 519, 527, 531, 534, 538, 541, 544, 552, 560,
+    563, 568, 571, 576, 581, 585, 590, 597, 601, 604, 616, 619, 622, 625, 637, 638,
+    645, 648, 658, 667, 688, 695, 701, 710, 718, 721, 723, 726, 729, 732, 734, 738,
+    741, 757, 763, 768, 770, 775, 776, 782, 785, 790, 794, 819, 822, 827, 832, 839,
+    841, 856, 858, 862, 870, 882, 892, 902, 906, 921, 939, 944, 947,
+};
+
+static const int16_t MODEL_REGIONS_TEMP_THRESHOLDS[21] = {
+    19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+    35, 36, 37, 38, 39,
+};
+
+static const int16_t MODEL_REGIONS_HUM_THRESHOLDS[41] = {
+    40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+    56, 57, 58, 59, 60, 61, 62, 63, 65, 66, 67, 68, 69, 70, 71, 72,
+    73, 74, 76, 77, 78, 79, 80, 81, 82,
+};
+
+static const uint16_t MODEL_REGIONS_ROW_INDEX[2420] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 5, 5, 1, 1, 1, 1,
+    2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4,
+    6, 6, 1, 1, 1, 1, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 4, 4, 7, 7, 2, 2, 8, 2, 9, 9, 2, 10,
+    10, 10, 10, 10, 11, 2, 12, 12, 12, 12, 12, 12, 13, 13, 2, 2,
+    14, 15, 16, 16, 17, 18, 19, 19, 19, 20, 21, 22, 23, 24, 24, 24,
+    24, 24, 25, 26, 2, 2, 27, 20, 27, 27, 17, 28, 29, 29, 29, 30,
+    31, 22, 32, 24, 24, 24, 24, 24, 25, 26, 33, 33, 34, 35, 34, 34,
+    36, 37, 38, 38, 38, 37, 39, 12, 40, 41, 41, 41, 41, 41, 42, 26,
+    33, 33, 34, 35, 34, 34, 36, 37, 38, 38, 38, 37, 39, 12, 40, 41,
+    41, 41, 41, 41, 42, 26, 33, 33, 34, 35, 34, 34, 36, 37, 38, 38,
+    38, 37, 39, 12, 43, 44, 44, 44, 44, 45, 46, 47, 2, 2, 48, 49,
+    48, 48, 50, 51, 52, 52, 53, 54, 55, 12, 56, 57, 57, 57, 57, 57,
+    46, 47, 2, 2, 48, 49, 48, 48, 50, 58, 52, 52, 55, 59, 55, 2,
+    41, 60, 57, 57, 57, 57, 61, 62, 2, 2, 48, 49, 48, 48, 50, 58,
+    52, 52, 55, 59, 55, 12, 63, 60, 57, 57, 57, 57, 61, 62, 2, 2,
+    64, 65, 48, 48, 50, 58, 52, 52, 55, 59, 55, 12, 63, 60, 57, 57,
+    57, 57, 61, 62, 33, 33, 66, 67, 67, 67, 50, 68, 69, 69, 70, 71,
+    71, 72, 73, 74, 75, 75, 75, 76, 61, 26, 33, 33, 66, 77, 77, 77,
+    78, 79, 80, 80, 70, 71, 71, 72, 73, 74, 75, 75, 75, 76, 81, 26,
+    33, 33, 66, 77, 77, 77, 78, 79, 80, 80, 70, 71, 71, 72, 73, 74,
+    75, 75, 75, 76, 25, 82, 33, 33, 66, 77, 77, 77, 78, 79, 80, 80,
+    70, 71, 71, 72, 73, 74, 75, 75, 75, 76, 25, 82, 33, 33, 83, 64,
+    84, 84, 85, 86, 87, 87, 70, 71, 71, 72, 73, 74, 75, 75, 75, 76,
+    25, 82, 2, 2, 83, 88, 89, 89, 90, 86, 91, 91, 92, 93, 71, 94,
+    95, 33, 2, 2, 2, 33, 96, 2, 97, 98, 99, 100, 101, 101, 102, 103,
+    104, 104, 105, 106, 107, 108, 109, 110, 2, 2, 2, 2, 111, 2, 112, 113,
+    83, 66, 114, 114, 115, 116, 117, 117, 118, 119, 120, 121, 122, 123, 124, 124,
+    110, 125, 126, 127, 112, 113, 83, 66, 114, 114, 115, 116, 117, 117, 118, 119,
+    120, 121, 122, 123, 124, 124, 110, 128, 129, 130, 131, 131, 132, 133, 134, 134,
+    135, 136, 137, 137, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148,
+    1, 1, 149, 150, 151, 151, 152, 153, 154, 154, 155, 156, 157, 158, 159, 160,
+    161, 162, 163, 146, 147, 148, 1, 1, 164, 165, 166, 166, 2, 167, 168, 168,
+    169, 170, 171, 172, 173, 174, 175, 175, 163, 146, 176, 148, 2, 2, 177, 178,
+    179, 179, 2, 167, 168, 168, 169, 170, 180, 181, 173, 174, 175, 175, 163, 146,
+    176, 148, 2, 2, 177, 178, 179, 179, 2, 167, 168, 168, 169, 170, 182, 181,
+    183, 175, 175, 175, 163, 146, 176, 148, 2, 2, 184, 185, 186, 186, 2, 187,
+    188, 188, 189, 190, 191, 172, 183, 175, 175, 175, 163, 146, 192, 192, 2, 2,
+    184, 185, 186, 186, 2, 187, 188, 188, 189, 190, 191, 172, 183, 33, 175, 175,
+    163, 146, 192, 192, 2, 2, 184, 185, 186, 186, 2, 187, 188, 188, 189, 190,
+    191, 172, 183, 33, 175, 175, 163, 146, 193, 193, 2, 2, 184, 185, 186, 186,
+    2, 187, 188, 188, 189, 190, 191, 172, 183, 33, 175, 175, 194, 146, 193, 193,
+    2, 2, 184, 185, 186, 186, 2, 187, 188, 188, 189, 33, 195, 196, 183, 33,
+    33, 2, 33, 197, 198, 199, 2, 2, 200, 201, 202, 202, 33, 203, 204, 204,
+    189, 205, 206, 196, 183, 33, 33, 33, 33, 207, 198, 199, 2, 2, 208, 209,
+    210, 210, 211, 212, 213, 213, 214, 215, 216, 196, 183, 217, 205, 33, 205, 207,
+    198, 199, 1, 2, 218, 219, 220, 220, 221, 222, 223, 223, 224, 225, 191, 226,
+    183, 227, 205, 33, 33, 33, 193, 228, 229, 230, 231, 232, 233, 233, 234, 235,
+    236, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 193, 193, 229, 230,
+    231, 232, 233, 233, 234, 235, 236, 236, 237, 247, 239, 240, 241, 242, 243, 244,
+    245, 246, 193, 193, 248, 2, 231, 232, 249, 249, 234, 235, 236, 236, 237, 247,
+    239, 240, 241, 242, 243, 244, 245, 246, 193, 193, 2, 2, 250, 251, 251, 251,
+    252, 253, 253, 253, 254, 255, 256, 257, 258, 259, 260, 261, 2, 33, 262, 262,
+    2, 2, 263, 264, 265, 265, 266, 267, 268, 268, 264, 269, 256, 270, 258, 259,
+    260, 261, 2, 33, 262, 262, 2, 2, 263, 264, 265, 265, 266, 267, 268, 268,
+    264, 271, 272, 273, 274, 275, 276, 277, 2, 33, 262, 262, 2, 2, 263, 264,
+    265, 265, 266, 267, 268, 268, 264, 271, 272, 273, 274, 275, 276, 277, 2, 33,
+    262, 262, 2, 2, 263, 264, 265, 265, 266, 267, 268, 268, 264, 271, 272, 273,
+    278, 279, 280, 277, 2, 33, 262, 262, 2, 2, 263, 264, 265, 265, 266, 267,
+    268, 268, 264, 271, 272, 273, 278, 281, 282, 283, 2, 33, 262, 262, 2, 2,
+    284, 266, 266, 266, 285, 268, 268, 268, 264, 286, 272, 273, 287, 242, 260, 288,
+    2, 33, 262, 262, 289, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299,
+    300, 301, 302, 303, 304, 305, 2, 2, 2, 2, 289, 289, 290, 291, 292, 293,
+    294, 306, 296, 297, 307, 308, 300, 301, 302, 309, 304, 305, 2, 2, 2, 2,
+    310, 310, 311, 312, 2, 2, 313, 2, 2, 2, 2, 314, 315, 2, 316, 2,
+    2, 317, 2, 2, 2, 2, 310, 310, 311, 312, 2, 2, 313, 2, 2, 2,
+    2, 314, 2, 316, 316, 2, 2, 317, 2, 2, 2, 2, 310, 310, 311, 312,
+    2, 2, 313, 2, 2, 2, 2, 314, 2, 316, 316, 2, 2, 317, 2, 2,
+    2, 2, 310, 310, 311, 312, 2, 2, 313, 2, 2, 2, 2, 314, 318, 316,
+    316, 319, 320, 321, 2, 2, 2, 2, 322, 322, 323, 324, 325, 326, 327, 328,
+    329, 2, 2, 330, 331, 332, 333, 334, 335, 336, 2, 2, 2, 2, 337, 337,
+    338, 339, 340, 341, 342, 343, 344, 313, 2, 345, 346, 347, 333, 334, 335, 336,
+    2, 2, 2, 2, 348, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358,
+    359, 360, 360, 361, 362, 336, 2, 2, 2, 2, 363, 363, 364, 365, 366, 351,
+    367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 376, 377, 2, 2, 2, 2,
+    363, 363, 364, 378, 379, 380, 381, 382, 369, 370, 371, 372, 373, 374, 375, 376,
+    376, 377, 2, 2, 2, 2, 383, 383, 384, 365, 366, 351, 385, 386, 387, 388,
+    389, 390, 373, 391, 375, 376, 376, 377, 2, 2, 2, 2, 383, 383, 365, 351,
+    392, 393, 394, 386, 387, 388, 389, 390, 373, 391, 375, 376, 376, 377, 2, 2,
+    2, 2, 365, 365, 365, 351, 392, 393, 394, 386, 387, 388, 389, 390, 373, 391,
+    375, 376, 376, 377, 2, 2, 2, 2, 366, 366, 366, 395, 396, 397, 398, 399,
+    400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 2, 2, 2, 2, 366, 366,
+    366, 395, 396, 397, 398, 399, 400, 410, 2, 411, 412, 413, 375, 376, 414, 409,
+    2, 2, 2, 2, 415, 415, 416, 417, 418, 418, 2, 419, 420, 421, 422, 389,
+    423, 423, 423, 423, 424, 425, 2, 2, 2, 2, 426, 426, 416, 417, 418, 418,
+    2, 419, 420, 421, 422, 389, 423, 423, 423, 423, 424, 425, 2, 2, 2, 2,
+    426, 426, 416, 417, 427, 427, 2, 426, 366, 426, 2, 428, 2, 2, 2, 2,
+    423, 429, 2, 2, 2, 2, 426, 426, 416, 430, 431, 431, 320, 426, 366, 426,
+    2, 428, 2, 2, 2, 2, 423, 429, 2, 2, 2, 2, 426, 426, 426, 430,
+    432, 432, 320, 426, 433, 426, 2, 389, 2, 2, 2, 2, 428, 389, 2, 2,
+    2, 2, 426, 426, 416, 430, 434, 434, 320, 426, 366, 426, 2, 389, 2, 2,
+    2, 2, 428, 389, 2, 2, 2, 2, 426, 426, 416, 430, 434, 434, 320, 426,
+    366, 426, 2, 389, 2, 2, 2, 2, 428, 389, 2, 2, 2, 2, 426, 426,
+    416, 416, 434, 434, 320, 426, 366, 426, 2, 389, 2, 2, 2, 2, 428, 389,
+    2, 2, 2, 2, 416, 416, 435, 436, 437, 437, 427, 426, 366, 426, 2, 389,
+    2, 2, 2, 2, 428, 389, 2, 2, 2, 2, 416, 416, 435, 436, 437, 437,
+    427, 426, 366, 426, 2, 389, 2, 2, 2, 2, 428, 2, 2, 2, 2, 2,
+    416, 416, 61, 436, 438, 438, 427, 46, 366, 439, 2, 423, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 416, 416, 61, 436, 440, 440, 320, 46, 366, 439,
+    2, 423, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 416, 416, 61, 436,
+    440, 440, 320, 46, 366, 439, 2, 424, 2, 2, 2, 2, 423, 2, 441, 441,
+    442, 442, 436, 436, 443, 444, 427, 445, 446, 447, 448, 449, 429, 450, 422, 422,
+    422, 422, 451, 429, 452, 452, 453, 453, 436, 436, 443, 444, 427, 445, 446, 447,
+    448, 449, 429, 450, 422, 422, 422, 422, 451, 429, 441, 441, 454, 454, 436, 436,
+    443, 455, 427, 456, 457, 433, 366, 46, 2, 458, 423, 423, 423, 423, 459, 2,
+    441, 441, 454, 454, 460, 460, 461, 83, 462, 463, 464, 465, 465, 99, 466, 467,
+    467, 467, 467, 467, 468, 467, 469, 470, 471, 471, 460, 460, 472, 473, 474, 475,
+    476, 465, 465, 477, 478, 479, 467, 480, 481, 481, 482, 483, 441, 441, 484, 484,
+    99, 99, 2, 2, 320, 320, 2, 485, 486, 487, 2, 423, 488, 481, 489, 489,
+    481, 490, 441, 441, 484, 484, 99, 99, 2, 2, 2, 2, 2, 320, 320, 320,
+    2, 423, 488, 481, 489, 489, 481, 490, 441, 441, 484, 484, 99, 99, 2, 2,
+    2, 2, 2, 320, 320, 320, 2, 423, 488, 481, 489, 489, 481, 490, 441, 441,
+    484, 484, 491, 491, 2, 2, 2, 2, 2, 2, 320, 320, 2, 423, 492, 489,
+    423, 423, 423, 493, 441, 441, 484, 484, 491, 491, 2, 2, 2, 2, 2, 320,
+    320, 494, 2, 423, 495, 480, 496, 496, 496, 493, 441, 441, 484, 484, 497, 497,
+    2, 2, 2, 2, 230, 423, 423, 498, 499, 499, 499, 500, 423, 423, 423, 501,
+    230, 230, 230, 230, 497, 497, 2, 2, 2, 2, 230, 423, 423, 498, 499, 499,
+    499, 500, 423, 423, 423, 501, 230, 230, 230, 230, 502, 502, 2, 2, 230, 230,
+    230, 2, 2, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    502, 502, 2, 2, 230, 230, 230, 2, 2, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 99, 99, 2, 2, 230, 230, 230, 2, 2, 230,
+    230, 230, 230, 230, 230, 230, 230, 503, 504, 504, 230, 230, 99, 99, 2, 2,
+    230, 230, 230, 230, 505, 506, 505, 505, 505, 505, 505, 505, 505, 507, 508, 509,
+    230, 230, 99, 99, 2, 2, 230, 230, 230, 230, 505, 506, 505, 505, 505, 505,
+    505, 505, 505, 507, 508, 509, 230, 230, 99, 99, 2, 2, 230, 230, 230, 230,
+    505, 505, 505, 505, 505, 505, 505, 505, 505, 510, 511, 512, 230, 230, 99, 99,
+    2, 2, 230, 230, 230, 230, 505, 505, 505, 505, 505, 505, 505, 505, 505, 510,
+    511, 512, 230, 230, 99, 99, 2, 2, 230, 230, 230, 230, 505, 505, 505, 505,
+    505, 505, 505, 505, 505, 510, 511, 512, 230, 230, 99, 99, 2, 2, 230, 230,
+    230, 230, 505, 505, 505, 505, 505, 505, 505, 505, 505, 510, 511, 512, 230, 230,
+    99, 99, 2, 2, 230, 230, 230, 230, 505, 505, 505, 505, 505, 505, 505, 505,
+    505, 510, 511, 512, 2, 2, 99, 99, 2, 2, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 510, 513, 514, 230, 230, 99, 99, 2, 2,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 510, 513, 514,
+    230, 230, 99, 99, 2, 2, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 510, 513, 514, 230, 230, 99, 99, 2, 2, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 510, 513, 514, 230, 230, 99, 99,
+    2, 2, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 515,
+    513, 514, 230, 230, 99, 99, 2, 2, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 516, 230, 230, 230, 517, 518, 519, 230, 230, 520, 520, 2, 2, 230, 230,
+    230, 521, 521, 522, 504, 504, 504, 230, 230, 230, 504, 523, 524, 525, 230, 230,
+    520, 520, 2, 2, 230, 230, 230, 521, 521, 522, 504, 504, 504, 230, 230, 230,
+    504, 526, 527, 528, 230, 230, 99, 99, 2, 2, 230, 230, 230, 2, 2, 230,
+    230, 230, 230, 230, 230, 230, 230, 529, 230, 230, 230, 230, 99, 99, 2, 2,
+    230, 230, 230, 2, 2, 230, 230, 230, 230, 230, 230, 230, 230, 529, 230, 230,
+    230, 230, 99, 99, 2, 2, 230, 230, 230, 2, 2, 230, 230, 230, 230, 230,
+    230, 230, 230, 529, 230, 230, 230, 230, 99, 99, 2, 2, 230, 230, 230, 2,
+    2, 230, 230, 230, 230, 230, 230, 230, 230, 529, 230, 230, 230, 230, 99, 99,
+    530, 531, 532, 532, 533, 534, 535, 230, 230, 230, 230, 230, 230, 230, 230, 99,
+    536, 536, 537, 537,
+};
+
+static const uint8_t MODEL_REGIONS_ROWS[MODEL_REGIONS_ROW_COUNT * MODEL_REGIONS_ROW_BYTES] = {
+    0xfc, 0xff, 0xff, 0xff, 0xff, 0x03,
+    0x00, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xff, 0x03, 0x00,
+    0x04, 0x00, 0xff, 0xff, 0x03, 0x00,
+    0xfc, 0x00, 0xff, 0xff, 0xff, 0x03,
+    0xfc, 0x0f, 0xff, 0xff, 0xff, 0x03,
+    0xcc, 0x00, 0xf8, 0xff, 0xff, 0x03,
+    0x20, 0x00, 0x80, 0x0c, 0x00, 0x00,
+    0xa0, 0x01, 0xc0, 0xee, 0x31, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xe3, 0x03,
+    0xff, 0xff, 0xff, 0x03, 0x10, 0x00,
+    0xff, 0x7f, 0xff, 0x01, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x0f, 0x10, 0x00,
+    0xef, 0x0d, 0x80, 0x00, 0x00, 0x00,
+    0xff, 0x0f, 0xc0, 0x00, 0x00, 0x00,
+    0xff, 0x7f, 0xff, 0x00, 0x00, 0x00,
+    0xff, 0x7f, 0xff, 0x0f, 0x10, 0x00,
+    0xff, 0x1f, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
+    0xe8, 0xbf, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x0f, 0x00, 0xff, 0xff, 0xff, 0x03,
+    0x00, 0x00, 0xc8, 0x00, 0xc1, 0x03,
+    0xff, 0xff, 0xff, 0xff, 0x11, 0x00,
+    0xff, 0x0f, 0xc0, 0x0e, 0x10, 0x00,
+    0xff, 0x7f, 0xff, 0x0c, 0x10, 0x00,
+    0xff, 0x7f, 0xff, 0xff, 0x13, 0x00,
+    0xff, 0x1f, 0xff, 0x00, 0x10, 0x00,
+    0xe8, 0xbf, 0xff, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0xe1, 0xff, 0xff, 0xff, 0x3f, 0x00,
+    0xe0, 0xff, 0xff, 0xff, 0x33, 0x00,
+    0xc0, 0x7f, 0xc0, 0xff, 0x33, 0x00,
+    0xe0, 0xff, 0xff, 0xff, 0x3f, 0x00,
+    0xe0, 0xff, 0xff, 0xff, 0x13, 0x00,
+    0xe0, 0xff, 0xff, 0xec, 0x13, 0x00,
+    0xc0, 0xff, 0xff, 0xee, 0x13, 0x00,
+    0x00, 0x80, 0xff, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0xfa, 0xff, 0xff, 0x03,
+    0xc0, 0xff, 0xff, 0xff, 0x33, 0x00,
+    0x00, 0xf0, 0xff, 0xee, 0x13, 0x00,
+    0x00, 0xf0, 0xff, 0xef, 0x13, 0x00,
+    0x00, 0x00, 0xff, 0xff, 0xff, 0x03,
+    0x00, 0x00, 0xfa, 0xff, 0xe7, 0x03,
+    0xef, 0x0f, 0xc0, 0xee, 0x11, 0x00,
+    0xed, 0x0d, 0xc0, 0x00, 0x10, 0x00,
+    0xe0, 0x01, 0x80, 0x00, 0x10, 0x00,
+    0xed, 0x01, 0xc0, 0xff, 0x13, 0x00,
+    0xed, 0x01, 0xc0, 0x00, 0x10, 0x00,
+    0xe1, 0x0f, 0xc1, 0x00, 0x10, 0x00,
+    0xe1, 0x0f, 0xc1, 0xff, 0x13, 0x00,
+    0xe1, 0x0f, 0xc0, 0x00, 0x10, 0x00,
+    0x00, 0x80, 0xff, 0xee, 0x13, 0x00,
+    0x00, 0x00, 0xff, 0x00, 0x10, 0x00,
+    0xed, 0x01, 0xc0, 0xee, 0x11, 0x00,
+    0xe1, 0x0f, 0xc0, 0xee, 0x11, 0x00,
+    0x00, 0x00, 0xc3, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0xfe, 0xff, 0xff, 0x03,
+    0x00, 0x00, 0xc8, 0xff, 0xe7, 0x03,
+    0x00, 0xc0, 0xff, 0xef, 0x33, 0x00,
+    0xff, 0x7f, 0xff, 0xff, 0x33, 0x00,
+    0xef, 0x0f, 0xc0, 0xef, 0x11, 0x00,
+    0xff, 0x7f, 0xff, 0xff, 0x3f, 0x00,
+    0xef, 0x0f, 0xc0, 0xff, 0x33, 0x00,
+    0xed, 0x01, 0xc0, 0xff, 0x3f, 0x00,
+    0xed, 0x01, 0xc0, 0xee, 0x13, 0x00,
+    0xe1, 0x0f, 0xc0, 0xec, 0x11, 0x00,
+    0xe1, 0x0f, 0xc0, 0xff, 0x3f, 0x00,
+    0x00, 0x00, 0xc0, 0x00, 0x30, 0x00,
+    0x00, 0xc0, 0xff, 0xff, 0xff, 0x03,
+    0x00, 0x00, 0xc3, 0xff, 0x3f, 0x00,
+    0x00, 0x00, 0xff, 0x00, 0x11, 0x00,
+    0x00, 0x00, 0xff, 0xee, 0x31, 0x00,
+    0xff, 0x0f, 0xc0, 0xff, 0x33, 0x00,
+    0xe1, 0x01, 0x80, 0x00, 0x10, 0x00,
+    0xef, 0x01, 0xc0, 0xff, 0x3f, 0x00,
+    0xef, 0x01, 0xc0, 0xee, 0x13, 0x00,
+    0x0f, 0x00, 0xfe, 0xff, 0xff, 0x03,
+    0x00, 0x00, 0xfa, 0xff, 0xc7, 0x03,
+    0xff, 0xff, 0xff, 0xff, 0x3f, 0x00,
+    0xff, 0x1f, 0xff, 0xff, 0x33, 0x00,
+    0xe1, 0x01, 0xc0, 0x00, 0x10, 0x00,
+    0xef, 0x0f, 0xc0, 0xff, 0x3f, 0x00,
+    0xef, 0x0f, 0xff, 0xee, 0x13, 0x00,
+    0xff, 0x7f, 0xff, 0xff, 0x11, 0x00,
+    0xff, 0x1f, 0xff, 0xff, 0x13, 0x00,
+    0xe1, 0x01, 0xc0, 0x2c, 0x10, 0x00,
+    0xef, 0x0f, 0xff, 0xfe, 0x11, 0x00,
+    0xe1, 0x0f, 0xc0, 0x3c, 0x10, 0x00,
+    0xe1, 0x0f, 0xc0, 0xff, 0x33, 0x00,
+    0x00, 0x00, 0xc0, 0x3e, 0x31, 0x00,
+    0x00, 0x80, 0xc3, 0xff, 0xff, 0x03,
+    0x0f, 0x00, 0xca, 0x3f, 0x00, 0x00,
+    0x00, 0x0c, 0xc0, 0xfe, 0x33, 0x00,
+    0x00, 0x00, 0x00, 0xee, 0x11, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x03,
+    0xef, 0x7f, 0xff, 0xff, 0x3f, 0x00,
+    0xe0, 0x0f, 0xff, 0xff, 0x3f, 0x00,
+    0x00, 0x00, 0xc0, 0xec, 0x11, 0x00,
+    0x00, 0x0e, 0xc0, 0xff, 0x3f, 0x00,
+    0x00, 0x0e, 0xff, 0xfe, 0x3f, 0x00,
+    0x80, 0x0e, 0xc0, 0xfe, 0x33, 0x00,
+    0x80, 0x0f, 0xc0, 0xff, 0x3f, 0x00,
+    0x80, 0x3f, 0xc0, 0xff, 0x3f, 0x00,
+    0x00, 0x00, 0xc0, 0xec, 0x33, 0x00,
+    0x00, 0x00, 0xc0, 0xff, 0xff, 0x03,
+    0x00, 0x00, 0xc0, 0x00, 0x10, 0x00,
+    0x0f, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x0c, 0xc0, 0xfe, 0x13, 0x00,
+    0x00, 0x00, 0x80, 0xfe, 0x11, 0x00,
+    0xe5, 0x0f, 0xff, 0xff, 0x3f, 0x00,
+    0x00, 0x00, 0x80, 0xfc, 0x11, 0x00,
+    0x00, 0x0e, 0x80, 0xff, 0x3f, 0x00,
+    0x00, 0x0e, 0xff, 0xff, 0x3f, 0x00,
+    0x80, 0x0e, 0x80, 0xff, 0x33, 0x00,
+    0x80, 0x0e, 0xc0, 0xff, 0x3f, 0x00,
+    0x81, 0x3f, 0xc0, 0xfc, 0x3f, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x80, 0xec, 0x11, 0x00,
+    0x00, 0x00, 0x82, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0xc2, 0x00, 0x11, 0x00,
+    0x00, 0x00, 0xc0, 0x6c, 0x11, 0x00,
+    0x1f, 0x00, 0xcb, 0xff, 0x3f, 0x00,
+    0x0f, 0x00, 0xc0, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0xc0, 0x7e, 0x11, 0x00,
+    0xff, 0x07, 0xfb, 0xff, 0x3f, 0x00,
+    0x0f, 0x00, 0xca, 0x7f, 0x00, 0x00,
+    0x00, 0x0c, 0x00, 0xee, 0x11, 0x00,
+    0xef, 0xff, 0xff, 0xff, 0x3f, 0x00,
+    0xef, 0x7f, 0xef, 0xff, 0x3f, 0x00,
+    0x05, 0x0e, 0xef, 0xff, 0x3f, 0x00,
+    0x00, 0x00, 0x06, 0xfe, 0x11, 0x00,
+    0x00, 0x0c, 0x8f, 0xff, 0x3f, 0x00,
+    0x00, 0x0c, 0xaf, 0xff, 0x3f, 0x00,
+    0x00, 0x0c, 0x06, 0xfe, 0x3f, 0x00,
+    0x8f, 0x2f, 0x06, 0xfe, 0x33, 0x00,
+    0xef, 0xff, 0xbf, 0xff, 0x3f, 0x00,
+    0x02, 0x00, 0x82, 0xff, 0x3f, 0x00,
+    0x1f, 0x00, 0x00, 0xfe, 0x11, 0x00,
+    0x1f, 0x00, 0x00, 0xfe, 0x3f, 0x00,
+    0x1f, 0x00, 0x00, 0xec, 0x33, 0x00,
+    0x08, 0x00, 0x00, 0xec, 0x3f, 0x00,
+    0x00, 0x00, 0xc0, 0xff, 0x3f, 0x00,
+    0x0f, 0x00, 0xfa, 0xff, 0xff, 0x03,
+    0x00, 0x00, 0xf8, 0xff, 0xff, 0x03,
+    0xef, 0xff, 0xff, 0xff, 0x13, 0x00,
+    0xef, 0x7f, 0xef, 0xef, 0x11, 0x00,
+    0x05, 0x0e, 0xef, 0xff, 0x11, 0x00,
+    0x00, 0x00, 0x06, 0x00, 0x11, 0x00,
+    0x00, 0x0c, 0x8f, 0xff, 0x11, 0x00,
+    0x00, 0x0c, 0xaf, 0xfe, 0x11, 0x00,
+    0x00, 0x0c, 0xaf, 0xee, 0x11, 0x00,
+    0x00, 0x0c, 0x06, 0xee, 0x11, 0x00,
+    0x8f, 0x2f, 0x06, 0x00, 0x11, 0x00,
+    0xef, 0xff, 0xbf, 0x0e, 0x11, 0x00,
+    0x02, 0x00, 0x82, 0xee, 0x11, 0x00,
+    0x1f, 0x00, 0x00, 0x6e, 0x10, 0x00,
+    0x1f, 0x00, 0x00, 0xee, 0x33, 0x00,
+    0x1f, 0x00, 0x00, 0x00, 0x11, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x11, 0x00,
+    0xef, 0xff, 0xef, 0xef, 0x11, 0x00,
+    0xef, 0x7f, 0xaf, 0x02, 0x11, 0x00,
+    0x05, 0x0e, 0x8f, 0x00, 0x11, 0x00,
+    0x00, 0x0c, 0x07, 0xee, 0x11, 0x00,
+    0x00, 0x0c, 0x8f, 0xee, 0x11, 0x00,
+    0x00, 0x0c, 0x07, 0x00, 0x11, 0x00,
+    0x00, 0x0c, 0x00, 0x00, 0x11, 0x00,
+    0x8f, 0x2f, 0x00, 0x00, 0x10, 0x00,
+    0xef, 0xff, 0x0f, 0x00, 0x11, 0x00,
+    0x02, 0x00, 0x80, 0x00, 0x11, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x01, 0x00, 0xfa, 0xff, 0xff, 0x03,
+    0x00, 0x3e, 0x8f, 0x02, 0x11, 0x00,
+    0x00, 0x2e, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x0e, 0x8f, 0x00, 0x11, 0x00,
+    0x0f, 0x2e, 0x00, 0x00, 0x10, 0x00,
+    0x8f, 0xff, 0x0f, 0x00, 0x11, 0x00,
+    0x07, 0x0e, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x80, 0x00, 0x11, 0x00,
+    0xef, 0x3f, 0x8f, 0x02, 0x11, 0x00,
+    0x8f, 0x2f, 0x07, 0x00, 0x00, 0x00,
+    0x0f, 0x0e, 0x8f, 0x00, 0x11, 0x00,
+    0x05, 0x0c, 0x07, 0xee, 0x11, 0x00,
+    0x05, 0x0c, 0x8f, 0xee, 0x11, 0x00,
+    0x01, 0x0c, 0x07, 0x00, 0x11, 0x00,
+    0x01, 0x0c, 0x00, 0x00, 0x11, 0x00,
+    0x8f, 0x0f, 0x00, 0x00, 0x10, 0x00,
+    0x0f, 0x00, 0xfa, 0xff, 0x7f, 0x00,
+    0x0f, 0x00, 0xc2, 0xff, 0x1f, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x11, 0x00,
+    0x0f, 0x0e, 0x00, 0x00, 0x00, 0x00,
+    0x8f, 0x3f, 0x07, 0x00, 0x11, 0x00,
+    0x00, 0x00, 0xc0, 0xff, 0x1f, 0x00,
+    0x01, 0x00, 0x82, 0xff, 0x1f, 0x00,
+    0x01, 0x00, 0x82, 0xff, 0x07, 0x00,
+    0xef, 0x3f, 0x07, 0x00, 0x11, 0x00,
+    0x8f, 0x2f, 0x07, 0x00, 0x10, 0x00,
+    0x0f, 0x0e, 0x87, 0xec, 0x11, 0x00,
+    0x05, 0x0c, 0x07, 0xfe, 0x11, 0x00,
+    0x05, 0x0c, 0x07, 0xec, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+    0x0f, 0x0e, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x80, 0xfe, 0x1f, 0x00,
+    0xef, 0x3f, 0x8f, 0xee, 0x11, 0x00,
+    0x8f, 0x2f, 0x07, 0x00, 0x11, 0x00,
+    0x8f, 0x6f, 0x8f, 0xfe, 0x11, 0x00,
+    0x00, 0x0c, 0x01, 0x00, 0x11, 0x00,
+    0x0f, 0x0c, 0x07, 0xfe, 0x13, 0x00,
+    0x0f, 0x0c, 0x8f, 0xfe, 0x11, 0x00,
+    0x01, 0x0e, 0x87, 0xec, 0x11, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x11, 0x00,
+    0x8f, 0x0f, 0x00, 0x00, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x6e, 0x11, 0x00,
+    0xef, 0x3f, 0xaf, 0xee, 0x11, 0x00,
+    0x8f, 0x2f, 0x87, 0x00, 0x11, 0x00,
+    0x0f, 0x0e, 0xaf, 0xfe, 0x11, 0x00,
+    0x05, 0x0c, 0x07, 0x00, 0x11, 0x00,
+    0x05, 0x0c, 0x8e, 0xff, 0x11, 0x00,
+    0x05, 0x0c, 0xaf, 0xfe, 0x11, 0x00,
+    0x01, 0x0c, 0x8e, 0xec, 0x11, 0x00,
+    0x01, 0x0c, 0x06, 0xec, 0x11, 0x00,
+    0x8f, 0x2f, 0x0e, 0x00, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0xfe, 0x13, 0x00,
+    0x0f, 0x00, 0x82, 0xff, 0x07, 0x00,
+    0x04, 0x00, 0x46, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xef, 0xff, 0xff, 0xff, 0x31, 0x00,
+    0x8f, 0x3f, 0xff, 0x00, 0x01, 0x00,
+    0x0f, 0x0c, 0xff, 0x00, 0x01, 0x00,
+    0x0f, 0x6c, 0xff, 0x00, 0x01, 0x00,
+    0x0f, 0x0c, 0xfe, 0xef, 0x01, 0x00,
+    0x0f, 0x0c, 0xff, 0xee, 0x01, 0x00,
+    0x07, 0x0c, 0xfe, 0x00, 0x01, 0x00,
+    0x07, 0x0c, 0xe6, 0x00, 0x01, 0x00,
+    0x8f, 0x2f, 0x06, 0x00, 0x01, 0x00,
+    0xef, 0x3f, 0xbf, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x80, 0x0c, 0x01, 0x00,
+    0x00, 0x00, 0x80, 0xff, 0xff, 0x03,
+    0x01, 0x00, 0x80, 0xbe, 0xf3, 0x03,
+    0x0f, 0x00, 0xf2, 0xff, 0xff, 0x03,
+    0x01, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x01, 0x00, 0xc0, 0xec, 0x33, 0x00,
+    0x07, 0x0c, 0xe6, 0xee, 0x01, 0x00,
+    0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+    0x0d, 0x0c, 0xff, 0x00, 0x01, 0x00,
+    0x87, 0xff, 0xff, 0xee, 0x01, 0x00,
+    0x07, 0x0c, 0xff, 0x00, 0x00, 0x00,
+    0x07, 0x6c, 0xff, 0x00, 0x00, 0x00,
+    0x07, 0x0c, 0xfe, 0x0c, 0x01, 0x00,
+    0x07, 0x0c, 0xfe, 0x00, 0x00, 0x00,
+    0x07, 0x0c, 0xa6, 0xfc, 0x31, 0x00,
+    0x07, 0x0c, 0x06, 0xe8, 0x31, 0x00,
+    0x87, 0x0f, 0xee, 0xfc, 0x3f, 0x00,
+    0x00, 0x00, 0x82, 0xec, 0x31, 0x00,
+    0x00, 0x00, 0x80, 0xfd, 0xff, 0x03,
+    0x00, 0x00, 0xc0, 0x2c, 0x30, 0x00,
+    0x01, 0x00, 0xf2, 0x3f, 0x30, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x01, 0x00,
+    0x87, 0x6f, 0xff, 0xee, 0x01, 0x00,
+    0x07, 0x0c, 0xee, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0xee, 0x00, 0x00, 0x00,
+    0x07, 0x0c, 0xef, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0xee, 0x0c, 0x01, 0x00,
+    0x07, 0x0c, 0xee, 0x0c, 0x01, 0x00,
+    0x07, 0x00, 0x86, 0xfc, 0x31, 0x00,
+    0x87, 0x0f, 0xae, 0xfc, 0x3f, 0x00,
+    0x07, 0x00, 0x86, 0xec, 0x01, 0x00,
+    0x07, 0x0c, 0x06, 0x08, 0x01, 0x00,
+    0x87, 0x0f, 0xae, 0xec, 0x33, 0x00,
+    0x00, 0x00, 0x82, 0x00, 0x31, 0x00,
+    0x00, 0x00, 0x80, 0xed, 0x33, 0x00,
+    0x00, 0x00, 0xc0, 0x0c, 0x30, 0x00,
+    0x01, 0x00, 0xf2, 0x2f, 0x00, 0x00,
+    0x00, 0x00, 0x82, 0x0d, 0x31, 0x00,
+    0x00, 0x00, 0x82, 0xfd, 0x33, 0x00,
+    0x00, 0x00, 0xf2, 0x0d, 0x30, 0x00,
+    0x00, 0x00, 0x80, 0x0d, 0x31, 0x00,
+    0x00, 0x00, 0xc0, 0x0c, 0x00, 0x00,
+    0x01, 0x00, 0xc0, 0x0d, 0x00, 0x00,
+    0x8f, 0xff, 0xff, 0xee, 0x01, 0x00,
+    0x07, 0x6c, 0xef, 0x00, 0x00, 0x00,
+    0x07, 0x0c, 0x86, 0xec, 0x01, 0x00,
+    0x00, 0x00, 0x82, 0xed, 0x33, 0x00,
+    0x01, 0x00, 0xc0, 0x3f, 0x30, 0x00,
+    0x04, 0xe0, 0xff, 0x0c, 0x01, 0x00,
+    0x07, 0xec, 0xff, 0xfe, 0x3f, 0x00,
+    0x06, 0xe0, 0xff, 0x0c, 0x01, 0x00,
+    0x06, 0xe0, 0xff, 0x00, 0x01, 0x00,
+    0x06, 0xe0, 0xff, 0x00, 0x00, 0x00,
+    0x0f, 0xe0, 0xff, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0xff, 0x0c, 0x01, 0x00,
+    0x04, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x80, 0x0c, 0x01, 0x00,
+    0x07, 0x00, 0x80, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0xc0, 0xec, 0x01, 0x00,
+    0x07, 0x00, 0x00, 0xe8, 0x01, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x9f, 0x0d, 0xfe, 0x00, 0x00, 0x00,
+    0x9f, 0x0d, 0x46, 0x00, 0x00, 0x00,
+    0xff, 0x0f, 0xfe, 0x0c, 0x00, 0x00,
+    0xff, 0x7f, 0xf8, 0x2f, 0x00, 0x00,
+    0x06, 0x60, 0xff, 0x0c, 0x01, 0x00,
+    0x07, 0x00, 0xc0, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0xc0, 0xfc, 0x01, 0x00,
+    0xff, 0x0d, 0x46, 0x0c, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x08, 0x01, 0x00,
+    0x06, 0x00, 0xef, 0xec, 0x01, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x01, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x01, 0x00,
+    0x06, 0x00, 0x00, 0x08, 0x01, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1d, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x08, 0x01, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xe7, 0x0c, 0x39, 0x00,
+    0x06, 0x60, 0xff, 0xee, 0x39, 0x00,
+    0x04, 0x00, 0xef, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0xe7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x43, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x67, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xe8, 0x01, 0x00,
+    0x07, 0x00, 0x00, 0xff, 0x7f, 0x00,
+    0x07, 0x00, 0x00, 0xfc, 0x01, 0x00,
+    0x0f, 0x00, 0x46, 0x0f, 0x01, 0x00,
+    0x0d, 0x00, 0x00, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x1f, 0x00, 0x00,
+    0xfd, 0x03, 0xfe, 0x2f, 0x00, 0x00,
+    0x00, 0xe0, 0xff, 0x0c, 0x39, 0x00,
+    0x0e, 0xe0, 0xff, 0xee, 0x39, 0x00,
+    0x00, 0xe0, 0xff, 0x00, 0x01, 0x00,
+    0x00, 0xe0, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0x47, 0x00, 0x00, 0x00,
+    0x04, 0xe0, 0x67, 0x00, 0x00, 0x00,
+    0x04, 0x60, 0x67, 0x00, 0x00, 0x00,
+    0x04, 0x60, 0xef, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0xe8, 0x01, 0x00,
+    0x0f, 0x00, 0x86, 0xff, 0x7f, 0x00,
+    0x0f, 0x00, 0x00, 0xfc, 0x01, 0x00,
+    0x00, 0xe0, 0xff, 0xff, 0x39, 0x00,
+    0x0e, 0xec, 0xff, 0xff, 0xff, 0x03,
+    0x04, 0xec, 0xff, 0xef, 0x39, 0x00,
+    0x00, 0xe0, 0xff, 0x0f, 0x39, 0x00,
+    0x04, 0xe0, 0xff, 0x00, 0x01, 0x00,
+    0x8e, 0xed, 0xff, 0x00, 0x00, 0x00,
+    0x86, 0xed, 0xff, 0xef, 0x01, 0x00,
+    0x8e, 0xed, 0xff, 0xee, 0x01, 0x00,
+    0x8f, 0x0d, 0x06, 0xee, 0x01, 0x00,
+    0x87, 0x0f, 0x86, 0x0c, 0x01, 0x00,
+    0x8f, 0x0f, 0xa6, 0xfe, 0x3f, 0x00,
+    0xff, 0x6f, 0xff, 0xff, 0x7f, 0x00,
+    0xdf, 0x0f, 0xfe, 0xff, 0x7f, 0x00,
+    0xff, 0x0f, 0xfe, 0xff, 0x7f, 0x00,
+    0xff, 0x03, 0xfe, 0x3f, 0x7f, 0x00,
+    0x0c, 0xec, 0xff, 0xff, 0xff, 0x03,
+    0x3f, 0xec, 0xff, 0xff, 0xff, 0x03,
+    0x00, 0xec, 0xff, 0xff, 0xff, 0x03,
+    0x00, 0xe0, 0xff, 0xff, 0xff, 0x03,
+    0xff, 0xef, 0xff, 0x00, 0x38, 0x00,
+    0xc4, 0xed, 0xff, 0x2f, 0x00, 0x00,
+    0xc4, 0xed, 0xff, 0x2e, 0x00, 0x00,
+    0xcf, 0x0d, 0xa6, 0x2e, 0x00, 0x00,
+    0x80, 0x01, 0xa0, 0x00, 0x00, 0x00,
+    0x80, 0x0d, 0xe0, 0xfc, 0x7f, 0x00,
+    0xff, 0x6f, 0xef, 0xff, 0xff, 0x03,
+    0x97, 0x0f, 0xee, 0xfc, 0x7f, 0x00,
+    0xdf, 0x0f, 0xfe, 0x1f, 0x70, 0x00,
+    0x81, 0x01, 0xfe, 0x0f, 0x00, 0x00,
+    0x91, 0x03, 0x40, 0x01, 0x00, 0x00,
+    0x00, 0xec, 0xff, 0xef, 0xff, 0x03,
+    0x00, 0xe0, 0xff, 0xef, 0xff, 0x03,
+    0x00, 0xe0, 0xff, 0x00, 0x38, 0x00,
+    0xff, 0xef, 0xff, 0x00, 0x00, 0x00,
+    0xc4, 0xed, 0xff, 0x0e, 0x00, 0x00,
+    0x08, 0xec, 0xff, 0xff, 0xff, 0x03,
+    0x3c, 0xec, 0xff, 0xff, 0xff, 0x03,
+    0xfc, 0xef, 0xff, 0x00, 0x38, 0x00,
+    0xc0, 0xed, 0xff, 0x2f, 0x00, 0x00,
+    0xc0, 0xed, 0xff, 0xff, 0x3f, 0x00,
+    0xcc, 0x0d, 0x06, 0xff, 0x3f, 0x00,
+    0x80, 0x01, 0x00, 0x0e, 0x00, 0x00,
+    0x80, 0x0d, 0x80, 0xfe, 0x7f, 0x00,
+    0x90, 0x0f, 0xee, 0xfc, 0x7f, 0x00,
+    0x00, 0xe0, 0xff, 0x0d, 0x39, 0x00,
+    0x00, 0x60, 0xef, 0x00, 0x38, 0x00,
+    0x00, 0xe0, 0x6f, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xff, 0xef, 0x3f, 0x00,
+    0x00, 0x00, 0xff, 0x0d, 0x39, 0x00,
+    0x00, 0x00, 0xec, 0x00, 0x38, 0x00,
+    0x00, 0x00, 0xed, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xff, 0xef, 0x01, 0x00,
+    0x00, 0xe0, 0xff, 0xff, 0x3f, 0x00,
+    0x00, 0x00, 0xa4, 0xff, 0x7f, 0x00,
+    0x00, 0x00, 0xa0, 0x2f, 0x00, 0x00,
+    0x00, 0x00, 0xa0, 0xff, 0xff, 0x03,
+    0xff, 0x6f, 0xff, 0xff, 0xff, 0x03,
+    0x90, 0x0f, 0xee, 0xff, 0x7f, 0x00,
+    0xdf, 0x0f, 0xfe, 0x3f, 0x7f, 0x00,
+    0x81, 0x01, 0xfe, 0x1f, 0x00, 0x00,
+    0x81, 0x01, 0xfe, 0x1f, 0x70, 0x00,
+    0x91, 0x03, 0xfc, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x2e, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xfe, 0x7f, 0x00,
+    0xd9, 0x0f, 0xef, 0xff, 0xff, 0x03,
+    0x91, 0x0f, 0xec, 0xfc, 0x7f, 0x00,
+    0x91, 0x03, 0xfe, 0x1f, 0x30, 0x00,
+    0x00, 0x00, 0x02, 0xfe, 0xff, 0x03,
+    0x00, 0x00, 0x00, 0xfe, 0x3f, 0x00,
+    0x00, 0x00, 0x00, 0x0c, 0x18, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0x38, 0x00,
+    0xcc, 0x61, 0xff, 0xff, 0xff, 0x03,
+    0xcc, 0xe1, 0xff, 0xff, 0xff, 0x03,
+    0xcc, 0x01, 0x00, 0xfe, 0xff, 0x03,
+    0x80, 0x01, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x80, 0x01, 0x00, 0x0c, 0x00, 0x00,
+    0x90, 0x03, 0xff, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xfe, 0xff, 0x03,
+    0x00, 0x00, 0x00, 0x08, 0x38, 0x00,
+    0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
+    0x80, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xee, 0x3f, 0x00,
+    0x00, 0x00, 0x00, 0xf8, 0x38, 0x00,
+    0x00, 0x00, 0x00, 0xf8, 0x3f, 0x00,
+    0x00, 0x60, 0xff, 0xff, 0xff, 0x03,
+    0x00, 0x00, 0x00, 0xf8, 0x3f, 0x03,
+    0x00, 0x00, 0xfc, 0xff, 0xff, 0x03,
+    0x00, 0x00, 0xfe, 0xff, 0x3f, 0x00,
+    0x00, 0x00, 0x00, 0xfc, 0xff, 0x03,
+    0x00, 0x00, 0x00, 0xf8, 0xff, 0x03,
+    0x80, 0x00, 0x00, 0xfe, 0xff, 0x03,
+    0x00, 0x00, 0x00, 0x18, 0x39, 0x03,
+    0x80, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0xfe, 0x03, 0xff, 0xff, 0x01, 0x03,
+    0x00, 0x00, 0x02, 0xfe, 0x3f, 0x00,
+    0x0c, 0x00, 0x02, 0xee, 0x3f, 0x00,
+    0xcc, 0x01, 0x03, 0x08, 0x38, 0x00,
+    0xcc, 0x21, 0x03, 0x00, 0x00, 0x00,
+    0xfc, 0x63, 0xff, 0xff, 0xff, 0x03,
+    0xfc, 0xe3, 0xff, 0xff, 0xff, 0x03,
+    0xfc, 0x03, 0xff, 0xff, 0xff, 0x03,
+    0x90, 0x03, 0x00, 0x0e, 0x00, 0x00,
+    0x90, 0x03, 0x00, 0x06, 0x00, 0x00,
+    0xde, 0x03, 0xff, 0x07, 0x00, 0x00,
+    0xfe, 0x07, 0xff, 0xff, 0x01, 0x03,
+    0xfe, 0x03, 0xff, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0xee, 0x3f, 0x00,
+    0x00, 0x00, 0x03, 0x08, 0x38, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+    0xfe, 0xfd, 0xff, 0xff, 0xff, 0x03,
+    0x3e, 0x4c, 0xff, 0xff, 0x3f, 0x00,
+    0xfe, 0xff, 0xff, 0x1d, 0x3f, 0x03,
+    0xff, 0xff, 0xff, 0x1f, 0x3f, 0x03,
+    0xff, 0xff, 0x7f, 0x08, 0x00, 0x00,
+    0xfe, 0xff, 0xff, 0xff, 0xff, 0x03,
+    0xff, 0xff, 0xff, 0x07, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x0f, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x1f, 0x00, 0x00,
+    0xde, 0x73, 0xff, 0x0f, 0x00, 0x03,
+    0xde, 0x73, 0xff, 0x0f, 0x00, 0x00,
+    0xfe, 0x03, 0xff, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xef, 0x3f, 0x00,
+    0x3c, 0x4c, 0xff, 0xef, 0x3f, 0x00,
+    0xcc, 0xe1, 0x03, 0x08, 0x38, 0x00,
+    0xfe, 0xe3, 0xff, 0x09, 0x38, 0x00,
+    0xff, 0xe3, 0x03, 0x00, 0x00, 0x00,
+    0xff, 0xf3, 0xff, 0xff, 0xff, 0x03,
+    0xdf, 0xf3, 0xff, 0x01, 0x00, 0x00,
+    0xdf, 0xf3, 0xff, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0xf0, 0x07, 0x00, 0x00,
+    0x80, 0x00, 0xff, 0x07, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x01, 0x00, 0x00,
+    0xfe, 0x07, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1e, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0x3f, 0x00, 0x00,
+    0x81, 0x41, 0xff, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0xf0, 0x05, 0x00, 0x00,
+    0x90, 0x73, 0xff, 0x00, 0x00, 0x00,
+    0xfe, 0x1d, 0xfe, 0xef, 0xff, 0x03,
+    0x81, 0x01, 0xff, 0x07, 0x00, 0x00,
+    0x80, 0x01, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+    0x81, 0x41, 0xff, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0xf0, 0x0d, 0x00, 0x00,
+    0xff, 0x7f, 0xff, 0xff, 0xff, 0x03,
+    0x01, 0x00, 0x00, 0x0c, 0x00, 0x00,
+    0x81, 0x01, 0x00, 0x04, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x81, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x1f, 0xff, 0xff, 0xff, 0x00,
+    0x91, 0x03, 0xff, 0x00, 0xe0, 0x00,
+    0x81, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xe0, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xe0, 0x02,
+    0xdf, 0x03, 0x00, 0xe0, 0xff, 0x03,
+    0x81, 0x03, 0x00, 0xe0, 0xff, 0x03,
+    0x81, 0x03, 0x00, 0xe0, 0xff, 0x00,
+    0x9f, 0x03, 0x00, 0xe0, 0xff, 0x03,
+    0x81, 0x00, 0x00, 0xe0, 0xff, 0x02,
+    0x81, 0x00, 0x00, 0xe0, 0xff, 0x00,
+    0x81, 0x00, 0x00, 0xe0, 0xdf, 0x02,
+    0x81, 0x00, 0x00, 0xe0, 0x1f, 0x00,
+    0x9d, 0x03, 0x00, 0xe0, 0xff, 0x03,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x9d, 0x03, 0x00, 0x00, 0xfc, 0x03,
+    0x81, 0x00, 0x00, 0x00, 0xdc, 0x03,
+    0x81, 0x00, 0x00, 0x00, 0x1c, 0x00,
+    0xff, 0xff, 0xff, 0xf9, 0xff, 0x03,
+    0xcd, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0xcd, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x77, 0x00, 0xe0, 0xff, 0x03,
+    0xdf, 0x73, 0x00, 0x00, 0xfc, 0x03,
+    0xdf, 0x73, 0x00, 0x00, 0x7c, 0x02,
+    0xff, 0x77, 0x00, 0x00, 0xfc, 0x03,
+    0xdf, 0x73, 0x00, 0x00, 0xdc, 0x03,
+    0xdf, 0x73, 0x00, 0x00, 0x1c, 0x00,
+    0x87, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x8c, 0x7f, 0x3f, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x7f, 0xfe, 0xff, 0x03,
+    0xfe, 0x73, 0x3f, 0x00, 0x00, 0x02,
+    0xfe, 0x73, 0x3f, 0x00, 0x00, 0x00,
+    0xff, 0x73, 0x3f, 0x00, 0xe0, 0x03,
+    0xff, 0x73, 0x3f, 0xc0, 0xff, 0x03,
+    0xff, 0xff, 0xff, 0xfe, 0xff, 0x03,
+    0xff, 0x03, 0x3f, 0x00, 0x00, 0x00,
+};
+
+static const ModelRegions MODEL_REGIONS = {
+    { MODEL_REGIONS_SOIL_THRESHOLDS, MODEL_REGIONS_TEMP_THRESHOLDS, MODEL_REGIONS_HUM_THRESHOLDS },
+    { 109, 21, 41 },
+    MODEL_REGIONS_ROW_INDEX,
+    MODEL_REGIONS_ROWS,
+    MODEL_REGIONS_ROW_COUNT,
+    MODEL_REGIONS_ROW_BYTES,
+};
+
+#endif
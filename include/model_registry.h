@@ -0,0 +1,51 @@
+#ifndef MODEL_REGISTRY_H
+#define MODEL_REGISTRY_H
+
+// Nhiều mô hình (mỗi vùng tưới một mô hình) dùng chung một bảng node. Mỗi mô hình
+// chỉ có bảng gốc/lớp riêng trỏ vào bảng chung (model_pool.h); cây giống nhau
+// giữa các mô hình được duyệt một lần cho cả lượt. Không phụ thuộc Arduino.
+
+#include "model_engine.h"
+
+#define MODEL_REGISTRY_MAX_MODELS 4
+#define MODEL_REGISTRY_MAX_TREES 192    // tổng số cây của mọi mô hình (kể cả trùng)
+
+class ModelRegistry {
+    public:
+        ModelRegistry();
+
+        // Đặt mô hình id (0..MODEL_REGISTRY_MAX_MODELS-1, liền nhau từ 0). Bảng phải
+        // sống lâu hơn registry. false nếu id không hợp lệ hoặc vượt số cây tối đa
+        bool set(uint8_t id, const ModelTables& tables);
+        void clear();
+
+        uint8_t modelCount() const { return count; }
+        const ModelTables& tables(uint8_t id) const { return models[id]; }
+
+        // Số cây khác nhau phải duyệt mỗi lượt predictAll
+        uint16_t uniqueTrees() const { return uniqueCount; }
+        uint16_t totalTrees() const;
+
+        // Duyệt mỗi cây khác nhau đúng một lần cho x, rồi cộng votes của từng mô
+        // hình theo thứ tự cây của nó: out[id] trùng bit với TreeEnsemble::predictFull
+        void predictAll(const float* x, uint8_t* out);
+        // Chỉ mô hình id (cộng đủ cây như TreeEnsemble::predict), cho vùng có vector đặc
+        // trưng riêng; cùng kết quả với out[id] của predictAll trên cùng x
+        int predict(uint8_t id, const float* x, uint16_t* treesEvaluated = nullptr) const;
+
+    private:
+        void rebuild();
+
+        ModelTables models[MODEL_REGISTRY_MAX_MODELS];
+        uint8_t count;
+        // Cây khác nhau, nhận diện bằng (bảng node, gốc)
+        const ModelNode* treeNodes[MODEL_REGISTRY_MAX_TREES];
+        uint16_t treeRoots[MODEL_REGISTRY_MAX_TREES];
+        uint16_t uniqueCount;
+        // Cây thứ t của mô hình id là cây khác nhau slots[offsets[id] + t]
+        uint16_t slots[MODEL_REGISTRY_MAX_TREES];
+        uint16_t offsets[MODEL_REGISTRY_MAX_MODELS + 1];
+        float leaves[MODEL_REGISTRY_MAX_TREES];
+};
+
+#endif
@@ -0,0 +1,2595 @@
+// model_table.h
+// Sinh tự động bởi tools/model_export.py từ irrigation_xgb.json - không sửa tay.
+
+#ifndef MODEL_TABLE_H
+#define MODEL_TABLE_H
+
+#include "model_engine.h"
+
+// Đầu vào: 3 mục đầu (soil, temperature, humidity) của vector đặc trưng feature_store.h
+#define MODEL_FEATURE_LAYOUT_VERSION 1
+#define MODEL_TABLE_TREE_COUNT 41
+#define MODEL_TABLE_NODE_COUNT 2243
+#define MODEL_TABLE_POOL_NODE_COUNT 2243   // kể cả cây của các mô hình vùng (model_pool.h)
+#define MODEL_THRESHOLD 0.54f
+#define MODEL_LOGIT_THRESHOLD 0.16034265f
+
+// Bảng constexpr: TreeEnsemble đọc lúc chạy, UnrolledEnsemble (model_unrolled.h)
+// trải thành code và static_assert kiểm tra lúc build
+// Node: { feature, right, value } - con trái luôn là node kế tiếp
+constexpr ModelNode MODEL_TABLE_NODES[MODEL_TABLE_POOL_NODE_COUNT] = {
+    { 0, 32, 504.642822f },
+    { 0, 13, 414.901276f },
+    { 0, 4, 314.835846f },
+    { 255, 0, -0.272476137f },
+    { 1, 10, 38.3529434f },
+    { 1, 7, 20.2102623f },
+    { 255, 0, 0.0128484461f },
+    { 1, 9, 31.5958576f },
+    { 255, 0, -0.224116698f },
+    { 255, 0, -0.15956521f },
+    { 2, 12, 58.3609047f },
+    { 255, 0, 0.121853739f },
+    { 255, 0, -0.116872855f },
+    { 1, 21, 32.8193092f },
+    { 2, 20, 48.5084915f },
+    { 0, 19, 443.64624f },
+    { 0, 18, 437.694153f },
+    { 255, 0, -0.0779144466f },
+    { 255, 0, 0.121853739f },
+    { 255, 0, -0.178318784f },
+    { 255, 0, -0.238200054f },
+    { 2, 27, 61.8882256f },
+    { 1, 26, 37.1719971f },
+    { 2, 25, 54.3874397f },
+    { 255, 0, 0.147279873f },
+    { 255, 0, 0.000324264081f },
+    { 255, 0, 0.206642523f },
+    { 1, 29, 34.6546669f },
+    { 255, 0, -0.204046145f },
+    { 2, 31, 71.1944275f },
+    { 255, 0, 0.10088513f },
+    { 255, 0, -0.0151045974f },
+    { 0, 56, 625.170166f },
+    { 1, 47, 32.3084106f },
+    { 2, 42, 63.751545f },
+    { 0, 39, 576.561096f },
+    { 2, 38, 43.2635002f },
+    { 255, 0, 0.100428037f },
+    { 255, 0, -0.0992854834f },
+    { 2, 41, 55.3870468f },
+    { 255, 0, 0.130148545f },
+    { 255, 0, -0.0447905958f },
+    { 1, 44, 29.7924881f },
+    { 255, 0, -0.238929257f },
+    { 0, 46, 571.920654f },
+    { 255, 0, -0.12988545f },
+    { 255, 0, 0.151352346f },
+    { 1, 55, 35.5903358f },
+    { 2, 52, 69.243866f },
+    { 2, 51, 56.2749748f },
+    { 255, 0, 0.18431294f },
+    { 255, 0, 0.0918907672f },
+    { 0, 54, 568.22876f },
+    { 255, 0, -0.116872855f },
+    { 255, 0, 0.0437818579f },
+    { 255, 0, 0.213468388f },
+    { 1, 70, 22.7132282f },
+    { 0, 65, 738.240356f },
+    { 2, 62, 55.3870468f },
+    { 0, 61, 637.041443f },
+    { 255, 0, 0.0996434167f },
+    { 255, 0, -0.00349683035f },
+    { 2, 64, 76.4636459f },
+    { 255, 0, -0.152702183f },
+    { 255, 0, 0.0166309793f },
+    { 1, 67, 20.0188656f },
+    { 255, 0, -0.166805491f },
+    { 0, 69, 939.830566f },
+    { 255, 0, 0.166235626f },
+    { 255, 0, -0.0593282804f },
+    { 0, 78, 770.63739f },
+    { 2, 75, 67.8146362f },
+    { 0, 74, 723.110596f },
+    { 255, 0, 0.217719823f },
+    { 255, 0, 0.151513189f },
+    { 1, 77, 28.6260338f },
+    { 255, 0, -0.0385291651f },
+    { 255, 0, 0.163532272f },
+    { 2, 80, 40.0642738f },
+    { 255, 0, -0.0593282804f },
+    { 0, 82, 947.555847f },
+    { 255, 0, 0.215075538f },
+    { 255, 0, 0.0151447896f },
+    { 0, 117, 576.561096f },
+    { 0, 96, 423.757202f },
+    { 0, 87, 314.835846f },
+    { 255, 0, -0.236885369f },
+    { 1, 93, 38.3000298f },
+    { 1, 90, 20.2102623f },
+    { 255, 0, 0.0119574144f },
+    { 1, 92, 31.5958576f },
+    { 255, 0, -0.199428141f },
+    { 255, 0, -0.134880483f },
+    { 2, 95, 59.2451096f },
+    { 255, 0, 0.117959023f },
+    { 255, 0, -0.121182993f },
+    { 1, 108, 33.7817535f },
+    { 2, 105, 63.751545f },
+    { 1, 102, 32.2109337f },
+    { 2, 101, 43.2635002f },
+    { 255, 0, 0.0431740321f },
+    { 255, 0, -0.132782891f },
+    { 1, 104, 33.3304367f },
+    { 255, 0, 0.127276167f },
+    { 255, 0, -0.0599770844f },
+    { 0, 107, 430.821411f },
+    { 255, 0, -0.0652486235f },
+    { 255, 0, -0.211284727f },
+    { 2, 110, 56.4054871f },
+    { 255, 0, 0.187009141f },
+    { 1, 114, 36.5741768f },
+    { 0, 113, 479.104919f },
+    { 255, 0, -0.172955051f },
+    { 255, 0, 0.0181375965f },
+    { 2, 116, 80.5668564f },
+    { 255, 0, 0.173659638f },
+    { 255, 0, 0.00469471235f },
+    { 1, 141, 25.0434551f },
+    { 0, 134, 738.240356f },
+    { 2, 127, 57.7745628f },
+    { 0, 124, 667.424072f },
+    { 0, 123, 637.041443f },
+    { 255, 0, 0.0618891343f },
+    { 255, 0, -0.0901317298f },
+    { 1, 126, 22.6435928f },
+    { 255, 0, 0.0417299569f },
+    { 255, 0, 0.160354495f },
+    { 2, 131, 76.4636459f },
+    { 2, 130, 65.8288727f },
+    { 255, 0, -0.0293807182f },
+    { 255, 0, -0.156736076f },
+    { 2, 133, 79.6292648f },
+    { 255, 0, 0.11558181f },
+    { 255, 0, -0.153996915f },
+    { 1, 136, 20.1292877f },
+    { 255, 0, -0.123714544f },
+    { 0, 140, 947.555847f },
+    { 0, 139, 862.270081f },
+    { 255, 0, 0.138719544f },
+    { 255, 0, 0.189164713f },
+    { 255, 0, -0.0790834874f },
+    { 0, 151, 625.170166f },
+    { 1, 150, 30.384491f },
+    { 2, 147, 58.0878334f },
+    { 1, 146, 28.9362946f },
+    { 255, 0, 0.166083276f },
+    { 255, 0, 0.0065219081f },
+    { 2, 149, 61.101387f },
+    { 255, 0, -0.0133264558f },
+    { 255, 0, -0.149621099f },
+    { 255, 0, 0.179473758f },
+    { 2, 153, 40.0642738f },
+    { 255, 0, -0.0173324905f },
+    { 2, 157, 69.2937241f },
+    { 0, 156, 947.555847f },
+    { 255, 0, 0.192821175f },
+    { 255, 0, 0.0117982049f },
+    { 0, 159, 734.138062f },
+    { 255, 0, 0.0695599616f },
+    { 255, 0, 0.18943283f },
+    { 0, 196, 544.882202f },
+    { 0, 177, 414.901276f },
+    { 0, 164, 314.835846f },
+    { 255, 0, -0.212747112f },
+    { 2, 170, 62.6410065f },
+    { 2, 169, 61.8882256f },
+    { 1, 168, 38.3000298f },
+    { 255, 0, -0.13191551f },
+    { 255, 0, 0.0346908718f },
+    { 255, 0, 0.104590937f },
+    { 0, 174, 407.900116f },
+    { 1, 173, 38.3529434f },
+    { 255, 0, -0.193947747f },
+    { 255, 0, -0.0648008958f },
+    { 2, 176, 70.602066f },
+    { 255, 0, -0.126668438f },
+    { 255, 0, 0.0354111008f },
+    { 1, 187, 34.1479378f },
+    { 2, 186, 62.0385475f },
+    { 1, 183, 32.2109337f },
+    { 2, 182, 44.8780136f },
+    { 255, 0, -0.0164399482f },
+    { 255, 0, -0.149044409f },
+    { 0, 185, 447.999878f },
+    { 255, 0, -0.0458242968f },
+    { 255, 0, 0.127481848f },
+    { 255, 0, -0.190099761f },
+    { 2, 189, 59.2451096f },
+    { 255, 0, 0.161318526f },
+    { 1, 193, 38.3529434f },
+    { 0, 192, 479.104919f },
+    { 255, 0, -0.103896804f },
+    { 255, 0, 0.0218044072f },
+    { 0, 195, 443.64624f },
+    { 255, 0, 0.0489140153f },
+    { 255, 0, 0.158381149f },
+    { 0, 218, 625.170166f },
+    { 1, 211, 31.1099033f },
+    { 2, 204, 52.9265976f },
+    { 1, 201, 24.0817528f },
+    { 255, 0, 0.150863469f },
+    { 1, 203, 24.7294979f },
+    { 255, 0, -0.119380407f },
+    { 255, 0, 0.089047499f },
+    { 1, 208, 27.744463f },
+    { 1, 207, 23.5818996f },
+    { 255, 0, -0.207519174f },
+    { 255, 0, -0.109503537f },
+    { 2, 210, 62.1497269f },
+    { 255, 0, 0.0601249225f },
+    { 255, 0, -0.120349064f },
+    { 1, 217, 33.5487595f },
+    { 0, 216, 571.920654f },
+    { 0, 215, 563.617065f },
+    { 255, 0, 0.0862701982f },
+    { 255, 0, -0.0849637762f },
+    { 255, 0, 0.137801692f },
+    { 255, 0, 0.176139027f },
+    { 1, 232, 22.7132282f },
+    { 0, 227, 785.920593f },
+    { 2, 224, 56.4054871f },
+    { 1, 223, 22.2793179f },
+    { 255, 0, 0.08928442f },
+    { 255, 0, -0.06630674f },
+    { 0, 226, 738.240356f },
+    { 255, 0, -0.0851046741f },
+    { 255, 0, 0.0061845975f },
+    { 1, 229, 20.1292877f },
+    { 255, 0, -0.072089456f },
+    { 0, 231, 939.830566f },
+    { 255, 0, 0.160539493f },
+    { 255, 0, -0.0498447269f },
+    { 0, 240, 770.63739f },
+    { 2, 237, 67.8146362f },
+    { 0, 236, 723.110596f },
+    { 255, 0, 0.181704879f },
+    { 255, 0, 0.118233904f },
+    { 1, 239, 28.6260338f },
+    { 255, 0, -0.0392786339f },
+    { 255, 0, 0.135685474f },
+    { 2, 242, 40.0642738f },
+    { 255, 0, -0.0540417098f },
+    { 0, 244, 947.555847f },
+    { 255, 0, 0.17742762f },
+    { 255, 0, 0.0111871911f },
+    { 0, 289, 504.642822f },
+    { 0, 266, 414.901276f },
+    { 0, 253, 314.835846f },
+    { 2, 252, 42.1177483f },
+    { 1, 251, 36.2934189f },
+    { 255, 0, -0.165548161f },
+    { 255, 0, 0.0650848597f },
+    { 255, 0, -0.198077619f },
+    { 2, 259, 62.6410065f },
+    { 2, 258, 61.8882256f },
+    { 0, 257, 330.207428f },
+    { 255, 0, -0.00220829272f },
+    { 255, 0, -0.121618964f },
+    { 255, 0, 0.0965830758f },
+    { 0, 263, 407.900116f },
+    { 1, 262, 38.3529434f },
+    { 255, 0, -0.175283402f },
+    { 255, 0, -0.0601561181f },
+    { 1, 265, 30.5218792f },
+    { 255, 0, -0.119428866f },
+    { 255, 0, 0.0333755799f },
+    { 1, 278, 33.7817535f },
+    { 2, 275, 53.7436066f },
+    { 1, 272, 30.0575085f },
+    { 1, 271, 22.5222015f },
+    { 255, 0, 0.0188639816f },
+    { 255, 0, -0.185630471f },
+    { 2, 274, 46.7297173f },
+    { 255, 0, -0.0449911542f },
+    { 255, 0, 0.0689642206f },
+    { 1, 277, 33.2605438f },
+    { 255, 0, -0.171579406f },
+    { 255, 0, -0.0381053686f },
+    { 2, 286, 71.1944275f },
+    { 1, 283, 37.1719971f },
+    { 2, 282, 54.3874397f },
+    { 255, 0, 0.120954081f },
+    { 255, 0, -0.0125114461f },
+    { 0, 285, 419.505035f },
+    { 255, 0, 0.0529990643f },
+    { 255, 0, 0.169378802f },
+    { 0, 288, 481.389587f },
+    { 255, 0, -0.135069668f },
+    { 255, 0, 0.0696824118f },
+    { 0, 311, 625.170166f },
+    { 1, 304, 32.3084106f },
+    { 2, 299, 63.751545f },
+    { 0, 296, 581.963745f },
+    { 2, 295, 42.4820442f },
+    { 255, 0, 0.112433143f },
+    { 255, 0, -0.0611597002f },
+    { 2, 298, 55.3870468f },
+    { 255, 0, 0.110925213f },
+    { 255, 0, -0.0395249687f },
+    { 1, 301, 29.7924881f },
+    { 255, 0, -0.176620021f },
+    { 0, 303, 571.920654f },
+    { 255, 0, -0.089740172f },
+    { 255, 0, 0.132494688f },
+    { 2, 306, 65.8288727f },
+    { 255, 0, 0.16193983f },
+    { 1, 310, 36.5741768f },
+    { 0, 309, 541.012268f },
+    { 255, 0, -0.118216492f },
+    { 255, 0, 0.0500374213f },
+    { 255, 0, 0.155512989f },
+    { 1, 325, 22.7132282f },
+    { 0, 320, 785.920593f },
+    { 2, 317, 52.2610207f },
+    { 0, 316, 723.110596f },
+    { 255, 0, -0.0140586691f },
+    { 255, 0, 0.139889315f },
+    { 0, 319, 757.170593f },
+    { 255, 0, -0.0149183264f },
+    { 255, 0, -0.121836565f },
+    { 1, 322, 20.1292877f },
+    { 255, 0, -0.0668142363f },
+    { 0, 324, 939.830566f },
+    { 255, 0, 0.147606641f },
+    { 255, 0, -0.0464935973f },
+    { 1, 333, 35.3305435f },
+    { 0, 330, 768.336487f },
+    { 2, 329, 69.2937241f },
+    { 255, 0, 0.141072288f },
+    { 255, 0, 0.0256794356f },
+    { 0, 332, 947.555847f },
+    { 255, 0, 0.155397654f },
+    { 255, 0, -0.0605572611f },
+    { 255, 0, 0.17407681f },
+    { 0, 384, 544.882202f },
+    { 0, 355, 423.757202f },
+    { 0, 344, 314.835846f },
+    { 1, 339, 38.3000298f },
+    { 255, 0, -0.186582863f },
+    { 2, 341, 42.4820442f },
+    { 255, 0, 0.0684328973f },
+    { 0, 343, 283.323853f },
+    { 255, 0, -0.167865112f },
+    { 255, 0, -0.0337910578f },
+    { 1, 350, 38.3000298f },
+    { 1, 347, 20.2102623f },
+    { 255, 0, 0.0280819423f },
+    { 1, 349, 31.5958576f },
+    { 255, 0, -0.150873989f },
+    { 255, 0, -0.091266349f },
+    { 2, 352, 58.3609047f },
+    { 255, 0, 0.131553575f },
+    { 1, 354, 38.9854584f },
+    { 255, 0, 0.0249706432f },
+    { 255, 0, -0.148817465f },
+    { 1, 369, 32.5350685f },
+    { 2, 362, 44.8780136f },
+    { 2, 359, 40.996048f },
+    { 255, 0, -0.0960290506f },
+    { 1, 361, 24.2286224f },
+    { 255, 0, 0.104397379f },
+    { 255, 0, -0.014798319f },
+    { 1, 366, 29.7018929f },
+    { 1, 365, 20.7989597f },
+    { 255, 0, -0.0532626733f },
+    { 255, 0, -0.159772098f },
+    { 1, 368, 31.3860989f },
+    { 255, 0, 0.0110609261f },
+    { 255, 0, -0.144520894f },
+    { 2, 377, 62.0385475f },
+    { 2, 374, 54.3874397f },
+    { 2, 373, 41.4611816f },
+    { 255, 0, 0.0357211307f },
+    { 255, 0, 0.154999331f },
+    { 2, 376, 57.5607338f },
+    { 255, 0, 0.0141365919f },
+    { 255, 0, 0.119801648f },
+    { 1, 381, 36.5741768f },
+    { 1, 380, 35.2870636f },
+    { 255, 0, -0.156029776f },
+    { 255, 0, -0.0229059868f },
+    { 0, 383, 481.389587f },
+    { 255, 0, 0.0138995517f },
+    { 255, 0, 0.14359948f },
+    { 1, 406, 27.744463f },
+    { 0, 399, 738.240356f },
+    { 2, 392, 52.9265976f },
+    { 1, 391, 25.6510048f },
+    { 0, 390, 581.963745f },
+    { 255, 0, -0.0094999643f },
+    { 255, 0, 0.0963382646f },
+    { 255, 0, 0.160770819f },
+    { 0, 396, 625.170166f },
+    { 1, 395, 23.5818996f },
+    { 255, 0, -0.179580435f },
+    { 255, 0, -0.0856047496f },
+    { 2, 398, 65.8288727f },
+    { 255, 0, 0.0261442047f },
+    { 255, 0, -0.0815918371f },
+    { 1, 401, 20.0188656f },
+    { 255, 0, -0.136447176f },
+    { 0, 405, 947.555847f },
+    { 1, 404, 21.3451176f },
+    { 255, 0, 0.0844496116f },
+    { 255, 0, 0.142643675f },
+    { 255, 0, -0.0268017091f },
+    { 1, 420, 35.3305435f },
+    { 0, 415, 622.761047f },
+    { 2, 412, 63.751545f },
+    { 1, 411, 31.1099033f },
+    { 255, 0, 0.0380110443f },
+    { 255, 0, 0.123322859f },
+    { 1, 414, 29.7924881f },
+    { 255, 0, -0.145814404f },
+    { 255, 0, 0.0486489385f },
+    { 2, 417, 40.0642738f },
+    { 255, 0, -0.0278251003f },
+    { 1, 419, 34.8325424f },
+    { 255, 0, 0.138409063f },
+    { 255, 0, 0.0683637112f },
+    { 255, 0, 0.163978666f },
+    { 0, 453, 504.642822f },
+    { 0, 428, 314.835846f },
+    { 2, 427, 42.1177483f },
+    { 1, 426, 36.2934189f },
+    { 255, 0, -0.144322425f },
+    { 255, 0, 0.0629100278f },
+    { 255, 0, -0.174743012f },
+    { 1, 438, 31.5958576f },
+    { 1, 431, 19.2320633f },
+    { 255, 0, 0.126402423f },
+    { 0, 435, 330.207428f },
+    { 2, 434, 69.0979462f },
+    { 255, 0, -0.00391960703f },
+    { 255, 0, -0.12819545f },
+    { 2, 437, 40.3054695f },
+    { 255, 0, -0.0304524247f },
+    { 255, 0, -0.14708671f },
+    { 0, 446, 417.264038f },
+    { 1, 443, 33.8789864f },
+    { 1, 442, 33.3304367f },
+    { 255, 0, -0.0288205761f },
+    { 255, 0, 0.0864461735f },
+    { 1, 445, 38.3529434f },
+    { 255, 0, -0.137960151f },
+    { 255, 0, 0.00532246241f },
+    { 1, 450, 34.6546669f },
+    { 2, 449, 60.7390938f },
+    { 255, 0, 0.0470087193f },
+    { 255, 0, -0.158291131f },
+    { 2, 452, 54.3874397f },
+    { 255, 0, 0.151944503f },
+    { 255, 0, 0.0440595895f },
+    { 0, 479, 625.170166f },
+    { 1, 470, 32.3084106f },
+    { 2, 463, 63.751545f },
+    { 2, 460, 42.4820442f },
+    { 0, 459, 601.795471f },
+    { 255, 0, 0.123769097f },
+    { 255, 0, 0.00697644986f },
+    { 0, 462, 581.963745f },
+    { 255, 0, -0.0468908697f },
+    { 255, 0, 0.0399480239f },
+    { 1, 467, 29.7924881f },
+    { 0, 466, 601.795471f },
+    { 255, 0, -0.17094104f },
+    { 255, 0, -0.0785338506f },
+    { 2, 469, 67.9678268f },
+    { 255, 0, -0.117622986f },
+    { 255, 0, 0.0974882096f },
+    { 1, 478, 35.5903358f },
+    { 2, 475, 69.243866f },
+    { 0, 474, 534.459778f },
+    { 255, 0, 0.0389842167f },
+    { 255, 0, 0.121862181f },
+    { 2, 477, 77.484726f },
+    { 255, 0, -0.0909730271f },
+    { 255, 0, 0.0211363677f },
+    { 255, 0, 0.149323195f },
+    { 1, 493, 22.7132282f },
+    { 0, 486, 785.920593f },
+    { 2, 485, 78.805069f },
+    { 2, 484, 76.4636459f },
+    { 255, 0, -0.0176632553f },
+    { 255, 0, 0.114345476f },
+    { 255, 0, -0.123114407f },
+    { 2, 490, 46.8502693f },
+    { 0, 489, 827.341675f },
+    { 255, 0, 0.097597152f },
+    { 255, 0, -0.0701556653f },
+    { 1, 492, 20.1292877f },
+    { 255, 0, -0.0420829244f },
+    { 255, 0, 0.142198786f },
+    { 1, 501, 35.3305435f },
+    { 0, 498, 768.336487f },
+    { 2, 497, 67.8146362f },
+    { 255, 0, 0.124818161f },
+    { 255, 0, 0.0188825317f },
+    { 0, 500, 947.555847f },
+    { 255, 0, 0.135710686f },
+    { 255, 0, -0.059736602f },
+    { 255, 0, 0.153567031f },
+    { 0, 534, 481.389587f },
+    { 0, 511, 314.835846f },
+    { 1, 506, 38.3000298f },
+    { 255, 0, -0.168395564f },
+    { 2, 508, 42.4820442f },
+    { 255, 0, 0.0657445863f },
+    { 0, 510, 283.323853f },
+    { 255, 0, -0.149759889f },
+    { 255, 0, -0.0197824743f },
+    { 1, 527, 38.3529434f },
+    { 2, 520, 56.715847f },
+    { 1, 517, 31.9208717f },
+    { 1, 516, 19.2320633f },
+    { 255, 0, 0.118695445f },
+    { 255, 0, -0.121682495f },
+    { 0, 519, 423.757202f },
+    { 255, 0, -0.0338250771f },
+    { 255, 0, 0.0804797858f },
+    { 2, 524, 66.0044632f },
+    { 0, 523, 467.623199f },
+    { 255, 0, -0.106612593f },
+    { 255, 0, 0.00680464972f },
+    { 0, 526, 321.81543f },
+    { 255, 0, -0.0570352674f },
+    { 255, 0, -0.144121945f },
+    { 1, 529, 39.1129875f },
+    { 255, 0, 0.131739631f },
+    { 2, 531, 57.7745628f },
+    { 255, 0, 0.120086633f },
+    { 0, 533, 397.247711f },
+    { 255, 0, -0.124027953f },
+    { 255, 0, -0.011667178f },
+    { 0, 556, 590.554199f },
+    { 1, 549, 34.1479378f },
+    { 2, 544, 63.751545f },
+    { 1, 541, 26.7441292f },
+    { 2, 540, 51.8712692f },
+    { 255, 0, -0.0198514741f },
+    { 255, 0, -0.135132819f },
+    { 0, 543, 560.389099f },
+    { 255, 0, 0.0570172779f },
+    { 255, 0, -0.0359499864f },
+    { 1, 546, 30.2948437f },
+    { 255, 0, -0.163797542f },
+    { 1, 548, 31.3860989f },
+    { 255, 0, 0.0841657743f },
+    { 255, 0, -0.13178277f },
+    { 1, 555, 36.5741768f },
+    { 2, 552, 58.911232f },
+    { 255, 0, 0.11974676f },
+    { 2, 554, 70.602066f },
+    { 255, 0, -0.168281257f },
+    { 255, 0, 0.0765698329f },
+    { 255, 0, 0.154715791f },
+    { 1, 572, 25.0434551f },
+    { 0, 565, 723.110596f },
+    { 2, 562, 57.7745628f },
+    { 0, 561, 667.424072f },
+    { 255, 0, 0.00270242128f },
+    { 255, 0, 0.10265144f },
+    { 1, 564, 20.3994579f },
+    { 255, 0, 0.0691799745f },
+    { 255, 0, -0.0990173593f },
+    { 1, 569, 20.1292877f },
+    { 2, 568, 65.8288727f },
+    { 255, 0, -0.136275023f },
+    { 255, 0, -0.0331427306f },
+    { 0, 571, 947.555847f },
+    { 255, 0, 0.10569749f },
+    { 255, 0, -0.0667364895f },
+    { 1, 580, 35.3305435f },
+    { 2, 577, 69.2937241f },
+    { 1, 576, 35.1345978f },
+    { 255, 0, 0.124076977f },
+    { 255, 0, -0.0508705862f },
+    { 0, 579, 732.35437f },
+    { 255, 0, -0.0104074292f },
+    { 255, 0, 0.124356396f },
+    { 255, 0, 0.147380725f },
+    { 0, 609, 481.389587f },
+    { 0, 590, 314.835846f },
+    { 1, 585, 38.3000298f },
+    { 255, 0, -0.161789045f },
+    { 2, 587, 42.4820442f },
+    { 255, 0, 0.0607579201f },
+    { 0, 589, 283.323853f },
+    { 255, 0, -0.143115625f },
+    { 255, 0, -0.0184575487f },
+    { 1, 604, 38.3529434f },
+    { 2, 599, 56.715847f },
+    { 1, 596, 31.9208717f },
+    { 1, 595, 19.2320633f },
+    { 255, 0, 0.11188896f },
+    { 255, 0, -0.111446604f },
+    { 2, 598, 42.7032928f },
+    { 255, 0, -0.112300865f },
+    { 255, 0, 0.0333852433f },
+    { 2, 603, 78.0548477f },
+    { 2, 602, 77.484726f },
+    { 255, 0, -0.106348678f },
+    { 255, 0, 0.0601735376f },
+    { 255, 0, -0.160763234f },
+    { 2, 608, 76.1152267f },
+    { 0, 607, 386.113647f },
+    { 255, 0, 0.00535953417f },
+    { 255, 0, 0.1239039f },
+    { 255, 0, -0.0545609668f },
+    { 0, 635, 625.170166f },
+    { 1, 626, 30.6314411f },
+    { 2, 619, 55.5911179f },
+    { 0, 616, 581.963745f },
+    { 2, 615, 43.2635002f },
+    { 255, 0, 0.0354773179f },
+    { 255, 0, -0.0652411506f },
+    { 0, 618, 619.163086f },
+    { 255, 0, 0.108415954f },
+    { 255, 0, -0.0325988904f },
+    { 2, 623, 63.751545f },
+    { 2, 622, 59.4178658f },
+    { 255, 0, -0.137461245f },
+    { 255, 0, 0.0284429342f },
+    { 0, 625, 601.795471f },
+    { 255, 0, -0.158804521f },
+    { 255, 0, -0.0486617759f },
+    { 1, 634, 35.2870636f },
+    { 0, 631, 571.920654f },
+    { 0, 630, 563.617065f },
+    { 255, 0, 0.0227789804f },
+    { 255, 0, -0.117837593f },
+    { 2, 633, 69.4708176f },
+    { 255, 0, 0.126271173f },
+    { 255, 0, 0.0420619659f },
+    { 255, 0, 0.137349471f },
+    { 1, 649, 25.0434551f },
+    { 0, 644, 738.240356f },
+    { 2, 641, 57.7745628f },
+    { 1, 640, 21.2505245f },
+    { 255, 0, -0.0423329249f },
+    { 255, 0, 0.0946461633f },
+    { 1, 643, 24.2286224f },
+    { 255, 0, -0.0159460381f },
+    { 255, 0, -0.147353172f },
+    { 1, 646, 20.0188656f },
+    { 255, 0, -0.119669303f },
+    { 0, 648, 947.555847f },
+    { 255, 0, 0.10161382f },
+    { 255, 0, -0.0619282462f },
+    { 2, 651, 40.0642738f },
+    { 255, 0, -0.0434301272f },
+    { 0, 655, 790.879639f },
+    { 2, 654, 67.8146362f },
+    { 255, 0, 0.128271133f },
+    { 255, 0, 0.0480944738f },
+    { 0, 657, 947.555847f },
+    { 255, 0, 0.136191368f },
+    { 255, 0, 0.0148494039f },
+    { 0, 688, 544.882202f },
+    { 0, 665, 314.835846f },
+    { 2, 664, 42.1177483f },
+    { 1, 663, 36.2934189f },
+    { 255, 0, -0.122038834f },
+    { 255, 0, 0.0625707656f },
+    { 255, 0, -0.154554844f },
+    { 1, 675, 32.1663895f },
+    { 1, 668, 19.2320633f },
+    { 255, 0, 0.105824403f },
+    { 2, 672, 62.1497269f },
+    { 2, 671, 61.4699364f },
+    { 255, 0, -0.0852143615f },
+    { 255, 0, 0.0995237902f },
+    { 1, 674, 30.384491f },
+    { 255, 0, -0.137677476f },
+    { 255, 0, -0.0644348934f },
+    { 0, 681, 407.900116f },
+    { 1, 678, 32.6003685f },
+    { 255, 0, 0.139706299f },
+    { 2, 680, 54.2410927f },
+    { 255, 0, -0.0346194245f },
+    { 255, 0, -0.119171105f },
+    { 2, 685, 62.0385475f },
+    { 1, 684, 37.1719971f },
+    { 255, 0, 0.0507734455f },
+    { 255, 0, 0.142505333f },
+    { 1, 687, 33.4218636f },
+    { 255, 0, -0.124882288f },
+    { 255, 0, 0.0148374839f },
+    { 1, 710, 27.744463f },
+    { 0, 703, 738.240356f },
+    { 2, 696, 52.9265976f },
+    { 2, 695, 51.1242714f },
+    { 2, 694, 49.2791176f },
+    { 255, 0, 0.0756250471f },
+    { 255, 0, -0.0307321716f },
+    { 255, 0, 0.146092474f },
+    { 1, 700, 26.3607903f },
+    { 0, 699, 597.551147f },
+    { 255, 0, -0.138725564f },
+    { 255, 0, -0.0212365445f },
+    { 0, 702, 571.920654f },
+    { 255, 0, -0.026861323f },
+    { 255, 0, -0.183425203f },
+    { 1, 705, 20.0188656f },
+    { 255, 0, -0.113025226f },
+    { 0, 709, 947.555847f },
+    { 1, 708, 21.3451176f },
+    { 255, 0, 0.0542803705f },
+    { 255, 0, 0.110686429f },
+    { 255, 0, -0.0195448138f },
+    { 1, 724, 36.1142883f },
+    { 0, 719, 625.170166f },
+    { 2, 716, 63.751545f },
+    { 1, 715, 28.9362946f },
+    { 255, 0, 0.138611674f },
+    { 255, 0, 0.0308705252f },
+    { 2, 718, 80.5668564f },
+    { 255, 0, -0.0714886189f },
+    { 255, 0, 0.108463131f },
+    { 2, 721, 40.4365158f },
+    { 255, 0, -0.0286570322f },
+    { 0, 723, 819.484436f },
+    { 255, 0, 0.0840805769f },
+    { 255, 0, 0.130916044f },
+    { 255, 0, 0.139270499f },
+    { 0, 755, 481.389587f },
+    { 0, 734, 314.835846f },
+    { 1, 729, 38.3000298f },
+    { 255, 0, -0.151998281f },
+    { 0, 731, 252.730637f },
+    { 255, 0, -0.131464198f },
+    { 2, 733, 55.1740875f },
+    { 255, 0, 0.10320916f },
+    { 255, 0, -0.0854208469f },
+    { 1, 748, 38.3529434f },
+    { 2, 743, 66.0044632f },
+    { 1, 740, 31.9208717f },
+    { 1, 739, 22.5222015f },
+    { 255, 0, 0.00323337712f },
+    { 255, 0, -0.100733362f },
+    { 2, 742, 56.4054871f },
+    { 255, 0, 0.0104810838f },
+    { 255, 0, -0.0692484379f },
+    { 0, 747, 430.821411f },
+    { 0, 746, 407.900116f },
+    { 255, 0, -0.118930705f },
+    { 255, 0, -0.00873515941f },
+    { 255, 0, -0.152182043f },
+    { 1, 750, 39.1129875f },
+    { 255, 0, 0.11924196f },
+    { 2, 752, 57.7745628f },
+    { 255, 0, 0.106692284f },
+    { 0, 754, 397.247711f },
+    { 255, 0, -0.109780543f },
+    { 255, 0, -0.0176274553f },
+    { 1, 783, 35.3305435f },
+    { 0, 770, 585.01825f },
+    { 2, 765, 63.751545f },
+    { 1, 762, 26.7441292f },
+    { 2, 761, 44.8780136f },
+    { 255, 0, 0.0207924414f },
+    { 255, 0, -0.0885158032f },
+    { 0, 764, 560.389099f },
+    { 255, 0, 0.0567846261f },
+    { 255, 0, -0.0369131528f },
+    { 1, 767, 30.2948437f },
+    { 255, 0, -0.143596664f },
+    { 1, 769, 31.3860989f },
+    { 255, 0, 0.0815798268f },
+    { 255, 0, -0.0998682678f },
+    { 0, 778, 770.63739f },
+    { 2, 775, 66.1435776f },
+    { 1, 774, 23.9091587f },
+    { 255, 0, 0.0142183602f },
+    { 255, 0, 0.0893419906f },
+    { 1, 777, 29.7924881f },
+    { 255, 0, -0.0477636196f },
+    { 255, 0, 0.0777936056f },
+    { 0, 782, 947.555847f },
+    { 1, 781, 21.0124493f },
+    { 255, 0, -0.0203899369f },
+    { 255, 0, 0.108769387f },
+    { 255, 0, -0.0655791909f },
+    { 255, 0, 0.129525557f },
+    { 0, 810, 479.104919f },
+    { 0, 793, 314.835846f },
+    { 1, 788, 38.3000298f },
+    { 255, 0, -0.148151502f },
+    { 0, 790, 252.730637f },
+    { 255, 0, -0.126732364f },
+    { 2, 792, 55.1740875f },
+    { 255, 0, 0.093472749f },
+    { 255, 0, -0.0818791911f },
+    { 1, 803, 38.3529434f },
+    { 2, 800, 65.2610092f },
+    { 2, 799, 65.1251373f },
+    { 1, 798, 20.2102623f },
+    { 255, 0, 0.0677565411f },
+    { 255, 0, -0.0541141406f },
+    { 255, 0, 0.0670937225f },
+    { 0, 802, 321.81543f },
+    { 255, 0, -0.0273584835f },
+    { 255, 0, -0.113396101f },
+    { 2, 809, 76.1152267f },
+    { 1, 806, 39.1129875f },
+    { 255, 0, 0.129138023f },
+    { 2, 808, 57.7745628f },
+    { 255, 0, 0.101765811f },
+    { 255, 0, -0.0543653443f },
+    { 255, 0, -0.051074136f },
+    { 1, 842, 35.3305435f },
+    { 0, 827, 625.170166f },
+    { 2, 820, 56.2749748f },
+    { 1, 817, 25.6510048f },
+    { 1, 816, 24.0817528f },
+    { 255, 0, 0.0110622682f },
+    { 255, 0, -0.0928074121f },
+    { 2, 819, 51.3940468f },
+    { 255, 0, 0.0390842557f },
+    { 255, 0, 0.124714881f },
+    { 1, 824, 30.6314411f },
+    { 0, 823, 601.795471f },
+    { 255, 0, -0.110736743f },
+    { 255, 0, -0.0329028703f },
+    { 1, 826, 31.5958576f },
+    { 255, 0, 0.0875658393f },
+    { 255, 0, -0.0276547335f },
+    { 1, 835, 22.7132282f },
+    { 0, 832, 785.920593f },
+    { 2, 831, 78.805069f },
+    { 255, 0, -0.00411189161f },
+    { 255, 0, -0.128750056f },
+    { 2, 834, 46.8502693f },
+    { 255, 0, -0.0304266457f },
+    { 255, 0, 0.0997316167f },
+    { 2, 839, 69.2937241f },
+    { 1, 838, 35.1345978f },
+    { 255, 0, 0.0976464003f },
+    { 255, 0, -0.0700104162f },
+    { 0, 841, 718.093689f },
+    { 255, 0, -0.0348503366f },
+    { 255, 0, 0.0944568738f },
+    { 255, 0, 0.123025693f },
+    { 0, 861, 423.757202f },
+    { 0, 846, 296.413544f },
+    { 255, 0, -0.142830238f },
+    { 1, 856, 38.5422096f },
+    { 2, 849, 44.4773293f },
+    { 255, 0, -0.148645878f },
+    { 2, 853, 63.4145584f },
+    { 2, 852, 61.8882256f },
+    { 255, 0, -0.0501768142f },
+    { 255, 0, 0.0845108777f },
+    { 0, 855, 367.197571f },
+    { 255, 0, -0.131603882f },
+    { 255, 0, -0.0481240265f },
+    { 2, 858, 58.3609047f },
+    { 255, 0, 0.15426448f },
+    { 1, 860, 38.9854584f },
+    { 255, 0, 0.00453590648f },
+    { 255, 0, -0.122720405f },
+    { 0, 887, 590.554199f },
+    { 1, 876, 33.7817535f },
+    { 2, 871, 65.2610092f },
+    { 2, 868, 43.2635002f },
+    { 2, 867, 40.996048f },
+    { 255, 0, -0.00223184447f },
+    { 255, 0, 0.0954893082f },
+    { 2, 870, 46.442112f },
+    { 255, 0, -0.128856421f },
+    { 255, 0, -0.0204929188f },
+    { 2, 875, 73.8990784f },
+    { 2, 874, 72.5990067f },
+    { 255, 0, -0.097158052f },
+    { 255, 0, 0.0582586452f },
+    { 255, 0, -0.137927279f },
+    { 2, 880, 54.3874397f },
+    { 2, 879, 41.4611816f },
+    { 255, 0, 0.0255031325f },
+    { 255, 0, 0.139515907f },
+    { 1, 884, 37.4105377f },
+    { 0, 883, 471.12204f },
+    { 255, 0, -0.105948083f },
+    { 255, 0, 0.00986897759f },
+    { 2, 886, 78.6886444f },
+    { 255, 0, 0.118491277f },
+    { 255, 0, 0.0270415563f },
+    { 1, 901, 25.0434551f },
+    { 0, 894, 695.823792f },
+    { 1, 891, 20.3994579f },
+    { 255, 0, 0.131740719f },
+    { 0, 893, 604.238281f },
+    { 255, 0, 0.123072274f },
+    { 255, 0, -0.0897873268f },
+    { 1, 898, 20.1292877f },
+    { 2, 897, 67.9678268f },
+    { 255, 0, -0.130508423f },
+    { 255, 0, -0.0305666123f },
+    { 2, 900, 79.6292648f },
+    { 255, 0, 0.0751652643f },
+    { 255, 0, -0.00877653342f },
+    { 1, 909, 35.3305435f },
+    { 2, 906, 69.2937241f },
+    { 1, 905, 35.1345978f },
+    { 255, 0, 0.091757305f },
+    { 255, 0, -0.0636579841f },
+    { 0, 908, 790.879639f },
+    { 255, 0, -0.000665186031f },
+    { 255, 0, 0.110293865f },
+    { 255, 0, 0.119415216f },
+    { 0, 936, 423.757202f },
+    { 0, 917, 296.413544f },
+    { 2, 916, 41.8031082f },
+    { 1, 915, 32.6594925f },
+    { 255, 0, -0.0828895569f },
+    { 255, 0, -0.00258212979f },
+    { 255, 0, -0.142233431f },
+    { 1, 927, 31.9208717f },
+    { 2, 920, 48.2610779f },
+    { 255, 0, -0.139564827f },
+    { 2, 924, 62.1497269f },
+    { 0, 923, 405.567444f },
+    { 255, 0, 0.0188344773f },
+    { 255, 0, -0.108369589f },
+    { 1, 926, 30.384491f },
+    { 255, 0, -0.125940964f },
+    { 255, 0, -0.0330228545f },
+    { 1, 929, 32.6003685f },
+    { 255, 0, 0.118929707f },
+    { 0, 933, 407.900116f },
+    { 2, 932, 55.1740875f },
+    { 255, 0, -0.0125078494f },
+    { 255, 0, -0.103308648f },
+    { 2, 935, 57.912468f },
+    { 255, 0, -0.0523883998f },
+    { 255, 0, 0.0812044516f },
+    { 0, 966, 625.170166f },
+    { 1, 953, 33.7817535f },
+    { 2, 946, 55.5911179f },
+    { 2, 943, 51.5628548f },
+    { 2, 942, 49.6859665f },
+    { 255, 0, 0.0151481954f },
+    { 255, 0, -0.18325904f },
+    { 2, 945, 52.9265976f },
+    { 255, 0, 0.147463977f },
+    { 255, 0, 0.0188358184f },
+    { 2, 950, 59.4178658f },
+    { 1, 949, 31.3860989f },
+    { 255, 0, -0.131368205f },
+    { 255, 0, -0.0340960659f },
+    { 2, 952, 60.7390938f },
+    { 255, 0, 0.105116107f },
+    { 255, 0, -0.0677290484f },
+    { 2, 959, 56.4054871f },
+    { 2, 956, 40.996048f },
+    { 255, 0, 0.0201616734f },
+    { 0, 958, 435.861267f },
+    { 255, 0, 0.0331541747f },
+    { 255, 0, 0.131057173f },
+    { 1, 963, 36.5741768f },
+    { 0, 962, 538.327454f },
+    { 255, 0, -0.0716217831f },
+    { 255, 0, 0.0515836589f },
+    { 2, 965, 80.5668564f },
+    { 255, 0, 0.109340511f },
+    { 255, 0, -0.0117183486f },
+    { 1, 980, 28.5101128f },
+    { 0, 975, 741.785583f },
+    { 2, 972, 65.8288727f },
+    { 0, 971, 710.787048f },
+    { 255, 0, 0.0681306571f },
+    { 255, 0, -0.0154019278f },
+    { 1, 974, 25.9988403f },
+    { 255, 0, -0.0184724852f },
+    { 255, 0, -0.173244953f },
+    { 1, 977, 20.0188656f },
+    { 255, 0, -0.102780968f },
+    { 0, 979, 947.555847f },
+    { 255, 0, 0.083906956f },
+    { 255, 0, -0.0497066453f },
+    { 2, 982, 40.4365158f },
+    { 255, 0, -0.0692600384f },
+    { 0, 986, 819.484436f },
+    { 0, 985, 721.237366f },
+    { 255, 0, 0.109320551f },
+    { 255, 0, 0.0406299755f },
+    { 0, 988, 944.020081f },
+    { 255, 0, 0.120229036f },
+    { 255, 0, 0.0394259393f },
+    { 0, 1011, 481.389587f },
+    { 0, 998, 314.835846f },
+    { 1, 993, 38.3000298f },
+    { 255, 0, -0.13985391f },
+    { 0, 995, 252.730637f },
+    { 255, 0, -0.113063671f },
+    { 2, 997, 47.1228828f },
+    { 255, 0, 0.0607726499f },
+    { 255, 0, -0.0122754266f },
+    { 2, 1010, 78.0548477f },
+    { 1, 1005, 38.3529434f },
+    { 2, 1004, 77.484726f },
+    { 0, 1003, 330.207428f },
+    { 255, 0, 0.0357405581f },
+    { 255, 0, -0.0524269007f },
+    { 255, 0, 0.0869193226f },
+    { 1, 1007, 39.1129875f },
+    { 255, 0, 0.124906696f },
+    { 2, 1009, 57.7745628f },
+    { 255, 0, 0.0904387161f },
+    { 255, 0, -0.0486201867f },
+    { 255, 0, -0.140223801f },
+    { 1, 1039, 35.3305435f },
+    { 0, 1026, 585.01825f },
+    { 2, 1021, 63.751545f },
+    { 0, 1018, 560.389099f },
+    { 0, 1017, 544.882202f },
+    { 255, 0, -0.0109714353f },
+    { 255, 0, 0.118264638f },
+    { 2, 1020, 43.5045547f },
+    { 255, 0, 0.0485985167f },
+    { 255, 0, -0.131043658f },
+    { 1, 1023, 30.2948437f },
+    { 255, 0, -0.129040509f },
+    { 1, 1025, 31.3860989f },
+    { 255, 0, 0.0787235349f },
+    { 255, 0, -0.080417417f },
+    { 0, 1034, 770.63739f },
+    { 2, 1031, 53.4475784f },
+    { 0, 1030, 729.404663f },
+    { 255, 0, 0.0919740871f },
+    { 255, 0, 0.00588060729f },
+    { 1, 1033, 30.384491f },
+    { 255, 0, -0.0217569601f },
+    { 255, 0, 0.0807985663f },
+    { 2, 1036, 40.4365158f },
+    { 255, 0, -0.0803437009f },
+    { 1, 1038, 21.0124493f },
+    { 255, 0, -0.0322326869f },
+    { 255, 0, 0.0867212489f },
+    { 1, 1047, 36.8433037f },
+    { 2, 1042, 66.7874527f },
+    { 255, 0, 0.115945928f },
+    { 0, 1046, 785.920593f },
+    { 0, 1045, 571.920654f },
+    { 255, 0, 0.0228198171f },
+    { 255, 0, -0.0991305411f },
+    { 255, 0, 0.101203613f },
+    { 255, 0, 0.123745598f },
+    { 0, 1074, 423.757202f },
+    { 0, 1055, 296.413544f },
+    { 2, 1054, 41.8031082f },
+    { 1, 1053, 30.8926163f },
+    { 255, 0, -0.0716231689f },
+    { 255, 0, -0.00462967716f },
+    { 255, 0, -0.137592241f },
+    { 1, 1065, 31.9208717f },
+    { 2, 1058, 48.2610779f },
+    { 255, 0, -0.132341668f },
+    { 2, 1062, 62.1497269f },
+    { 0, 1061, 405.567444f },
+    { 255, 0, 0.0221601389f },
+    { 255, 0, -0.101516344f },
+    { 1, 1064, 30.384491f },
+    { 255, 0, -0.117899954f },
+    { 255, 0, -0.0288373381f },
+    { 1, 1067, 32.6003685f },
+    { 255, 0, 0.112132825f },
+    { 0, 1071, 407.900116f },
+    { 1, 1070, 38.5422096f },
+    { 255, 0, -0.0743151456f },
+    { 255, 0, 0.0314676091f },
+    { 2, 1073, 57.912468f },
+    { 255, 0, -0.0463250056f },
+    { 255, 0, 0.0755488649f },
+    { 1, 1102, 36.1142883f },
+    { 0, 1089, 590.554199f },
+    { 2, 1084, 56.4054871f },
+    { 1, 1081, 30.8253994f },
+    { 2, 1080, 43.2635002f },
+    { 255, 0, 0.0396118872f },
+    { 255, 0, -0.0575794391f },
+    { 2, 1083, 46.0391083f },
+    { 255, 0, -0.000824489747f },
+    { 255, 0, 0.104065739f },
+    { 2, 1086, 58.2117615f },
+    { 255, 0, -0.141229764f },
+    { 2, 1088, 65.2610092f },
+    { 255, 0, 0.00701405946f },
+    { 255, 0, -0.0848612562f },
+    { 0, 1097, 770.63739f },
+    { 1, 1094, 30.384491f },
+    { 2, 1093, 53.4475784f },
+    { 255, 0, 0.0665858015f },
+    { 255, 0, -0.0190738719f },
+    { 0, 1096, 732.35437f },
+    { 255, 0, 0.1021147f },
+    { 255, 0, -0.0461257696f },
+    { 2, 1099, 40.4365158f },
+    { 255, 0, -0.072100386f },
+    { 1, 1101, 21.0124493f },
+    { 255, 0, -0.0286184102f },
+    { 255, 0, 0.0835479498f },
+    { 0, 1110, 481.389587f },
+    { 2, 1109, 71.1944275f },
+    { 1, 1108, 37.1719971f },
+    { 0, 1107, 458.729126f },
+    { 255, 0, 0.0326888673f },
+    { 255, 0, -0.00781510677f },
+    { 255, 0, 0.122221455f },
+    { 255, 0, -0.0852371603f },
+    { 2, 1112, 79.7098465f },
+    { 255, 0, 0.118118837f },
+    { 1, 1114, 37.0409698f },
+    { 255, 0, -0.0419948883f },
+    { 255, 0, 0.102274798f },
+    { 0, 1145, 423.757202f },
+    { 0, 1120, 296.413544f },
+    { 2, 1119, 41.8031082f },
+    { 255, 0, -0.0480475686f },
+    { 255, 0, -0.135555744f },
+    { 1, 1130, 31.9208717f },
+    { 2, 1123, 48.2610779f },
+    { 255, 0, -0.127426922f },
+    { 2, 1127, 62.1497269f },
+    { 0, 1126, 405.567444f },
+    { 255, 0, 0.0194073915f },
+    { 255, 0, -0.0973577276f },
+    { 1, 1129, 30.384491f },
+    { 255, 0, -0.113150209f },
+    { 255, 0, -0.0268663093f },
+    { 1, 1138, 33.8789864f },
+    { 2, 1135, 53.7436066f },
+    { 0, 1134, 341.632965f },
+    { 255, 0, 0.0678329766f },
+    { 255, 0, -0.0594048947f },
+    { 0, 1137, 359.514069f },
+    { 255, 0, -0.0338188782f },
+    { 255, 0, 0.165597409f },
+    { 1, 1142, 38.3000298f },
+    { 0, 1141, 417.264038f },
+    { 255, 0, -0.085359931f },
+    { 255, 0, 0.0428562202f },
+    { 2, 1144, 58.3609047f },
+    { 255, 0, 0.132006645f },
+    { 255, 0, -0.0811897591f },
+    { 1, 1177, 36.1142883f },
+    { 0, 1162, 625.170166f },
+    { 2, 1155, 56.4054871f },
+    { 1, 1152, 30.8253994f },
+    { 0, 1151, 541.012268f },
+    { 255, 0, -0.0586446077f },
+    { 255, 0, 0.0262880549f },
+    { 0, 1154, 440.630371f },
+    { 255, 0, 0.132501364f },
+    { 255, 0, 0.0545034371f },
+    { 0, 1159, 467.623199f },
+    { 0, 1158, 435.861267f },
+    { 255, 0, -0.00830580387f },
+    { 255, 0, -0.132428378f },
+    { 1, 1161, 30.6314411f },
+    { 255, 0, -0.0590192042f },
+    { 255, 0, 0.00413728645f },
+    { 1, 1170, 22.7132282f },
+    { 0, 1167, 785.920593f },
+    { 2, 1166, 78.805069f },
+    { 255, 0, -0.0100801596f },
+    { 255, 0, -0.122691803f },
+    { 2, 1169, 46.8502693f },
+    { 255, 0, -0.0488800071f },
+    { 255, 0, 0.0800475627f },
+    { 2, 1174, 69.2937241f },
+    { 0, 1173, 710.787048f },
+    { 255, 0, 0.11256431f },
+    { 255, 0, 0.0488399081f },
+    { 0, 1176, 734.138062f },
+    { 255, 0, -0.0315761492f },
+    { 255, 0, 0.0741773248f },
+    { 0, 1185, 481.389587f },
+    { 2, 1184, 71.1944275f },
+    { 1, 1183, 37.1719971f },
+    { 0, 1182, 458.729126f },
+    { 255, 0, 0.0307554435f },
+    { 255, 0, -0.00729976408f },
+    { 255, 0, 0.117528915f },
+    { 255, 0, -0.0790478513f },
+    { 2, 1187, 79.7098465f },
+    { 255, 0, 0.114124291f },
+    { 1, 1189, 37.0409698f },
+    { 255, 0, -0.0385060906f },
+    { 255, 0, 0.0986618847f },
+    { 0, 1210, 423.757202f },
+    { 0, 1195, 296.413544f },
+    { 2, 1194, 41.8031082f },
+    { 255, 0, -0.0449205488f },
+    { 255, 0, -0.133700505f },
+    { 2, 1209, 78.0548477f },
+    { 1, 1204, 31.9208717f },
+    { 2, 1201, 51.6752129f },
+    { 1, 1200, 20.7292194f },
+    { 255, 0, 0.0273695253f },
+    { 255, 0, -0.133792296f },
+    { 2, 1203, 62.1497269f },
+    { 255, 0, 0.0216293149f },
+    { 255, 0, -0.0844039544f },
+    { 1, 1206, 32.6003685f },
+    { 255, 0, 0.0940094143f },
+    { 1, 1208, 38.5422096f },
+    { 255, 0, -0.0378416665f },
+    { 255, 0, 0.0423870608f },
+    { 255, 0, -0.120545924f },
+    { 1, 1232, 36.1142883f },
+    { 0, 1225, 738.240356f },
+    { 2, 1218, 65.8288727f },
+    { 0, 1217, 732.35437f },
+    { 0, 1216, 625.170166f },
+    { 255, 0, 0.000963883882f },
+    { 255, 0, 0.0722103417f },
+    { 255, 0, -0.197840318f },
+    { 1, 1222, 28.8836689f },
+    { 1, 1221, 26.1693649f },
+    { 255, 0, -0.0328372866f },
+    { 255, 0, -0.137872055f },
+    { 0, 1224, 527.904602f },
+    { 255, 0, -0.0758527294f },
+    { 255, 0, 0.0296835043f },
+    { 1, 1227, 20.0188656f },
+    { 255, 0, -0.0961595923f },
+    { 2, 1229, 40.4365158f },
+    { 255, 0, -0.0689287558f },
+    { 0, 1231, 947.555847f },
+    { 255, 0, 0.067685768f },
+    { 255, 0, -0.0509181693f },
+    { 0, 1240, 481.389587f },
+    { 2, 1239, 71.1944275f },
+    { 1, 1238, 37.1719971f },
+    { 0, 1237, 458.729126f },
+    { 255, 0, 0.0289418884f },
+    { 255, 0, -0.00681849616f },
+    { 255, 0, 0.113156289f },
+    { 255, 0, -0.0734138861f },
+    { 2, 1242, 79.7098465f },
+    { 255, 0, 0.110173866f },
+    { 1, 1244, 37.0409698f },
+    { 255, 0, -0.0353201479f },
+    { 255, 0, 0.0952070355f },
+    { 0, 1271, 417.264038f },
+    { 0, 1250, 296.413544f },
+    { 2, 1249, 41.8031082f },
+    { 255, 0, -0.0419795029f },
+    { 255, 0, -0.131986007f },
+    { 2, 1260, 62.6410065f },
+    { 2, 1259, 61.8882256f },
+    { 1, 1256, 38.5422096f },
+    { 2, 1255, 44.4773293f },
+    { 255, 0, -0.124286756f },
+    { 255, 0, -0.0238438658f },
+    { 2, 1258, 55.1740875f },
+    { 255, 0, 0.127917245f },
+    { 255, 0, -0.0111726522f },
+    { 255, 0, 0.139365479f },
+    { 0, 1266, 367.197571f },
+    { 1, 1265, 38.5422096f },
+    { 1, 1264, 25.1329422f },
+    { 255, 0, -0.045235496f },
+    { 255, 0, -0.127180874f },
+    { 255, 0, -0.0209951792f },
+    { 1, 1270, 34.9676857f },
+    { 1, 1269, 30.2116146f },
+    { 255, 0, -0.0997031704f },
+    { 255, 0, 0.0941321552f },
+    { 255, 0, -0.115452848f },
+    { 1, 1299, 36.1142883f },
+    { 0, 1284, 590.554199f },
+    { 1, 1279, 34.1479378f },
+    { 2, 1278, 73.8990784f },
+    { 2, 1277, 42.4820442f },
+    { 255, 0, 0.0555485673f },
+    { 255, 0, -0.0328280888f },
+    { 255, 0, -0.124891691f },
+    { 0, 1281, 435.861267f },
+    { 255, 0, 0.127455354f },
+    { 2, 1283, 56.4054871f },
+    { 255, 0, 0.0812176019f },
+    { 255, 0, -0.0258289855f },
+    { 1, 1292, 25.0434551f },
+    { 0, 1289, 695.823792f },
+    { 1, 1288, 20.3994579f },
+    { 255, 0, 0.123296745f },
+    { 255, 0, -0.0667260066f },
+    { 1, 1291, 20.1292877f },
+    { 255, 0, -0.0978706405f },
+    { 255, 0, 0.0391025133f },
+    { 2, 1296, 70.4786758f },
+    { 0, 1295, 710.787048f },
+    { 255, 0, 0.0901108086f },
+    { 255, 0, 0.0392676741f },
+    { 0, 1298, 782.425354f },
+    { 255, 0, -0.0143213393f },
+    { 255, 0, 0.086226806f },
+    { 2, 1307, 79.7098465f },
+    { 2, 1302, 50.8559914f },
+    { 255, 0, 0.126532525f },
+    { 2, 1306, 54.9958763f },
+    { 0, 1305, 726.876038f },
+    { 255, 0, -0.0561359413f },
+    { 255, 0, 0.0757772699f },
+    { 255, 0, 0.0906584486f },
+    { 0, 1309, 531.149597f },
+    { 255, 0, -0.052287098f },
+    { 0, 1311, 782.425354f },
+    { 255, 0, 0.0825749412f },
+    { 255, 0, 0.0092467349f },
+    { 0, 1318, 314.835846f },
+    { 1, 1315, 38.3000298f },
+    { 255, 0, -0.131394655f },
+    { 2, 1317, 55.1740875f },
+    { 255, 0, 0.0452693328f },
+    { 255, 0, -0.0977903828f },
+    { 0, 1340, 544.882202f },
+    { 1, 1329, 32.1663895f },
+    { 1, 1322, 20.0188656f },
+    { 255, 0, 0.0849669129f },
+    { 0, 1326, 330.207428f },
+    { 1, 1325, 24.8679314f },
+    { 255, 0, -0.0235875417f },
+    { 255, 0, 0.0585642047f },
+    { 1, 1328, 28.5788841f },
+    { 255, 0, -0.0786683559f },
+    { 255, 0, -0.0242789555f },
+    { 2, 1337, 79.2100067f },
+    { 0, 1334, 479.104919f },
+    { 1, 1333, 38.3529434f },
+    { 255, 0, -0.0115959356f },
+    { 255, 0, 0.0574735291f },
+    { 2, 1336, 66.0044632f },
+    { 255, 0, 0.0886556059f },
+    { 255, 0, -0.00985462032f },
+    { 1, 1339, 37.7319069f },
+    { 255, 0, -0.116327986f },
+    { 255, 0, -0.0328543819f },
+    { 1, 1354, 25.0434551f },
+    { 0, 1349, 695.823792f },
+    { 1, 1346, 20.3994579f },
+    { 0, 1345, 616.029846f },
+    { 255, 0, -0.00563845737f },
+    { 255, 0, 0.136379346f },
+    { 0, 1348, 645.976685f },
+    { 255, 0, -0.00696449447f },
+    { 255, 0, -0.121388584f },
+    { 1, 1351, 20.1292877f },
+    { 255, 0, -0.0909138098f },
+    { 2, 1353, 79.6292648f },
+    { 255, 0, 0.0468560085f },
+    { 255, 0, -0.0359309576f },
+    { 1, 1360, 36.1142883f },
+    { 0, 1357, 552.700989f },
+    { 255, 0, 0.148168549f },
+    { 0, 1359, 590.554199f },
+    { 255, 0, -0.0337542333f },
+    { 255, 0, 0.0440270565f },
+    { 0, 1362, 701.65979f },
+    { 255, 0, 0.119640492f },
+    { 0, 1364, 726.876038f },
+    { 255, 0, -0.0579608232f },
+    { 255, 0, 0.0917377919f },
+    { 0, 1373, 314.835846f },
+    { 1, 1368, 38.3000298f },
+    { 255, 0, -0.129829228f },
+    { 2, 1372, 55.1740875f },
+    { 0, 1371, 257.416229f },
+    { 255, 0, 0.00115101971f },
+    { 255, 0, 0.060845837f },
+    { 255, 0, -0.094477132f },
+    { 0, 1393, 544.882202f },
+    { 2, 1390, 79.2100067f },
+    { 1, 1383, 32.1663895f },
+    { 0, 1380, 330.207428f },
+    { 2, 1379, 51.3940468f },
+    { 255, 0, -0.0382590517f },
+    { 255, 0, 0.112830266f },
+    { 1, 1382, 28.5788841f },
+    { 255, 0, -0.063167721f },
+    { 255, 0, -0.0127929607f },
+    { 0, 1387, 345.389679f },
+    { 2, 1386, 51.5628548f },
+    { 255, 0, 0.013575431f },
+    { 255, 0, -0.102266178f },
+    { 1, 1389, 37.8016739f },
+    { 255, 0, 0.0125166913f },
+    { 255, 0, 0.064486295f },
+    { 1, 1392, 37.7319069f },
+    { 255, 0, -0.127493262f },
+    { 255, 0, -0.0305435136f },
+    { 1, 1407, 36.1142883f },
+    { 0, 1402, 770.63739f },
+    { 2, 1399, 49.6859665f },
+    { 0, 1398, 729.404663f },
+    { 255, 0, 0.0753287897f },
+    { 255, 0, -0.0246054381f },
+    { 1, 1401, 27.744463f },
+    { 255, 0, -0.0262489673f },
+    { 255, 0, 0.0206027459f },
+    { 2, 1404, 40.0642738f },
+    { 255, 0, -0.0906325653f },
+    { 1, 1406, 21.0124493f },
+    { 255, 0, -0.0343070067f },
+    { 255, 0, 0.0620423518f },
+    { 0, 1409, 701.65979f },
+    { 255, 0, 0.116958253f },
+    { 0, 1411, 726.876038f },
+    { 255, 0, -0.0528083667f },
+    { 2, 1413, 80.5668564f },
+    { 255, 0, 0.0953082815f },
+    { 255, 0, 0.0080405511f },
+    { 0, 1422, 314.835846f },
+    { 1, 1417, 38.3000298f },
+    { 255, 0, -0.128328785f },
+    { 2, 1421, 55.1740875f },
+    { 0, 1420, 257.416229f },
+    { 255, 0, 0.0010752849f },
+    { 255, 0, 0.056518957f },
+    { 255, 0, -0.0912756994f },
+    { 0, 1440, 544.882202f },
+    { 2, 1437, 79.2100067f },
+    { 1, 1430, 32.1663895f },
+    { 1, 1427, 20.0188656f },
+    { 255, 0, 0.0833644196f },
+    { 2, 1429, 51.6752129f },
+    { 255, 0, -0.0719571263f },
+    { 255, 0, -0.0171135552f },
+    { 2, 1434, 56.4054871f },
+    { 2, 1433, 43.9408569f },
+    { 255, 0, -0.0276991986f },
+    { 255, 0, 0.0553255789f },
+    { 2, 1436, 57.912468f },
+    { 255, 0, -0.132712334f },
+    { 255, 0, 0.0089897532f },
+    { 1, 1439, 37.7319069f },
+    { 255, 0, -0.123670056f },
+    { 255, 0, -0.0283939335f },
+    { 1, 1456, 36.1142883f },
+    { 0, 1449, 776.132446f },
+    { 2, 1446, 49.6859665f },
+    { 2, 1445, 48.0908966f },
+    { 255, 0, 0.0328037404f },
+    { 255, 0, 0.119677357f },
+    { 1, 1448, 22.7132282f },
+    { 255, 0, -0.0478610583f },
+    { 255, 0, 0.00856953952f },
+    { 0, 1453, 947.555847f },
+    { 2, 1452, 40.4365158f },
+    { 255, 0, -0.0578001961f },
+    { 255, 0, 0.0582448915f },
+    { 2, 1455, 62.1497269f },
+    { 255, 0, -0.125402644f },
+    { 255, 0, 0.0112486295f },
+    { 0, 1458, 701.65979f },
+    { 255, 0, 0.114310168f },
+    { 0, 1460, 726.876038f },
+    { 255, 0, -0.0481317081f },
+    { 2, 1462, 80.5668564f },
+    { 255, 0, 0.0913739577f },
+    { 255, 0, 0.00754453475f },
+    { 0, 1469, 314.835846f },
+    { 1, 1466, 38.3000298f },
+    { 255, 0, -0.126869157f },
+    { 0, 1468, 252.730637f },
+    { 255, 0, -0.0872064382f },
+    { 255, 0, 0.0371067971f },
+    { 0, 1497, 625.170166f },
+    { 2, 1484, 63.751545f },
+    { 1, 1477, 30.8926163f },
+    { 1, 1476, 30.1104145f },
+    { 2, 1475, 51.5628548f },
+    { 255, 0, -0.0312936567f },
+    { 255, 0, 0.0300816055f },
+    { 255, 0, -0.170775741f },
+    { 0, 1481, 423.757202f },
+    { 2, 1480, 61.8882256f },
+    { 255, 0, -0.0281070415f },
+    { 255, 0, 0.0789094046f },
+    { 2, 1483, 54.5997162f },
+    { 255, 0, 0.0823273137f },
+    { 255, 0, 0.0133331772f },
+    { 1, 1490, 29.7924881f },
+    { 1, 1489, 26.1693649f },
+    { 1, 1488, 25.7303886f },
+    { 255, 0, -0.0694739148f },
+    { 255, 0, 0.100496247f },
+    { 255, 0, -0.126126692f },
+    { 1, 1494, 30.7131329f },
+    { 0, 1493, 484.002502f },
+    { 255, 0, 0.012731038f },
+    { 255, 0, 0.119876541f },
+    { 2, 1496, 72.4277267f },
+    { 255, 0, -0.0549900122f },
+    { 255, 0, 0.00831647124f },
+    { 1, 1509, 22.7132282f },
+    { 1, 1506, 22.5222015f },
+    { 1, 1503, 21.2505245f },
+    { 1, 1502, 20.6348743f },
+    { 255, 0, 0.0391272083f },
+    { 255, 0, -0.072074376f },
+    { 0, 1505, 688.57074f },
+    { 255, 0, -0.0523339473f },
+    { 255, 0, 0.0647343546f },
+    { 2, 1508, 54.9958763f },
+    { 255, 0, -0.108874775f },
+    { 255, 0, -0.0280461628f },
+    { 0, 1515, 638.904846f },
+    { 2, 1512, 71.6289825f },
+    { 255, 0, 0.1245239f },
+    { 1, 1514, 27.5947475f },
+    { 255, 0, -0.0153982732f },
+    { 255, 0, 0.0839537531f },
+    { 0, 1519, 658.263f },
+    { 2, 1518, 72.2822266f },
+    { 255, 0, 0.0267376397f },
+    { 255, 0, -0.102436744f },
+    { 2, 1521, 81.2489395f },
+    { 255, 0, 0.035164021f },
+    { 255, 0, 0.0929597691f },
+    { 0, 1530, 314.835846f },
+    { 1, 1525, 38.3000298f },
+    { 255, 0, -0.12542893f },
+    { 2, 1529, 55.1740875f },
+    { 2, 1528, 45.089489f },
+    { 255, 0, 0.0476889126f },
+    { 255, 0, 0.00633682078f },
+    { 255, 0, -0.0870830789f },
+    { 0, 1548, 504.642822f },
+    { 2, 1547, 79.2100067f },
+    { 1, 1540, 31.5958576f },
+    { 0, 1537, 330.207428f },
+    { 2, 1536, 51.3940468f },
+    { 255, 0, -0.0318783708f },
+    { 255, 0, 0.10660474f },
+    { 0, 1539, 471.12204f },
+    { 255, 0, -0.0336017385f },
+    { 255, 0, -0.102693141f },
+    { 2, 1544, 54.2410927f },
+    { 2, 1543, 43.9408569f },
+    { 255, 0, -0.0488199405f },
+    { 255, 0, 0.0581797063f },
+    { 2, 1546, 73.4998932f },
+    { 255, 0, -0.0310323182f },
+    { 255, 0, 0.0419248603f },
+    { 255, 0, -0.11446885f },
+    { 1, 1564, 36.8433037f },
+    { 0, 1557, 790.879639f },
+    { 2, 1554, 66.1435776f },
+    { 2, 1553, 43.2635002f },
+    { 255, 0, 0.0930757225f },
+    { 255, 0, 0.0170652904f },
+    { 2, 1556, 68.5820541f },
+    { 255, 0, -0.14651145f },
+    { 255, 0, -0.0111407749f },
+    { 2, 1561, 50.2390213f },
+    { 1, 1560, 31.9208717f },
+    { 255, 0, 0.0238816664f },
+    { 255, 0, -0.106570564f },
+    { 1, 1563, 25.5413857f },
+    { 255, 0, 0.0206112098f },
+    { 255, 0, 0.0791177228f },
+    { 0, 1566, 721.237366f },
+    { 255, 0, 0.11485263f },
+    { 0, 1568, 770.63739f },
+    { 255, 0, -0.0172738824f },
+    { 1, 1570, 38.9004784f },
+    { 255, 0, 0.100674227f },
+    { 255, 0, 0.031726446f },
+    { 0, 1579, 314.835846f },
+    { 1, 1574, 38.3000298f },
+    { 255, 0, -0.123988986f },
+    { 2, 1578, 55.1740875f },
+    { 0, 1577, 257.416229f },
+    { 255, 0, 0.0020222466f },
+    { 255, 0, 0.0482353903f },
+    { 255, 0, -0.0841062889f },
+    { 0, 1597, 590.554199f },
+    { 2, 1594, 79.2100067f },
+    { 1, 1589, 38.3529434f },
+    { 0, 1586, 560.389099f },
+    { 0, 1585, 544.882202f },
+    { 255, 0, -0.0134717822f },
+    { 255, 0, 0.0839394704f },
+    { 1, 1588, 28.2634487f },
+    { 255, 0, -0.0991192535f },
+    { 255, 0, -0.00428304821f },
+    { 0, 1593, 417.264038f },
+    { 2, 1592, 59.2451096f },
+    { 255, 0, 0.0514227897f },
+    { 255, 0, -0.0484462753f },
+    { 255, 0, 0.106078289f },
+    { 1, 1596, 37.7319069f },
+    { 255, 0, -0.106243663f },
+    { 255, 0, -0.0262819715f },
+    { 1, 1607, 35.3305435f },
+    { 0, 1606, 947.555847f },
+    { 0, 1603, 906.185242f },
+    { 0, 1602, 892.300537f },
+    { 255, 0, 0.0169993229f },
+    { 255, 0, -0.0930918157f },
+    { 2, 1605, 46.8502693f },
+    { 255, 0, -0.0145576866f },
+    { 255, 0, 0.0957121104f },
+    { 255, 0, -0.0916849151f },
+    { 0, 1613, 785.920593f },
+    { 0, 1610, 701.65979f },
+    { 255, 0, 0.108489551f },
+    { 1, 1612, 38.1835022f },
+    { 255, 0, -0.0759197697f },
+    { 255, 0, 0.0785703734f },
+    { 1, 1615, 38.9004784f },
+    { 255, 0, 0.113753177f },
+    { 255, 0, 0.0234641936f },
+    { 0, 1620, 296.413544f },
+    { 2, 1619, 41.8031082f },
+    { 255, 0, -0.00463939039f },
+    { 255, 0, -0.123005278f },
+    { 0, 1638, 734.138062f },
+    { 0, 1637, 732.35437f },
+    { 1, 1630, 30.384491f },
+    { 2, 1627, 65.8288727f },
+    { 1, 1626, 30.1104145f },
+    { 255, 0, 0.00568263512f },
+    { 255, 0, -0.14758189f },
+    { 2, 1629, 73.7191849f },
+    { 255, 0, -0.0936548859f },
+    { 255, 0, -0.0207138006f },
+    { 0, 1634, 479.104919f },
+    { 2, 1633, 54.2410927f },
+    { 255, 0, 0.0232377127f },
+    { 255, 0, -0.0419674031f },
+    { 0, 1636, 590.554199f },
+    { 255, 0, 0.0285006259f },
+    { 255, 0, 0.0783144087f },
+    { 255, 0, -0.216070548f },
+    { 1, 1640, 20.1292877f },
+    { 255, 0, -0.074796848f },
+    { 0, 1648, 947.555847f },
+    { 0, 1645, 906.185242f },
+    { 0, 1644, 892.300537f },
+    { 255, 0, 0.0392143764f },
+    { 255, 0, -0.0508542545f },
+    { 2, 1647, 42.7032928f },
+    { 255, 0, -0.0285442844f },
+    { 255, 0, 0.101300776f },
+    { 2, 1650, 62.1497269f },
+    { 255, 0, -0.116160542f },
+    { 255, 0, 0.0117352996f },
+    { 0, 1655, 296.413544f },
+    { 2, 1654, 41.8031082f },
+    { 255, 0, -0.00433227653f },
+    { 255, 0, -0.121436313f },
+    { 1, 1677, 38.5422096f },
+    { 0, 1664, 544.882202f },
+    { 2, 1663, 79.2100067f },
+    { 2, 1662, 77.688858f },
+    { 2, 1661, 74.1281662f },
+    { 255, 0, -0.0114240935f },
+    { 255, 0, -0.104604937f },
+    { 255, 0, 0.0753529072f },
+    { 255, 0, -0.108530939f },
+    { 1, 1672, 25.0434551f },
+    { 1, 1669, 24.3926964f },
+    { 2, 1668, 72.9267349f },
+    { 255, 0, -0.0134818247f },
+    { 255, 0, 0.058726009f },
+    { 2, 1671, 62.937542f },
+    { 255, 0, 0.00677912682f },
+    { 255, 0, -0.152960181f },
+    { 0, 1674, 552.700989f },
+    { 255, 0, 0.130362511f },
+    { 0, 1676, 576.561096f },
+    { 255, 0, -0.0416424237f },
+    { 255, 0, 0.0277615432f },
+    { 2, 1679, 58.3609047f },
+    { 255, 0, 0.123951808f },
+    { 0, 1683, 417.264038f },
+    { 2, 1682, 68.1291199f },
+    { 255, 0, -0.0765789449f },
+    { 255, 0, -0.0133700743f },
+    { 0, 1685, 819.484436f },
+    { 255, 0, 0.0957300216f },
+    { 255, 0, 0.0070719826f },
+    { 0, 1690, 296.413544f },
+    { 2, 1689, 41.8031082f },
+    { 255, 0, -0.0040454641f },
+    { 255, 0, -0.119825281f },
+    { 1, 1716, 38.5422096f },
+    { 0, 1707, 776.132446f },
+    { 2, 1700, 65.4638367f },
+    { 0, 1697, 519.741882f },
+    { 1, 1696, 31.5423393f },
+    { 255, 0, -0.032315053f },
+    { 255, 0, 0.00787054561f },
+    { 0, 1699, 710.787048f },
+    { 255, 0, 0.0326978713f },
+    { 255, 0, -0.0199379697f },
+    { 2, 1704, 68.5820541f },
+    { 2, 1703, 66.1435776f },
+    { 255, 0, -0.0171599723f },
+    { 255, 0, -0.143166259f },
+    { 2, 1706, 69.2937241f },
+    { 255, 0, 0.0788244531f },
+    { 255, 0, -0.01973092f },
+    { 2, 1715, 81.2489395f },
+    { 2, 1712, 78.5994492f },
+    { 1, 1711, 20.8813152f },
+    { 255, 0, -0.0617664047f },
+    { 255, 0, 0.0433123596f },
+    { 1, 1714, 24.8134098f },
+    { 255, 0, -0.0222158507f },
+    { 255, 0, -0.156920493f },
+    { 255, 0, 0.111306302f },
+    { 2, 1718, 58.3609047f },
+    { 255, 0, 0.119886264f },
+    { 0, 1722, 417.264038f },
+    { 2, 1721, 68.1291199f },
+    { 255, 0, -0.0719365925f },
+    { 255, 0, -0.0125398086f },
+    { 0, 1724, 819.484436f },
+    { 255, 0, 0.091373004f },
+    { 255, 0, 0.00662744185f },
+    { 0, 1731, 314.835846f },
+    { 1, 1728, 38.3000298f },
+    { 255, 0, -0.119005382f },
+    { 2, 1730, 55.1740875f },
+    { 255, 0, 0.0437977612f },
+    { 255, 0, -0.0723543093f },
+    { 0, 1747, 734.138062f },
+    { 0, 1746, 732.35437f },
+    { 1, 1739, 29.6646404f },
+    { 1, 1736, 20.0188656f },
+    { 255, 0, 0.104740225f },
+    { 2, 1738, 65.8288727f },
+    { 255, 0, -0.0041340054f },
+    { 255, 0, -0.0587525517f },
+    { 0, 1743, 479.104919f },
+    { 0, 1742, 463.607178f },
+    { 255, 0, -0.0029704005f },
+    { 255, 0, -0.0964541137f },
+    { 0, 1745, 648.651367f },
+    { 255, 0, 0.0271563865f },
+    { 255, 0, 0.0843632892f },
+    { 255, 0, -0.185466096f },
+    { 1, 1763, 35.3305435f },
+    { 1, 1756, 31.5958576f },
+    { 1, 1753, 25.5413857f },
+    { 0, 1752, 757.170593f },
+    { 255, 0, 0.0642334223f },
+    { 255, 0, -0.0109059f },
+    { 2, 1755, 69.2937241f },
+    { 255, 0, 0.0897905231f },
+    { 255, 0, 0.0268490519f },
+    { 2, 1760, 59.7402267f },
+    { 0, 1759, 822.795776f },
+    { 255, 0, -0.270156741f },
+    { 255, 0, -0.0576936118f },
+    { 1, 1762, 34.8325424f },
+    { 255, 0, 0.0707178414f },
+    { 255, 0, -0.0509941056f },
+    { 2, 1765, 63.2933426f },
+    { 255, 0, 0.106446438f },
+    { 2, 1767, 69.2937241f },
+    { 255, 0, -0.0574124642f },
+    { 0, 1769, 785.920593f },
+    { 255, 0, 0.00757871242f },
+    { 255, 0, 0.0909660533f },
+    { 0, 1774, 296.413544f },
+    { 2, 1773, 41.8031082f },
+    { 255, 0, 0.000495515415f },
+    { 255, 0, -0.116895087f },
+    { 1, 1798, 38.3529434f },
+    { 0, 1785, 625.170166f },
+    { 0, 1782, 619.163086f },
+    { 1, 1779, 20.0188656f },
+    { 255, 0, 0.087205708f },
+    { 1, 1781, 21.1400452f },
+    { 255, 0, -0.0781896189f },
+    { 255, 0, -0.00615311041f },
+    { 2, 1784, 57.2381172f },
+    { 255, 0, -0.0204443634f },
+    { 255, 0, -0.113436766f },
+    { 0, 1791, 638.904846f },
+    { 1, 1788, 21.4206963f },
+    { 255, 0, -0.00470400043f },
+    { 2, 1790, 71.6289825f },
+    { 255, 0, 0.126641035f },
+    { 255, 0, 0.0448836274f },
+    { 0, 1795, 658.263f },
+    { 2, 1794, 72.2822266f },
+    { 255, 0, 0.0108212791f },
+    { 255, 0, -0.109260254f },
+    { 0, 1797, 947.555847f },
+    { 255, 0, 0.016756434f },
+    { 255, 0, -0.0646943823f },
+    { 0, 1804, 443.64624f },
+    { 2, 1801, 58.3609047f },
+    { 255, 0, 0.0937905982f },
+    { 1, 1803, 38.9854584f },
+    { 255, 0, 0.0395935178f },
+    { 255, 0, -0.108783819f },
+    { 0, 1806, 858.644775f },
+    { 255, 0, 0.110963471f },
+    { 255, 0, 0.00364156533f },
+    { 0, 1813, 314.835846f },
+    { 1, 1810, 38.3000298f },
+    { 255, 0, -0.11612501f },
+    { 2, 1812, 47.1228828f },
+    { 255, 0, 0.0340920724f },
+    { 255, 0, -0.034160357f },
+    { 1, 1841, 38.3529434f },
+    { 0, 1828, 790.879639f },
+    { 2, 1821, 65.4638367f },
+    { 2, 1820, 65.1251373f },
+    { 1, 1819, 21.2505245f },
+    { 255, 0, -0.0429310426f },
+    { 255, 0, 0.0105118286f },
+    { 255, 0, 0.115660027f },
+    { 2, 1825, 68.5820541f },
+    { 2, 1824, 66.1435776f },
+    { 255, 0, -0.0137570137f },
+    { 255, 0, -0.126804739f },
+    { 0, 1827, 775.067749f },
+    { 255, 0, -0.00591512909f },
+    { 255, 0, -0.119593129f },
+    { 2, 1834, 65.8288727f },
+    { 0, 1833, 947.555847f },
+    { 1, 1832, 31.5958576f },
+    { 255, 0, 0.0328172706f },
+    { 255, 0, -0.0341447033f },
+    { 255, 0, -0.109530367f },
+    { 1, 1838, 26.7441292f },
+    { 1, 1837, 24.8134098f },
+    { 255, 0, 0.0615144409f },
+    { 255, 0, -0.0673562139f },
+    { 0, 1840, 902.922058f },
+    { 255, 0, 0.112855196f },
+    { 255, 0, 0.0325560048f },
+    { 0, 1845, 443.64624f },
+    { 1, 1844, 39.1129875f },
+    { 255, 0, 0.0700087473f },
+    { 255, 0, -0.0646787062f },
+    { 0, 1847, 858.644775f },
+    { 255, 0, 0.108107433f },
+    { 255, 0, 0.00341211702f },
+    { 0, 1852, 296.413544f },
+    { 2, 1851, 42.1177483f },
+    { 255, 0, 0.00181333802f },
+    { 255, 0, -0.11359632f },
+    { 1, 1878, 38.5422096f },
+    { 0, 1865, 481.389587f },
+    { 1, 1860, 22.5222015f },
+    { 0, 1859, 437.694153f },
+    { 0, 1858, 363.807678f },
+    { 255, 0, 0.058797054f },
+    { 255, 0, -0.0734279677f },
+    { 255, 0, 0.118157223f },
+    { 1, 1862, 24.9743233f },
+    { 255, 0, -0.116504796f },
+    { 1, 1864, 25.2266598f },
+    { 255, 0, 0.101116598f },
+    { 255, 0, -0.0223706178f },
+    { 1, 1873, 21.2505245f },
+    { 1, 1870, 20.7989597f },
+    { 2, 1869, 51.8712692f },
+    { 255, 0, 0.0633985549f },
+    { 255, 0, -0.0220581684f },
+    { 0, 1872, 832.5177f },
+    { 255, 0, -0.119249001f },
+    { 255, 0, 0.0285008792f },
+    { 0, 1877, 947.555847f },
+    { 0, 1876, 906.185242f },
+    { 255, 0, 0.0104383565f },
+    { 255, 0, 0.077698268f },
+    { 255, 0, -0.0812534168f },
+    { 2, 1880, 58.3609047f },
+    { 255, 0, 0.111144811f },
+    { 0, 1884, 443.64624f },
+    { 1, 1883, 38.9854584f },
+    { 255, 0, 0.0381366834f },
+    { 255, 0, -0.100686356f },
+    { 0, 1886, 794.703064f },
+    { 255, 0, 0.092271544f },
+    { 255, 0, 0.00474108988f },
+    { 0, 1891, 296.413544f },
+    { 2, 1890, 42.1177483f },
+    { 255, 0, 0.00169570372f },
+    { 255, 0, -0.111628868f },
+    { 1, 1919, 38.5422096f },
+    { 0, 1906, 576.561096f },
+    { 0, 1901, 560.389099f },
+    { 0, 1898, 544.882202f },
+    { 2, 1897, 79.2100067f },
+    { 255, 0, -0.00793481339f },
+    { 255, 0, -0.102211691f },
+    { 1, 1900, 23.2289524f },
+    { 255, 0, -0.0187994912f },
+    { 255, 0, 0.0900056735f },
+    { 2, 1905, 67.9678268f },
+    { 2, 1904, 47.1228828f },
+    { 255, 0, -0.0225151721f },
+    { 255, 0, -0.148302838f },
+    { 255, 0, 0.0421998203f },
+    { 1, 1912, 22.7132282f },
+    { 1, 1911, 22.5222015f },
+    { 2, 1910, 45.686657f },
+    { 255, 0, 0.0718710944f },
+    { 255, 0, -0.0115892626f },
+    { 255, 0, -0.0904092565f },
+    { 2, 1916, 49.6210556f },
+    { 2, 1915, 45.7290306f },
+    { 255, 0, 0.00778035866f },
+    { 255, 0, 0.107745029f },
+    { 2, 1918, 51.6752129f },
+    { 255, 0, -0.112890325f },
+    { 255, 0, 0.0168885496f },
+    { 2, 1921, 58.3609047f },
+    { 255, 0, 0.107305758f },
+    { 0, 1923, 417.264038f },
+    { 255, 0, -0.0478966609f },
+    { 0, 1925, 794.703064f },
+    { 255, 0, 0.0765984878f },
+    { 255, 0, 0.00444238493f },
+    { 0, 1932, 314.835846f },
+    { 1, 1929, 38.3000298f },
+    { 255, 0, -0.111696653f },
+    { 2, 1931, 52.7929726f },
+    { 255, 0, 0.0262981299f },
+    { 255, 0, -0.0228125211f },
+    { 1, 1948, 38.3529434f },
+    { 0, 1941, 734.138062f },
+    { 0, 1940, 732.35437f },
+    { 1, 1937, 20.1292877f },
+    { 255, 0, 0.0936242044f },
+    { 1, 1939, 21.2505245f },
+    { 255, 0, -0.0794688165f },
+    { 255, 0, 0.000902877771f },
+    { 255, 0, -0.179867446f },
+    { 2, 1943, 40.0642738f },
+    { 255, 0, -0.0880636722f },
+    { 1, 1945, 20.1292877f },
+    { 255, 0, -0.067843169f },
+    { 0, 1947, 947.555847f },
+    { 255, 0, 0.0291059129f },
+    { 255, 0, -0.0428342596f },
+    { 0, 1952, 443.64624f },
+    { 1, 1951, 39.1129875f },
+    { 255, 0, 0.0632471889f },
+    { 255, 0, -0.0599260181f },
+    { 0, 1954, 841.305298f },
+    { 255, 0, 0.100405835f },
+    { 255, 0, 0.0043495954f },
+    { 0, 1959, 296.413544f },
+    { 2, 1958, 42.3556175f },
+    { 255, 0, -0.00539033441f },
+    { 255, 0, -0.106990241f },
+    { 1, 1985, 38.5422096f },
+    { 0, 1970, 349.312317f },
+    { 2, 1967, 55.9880295f },
+    { 2, 1966, 51.3940468f },
+    { 2, 1965, 45.7290306f },
+    { 255, 0, 0.0491553918f },
+    { 255, 0, -0.0839320943f },
+    { 255, 0, 0.0858292505f },
+    { 1, 1969, 25.1329422f },
+    { 255, 0, 0.00925316568f },
+    { 255, 0, -0.115889207f },
+    { 1, 1978, 28.5101128f },
+    { 2, 1975, 43.2635002f },
+    { 2, 1974, 41.6887894f },
+    { 255, 0, 0.00505832769f },
+    { 255, 0, 0.116065636f },
+    { 0, 1977, 585.01825f },
+    { 255, 0, -0.0458378904f },
+    { 255, 0, -0.000755062385f },
+    { 2, 1982, 46.0391083f },
+    { 2, 1981, 44.8780136f },
+    { 255, 0, 0.000513632433f },
+    { 255, 0, -0.152135119f },
+    { 0, 1984, 819.484436f },
+    { 255, 0, 0.0117563494f },
+    { 255, 0, 0.072294794f },
+    { 2, 1987, 58.3609047f },
+    { 255, 0, 0.103157312f },
+    { 0, 1991, 443.64624f },
+    { 1, 1990, 38.9854584f },
+    { 255, 0, 0.0338801965f },
+    { 255, 0, -0.0926835164f },
+    { 0, 1993, 794.703064f },
+    { 255, 0, 0.0834047124f },
+    { 255, 0, 0.00287562888f },
+    { 0, 1996, 252.730637f },
+    { 255, 0, -0.102717623f },
+    { 1, 2012, 38.3000298f },
+    { 0, 1999, 314.835846f },
+    { 255, 0, -0.0849758163f },
+    { 0, 2005, 330.207428f },
+    { 2, 2002, 51.3940468f },
+    { 255, 0, -0.0286586583f },
+    { 1, 2004, 26.3607903f },
+    { 255, 0, 0.148077771f },
+    { 255, 0, -0.00927020237f },
+    { 0, 2009, 349.312317f },
+    { 2, 2008, 45.8896484f },
+    { 255, 0, 0.0761574283f },
+    { 255, 0, -0.124876313f },
+    { 1, 2011, 32.5350685f },
+    { 255, 0, -0.00308227749f },
+    { 255, 0, 0.0144748427f },
+    { 2, 2014, 58.3609047f },
+    { 255, 0, 0.0999476537f },
+    { 0, 2018, 450.725037f },
+    { 1, 2017, 38.9854584f },
+    { 255, 0, -0.000159593546f },
+    { 255, 0, -0.0779846236f },
+    { 0, 2020, 794.703064f },
+    { 255, 0, 0.0778106824f },
+    { 255, 0, 0.00269445078f },
+    { 0, 2027, 314.835846f },
+    { 1, 2024, 38.3000298f },
+    { 255, 0, -0.106330849f },
+    { 2, 2026, 52.7929726f },
+    { 255, 0, 0.0229346994f },
+    { 255, 0, -0.020038195f },
+    { 1, 2049, 38.3529434f },
+    { 0, 2038, 770.63739f },
+    { 0, 2035, 763.647339f },
+    { 1, 2032, 20.0188656f },
+    { 255, 0, 0.0919626281f },
+    { 2, 2034, 79.7098465f },
+    { 255, 0, 0.000584193156f },
+    { 255, 0, -0.0441612415f },
+    { 1, 2037, 23.5818996f },
+    { 255, 0, -0.147954166f },
+    { 255, 0, -0.0322927572f },
+    { 2, 2046, 81.2489395f },
+    { 2, 2043, 78.5994492f },
+    { 1, 2042, 35.3305435f },
+    { 255, 0, 0.0083680572f },
+    { 255, 0, 0.0973884016f },
+    { 0, 2045, 841.305298f },
+    { 255, 0, 0.012354074f },
+    { 255, 0, -0.161800638f },
+    { 2, 2048, 82.4489441f },
+    { 255, 0, 0.0278497729f },
+    { 255, 0, 0.0983562917f },
+    { 0, 2053, 443.64624f },
+    { 1, 2052, 39.1129875f },
+    { 255, 0, 0.0564087443f },
+    { 255, 0, -0.0532215498f },
+    { 0, 2055, 839.991638f },
+    { 255, 0, 0.0925371274f },
+    { 255, 0, 0.00576401642f },
+    { 0, 2058, 252.730637f },
+    { 255, 0, -0.0983005539f },
+    { 1, 2072, 38.3000298f },
+    { 0, 2061, 314.835846f },
+    { 255, 0, -0.0790634081f },
+    { 0, 2065, 330.207428f },
+    { 2, 2064, 55.9880295f },
+    { 255, 0, 0.0902027264f },
+    { 255, 0, -0.0157407671f },
+    { 0, 2069, 349.312317f },
+    { 2, 2068, 45.8896484f },
+    { 255, 0, 0.069740586f },
+    { 255, 0, -0.120441787f },
+    { 2, 2071, 47.0088196f },
+    { 255, 0, -0.014234513f },
+    { 255, 0, 0.0049494328f },
+    { 2, 2074, 58.3609047f },
+    { 255, 0, 0.0930325612f },
+    { 0, 2078, 450.725037f },
+    { 1, 2077, 38.9854584f },
+    { 255, 0, -0.00278296531f },
+    { 255, 0, -0.0726556033f },
+    { 2, 2080, 73.2763596f },
+    { 255, 0, 0.00245435047f },
+    { 255, 0, 0.0718435273f },
+    { 0, 2083, 252.730637f },
+    { 255, 0, -0.0958454013f },
+    { 2, 2101, 44.8780136f },
+    { 0, 2098, 870.471802f },
+    { 0, 2091, 423.757202f },
+    { 2, 2090, 44.4773293f },
+    { 1, 2089, 37.0409698f },
+    { 255, 0, -0.108710378f },
+    { 255, 0, 0.0201126877f },
+    { 255, 0, 0.0586093217f },
+    { 1, 2095, 24.2286224f },
+    { 2, 2094, 40.996048f },
+    { 255, 0, 0.0451394767f },
+    { 255, 0, 0.142001256f },
+    { 1, 2097, 25.3599434f },
+    { 255, 0, -0.10446398f },
+    { 255, 0, 0.0643820465f },
+    { 2, 2100, 41.6887894f },
+    { 255, 0, -0.122758023f },
+    { 255, 0, -0.0129785202f },
+    { 2, 2109, 47.0088196f },
+    { 1, 2108, 34.8576279f },
+    { 0, 2107, 856.504456f },
+    { 2, 2106, 46.0391083f },
+    { 255, 0, -0.145064324f },
+    { 255, 0, -0.0394368321f },
+    { 255, 0, 0.0162161421f },
+    { 255, 0, 0.0680440292f },
+    { 2, 2117, 49.6859665f },
+    { 0, 2114, 538.327454f },
+    { 1, 2113, 30.8253994f },
+    { 255, 0, -0.0698327497f },
+    { 255, 0, 0.0693040043f },
+    { 1, 2116, 22.9432659f },
+    { 255, 0, -0.00395035185f },
+    { 255, 0, 0.117555946f },
+    { 2, 2121, 51.3940468f },
+    { 1, 2120, 22.5935783f },
+    { 255, 0, 0.0176530369f },
+    { 255, 0, -0.0999449417f },
+    { 2, 2123, 52.7929726f },
+    { 255, 0, 0.105087675f },
+    { 255, 0, -0.00251654605f },
+    { 0, 2126, 252.730637f },
+    { 255, 0, -0.0933544114f },
+    { 2, 2140, 55.9880295f },
+    { 2, 2137, 54.9958763f },
+    { 2, 2136, 54.5997162f },
+    { 0, 2133, 892.300537f },
+    { 2, 2132, 51.6752129f },
+    { 255, 0, 0.00232301792f },
+    { 255, 0, 0.0676386505f },
+    { 0, 2135, 906.185242f },
+    { 255, 0, -0.174959913f },
+    { 255, 0, -0.0189897921f },
+    { 255, 0, -0.137985617f },
+    { 2, 2139, 55.5911179f },
+    { 255, 0, 0.148861498f },
+    { 255, 0, 0.0481764972f },
+    { 0, 2154, 882.741455f },
+    { 0, 2147, 351.355896f },
+    { 1, 2144, 25.1329422f },
+    { 255, 0, 0.0110082077f },
+    { 2, 2146, 74.5640182f },
+    { 255, 0, -0.1148296f },
+    { 255, 0, -0.00923960004f },
+    { 1, 2151, 28.5101128f },
+    { 1, 2150, 26.2437935f },
+    { 255, 0, -0.00476188492f },
+    { 255, 0, -0.0758267418f },
+    { 1, 2153, 34.8325424f },
+    { 255, 0, 0.0273964964f },
+    { 255, 0, -0.0260702316f },
+    { 2, 2158, 61.2290306f },
+    { 0, 2157, 921.656555f },
+    { 255, 0, 0.0764627084f },
+    { 255, 0, -0.0935516059f },
+    { 2, 2160, 74.5640182f },
+    { 255, 0, 0.108928256f },
+    { 0, 2162, 906.185242f },
+    { 255, 0, -0.0553073101f },
+    { 255, 0, 0.0637461394f },
+    { 0, 2167, 314.835846f },
+    { 1, 2166, 38.3000298f },
+    { 255, 0, -0.0990288779f },
+    { 255, 0, 0.00103021739f },
+    { 1, 2193, 38.3529434f },
+    { 0, 2180, 625.170166f },
+    { 0, 2177, 619.163086f },
+    { 2, 2174, 62.6410065f },
+    { 2, 2173, 61.7001305f },
+    { 255, 0, -0.00295053283f },
+    { 255, 0, 0.09185265f },
+    { 0, 2176, 367.197571f },
+    { 255, 0, -0.0805836171f },
+    { 255, 0, -0.00886700023f },
+    { 1, 2179, 27.5947475f },
+    { 255, 0, -0.105510347f },
+    { 255, 0, -0.0216815155f },
+    { 0, 2186, 638.904846f },
+    { 1, 2183, 21.4206963f },
+    { 255, 0, -0.00426659733f },
+    { 2, 2185, 71.6289825f },
+    { 255, 0, 0.12047755f },
+    { 255, 0, 0.0404471904f },
+    { 0, 2190, 648.651367f },
+    { 2, 2189, 72.2822266f },
+    { 255, 0, 0.0152964257f },
+    { 255, 0, -0.125596598f },
+    { 2, 2192, 40.0642738f },
+    { 255, 0, -0.0633235797f },
+    { 255, 0, 0.00689715706f },
+    { 0, 2197, 443.64624f },
+    { 1, 2196, 39.1129875f },
+    { 255, 0, 0.0541952662f },
+    { 255, 0, -0.0493328869f },
+    { 0, 2199, 832.5177f },
+    { 255, 0, 0.0878849328f },
+    { 255, 0, 0.00437853066f },
+    { 0, 2202, 252.730637f },
+    { 255, 0, -0.0886783823f },
+    { 2, 2220, 44.8780136f },
+    { 0, 2217, 870.471802f },
+    { 0, 2210, 423.757202f },
+    { 0, 2209, 375.313019f },
+    { 2, 2208, 43.5045547f },
+    { 255, 0, -0.0281027351f },
+    { 255, 0, 0.0756221786f },
+    { 255, 0, -0.10056337f },
+    { 1, 2214, 24.2286224f },
+    { 0, 2213, 500.492676f },
+    { 255, 0, 0.0414224677f },
+    { 255, 0, 0.135568157f },
+    { 1, 2216, 25.3599434f },
+    { 255, 0, -0.0950073823f },
+    { 255, 0, 0.0590808615f },
+    { 2, 2219, 41.6887894f },
+    { 255, 0, -0.104029469f },
+    { 255, 0, -0.0112115145f },
+    { 2, 2228, 47.0088196f },
+    { 1, 2227, 34.8576279f },
+    { 0, 2226, 856.504456f },
+    { 2, 2225, 46.0391083f },
+    { 255, 0, -0.129479706f },
+    { 255, 0, -0.0361421704f },
+    { 255, 0, 0.0171630569f },
+    { 255, 0, 0.0637683347f },
+    { 2, 2236, 49.6859665f },
+    { 0, 2233, 538.327454f },
+    { 1, 2232, 30.8253994f },
+    { 255, 0, -0.0644454956f },
+    { 255, 0, 0.062219847f },
+    { 1, 2235, 22.9432659f },
+    { 255, 0, -0.00388506241f },
+    { 255, 0, 0.112379797f },
+    { 2, 2240, 51.3940468f },
+    { 0, 2239, 625.170166f },
+    { 255, 0, -0.109988041f },
+    { 255, 0, -0.0192448441f },
+    { 2, 2242, 52.7929726f },
+    { 255, 0, 0.0926030204f },
+    { 255, 0, -0.00257184729f },
+};
+
+constexpr uint16_t MODEL_TABLE_TREE_ROOTS[MODEL_TABLE_TREE_COUNT] = {
+    0, 83, 160, 245, 334, 421, 502, 581, 658, 725, 784, 843, 910, 989, 1048, 1115,
+    1190, 1245, 1312, 1365, 1414, 1463, 1522, 1571, 1616, 1651, 1686, 1725, 1770, 1807, 1848, 1887,
+    1926, 1955, 1994, 2021, 2056, 2081, 2124, 2163, 2200,
+};
+
+constexpr uint8_t MODEL_TABLE_TREE_CLASS[MODEL_TABLE_TREE_COUNT] = {
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0,
+};
+
+// Khoảng votes[1] - votes[0] còn có thể cộng thêm từ cây i đến hết
+constexpr float MODEL_TABLE_MARGIN_MIN[MODEL_TABLE_TREE_COUNT + 1] = {
+    -6.03832483f, -5.82060528f, -5.58371973f, -5.40201473f, -5.20393705f, -5.03995848f, -4.86521578f, -4.71049976f,
+    -4.54871082f, -4.40261841f, -4.25043631f, -4.12129831f, -3.9726522f, -3.82518816f, -3.68496442f, -3.56274295f,
+    -3.4271872f, -3.31403089f, -3.18204498f, -3.03387642f, -2.90404725f, -2.78436971f, -2.61359406f, -2.49874139f,
+    -2.37475252f, -2.27345157f, -2.1204915f, -2.00060511f, -1.73044837f, -1.60380733f, -1.47700262f, -1.35884535f,
+    -1.21054256f, -1.11013675f, -0.958001554f, -0.809923828f, -0.648123145f, -0.555090606f, -0.410026282f, -0.261164784f,
+    -0.135568172f, 0.0f,
+};
+
+constexpr float MODEL_TABLE_MARGIN_MAX[MODEL_TABLE_TREE_COUNT + 1] = {
+    6.10731077f, 5.83483458f, 5.64201355f, 5.42926645f, 5.25518942f, 5.06860638f, 4.91503954f, 4.74664402f,
+    4.60929441f, 4.42586946f, 4.2963438f, 4.14819241f, 3.99392772f, 3.81066871f, 3.68576193f, 3.54453206f,
+    3.37893462f, 3.18109441f, 3.04172897f, 2.91033435f, 2.79337597f, 2.6606636f, 2.53613973f, 2.38962841f,
+    2.27587509f, 2.05980468f, 1.92944205f, 1.7725215f, 1.66607511f, 1.54918003f, 1.43351996f, 1.31427097f,
+    1.20652592f, 1.02665854f, 0.910592854f, 0.785716534f, 0.687360227f, 0.566918433f, 0.424917161f, 0.249957263f,
+    0.129479706f, 0.0f,
+};
+
+// Giải thích (TreeExplainer, model_explain.h), song song với MODEL_TABLE_NODES:
+// gốc cây là giá trị kỳ vọng, node khác là thay đổi kỳ vọng so với node cha
+constexpr float MODEL_TABLE_EXPLAIN[MODEL_TABLE_POOL_NODE_COUNT] = {
+    -0.0395076051f, -0.0715784431f, -0.0469034798f, -0.11448662f, 0.11448662f, -0.0459933467f, 0.102344699f, -0.102344699f,
+    -0.0322757438f, 0.0322757438f, 0.0459933467f, 0.119363301f, -0.119363301f, 0.0469034798f, -0.0940047428f, 0.0800127387f,
+    0.100144215f, -0.0998840928f, 0.0998840928f, -0.100144215f, -0.0800127387f, 0.0940047428f, 0.110400118f, -0.0664202273f,
+    0.0734778047f, -0.0734778047f, 0.0664202273f, -0.110400118f, -0.123468205f, 0.123468205f, 0.0579948649f, -0.0579948649f,
+    0.0715784431f, 0.0108726099f, -0.0891798362f, 0.0678615123f, -0.0210538469f, 0.0998567566f, -0.0998567566f, 0.0210538469f,
+    0.0874695703f, -0.0874695703f, -0.0678615123f, -0.124831356f, 0.124831356f, -0.140618905f, 0.140618905f, 0.0891798362f,
+    -0.0813451037f, 0.0873236731f, 0.0462110862f, -0.0462110862f, -0.0873236731f, -0.0803273544f, 0.0803273544f, 0.0813451037f,
+    -0.0108726099f, -0.0545267574f, 0.0233473778f, 0.0580544472f, 0.0515701249f, -0.0515701249f, -0.0580544472f, -0.08466658f,
+    0.08466658f, -0.0233473778f, -0.11012958f, 0.11012958f, 0.112781957f, -0.112781957f, 0.0545267574f, 0.0478340425f,
+    0.0610574745f, 0.0331033133f, -0.0331033133f, -0.0610574745f, -0.101030715f, 0.101030715f, -0.0478340425f, -0.0872192234f,
+    0.0872192234f, 0.0999653786f, -0.0999653786f, -0.019839434f, -0.0431520566f, -0.0752537996f, -0.0986400768f, 0.0986400768f,
+    -0.0379932299f, 0.0895558596f, -0.0895558596f, -0.032273829f, 0.032273829f, 0.0379932299f, 0.119571008f, -0.119571008f,
+    0.0752537996f, -0.0841843709f, 0.0663446188f, -0.0392269865f, 0.0879784599f, -0.0879784599f, 0.0392269865f, 0.0936266258f,
+    -0.0936266258f, -0.0663446188f, 0.0730180517f, -0.0730180517f, 0.0841843709f, 0.0905624554f, -0.0905624554f, -0.0832929537f,
+    -0.0955463201f, 0.0955463201f, 0.0832929537f, 0.0844824612f, -0.0844824612f, 0.0431520566f, -0.0468020551f, 0.0171531793f,
+    0.0497967191f, -0.0575817637f, 0.0760104284f, -0.0760104284f, 0.0575817637f, -0.0593122728f, 0.0593122728f, -0.0497967191f,
+    -0.0369254239f, 0.0636776835f, -0.0636776835f, 0.0369254239f, 0.134789363f, -0.134789363f, -0.0171531793f, -0.0830719322f,
+    0.0830719322f, 0.121512808f, -0.0252225846f, 0.0252225846f, -0.121512808f, 0.0468020551f, 0.0208294038f, -0.0885296762f,
+    0.083888188f, 0.0797806829f, -0.0797806829f, -0.083888188f, 0.068147324f, -0.068147324f, 0.0885296762f, -0.0208294038f,
+    -0.0666177645f, 0.0666177645f, -0.0135933533f, 0.0905114859f, -0.0905114859f, 0.0135933533f, -0.059936434f, 0.059936434f,
+    -0.0117298597f, -0.0512005948f, -0.0583211444f, -0.0914955065f, 0.0914955065f, 0.0577454045f, -0.0766016319f, -0.0833031908f,
+    0.0833031908f, 0.0766016319f, -0.0577454045f, -0.0418728255f, -0.0645734295f, 0.0645734295f, 0.0418728255f, -0.0810397714f,
+    0.0810397714f, 0.0583211444f, -0.100918919f, 0.0845715329f, -0.0617854781f, 0.0663022324f, -0.0663022324f, 0.0617854781f,
+    -0.0866530761f, 0.0866530761f, -0.0845715329f, 0.100918919f, 0.065008916f, -0.065008916f, -0.0723468885f, -0.062850602f,
+    0.062850602f, 0.0723468885f, -0.0547335669f, 0.0547335669f, 0.0512005948f, 0.0152550824f, -0.0679574236f, 0.0810801089f,
+    0.0830149651f, -0.0830149651f, -0.104213953f, 0.104213953f, -0.0810801089f, -0.0641996413f, -0.0490078144f, 0.0490078144f,
+    0.0641996413f, 0.0902369916f, -0.0902369916f, 0.0679574236f, -0.0534557886f, -0.0685742423f, 0.0856169909f, -0.0856169909f,
+    0.0685742423f, 0.0534557886f, -0.0152550824f, -0.0353939719f, -0.00280728214f, 0.0254744384f, 0.07779558f, -0.07779558f,
+    -0.0254744384f, -0.0456446372f, 0.0456446372f, 0.00280728214f, -0.0637184232f, 0.0637184232f, 0.10519211f, -0.10519211f,
+    0.0353939719f, 0.0394767784f, 0.0508829877f, 0.0317354873f, -0.0317354873f, -0.0508829877f, -0.0874820501f, 0.0874820501f,
+    -0.0394767784f, -0.0741745606f, 0.0741745606f, 0.083120212f, -0.083120212f, 0.000152282591f, -0.0503869057f, -0.0276023131f,
+    -0.0463176966f, 0.0739229843f, -0.11531651f, 0.11531651f, -0.0739229843f, 0.0463176966f, 0.0488539636f, -0.0792483538f,
+    0.0597053356f, -0.0597053356f, 0.0792483538f, -0.0488539636f, -0.0373465568f, -0.0575636402f, 0.0575636402f, 0.0373465568f,
+    -0.0764022246f, 0.0764022246f, 0.0276023131f, -0.0476380587f, 0.0345720164f, -0.0476848893f, 0.102247223f, -0.102247223f,
+    0.0476848893f, -0.0569776855f, 0.0569776855f, -0.0345720164f, -0.0667370185f, 0.0667370185f, 0.0476380587f, 0.0576993786f,
+    -0.028483808f, 0.0667327642f, -0.0667327642f, 0.028483808f, -0.0581898689f, 0.0581898689f, -0.0576993786f, -0.102376036f,
+    0.102376036f, 0.0503869057f, -0.00661453977f, -0.067401126f, 0.0541449003f, -0.00503169978f, 0.0867964178f, -0.0867964178f,
+    0.00503169978f, 0.0752250925f, -0.0752250925f, -0.0541449003f, -0.0989986435f, 0.0989986435f, -0.11111743f, 0.11111743f,
+    0.067401126f, 0.0506140515f, -0.0506140515f, -0.094801262f, -0.0841269568f, 0.0841269568f, 0.094801262f, 0.00661453977f,
+    -0.0625836924f, 0.00269889832f, 0.0656463802f, -0.0769739896f, 0.0769739896f, -0.0656463802f, 0.0534591191f, -0.0534591191f,
+    -0.00269889832f, -0.058685381f, 0.058685381f, 0.0970501155f, -0.0970501155f, 0.0625836924f, -0.0543393902f, 0.0179778337f,
+    0.0576964281f, -0.0576964281f, -0.0179778337f, 0.107977457f, -0.107977457f, 0.0543393902f, 0.00373435789f, -0.0350959115f,
+    -0.0222533159f, -0.0477753542f, -0.0851926357f, 0.0851926357f, 0.0846304893f, -0.0846304893f, -0.0670370236f, 0.0670370236f,
+    0.0477753542f, -0.0406545997f, 0.0745760575f, -0.0745760575f, -0.02980382f, 0.02980382f, 0.0406545997f, 0.0967384949f,
+    -0.0967384949f, 0.0868940502f, -0.0868940502f, 0.0222533159f, -0.0470109843f, 0.0305044632f, -0.0704142898f, 0.0704142898f,
+    0.0595978498f, -0.0595978498f, -0.0305044632f, -0.0198937003f, 0.0532547124f, -0.0532547124f, 0.0198937003f, 0.077790916f,
+    -0.077790916f, 0.0470109843f, 0.0432619303f, 0.0141955549f, -0.0596391f, 0.0596391f, -0.0141955549f, -0.0528325289f,
+    0.0528325289f, -0.0432619303f, -0.0841087028f, -0.0665619001f, 0.0665619001f, 0.0841087028f, -0.0648499653f, 0.0648499653f,
+    0.0350959115f, -0.0566147529f, 0.0287528727f, 0.0911265984f, -0.058675833f, -0.0529191159f, 0.0529191159f, 0.058675833f,
+    -0.0911265984f, -0.0524343885f, -0.0469878465f, 0.0469878465f, 0.0524343885f, 0.0538680218f, -0.0538680218f, -0.0287528727f,
+    -0.0899098217f, 0.0899098217f, 0.07017418f, -0.0290970355f, 0.0290970355f, -0.07017418f, 0.0566147529f, -0.0685336441f,
+    -0.0108692655f, 0.0646248385f, -0.0426559076f, 0.0426559076f, -0.0646248385f, -0.0972316712f, 0.0972316712f, 0.0108692655f,
+    -0.0656057447f, 0.0656057447f, 0.035022676f, -0.035022676f, 0.0685336441f, -0.00255436543f, -0.0448809043f, -0.0602893345f,
+    0.0670184046f, -0.10361623f, 0.10361623f, -0.0670184046f, 0.0602893345f, 0.011640369f, 0.101907983f, -0.101907983f,
+    0.0113560194f, 0.0621379204f, -0.0621379204f, -0.0113560194f, 0.0583171435f, -0.0583171435f, -0.011640369f, -0.0199667215f,
+    0.0475658216f, -0.0576333739f, 0.0576333739f, -0.0475658216f, -0.0716413036f, 0.0716413036f, 0.0199667215f, -0.0768216252f,
+    0.102649927f, -0.102649927f, 0.0768216252f, 0.0539424568f, -0.0539424568f, 0.0448809043f, -0.00842056517f, -0.0521318428f,
+    0.0491765477f, 0.0344220996f, 0.0583963245f, -0.0583963245f, -0.0344220996f, -0.0434194468f, 0.0434194468f, -0.0491765477f,
+    -0.0573350266f, -0.0462035947f, 0.0462035947f, 0.0573350266f, -0.107555598f, 0.107555598f, 0.0521318428f, -0.0632853806f,
+    0.0576707646f, -0.0414389819f, 0.0414389819f, -0.0576707646f, -0.0560547002f, 0.0560547002f, 0.0632853806f, 0.00842056517f,
+    -0.053495761f, -0.0346379951f, 0.0857277587f, -0.0660043657f, 0.0660043657f, -0.0857277587f, 0.0346379951f, -0.0181685947f,
+    0.0838764086f, -0.0838764086f, 0.0181685947f, -0.0921408534f, 0.0921408534f, 0.053495761f, -0.049324166f, 0.0169316512f,
+    0.0529678129f, -0.0529678129f, -0.0169316512f, 0.097723648f, -0.097723648f, 0.049324166f, -0.0010918366f, -0.0316935293f,
+    -0.0561690629f, -0.0794411302f, 0.0794411302f, 0.0752578825f, -0.0752578825f, -0.06498871f, 0.06498871f, 0.0561690629f,
+    -0.0555458851f, 0.0430791005f, -0.0124104396f, 0.120188966f, -0.120188966f, 0.0124104396f, -0.0571524315f, 0.0571524315f,
+    -0.0430791005f, 0.0253373161f, -0.056708619f, 0.056708619f, -0.0253373161f, 0.0435433351f, -0.0435433351f, 0.0555458851f,
+    0.0528100468f, -0.0528100468f, 0.093967095f, -0.093967095f, -0.0561803877f, 0.0561803877f, 0.0316935293f, -0.0145069314f,
+    -0.0797358975f, 0.0301618837f, -0.0440128967f, 0.0576406717f, -0.0576406717f, 0.0440128967f, 0.0464836322f, -0.0464836322f,
+    -0.0301618837f, -0.0699945241f, 0.0699945241f, 0.107974268f, -0.107974268f, 0.0797358975f, -0.0588851348f, 0.0828012377f,
+    -0.0828012377f, -0.122425541f, 0.122425541f, 0.0588851348f, 0.0145069314f, -0.0519761592f, 0.0257466529f, 0.0337978117f,
+    -0.0499745086f, 0.0499745086f, -0.0337978117f, 0.0840986669f, -0.0840986669f, -0.0257466529f, -0.0520946868f, -0.0515661463f,
+    0.0515661463f, 0.0520946868f, 0.0862169936f, -0.0862169936f, 0.0519761592f, -0.0502959378f, -0.010185644f, 0.0874737799f,
+    -0.0874737799f, 0.010185644f, -0.067381911f, 0.067381911f, 0.0502959378f, -0.024766108f, -0.0308688562f, -0.0302667227f,
+    -0.0758873522f, 0.0758873522f, 0.070772253f, -0.070772253f, -0.0623290353f, 0.0623290353f, 0.0302667227f, -0.0304036159f,
+    0.0361535437f, 0.0198394954f, 0.111667782f, -0.111667782f, -0.0198394954f, -0.0728430524f, 0.0728430524f, -0.0361535437f,
+    0.0688378289f, -0.0832611099f, 0.0832611099f, -0.0688378289f, 0.0304036159f, 0.0595963411f, -0.0592721812f, 0.0592721812f,
+    -0.0595963411f, 0.0308688562f, 0.0159123167f, -0.0558189861f, 0.0453172289f, -0.026395224f, 0.0503592342f, -0.0503592342f,
+    0.026395224f, 0.0705074221f, -0.0705074221f, -0.0453172289f, 0.0246119946f, -0.0829520896f, 0.0829520896f, -0.0246119946f,
+    -0.0550713725f, 0.0550713725f, 0.0558189861f, -0.0595154203f, -0.0658479333f, 0.070308283f, -0.070308283f, 0.0658479333f,
+    0.0421046019f, -0.0421046019f, 0.0595154203f, -0.0159123167f, -0.0290203039f, 0.0110833813f, 0.0539031103f, -0.0684895441f,
+    0.0684895441f, -0.0539031103f, 0.0657035634f, -0.0657035634f, -0.0110833813f, -0.0697560459f, 0.0697560459f, 0.081771031f,
+    -0.081771031f, 0.0290203039f, -0.0626408607f, 0.0626408607f, 0.0063312077f, 0.0400883295f, -0.0400883295f, -0.0063312077f,
+    0.060670983f, -0.060670983f, 0.0013898192f, -0.0335760787f, -0.0599581786f, 0.062410403f, -0.0923048034f, 0.0923048034f,
+    -0.062410403f, 0.0599581786f, 0.00166491373f, 0.0763875693f, -0.0763875693f, 0.0541054495f, -0.0923690721f, 0.0923690721f,
+    -0.0541054495f, -0.0366212949f, 0.0366212949f, -0.00166491373f, 0.00529851252f, 0.108300783f, -0.108300783f, 0.0422758423f,
+    -0.0422758423f, -0.00529851252f, 0.0758308992f, -0.0458659418f, 0.0458659418f, -0.0758308992f, -0.0698598847f, 0.0698598847f,
+    0.0335760787f, -0.0574280545f, 0.018315807f, 0.088415809f, -0.0618230142f, 0.0531786121f, -0.0531786121f, 0.0618230142f,
+    -0.088415809f, 0.0125811044f, -0.0587445088f, 0.0587445088f, -0.0125811044f, 0.078281939f, -0.078281939f, -0.018315807f,
+    -0.0722472593f, 0.0722472593f, 0.0510141067f, -0.0282030292f, 0.0282030292f, -0.0510141067f, 0.0574280545f, -0.046876546f,
+    0.00609676866f, 0.0331269205f, 0.0538705736f, -0.0538705736f, -0.0331269205f, -0.0899758786f, 0.0899758786f, -0.00609676866f,
+    -0.0680776685f, 0.0680776685f, -0.0234177299f, 0.0234177299f, 0.046876546f, 0.00122292864f, -0.0553360321f, -0.052528549f,
+    -0.0453566276f, 0.0453566276f, -0.0701791793f, 0.0701791793f, 0.0943150073f, -0.0943150073f, 0.052528549f, -0.0719526038f,
+    0.0344703272f, -0.00968315639f, 0.0519833677f, -0.0519833677f, 0.00968315639f, 0.0398647636f, -0.0398647636f, -0.0344703272f,
+    0.0441745557f, -0.0550977737f, 0.0550977737f, -0.0441745557f, 0.0719526038f, 0.0488739088f, -0.0488739088f, 0.0851981416f,
+    -0.0851981416f, -0.0460765436f, 0.0460765436f, 0.0553360321f, -0.072966598f, -0.0277590659f, 0.0322037339f, -0.0218987074f,
+    0.0546541214f, -0.0546541214f, 0.0218987074f, 0.0468488894f, -0.0468488894f, -0.0322037339f, -0.0672262236f, 0.0672262236f,
+    0.090724051f, -0.090724051f, 0.0277590659f, 0.0220461581f, 0.0183825903f, -0.0375618152f, 0.0375618152f, -0.0183825903f,
+    -0.0627786145f, 0.0627786145f, -0.0220461581f, 0.0548844598f, -0.0645796657f, 0.0645796657f, -0.0548844598f, 0.072966598f,
+    0.00451825606f, -0.0576824322f, -0.0511454679f, -0.0438418537f, 0.0438418537f, -0.0662645698f, 0.0662645698f, 0.0876759663f,
+    -0.0876759663f, 0.0511454679f, -0.0146912057f, 0.0536673777f, -0.0301362593f, 0.0609353408f, -0.0609353408f, 0.0301362593f,
+    -0.0536673777f, 0.0430188067f, -0.0430188067f, 0.0146912057f, 0.0637466311f, 0.0527188927f, -0.0527188927f, 0.0780655742f,
+    -0.0780655742f, -0.0637466311f, 0.0576824322f, -0.0608250014f, -0.00158500334f, 0.020722812f, -0.0613860711f, 0.0519348383f,
+    -0.0519348383f, 0.0613860711f, -0.0428153127f, 0.0428153127f, -0.020722812f, -0.0508876778f, -0.0389169343f, 0.0389169343f,
+    0.0508876778f, 0.0576102883f, -0.0576102883f, 0.00158500334f, -0.0188499372f, -0.0505417325f, 0.062319085f, -0.062319085f,
+    0.0505417325f, -0.0650791302f, 0.0650791302f, 0.0188499372f, -0.00799263828f, 0.0838284045f, -0.0838284045f, 0.00799263828f,
+    -0.0646536052f, 0.0646536052f, 0.0608250014f, -0.0284133963f, -0.0542294867f, -0.0601873547f, 0.0601873547f, -0.0700416416f,
+    -0.0561487116f, 0.0561487116f, 0.0535154939f, -0.067343846f, 0.067343846f, -0.0535154939f, -0.0417399257f, 0.0417399257f,
+    0.0700416416f, 0.106678367f, -0.106678367f, 0.0636281595f, -0.0636281595f, 0.0542294867f, -0.0252757184f, -0.0468961038f,
+    0.0323327631f, 0.0606517009f, -0.048860576f, 0.048860576f, -0.0606517009f, -0.0541817509f, 0.0541817509f, -0.0323327631f,
+    0.0592387877f, -0.0777083486f, 0.0777083486f, -0.0592387877f, 0.0468961038f, 0.0350730419f, -0.0570063852f, 0.0570063852f,
+    -0.0350730419f, -0.0604029857f, -0.0579085276f, 0.0579085276f, 0.0604029857f, 0.0457248613f, -0.0457248613f, 0.0252757184f,
+    -0.0258317981f, 0.0489315875f, 0.0575491227f, -0.0575491227f, 0.1064298f, -0.1064298f, -0.0489315875f, -0.0568659417f,
+    -0.0499709025f, 0.0499709025f, 0.0568659417f, 0.0419708975f, -0.0419708975f, 0.0258317981f, -0.0424916074f, -0.0203823391f,
+    0.0777076408f, -0.0777076408f, 0.0203823391f, -0.0554795265f, 0.0554795265f, 0.0424916074f, -0.0316148214f, -0.0276912432f,
+    -0.0331785716f, 0.0497487932f, -0.0401537158f, 0.0401537158f, -0.0497487932f, 0.0331785716f, -0.0747172907f, -0.038720049f,
+    0.038720049f, 0.0173571762f, 0.0636020303f, -0.0636020303f, -0.0173571762f, -0.0464590527f, 0.0464590527f, 0.0747172907f,
+    0.0703399107f, -0.0703399107f, -0.036158137f, 0.0454003997f, -0.0454003997f, 0.036158137f, -0.066796422f, 0.066796422f,
+    0.0276912432f, 0.0134379836f, -0.0257504359f, 0.015783269f, -0.0836026594f, 0.0992036164f, -0.0992036164f, 0.0836026594f,
+    0.0643140823f, -0.0643140823f, -0.015783269f, -0.0507128313f, -0.0486360677f, 0.0486360677f, 0.0507128313f, 0.0864225775f,
+    -0.0864225775f, 0.0257504359f, 0.0158688314f, -0.0309720002f, 0.0309720002f, -0.0489514992f, 0.0489514992f, -0.0158688314f,
+    -0.029415071f, -0.0616027191f, 0.0616027191f, 0.029415071f, 0.0605294295f, -0.0605294295f, -0.0134379836f, -0.0214322302f,
+    0.00404661568f, 0.0611115433f, 0.0417662933f, -0.0417662933f, -0.0611115433f, 0.0773862302f, -0.0773862302f, -0.00404661568f,
+    -0.0599405617f, 0.0599405617f, 0.0668068007f, -0.0668068007f, 0.0214322302f, -0.0733307078f, 0.0733307078f, -0.00242611277f,
+    0.0343452878f, -0.0343452878f, 0.00242611277f, 0.0404015481f, -0.0404015481f, -0.0117419073f, -0.0553548969f, -0.0250339173f,
+    -0.047723189f, 0.047723189f, -0.0686561391f, 0.0686561391f, 0.0365240388f, -0.0365240388f, 0.0250339173f, 0.0981609151f,
+    -0.0168099534f, -0.0476312451f, 0.0440837294f, -0.0440837294f, 0.0476312451f, 0.0168099534f, 0.0519987196f, -0.0519987196f,
+    0.0695294514f, -0.0695294514f, -0.0981609151f, 0.0553548969f, -0.0551273264f, -0.0178515203f, 0.0355778709f, 0.047434587f,
+    -0.0646180362f, 0.0646180362f, -0.047434587f, 0.0898210853f, -0.0898210853f, -0.0355778709f, -0.0640967861f, 0.0640967861f,
+    0.0795704797f, -0.0795704797f, 0.0178515203f, 0.0328868926f, 0.00970327202f, 0.0430467427f, -0.0430467427f, -0.00970327202f,
+    -0.0512777641f, 0.0512777641f, -0.0328868926f, -0.0537939891f, 0.0537939891f, -0.0594769679f, 0.0594769679f, 0.0551273264f,
+    -0.0250052866f, 0.042210903f, -0.042210903f, -0.0696794838f, 0.0609751791f, -0.0609751791f, 0.0696794838f, 0.0250052866f,
+    -0.0229015946f, -0.0310453381f, -0.0339123979f, 0.0497329086f, -0.0334967449f, 0.0334967449f, -0.0497329086f, 0.0339123979f,
+    -0.0743979886f, -0.0379091501f, 0.0379091501f, 0.0168452729f, 0.0618382394f, -0.0618382394f, -0.0168452729f, -0.0445313081f,
+    0.0445313081f, 0.0743979886f, 0.0577693731f, -0.0577693731f, -0.018017849f, -0.0528913774f, 0.0528913774f, 0.018017849f,
+    -0.0609369352f, 0.0609369352f, 0.0310453381f, -0.0244439561f, -0.0180789158f, 0.0556975529f, -0.0303022005f, 0.0485956632f,
+    -0.0485956632f, 0.0303022005f, -0.0524451137f, 0.0524451137f, -0.0556975529f, -0.0511530824f, 0.0511530824f, 0.0459376574f,
+    -0.0459376574f, 0.0180789158f, 0.0240965113f, -0.0021192506f, 0.0428298377f, -0.0428298377f, 0.0021192506f, 0.0741202384f,
+    -0.0741202384f, -0.0240965113f, -0.0497825779f, 0.0497825779f, -0.05608318f, 0.05608318f, 0.0244439561f, -0.0415416956f,
+    0.0762831643f, -0.0548922867f, 0.0202519875f, -0.0202519875f, 0.0548922867f, -0.0762831643f, 0.0415416956f, 0.0439894423f,
+    -0.0439894423f, -0.072134845f, 0.072134845f, -0.0229283944f, -0.0410710201f, -0.027802242f, 0.0437540859f, -0.0437540859f,
+    0.027802242f, -0.0547621474f, -0.0364676043f, 0.0364676043f, 0.0155165456f, 0.0583825596f, -0.0583825596f, -0.0155165456f,
+    -0.0431419499f, 0.0431419499f, 0.0547621474f, 0.0164866801f, -0.0308376104f, 0.0636189356f, -0.0636189356f, 0.0308376104f,
+    -0.0997081473f, 0.0997081473f, -0.0164866801f, -0.0233301502f, -0.0641080737f, 0.0641080737f, 0.0233301502f, 0.106598206f,
+    -0.106598206f, 0.0410710201f, -0.0143030537f, -0.00896055251f, 0.0437830426f, -0.0548403375f, -0.0424663313f, 0.0424663313f,
+    0.0548403375f, 0.0389989614f, -0.0389989614f, -0.0437830426f, -0.0214630663f, 0.0620612875f, -0.0620612875f, 0.0214630663f,
+    -0.0315782465f, 0.0315782465f, 0.00896055251f, -0.0382012241f, -0.0409848765f, 0.0563058183f, -0.0563058183f, 0.0409848765f,
+    -0.0644637868f, 0.0644637868f, 0.0382012241f, 0.0297007617f, 0.0318621993f, -0.0318621993f, -0.0297007617f, -0.052876737f,
+    0.052876737f, 0.0143030537f, -0.0396554135f, 0.0718381107f, -0.0529005378f, 0.0190276038f, -0.0190276038f, 0.0529005378f,
+    -0.0718381107f, 0.0396554135f, 0.0420231968f, -0.0420231968f, -0.0685839877f, 0.0685839877f, -0.0453098826f, -0.0287516471f,
+    -0.0152489953f, 0.0443899743f, -0.0443899743f, 0.0152489953f, 0.0617333837f, -0.0452202037f, -0.0109120337f, 0.0805809125f,
+    -0.0805809125f, 0.0109120337f, 0.0530166328f, -0.0530166328f, 0.0452202037f, 0.0458683595f, -0.0458683595f, -0.0401143618f,
+    0.0401143618f, -0.0617333837f, 0.0287516471f, -0.0487613417f, -0.00210354477f, -0.0132034803f, 0.117213719f, -0.0356232263f,
+    0.0356232263f, -0.117213719f, 0.0132034803f, -0.0311350301f, 0.052517388f, -0.052517388f, 0.0311350301f, -0.0527681187f,
+    0.0527681187f, 0.00210354477f, -0.0329435542f, 0.0329435542f, -0.0386562794f, 0.0386562794f, 0.0593019687f, -0.0593019687f,
+    0.0487613417f, -0.0378555506f, 0.0677614361f, -0.0510472953f, 0.017880192f, -0.017880192f, 0.0510472953f, -0.0677614361f,
+    0.0378555506f, 0.0401152112f, -0.0401152112f, -0.0652635917f, 0.0652635917f, -0.00550977094f, -0.0356318392f, -0.0458411388f,
+    0.0450032502f, -0.0450032502f, 0.0458411388f, 0.0610599592f, -0.0736059919f, -0.0662188083f, -0.0502214432f, 0.0502214432f,
+    0.0662188083f, 0.0695449486f, -0.0695449486f, 0.0736059919f, -0.0610599592f, 0.0027587486f, -0.0326065011f, 0.0409726873f,
+    -0.0409726873f, 0.0326065011f, -0.0027587486f, 0.0563336723f, -0.096917659f, 0.096917659f, -0.0563336723f, 0.0356318392f,
+    -0.0124768838f, -0.00724063441f, -0.0671702772f, 0.0681259632f, 0.0441883281f, -0.0441883281f, -0.0681259632f, 0.0671702772f,
+    0.0498805195f, -0.0498805195f, 0.0535232909f, -0.0535232909f, 0.00724063441f, -0.0254351683f, 0.0288347155f, 0.0950113758f,
+    -0.0950113758f, -0.0288347155f, -0.0684865788f, 0.0684865788f, 0.0254351683f, 0.0143682547f, 0.0254215673f, -0.0254215673f,
+    -0.0143682547f, -0.0502740741f, 0.0502740741f, 0.0124768838f, 0.0457870848f, 0.0381464809f, -0.0381464809f, -0.0404188931f,
+    -0.0659566075f, 0.0659566075f, 0.0404188931f, -0.0457870848f, -0.0490989685f, 0.0490989685f, 0.0366641022f, -0.0366641022f,
+    -0.0314549804f, -0.0473726057f, -0.0525670648f, 0.0525670648f, 0.0715298578f, -0.0715298578f, 0.0473726057f, -0.00977944676f,
+    0.0278489459f, 0.0509797856f, -0.0509797856f, 0.0344809927f, -0.0410758741f, 0.0410758741f, -0.0344809927f, -0.0271946993f,
+    0.0271946993f, -0.0278489459f, 0.0528804138f, -0.00823084824f, -0.0345347337f, 0.0345347337f, 0.00823084824f, 0.049255114f,
+    -0.049255114f, -0.0528804138f, -0.0417368002f, 0.0417368002f, 0.00977944676f, -0.0467614159f, 0.0216612983f, 0.0647734925f,
+    -0.0710089058f, 0.0710089058f, -0.0647734925f, 0.0572120436f, -0.0572120436f, -0.0216612983f, -0.0481881686f, 0.0481881686f,
+    0.0413934849f, -0.0413934849f, 0.0467614159f, 0.00419399701f, 0.0715160668f, -0.0715160668f, -0.0388906449f, 0.0388906449f,
+    -0.00419399701f, 0.0513760038f, -0.0513760038f, -0.0748493075f, 0.0748493075f, -0.0448938943f, -0.0358903967f, -0.0490449406f,
+    0.0490449406f, 0.0627377778f, -0.0298474096f, 0.0298474096f, -0.0627377778f, 0.0358903967f, -0.0313230231f, 0.0386918671f,
+    0.0012872878f, 0.0376329757f, -0.0755446628f, 0.0755446628f, -0.0376329757f, -0.0251873787f, 0.0251873787f, -0.0012872878f,
+    -0.0414234325f, 0.0579208061f, -0.0579208061f, 0.0414234325f, -0.0259848014f, 0.0259848014f, -0.0386918671f, -0.0484748743f,
+    0.0484748743f, 0.0313230231f, -0.0358761102f, 0.0248258654f, 0.0140923932f, 0.0499671139f, -0.0499671139f, -0.0140923932f,
+    -0.0234258566f, 0.0234258566f, -0.0248258654f, -0.0522501171f, 0.0522501171f, -0.0481746793f, 0.0481746793f, 0.0358761102f,
+    0.0587626137f, -0.0587626137f, -0.0522413924f, 0.0522413924f, 0.0436338633f, -0.0436338633f, -0.0425063632f, -0.0372776762f,
+    -0.0485447496f, 0.0485447496f, 0.0600364096f, -0.0277218353f, 0.0277218353f, -0.0600364096f, 0.0372776762f, -0.0339396894f,
+    0.0368636213f, 0.0217192937f, 0.063949883f, -0.063949883f, -0.0274217855f, 0.0274217855f, -0.0217192937f, 0.0378372408f,
+    -0.0415123887f, 0.0415123887f, -0.0378372408f, -0.0708510429f, 0.0708510429f, -0.0368636213f, -0.0476380624f, 0.0476380624f,
+    0.0339396894f, -0.0287759677f, 0.0283623617f, 0.0479431562f, -0.0434368104f, 0.0434368104f, -0.0479431562f, -0.0282153003f,
+    0.0282153003f, -0.0283623617f, 0.0286496766f, -0.0580225438f, 0.0580225438f, -0.0286496766f, -0.0683256313f, 0.0683256313f,
+    0.0287759677f, 0.0568232015f, -0.0568232015f, -0.0487954766f, 0.0487954766f, 0.0419147126f, -0.0419147126f, -0.0419790931f,
+    -0.0339803956f, -0.0509096682f, 0.0509096682f, -0.0621566176f, 0.0621566176f, 0.0339803956f, -0.012726157f, -0.00381272961f,
+    -0.0611532964f, 0.0850848556f, -0.030687632f, 0.030687632f, -0.0850848556f, 0.0611532964f, -0.011214531f, -0.0535082221f,
+    0.0535082221f, 0.011214531f, 0.0344970673f, -0.0344970673f, 0.00381272961f, -0.0383956358f, 0.0708189309f, -0.0849850848f,
+    0.0849850848f, -0.0708189309f, 0.0383956358f, 0.0448202789f, -0.0535727516f, 0.0535727516f, -0.0448202789f, -0.0316532403f,
+    0.0316532403f, 0.012726157f, -0.0415260382f, 0.0316618904f, -0.0113368938f, 0.0556007922f, -0.0556007922f, 0.0113368938f,
+    -0.0585341528f, 0.0585341528f, -0.0316618904f, -0.0404143073f, 0.0404143073f, 0.0415260382f, 0.0331473239f, 0.0451230817f,
+    -0.0451230817f, -0.0496760122f, 0.0496760122f, -0.0331473239f, -0.050955724f, 0.0645871907f, -0.0645871907f, 0.050955724f,
+    -0.0288978759f, 0.0288978759f, -0.0455890521f, -0.032142967f, -0.0476969108f, 0.0476969108f, 0.0570479743f, 0.0206760466f,
+    -0.0206760466f, -0.0570479743f, 0.032142967f, -0.0463706031f, 0.0546521619f, -0.010227602f, 0.0527553111f, -0.0692415535f,
+    0.0692415535f, -0.0527553111f, 0.034545701f, -0.034545701f, 0.010227602f, -0.000383194012f, -0.0534998216f, 0.0534998216f,
+    0.000383194012f, -0.0364785902f, 0.0364785902f, -0.0546521619f, 0.0463706031f, -0.036733415f, -0.00806890614f, 0.0669483095f,
+    0.0380052142f, -0.0380052142f, -0.0669483095f, -0.0676853359f, 0.0676853359f, 0.00806890614f, -0.0456044562f, 0.0652261153f,
+    -0.0652261153f, 0.0456044562f, -0.0292532556f, 0.0292532556f, 0.036733415f, 0.0451947004f, -0.0451947004f, -0.0417371094f,
+    0.0417371094f, 0.0344738923f, -0.0344738923f, -0.0417368896f, -0.0350019708f, -0.0472501256f, 0.0472501256f, 0.0546175539f,
+    -0.0231065713f, 0.0231065713f, -0.0546175539f, 0.0350019708f, -0.0150090866f, 0.0445188135f, -0.0310084634f, 0.0434674956f,
+    -0.0487056263f, 0.0487056263f, -0.0434674956f, -0.0474181026f, 0.0474181026f, 0.0310084634f, -0.052295018f, 0.0499345325f,
+    -0.0499345325f, 0.052295018f, -0.0445188135f, -0.0399808437f, 0.0399808437f, 0.0150090866f, -0.0534838848f, 0.0464751981f,
+    -0.0393117294f, 0.0550455712f, -0.0550455712f, 0.0393117294f, -0.0551348999f, 0.0551348999f, -0.0464751981f, 0.0534838848f,
+    -0.00685063098f, 0.0535821244f, -0.0535821244f, -0.0772450715f, 0.0772450715f, 0.00685063098f, 0.0451444946f, -0.0451444946f,
+    -0.073205784f, 0.00938345212f, 0.0591829456f, -0.0591829456f, -0.00938345212f, -0.0359574482f, 0.0975238606f, -0.0430441611f,
+    -0.0068826424f, 0.0766322613f, -0.0766322613f, 0.0068826424f, -0.0364705436f, 0.0364705436f, 0.0430441611f, -0.0313861817f,
+    0.0326025598f, -0.0326025598f, 0.0313861817f, -0.0249068923f, 0.0249068923f, -0.0975238606f, 0.0359574482f, -0.0281650592f,
+    0.0281650592f, 0.0337458849f, -0.0210990924f, 0.0450343154f, -0.0450343154f, 0.0210990924f, -0.0649225265f, 0.0649225265f,
+    -0.0337458849f, -0.0639479235f, 0.0639479235f, -0.0195080731f, -0.0433762223f, 0.0585520156f, -0.0585520156f, 0.0433762223f,
+    -0.0397143811f, -0.0340846404f, 0.0586000681f, -0.0666837171f, 0.0465904251f, -0.0465904251f, 0.0666837171f, -0.0586000681f,
+    0.0340846404f, -0.0434726253f, 0.0478563085f, -0.0361039191f, 0.0361039191f, -0.0478563085f, 0.0798696503f, -0.0798696503f,
+    0.0434726253f, 0.068651475f, -0.068651475f, -0.0347019844f, 0.0347019844f, 0.0397143811f, 0.060369283f, -0.060369283f,
+    -0.048187755f, -0.0316044353f, 0.0316044353f, 0.048187755f, 0.0443290174f, -0.0443290174f, -0.0134543153f, -0.0484810546f,
+    0.0578899086f, -0.0578899086f, 0.0484810546f, -0.0266068969f, -0.0225345064f, 0.011193512f, -0.00930110179f, -0.0200928003f,
+    0.0200928003f, 0.00930110179f, 0.0263179205f, -0.0263179205f, -0.011193512f, -0.0548549406f, 0.0630031452f, -0.0630031452f,
+    0.0548549406f, 0.0492776856f, -0.0492776856f, 0.0225345064f, -0.0803519487f, 0.0401705764f, -0.0525393821f, 0.0525393821f,
+    -0.0401705764f, 0.0673523247f, -0.0673523247f, 0.0803519487f, 0.0266068969f, 0.0582526252f, -0.0582526252f, -0.0456192121f,
+    -0.0296983905f, 0.0296983905f, 0.0456192121f, 0.0423727818f, -0.0423727818f, -0.0497848764f, -0.0168569498f, -0.0523635522f,
+    0.0523635522f, 0.0580760352f, -0.0580760352f, 0.0168569498f, -0.0498870574f, 0.102651119f, 0.0168123413f, 0.0680917501f,
+    -0.0680917501f, 0.0273092724f, -0.0273092724f, -0.0168123413f, -0.0527360477f, 0.0467418544f, -0.0467418544f, 0.0527360477f,
+    -0.0286034513f, 0.0286034513f, -0.102651119f, 0.0498870574f, -0.0342290699f, 0.0597617142f, -0.0158280134f, 0.0375696607f,
+    -0.0375696607f, 0.0158280134f, 0.0314707346f, -0.0314707346f, -0.0597617142f, -0.0868935212f, -0.106231563f, 0.106231563f,
+    0.0868935212f, 0.0608559735f, -0.0608559735f, 0.0342290699f, 0.0552582406f, -0.0552582406f, -0.0533424243f, 0.0533424243f,
+    -0.0416936688f, 0.0416936688f, -0.0207678918f, -0.0374318957f, 0.0586953014f, -0.0586953014f, 0.0374318957f, -0.0267861169f,
+    -0.0120895822f, 0.0447288677f, 0.064688541f, -0.064688541f, -0.0360182561f, 0.0360182561f, -0.0447288677f, 0.0464962013f,
+    -0.0464962013f, 0.0120895822f, 0.038561698f, -0.0452331677f, 0.0452331677f, 0.0408787057f, -0.0408787057f, -0.038561698f,
+    -0.0126252566f, 0.0600407645f, -0.0600407645f, 0.0126252566f, 0.0407254063f, -0.0407254063f, 0.0267861169f, -0.013852397f,
+    0.0641928762f, -0.0641928762f, 0.074188672f, -0.074188672f, 0.013852397f, 0.0536609516f, -0.0536609516f, -0.024048999f,
+    -0.0340305753f, -0.058045432f, 0.058045432f, 0.0341262147f, -0.0341262147f, 0.0340305753f, -0.0192308202f, 0.000853098696f,
+    0.0581213571f, -0.065934822f, -0.0267214365f, 0.0267214365f, 0.065934822f, -0.0581213571f, -0.00376337371f, 0.0565238632f,
+    -0.0565238632f, 0.00376337371f, 0.0568390004f, -0.0568390004f, -0.000853098696f, -0.0449947007f, 0.0544333272f, 0.033480987f,
+    -0.033480987f, -0.0544333272f, 0.0449947007f, -0.0378132425f, 0.0644353256f, -0.0644353256f, 0.0378132425f, 0.0401495956f,
+    -0.0401495956f, 0.0192308202f, -0.0265473761f, 0.0673437268f, -0.0673437268f, 0.0265473761f, 0.0523476563f, -0.0523476563f,
+    -0.0138562713f, -0.0420352183f, 0.0577048287f, -0.0577048287f, 0.0420352183f, -0.0317013264f, 0.0119498661f, 0.0469933935f,
+    -0.0627363399f, 0.0661125109f, -0.0661125109f, 0.0627363399f, -0.0469933935f, -0.0779388919f, 0.0779388919f, 0.0617436096f,
+    -0.0617436096f, -0.0119498661f, 0.00312030991f, 0.033022128f, 0.0427283607f, -0.0427283607f, -0.033022128f, -0.073874943f,
+    0.073874943f, -0.00312030991f, 0.0626608655f, -0.0336299576f, 0.0336299576f, -0.0626608655f, 0.0317013264f, 0.0512645356f,
+    -0.0512645356f, -0.0398905762f, 0.0694115236f, -0.0694115236f, 0.0398905762f, 0.0437652282f, -0.0437652282f, -0.0180681441f,
+    -0.0368984379f, 0.0566622876f, -0.0566622876f, 0.0368984379f, -0.032978531f, -0.00152160134f, 0.00593475578f, -0.0453381687f,
+    0.0471384376f, -0.0471384376f, 0.0453381687f, -0.0544025823f, 0.0544025823f, -0.00593475578f, -0.0638044104f, 0.0628938377f,
+    -0.0628938377f, 0.0638044104f, 0.00152160134f, -0.0175075382f, 0.060275089f, 0.0417301767f, -0.0417301767f, -0.060275089f,
+    0.0175075382f, 0.0528817922f, -0.0499823354f, 0.0499823354f, -0.0528817922f, -0.0648894385f, 0.0648894385f, 0.032978531f,
+    0.0554969348f, -0.0554969348f, -0.044208549f, 0.044208549f, 0.0360780507f, -0.0360780507f, -0.0381158106f, -0.0168611128f,
+    -0.0567197278f, 0.0567197278f, 0.0245553255f, -0.0245553255f, 0.0168611128f, -0.0482738465f, -0.00681987312f, 0.10351903f,
+    0.066453591f, -0.066453591f, -0.0401858501f, 0.0401858501f, -0.10351903f, 0.00681987312f, -0.025355f, 0.025355f,
+    -0.0304894987f, 0.0304894987f, 0.0359700881f, -0.0359700881f, 0.0482738465f, -0.0253585652f, 0.0615866035f, -0.0615866035f,
+    0.0253585652f, 0.0480281189f, -0.0480281189f, -0.0154266609f, -0.0407636277f, 0.050799951f, -0.050799951f, 0.0407636277f,
+    -0.0296763163f, -0.00520943524f, 0.0437692367f, -0.0516088009f, 0.066543743f, -0.066543743f, 0.0516088009f, -0.0437692367f,
+    0.0625711903f, -0.0625711903f, 0.00520943524f, 0.0177626703f, 0.0419292301f, -0.0555036552f, 0.0555036552f, -0.0419292301f,
+    -0.0225414131f, 0.0225414131f, -0.0177626703f, -0.0589181595f, 0.0763243735f, -0.0763243735f, 0.0589181595f, -0.0302692223f,
+    0.0302692223f, 0.0296763163f, 0.0481440276f, -0.0481440276f, -0.0362709165f, 0.0632818565f, -0.0632818565f, 0.0362709165f,
+    0.0402645394f, -0.0402645394f, -0.0487234928f, -0.0539941303f, 0.0539941303f, -0.0449983031f, -0.0452481546f, 0.0452481546f,
+    0.0148520712f, -0.0490312204f, 0.0490312204f, 0.0786739886f, -0.0786739886f, -0.0148520712f, -0.0150278611f, 0.100516871f,
+    -0.100516871f, 0.0150278611f, -0.00877855998f, 0.00877855998f, 0.0449983031f, 0.0496787094f, -0.0496787094f, -0.0396623351f,
+    0.0389125124f, -0.0389125124f, 0.0396623351f, 0.037558116f, -0.037558116f, -0.0200561229f, -0.0323851779f, -0.0538895503f,
+    0.0538895503f, 0.0214864481f, -0.0214864481f, 0.0323851779f, -0.0130430311f, -0.0268042292f, 0.0626052618f, 0.0568755753f,
+    -0.0568755753f, 0.022372717f, -0.022372717f, -0.0626052618f, -0.0578307062f, 0.0578307062f, 0.0268042292f, -0.0370127782f,
+    0.0638007522f, -0.0445101708f, 0.0445101708f, -0.0638007522f, 0.0870773569f, -0.0870773569f, 0.0370127782f, -0.0352532603f,
+    0.0352532603f, 0.0130430311f, -0.0237784889f, 0.0548151471f, -0.0548151471f, 0.0237784889f, 0.0433865562f, -0.0433865562f,
+    -0.0460501276f, -0.0522504263f, 0.0522504263f, -0.0401734002f, -0.0450903066f, 0.0450903066f, 0.0261137765f, 0.0529717468f,
+    -0.0529717468f, -0.0261137765f, -0.0103540309f, 0.0950911865f, -0.0950911865f, 0.0103540309f, -0.00959197339f, 0.00959197339f,
+    0.0401734002f, 0.0466588661f, -0.0466588661f, -0.0374341123f, 0.0349363163f, -0.0349363163f, 0.0374341123f, -0.0346945897f,
+    0.0346945897f, -0.0497008748f, -0.0461445265f, 0.0461445265f, -0.0193978045f, 0.0449141189f, -0.0148047321f, -0.0514540821f,
+    -0.0644115359f, 0.0644115359f, 0.0514540821f, 0.0148047321f, 0.0568056665f, -0.0484308898f, 0.0484308898f, -0.0568056665f,
+    -0.084423013f, 0.084423013f, -0.0449141189f, -0.0548897497f, 0.0548897497f, 0.0193978045f, -0.000828051358f, -0.053030625f,
+    -0.0542333573f, -0.0528137423f, 0.0528137423f, 0.0542333573f, 0.053030625f, 0.000828051358f, 0.0115997028f, -0.0285335854f,
+    -0.0695683807f, 0.0695683807f, 0.0285335854f, -0.060753148f, 0.060753148f, -0.0115997028f, -0.0462157577f, 0.0587989874f,
+    -0.0587989874f, 0.0462157577f, 0.0538021103f, -0.0538021103f, -0.0447549559f, -0.0485994518f, 0.0485994518f, 0.0031693459f,
+    -0.091505155f, 0.0534943044f, 0.0659778416f, -0.032657817f, 0.032657817f, -0.0659778416f, -0.0779850557f, 0.0779850557f,
+    -0.0534943044f, 0.091505155f, 0.0503425002f, -0.0503425002f, -0.0031693459f, -0.0233395435f, -0.00284880283f, 0.036521405f,
+    -0.036521405f, -0.0527950004f, 0.0527950004f, 0.00284880283f, -0.0204787217f, 0.0355324261f, -0.0355324261f, 0.0204787217f,
+    0.0267333649f, -0.0267333649f, 0.0233395435f, -0.0325591415f, 0.0850071609f, -0.0850071609f, 0.0325591415f, 0.0523544215f,
+    -0.0523544215f, -0.0595267266f, 0.0595267266f, -0.0226366017f, -0.0263627302f, -0.0500295497f, 0.0500295497f, 0.0263627302f,
+    -0.0205553323f, -0.0150373243f, 0.0317294039f, 0.0445881858f, -0.0474015921f, 0.0474015921f, -0.0445881858f, -0.0358583108f,
+    0.0358583108f, -0.0317294039f, -0.0419144183f, 0.0419144183f, 0.0150373243f, 0.0398897678f, -0.0423644818f, 0.0423644818f,
+    0.0400151797f, -0.0400151797f, -0.0398897678f, -0.0134684378f, 0.0704465136f, -0.0704465136f, 0.0134684378f, -0.0351103693f,
+    0.0351103693f, 0.0205553323f, -0.0218502712f, 0.0517640747f, -0.0517640747f, 0.0218502712f, 0.041753199f, -0.041753199f,
+    -0.0487557873f, -0.039922595f, 0.039922595f, -0.0207610019f, 0.0280262977f, -0.036833927f, 0.0621615462f, -0.0518624559f,
+    0.0518624559f, -0.0621615462f, 0.036833927f, 0.0532292873f, -0.0470728464f, 0.0470728464f, -0.0532292873f, -0.0770441219f,
+    0.0770441219f, -0.0280262977f, -0.0464089774f, 0.0464089774f, 0.0207610019f, 0.00354438787f, -0.0482961386f, -0.0499869958f,
+    -0.0466687642f, 0.0466687642f, 0.0499869958f, 0.0482961386f, -0.00354438787f, 0.0181838498f, -0.0276800971f, -0.0633326694f,
+    0.0633326694f, 0.0276800971f, -0.0581324324f, 0.0581324324f, -0.0181838498f, -0.0548160151f, -0.0453715995f, 0.0453715995f,
+    0.0548160151f, 0.047587432f, -0.047587432f,
+};
+
+constexpr ModelTables MODEL_TABLE = {
+    MODEL_TABLE_NODES,
+    MODEL_TABLE_TREE_ROOTS,
+    MODEL_TABLE_TREE_CLASS,
+    MODEL_TABLE_NODE_COUNT,
+    MODEL_TABLE_TREE_COUNT,
+    MODEL_THRESHOLD,
+    MODEL_LOGIT_THRESHOLD,
+    MODEL_TABLE_MARGIN_MIN,
+    MODEL_TABLE_MARGIN_MAX,
+};
+
+#endif
@@ -0,0 +1,129 @@
+#ifndef MODEL_UNROLLED_H
+#define MODEL_UNROLLED_H
+
+// Mô hình chuyên biệt lúc biên dịch: bảng constexpr (model_table.h) được template
+// trải thành if lồng nhau, ngưỡng và lá là hằng số trong code giống model_final.h
+// nhưng sinh từ cùng bảng với TreeEnsemble. Bảng hỏng thì static_assert dừng build.
+
+#include "model_engine.h"
+#include <math.h>
+#include <utility>
+
+// Chỉ số node ngay sau cây con gốc i (bảng preorder: con phải của node cuối cùng
+// trên nhánh phải). count + 1 nếu đi ra ngoài bảng
+constexpr uint32_t modelSubtreeEnd(const ModelTables& m, uint32_t i) {
+    while (i < m.nodeCount && m.nodes[i].feature != MODEL_LEAF) {
+        if (m.nodes[i].right <= i) return m.nodeCount + 1u;
+        i = m.nodes[i].right;
+    }
+    return i < m.nodeCount ? i + 1 : m.nodeCount + 1u;
+}
+
+// Feature của mọi split và lớp của mọi cây nằm trong phạm vi
+constexpr bool modelIndicesValid(const ModelTables& m) {
+    for (uint32_t i = 0; i < m.nodeCount; i++) {
+        uint8_t feature = m.nodes[i].feature;
+        if (feature != MODEL_LEAF && feature >= MODEL_FEATURE_COUNT) return false;
+    }
+    for (uint32_t t = 0; t < m.treeCount; t++) {
+        if (m.treeClass[t] >= MODEL_CLASS_COUNT) return false;
+    }
+    return true;
+}
+
+// Mỗi cây là một đoạn preorder liền nhau: con trái là i + 1, cây con trái kết thúc
+// đúng tại con phải, và cây t kết thúc đúng tại gốc cây t + 1
+constexpr bool modelShapeValid(const ModelTables& m) {
+    if (m.treeCount == 0 || m.treeRoots[0] != 0) return false;
+    for (uint32_t i = 0; i < m.nodeCount; i++) {
+        const ModelNode& node = m.nodes[i];
+        if (node.feature == MODEL_LEAF) continue;
+        if (node.right <= i + 1 || node.right >= m.nodeCount) return false;
+        if (modelSubtreeEnd(m, i + 1) != node.right) return false;
+    }
+    for (uint32_t t = 0; t < m.treeCount; t++) {
+        uint32_t end = t + 1 < m.treeCount ? m.treeRoots[t + 1] : m.nodeCount;
+        if (m.treeRoots[t] >= m.nodeCount || modelSubtreeEnd(m, m.treeRoots[t]) != end) return false;
+    }
+    return true;
+}
+
+struct ModelInputBox {
+    float lo[MODEL_FEATURE_COUNT];
+    float hi[MODEL_FEATURE_COUNT];
+};
+
+constexpr bool modelSubtreeOrdered(const ModelTables& m, uint32_t i, ModelInputBox box) {
+    const ModelNode& node = m.nodes[i];
+    if (node.feature == MODEL_LEAF) {
+        return node.value == node.value && node.value > -INFINITY && node.value < INFINITY;
+    }
+    // Ngưỡng phải nằm hẳn trong hộp mà các split phía trên để lại, nếu không một
+    // nhánh không bao giờ tới được (hoặc ngưỡng là NaN)
+    if (!(box.lo[node.feature] < node.value && node.value < box.hi[node.feature])) return false;
+    ModelInputBox left = box;
+    ModelInputBox right = box;
+    left.hi[node.feature] = node.value;
+    right.lo[node.feature] = node.value;
+    return modelSubtreeOrdered(m, i + 1, left) && modelSubtreeOrdered(m, node.right, right);
+}
+
+// Ngưỡng trên mỗi đường đi tăng/giảm chặt theo từng feature, lá hữu hạn
+constexpr bool modelThresholdsOrdered(const ModelTables& m) {
+    if (!modelShapeValid(m)) return false;
+    ModelInputBox box = {};
+    for (int f = 0; f < MODEL_FEATURE_COUNT; f++) {
+        box.lo[f] = -INFINITY;
+        box.hi[f] = INFINITY;
+    }
+    for (uint32_t t = 0; t < m.treeCount; t++) {
+        if (!modelSubtreeOrdered(m, m.treeRoots[t], box)) return false;
+    }
+    return true;
+}
+
+// Model là bảng constexpr (MODEL_TABLE). Cộng đủ các cây theo thứ tự nên kết quả
+// trùng bit với TreeEnsemble::predictFull; không dừng sớm.
+template <const ModelTables& Model>
+class UnrolledEnsemble {
+        static_assert(modelIndicesValid(Model), "bảng mô hình có feature hoặc lớp ngoài phạm vi");
+        static_assert(modelShapeValid(Model), "bảng mô hình không phải các cây preorder liền nhau");
+        static_assert(modelThresholdsOrdered(Model), "ngưỡng split không chặt theo đường đi hoặc lá không hữu hạn");
+
+    public:
+        static int predict(const float* x) {
+            float v[MODEL_CLASS_COUNT];
+            votes(x, v);
+            float exp0 = expf(v[0]);
+            float exp1 = expf(v[1]);
+            float prob = exp1 / (exp0 + exp1);
+            return prob >= Model.threshold ? 1 : 0;
+        }
+
+        // Một hàm cho cả ensemble: đo kích thước code bằng symbol này
+        __attribute__((noinline)) static void votes(const float* x, float* out) {
+            for (int k = 0; k < MODEL_CLASS_COUNT; k++) {
+                out[k] = 0;
+            }
+            sumTrees(x, out, std::make_index_sequence<Model.treeCount>());
+        }
+
+    private:
+        template <size_t... T>
+        __attribute__((always_inline)) static void sumTrees(const float* x, float* out, std::index_sequence<T...>) {
+            // Fold trên dấu phẩy chạy từ trái sang phải: cùng thứ tự cộng với bảng
+            ((out[Model.treeClass[T]] += leaf<Model.treeRoots[T]>(x)), ...);
+        }
+
+        template <uint16_t I>
+        __attribute__((always_inline)) static float leaf(const float* x) {
+            constexpr ModelNode node = Model.nodes[I];
+            if constexpr (node.feature == MODEL_LEAF) {
+                return node.value;
+            } else {
+                return x[node.feature] <= node.value ? leaf<I + 1>(x) : leaf<node.right>(x);
+            }
+        }
+};
+
+#endif
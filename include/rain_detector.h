@@ -0,0 +1,53 @@
+#ifndef RAIN_DETECTOR_H
+#define RAIN_DETECTOR_H
+
+// Phát hiện mưa bằng ngắt cạnh trên RAIN_PIN. Mỗi cạnh khởi động lại timer phần
+// cứng RAIN_DEBOUNCE_MS; khi timer hết hạn mà mức chân khác trạng thái ổn định thì
+// sinh sự kiện bắt đầu/tạnh mưa, mang thời điểm của cạnh đầu tiên (giọt đầu tiên).
+// Sự kiện đi qua SpscRing từ ngắt timer tới loop.
+
+#include "config.h"
+
+struct RainEvent {
+    uint32_t timeMs;        // millis() của cạnh đầu tiên, trước khi hết rung
+    bool raining;           // true: bắt đầu mưa, false: tạnh
+};
+
+// Thời gian ướt theo từng giờ (tính từ lúc khởi động), RAIN_WET_HOURS giờ gần nhất
+class WetTimeTracker {
+    public:
+        WetTimeTracker();
+
+        // Gọi với mỗi sự kiện (theo thứ tự thời gian) và định kỳ để đóng giờ cũ
+        void update(uint32_t nowMs, bool raining);
+        void reset();
+
+        // 0 = giờ hiện tại
+        uint32_t wetMs(uint8_t hoursAgo) const;
+        uint32_t totalWetMs() const;
+
+    private:
+        uint32_t hourly[RAIN_WET_HOURS];
+        uint8_t pos;            // ô của giờ hiện tại
+        uint32_t hourStartMs;
+        uint32_t lastMs;
+        bool raining;
+        bool started;
+};
+
+// Đọc mức ban đầu, gắn ngắt cạnh và timer debounce
+void setupRainDetector();
+
+// Sự kiện đã qua debounce, theo thứ tự; false khi hết. Chỉ gọi từ loop
+bool popRainEvent(RainEvent& event);
+
+// Trạng thái ổn định hiện tại (gọi được từ mọi task)
+bool rainDetectorRaining();
+// true nếu đang mưa hoặc đã có mưa từ lần gọi trước: mưa ngắn giữa hai lần lấy mẫu
+// không bị bỏ sót. Chỉ một nơi gọi (task cảm biến)
+bool rainDetectorTakeWet();
+
+uint32_t rainDetectorEdges();       // số cạnh (kể cả rung)
+uint32_t rainDetectorDropped();     // sự kiện bị bỏ vì loop không lấy kịp
+
+#endif
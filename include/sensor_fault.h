@@ -0,0 +1,125 @@
+#ifndef SENSOR_FAULT_H
+#define SENSOR_FAULT_H
+
+// Phát hiện lỗi cảm biến theo luồng: mỗi kênh một FaultDetector giữ bitmask lỗi
+// riêng, cập nhật O(1) mỗi lần đọc (không lưu lịch sử). Kênh đang lỗi bị loại khỏi
+// đặc trưng (NaN) thay vì làm bẩn cửa sổ trượt và đầu vào mô hình. Không phụ thuộc
+// Arduino.
+
+#include <stdint.h>
+#include <math.h>
+#include "sensor_hal.h"
+
+#define FAULT_NAN_BURST 3               // số lần đọc lỗi liên tiếp thì báo SENSOR_FAULT_NAN
+#define FAULT_SPIKE_CONFIRM 3           // số lần đọc liên tiếp ở mức mới thì coi là bước thật
+#define FAULT_FLAT_ALPHA 0.05f          // hệ số trung bình trượt của phương sai
+
+enum SensorFaultBit {
+    SENSOR_FAULT_RANGE = 1 << 0,        // ngoài giới hạn vật lý của cảm biến
+    SENSOR_FAULT_NAN = 1 << 1,          // đọc lỗi FAULT_NAN_BURST lần liên tiếp
+    SENSOR_FAULT_SPIKE = 1 << 2,        // nhảy nhanh hơn tốc độ thay đổi tối đa
+    SENSOR_FAULT_STUCK = 1 << 3,        // đúng một giá trị suốt stuckMs
+    SENSOR_FAULT_FLAT = 1 << 4,         // phương sai trượt dưới ngưỡng suốt flatMs
+};
+#define SENSOR_FAULT_KINDS 5
+
+struct FaultLimits {
+    float lo, hi;                       // giới hạn vật lý
+    float maxStep;                      // thay đổi cho phép giữa hai lần đọc...
+    float maxRatePerMin;                // ...cộng theo thời gian giữa hai lần đọc
+    uint32_t stuckMs;                   // 0 = không kiểm tra
+    uint32_t flatMs;                    // 0 = không kiểm tra
+    float flatVariance;
+    float quietFloor;                   // giá trị <= floor được phép đứng yên (đêm: 0 lux)
+};
+
+// Lỗi kéo dài: mọi loại trừ xung (xung tự hết sau FAULT_SPIKE_CONFIRM lần đọc)
+#define SENSOR_FAULT_PERSISTENT (SENSOR_FAULT_RANGE | SENSOR_FAULT_NAN | SENSOR_FAULT_STUCK | SENSOR_FAULT_FLAT)
+
+// Theo cảm biến của hệ thống: DHT11 độ phân giải 1 đơn vị nên không kiểm tra
+// phẳng; đất khô hẳn (0) hay ướt hẳn (1023) vẫn là số đọc hợp lệ, đầu dò hở mạch
+// hoặc chập nằm yên ở biên ADC nên bị bắt bởi kiểm tra đứng yên/phẳng; ánh sáng đổi
+// theo mây nên không giới hạn bước
+#define FAULT_LIMITS_TEMPERATURE { -10.0f, 60.0f, 3.0f, 0.5f, 12 * 3600000ul, 0, 0.0f, -INFINITY }
+#define FAULT_LIMITS_HUMIDITY { 0.0f, 100.0f, 8.0f, 2.0f, 12 * 3600000ul, 0, 0.0f, -INFINITY }
+#define FAULT_LIMITS_SOIL { 0.0f, 1023.0f, 40.0f, 30.0f, 6 * 3600000ul, 24 * 3600000ul, 0.25f, -INFINITY }
+#define FAULT_LIMITS_LIGHT { 0.0f, 120000.0f, INFINITY, 0.0f, 2 * 3600000ul, 4 * 3600000ul, 1.0f, 1.0f }
+
+class FaultDetector {
+    public:
+        explicit FaultDetector(const FaultLimits& limits);
+
+        // Một lần đọc, NaN = đọc lỗi. Trả về bitmask SensorFaultBit sau lần đọc này
+        uint8_t update(uint32_t timeMs, float value);
+        void reset();
+
+        uint8_t mask() const { return faults; }
+        // Lần đọc cuối dùng được: hợp lệ, không bị bỏ như xung và kênh không lỗi
+        bool usable() const { return accepted && faults == 0; }
+        // Số lần lỗi loại bit (1 << kind) bắt đầu
+        uint32_t count(int kind) const { return onsets[kind]; }
+        uint32_t samples() const { return total; }
+
+    private:
+        void set(uint8_t bit, bool on);
+
+        FaultLimits limit;
+        uint8_t faults;
+        bool accepted;
+        uint32_t total;
+        uint32_t onsets[SENSOR_FAULT_KINDS];
+        uint8_t nanRun;
+        // Giá trị nhận cuối cùng (mốc cho xung và đứng yên)
+        bool hasLast;
+        float lastValue;
+        uint32_t lastMs;
+        uint32_t sameSinceMs;
+        // Mức mới đang chờ xác nhận
+        uint8_t spikeRun;
+        float candidate;
+        uint32_t candidateMs;
+        // Phương sai trượt
+        float mean;
+        float variance;
+        uint32_t flatSinceMs;
+};
+
+enum FaultChannel {
+    FAULT_TEMPERATURE,
+    FAULT_HUMIDITY,
+    FAULT_SOIL,
+    FAULT_LIGHT,
+    FAULT_CHANNEL_COUNT
+};
+
+// Bộ phát hiện cho mọi kênh của SensorSample
+class SensorFaultMonitor {
+    public:
+        SensorFaultMonitor();
+
+        // Chỉ các kênh vừa đọc (sample.fresh) được cập nhật
+        void update(const SensorSample& sample);
+        void reset();
+
+        const FaultDetector& channel(int index) const { return detectors[index]; }
+        uint8_t mask(int index) const { return detectors[index].mask(); }
+        // Bit kênh: kênh đang có lỗi
+        uint8_t faultyChannels() const;
+        // Bit kênh: kênh đang có lỗi kéo dài (SENSOR_FAULT_PERSISTENT)
+        uint8_t persistentFaultChannels() const;
+
+        // Giá trị của kênh không dùng được đổi thành không hợp lệ (NaN, ánh sáng âm)
+        void exclude(FeatureSample& sample) const;
+        // Đặc trưng dựa trên kênh đang lỗi thành NaN (vector theo FeatureIndex)
+        void exclude(float* features) const;
+
+    private:
+        FaultDetector detectors[FAULT_CHANNEL_COUNT];
+};
+
+// Bit kênh mà featureCount đặc trưng đầu (FeatureIndex) được tính từ
+uint8_t featureFaultChannels(int featureCount);
+const char* faultChannelName(int index);
+const char* sensorFaultName(int kind);
+
+#endif
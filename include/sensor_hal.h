@@ -0,0 +1,69 @@
+#ifndef SENSOR_HAL_H
+#define SENSOR_HAL_H
+
+// Lớp trừu tượng cảm biến: đường lấy mẫu -> đặc trưng -> mô hình -> luật điều khiển
+// chỉ thấy SensorBackend và halMillis(), nên chạy được cả trên ESP32 (phần cứng thật
+// hoặc mô phỏng) lẫn trên host (mô phỏng, phát lại trace) với đồng hồ giả.
+// Không phụ thuộc Arduino.
+
+#include <stdint.h>
+#include "feature_store.h"
+
+// Kênh lấy mẫu thích nghi, mỗi kênh một chu kỳ riêng (mưa đi bằng ngắt trên phần cứng)
+enum SensorChannel {
+    SENSOR_CHANNEL_DHT,         // nhiệt độ + độ ẩm không khí, một lần đọc DHT11
+    SENSOR_CHANNEL_SOIL,
+    SENSOR_CHANNEL_LIGHT,       // BH1750 qua I2C
+    SENSOR_CHANNEL_COUNT
+};
+
+// Một lần thức của task cảm biến có ít nhất một kênh đến hạn. Kênh không đọc giữ
+// giá trị của lần đọc trước
+struct SensorSample {
+    uint32_t timeMs;            // halMillis() lúc bắt đầu đọc
+    uint32_t latenessUs;        // trễ so với lịch (nhịp SENSOR_TICK_MS)
+    uint32_t readUs;            // thời gian đọc (DHT11 bit-bang, chờ BH1750 chuyển đổi)
+    uint32_t i2cUs;             // thời gian chiếm bus I2C trong lần thức này
+    float temperature;          // NaN nếu DHT11 lỗi
+    float humidity;
+    int soilMoisture;
+    float soilNoise;            // nhiễu ước lượng (thang 0-1023), NaN nếu không lọc
+    float lightLevel;           // âm nếu BH1750 lỗi
+    bool rainDetected;          // có mưa lúc nào đó trong chu kỳ (kể cả mưa ngắn)
+    uint8_t fresh;              // bit (1 << SensorChannel): kênh vừa được đọc
+    uint32_t intervalMs[SENSOR_CHANNEL_COUNT];  // chu kỳ hiện tại của từng kênh
+};
+
+// Mẫu chưa đọc: mọi kênh không hợp lệ
+void sensorSampleInvalid(SensorSample& sample);
+// Phần mẫu feature store dùng
+void sensorSampleFeatures(const SensorSample& sample, FeatureSample& out);
+
+class SensorBackend {
+    public:
+        virtual ~SensorBackend() {}
+
+        virtual const char* name() const = 0;
+        // false nếu cảm biến không trả lời (DHT11 hoặc BH1750 lỗi, trace không mở được)
+        virtual bool begin() = 0;
+        // Đọc các kênh trong due vào sample, kênh khác giữ nguyên; luôn ghi rainDetected
+        virtual void read(SensorSample& sample, uint8_t due) = 0;
+
+        // Mưa đi bằng sự kiện ngắt (rain_detector.h) thay cho rainDetected trong mẫu
+        virtual bool rainInterrupt() const { return false; }
+        // Dự báo mưa 1 giờ tới (mm) đi kèm số đọc (mô phỏng, trace) cho công cụ host;
+        // false nếu không có. Firmware vẫn dùng OpenWeather
+        virtual bool forecast(uint32_t /*nowMs*/, float& /*rainNext1h*/) { return false; }
+        // Trạng thái cơ cấu chấp hành, để mô phỏng phản hồi (bơm làm ướt đất)
+        virtual void actuate(uint32_t /*nowMs*/, bool /*pump*/, bool /*canopy*/) {}
+        // Thời gian chiếm bus I2C tích lũy từ lần gọi trước (micro giây)
+        virtual uint32_t takeBusUs() { return 0; }
+};
+
+// Đồng hồ của đường cảm biến và điều khiển: millis() trên ESP32 cho tới khi bị giả
+// lập bằng halMockClock; trên host luôn là đồng hồ giả (bắt đầu từ 0)
+uint32_t halMillis();
+void halMockClock(uint32_t nowMs);
+void halAdvanceClock(uint32_t deltaMs);
+
+#endif
@@ -2,12 +2,44 @@
 #define SENSOR_HANDLER_H
 
 #include "config.h"
+#include "feature_store.h"
+#include "sensor_hal.h"
+#include "sensor_fault.h"
 
+// Đặc trưng cửa sổ trượt, cập nhật sau mỗi lần readSensors
+extern FeatureStore featureStore;
+
+// Khởi tạo backend SENSOR_BACKEND rồi chạy task đọc trên core SENSOR_TASK_CORE
 void setupSensors();
+
+// Báo trạng thái bơm/mái che cho backend (mô phỏng dùng để làm ướt đất)
+void sensorActuate(bool pump, bool canopy);
+
+// Lấy mọi mẫu task đã gửi (không chặn): cập nhật sensorData và featureStore
 void readSensors();
-void readDHT11();
-void readSoilMoisture();
-void readRainSensor();
-void readLightSensor();
+
+// Lấy sự kiện mưa từ ngắt (không chặn): cập nhật sensorData.rainDetected ngay và
+// thời gian ướt theo giờ. true nếu trạng thái mưa vừa đổi
+bool handleRainEvents();
+void setRainJson(FirebaseJson& json);
+
+// Tóm tắt mọi mẫu từ lần upload trước (số mẫu, trung bình, độ lệch chuẩn, min/max,
+// lần đổi cuối) thay cho một số đọc tức thời; reset sau mỗi lần upload
+void setSensorSummaryJson(FirebaseJson& json);
+void resetSensorSummary();
+
+// Lỗi theo kênh (kẹt, xung, NaN liên tiếp, phẳng, ngoài dải), cập nhật mỗi mẫu
+const SensorFaultMonitor& sensorFaults();
+void setSensorFaultJson(FirebaseJson& json);
+// featureStore.vector với đặc trưng của kênh đang lỗi là NaN; trả về số hợp lệ
+int sensorFeatureVector(float* out);
+
+// In vector đặc trưng hiện tại và RAM của feature store
+void printFeatures();
+
+// Độ trễ lịch lấy mẫu (jitter), thời gian đọc, độ trễ tới loop (micro giây) và
+// tốc độ lấy mẫu hiện tại của từng kênh
+void printSensorTiming();
+void setSensorTimingJson(FirebaseJson& json);
 
 #endif
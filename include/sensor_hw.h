@@ -0,0 +1,30 @@
+#ifndef SENSOR_HW_H
+#define SENSOR_HW_H
+
+// Backend phần cứng thật: DHT11 (dht), BH1750 hai pha (light_sensor.h), đất qua ADC
+// DMA hoặc analogRead, mưa qua ngắt (rain_detector.h)
+
+#include "config.h"
+#include "sensor_hal.h"
+#include "light_sensor.h"
+
+class HardwareSensorBackend : public SensorBackend {
+    public:
+        HardwareSensorBackend();
+
+        const char* name() const override { return "hardware"; }
+        bool begin() override;
+        void read(SensorSample& sample, uint8_t due) override;
+        bool rainInterrupt() const override { return true; }
+        uint32_t takeBusUs() override { return light.takeBusUs(); }
+
+        const LightSensor& lightSensor() const { return light; }
+
+    private:
+        void readSoil(SensorSample& sample);
+        float collectLight();
+
+        LightSensor light;
+};
+
+#endif
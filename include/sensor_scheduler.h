@@ -0,0 +1,43 @@
+#ifndef SENSOR_SCHEDULER_H
+#define SENSOR_SCHEDULER_H
+
+// Lấy mẫu thích nghi: nơi gọi (task cảm biến hoặc host) thức mỗi SENSOR_TICK_MS và
+// chỉ đọc các kênh đến hạn. Chu kỳ mỗi kênh giãn khi số đọc đứng yên trong deadband
+// (đêm) và co khi thay đổi nhanh (bình minh), trong [MIN, MAX] (adaptive_sampler.h).
+// Đặt MIN = MAX để quay về chu kỳ cố định. Không phụ thuộc Arduino.
+
+#include "sensor_hal.h"
+#include "adaptive_sampler.h"
+
+#define SENSOR_TICK_MS 1000
+#define DHT_INTERVAL_MIN_MS 2000        // DHT11 cần tối thiểu 1 giây giữa hai lần đọc
+#define DHT_INTERVAL_MAX_MS 60000
+#define DHT_DEADBAND_TEMP 0.5f          // °C
+#define DHT_DEADBAND_HUMIDITY 2.0f      // %
+#define SOIL_INTERVAL_MIN_MS 2000
+#define SOIL_INTERVAL_MAX_MS 60000
+#define SOIL_DEADBAND 5.0f              // thang 0-1023; nhỏ nhất, nới theo nhiễu ước lượng
+#define LIGHT_INTERVAL_MIN_MS 1000
+#define LIGHT_INTERVAL_MAX_MS 30000
+#define LIGHT_DEADBAND_LUX 20.0f
+#define LIGHT_DEADBAND_RATIO 0.1f       // hoặc 10% giá trị trước, lấy số lớn hơn
+
+class SensorScheduler {
+    public:
+        SensorScheduler();
+
+        // Mọi kênh về chu kỳ nhỏ nhất, lần đọc trước không hợp lệ
+        void reset();
+
+        // Nếu có kênh đến hạn lúc nowMs: backend đọc các kênh đó vào out (kênh khác
+        // giữ giá trị lần trước), cập nhật chu kỳ rồi trả về true
+        bool poll(uint32_t nowMs, SensorBackend& backend, SensorSample& out);
+
+        const SensorSample& last() const { return previous; }
+
+    private:
+        AdaptiveInterval schedules[SENSOR_CHANNEL_COUNT];
+        SensorSample previous;
+};
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef SENSOR_SIM_H
+#define SENSOR_SIM_H
+
+// Backend không cần phần cứng:
+// - SimulatedSensorBackend: thời tiết tất định theo seed (ngày/đêm, mây, cơn mưa) và
+//   độ ẩm đất khô dần theo nhiệt/nắng, ướt lên khi mưa hoặc bơm chạy
+// - TraceReplayBackend: phát lại trace đã ghi (CSV hoặc nhị phân) theo halMillis(),
+//   tốc độ phát do đồng hồ giả quyết định
+// SensorTraceWriter ghi trace cùng định dạng. Dùng stdio nên chạy trên host (và trên
+// ESP32 với đường dẫn VFS). Không phụ thuộc Arduino.
+
+#include <stdio.h>
+#include "sensor_hal.h"
+
+#define SENSOR_SIM_DAY_MS 86400000ul
+#define SENSOR_TRACE_MAGIC 0x31525453u  // "STR1", đầu file trace nhị phân
+
+// Một dòng trace. CSV: time_ms,temperature,humidity,soil,light,rain[,rain_next_1h]
+// với thời gian tương đối từ dòng đầu; dòng không bắt đầu bằng số bị bỏ qua (log
+// khác lẫn trong serial). Nhị phân: SENSOR_TRACE_MAGIC rồi các bản ghi này
+struct SensorTraceRecord {
+    uint32_t timeMs;
+    float temperature;          // NaN nếu DHT11 lỗi
+    float humidity;
+    int16_t soilMoisture;       // -1 nếu lỗi
+    uint8_t rain;
+    uint8_t hasForecast;
+    float lightLevel;           // âm nếu BH1750 lỗi
+    float rainNext1h;           // mm, chỉ dùng khi hasForecast
+};
+
+class SimulatedSensorBackend : public SensorBackend {
+    public:
+        explicit SimulatedSensorBackend(uint32_t seed = 1);
+
+        const char* name() const override { return "simulated"; }
+        bool begin() override;
+        void read(SensorSample& sample, uint8_t due) override;
+        bool forecast(uint32_t nowMs, float& rainNext1h) override;
+        void actuate(uint32_t nowMs, bool pump, bool canopy) override;
+
+        // Lượng mưa (mm/giờ) tại thời điểm t, 0 nếu không mưa
+        float rainRate(uint32_t nowMs) const;
+
+    private:
+        void advanceSoil(uint32_t nowMs);
+        float temperatureAt(uint32_t nowMs) const;
+        float clearSkyLux(uint32_t nowMs) const;
+        float noise(uint32_t key, uint32_t salt) const;
+
+        uint32_t seed;
+        float soil;             // thang 0-1023, lớn = ướt
+        uint32_t soilMs;
+        bool pumpOn;
+        bool started;
+};
+
+class TraceReplayBackend : public SensorBackend {
+    public:
+        TraceReplayBackend();
+        ~TraceReplayBackend();
+
+        bool open(const char* path);
+        const char* name() const override { return "replay"; }
+        bool begin() override;
+        void read(SensorSample& sample, uint8_t due) override;
+        bool forecast(uint32_t nowMs, float& rainNext1h) override;
+
+        // Đã phát tới bản ghi cuối
+        bool finished() const { return !hasPending; }
+        uint32_t records() const { return count; }
+
+    private:
+        void seek(uint32_t nowMs);
+        bool next(SensorTraceRecord& record);
+
+        FILE* file;
+        bool binary;
+        uint32_t count;
+        uint32_t originMs;      // thời gian của bản ghi đầu
+        SensorTraceRecord current;
+        SensorTraceRecord pending;
+        bool hasPending;
+};
+
+class SensorTraceWriter {
+    public:
+        SensorTraceWriter();
+        ~SensorTraceWriter();
+
+        // Đuôi .bin thì ghi nhị phân, còn lại CSV
+        bool open(const char* path);
+        void write(const SensorSample& sample, bool hasForecast, float rainNext1h);
+        void close();
+
+    private:
+        FILE* file;
+        bool binary;
+};
+
+void sensorTraceRecord(const SensorSample& sample, bool hasForecast, float rainNext1h, SensorTraceRecord& out);
+// Một dòng CSV (không xuống dòng) vào buf, trả về độ dài như snprintf. Float in đủ
+// chữ số để phát lại cho đúng bit như lúc ghi
+int sensorTraceCsv(const SensorTraceRecord& record, char* buf, size_t size);
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef SENSOR_SUMMARY_H
+#define SENSOR_SUMMARY_H
+
+// Thống kê chạy cho mỗi cảm biến giữa hai lần upload: mỗi mẫu O(1), bộ nhớ cố định.
+// Phương sai theo Welford nên không mất chính xác khi cộng nhiều mẫu float gần nhau.
+// Không phụ thuộc Arduino.
+
+#include <stdint.h>
+#include "sensor_hal.h"
+
+class RunningStats {
+    public:
+        RunningStats();
+
+        // NaN (cảm biến lỗi) chỉ được đếm vào errors
+        void add(uint32_t timeMs, float value);
+        void reset();
+
+        uint32_t count() const { return n; }
+        uint32_t errors() const { return invalid; }
+        // NaN khi chưa có mẫu (variance cần ít nhất 2)
+        float mean() const;
+        float variance() const;         // phương sai mẫu (chia n - 1)
+        float stddev() const;
+        float min() const;
+        float max() const;
+        float last() const;
+        // Thời điểm giá trị đổi lần cuối (mẫu đầu tiên cũng tính là đổi)
+        uint32_t lastChangeMs() const { return changeMs; }
+
+    private:
+        uint32_t n;
+        uint32_t invalid;
+        float average;
+        float m2;               // tổng bình phương độ lệch so với trung bình
+        float lo, hi;
+        float latest;
+        uint32_t changeMs;
+};
+
+enum SummaryChannel {
+    SUMMARY_TEMPERATURE,
+    SUMMARY_HUMIDITY,
+    SUMMARY_SOIL,
+    SUMMARY_LIGHT,
+    SUMMARY_RAIN,               // 0/1 mỗi mẫu; tỉ lệ thời gian mưa là rainFraction()
+    SUMMARY_CHANNEL_COUNT
+};
+
+class SensorSummary {
+    public:
+        SensorSummary();
+
+        // Chỉ các kênh vừa đọc (sample.fresh) được cộng, giá trị giữ lại thì không
+        void add(const SensorSample& sample);
+        // Bắt đầu cửa sổ mới từ startMs
+        void reset(uint32_t startMs);
+
+        const RunningStats& channel(int index) const { return stats[index]; }
+        uint32_t startMs() const { return windowStartMs; }
+        // Tỉ lệ thời gian mưa trong cửa sổ: mỗi mẫu nặng bằng thời gian từ mẫu trước
+        // (lấy mẫu thích nghi nên các mẫu cách nhau không đều, trung bình theo mẫu
+        // của kênh SUMMARY_RAIN lệch về lúc lấy mẫu dày). NaN khi chưa có mẫu
+        float rainFraction() const;
+
+    private:
+        RunningStats stats[SUMMARY_CHANNEL_COUNT];
+        uint32_t windowStartMs;
+        uint32_t rainSinceMs;   // thời điểm mẫu trước (hoặc đầu cửa sổ)
+        uint32_t rainWetMs;
+        uint32_t rainSpanMs;
+};
+
+const char* summaryChannelName(int index);
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef SOIL_SAMPLER_H
+#define SOIL_SAMPLER_H
+
+// Lấy mẫu độ ẩm đất liên tục bằng ADC1 + DMA. Task lọc chờ DMA đầy từng khung,
+// đưa mẫu qua RobustAdcFilter và đường cong hiệu chuẩn rồi công bố kết quả mới
+// nhất; nơi đọc (task cảm biến) chỉ sao chép kết quả, không tốn thời gian ADC.
+//
+// MODEL_ZONE_COUNT > 1: SOIL_PIN là đầu ra chung của các mux, task lọc quét lần lượt
+// các vùng (ZoneScanner) và đổi kênh mux giữa hai khung DMA. Kết quả từng vùng đi
+// qua ring tới loop; vùng 0 đồng thời là readSoilFiltered như một đầu dò.
+
+#include "config.h"
+#include "zone_scanner.h"
+
+struct SoilReading {
+    float raw;          // raw đã lọc và hiệu chuẩn (0-4095)
+    float noise;        // độ lệch chuẩn ước lượng của một mẫu, cùng thang
+    uint32_t blocks;    // số khối đã lọc từ lúc khởi động
+};
+
+// Khởi động ADC DMA và task lọc. false nếu driver lỗi, khi đó gọi analogRead như cũ
+bool startSoilSampler();
+bool soilSamplerRunning();
+
+// Kết quả lọc mới nhất; false nếu chưa có khối nào
+bool readSoilFiltered(SoilReading& out);
+
+// Số mẫu DMA đã xử lý và số lần bộ đệm DMA tràn (task lọc không theo kịp)
+uint32_t soilSamplerSamples();
+uint32_t soilSamplerOverflows();
+
+struct ZoneScanStats {
+    uint32_t visits;            // số khối vùng đã đo
+    uint32_t passes;            // số lượt quét đủ mọi vùng
+    uint32_t lastPassUs;        // thời gian ADC của lượt gần nhất
+    uint32_t maxPassUs;
+};
+
+// Kết quả từng vùng theo thứ tự quét (đã hiệu chuẩn, thang 0-4095); false khi hết
+// hoặc chỉ có một vùng. Chỉ loop gọi
+bool popZoneReading(ZoneReading& reading);
+// Bit z: đo vùng z xen giữa các vùng khác (van đang mở)
+void setZoneScanPriority(uint64_t zones);
+bool readZoneScanStats(ZoneScanStats& out);
+uint32_t zoneReadingsDropped();     // kết quả bị bỏ vì loop không lấy kịp
+
+#endif
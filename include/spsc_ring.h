@@ -0,0 +1,91 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+// Trao đổi dữ liệu giữa task không khóa (không mutex, không tắt ngắt). Không phụ
+// thuộc Arduino.
+//
+// SpscRing: hàng đợi vòng một producer / một consumer: producer (task cảm biến)
+// chỉ ghi tail, consumer (loop) chỉ ghi head. Đầy thì push bỏ mẫu mới và đếm vào
+// dropped().
+//
+// LatestValue: giá trị mới nhất từ một writer (seqlock): writer không bao giờ chờ,
+// reader đọc lại nếu writer ghi chen giữa.
+
+#include <stdint.h>
+#include <atomic>
+
+template <typename T, uint16_t N>
+class SpscRing {
+        static_assert(N > 0 && (N & (N - 1)) == 0, "kích thước ring phải là lũy thừa của 2");
+
+    public:
+        // Chỉ gọi từ producer
+        bool push(const T& item) {
+            uint32_t t = tail.load(std::memory_order_relaxed);
+            if (t - head.load(std::memory_order_acquire) == N) {
+                drops.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            items[t & (N - 1)] = item;
+            // release: consumer thấy tail mới thì cũng thấy item đã ghi xong
+            tail.store(t + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Chỉ gọi từ consumer
+        bool pop(T& item) {
+            uint32_t h = head.load(std::memory_order_relaxed);
+            if (h == tail.load(std::memory_order_acquire)) {
+                return false;
+            }
+            item = items[h & (N - 1)];
+            // release: producer thấy head mới thì ô cũ đã đọc xong, ghi đè được
+            head.store(h + 1, std::memory_order_release);
+            return true;
+        }
+
+        uint16_t size() const {
+            // Đọc head trước: tail chỉ tăng nên hiệu không bao giờ âm
+            uint32_t h = head.load(std::memory_order_acquire);
+            return (uint16_t)(tail.load(std::memory_order_acquire) - h);
+        }
+        uint32_t dropped() const { return drops.load(std::memory_order_relaxed); }
+
+    private:
+        T items[N];
+        std::atomic<uint32_t> head{0};
+        std::atomic<uint32_t> tail{0};
+        std::atomic<uint32_t> drops{0};
+};
+
+template <typename T>
+class LatestValue {
+    public:
+        // Chỉ một writer
+        void store(const T& item) {
+            uint32_t s = sequence.load(std::memory_order_relaxed);
+            sequence.store(s + 1, std::memory_order_relaxed);   // lẻ: đang ghi
+            std::atomic_thread_fence(std::memory_order_release);
+            value = item;
+            sequence.store(s + 2, std::memory_order_release);
+        }
+
+        // false nếu chưa có giá trị nào
+        bool load(T& item) const {
+            for (;;) {
+                uint32_t before = sequence.load(std::memory_order_acquire);
+                if (before & 1) continue;
+                item = value;
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (sequence.load(std::memory_order_relaxed) == before) {
+                    return before != 0;
+                }
+            }
+        }
+
+    private:
+        T value{};
+        std::atomic<uint32_t> sequence{0};
+};
+
+#endif
@@ -10,14 +10,16 @@ String getISOTimestamp();
 void checkDailyReset();
 void printSystemStatus();
 
-// EEPROM functions
+// EEPROM functions (autoMode)
 void initEEPROM();
 bool isEEPROMInitialized();
-void saveDataToEEPROM();
-void clearEEPROMData();
-uint16_t getStoredDataCount();
-void uploadStoredDataToFirebase();
 void saveAutoModeToEEPROM();
 bool loadAutoModeFromEEPROM();
 
+// Bản ghi offline trên flash (FlashLog), gọi initRecordStore sau initEEPROM
+bool initRecordStore();
+void saveDataOffline();
+uint16_t getStoredDataCount();
+void uploadStoredDataToFirebase();
+
 #endif
\ No newline at end of file
@@ -17,6 +17,7 @@ void handleCanopyCommand(const String& action, const String& chatId);
 void handleStatusCommand(const String& chatId);
 void handleHelpCommand(const String& chatId);
 void handleAutoModeCommand(const String& action, const String& chatId);
+void handleModelCommand(const String& action, const String& chatId);
 
 // Utility functions
 String getSystemStatusText();
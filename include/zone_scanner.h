@@ -0,0 +1,75 @@
+#ifndef ZONE_SCANNER_H
+#define ZONE_SCANNER_H
+
+// Lịch quét nhiều đầu dò đất sau bộ dồn kênh analog (mux) trên cùng một chân ADC.
+// Mỗi lượt chọn một vùng, bỏ ZONE_SCAN_SETTLE_SAMPLES mẫu đầu (mẫu còn trong DMA từ
+// kênh cũ và thời gian ổn định RC của mux) rồi lấy một khối ADC_FILTER_BLOCK mẫu
+// cho trung bình cắt và nhiễu của vùng đó, xong thì chuyển vùng. Vùng ưu tiên (van
+// đang mở, độ ẩm đổi nhanh) được đo xen giữa các vùng theo vòng. Không phụ thuộc
+// Arduino: chỉ nhận mẫu raw và báo kênh mux cần chọn.
+
+#include <stdint.h>
+#include "adc_filter.h"
+#include "zone_state.h"
+
+#define ZONE_SCAN_SETTLE_SAMPLES 160    // một khung DMA (128) + ổn định RC của mux
+
+struct ZoneReading {
+    uint8_t zone;
+    float raw;          // trung bình cắt của khối (0-4095, chưa hiệu chuẩn)
+    float noise;        // độ lệch chuẩn ước lượng của một mẫu (IQR / 1.349)
+};
+
+class ZoneScanner {
+    public:
+        explicit ZoneScanner(uint8_t zones, uint16_t settleSamples = ZONE_SCAN_SETTLE_SAMPLES);
+
+        // Kênh mux phải đang chọn cho các mẫu tiếp theo
+        uint8_t zone() const { return current; }
+
+        // Một mẫu raw của kênh zone(). true khi vừa xong vùng: reading nhận kết quả và
+        // zone() đã sang vùng kế tiếp, nơi gọi phải chuyển mux trước mẫu sau
+        bool add(uint16_t raw, ZoneReading& reading);
+
+        // Mẫu ADC đã lấy nhưng không đưa vào add (phần còn lại của khung sau khi đổi
+        // kênh): chỉ tính vào thời gian quét
+        void skip(uint32_t samples) { sampleTotal += samples; }
+
+        // Mẫu đã nhận không chắc thuộc kênh zone() (DMA tràn, mux vừa đổi ngoài lịch):
+        // bỏ khối đang dở và ổn định lại
+        void resettle();
+
+        // Bit z: xen vùng z giữa các vùng theo vòng. Bit ngoài số vùng bị bỏ qua
+        void setPriority(uint64_t mask);
+
+        uint8_t zones() const { return count; }
+        uint32_t samples() const { return sampleTotal; }
+        uint32_t visits() const { return visitTotal; }
+        uint32_t passes() const { return passTotal; }
+        // Số mẫu ADC của lượt quét đủ mọi vùng gần nhất / lâu nhất (0 khi chưa xong lượt)
+        uint32_t lastPassSamples() const { return passLast; }
+        uint32_t maxPassSamples() const { return passMax; }
+
+    private:
+        uint8_t nextZone();
+
+        uint8_t count;
+        uint8_t current;
+        uint8_t roundRobin;         // vùng theo vòng cuối cùng
+        uint8_t priorityPos;        // vùng ưu tiên cuối cùng
+        bool priorityTurn;
+        uint64_t priority;
+        uint64_t visited;           // các vùng đã đo trong lượt hiện tại
+        uint16_t settle;
+        uint16_t settleLeft;        // mẫu còn phải bỏ
+        uint16_t fill;
+        uint16_t block[ADC_FILTER_BLOCK];
+        uint32_t sampleTotal;
+        uint32_t visitTotal;
+        uint32_t passTotal;
+        uint32_t passStart;
+        uint32_t passLast;
+        uint32_t passMax;
+};
+
+#endif
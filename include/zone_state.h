@@ -0,0 +1,75 @@
+#ifndef ZONE_STATE_H
+#define ZONE_STATE_H
+
+// Trạng thái cảm biến và van của các vùng tưới (luống), bố cục structure-of-arrays:
+// mỗi trường là một mảng theo chỉ số vùng, trạng thái bật/tắt là bitset 64 bit.
+// Quét một trường qua mọi vùng (upload, luật tưới) đi tuần tự trên bộ nhớ liền
+// nhau và kích thước tăng tuyến tính theo N thay vì theo sizeof(SensorData).
+// Không phụ thuộc Arduino.
+
+#include <stdint.h>
+#include <math.h>
+
+#define ZONE_MAX 64                     // giới hạn của bitset uint64_t
+
+// Số đọc 12-bit đã lọc và hiệu chuẩn -> thang 0-1023 của SensorData (lớn = ướt),
+// như map(raw, 4095, 0, 0, 1023)
+inline int16_t soilMoistureFromRaw(float raw) {
+    int value = (int)((4095.0f - raw) * 1023.0f / 4095.0f);
+    return (int16_t)(value < 0 ? 0 : (value > 1023 ? 1023 : value));
+}
+inline float soilNoiseFromRaw(float noise) {
+    return noise * 1023.0f / 4095.0f;
+}
+
+template <uint8_t N>
+struct ZoneStateT {
+    static_assert(N >= 1 && N <= ZONE_MAX, "Số vùng phải trong 1..ZONE_MAX");
+
+    int16_t soilMoisture[N];            // 0-1023 như SensorData.soilMoisture, -1 = chưa đọc được
+    float soilNoise[N];                 // độ lệch chuẩn một mẫu, cùng thang; NaN khi chưa có
+    uint32_t soilReadMs[N];             // millis() của số đọc cuối
+    uint32_t valveSinceMs[N];           // millis() lần đổi trạng thái van cuối
+    uint64_t valveOpen;                 // bit z: van vùng z đang mở
+    uint64_t soilValid;                 // bit z: soilMoisture[z] có giá trị
+
+    static constexpr uint8_t count() { return N; }
+    static constexpr uint64_t allMask() { return N == 64 ? ~0ull : (1ull << N) - 1; }
+
+    void reset() {
+        for (int z = 0; z < N; z++) {
+            soilMoisture[z] = -1;
+            soilNoise[z] = NAN;
+            soilReadMs[z] = 0;
+            valveSinceMs[z] = 0;
+        }
+        valveOpen = 0;
+        soilValid = 0;
+    }
+
+    void setSoil(uint8_t zone, int16_t moisture, float noise, uint32_t nowMs) {
+        soilMoisture[zone] = moisture;
+        soilNoise[zone] = noise;
+        soilReadMs[zone] = nowMs;
+        soilValid |= 1ull << zone;
+    }
+
+    bool hasSoil(uint8_t zone) const { return (soilValid >> zone) & 1; }
+    bool valve(uint8_t zone) const { return (valveOpen >> zone) & 1; }
+
+    // true nếu trạng thái van đổi
+    bool setValve(uint8_t zone, bool open, uint32_t nowMs) {
+        if (valve(zone) == open) return false;
+        if (open) {
+            valveOpen |= 1ull << zone;
+        } else {
+            valveOpen &= ~(1ull << zone);
+        }
+        valveSinceMs[zone] = nowMs;
+        return true;
+    }
+
+    uint8_t valvesOpen() const { return (uint8_t)__builtin_popcountll(valveOpen); }
+};
+
+#endif
@@ -0,0 +1,41 @@
+#include "adaptive_sampler.h"
+#include <math.h>
+
+float adaptiveChange(float now, float last, float deadband) {
+    if (isnan(now) || isnan(last)) {
+        return INFINITY;
+    }
+    return fabsf(now - last) / deadband;
+}
+
+AdaptiveInterval::AdaptiveInterval(uint32_t minMs, uint32_t maxMs)
+    : minInterval(minMs), maxInterval(maxMs < minMs ? minMs : maxMs) {
+    reset();
+}
+
+void AdaptiveInterval::reset() {
+    interval = minInterval;
+    nextMs = 0;
+    count = 0;
+}
+
+bool AdaptiveInterval::due(uint32_t nowMs) const {
+    // Lần đầu luôn đến hạn; sau đó so sánh có dấu nên đúng cả khi millis tràn
+    return count == 0 || (int32_t)(nowMs - nextMs) >= 0;
+}
+
+void AdaptiveInterval::update(uint32_t nowMs, float change) {
+    float next;
+    if (change <= 1.0f) {
+        next = interval * ADAPTIVE_GROWTH;
+    } else if (isinf(change) || isnan(change)) {
+        next = minInterval;
+    } else {
+        next = interval / change;
+    }
+    if (next < minInterval) next = minInterval;
+    if (next > maxInterval) next = maxInterval;
+    interval = (uint32_t)next;
+    nextMs = nowMs + interval;
+    count++;
+}
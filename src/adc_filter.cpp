@@ -0,0 +1,96 @@
+#include "adc_filter.h"
+#include <math.h>
+#include <algorithm>
+
+static_assert(2 * ADC_FILTER_TRIM < ADC_FILTER_BLOCK, "ADC_FILTER_TRIM bỏ hết mẫu của khối");
+
+AdcCalibration::AdcCalibration(const AdcCalibrationPoint* points, uint8_t count) : curve(points), size(count) {
+}
+
+uint8_t AdcCalibration::segment(float raw) const {
+    uint8_t i = 0;
+    while (i + 2 < size && raw > curve[i + 1].measured) i++;
+    return i;
+}
+
+float AdcCalibration::slope(float raw) const {
+    if (size < 2) {
+        return 1.0f;
+    }
+    uint8_t i = segment(raw);
+    const AdcCalibrationPoint& a = curve[i];
+    const AdcCalibrationPoint& b = curve[i + 1];
+    return (b.actual - a.actual) / (b.measured - a.measured);
+}
+
+float AdcCalibration::apply(float raw) const {
+    if (size < 2) {
+        return raw;
+    }
+    const AdcCalibrationPoint& a = curve[segment(raw)];
+    return a.actual + (raw - a.measured) * slope(raw);
+}
+
+RobustAdcFilter::RobustAdcFilter() {
+    reset();
+}
+
+void RobustAdcFilter::reset() {
+    fill = 0;
+    meanPos = 0;
+    meanCount = 0;
+    noiseEstimate = NAN;
+    blockTotal = 0;
+}
+
+bool RobustAdcFilter::add(uint16_t raw) {
+    block[fill++] = raw;
+    if (fill < ADC_FILTER_BLOCK) {
+        return false;
+    }
+    closeBlock();
+    fill = 0;
+    return true;
+}
+
+void adcBlockStats(uint16_t* block, float& trimmedMean, float& sigma) {
+    std::sort(block, block + ADC_FILTER_BLOCK);
+    uint32_t sum = 0;
+    for (int i = ADC_FILTER_TRIM; i < ADC_FILTER_BLOCK - ADC_FILTER_TRIM; i++) {
+        sum += block[i];
+    }
+    trimmedMean = (float)sum / (ADC_FILTER_BLOCK - 2 * ADC_FILTER_TRIM);
+    // IQR của phân phối chuẩn là 1.349 sigma; không bị xung đột biến kéo lệch
+    sigma = (block[3 * ADC_FILTER_BLOCK / 4] - block[ADC_FILTER_BLOCK / 4]) / 1.349f;
+}
+
+void RobustAdcFilter::closeBlock() {
+    float sigma;
+    adcBlockStats(block, means[meanPos], sigma);
+    meanPos = (meanPos + 1) % ADC_FILTER_BLOCKS;
+    if (meanCount < ADC_FILTER_BLOCKS) meanCount++;
+
+    noiseEstimate = isnan(noiseEstimate) ? sigma : noiseEstimate + ADC_FILTER_NOISE_ALPHA * (sigma - noiseEstimate);
+    blockTotal++;
+}
+
+float RobustAdcFilter::value() const {
+    if (meanCount == 0) {
+        return NAN;
+    }
+    // Sắp chèn chỉ các mục đã có (tối đa ADC_FILTER_BLOCKS): với mảng nhỏ như vậy
+    // nhanh hơn std::sort và không đụng tới phần mảng chưa ghi
+    float sorted[ADC_FILTER_BLOCKS];
+    for (uint8_t i = 0; i < meanCount; i++) {
+        float v = means[i];
+        uint8_t j = i;
+        for (; j > 0 && sorted[j - 1] > v; j--) {
+            sorted[j] = sorted[j - 1];
+        }
+        sorted[j] = v;
+    }
+    if (meanCount % 2) {
+        return sorted[meanCount / 2];
+    }
+    return (sorted[meanCount / 2 - 1] + sorted[meanCount / 2]) / 2;
+}
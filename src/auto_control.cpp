@@ -2,11 +2,33 @@
 #include "auto_control.h"
 #include "firebase_handler.h"
 #include "system_handler.h"
-#include "model_final.h"
+#include "model_handler.h"
+#include "control_rules.h"
+#include "sensor_handler.h"
+
+// Chuỗi 74HC595: bit z = van vùng z (vùng 0 theo bơm). Bit của vùng cuối đẩy vào
+// trước để tới thanh ghi cuối chuỗi
+static void writeValves() {
+#if MODEL_ZONE_COUNT > 1
+    digitalWrite(ZONE_VALVE_LATCH_PIN, LOW);
+    for (int z = (MODEL_ZONE_COUNT + 7) / 8 * 8 - 1; z >= 0; z--) {
+        digitalWrite(ZONE_VALVE_DATA_PIN, zoneState.valve(z) ? HIGH : LOW);
+        digitalWrite(ZONE_VALVE_CLOCK_PIN, HIGH);
+        digitalWrite(ZONE_VALVE_CLOCK_PIN, LOW);
+    }
+    digitalWrite(ZONE_VALVE_LATCH_PIN, HIGH);
+#endif
+}
 
 void setupAutoControl() {
     Serial.println("Khởi tạo hệ thống tự động...");
     controlData.initialized = true;
+#if MODEL_ZONE_COUNT > 1
+    pinMode(ZONE_VALVE_DATA_PIN, OUTPUT);
+    pinMode(ZONE_VALVE_CLOCK_PIN, OUTPUT);
+    pinMode(ZONE_VALVE_LATCH_PIN, OUTPUT);
+    writeValves();      // mọi van đóng
+#endif
     
     // Load autoMode từ EEPROM 
     controlData.autoMode = loadAutoModeFromEEPROM();
@@ -18,6 +40,64 @@ void setupAutoControl() {
     Serial.println("=======================");
 }
 
+static ControlInputs controlInputs() {
+    ControlInputs in;
+    in.needIrrigation = modelPredict[0].needIrrigation;
+    in.sensorFault = modelPredict[0].sensorFault;
+    in.rainNext1h = weatherData.rainNext1h;
+    in.rainDetected = sensorData.rainDetected;
+    in.lightLevel = sensorData.lightLevel;
+    return in;
+}
+
+// Cảnh báo do mô hình quyết định: gửi kèm đóng góp của từng đặc trưng
+static void uploadModelAlert(const String& message) {
+    ModelExplanation explanation;
+    if (!explainIrrigation(explanation)) {
+        uploadAlerts("irrigation", message);
+        return;
+    }
+    Serial.printf("Giải thích: soil %+.3f, temp %+.3f, hum %+.3f (bias %+.3f, margin %+.3f, %u chu kỳ)\n",
+                  explanation.contributions[0], explanation.contributions[1], explanation.contributions[2],
+                  explanation.bias, explanation.margin, modelPredict[0].explainCycles);
+    uploadAlerts("irrigation", message, &explanation);
+}
+
+#if MODEL_ZONE_COUNT > 1
+// Vùng 1..N-1: cùng luật với bơm, theo quyết định mô hình của từng vùng. Một cảnh báo
+// cho cả lượt thay vì mỗi van một cảnh báo
+static void handleZoneValves() {
+    ControlInputs in = controlInputs();
+    String opened, closed;
+    for (int z = 1; z < MODEL_ZONE_COUNT; z++) {
+        in.needIrrigation = modelPredict[z].needIrrigation;
+        switch (decideIrrigation(in, zoneState.valve(z))) {
+            case IRRIGATION_START:
+                setZoneValve(z, true);
+                opened.concat(' ');
+                opened.concat(z);
+                break;
+            case IRRIGATION_STOP_MODEL:
+            case IRRIGATION_STOP_FORECAST:
+            case IRRIGATION_STOP_SENSOR:
+                setZoneValve(z, false);
+                closed.concat(' ');
+                closed.concat(z);
+                break;
+            case IRRIGATION_KEEP:
+                break;
+        }
+    }
+    if (opened.length() > 0) {
+        uploadAlerts("irrigation", "Tự động tưới: mở van vùng" + opened);
+        alertData.alertCountToday++;
+    }
+    if (closed.length() > 0) {
+        uploadAlerts("irrigation", "Đóng van vùng" + closed);
+    }
+}
+#endif
+
 void handleAutoIrrigation() {
     static unsigned long lastCheck = 0;
     if (millis() - lastCheck < AUTO_CONTROL_INTERVAL) return;
@@ -26,50 +106,38 @@ void handleAutoIrrigation() {
     if (!controlData.autoMode) return;
     
     // Luồng hoạt động mới theo yêu cầu:
-    // ESP32 nhận kết quả từ mô hình → modelPredict.needIrrigation (true/false)
-    
-    // Nếu modelPredict.needIrrigation = false → không tưới
-    if (!modelPredict.needIrrigation) {
-        if (controlData.pumpState) {
-            setPumpState(false);
-            uploadAlerts("irrigation", "Bơm tắt - Mô hình không khuyến nghị tưới");
-        }
-        return;
-    }
-    
-    // Nếu modelPredict.needIrrigation = true → kiểm tra dự báo mưa 1 giờ tới
-    // Quy tắc quyết định:
-    // - Không tưới: rainNext1h > 0 mm (mưa nhỏ, vừa, to)
+    // ESP32 nhận kết quả từ mô hình → modelPredict[0].needIrrigation (true/false),
+    // bơm theo vùng 0. Luật ở control_rules.cpp:
+    // - Không tưới: mô hình không khuyến nghị, hoặc rainNext1h > 0 mm (mưa nhỏ, vừa, to)
     // - Tưới: rainNext1h == 0 mm và cảm biến mưa hiện tại rainDetected == true
-    
-    bool shouldIrrigate = false;
-    String reason = "";
-    
-    if (weatherData.rainNext1h > 0.0) {
-        // Có mưa dự báo trong 1 giờ tới - không tưới
-        if (controlData.pumpState) {
+    switch (decideIrrigation(controlInputs(), controlData.pumpState)) {
+        case IRRIGATION_STOP_MODEL:
+            setPumpState(false);
+            uploadModelAlert("Bơm tắt - Mô hình không khuyến nghị tưới");
+            break;
+        case IRRIGATION_STOP_FORECAST: {
             setPumpState(false);
             String message = "Bơm tắt - Dự báo mưa ";
             message.concat(weatherData.rainNext1h);
             message.concat("mm trong 1h");
             uploadAlerts("irrigation", message);
+            break;
         }
-        shouldIrrigate = false;
-    } else if (weatherData.rainNext1h == 0.0 && sensorData.rainDetected) {
-        // Không mưa dự báo và không mưa hiện tại - có thể tưới
-        shouldIrrigate = true;
-        reason = "Mô hình khuyến nghị tưới - Không mưa";
-    }
-    
-    // Thực hiện tưới nếu điều kiện cho phép
-    if (shouldIrrigate && !controlData.pumpState) {
-        setPumpState(true);
-        String message = "Tự động tưới: ";
-        message.concat(reason);
-        uploadAlerts("irrigation", message);
-        alertData.alertCountToday++;
+        case IRRIGATION_STOP_SENSOR:
+            setPumpState(false);
+            uploadAlerts("irrigation", "Bơm tắt - Cảm biến lỗi, không có quyết định của mô hình");
+            break;
+        case IRRIGATION_START:
+            setPumpState(true);
+            uploadModelAlert("Tự động tưới: Mô hình khuyến nghị tưới - Không mưa");
+            alertData.alertCountToday++;
+            break;
+        case IRRIGATION_KEEP:
+            break;
     }
-    
+#if MODEL_ZONE_COUNT > 1
+    handleZoneValves();
+#endif
 }
 
 void checkAutoTurnOff() {
@@ -81,6 +149,18 @@ void checkAutoTurnOff() {
         uploadAlerts("irrigation", "Bơm tắt sau 5 phút");
     }
     
+#if MODEL_ZONE_COUNT > 1
+    for (int z = 1; z < MODEL_ZONE_COUNT; z++) {
+        if (zoneState.valve(z) && millis() - zoneState.valveSinceMs[z] > PUMP_INTERVAL) {
+            setZoneValve(z, false);
+            String message = "Van vùng ";
+            message.concat(z);
+            message.concat(" đóng sau 5 phút");
+            uploadAlerts("irrigation", message);
+        }
+    }
+#endif
+
     // Mái che được điều khiển bởi handleAutoCanopy() dựa trên điều kiện thời tiết
     // Không tự động tắt theo thời gian
 }
@@ -92,40 +172,29 @@ void handleAutoCanopy() {
     
     if (!controlData.autoMode) return;
     
+    updateCanopy();
+}
+
+void updateCanopy() {
     // Luồng hoạt động mới theo yêu cầu:
     // Kiểm tra ánh sáng (BH1750) và dự báo mưa
-    
-    bool shouldCloseCanopy = false;
-    String reason = "";
-    
-    // Điều kiện 1: Ánh sáng mạnh (nắng gắt)
-    if (sensorData.lightLevel > LUX_HIGH_THRESHOLD) {
-        shouldCloseCanopy = true;
-        reason = "Ánh sáng mạnh (";
-        reason.concat(sensorData.lightLevel);
-        reason.concat(" lux)");
-    }
-    
-    // Điều kiện 2: Dựa vào mưa hiện tại và mưa 1 giờ tới
-    // Bật mái che (đóng): Hiện tại mưa to và rainNext1h ≥ 5 mm (mưa vừa → to)
-    // Mở mái che: Hiện tại và rainNext1h < 5 mm và không mưa hiện tại
-    
-    if (sensorData.rainDetected && weatherData.rainNext1h >= 5.0) {
-        // Hiện tại mưa và dự báo mưa vừa đến to trong 1h tới
-        shouldCloseCanopy = true;
-        reason = "Mưa hiện tại + dự báo mưa ";
-        reason.concat(weatherData.rainNext1h);
-        reason.concat("mm trong 1h");
-    } else if (sensorData.rainDetected && weatherData.rainNext1h < 5.0) {
-        // Không mưa hiện tại và dự báo mưa nhẹ trong 1h tới
-        shouldCloseCanopy = false;
-    }
+    // Bật mái che (đóng): ánh sáng mạnh, hoặc hiện tại mưa và rainNext1h ≥ 5 mm (mưa vừa → to)
+    CanopyDecision decision = decideCanopy(controlInputs(), LUX_HIGH_THRESHOLD);
+    bool shouldCloseCanopy = decision != CANOPY_OPEN;
     
     // Thực hiện điều khiển mái che
     if (shouldCloseCanopy && !controlData.canopyState) {
         setCanopyState(true);
         String message = "Mái che bật: ";
-        message.concat(reason);
+        if (decision == CANOPY_CLOSE_RAIN) {
+            message.concat("Mưa hiện tại + dự báo mưa ");
+            message.concat(weatherData.rainNext1h);
+            message.concat("mm trong 1h");
+        } else {
+            message.concat("Ánh sáng mạnh (");
+            message.concat(sensorData.lightLevel);
+            message.concat(" lux)");
+        }
         uploadAlerts("canopy", message);
         alertData.alertCountToday++;
     } else if (!shouldCloseCanopy && controlData.canopyState) {
@@ -188,7 +257,10 @@ void setPumpState(bool state) {
     if (state != controlData.pumpState) {
         digitalWrite(PUMP_PIN, state ? PUMP_ON : PUMP_OFF);
         controlData.pumpState = state;
+        sensorActuate(controlData.pumpState, controlData.canopyState);
         controlData.lastPumpOn = millis();
+        zoneState.setValve(0, state, controlData.lastPumpOn);
+        writeValves();
         Serial.printf("Bơm: %s\n", state ? "ON" : "OFF");
         
         if (firebaseConnected) {
@@ -197,10 +269,17 @@ void setPumpState(bool state) {
     }
 }
 
+void setZoneValve(uint8_t zone, bool open) {
+    if (zone >= MODEL_ZONE_COUNT || !zoneState.setValve(zone, open, millis())) return;
+    writeValves();
+    Serial.printf("Van vùng %u: %s\n", zone, open ? "ON" : "OFF");
+}
+
 void setCanopyState(bool state) {
     if (state != controlData.canopyState) {
         digitalWrite(CANOPY_PIN, state ? CANOPY_ON : CANOPY_OFF);
         controlData.canopyState = state;
+        sensorActuate(controlData.pumpState, controlData.canopyState);
         controlData.lastCanopyOn = millis();
         Serial.printf("Mái che: %s\n", state ? "ON" : "OFF");
         
@@ -0,0 +1,27 @@
+#include "control_rules.h"
+
+IrrigationAction decideIrrigation(const ControlInputs& in, bool pumpOn) {
+    // Không biết độ ẩm đất thì không tưới tiếp theo quyết định cũ
+    if (in.sensorFault) {
+        return pumpOn ? IRRIGATION_STOP_SENSOR : IRRIGATION_KEEP;
+    }
+    if (!in.needIrrigation) {
+        return pumpOn ? IRRIGATION_STOP_MODEL : IRRIGATION_KEEP;
+    }
+    // Mô hình khuyến nghị tưới: không tưới nếu dự báo có mưa trong 1 giờ tới
+    if (in.rainNext1h > 0.0f) {
+        return pumpOn ? IRRIGATION_STOP_FORECAST : IRRIGATION_KEEP;
+    }
+    if (in.rainNext1h == 0.0f && in.rainDetected && !pumpOn) {
+        return IRRIGATION_START;
+    }
+    return IRRIGATION_KEEP;
+}
+
+CanopyDecision decideCanopy(const ControlInputs& in, float luxHigh) {
+    // Đang mưa thì chỉ dự báo quyết định: mưa nhẹ thì mở kể cả khi ánh sáng mạnh
+    if (in.rainDetected) {
+        return in.rainNext1h >= CANOPY_RAIN_CLOSE_MM ? CANOPY_CLOSE_RAIN : CANOPY_OPEN;
+    }
+    return in.lightLevel > luxHigh ? CANOPY_CLOSE_LIGHT : CANOPY_OPEN;
+}
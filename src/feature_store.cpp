@@ -0,0 +1,298 @@
+#include "feature_store.h"
+#include <math.h>
+#include <string.h>
+
+static_assert(sizeof(FeatureStore) <= FEATURE_STORE_MAX_BYTES, "FeatureStore vượt FEATURE_STORE_MAX_BYTES");
+static_assert(FEATURE_RAIN_SLOTS <= UINT16_MAX, "vị trí bit mưa là uint16_t");
+
+static const char* const FEATURE_NAMES[] = FEATURE_LAYOUT_NAMES;
+static_assert(sizeof(FEATURE_NAMES) / sizeof(FEATURE_NAMES[0]) == FEATURE_COUNT,
+              "FEATURE_LAYOUT_NAMES phải khớp FeatureIndex");
+
+const char* featureName(int index) {
+    return index >= 0 && index < FEATURE_COUNT ? FEATURE_NAMES[index] : "?";
+}
+
+static double hoursBetween(uint32_t from, uint32_t to) {
+    // Hiệu unsigned nên đúng cả khi millis tràn
+    return (double)(to - from) / 3600000.0;
+}
+
+template <uint16_t N>
+RollingWindow<N>::RollingWindow(uint32_t spanMs) : span(spanMs) {
+    reset();
+}
+
+template <uint16_t N>
+void RollingWindow<N>::reset() {
+    head = 0;
+    size = 0;
+    minHead = minSize = 0;
+    maxHead = maxSize = 0;
+    origin = 0;
+    evictions = 0;
+    sumT = sumV = sumTT = sumTV = 0;
+}
+
+template <uint16_t N>
+void RollingWindow<N>::add(uint32_t timeMs, float value) {
+    if (size == N) {
+        evictOldest();  // ring đầy: bỏ mẫu cũ nhất dù chưa hết hạn
+    }
+    if (size == 0) {
+        origin = timeMs;
+    }
+    uint16_t slot = (head + size) % N;
+    times[slot] = timeMs;
+    values[slot] = value;
+    size++;
+
+    // Mẫu mới làm các mẫu cũ lớn hơn (nhỏ hơn) không bao giờ là min (max) nữa
+    while (minSize > 0 && values[minQueue[(minHead + minSize - 1) % N]] >= value) minSize--;
+    minQueue[(minHead + minSize) % N] = slot;
+    minSize++;
+    while (maxSize > 0 && values[maxQueue[(maxHead + maxSize - 1) % N]] <= value) maxSize--;
+    maxQueue[(maxHead + maxSize) % N] = slot;
+    maxSize++;
+
+    double t = hoursBetween(origin, timeMs);
+    sumT += t;
+    sumV += value;
+    sumTT += t * t;
+    sumTV += t * value;
+
+    expire(timeMs);
+}
+
+template <uint16_t N>
+void RollingWindow<N>::expire(uint32_t nowMs) {
+    while (size > 0 && nowMs - times[head] >= span) {
+        evictOldest();
+    }
+}
+
+template <uint16_t N>
+void RollingWindow<N>::evictOldest() {
+    uint16_t slot = head;
+    if (minSize > 0 && minQueue[minHead] == slot) {
+        minHead = (minHead + 1) % N;
+        minSize--;
+    }
+    if (maxSize > 0 && maxQueue[maxHead] == slot) {
+        maxHead = (maxHead + 1) % N;
+        maxSize--;
+    }
+    head = (head + 1) % N;
+    size--;
+
+    if (size == 0) {
+        reset();
+        return;
+    }
+    if (++evictions >= N) {
+        recompute();
+        return;
+    }
+    double t = hoursBetween(origin, times[slot]);
+    float value = values[slot];
+    sumT -= t;
+    sumV -= value;
+    sumTT -= t * t;
+    sumTV -= t * value;
+}
+
+template <uint16_t N>
+void RollingWindow<N>::recompute() {
+    origin = times[head];
+    evictions = 0;
+    sumT = sumV = sumTT = sumTV = 0;
+    for (uint16_t i = 0; i < size; i++) {
+        uint16_t slot = (head + i) % N;
+        double t = hoursBetween(origin, times[slot]);
+        sumT += t;
+        sumV += values[slot];
+        sumTT += t * t;
+        sumTV += t * values[slot];
+    }
+}
+
+template <uint16_t N>
+float RollingWindow<N>::mean() const {
+    return size > 0 ? (float)(sumV / size) : NAN;
+}
+
+template <uint16_t N>
+float RollingWindow<N>::min() const {
+    return minSize > 0 ? values[minQueue[minHead]] : NAN;
+}
+
+template <uint16_t N>
+float RollingWindow<N>::max() const {
+    return maxSize > 0 ? values[maxQueue[maxHead]] : NAN;
+}
+
+template <uint16_t N>
+float RollingWindow<N>::slopePerHour() const {
+    if (size < 2) {
+        return NAN;
+    }
+    double n = size;
+    double denominator = n * sumTT - sumT * sumT;
+    // Mọi mẫu cùng thời điểm (hoặc gần như vậy): không xác định được độ dốc
+    if (denominator <= 1e-9 * n * n) {
+        return NAN;
+    }
+    return (float)((n * sumTV - sumT * sumV) / denominator);
+}
+
+template class RollingWindow<FEATURE_WINDOW_SLOTS>;
+
+RainHistory::RainHistory() {
+    reset();
+}
+
+void RainHistory::reset() {
+    memset(bits, 0, sizeof(bits));
+    minute = 0;
+    pos = 0;
+    wet = 0;
+    started = false;
+}
+
+void RainHistory::update(uint32_t nowMs, bool raining) {
+    uint32_t now = nowMs / FEATURE_SLOT_MS;
+    if (!started) {
+        started = true;
+        minute = now;
+    }
+    // Sang phút mới: xóa bit của các phút vừa ra khỏi cửa sổ 24 giờ. Mỗi phút chỉ
+    // xóa một lần nên vẫn O(1) khấu hao; mất điện lâu thì xóa tối đa một vòng
+    uint32_t steps = now - minute;
+    if (steps > FEATURE_RAIN_SLOTS) steps = FEATURE_RAIN_SLOTS;
+    for (uint32_t i = 0; i < steps; i++) {
+        pos = (pos + 1) % FEATURE_RAIN_SLOTS;
+        uint32_t mask = 1u << (pos & 31);
+        if (bits[pos >> 5] & mask) {
+            bits[pos >> 5] &= ~mask;
+            wet--;
+        }
+    }
+    minute = now;
+
+    uint32_t mask = 1u << (pos & 31);
+    if (raining && !(bits[pos >> 5] & mask)) {
+        bits[pos >> 5] |= mask;
+        wet++;
+    }
+}
+
+FeatureStore::FeatureStore()
+    : soil(FEATURE_WINDOW_MS), temperature(FEATURE_WINDOW_MS), humidity(FEATURE_WINDOW_MS) {
+    reset();
+}
+
+void FeatureStore::reset() {
+    soil.reset();
+    temperature.reset();
+    humidity.reset();
+    rain.reset();
+    memset(pending, 0, sizeof(pending));
+    pendingMinute = 0;
+    hasPending = false;
+    memset(&latest, 0, sizeof(latest));
+    hasLatest = false;
+    lightSum = 0;
+    lightCount = 0;
+    darkSinceMs = 0;
+    sunriseMs = 0;
+    dark = false;
+    sunriseDetected = false;
+}
+
+void FeatureStore::closeMinute() {
+    uint32_t timeMs = pendingMinute * FEATURE_SLOT_MS;
+    RollingWindow<FEATURE_WINDOW_SLOTS>* windows[3] = { &soil, &temperature, &humidity };
+    for (int i = 0; i < 3; i++) {
+        if (pending[i].count > 0) {
+            windows[i]->add(timeMs, pending[i].sum / pending[i].count);
+        }
+    }
+    hasPending = false;
+}
+
+void FeatureStore::add(uint32_t nowMs, const FeatureSample& sample) {
+    if (!hasLatest) {
+        sunriseMs = nowMs;  // chưa thấy mặt trời mọc: tính ánh sáng từ lúc khởi động
+    }
+    latest = sample;
+    hasLatest = true;
+
+    uint32_t minute = nowMs / FEATURE_SLOT_MS;
+    if (hasPending && minute != pendingMinute) {
+        closeMinute();
+    }
+    if (!hasPending) {
+        memset(pending, 0, sizeof(pending));
+        pendingMinute = minute;
+        hasPending = true;
+    }
+    const float values[3] = { sample.soil, sample.temperature, sample.humidity };
+    for (int i = 0; i < 3; i++) {
+        if (!isnan(values[i])) {
+            pending[i].sum += values[i];
+            pending[i].count++;
+        }
+    }
+    soil.expire(nowMs);
+    temperature.expire(nowMs);
+    humidity.expire(nowMs);
+
+    rain.update(nowMs, sample.raining);
+
+    if (sample.light >= 0) {
+        if (sample.light < FEATURE_SUNRISE_LUX) {
+            if (!dark) {
+                dark = true;
+                darkSinceMs = nowMs;
+            }
+        } else {
+            // Mây che vài phút không tính: phải tối đủ FEATURE_NIGHT_MS mới là đêm
+            if (dark && nowMs - darkSinceMs >= FEATURE_NIGHT_MS) {
+                lightSum = 0;
+                lightCount = 0;
+                sunriseMs = nowMs;
+                sunriseDetected = true;
+            }
+            dark = false;
+        }
+        lightSum += sample.light;
+        lightCount++;
+    }
+}
+
+int FeatureStore::vector(float* out) const {
+    for (int i = 0; i < FEATURE_COUNT; i++) {
+        out[i] = NAN;
+    }
+    if (!hasLatest) {
+        return 0;
+    }
+    out[FEATURE_SOIL] = latest.soil;
+    out[FEATURE_TEMPERATURE] = latest.temperature;
+    out[FEATURE_HUMIDITY] = latest.humidity;
+    out[FEATURE_SOIL_SLOPE_1H] = soil.slopePerHour();
+    out[FEATURE_SOIL_RANGE_1H] = soil.max() - soil.min();
+    out[FEATURE_TEMPERATURE_MEAN_1H] = temperature.mean();
+    out[FEATURE_TEMPERATURE_MAX_1H] = temperature.max();
+    out[FEATURE_HUMIDITY_MIN_1H] = humidity.min();
+    if (lightCount > 0) {
+        out[FEATURE_LIGHT_MEAN_SINCE_SUNRISE] = (float)(lightSum / lightCount);
+    }
+    out[FEATURE_RAIN_MINUTES_24H] = rain.wetMinutes();
+
+    int valid = 0;
+    for (int i = 0; i < FEATURE_COUNT; i++) {
+        if (!isnan(out[i])) valid++;
+    }
+    return valid;
+}
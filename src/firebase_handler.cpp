@@ -2,6 +2,8 @@
 #include "firebase_handler.h"
 #include "system_handler.h"
 #include "auto_control.h"
+#include "model_handler.h"
+#include "sensor_handler.h"
 
 void setupFirebase(){
     Serial.println("Cấu hình Firebase...");
@@ -35,8 +37,8 @@ void uploadSensorData() {
     }
 
     if (!firebaseConnected) {
-        Serial.println("Firebase không kết nối. Lưu vào EEPROM.");
-        saveDataToEEPROM();
+        Serial.println("Firebase không kết nối. Lưu vào flash.");
+        saveDataOffline();
         return;
     }
 
@@ -46,6 +48,9 @@ void uploadSensorData() {
     jsonPayload.set("temperature", sensorData.temperature);
     jsonPayload.set("humidity", sensorData.humidity);
     jsonPayload.set("soil_moisture", sensorData.soilMoisture);
+    if (!isnan(sensorData.soilNoise)) {
+        jsonPayload.set("soil_noise", sensorData.soilNoise);
+    }
     jsonPayload.set("light_level", sensorData.lightLevel);
     jsonPayload.set("rain_detected", sensorData.rainDetected);
     jsonPayload.set("pump_state", controlData.pumpState);
@@ -53,6 +58,12 @@ void uploadSensorData() {
     jsonPayload.set("auto_mode", controlData.autoMode);
     jsonPayload.set("timestamp", timestamp);
 
+    // Các mẫu giữa hai lần upload, cùng một lần ghi
+    FirebaseJson summary;
+    setSensorSummaryJson(summary);
+    jsonPayload.set("summary", summary);
+    resetSensorSummary();
+
     object_t payloadObject(jsonPayload.raw());
 
     // Dữ liệu hiện tại
@@ -71,7 +82,40 @@ void uploadSensorData() {
 
     Serial.printf("Pushing new sensor record to: %s\n", historyPath.c_str());
     Database.push<object_t>(aClient, historyPath, payloadObject, processData, "Upload sensor history");
+
+#if MODEL_ZONE_COUNT > 1
+    uploadZoneData(timestamp);
+#endif
+}
+
+#if MODEL_ZONE_COUNT > 1
+void uploadZoneData(const String& timestamp) {
+    // Mỗi vùng một nút ROOT/zones/<zz> (hai chữ số để sắp theo thứ tự), mọi vùng
+    // trong một lần update: chỉ ghi đè các nút vùng, không đụng nút khác
+    FirebaseJson zonesJson;
+    uint32_t nowMs = millis();
+    for (int z = 0; z < MODEL_ZONE_COUNT; z++) {
+        FirebaseJson zone;
+        if (zoneState.hasSoil(z)) {
+            zone.set("soil_moisture", (int)zoneState.soilMoisture[z]);
+            if (!isnan(zoneState.soilNoise[z])) {
+                zone.set("soil_noise", zoneState.soilNoise[z]);
+            }
+            zone.set("age_s", (int)((nowMs - zoneState.soilReadMs[z]) / 1000));
+        }
+        zone.set("valve", zoneState.valve(z));
+        zone.set("need_irrigation", modelPredict[z].needIrrigation);
+        zone.set("model", (int)modelPredict[z].poolModel);
+        zone.set("timestamp", timestamp);
+        char key[4];
+        snprintf(key, sizeof(key), "%02d", z);
+        zonesJson.set(key, zone);
+    }
+    String path = ROOT;
+    path += "/zones";
+    Database.update<object_t>(aClient, path, object_t(zonesJson.raw()), processData, "Update zones");
 }
+#endif
 
 void uploadSystemStatus() {
     // Kiểm tra Firebase connection thực tế
@@ -87,15 +131,56 @@ void uploadSystemStatus() {
     statusJson.set("auto_mode", controlData.autoMode);
     statusJson.set("pump_state", controlData.pumpState);
     statusJson.set("canopy_state", controlData.canopyState);
+    statusJson.set("model_version", (int)modelPredict[0].modelVersion);
     
     // Trạng thái cảm biến
     FirebaseJson sensorStatus;
-    sensorStatus.set("dht11", !isnan(sensorData.temperature) ? "ok" : "error");
-    sensorStatus.set("soil_sensor", "ok");
+    const SensorFaultMonitor& faults = sensorFaults();
+    bool dhtOk = !isnan(sensorData.temperature) && faults.mask(FAULT_TEMPERATURE) == 0 &&
+                 faults.mask(FAULT_HUMIDITY) == 0;
+    sensorStatus.set("dht11", dhtOk ? "ok" : "error");
+    sensorStatus.set("soil_sensor", faults.mask(FAULT_SOIL) == 0 ? "ok" : "error");
     sensorStatus.set("rain_sensor", "ok");
-    sensorStatus.set("light_sensor", sensorData.lightLevel > 0 ? "ok" : "error");
+    sensorStatus.set("light_sensor", sensorData.lightLevel >= 0 && faults.mask(FAULT_LIGHT) == 0 ? "ok" : "error");
+
+    // Bitmask lỗi và số lần từng loại lỗi của mỗi kênh
+    FirebaseJson faultStatus;
+    setSensorFaultJson(faultStatus);
+    sensorStatus.set("faults", faultStatus);
     
     statusJson.set("sensors", sensorStatus);
+
+    // Thời gian suy luận mô hình
+    FirebaseJson modelStatus;
+    setModelProfileJson(modelStatus);
+    statusJson.set("model", modelStatus);
+
+    // Kết quả từng vùng tưới
+    FirebaseJsonArray zoneStatus;
+    for (int z = 0; z < MODEL_ZONE_COUNT; z++) {
+        FirebaseJson zone;
+        zone.set("model", (int)modelPredict[z].poolModel);
+        zone.set("need_irrigation", modelPredict[z].needIrrigation);
+        zoneStatus.add(zone);
+    }
+    statusJson.set("zones", zoneStatus);
+
+    // Feature store: bố cục và RAM cố định
+    FirebaseJson featureStatus;
+    featureStatus.set("layout_version", FEATURE_LAYOUT_VERSION);
+    featureStatus.set("ram_bytes", (int)sizeof(FeatureStore));
+    featureStatus.set("window_minutes", (int)featureStore.windowSamples());
+    statusJson.set("features", featureStatus);
+
+    // Lịch lấy mẫu của task cảm biến
+    FirebaseJson samplingStatus;
+    setSensorTimingJson(samplingStatus);
+    statusJson.set("sampling", samplingStatus);
+
+    // Mưa theo sự kiện ngắt, thời gian ướt theo giờ
+    FirebaseJson rainStatus;
+    setRainJson(rainStatus);
+    statusJson.set("rain", rainStatus);
     
     // Cập nhật trạng thái
     String path = ROOT;
@@ -103,7 +188,7 @@ void uploadSystemStatus() {
     Database.set<object_t>(aClient, path, object_t(statusJson.raw()), processData, "System status update");
 }
 
-void uploadAlerts(String alertType, String message) {
+void uploadAlerts(String alertType, String message, const ModelExplanation* explanation) {
     // Kiểm tra Firebase connection thực tế
     if (!firebaseConnected || !app.ready() || WiFi.status() != WL_CONNECTED) {
         Serial.println("Firebase không kết nối! Không thể tải cảnh báo.");
@@ -116,6 +201,20 @@ void uploadAlerts(String alertType, String message) {
     alertJson.set("timestamp", getISOTimestamp());
     alertJson.set("severity", "warning");
     alertJson.set("count_today", alertData.alertCountToday);
+    if (explanation != nullptr) {
+        // Đóng góp vào margin logit (dương: nghiêng về tưới), bias + tổng = margin
+        FirebaseJson contributions;
+        for (int f = 0; f < MODEL_FEATURE_COUNT; f++) {
+            contributions.set(featureName(f), explanation->contributions[f]);
+        }
+        FirebaseJson explainJson;
+        explainJson.set("contributions", contributions);
+        explainJson.set("bias", explanation->bias);
+        explainJson.set("margin", explanation->margin);
+        explainJson.set("prediction", explanation->prediction);
+        explainJson.set("cycles", (int)modelPredict[0].explainCycles);
+        alertJson.set("explanation", explainJson);
+    }
     
     String path = ROOT;
     path += "/alerts/current/";
@@ -202,6 +301,9 @@ void processControlCommands(AsyncResult &aResult) {
                         saveAutoModeToEEPROM();
                         Serial.printf("Auto mode: %s\n", autoMode ? "ON" : "OFF");
                     }
+                    if (json.get(data, "model_url")) {
+                        requestModelUpdate(data.to<String>());
+                    }
                 } else {
                     Serial.println("Lỗi parse JSON!");
                 }
@@ -227,6 +329,9 @@ void processControlCommands(AsyncResult &aResult) {
                     saveAutoModeToEEPROM();
                     Serial.printf("Auto mode: %s\n", autoMode ? "ON" : "OFF");
                 }
+                else if (path.indexOf("model_url") >= 0) {
+                    requestModelUpdate(dataStr);
+                }
             }
         }
     }
@@ -0,0 +1,237 @@
+#include "flash_log.h"
+#include <string.h>
+
+// CRC32 (đa thức zlib) không bảng: mỗi lần chỉ tính vài chục byte
+uint32_t flashLogCrc32(const void* data, size_t length) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= bytes[i];
+        for (int b = 0; b < 8; b++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+FlashLog::FlashLog(FlashDevice& device, uint16_t recordSize)
+    : flash(device), payloadSize(recordSize), slotSize(0), slots(0), sectors(0), ready(false), headSector(0),
+      headSequence(0), headSlot(0), tailSector(0), tailSequence(0), tailSlot(0), appendCount(0), eraseCount(0),
+      droppedCount(0), corruptCount(0), wearMax(0), reads(0), readsAtBegin(0) {}
+
+bool FlashLog::countedRead(uint32_t address, void* data, uint32_t length) {
+    reads++;
+    return flash.read(address, data, length);
+}
+
+uint32_t FlashLog::slotAddress(uint16_t sector, uint16_t slot) const {
+    return sector * flash.sectorSize() + FLASH_LOG_HEADER_BYTES + (uint32_t)slot * slotSize;
+}
+
+bool FlashLog::readHeader(uint16_t sector, Header& header) {
+    if (!countedRead(sector * flash.sectorSize(), &header, sizeof(header))) return false;
+    return header.magic == FLASH_LOG_MAGIC && header.crc == flashLogCrc32(&header, offsetof(Header, crc));
+}
+
+bool FlashLog::slotEmpty(uint16_t sector, uint16_t slot) {
+    // Cả ô phải còn 0xFF: ghi dở chỉ một phần vẫn tính là đã dùng
+    uint32_t words[(FLASH_LOG_MAX_RECORD + 8) / 4 + 1];
+    if (!countedRead(slotAddress(sector, slot), words, slotSize)) return false;
+    for (uint16_t i = 0; i < slotSize / 4; i++) {
+        if (words[i] != 0xFFFFFFFFu) return false;
+    }
+    return true;
+}
+
+bool FlashLog::slotConsumed(uint16_t sector, uint16_t slot) {
+    uint32_t mark = 0xFFFFFFFFu;
+    countedRead(slotAddress(sector, slot) + slotSize - 4, &mark, 4);
+    return mark != 0xFFFFFFFFu;
+}
+
+bool FlashLog::openSector(uint16_t sector, uint32_t sequence) {
+    Header old;
+    uint32_t wear = readHeader(sector, old) ? old.eraseCount + 1 : wearMax;
+    if (!flash.erase(sector)) return false;
+    eraseCount++;
+    if (wear > wearMax) wearMax = wear;
+
+    Header header;
+    header.magic = FLASH_LOG_MAGIC;
+    header.sequence = sequence;
+    header.eraseCount = wear;
+    header.crc = flashLogCrc32(&header, offsetof(Header, crc));
+    if (!flash.write(sector * flash.sectorSize(), &header, sizeof(header))) return false;
+    headSector = sector;
+    headSequence = sequence;
+    headSlot = 0;
+    return true;
+}
+
+bool FlashLog::begin() {
+    ready = false;
+    reads = 0;
+    sectors = flash.sectorCount();
+    slotSize = (uint16_t)(4 + ((payloadSize + 3) & ~3u) + 4);
+    slots = (uint16_t)((flash.sectorSize() - FLASH_LOG_HEADER_BYTES) / slotSize);
+    if (payloadSize == 0 || payloadSize > FLASH_LOG_MAX_RECORD || sectors < 2 || slots == 0) {
+        return false;
+    }
+
+    // Head: sector hợp lệ có số thứ tự lớn nhất
+    bool found = false;
+    wearMax = 0;
+    for (uint16_t s = 0; s < sectors; s++) {
+        Header header;
+        if (!readHeader(s, header)) continue;
+        if (header.eraseCount > wearMax) wearMax = header.eraseCount;
+        if (!found || header.sequence > headSequence) {
+            found = true;
+            headSector = s;
+            headSequence = header.sequence;
+        }
+    }
+    if (!found) {
+        // Phân vùng trống (lần đầu) hoặc không còn header nào đọc được
+        if (!openSector(0, 1)) return false;
+        tailSector = headSector;
+        tailSequence = headSequence;
+        tailSlot = 0;
+        readsAtBegin = reads;
+        ready = true;
+        return true;
+    }
+
+    // Sector cũ nhất: lùi theo vòng khi số thứ tự còn liên tiếp
+    uint16_t oldest = headSector;
+    uint32_t oldestSequence = headSequence;
+    for (uint16_t k = 1; k < sectors; k++) {
+        uint16_t s = (uint16_t)((headSector + sectors - k) % sectors);
+        Header header;
+        if (!readHeader(s, header) || header.sequence != headSequence - k) break;
+        oldest = s;
+        oldestSequence = header.sequence;
+    }
+
+    // Ô trống đầu tiên trong sector head (các ô được ghi theo thứ tự)
+    uint16_t lo = 0, hi = slots;
+    while (lo < hi) {
+        uint16_t mid = (uint16_t)((lo + hi) / 2);
+        if (slotEmpty(headSector, mid)) {
+            hi = mid;
+        } else {
+            lo = (uint16_t)(mid + 1);
+        }
+    }
+    headSlot = lo;
+
+    // Tail: sector đầu tiên mà ô cuối chưa lấy, rồi ô chưa lấy đầu tiên trong đó
+    tailSector = oldest;
+    tailSequence = oldestSequence;
+    while (tailSequence != headSequence && slotConsumed(tailSector, slots - 1)) {
+        tailSector = (uint16_t)((tailSector + 1) % sectors);
+        tailSequence++;
+    }
+    uint16_t filled = tailSequence == headSequence ? headSlot : slots;
+    lo = 0;
+    hi = filled;
+    while (lo < hi) {
+        uint16_t mid = (uint16_t)((lo + hi) / 2);
+        if (slotConsumed(tailSector, mid)) {
+            lo = (uint16_t)(mid + 1);
+        } else {
+            hi = mid;
+        }
+    }
+    tailSlot = lo;
+    normalizeTail();
+    readsAtBegin = reads;
+    ready = true;
+    return true;
+}
+
+void FlashLog::normalizeTail() {
+    // Tail ở cuối một sector đã đầy chuyển sang đầu sector kế tiếp
+    if (tailSlot >= slots && tailSequence != headSequence) {
+        tailSector = (uint16_t)((tailSector + 1) % sectors);
+        tailSequence++;
+        tailSlot = 0;
+    }
+}
+
+uint32_t FlashLog::pending() const {
+    if (!ready) return 0;
+    return (headSequence - tailSequence) * slots + headSlot - tailSlot;
+}
+
+bool FlashLog::append(const void* record) {
+    if (!ready) return false;
+    if (headSlot >= slots) {
+        uint16_t next = (uint16_t)((headSector + 1) % sectors);
+        // Tail mới tính vào biến tạm, chỉ áp dụng khi mở sector thành công: xóa hoặc
+        // ghi header lỗi thì trạng thái trong RAM vẫn khớp với flash và append sau thử lại
+        uint16_t newTailSector = tailSector;
+        uint32_t newTailSequence = tailSequence;
+        uint16_t newTailSlot = tailSlot;
+        uint32_t dropping = 0;
+        if (tailSequence + sectors - 1 == headSequence) {
+            // Log đầy: sector sắp xóa chứa tail, bỏ các bản ghi chưa lấy trong đó
+            dropping = slots - tailSlot;
+            newTailSector = (uint16_t)((next + 1) % sectors);
+            newTailSequence++;
+            newTailSlot = 0;
+        }
+        if (newTailSequence == headSequence && newTailSlot >= slots) {
+            // Đã lấy hết sector head cũ: tail sang đầu sector mới
+            newTailSector = next;
+            newTailSequence = headSequence + 1;
+            newTailSlot = 0;
+        }
+        if (!openSector(next, headSequence + 1)) return false;
+        tailSector = newTailSector;
+        tailSequence = newTailSequence;
+        tailSlot = newTailSlot;
+        droppedCount += dropping;
+    }
+
+    uint32_t slot[(FLASH_LOG_MAX_RECORD + 8) / 4 + 1];
+    memset(slot, 0, slotSize);
+    memcpy(&slot[1], record, payloadSize);
+    slot[0] = flashLogCrc32(&slot[1], payloadSize);
+    slot[slotSize / 4 - 1] = 0xFFFFFFFFu;
+    // Một lần ghi cho cả ô: mất điện giữa chừng thì crc không khớp
+    if (!flash.write(slotAddress(headSector, headSlot), slot, slotSize)) return false;
+    headSlot++;
+    appendCount++;
+    return true;
+}
+
+bool FlashLog::peek(void* record) {
+    while (pending() > 0) {
+        uint32_t slot[(FLASH_LOG_MAX_RECORD + 8) / 4 + 1];
+        if (!flash.read(slotAddress(tailSector, tailSlot), slot, slotSize)) return false;
+        bool consumed = slot[slotSize / 4 - 1] != 0xFFFFFFFFu;
+        if (!consumed && slot[0] == flashLogCrc32(&slot[1], payloadSize)) {
+            memcpy(record, &slot[1], payloadSize);
+            return true;
+        }
+        if (!consumed) {
+            // Ô ghi dở: đánh dấu đã lấy để lần khởi động sau không gặp lại
+            corruptCount++;
+            uint32_t mark = 0;
+            flash.write(slotAddress(tailSector, tailSlot) + slotSize - 4, &mark, 4);
+        }
+        tailSlot++;
+        normalizeTail();
+    }
+    return false;
+}
+
+bool FlashLog::consume() {
+    if (pending() == 0) return false;
+    uint32_t mark = 0;
+    if (!flash.write(slotAddress(tailSector, tailSlot) + slotSize - 4, &mark, 4)) return false;
+    tailSlot++;
+    normalizeTail();
+    return true;
+}
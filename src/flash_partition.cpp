@@ -0,0 +1,27 @@
+#include "flash_partition.h"
+
+PartitionFlash::PartitionFlash() : partition(nullptr) {
+}
+
+bool PartitionFlash::begin() {
+    partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)RECORD_PARTITION_SUBTYPE,
+                                         RECORD_PARTITION_LABEL);
+    return partition != nullptr;
+}
+
+uint16_t PartitionFlash::sectorCount() const {
+    return partition ? (uint16_t)(partition->size / RECORD_SECTOR_SIZE) : 0;
+}
+
+bool PartitionFlash::read(uint32_t address, void* data, uint32_t length) {
+    return partition && esp_partition_read(partition, address, data, length) == ESP_OK;
+}
+
+bool PartitionFlash::write(uint32_t address, const void* data, uint32_t length) {
+    return partition && esp_partition_write(partition, address, data, length) == ESP_OK;
+}
+
+bool PartitionFlash::erase(uint16_t sector) {
+    return partition &&
+           esp_partition_erase_range(partition, (size_t)sector * RECORD_SECTOR_SIZE, RECORD_SECTOR_SIZE) == ESP_OK;
+}
@@ -1,6 +1,7 @@
 #include "health_check.h"
 #include "config.h"
 #include "firebase_handler.h"
+#include "sensor_handler.h"
 
 void handleHealthCheck(){
     Serial.println("===== Check hệ thống =====");
@@ -31,20 +32,21 @@ void handleHealthCheck(){
         issues += "WiFi không kết nối; ";
     }
     
-    // Kiểm tra giá trị cảm biến bất thường
-    if (sensorData.temperature < -10 || sensorData.temperature > 60) {
+    // Lỗi theo kênh từ bộ phát hiện chạy mỗi mẫu (ngoài dải, kẹt, xung, phẳng, NaN)
+    const SensorFaultMonitor& faults = sensorFaults();
+    for (int c = 0; c < FAULT_CHANNEL_COUNT; c++) {
+        uint8_t mask = faults.mask(c);
+        if (mask == 0) continue;
         systemHealthy = false;
-        issues += "Temperature out of range; ";
-    }
-    
-    if (sensorData.humidity < 0 || sensorData.humidity > 100) {
-        systemHealthy = false;
-        issues += "Humidity out of range; ";
-    }
-    
-    if (sensorData.soilMoisture < 0 || sensorData.soilMoisture > 1023) {
-        systemHealthy = false;
-        issues += "Soil sensor out of range; ";
+        issues += faultChannelName(c);
+        issues += ":";
+        for (int k = 0; k < SENSOR_FAULT_KINDS; k++) {
+            if (mask & (1 << k)) {
+                issues += " ";
+                issues += sensorFaultName(k);
+            }
+        }
+        issues += "; ";
     }
     
     if (systemHealthy) {
@@ -0,0 +1,106 @@
+#include "light_sensor.h"
+
+// Tăng dần độ nhạy: lux = đếm / 1.2 * 69 / MTreg, MODE_2 chia thêm 2
+static const LightRange LIGHT_RANGES[] = {
+    { BH1750::ONE_TIME_HIGH_RES_MODE_2, 138 },  // 0.2 lux/đếm, tới ~13.6k lux
+    { BH1750::ONE_TIME_HIGH_RES_MODE, 69 },     // mặc định, tới ~54.6k lux
+    { BH1750::ONE_TIME_HIGH_RES_MODE, 31 },     // nắng gắt, tới ~121k lux
+};
+static const uint8_t LIGHT_RANGE_COUNT = sizeof(LIGHT_RANGES) / sizeof(LIGHT_RANGES[0]);
+static const uint8_t LIGHT_RANGE_DEFAULT = 1;
+
+#define LIGHT_CONVERSION_MAX_MS 180     // HIGH_RES ở MTreg 69 (datasheet), tỉ lệ với MTreg
+#define LIGHT_COUNTS_FULL 65535.0f
+
+// Số đếm trên mỗi lux của dải
+static float countsPerLux(const LightRange& range) {
+    float gain = 1.2f * range.mtreg / BH1750_DEFAULT_MTREG;
+    return range.mode == BH1750::ONE_TIME_HIGH_RES_MODE_2 ? gain * 2.0f : gain;
+}
+
+LightSensor::LightSensor(BH1750& meter)
+    : meter(meter), current(LIGHT_RANGE_DEFAULT), rangeDirty(false), startMs(0), conversionMs(0), busUs(0),
+      switches(0) {
+}
+
+bool LightSensor::begin() {
+    current = LIGHT_RANGE_DEFAULT;
+    uint32_t start = micros();
+    bool ok = meter.begin(LIGHT_RANGES[current].mode, LIGHT_I2C_ADDRESS, &Wire);
+    busUs += micros() - start;
+    rangeDirty = !ok;
+    startMs = millis();
+    conversionMs = LIGHT_CONVERSION_MAX_MS * LIGHT_RANGES[current].mtreg / BH1750_DEFAULT_MTREG + 1;
+    return ok;
+}
+
+bool LightSensor::applyRange() {
+    // Đổi dải hiếm nên dùng thư viện (kèm thời gian chờ của nó) để nó biết chế độ
+    // và MTreg khi đổi số đếm ra lux; configure() cũng bắt đầu luôn một lần đo
+    const LightRange& range = LIGHT_RANGES[current];
+    return meter.setMTreg(range.mtreg) && meter.configure(range.mode);
+}
+
+bool LightSensor::trigger() {
+    uint32_t start = micros();
+    bool ok;
+    if (rangeDirty) {
+        ok = applyRange();
+        rangeDirty = !ok;
+    } else {
+        // Cùng dải: chỉ gửi lại byte lệnh one-time, không có thời gian chờ của thư viện
+        Wire.beginTransmission(LIGHT_I2C_ADDRESS);
+        Wire.write((uint8_t)LIGHT_RANGES[current].mode);
+        ok = Wire.endTransmission() == 0;
+    }
+    busUs += micros() - start;
+    startMs = millis();
+    conversionMs = LIGHT_CONVERSION_MAX_MS * LIGHT_RANGES[current].mtreg / BH1750_DEFAULT_MTREG + 1;
+    return ok;
+}
+
+uint32_t LightSensor::remainingMs() const {
+    uint32_t elapsed = millis() - startMs;
+    return elapsed >= conversionMs ? 0 : conversionMs - elapsed;
+}
+
+float LightSensor::collect(bool& rangeRaised) {
+    rangeRaised = false;
+    uint32_t start = micros();
+    float lux = meter.readLightLevel();
+    busUs += micros() - start;
+    if (lux < 0) {
+        return lux;
+    }
+
+    // Chọn dải theo số đếm thô: gần tràn thì nâng, đủ nhỏ để dải nhạy hơn vẫn còn
+    // dư một nửa thang thì hạ
+    float counts = lux * countsPerLux(LIGHT_RANGES[current]);
+    uint8_t next = current;
+    if (counts >= LIGHT_RANGE_UP_RATIO * LIGHT_COUNTS_FULL && current + 1 < LIGHT_RANGE_COUNT) {
+        next = current + 1;
+        rangeRaised = true;
+    } else if (current > 0 && lux * countsPerLux(LIGHT_RANGES[current - 1]) < LIGHT_RANGE_DOWN_RATIO * LIGHT_COUNTS_FULL) {
+        next = current - 1;
+    }
+    if (next != current) {
+        current = next;
+        rangeDirty = true;
+        switches++;
+    }
+    return lux;
+}
+
+uint8_t LightSensor::mtreg() const {
+    return LIGHT_RANGES[current].mtreg;
+}
+
+float LightSensor::fullScaleLux() const {
+    return LIGHT_COUNTS_FULL / countsPerLux(LIGHT_RANGES[current]);
+}
+
+uint32_t LightSensor::takeBusUs() {
+    uint32_t us = busUs;
+    busUs = 0;
+    return us;
+}
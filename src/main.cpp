@@ -8,6 +8,7 @@
 #include "health_check.h"
 #include "weather_api_handler.h"
 #include "telegram_handler.h"
+#include "model_handler.h"
 
 // Global Objects
 FirebaseApp app;
@@ -29,7 +30,8 @@ SensorData sensorData;
 ControlData controlData;
 SystemState systemState;
 AlertData alertData;
-ModelPredict modelPredict;
+ModelPredict modelPredict[MODEL_ZONE_COUNT];
+ZoneState zoneState;
 WeatherData weatherData;
 
 const String TELEGRAM_CHAT_IDS[] = {
@@ -48,10 +50,15 @@ void setup(){
     
     // Initialize EEPROM
     initEEPROM();
+    // Bản ghi offline trên phân vùng flash riêng
+    initRecordStore();
 
     // Setup Watchdog
     setupWatchdog();
 
+    // Nạp mô hình từ LittleFS hoặc dùng mô hình built-in
+    setupModel();
+
     // Initialize sensors
     setupSensors();
     setupAutoControl();
@@ -66,7 +73,7 @@ void setup(){
         
         // Upload stored data when reconnected
         if (getStoredDataCount() > 0) {
-            Serial.println("Tìm thấy dữ liệu trong EEPROM, tải lên...");
+            Serial.println("Tìm thấy bản ghi offline, tải lên...");
             uploadStoredDataToFirebase();
         }
     } else {
@@ -91,6 +98,11 @@ void loop(){
     // Read all sensors
     readSensors();
 
+    // Mưa từ ngắt: mái che phản ứng ngay, không chờ chu kỳ tự động
+    if (handleRainEvents() && controlData.autoMode) {
+        updateCanopy();
+    }
+
     // Process Firebase
     app.loop();
     
@@ -103,7 +115,7 @@ void loop(){
             startControlStream();
             // Upload stored data when reconnected
             if (getStoredDataCount() > 0) {
-                Serial.println("Tìm thấy dữ liệu trong EEPROM, tải lên...");
+                Serial.println("Tìm thấy bản ghi offline, tải lên...");
                 uploadStoredDataToFirebase();
             }
         } else {
@@ -116,14 +128,14 @@ void loop(){
             sensorData.lastUpload = millis();
         }
         
-        // Check for EEPROM data to upload every 30 seconds
-        static unsigned long lastEEPROMCheck = 0;
-        if (millis() - lastEEPROMCheck >= 30000) {
+        // Check for offline records to upload every 30 seconds
+        static unsigned long lastRecordCheck = 0;
+        if (millis() - lastRecordCheck >= 30000) {
             if (getStoredDataCount() > 0) {
-                Serial.println("Tìm thấy dữ liệu trong EEPROM, tải lên...");
+                Serial.println("Tìm thấy bản ghi offline, tải lên...");
                 uploadStoredDataToFirebase();
             }
-            lastEEPROMCheck = millis();
+            lastRecordCheck = millis();
         }
 
         // Update system status every 5 minutes
@@ -138,25 +150,27 @@ void loop(){
             systemState.lastCheckHealth = millis();
         }
     } else {
-        // Firebase not connected - save to EEPROM
+        // Firebase not connected - save to flash
         if (firebaseConnected) {
             Serial.println("Firebase không kết nối!");
         }
         firebaseConnected = false;
-        static unsigned long lastSaveToEEPROM = 0;
+        static unsigned long lastSaveOffline = 0;
         static unsigned long lastDebugPrint = 0;
-        unsigned long timeSinceLastSave = millis() - lastSaveToEEPROM;
+        unsigned long timeSinceLastSave = millis() - lastSaveOffline;
         
-        if (timeSinceLastSave >= EEPROM_SAVE_INTERVAL) { 
-            Serial.println("Firebase không kết nối - lưu vào EEPROM...");
-            saveDataToEEPROM();
-            lastSaveToEEPROM = millis();
+        if (timeSinceLastSave >= RECORD_SAVE_INTERVAL) { 
+            Serial.println("Firebase không kết nối - lưu vào flash...");
+            saveDataOffline();
+            lastSaveOffline = millis();
         }
     }
 
     // Update weather data and model predictions
     updateWeatherData();
+    handleModelUpdate();
     updateModelPrediction();
+    handleModelProfile();
     
     // Auto control system
     if (controlData.autoMode) {
@@ -0,0 +1,184 @@
+#include "model_engine.h"
+#include "model_batch.h"
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#ifndef ARDUINO
+#include <thread>
+#endif
+
+#if defined(__AVX2__) || defined(__ARM_NEON)
+
+// Trên host duyệt cây kiểu QuickScorer: mỗi node split được so sánh một lần cho cả
+// khối mẫu (không rẽ nhánh, không gather). Mỗi mẫu giữ bitmask các lá còn khả dĩ;
+// node nào đi phải thì xóa các lá thuộc cây con trái. Lá thoát là bit thấp nhất.
+struct BatchSplit {
+    uint8_t feature;
+    float threshold;
+    uint64_t keepIfRight;   // bitmask lá giữ lại khi x > threshold
+};
+
+struct BatchTree {
+    std::vector<BatchSplit> splits;
+    std::vector<float> leaves;  // lá theo thứ tự trái -> phải
+};
+
+// Trả về số lá của cây con gốc `index`, đánh số lá bắt đầu từ tree.leaves.size()
+static int planSubtree(const ModelNode* nodes, uint16_t index, BatchTree& tree) {
+    const ModelNode& node = nodes[index];
+    if (node.feature == MODEL_LEAF) {
+        tree.leaves.push_back(node.value);
+        return 1;
+    }
+    size_t split = tree.splits.size();
+    tree.splits.push_back({ node.feature, node.value, 0 });
+    int first = (int)tree.leaves.size();
+    int leftLeaves = planSubtree(nodes, index + 1, tree);
+    int rightLeaves = planSubtree(nodes, node.right, tree);
+    if (first + leftLeaves <= 64) {
+        uint64_t left = (leftLeaves == 64 ? ~0ull : ((1ull << leftLeaves) - 1)) << first;
+        tree.splits[split].keepIfRight = ~left;
+    }
+    return leftLeaves + rightLeaves;
+}
+
+#if defined(__AVX2__)
+
+// 8 mẫu một lần: bitmask lá 64-bit của 8 mẫu nằm trong 2 thanh ghi 256-bit
+static void scoreBlock(const BatchTree& tree, const float (*xs)[MODEL_BATCH_LANES], float* leaves) {
+    static_assert(MODEL_BATCH_LANES == 8, "AVX2 xử lý 8 lane");
+    __m256i lo = _mm256_set1_epi64x(-1);
+    __m256i hi = _mm256_set1_epi64x(-1);
+    for (const BatchSplit& split : tree.splits) {
+        __m256 x = _mm256_loadu_ps(xs[split.feature]);
+        // x <= threshold (đi trái) giữ nguyên; ngược lại, kể cả NaN, xóa lá bên trái
+        __m256i goLeft = _mm256_castps_si256(_mm256_cmp_ps(x, _mm256_set1_ps(split.threshold), _CMP_LE_OQ));
+        __m256i keep = _mm256_set1_epi64x((long long)split.keepIfRight);
+        lo = _mm256_and_si256(lo, _mm256_or_si256(keep, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(goLeft))));
+        hi = _mm256_and_si256(hi, _mm256_or_si256(keep, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(goLeft, 1))));
+    }
+    uint64_t masks[MODEL_BATCH_LANES];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(masks), lo);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(masks + 4), hi);
+    for (int l = 0; l < MODEL_BATCH_LANES; l++) {
+        leaves[l] = tree.leaves[__builtin_ctzll(masks[l])];
+    }
+}
+
+#else
+
+// NEON: 4 mẫu một nhóm, bitmask lá trong 2 thanh ghi uint64x2
+static void scoreBlock(const BatchTree& tree, const float (*xs)[MODEL_BATCH_LANES], float* leaves) {
+    for (int base = 0; base < MODEL_BATCH_LANES; base += 4) {
+        uint64x2_t lo = vdupq_n_u64(~0ull);
+        uint64x2_t hi = vdupq_n_u64(~0ull);
+        for (const BatchSplit& split : tree.splits) {
+            uint32x4_t goLeft = vcleq_f32(vld1q_f32(xs[split.feature] + base), vdupq_n_f32(split.threshold));
+            int32x4_t wide = vreinterpretq_s32_u32(goLeft);
+            uint64x2_t keep = vdupq_n_u64(split.keepIfRight);
+            lo = vandq_u64(lo, vorrq_u64(keep, vreinterpretq_u64_s64(vmovl_s32(vget_low_s32(wide)))));
+            hi = vandq_u64(hi, vorrq_u64(keep, vreinterpretq_u64_s64(vmovl_s32(vget_high_s32(wide)))));
+        }
+        uint64_t masks[4];
+        vst1q_u64(masks, lo);
+        vst1q_u64(masks + 2, hi);
+        for (int l = 0; l < 4; l++) {
+            leaves[base + l] = tree.leaves[__builtin_ctzll(masks[l])];
+        }
+    }
+}
+
+#endif
+
+template <>
+void TreeEnsemble::predictBatch(const float* X, size_t n, uint8_t* out) const {
+    // Kế hoạch duyệt dựng lại mỗi lần gọi (vài chục µs), không đổi bảng trong flash
+    std::vector<BatchTree> trees(model.treeCount);
+    bool fits = true;
+    for (uint16_t t = 0; t < model.treeCount; t++) {
+        fits = fits && planSubtree(model.nodes, model.treeRoots[t], trees[t]) <= 64;
+    }
+    if (!fits) {
+        // Cây quá 64 lá: không dùng được bitmask, quay về duyệt từng mẫu
+        for (size_t i = 0; i < n; i++) {
+            out[i] = (uint8_t)predictFull(X + i * MODEL_FEATURE_COUNT);
+        }
+        return;
+    }
+
+    float xs[MODEL_FEATURE_COUNT][MODEL_BATCH_LANES];
+    for (size_t start = 0; start < n; start += MODEL_BATCH_LANES) {
+        size_t count = n - start < MODEL_BATCH_LANES ? n - start : MODEL_BATCH_LANES;
+
+        // Chuyển AoS -> SoA; lane thừa ở khối cuối lặp lại mẫu cuối
+        for (int l = 0; l < MODEL_BATCH_LANES; l++) {
+            const float* x = X + (start + (l < (int)count ? l : count - 1)) * MODEL_FEATURE_COUNT;
+            for (int f = 0; f < MODEL_FEATURE_COUNT; f++) {
+                xs[f][l] = x[f];
+            }
+        }
+
+        // Cộng theo đúng thứ tự cây để trùng bit với predictFull
+        float votes[MODEL_CLASS_COUNT][MODEL_BATCH_LANES] = {};
+        float leaves[MODEL_BATCH_LANES];
+        for (uint16_t t = 0; t < model.treeCount; t++) {
+            scoreBlock(trees[t], xs, leaves);
+            float* v = votes[model.treeClass[t]];
+            for (int l = 0; l < MODEL_BATCH_LANES; l++) {
+                v[l] += leaves[l];
+            }
+        }
+
+        for (size_t l = 0; l < count; l++) {
+            float v[MODEL_CLASS_COUNT] = { votes[0][l], votes[1][l] };
+            out[start + l] = (uint8_t)decide(v);
+        }
+    }
+}
+
+#else
+
+// Scalar (ESP32): cây nông (độ sâu <= 6) nên duyệt từng mẫu đã là nhanh nhất,
+// QuickScorer phải so sánh mọi node split của cây
+template <>
+void TreeEnsemble::predictBatch(const float* X, size_t n, uint8_t* out) const {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = (uint8_t)predictFull(X + i * MODEL_FEATURE_COUNT);
+    }
+}
+
+#endif
+
+#ifndef ARDUINO
+
+void predictBatchParallel(const TreeEnsemble& engine, const float* X, size_t n, uint8_t* out, unsigned threads) {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    if (threads <= 1 || n < 2 * MODEL_BATCH_LANES) {
+        engine.predictBatch(X, n, out);
+        return;
+    }
+
+    // Chia thành các đoạn liền nhau, mỗi đoạn là bội của một khối
+    size_t blocks = (n + MODEL_BATCH_LANES - 1) / MODEL_BATCH_LANES;
+    size_t perThread = (blocks + threads - 1) / threads * MODEL_BATCH_LANES;
+
+    std::vector<std::thread> workers;
+    for (size_t start = 0; start < n; start += perThread) {
+        size_t count = n - start < perThread ? n - start : perThread;
+        workers.emplace_back([&engine, X, out, start, count]() {
+            engine.predictBatch(X + start * MODEL_FEATURE_COUNT, count, out + start);
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+#endif
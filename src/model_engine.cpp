@@ -0,0 +1,442 @@
+#include "model_engine.h"
+#include <math.h>
+
+template <typename Number>
+BasicTreeEnsemble<Number>::BasicTreeEnsemble(const Tables& tables) : model(tables) {
+}
+
+template <typename Number>
+typename Number::Value BasicTreeEnsemble<Number>::leafValue(uint16_t tree, const Value* x) const {
+    const ModelNodeT<Value>* nodes = model.nodes;
+    uint16_t i = model.treeRoots[tree];
+    while (nodes[i].feature != MODEL_LEAF) {
+        i = (x[nodes[i].feature] <= nodes[i].value) ? i + 1 : nodes[i].right;
+    }
+    return nodes[i].value;
+}
+
+template <typename Number>
+void BasicTreeEnsemble<Number>::leafBox(uint16_t tree, const Value* x, LeafCache& cache) const {
+    Value lo[MODEL_FEATURE_COUNT], hi[MODEL_FEATURE_COUNT];
+    for (int f = 0; f < MODEL_FEATURE_COUNT; f++) {
+        lo[f] = Number::lowest();
+        hi[f] = Number::highest();
+    }
+    const ModelNodeT<Value>* nodes = model.nodes;
+    uint16_t i = model.treeRoots[tree];
+    while (nodes[i].feature != MODEL_LEAF) {
+        const ModelNodeT<Value>& node = nodes[i];
+        if (x[node.feature] <= node.value) {
+            if (node.value < hi[node.feature]) hi[node.feature] = node.value;
+            i = i + 1;
+        } else {
+            if (node.value > lo[node.feature]) lo[node.feature] = node.value;
+            i = node.right;
+        }
+    }
+    for (int f = 0; f < MODEL_FEATURE_COUNT; f++) {
+        cache.lo[f][tree] = lo[f];
+        cache.hi[f][tree] = hi[f];
+    }
+    cache.leaf[tree] = nodes[i].value;
+}
+
+template <typename Number>
+void BasicTreeEnsemble<Number>::votes(const Value* x, Value* out) const {
+    for (int k = 0; k < MODEL_CLASS_COUNT; k++) {
+        out[k] = 0;
+    }
+    // Cộng theo đúng thứ tự cây như model_final.h để kết quả trùng bit
+    for (uint16_t t = 0; t < model.treeCount; t++) {
+        out[model.treeClass[t]] += leafValue(t, x);
+    }
+}
+
+template <>
+int TreeEnsemble::decide(const float* votes) const {
+    float exp0 = expf(votes[0]);
+    float exp1 = expf(votes[1]);
+    float prob = exp1 / (exp0 + exp1);
+    return prob >= model.threshold ? 1 : 0;
+}
+
+template <typename Number>
+int BasicTreeEnsemble<Number>::predictFull(const Value* x) const {
+    Value v[MODEL_CLASS_COUNT];
+    votes(x, v);
+    return decide(v);
+}
+
+template <typename Number>
+int BasicTreeEnsemble<Number>::predictIncremental(const Value* x, LeafCache& cache, uint16_t* treesEvaluated) const {
+    if (model.treeCount > MODEL_CACHE_MAX_TREES) {
+        if (treesEvaluated) *treesEvaluated = model.treeCount;
+        return predictFull(x);
+    }
+
+    // Chỉ các feature đổi giá trị mới có thể đưa x ra khỏi hộp. NaN khác chính nó
+    // nên luôn tính là đổi, và không thỏa lo < x nên cây luôn được duyệt lại
+    bool changed[MODEL_FEATURE_COUNT];
+    bool anyChanged = !cache.valid;
+    for (int f = 0; f < MODEL_FEATURE_COUNT; f++) {
+        changed[f] = !(x[f] == cache.x[f]);
+        anyChanged |= changed[f];
+        cache.x[f] = x[f];
+    }
+    if (!anyChanged) {
+        cache.hits += model.treeCount;
+        if (treesEvaluated) *treesEvaluated = 0;
+        return cache.prediction;
+    }
+
+    // Đánh dấu cây có x nằm ngoài hộp theo một feature đã đổi
+    bool stale[MODEL_CACHE_MAX_TREES];
+    for (uint16_t t = 0; t < model.treeCount; t++) {
+        stale[t] = !cache.valid;
+    }
+    for (int f = 0; f < MODEL_FEATURE_COUNT; f++) {
+        if (!changed[f]) continue;
+        const Value* lo = cache.lo[f];
+        const Value* hi = cache.hi[f];
+        Value value = x[f];
+        for (uint16_t t = 0; t < model.treeCount; t++) {
+            stale[t] |= !((lo[t] < value) & (value <= hi[t]));
+        }
+    }
+
+    uint16_t walked = 0;
+    for (uint16_t t = 0; t < model.treeCount; t++) {
+        if (stale[t]) {
+            leafBox(t, x, cache);
+            walked++;
+        }
+    }
+    cache.hits += model.treeCount - walked;
+    cache.misses += walked;
+    if (treesEvaluated) *treesEvaluated = walked;
+
+    // Không cây nào đổi lá: tổng votes và kết quả giữ nguyên như lần trước
+    if (walked == 0) {
+        return cache.prediction;
+    }
+
+    // Cộng đủ các lá theo thứ tự cây nên kết quả trùng bit với predictFull
+    Value v[MODEL_CLASS_COUNT] = {};
+    for (uint16_t t = 0; t < model.treeCount; t++) {
+        v[model.treeClass[t]] += cache.leaf[t];
+    }
+    cache.valid = true;
+    cache.prediction = decide(v);
+    return cache.prediction;
+}
+
+template <typename Number>
+int BasicTreeEnsemble<Number>::predict(const Value* x, uint16_t* treesEvaluated) const {
+    if (treesEvaluated) *treesEvaluated = model.treeCount;
+    return predictFull(x);
+}
+
+template <typename Number>
+int BasicTreeEnsemble<Number>::predictEarlyExit(const Value* x, uint16_t* treesEvaluated) const {
+    Value v[MODEL_CLASS_COUNT] = {};
+    for (uint16_t t = 0; t < model.treeCount; t++) {
+        if (model.marginMin) {
+            // prob >= threshold  <=>  v[1] - v[0] >= logit(threshold), không cần exp
+            Value margin = v[1] - v[0];
+            if (margin + model.marginMin[t] >= model.logitThreshold + Number::earlyExitMargin) {
+                if (treesEvaluated) *treesEvaluated = t;
+                return 1;
+            }
+            if (margin + model.marginMax[t] < model.logitThreshold - Number::earlyExitMargin) {
+                if (treesEvaluated) *treesEvaluated = t;
+                return 0;
+            }
+        }
+        v[model.treeClass[t]] += leafValue(t, x);
+    }
+    if (treesEvaluated) *treesEvaluated = model.treeCount;
+
+    // Sát ngưỡng: float tính xác suất giống hệt model_final.h
+    return decide(v);
+}
+
+template <typename Number>
+size_t BasicTreeEnsemble<Number>::flashBytes() const {
+    size_t bytes = model.nodeCount * sizeof(ModelNodeT<Value>)
+        + model.treeCount * (sizeof(uint16_t) + sizeof(uint8_t))
+        + sizeof(Tables);
+    if (model.marginMin) bytes += 2 * (model.treeCount + 1) * sizeof(Value);
+    return bytes;
+}
+
+template <>
+int FixedTreeEnsemble::decide(const int32_t* votes) const {
+    return (votes[1] - votes[0]) >= model.logitThreshold ? 1 : 0;
+}
+
+template class BasicTreeEnsemble<ModelFloat>;
+template class BasicTreeEnsemble<ModelFixed>;
+
+// value * 2^bits làm tròn nửa ra xa 0 rồi bão hòa vào int32. Nhân với lũy thừa của 2
+// là chính xác nên kết quả trùng với q_round trong model_export.py
+static int32_t fixedRound(float value, int bits) {
+    float scaled = value * (float)(1u << bits);
+    if (scaled >= 2147483647.0f) return INT32_MAX;
+    if (scaled <= -2147483648.0f) return INT32_MIN;
+    return scaled >= 0 ? (int32_t)floorf(scaled + 0.5f) : -(int32_t)floorf(0.5f - scaled);
+}
+
+static int32_t fixedFloor(float value, int bits) {
+    float scaled = floorf(value * (float)(1u << bits));
+    if (scaled >= 2147483647.0f) return INT32_MAX;
+    if (scaled <= -2147483648.0f) return INT32_MIN;
+    return (int32_t)scaled;
+}
+
+int32_t modelFixedInput(float value) {
+    // NaN không <= ngưỡng nào: đưa về INT32_MAX để đi phải như engine float
+    if (value != value) return INT32_MAX;
+    return fixedRound(value, MODEL_FIXED_INPUT_Q_BITS);
+}
+
+ModelFixedTables toFixedTables(const ModelTables& tables, ModelFixedNode* nodes, int32_t* margins) {
+    for (uint16_t i = 0; i < tables.nodeCount; i++) {
+        const ModelNode& node = tables.nodes[i];
+        nodes[i].feature = node.feature;
+        nodes[i].right = node.right;
+        // Ngưỡng làm tròn xuống: với x đúng trên lưới Q20, x <= t <=> X <= floor(t * 2^20)
+        nodes[i].value = node.feature == MODEL_LEAF
+            ? fixedRound(node.value, MODEL_FIXED_LEAF_Q_BITS)
+            : fixedFloor(node.value, MODEL_FIXED_INPUT_Q_BITS);
+    }
+
+    ModelFixedTables fixed;
+    fixed.nodes = nodes;
+    fixed.treeRoots = tables.treeRoots;
+    fixed.treeClass = tables.treeClass;
+    fixed.nodeCount = tables.nodeCount;
+    fixed.treeCount = tables.treeCount;
+    fixed.threshold = tables.threshold;
+    fixed.logitThreshold = -fixedFloor(-tables.logitThreshold, MODEL_FIXED_LEAF_Q_BITS);
+    fixed.marginMin = nullptr;
+    fixed.marginMax = nullptr;
+
+    // Cây t chiếm các node từ treeRoots[t] tới trước gốc cây sau (preorder). Khoảng
+    // votes[1] - votes[0] cộng dồn từ cây cuối, số nguyên nên không cần làm tròn ra ngoài
+    uint16_t count = tables.treeCount;
+    for (uint16_t t = 0; t + 1 < count; t++) {
+        if (tables.treeRoots[t + 1] <= tables.treeRoots[t]) return fixed;
+    }
+    int32_t* lo = margins;
+    int32_t* hi = margins + count + 1;
+    lo[count] = 0;
+    hi[count] = 0;
+    for (int t = count - 1; t >= 0; t--) {
+        uint16_t end = t + 1 < count ? tables.treeRoots[t + 1] : tables.nodeCount;
+        int32_t leafMin = INT32_MAX, leafMax = INT32_MIN;
+        for (uint16_t i = tables.treeRoots[t]; i < end; i++) {
+            if (nodes[i].feature != MODEL_LEAF) continue;
+            if (nodes[i].value < leafMin) leafMin = nodes[i].value;
+            if (nodes[i].value > leafMax) leafMax = nodes[i].value;
+        }
+        if (tables.treeClass[t] == 1) {
+            lo[t] = lo[t + 1] + leafMin;
+            hi[t] = hi[t + 1] + leafMax;
+        } else {
+            lo[t] = lo[t + 1] - leafMax;
+            hi[t] = hi[t + 1] - leafMin;
+        }
+    }
+    fixed.marginMin = lo;
+    fixed.marginMax = hi;
+    return fixed;
+}
+
+// Số ngưỡng nhỏ hơn x trong dãy tăng dần t (x <= t[i] thuộc bin i)
+static uint8_t thresholdBin(const float* t, uint8_t count, float x) {
+    // NaN không <= ngưỡng nào nên luôn đi phải (bin cuối)
+    if (x != x) {
+        return count;
+    }
+    uint8_t lo = 0, hi = count;
+    while (lo < hi) {
+        uint8_t mid = (lo + hi) / 2;
+        if (t[mid] < x) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+QuantizedEnsemble::QuantizedEnsemble(const ModelQuantTables& tables) : model(tables) {
+}
+
+void QuantizedEnsemble::quantize(const float* x, uint8_t* bins) const {
+    for (int f = 0; f < MODEL_FEATURE_COUNT; f++) {
+        bins[f] = thresholdBin(model.thresholds[f], model.thresholdCount[f], x[f]);
+    }
+}
+
+int16_t QuantizedEnsemble::leafValue(uint16_t tree, const uint8_t* bins) const {
+    const ModelQuantNode* nodes = model.nodes;
+    uint16_t i = model.treeRoots[tree];
+    while (nodes[i].feature != MODEL_LEAF) {
+        i = (bins[nodes[i].feature] <= nodes[i].bin) ? i + 1 : (uint16_t)nodes[i].value;
+    }
+    return nodes[i].value;
+}
+
+int QuantizedEnsemble::predictBins(const uint8_t* bins, uint16_t* treesEvaluated) const {
+    int32_t votes[MODEL_CLASS_COUNT] = { 0 };
+    for (uint16_t t = 0; t < model.treeCount; t++) {
+        if (model.marginMin) {
+            // Số nguyên nên không cần khoảng an toàn như bản float
+            int32_t margin = votes[1] - votes[0];
+            if (margin + model.marginMin[t] >= model.logitThreshold) {
+                if (treesEvaluated) *treesEvaluated = t;
+                return 1;
+            }
+            if (margin + model.marginMax[t] < model.logitThreshold) {
+                if (treesEvaluated) *treesEvaluated = t;
+                return 0;
+            }
+        }
+        votes[model.treeClass[t]] += leafValue(t, bins);
+    }
+    if (treesEvaluated) *treesEvaluated = model.treeCount;
+    // prob = e1 / (e0 + e1) >= p  <=>  votes[1] - votes[0] >= logit(p)
+    return (votes[1] - votes[0]) >= model.logitThreshold ? 1 : 0;
+}
+
+int QuantizedEnsemble::predict(const float* x, uint16_t* treesEvaluated) const {
+    uint8_t bins[MODEL_FEATURE_COUNT];
+    quantize(x, bins);
+    return predictBins(bins, treesEvaluated);
+}
+
+size_t QuantizedEnsemble::flashBytes() const {
+    size_t bytes = model.nodeCount * sizeof(ModelQuantNode)
+        + model.treeCount * (sizeof(uint16_t) + sizeof(uint8_t))
+        + sizeof(ModelQuantTables);
+    for (int f = 0; f < MODEL_FEATURE_COUNT; f++) {
+        bytes += model.thresholdCount[f] * sizeof(float);
+    }
+    if (model.marginMin) bytes += 2 * (model.treeCount + 1) * sizeof(int32_t);
+    return bytes;
+}
+
+CompactEnsemble::CompactEnsemble(const ModelCompactTables& tables) : model(tables) {
+}
+
+void CompactEnsemble::quantize(const float* x, uint8_t* bins) const {
+    for (int f = 0; f < MODEL_FEATURE_COUNT; f++) {
+        bins[f] = thresholdBin(model.thresholds[f], model.thresholdCount[f], x[f]);
+    }
+}
+
+uint8_t CompactEnsemble::leafIndex(uint16_t tree, const uint8_t* bins) const {
+    uint16_t root = model.treeRoots[tree];
+    if (root & MODEL_COMPACT_ROOT_LEAF) {
+        return (uint8_t)(root & ~MODEL_COMPACT_ROOT_LEAF);
+    }
+    const uint32_t* nodes = model.nodes;
+    uint16_t i = root;
+    for (;;) {
+        uint32_t node = nodes[i];
+        if (bins[MODEL_COMPACT_FEATURE(node)] <= MODEL_COMPACT_BIN(node)) {
+            if (node & MODEL_COMPACT_LEFT_LEAF) return (uint8_t)MODEL_COMPACT_LEFT(node);
+            i = i + 1;
+        } else {
+            if (node & MODEL_COMPACT_RIGHT_LEAF) return (uint8_t)MODEL_COMPACT_RIGHT(node);
+            i = (uint16_t)MODEL_COMPACT_RIGHT(node);
+        }
+    }
+}
+
+int CompactEnsemble::predictBins(const uint8_t* bins, uint16_t* treesEvaluated) const {
+    int32_t votes[MODEL_CLASS_COUNT] = { 0 };
+    for (uint16_t t = 0; t < model.treeCount; t++) {
+        if (model.marginMin) {
+            int32_t margin = votes[1] - votes[0];
+            if (margin + model.marginMin[t] >= model.logitThreshold) {
+                if (treesEvaluated) *treesEvaluated = t;
+                return 1;
+            }
+            if (margin + model.marginMax[t] < model.logitThreshold) {
+                if (treesEvaluated) *treesEvaluated = t;
+                return 0;
+            }
+        }
+        votes[model.treeClass[t]] += model.palette[leafIndex(t, bins)];
+    }
+    if (treesEvaluated) *treesEvaluated = model.treeCount;
+    return (votes[1] - votes[0]) >= model.logitThreshold ? 1 : 0;
+}
+
+int CompactEnsemble::predict(const float* x, uint16_t* treesEvaluated) const {
+    uint8_t bins[MODEL_FEATURE_COUNT];
+    quantize(x, bins);
+    return predictBins(bins, treesEvaluated);
+}
+
+size_t CompactEnsemble::flashBytes() const {
+    size_t bytes = model.nodeCount * sizeof(uint32_t)
+        + model.treeCount * (sizeof(uint16_t) + sizeof(uint8_t))
+        + model.paletteSize * sizeof(int16_t)
+        + sizeof(ModelCompactTables);
+    for (int f = 0; f < MODEL_FEATURE_COUNT; f++) {
+        bytes += model.thresholdCount[f] * sizeof(float);
+    }
+    if (model.marginMin) bytes += 2 * (model.treeCount + 1) * sizeof(int32_t);
+    return bytes;
+}
+
+RegionModel::RegionModel(const ModelRegions& regions) : model(regions) {
+}
+
+uint16_t RegionModel::bin(uint8_t feature, int value) const {
+    // Số ngưỡng nhỏ hơn value (lower_bound)
+    const int16_t* t = model.thresholds[feature];
+    uint16_t lo = 0, hi = model.thresholdCount[feature];
+    while (lo < hi) {
+        uint16_t mid = (lo + hi) / 2;
+        if (t[mid] < value) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+bool RegionModel::lookup(const float* x, int& prediction) const {
+    int v[MODEL_FEATURE_COUNT];
+    for (int f = 0; f < MODEL_FEATURE_COUNT; f++) {
+        // NaN và số không nguyên đều không thỏa điều kiện này
+        if (!(x[f] >= INT16_MIN && x[f] <= INT16_MAX)) return false;
+        v[f] = (int)x[f];
+        if ((float)v[f] != x[f]) return false;
+    }
+
+    uint16_t soilBin = bin(0, v[0]);
+    uint16_t tempBin = bin(1, v[1]);
+    uint16_t humBin = bin(2, v[2]);
+    uint16_t tempBins = model.thresholdCount[1] + 1;
+
+    uint16_t row = model.rowIndex[soilBin * tempBins + tempBin];
+    const uint8_t* bits = model.rows + row * model.rowBytes;
+    prediction = (bits[humBin >> 3] >> (humBin & 7)) & 1;
+    return true;
+}
+
+size_t RegionModel::flashBytes() const {
+    size_t bytes = sizeof(ModelRegions);
+    size_t cells = 1;
+    for (int f = 0; f < MODEL_FEATURE_COUNT; f++) {
+        bytes += model.thresholdCount[f] * sizeof(int16_t);
+        if (f < 2) cells *= model.thresholdCount[f] + 1;
+    }
+    return bytes + cells * sizeof(uint16_t) + model.rowCount * model.rowBytes;
+}
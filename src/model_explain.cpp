@@ -0,0 +1,52 @@
+#include "model_explain.h"
+
+TreeExplainer::TreeExplainer(const ModelTables& tables, const float* deltas) : model(tables), nodeDeltas(deltas) {
+}
+
+int TreeExplainer::explain(const float* x, ModelExplanation& out) const {
+    float votes[MODEL_CLASS_COUNT] = { 0 };
+    out.bias = 0;
+    for (int f = 0; f < MODEL_FEATURE_COUNT; f++) {
+        out.contributions[f] = 0;
+    }
+    for (uint16_t t = 0; t < model.treeCount; t++) {
+        // Cây lớp 0 làm giảm margin
+        float sign = model.treeClass[t] == 1 ? 1.0f : -1.0f;
+        uint16_t i = model.treeRoots[t];
+        out.bias += sign * nodeDeltas[i];
+        while (model.nodes[i].feature != MODEL_LEAF) {
+            uint8_t feature = model.nodes[i].feature;
+            i = (x[feature] <= model.nodes[i].value) ? i + 1 : model.nodes[i].right;
+            out.contributions[feature] += sign * nodeDeltas[i];
+        }
+        votes[model.treeClass[t]] += model.nodes[i].value;
+    }
+    out.margin = out.bias;
+    for (int f = 0; f < MODEL_FEATURE_COUNT; f++) {
+        out.margin += out.contributions[f];
+    }
+    out.prediction = TreeEnsemble(model).decide(votes);
+    return out.prediction;
+}
+
+void modelExplainDeltas(const ModelTables& tables, float* deltas) {
+    // Con luôn đứng sau cha trong bảng preorder: đi ngược từ cuối bảng thì hai con
+    // đã có kỳ vọng khi tới cha
+    for (int i = tables.nodeCount - 1; i >= 0; i--) {
+        const ModelNode& node = tables.nodes[i];
+        if (node.feature == MODEL_LEAF) {
+            deltas[i] = node.value;
+        } else {
+            deltas[i] = (deltas[i + 1] + deltas[node.right]) / 2;
+        }
+    }
+    // Đổi kỳ vọng của con thành chênh lệch so với cha. Đi ngược nên con đã dùng
+    // kỳ vọng của chính nó cho các cháu trước khi bị đổi; gốc giữ nguyên kỳ vọng
+    for (int i = tables.nodeCount - 1; i >= 0; i--) {
+        const ModelNode& node = tables.nodes[i];
+        if (node.feature != MODEL_LEAF) {
+            deltas[i + 1] -= deltas[i];
+            deltas[node.right] -= deltas[i];
+        }
+    }
+}
@@ -0,0 +1,754 @@
+#include "config.h"
+#include "model_handler.h"
+#include "system_handler.h"
+#include "telegram_handler.h"
+#include "sensor_handler.h"
+#include "model_table.h"
+#include "model_pool.h"
+#include "model_registry.h"
+#include "model_explain.h"
+#include "model_image.h"
+#include "model_profile.h"
+#include "feature_store.h"
+// Chỉ engine chọn bằng MODEL_INFERENCE_* được link vào firmware; các định dạng còn
+// lại và mô hình nested-if gốc chỉ có khi build với MODEL_BENCHMARK ('m')
+#if defined(MODEL_BENCHMARK)
+#include "model_final.h"
+#include "model_unrolled.h"
+#endif
+#if defined(MODEL_BENCHMARK) || defined(MODEL_INFERENCE_FIXED)
+#include "model_fixed.h"
+#endif
+#if defined(MODEL_BENCHMARK) || !defined(MODEL_INFERENCE_FIXED)
+#include "model_regions.h"
+#endif
+#if defined(MODEL_BENCHMARK) || defined(MODEL_INFERENCE_QUANTIZED)
+#include "model_quantized.h"
+#endif
+#if defined(MODEL_BENCHMARK) || defined(MODEL_INFERENCE_COMPACT)
+#include "model_compact.h"
+#endif
+#include <HTTPClient.h>
+#include <LittleFS.h>
+
+// Mô hình đọc MODEL_FEATURE_COUNT mục đầu của vector trong feature_store.h
+#if MODEL_FEATURE_LAYOUT_VERSION != FEATURE_LAYOUT_VERSION
+#error "model_table.h sinh với bố cục đặc trưng khác feature_store.h, chạy lại tools/model_export.py"
+#endif
+static_assert(MODEL_FEATURE_COUNT <= FEATURE_COUNT, "mô hình dùng nhiều đặc trưng hơn feature store");
+
+// Các engine suy luận của mô hình built-in (bảng node nằm trong flash). Bảng
+// model_table.h luôn có (giải thích, quét WCET, mô hình vùng)
+static const TreeEnsemble tableEngine(MODEL_TABLE);
+#if defined(MODEL_BENCHMARK) || defined(MODEL_INFERENCE_FIXED)
+static const FixedTreeEnsemble fixedEngine(MODEL_FIXED);
+#endif
+#if defined(MODEL_BENCHMARK) || defined(MODEL_INFERENCE_QUANTIZED)
+static const QuantizedEnsemble quantizedEngine(MODEL_QUANTIZED);
+#endif
+#if defined(MODEL_BENCHMARK) || defined(MODEL_INFERENCE_COMPACT)
+static const CompactEnsemble compactEngine(MODEL_COMPACT);
+#endif
+#if defined(MODEL_INFERENCE_QUANTIZED)
+static const QuantizedEnsemble& builtinEngine = quantizedEngine;
+#elif defined(MODEL_INFERENCE_COMPACT)
+static const CompactEnsemble& builtinEngine = compactEngine;
+#elif defined(MODEL_INFERENCE_FIXED)
+static const FixedTreeEnsemble& builtinEngine = fixedEngine;
+#else
+static const TreeEnsemble& builtinEngine = tableEngine;
+#endif
+#if defined(MODEL_BENCHMARK) || !defined(MODEL_INFERENCE_FIXED)
+// Bảng vùng quyết định: 3 lần tìm nhị phân + 1 bit thay vì duyệt 41 cây
+static const RegionModel modelRegions(MODEL_REGIONS);
+#endif
+#if defined(MODEL_BENCHMARK)
+// Bản unrolled trải bảng thành code lúc biên dịch, chỉ dùng để so trong benchmarkModel
+typedef UnrolledEnsemble<MODEL_TABLE> UnrolledModel;
+#endif
+static const TreeExplainer builtinExplainer(MODEL_TABLE, MODEL_TABLE_EXPLAIN);
+
+// Mô hình nạp từ file: engine trỏ vào buffer trong heap. nullptr = dùng built-in
+static TreeEnsemble* loadedEngine = nullptr;
+static uint8_t* loadedImage = nullptr;
+// Bảng delta giải thích của mô hình nạp từ file, nullptr nếu không đủ RAM
+static TreeExplainer* loadedExplainer = nullptr;
+static float* loadedDeltas = nullptr;
+static String loadedUrl;
+// Tăng mỗi lần đổi mô hình (nạp file hoặc quay về built-in)
+static uint32_t modelGeneration = 0;
+
+// Giải thích của quyết định vùng 0 gần nhất, ghi lúc ra quyết định (không tính lại
+// trên vector mới hơn lúc cảnh báo). Vector và mô hình không đổi thì các lá đạt tới
+// không đổi nên đóng góp giữ nguyên, không duyệt lại
+static ModelExplanation decisionExplanation;
+static bool decisionExplained = false;
+static float explainedInput[MODEL_FEATURE_COUNT];
+static uint32_t explainedGeneration = 0;
+
+#if defined(MODEL_INFERENCE_FIXED)
+// Mô hình nạp từ file đổi sang fixed-point lúc nạp: node và margin nằm trong heap
+static FixedTreeEnsemble* loadedFixedEngine = nullptr;
+static uint8_t* loadedFixedTables = nullptr;
+#endif
+
+// Lá và hộp đầu vào của từng cây ở lần suy luận trước (predictIncremental)
+#if defined(MODEL_INFERENCE_FIXED)
+static ModelFixedLeafCache modelCache;
+#else
+static ModelLeafCache modelCache;
+#endif
+
+// Mô hình của từng vùng trong model_pool.h
+static constexpr uint8_t zoneModels[MODEL_ZONE_COUNT] = MODEL_ZONE_MODELS;
+static constexpr bool zoneModelsValid() {
+    for (int z = 0; z < MODEL_ZONE_COUNT; z++) {
+        if (zoneModels[z] >= MODEL_POOL_MODEL_COUNT) return false;
+    }
+    return true;
+}
+static_assert(zoneModelsValid(), "MODEL_ZONE_MODELS trỏ tới mô hình không có trong model_pool.h");
+static_assert(MODEL_POOL_MODEL_COUNT <= MODEL_REGISTRY_MAX_MODELS, "model_pool.h có quá nhiều mô hình");
+
+#if MODEL_ZONE_COUNT > 1
+#if defined(MODEL_INFERENCE_FIXED)
+#error "MODEL_INFERENCE_FIXED chỉ hỗ trợ MODEL_ZONE_COUNT 1"
+#endif
+// Mọi mô hình vùng trong một lượt; mô hình 0 là mô hình đang dùng (built-in hoặc LittleFS)
+static ModelRegistry zoneRegistry;
+#endif
+
+static String pendingUrl;
+static bool fsReady = false;
+
+// Thời gian suy luận thực tế (mỗi lần predictIrrigation) và kết quả quét miền
+static CycleHistogram inferenceProfile;
+static CycleHistogram sweepProfile;
+static ModelDomainSweep* sweep = nullptr;    // khác nullptr khi đang quét
+static uint32_t sweepNext = 0;
+static uint32_t sweepWorst = 0;
+static float sweepWorstInput[MODEL_FEATURE_COUNT];
+static bool sweepDone = false;
+
+// Đọc và kiểm tra file, thành công thì thay mô hình đang dùng
+// Phiên bản chỉ áp dụng cho các vùng dùng mô hình 0 (mô hình nạp được từ LittleFS)
+static void setModelVersion(uint32_t version) {
+    for (int z = 0; z < MODEL_ZONE_COUNT; z++) {
+        if (zoneModels[z] == 0) modelPredict[z].modelVersion = version;
+    }
+}
+
+static bool loadModelFile(const char* path) {
+    File file = LittleFS.open(path, "r");
+    if (!file) {
+        return false;
+    }
+    size_t size = file.size();
+    if (size == 0 || size > MODEL_IMAGE_MAX_SIZE) {
+        Serial.printf("Mô hình %s: kích thước %u không hợp lệ\n", path, (unsigned)size);
+        file.close();
+        return false;
+    }
+
+    uint8_t* buffer = static_cast<uint8_t*>(malloc(size));
+    if (buffer == nullptr) {
+        Serial.println("Mô hình: không đủ RAM để nạp");
+        file.close();
+        return false;
+    }
+    size_t readBytes = file.read(buffer, size);
+    file.close();
+
+    ModelTables tables;
+    ModelImageHeader header;
+    ModelImageStatus status = readBytes == size
+        ? parseModelImage(buffer, size, tables, &header)
+        : MODEL_IMAGE_IO_ERROR;
+    if (status != MODEL_IMAGE_OK) {
+        Serial.printf("Mô hình %s: %s\n", path, modelImageStatusText(status));
+        free(buffer);
+        return false;
+    }
+
+#if defined(MODEL_INFERENCE_FIXED)
+    // Đổi ngưỡng và lá sang số nguyên một lần lúc nạp, đường suy luận không còn float
+    size_t nodeBytes = tables.nodeCount * sizeof(ModelFixedNode);
+    uint8_t* fixedBuffer = static_cast<uint8_t*>(malloc(nodeBytes + 2 * (tables.treeCount + 1) * sizeof(int32_t)));
+    if (fixedBuffer == nullptr) {
+        Serial.println("Mô hình: không đủ RAM để đổi sang fixed-point");
+        free(buffer);
+        return false;
+    }
+    FixedTreeEnsemble* fixed = new FixedTreeEnsemble(toFixedTables(
+        tables, reinterpret_cast<ModelFixedNode*>(fixedBuffer), reinterpret_cast<int32_t*>(fixedBuffer + nodeBytes)));
+#endif
+
+    // File mô hình không có cover: tính bảng giải thích với hai nhánh nặng như nhau.
+    // Thiếu RAM thì vẫn chạy mô hình, chỉ không giải thích được
+    float* deltas = static_cast<float*>(malloc(tables.nodeCount * sizeof(float)));
+    TreeExplainer* explainer = nullptr;
+    if (deltas != nullptr) {
+        modelExplainDeltas(tables, deltas);
+        explainer = new TreeExplainer(tables, deltas);
+    } else {
+        Serial.println("Mô hình: không đủ RAM cho bảng giải thích");
+    }
+
+    // Engine mới dựng xong mới đổi con trỏ, suy luận (chạy trong loop) chỉ thấy
+    // mô hình cũ hoặc mô hình mới hoàn chỉnh
+    TreeEnsemble* engine = new TreeEnsemble(tables);
+    TreeEnsemble* oldEngine = loadedEngine;
+    uint8_t* oldImage = loadedImage;
+    TreeExplainer* oldExplainer = loadedExplainer;
+    float* oldDeltas = loadedDeltas;
+    loadedEngine = engine;
+    loadedImage = buffer;
+    loadedExplainer = explainer;
+    loadedDeltas = deltas;
+    modelGeneration++;
+#if defined(MODEL_INFERENCE_FIXED)
+    FixedTreeEnsemble* oldFixed = loadedFixedEngine;
+    uint8_t* oldFixedTables = loadedFixedTables;
+    loadedFixedEngine = fixed;
+    loadedFixedTables = fixedBuffer;
+    delete oldFixed;
+    free(oldFixedTables);
+#endif
+    modelCache.invalidate();
+#if MODEL_ZONE_COUNT > 1
+    if (!zoneRegistry.set(0, engine->tables())) {
+        Serial.println("Mô hình: quá nhiều cây cho các vùng, vùng dùng mô hình 0 giữ bản built-in");
+        zoneRegistry.set(0, MODEL_POOL_MODELS[0]);
+    }
+#endif
+    delete oldEngine;
+    free(oldImage);
+    delete oldExplainer;
+    free(oldDeltas);
+
+    setModelVersion(header.modelVersion);
+    Serial.printf("Đã nạp mô hình v%u: %u cây, %u node, ngưỡng %.3f\n",
+                  (unsigned)header.modelVersion, header.treeCount, header.nodeCount, header.threshold);
+    return true;
+}
+
+static bool downloadModel(const String& url) {
+    if (WiFi.status() != WL_CONNECTED) {
+        Serial.println("Mô hình: WiFi không kết nối");
+        return false;
+    }
+
+    HTTPClient http;
+    if (!http.begin(http_ssl_client, url)) {
+        Serial.println("Mô hình: HTTP begin failed");
+        return false;
+    }
+    int httpCode = http.GET();
+    if (httpCode != 200) {
+        Serial.printf("Mô hình: HTTP status %d\n", httpCode);
+        http.end();
+        return false;
+    }
+    int size = http.getSize();
+    if (size <= 0 || size > MODEL_IMAGE_MAX_SIZE) {
+        Serial.printf("Mô hình: kích thước %d không hợp lệ\n", size);
+        http.end();
+        return false;
+    }
+
+    // Ghi ra file tạm, chỉ thay MODEL_FILE_PATH khi file mới nạp được
+    File file = LittleFS.open(MODEL_TMP_PATH, "w");
+    if (!file) {
+        Serial.println("Mô hình: không tạo được file tạm");
+        http.end();
+        return false;
+    }
+    int written = http.writeToStream(&file);
+    file.close();
+    http.end();
+    feedWatchdog();
+
+    if (written != size || !loadModelFile(MODEL_TMP_PATH)) {
+        Serial.printf("Mô hình: tải lỗi (%d/%d bytes), giữ mô hình hiện tại\n", written, size);
+        LittleFS.remove(MODEL_TMP_PATH);
+        return false;
+    }
+
+    // Mất điện giữa hai bước thì lần khởi động sau dùng mô hình built-in
+    LittleFS.remove(MODEL_FILE_PATH);
+    LittleFS.rename(MODEL_TMP_PATH, MODEL_FILE_PATH);
+    File urlFile = LittleFS.open(MODEL_URL_PATH, "w");
+    if (urlFile) {
+        urlFile.print(url);
+        urlFile.close();
+    }
+    loadedUrl = url;
+    return true;
+}
+
+void setupModel() {
+    for (int z = 0; z < MODEL_ZONE_COUNT; z++) {
+        modelPredict[z].poolModel = zoneModels[z];
+    }
+    setModelVersion(0);
+#if MODEL_ZONE_COUNT > 1
+    for (int m = 0; m < MODEL_POOL_MODEL_COUNT; m++) {
+        zoneRegistry.set(m, MODEL_POOL_MODELS[m]);
+    }
+    Serial.printf("%d vùng, %d mô hình: %u cây khác nhau / %u cây\n", MODEL_ZONE_COUNT, MODEL_POOL_MODEL_COUNT,
+                  zoneRegistry.uniqueTrees(), zoneRegistry.totalTrees());
+#endif
+    fsReady = LittleFS.begin(true);
+    if (!fsReady) {
+        Serial.println("LittleFS lỗi, dùng mô hình built-in");
+        return;
+    }
+
+    if (LittleFS.exists(MODEL_FILE_PATH) && loadModelFile(MODEL_FILE_PATH)) {
+        File urlFile = LittleFS.open(MODEL_URL_PATH, "r");
+        if (urlFile) {
+            loadedUrl = urlFile.readString();
+            urlFile.close();
+        }
+    } else {
+        Serial.println("Dùng mô hình built-in");
+    }
+}
+
+#if defined(MODEL_INFERENCE_FIXED)
+
+static int runModel(const int32_t* features, uint16_t* treesEvaluated) {
+    // Không tra bảng vùng: mọi kết quả đều từ cùng một engine số nguyên
+    const FixedTreeEnsemble& engine = loadedFixedEngine != nullptr ? *loadedFixedEngine : builtinEngine;
+    int prediction = engine.predictIncremental(features, modelCache, treesEvaluated);
+    modelPredict[0].cacheHits = modelCache.hits;
+    modelPredict[0].cacheMisses = modelCache.misses;
+    return prediction;
+}
+
+int predictIrrigationFixed(const int32_t* features, uint16_t* treesEvaluated) {
+    if (treesEvaluated) *treesEvaluated = 0;
+    uint32_t start = modelCycleCount();
+    int prediction = runModel(features, treesEvaluated);
+    inferenceProfile.record(modelCycleCount() - start);
+    return prediction;
+}
+
+int predictIrrigation(const float* features, uint16_t* treesEvaluated) {
+    int32_t x[MODEL_FEATURE_COUNT];
+    for (int f = 0; f < MODEL_FEATURE_COUNT; f++) {
+        x[f] = modelFixedInput(features[f]);
+    }
+    return predictIrrigationFixed(x, treesEvaluated);
+}
+
+// Engine cây không trạng thái của mô hình đang dùng (kể cả bước đổi đầu vào sang Q20)
+static int predictTrees(const float* features) {
+    int32_t x[MODEL_FEATURE_COUNT];
+    for (int f = 0; f < MODEL_FEATURE_COUNT; f++) {
+        x[f] = modelFixedInput(features[f]);
+    }
+    if (loadedFixedEngine != nullptr) {
+        return loadedFixedEngine->predict(x);
+    }
+    return builtinEngine.predict(x);
+}
+
+#else
+
+static int runModel(const float* features, uint16_t* treesEvaluated) {
+    int prediction;
+    if (loadedEngine != nullptr) {
+        prediction = loadedEngine->predictIncremental(features, modelCache, treesEvaluated);
+    } else if (modelRegions.lookup(features, prediction)) {
+        // Tra bảng vùng khi đầu vào là số nguyên (trùng kết quả với model_final.h).
+        // Bảng vùng chỉ đúng với mô hình built-in
+        return prediction;
+    } else {
+#if defined(MODEL_INFERENCE_QUANTIZED) || defined(MODEL_INFERENCE_COMPACT)
+        return builtinEngine.predict(features, treesEvaluated);
+#else
+        // Chỉ duyệt lại các cây có lá bị đổi so với lần trước
+        prediction = builtinEngine.predictIncremental(features, modelCache, treesEvaluated);
+#endif
+    }
+    modelPredict[0].cacheHits = modelCache.hits;
+    modelPredict[0].cacheMisses = modelCache.misses;
+    return prediction;
+}
+
+int predictIrrigation(const float* features, uint16_t* treesEvaluated) {
+    if (treesEvaluated) *treesEvaluated = 0;
+    uint32_t start = modelCycleCount();
+    int prediction = runModel(features, treesEvaluated);
+    inferenceProfile.record(modelCycleCount() - start);
+    return prediction;
+}
+
+// Engine cây không trạng thái của mô hình đang dùng: đường chậm nhất của
+// predictIrrigation (bảng vùng không tra được và cache lá trượt hết)
+static int predictTrees(const float* features) {
+    if (loadedEngine != nullptr) {
+        return loadedEngine->predict(features);
+    }
+    return builtinEngine.predict(features);
+}
+
+#endif
+
+int predictIrrigationStateless(const float* features) {
+    return predictTrees(features);
+}
+
+void predictZones(const float* features, uint8_t* decisions, uint16_t* treesEvaluated) {
+#if MODEL_ZONE_COUNT > 1
+    uint8_t models[MODEL_POOL_MODEL_COUNT];
+    uint32_t start = modelCycleCount();
+    zoneRegistry.predictAll(features, models);
+    inferenceProfile.record(modelCycleCount() - start);
+    for (int z = 0; z < MODEL_ZONE_COUNT; z++) {
+        decisions[z] = models[zoneModels[z]];
+    }
+    if (treesEvaluated) *treesEvaluated = zoneRegistry.uniqueTrees();
+#else
+    decisions[0] = (uint8_t)predictIrrigation(features, treesEvaluated);
+#endif
+}
+
+uint8_t predictZone(uint8_t zone, const float* features, uint16_t* treesEvaluated) {
+#if MODEL_ZONE_COUNT > 1
+    uint32_t start = modelCycleCount();
+    int decision = zoneRegistry.predict(zoneModels[zone < MODEL_ZONE_COUNT ? zone : 0], features, treesEvaluated);
+    inferenceProfile.record(modelCycleCount() - start);
+    return (uint8_t)decision;
+#else
+    return (uint8_t)predictIrrigation(features, treesEvaluated);
+#endif
+}
+
+void recordIrrigationDecision(const float* features) {
+    bool same = decisionExplained && explainedGeneration == modelGeneration;
+    for (int f = 0; same && f < MODEL_FEATURE_COUNT; f++) {
+        same = explainedInput[f] == features[f];
+    }
+    if (same) return;
+
+    const TreeExplainer* explainer = &builtinExplainer;
+    if (loadedEngine != nullptr) {
+        explainer = loadedExplainer;
+    }
+    decisionExplained = false;
+    if (explainer == nullptr) {
+        return;
+    }
+    uint32_t start = modelCycleCount();
+    explainer->explain(features, decisionExplanation);
+    modelPredict[0].explainCycles = modelCycleCount() - start;
+    memcpy(explainedInput, features, sizeof(explainedInput));
+    explainedGeneration = modelGeneration;
+    decisionExplained = true;
+}
+
+bool explainIrrigation(ModelExplanation& out) {
+    if (!decisionExplained) return false;
+    out = decisionExplanation;
+    return true;
+}
+
+void startModelWcetSweep() {
+    if (sweep != nullptr) {
+        Serial.println("WCET: đang quét");
+        return;
+    }
+    sweep = new ModelDomainSweep(loadedEngine != nullptr ? loadedEngine->tables() : MODEL_TABLE);
+    sweepNext = 0;
+    sweepWorst = 0;
+    sweepDone = false;
+    sweepProfile.reset();
+    Serial.printf("WCET: bắt đầu quét %u ô%s\n", sweep->cellCount(),
+                  sweep->complete() ? "" : " (thiếu ngưỡng, không đủ miền)");
+}
+
+void handleModelProfile() {
+    if (sweep == nullptr) {
+        return;
+    }
+    // Mỗi vòng loop quét tối đa MODEL_SWEEP_SLICE_MS để không chặn Firebase/Telegram
+    unsigned long sliceStart = millis();
+    uint32_t cells = sweep->cellCount();
+    float x[MODEL_FEATURE_COUNT];
+    while (sweepNext < cells && millis() - sliceStart < MODEL_SWEEP_SLICE_MS) {
+        for (int i = 0; i < 256 && sweepNext < cells; i++, sweepNext++) {
+            sweep->point(sweepNext, x);
+            uint32_t cycles = measureCycles(predictTrees, x, sweepWorst);
+            sweepProfile.record(cycles);
+            if (cycles > sweepWorst) {
+                sweepWorst = cycles;
+                memcpy(sweepWorstInput, x, sizeof(sweepWorstInput));
+            }
+        }
+    }
+    if (sweepNext >= cells) {
+        delete sweep;
+        sweep = nullptr;
+        sweepDone = true;
+        Serial.println("WCET: quét xong");
+        printModelProfile();
+    }
+}
+
+static void printHistogram(const char* name, const CycleHistogram& h) {
+    Serial.printf("%-10s %8u %8u %8u %8u %8u\n", name, h.count(), h.min(), h.mean(), h.percentile(0.99f), h.max());
+}
+
+void printModelProfile() {
+    Serial.println("\n=== Thời gian suy luận (chu kỳ CPU) ===");
+    Serial.printf("%-10s %8s %8s %8s %8s %8s\n", "", "count", "min", "mean", "p99", "max");
+    printHistogram("thực tế", inferenceProfile);
+    if (sweep != nullptr) {
+        Serial.printf("WCET: đang quét %u/%u ô\n", sweepNext, sweep->cellCount());
+    }
+    if (sweepDone || sweep != nullptr) {
+        printHistogram("quét miền", sweepProfile);
+        Serial.printf("Chậm nhất: %u chu kỳ (%.1f us) tại soil=%.2f temp=%.2f hum=%.2f\n",
+                      sweepWorst, sweepWorst / (float)getCpuFrequencyMhz(),
+                      sweepWorstInput[0], sweepWorstInput[1], sweepWorstInput[2]);
+    } else {
+        Serial.println("Chưa quét miền đầu vào (lệnh 'e')");
+    }
+    Serial.println("=======================================");
+}
+
+static void setHistogramJson(FirebaseJson& json, const CycleHistogram& h) {
+    json.set("count", (int)h.count());
+    json.set("min", (int)h.min());
+    json.set("mean", (int)h.mean());
+    json.set("p99", (int)h.percentile(0.99f));
+    json.set("max", (int)h.max());
+}
+
+void setModelProfileJson(FirebaseJson& json) {
+    FirebaseJson inference;
+    setHistogramJson(inference, inferenceProfile);
+    json.set("inference_cycles", inference);
+    if (sweepDone) {
+        FirebaseJson wcet;
+        setHistogramJson(wcet, sweepProfile);
+        wcet.set("worst_soil", sweepWorstInput[0]);
+        wcet.set("worst_temp", sweepWorstInput[1]);
+        wcet.set("worst_hum", sweepWorstInput[2]);
+        json.set("wcet_sweep", wcet);
+    }
+}
+
+bool requestModelUpdate(const String& url) {
+    if (url.isEmpty() || url == loadedUrl) {
+        return false;
+    }
+    pendingUrl = url;
+    Serial.printf("Đặt lịch tải mô hình: %s\n", url.c_str());
+    return true;
+}
+
+void handleModelUpdate() {
+    if (pendingUrl.isEmpty()) {
+        return;
+    }
+    String url = pendingUrl;
+    pendingUrl = "";
+
+    if (!fsReady) {
+        Serial.println("Mô hình: LittleFS chưa sẵn sàng, bỏ qua cập nhật");
+        return;
+    }
+
+    Serial.printf("Tải mô hình từ %s\n", url.c_str());
+    if (downloadModel(url)) {
+        String msg = "🤖 Đã cập nhật mô hình v";
+        msg.concat(String(modelPredict[0].modelVersion));
+        sendTelegramMessage(msg);
+    } else {
+        sendTelegramMessage("⚠️ Cập nhật mô hình thất bại, giữ mô hình hiện tại");
+    }
+}
+
+void useBuiltinModel() {
+    TreeEnsemble* oldEngine = loadedEngine;
+    uint8_t* oldImage = loadedImage;
+    TreeExplainer* oldExplainer = loadedExplainer;
+    float* oldDeltas = loadedDeltas;
+    loadedEngine = nullptr;
+    loadedImage = nullptr;
+    loadedExplainer = nullptr;
+    loadedDeltas = nullptr;
+    modelGeneration++;
+#if defined(MODEL_INFERENCE_FIXED)
+    delete loadedFixedEngine;
+    free(loadedFixedTables);
+    loadedFixedEngine = nullptr;
+    loadedFixedTables = nullptr;
+#endif
+    modelCache.invalidate();
+#if MODEL_ZONE_COUNT > 1
+    zoneRegistry.set(0, MODEL_POOL_MODELS[0]);
+#endif
+    delete oldEngine;
+    free(oldImage);
+    delete oldExplainer;
+    free(oldDeltas);
+
+    if (fsReady) {
+        LittleFS.remove(MODEL_FILE_PATH);
+        LittleFS.remove(MODEL_URL_PATH);
+    }
+    loadedUrl = "";
+    setModelVersion(0);
+    Serial.println("Quay về mô hình built-in");
+}
+
+String getModelInfoText() {
+    String info = "🤖 Mô hình: ";
+    if (loadedEngine != nullptr) {
+        const ModelTables& tables = loadedEngine->tables();
+        info.concat("v");
+        info.concat(String(modelPredict[0].modelVersion));
+        info.concat(" (LittleFS), ");
+        info.concat(String(tables.treeCount));
+        info.concat(" cây, ");
+        info.concat(String(tables.nodeCount));
+        info.concat(" node");
+    } else {
+        info.concat("built-in, ");
+        info.concat(String(MODEL_TABLE_TREE_COUNT));
+        info.concat(" cây, ");
+        info.concat(String(MODEL_TABLE_NODE_COUNT));
+        info.concat(" node");
+    }
+    if (modelCache.hits + modelCache.misses > 0) {
+        info.concat("\nCache lá: ");
+        info.concat(String(modelCache.hits));
+        info.concat(" hit, ");
+        info.concat(String(modelCache.misses));
+        info.concat(" miss");
+    }
+    return info;
+}
+
+#if defined(MODEL_BENCHMARK)
+// So sánh các engine với mô hình nested-if gốc: kết quả, flash và số chu kỳ CPU
+void benchmarkModel() {
+    Serial.println("\n=== Benchmark mô hình ===");
+
+    Eloquent::ML::Port::XGBClassifier classifier;
+    // Cache riêng để không làm lệch thống kê của mô hình đang chạy
+    static ModelLeafCache benchCache;
+    benchCache = ModelLeafCache();
+    uint32_t nestedCycles = 0, unrolledCycles = 0, tableCycles = 0, fixedCycles = 0, quantizedCycles = 0, compactCycles = 0;
+    uint32_t regionCycles = 0, incrementalCycles = 0, explainCycles = 0;
+    uint32_t nestedMax = 0, unrolledMax = 0, tableMax = 0, fixedMax = 0, quantizedMax = 0, compactMax = 0;
+    uint32_t regionMax = 0, incrementalMax = 0, explainMax = 0;
+    uint32_t samples = 0, mismatches = 0, fixedFlips = 0, quantizedFlips = 0, compactFlips = 0;
+    uint32_t tableTrees = 0, quantizedTrees = 0;
+
+    for (int soil = 0; soil <= 1023; soil += 31) {
+        feedWatchdog();
+        for (int temp = 10; temp <= 45; temp += 5) {
+            for (int hum = 20; hum <= 100; hum += 10) {
+                float features[3] = { (float)soil, (float)temp, (float)hum };
+
+                uint32_t start = ESP.getCycleCount();
+                int nested = classifier.predict(features);
+                uint32_t nestedTime = ESP.getCycleCount() - start;
+
+                start = ESP.getCycleCount();
+                int unrolled = UnrolledModel::predict(features);
+                uint32_t unrolledTime = ESP.getCycleCount() - start;
+
+                start = ESP.getCycleCount();
+                int table = tableEngine.predict(features);
+                uint32_t tableTime = ESP.getCycleCount() - start;
+                // Dừng sớm không còn là đường mặc định: chỉ đếm số cây nó duyệt
+                uint16_t trees = 0;
+                int early = tableEngine.predictEarlyExit(features, &trees);
+                tableTrees += trees;
+
+                // Soil, nhiệt độ, độ ẩm đều nguyên: đổi sang Q20 không qua float
+                int32_t fixedFeatures[3] = { modelFixedInput(soil), modelFixedInput(temp), modelFixedInput(hum) };
+                start = ESP.getCycleCount();
+                int fixed = fixedEngine.predict(fixedFeatures);
+                uint32_t fixedTime = ESP.getCycleCount() - start;
+
+                start = ESP.getCycleCount();
+                int quantized = quantizedEngine.predict(features, &trees);
+                uint32_t quantizedTime = ESP.getCycleCount() - start;
+                quantizedTrees += trees;
+
+                start = ESP.getCycleCount();
+                int compact = compactEngine.predict(features);
+                uint32_t compactTime = ESP.getCycleCount() - start;
+
+                int region = -1;
+                start = ESP.getCycleCount();
+                modelRegions.lookup(features, region);
+                uint32_t regionTime = ESP.getCycleCount() - start;
+
+                start = ESP.getCycleCount();
+                int incremental = tableEngine.predictIncremental(features, benchCache);
+                uint32_t incrementalTime = ESP.getCycleCount() - start;
+
+                ModelExplanation explanation;
+                start = ESP.getCycleCount();
+                int explained = builtinExplainer.explain(features, explanation);
+                uint32_t explainTime = ESP.getCycleCount() - start;
+
+                nestedCycles += nestedTime;
+                unrolledCycles += unrolledTime;
+                tableCycles += tableTime;
+                fixedCycles += fixedTime;
+                quantizedCycles += quantizedTime;
+                compactCycles += compactTime;
+                regionCycles += regionTime;
+                incrementalCycles += incrementalTime;
+                explainCycles += explainTime;
+                nestedMax = max(nestedMax, nestedTime);
+                unrolledMax = max(unrolledMax, unrolledTime);
+                tableMax = max(tableMax, tableTime);
+                fixedMax = max(fixedMax, fixedTime);
+                quantizedMax = max(quantizedMax, quantizedTime);
+                compactMax = max(compactMax, compactTime);
+                regionMax = max(regionMax, regionTime);
+                incrementalMax = max(incrementalMax, incrementalTime);
+                explainMax = max(explainMax, explainTime);
+                if (nested != table || nested != early || nested != unrolled || nested != region || nested != incremental ||
+                    nested != explained) mismatches++;
+                if (nested != fixed) fixedFlips++;
+                if (nested != quantized) quantizedFlips++;
+                if (nested != compact) compactFlips++;
+                samples++;
+            }
+        }
+    }
+
+    Serial.printf("Số mẫu: %u, khác nhau: %u, lệch sát ngưỡng: fixed %u, quantized %u, compact %u\n",
+                  samples, mismatches, fixedFlips, quantizedFlips, compactFlips);
+    Serial.printf("%-10s %12s %12s %12s\n", "engine", "flash(B)", "avg cyc", "max cyc");
+    Serial.printf("%-10s %12s %12u %12u\n", "nested-if", "code", nestedCycles / samples, nestedMax);
+    Serial.printf("%-10s %12s %12u %12u\n", "unrolled", "code", unrolledCycles / samples, unrolledMax);
+    Serial.printf("%-10s %12u %12u %12u\n", "table", (unsigned)tableEngine.flashBytes(), tableCycles / samples, tableMax);
+    Serial.printf("%-10s %12u %12u %12u\n", "fixed", (unsigned)fixedEngine.flashBytes(), fixedCycles / samples, fixedMax);
+    Serial.printf("%-10s %12u %12u %12u\n", "quantized", (unsigned)quantizedEngine.flashBytes(), quantizedCycles / samples, quantizedMax);
+    Serial.printf("%-10s %12u %12u %12u\n", "compact", (unsigned)compactEngine.flashBytes(), compactCycles / samples, compactMax);
+    Serial.printf("%-10s %12u %12u %12u\n", "regions", (unsigned)modelRegions.flashBytes(), regionCycles / samples, regionMax);
+    Serial.printf("%-10s %12s %12u %12u\n", "incremental", "(RAM)", incrementalCycles / samples, incrementalMax);
+    Serial.printf("%-10s %12u %12u %12u\n", "explain", (unsigned)sizeof(MODEL_TABLE_EXPLAIN), explainCycles / samples, explainMax);
+    Serial.printf("Dừng sớm: table %.1f, quantized %.1f / %u cây mỗi lần\n",
+                  (float)tableTrees / samples, (float)quantizedTrees / samples, MODEL_TABLE_TREE_COUNT);
+    Serial.printf("Cache lá (quét lưới): %.1f%% hit\n",
+                  100.0f * benchCache.hits / (benchCache.hits + benchCache.misses));
+    if (loadedEngine != nullptr) {
+        Serial.printf("Đang dùng mô hình v%u từ LittleFS (%u bytes RAM)\n",
+                      (unsigned)modelPredict[0].modelVersion, (unsigned)loadedEngine->flashBytes());
+    }
+    Serial.println("========================");
+}
+#endif
@@ -0,0 +1,147 @@
+#include "model_image.h"
+#include <string.h>
+
+#ifndef ARDUINO
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(sizeof(ModelImageHeader) == 32, "header phải đúng 32 bytes như model_export.py");
+static_assert(sizeof(ModelNode) == 8, "node phải đúng 8 bytes như model_export.py");
+
+static size_t align4(size_t bytes) {
+    return (bytes + 3) & ~(size_t)3;
+}
+
+const char* modelImageStatusText(ModelImageStatus status) {
+    switch (status) {
+        case MODEL_IMAGE_OK: return "OK";
+        case MODEL_IMAGE_TOO_SMALL: return "file quá nhỏ";
+        case MODEL_IMAGE_BAD_MAGIC: return "sai magic";
+        case MODEL_IMAGE_BAD_VERSION: return "phiên bản định dạng không hỗ trợ";
+        case MODEL_IMAGE_BAD_SHAPE: return "số feature/lớp không khớp firmware";
+        case MODEL_IMAGE_BAD_SIZE: return "kích thước không khớp header";
+        case MODEL_IMAGE_BAD_CRC: return "sai CRC";
+        case MODEL_IMAGE_BAD_NODES: return "bảng node không hợp lệ";
+        case MODEL_IMAGE_IO_ERROR: return "lỗi đọc file";
+    }
+    return "?";
+}
+
+uint32_t modelImageCrc32(const uint8_t* data, size_t size, uint32_t crc) {
+    // CRC-32 chuẩn (đa thức 0xEDB88320), tính theo từng nửa byte với bảng 16 phần tử
+    static const uint32_t table[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+    };
+    crc = ~crc;
+    for (size_t i = 0; i < size; i++) {
+        crc = table[(crc ^ data[i]) & 0x0F] ^ (crc >> 4);
+        crc = table[(crc ^ (data[i] >> 4)) & 0x0F] ^ (crc >> 4);
+    }
+    return ~crc;
+}
+
+size_t modelImageSize(uint16_t treeCount, uint16_t nodeCount) {
+    return sizeof(ModelImageHeader)
+        + align4(treeCount * sizeof(uint16_t))
+        + align4(treeCount * sizeof(uint8_t))
+        + 2 * (treeCount + 1) * sizeof(float)
+        + nodeCount * sizeof(ModelNode);
+}
+
+ModelImageStatus parseModelImage(const uint8_t* data, size_t size, ModelTables& tables,
+                                 ModelImageHeader* header) {
+    if (size < sizeof(ModelImageHeader)) return MODEL_IMAGE_TOO_SMALL;
+
+    ModelImageHeader h;
+    memcpy(&h, data, sizeof(h));
+    if (h.magic != MODEL_IMAGE_MAGIC) return MODEL_IMAGE_BAD_MAGIC;
+    if (h.formatVersion != MODEL_IMAGE_FORMAT_VERSION) return MODEL_IMAGE_BAD_VERSION;
+    if (h.featureCount != MODEL_FEATURE_COUNT || h.classCount != MODEL_CLASS_COUNT) return MODEL_IMAGE_BAD_SHAPE;
+    if (h.treeCount == 0 || h.nodeCount == 0) return MODEL_IMAGE_BAD_SHAPE;
+    if (modelImageSize(h.treeCount, h.nodeCount) != size) return MODEL_IMAGE_BAD_SIZE;
+    if (h.payloadSize != size - sizeof(ModelImageHeader)) return MODEL_IMAGE_BAD_SIZE;
+
+    const uint8_t* payload = data + sizeof(ModelImageHeader);
+    if (modelImageCrc32(payload, h.payloadSize) != h.payloadCrc) return MODEL_IMAGE_BAD_CRC;
+
+    const uint8_t* p = payload;
+    const uint16_t* roots = reinterpret_cast<const uint16_t*>(p);
+    p += align4(h.treeCount * sizeof(uint16_t));
+    const uint8_t* classes = p;
+    p += align4(h.treeCount * sizeof(uint8_t));
+    const float* marginMin = reinterpret_cast<const float*>(p);
+    p += (h.treeCount + 1) * sizeof(float);
+    const float* marginMax = reinterpret_cast<const float*>(p);
+    p += (h.treeCount + 1) * sizeof(float);
+    const ModelNode* nodes = reinterpret_cast<const ModelNode*>(p);
+
+    for (uint16_t t = 0; t < h.treeCount; t++) {
+        if (roots[t] >= h.nodeCount || classes[t] >= MODEL_CLASS_COUNT) return MODEL_IMAGE_BAD_NODES;
+    }
+    // Con trái là i + 1, con phải phải nằm sau i: không có vòng lặp khi duyệt
+    for (uint16_t i = 0; i < h.nodeCount; i++) {
+        const ModelNode& node = nodes[i];
+        if (node.feature == MODEL_LEAF) continue;
+        if (node.feature >= MODEL_FEATURE_COUNT) return MODEL_IMAGE_BAD_NODES;
+        if (i + 1 >= h.nodeCount || node.right <= i + 1 || node.right >= h.nodeCount) return MODEL_IMAGE_BAD_NODES;
+    }
+
+    tables.nodes = nodes;
+    tables.treeRoots = roots;
+    tables.treeClass = classes;
+    tables.nodeCount = h.nodeCount;
+    tables.treeCount = h.treeCount;
+    tables.threshold = h.threshold;
+    tables.logitThreshold = h.logitThreshold;
+    tables.marginMin = marginMin;
+    tables.marginMax = marginMax;
+    if (header) *header = h;
+    return MODEL_IMAGE_OK;
+}
+
+#ifndef ARDUINO
+
+ModelImageFile::ModelImageFile() : data(nullptr), size(0), model(), info() {
+}
+
+ModelImageFile::~ModelImageFile() {
+    close();
+}
+
+ModelImageStatus ModelImageFile::open(const char* path) {
+    close();
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) return MODEL_IMAGE_IO_ERROR;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        ::close(fd);
+        return MODEL_IMAGE_IO_ERROR;
+    }
+    void* mapped = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) return MODEL_IMAGE_IO_ERROR;
+
+    ModelImageStatus status = parseModelImage(static_cast<const uint8_t*>(mapped), (size_t)st.st_size, model, &info);
+    if (status != MODEL_IMAGE_OK) {
+        munmap(mapped, (size_t)st.st_size);
+        return status;
+    }
+    data = mapped;
+    size = (size_t)st.st_size;
+    return MODEL_IMAGE_OK;
+}
+
+void ModelImageFile::close() {
+    if (data) {
+        munmap(data, size);
+        data = nullptr;
+        size = 0;
+    }
+    model = ModelTables();
+}
+
+#endif
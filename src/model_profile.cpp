@@ -0,0 +1,108 @@
+#include "model_profile.h"
+#include <math.h>
+#include <string.h>
+
+static uint16_t bucketIndex(uint32_t cycles) {
+    const uint32_t sub = 1u << MODEL_PROFILE_SUB_BITS;
+    if (cycles < sub) {
+        return (uint16_t)cycles;
+    }
+    uint32_t msb = 31 - __builtin_clz(cycles);
+    uint32_t fraction = (cycles >> (msb - MODEL_PROFILE_SUB_BITS)) & (sub - 1);
+    return (uint16_t)(((msb - MODEL_PROFILE_SUB_BITS + 1) << MODEL_PROFILE_SUB_BITS) + fraction);
+}
+
+static uint32_t bucketUpper(uint16_t index) {
+    const uint32_t sub = 1u << MODEL_PROFILE_SUB_BITS;
+    if (index < sub) {
+        return index;
+    }
+    uint32_t msb = (index >> MODEL_PROFILE_SUB_BITS) - 1 + MODEL_PROFILE_SUB_BITS;
+    uint32_t fraction = index & (sub - 1);
+    uint64_t lower = (uint64_t)(sub + fraction) << (msb - MODEL_PROFILE_SUB_BITS);
+    uint64_t upper = lower + (1ull << (msb - MODEL_PROFILE_SUB_BITS)) - 1;
+    return upper > UINT32_MAX ? UINT32_MAX : (uint32_t)upper;
+}
+
+CycleHistogram::CycleHistogram() {
+    reset();
+}
+
+void CycleHistogram::reset() {
+    memset(buckets, 0, sizeof(buckets));
+    samples = 0;
+    minCycles = UINT32_MAX;
+    maxCycles = 0;
+    total = 0;
+}
+
+void CycleHistogram::record(uint32_t cycles) {
+    buckets[bucketIndex(cycles)]++;
+    samples++;
+    total += cycles;
+    if (cycles < minCycles) minCycles = cycles;
+    if (cycles > maxCycles) maxCycles = cycles;
+}
+
+uint32_t CycleHistogram::percentile(float p) const {
+    if (samples == 0) {
+        return 0;
+    }
+    // Số mẫu cần gom đủ, làm tròn lên: p99 của 100 mẫu là mẫu thứ 99
+    uint32_t target = (uint32_t)(p * samples);
+    if ((float)target < p * samples) target++;
+    if (target == 0) target = 1;
+
+    uint32_t seen = 0;
+    for (uint16_t i = 0; i < MODEL_PROFILE_BUCKETS; i++) {
+        seen += buckets[i];
+        if (seen >= target) {
+            uint32_t upper = bucketUpper(i);
+            return upper < maxCycles ? upper : maxCycles;
+        }
+    }
+    return maxCycles;
+}
+
+ModelDomainSweep::ModelDomainSweep(const ModelTables& tables) : full(true) {
+    for (int f = 0; f < MODEL_FEATURE_COUNT; f++) {
+        cutCount[f] = 0;
+    }
+    // Chèn từng ngưỡng vào dãy tăng dần, bỏ trùng
+    for (uint16_t i = 0; i < tables.nodeCount; i++) {
+        const ModelNode& node = tables.nodes[i];
+        if (node.feature == MODEL_LEAF) continue;
+        float* c = cuts[node.feature];
+        uint16_t& n = cutCount[node.feature];
+        uint16_t pos = 0;
+        while (pos < n && c[pos] < node.value) pos++;
+        if (pos < n && c[pos] == node.value) continue;
+        if (n == MODEL_PROFILE_MAX_CUTS - 1) {
+            full = false;
+            continue;
+        }
+        memmove(c + pos + 1, c + pos, (n - pos) * sizeof(float));
+        c[pos] = node.value;
+        n++;
+    }
+    // Ô cuối: số float ngay sau ngưỡng lớn nhất (đi phải ở mọi split)
+    for (int f = 0; f < MODEL_FEATURE_COUNT; f++) {
+        cuts[f][cutCount[f]] = cutCount[f] ? nextafterf(cuts[f][cutCount[f] - 1], INFINITY) : 0.0f;
+        cutCount[f]++;
+    }
+}
+
+uint32_t ModelDomainSweep::cellCount() const {
+    uint32_t cells = 1;
+    for (int f = 0; f < MODEL_FEATURE_COUNT; f++) {
+        cells *= cutCount[f];
+    }
+    return cells;
+}
+
+void ModelDomainSweep::point(uint32_t index, float* x) const {
+    for (int f = MODEL_FEATURE_COUNT - 1; f >= 0; f--) {
+        x[f] = cuts[f][index % cutCount[f]];
+        index /= cutCount[f];
+    }
+}
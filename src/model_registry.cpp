@@ -0,0 +1,81 @@
+#include "model_registry.h"
+
+ModelRegistry::ModelRegistry() {
+    clear();
+}
+
+void ModelRegistry::clear() {
+    count = 0;
+    uniqueCount = 0;
+    offsets[0] = 0;
+}
+
+uint16_t ModelRegistry::totalTrees() const {
+    return offsets[count];
+}
+
+bool ModelRegistry::set(uint8_t id, const ModelTables& tables) {
+    if (id > count || id >= MODEL_REGISTRY_MAX_MODELS) {
+        return false;
+    }
+    uint32_t total = tables.treeCount;
+    for (uint8_t m = 0; m < count; m++) {
+        if (m != id) total += models[m].treeCount;
+    }
+    if (total > MODEL_REGISTRY_MAX_TREES) {
+        return false;
+    }
+    models[id] = tables;
+    if (id == count) count++;
+    rebuild();
+    return true;
+}
+
+void ModelRegistry::rebuild() {
+    // Chỉ chạy khi đổi mô hình: tìm tuyến tính là đủ (vài trăm cây)
+    uniqueCount = 0;
+    uint16_t slot = 0;
+    for (uint8_t m = 0; m < count; m++) {
+        offsets[m] = slot;
+        const ModelTables& model = models[m];
+        for (uint16_t t = 0; t < model.treeCount; t++) {
+            uint16_t u = 0;
+            while (u < uniqueCount && !(treeNodes[u] == model.nodes && treeRoots[u] == model.treeRoots[t])) u++;
+            if (u == uniqueCount) {
+                treeNodes[u] = model.nodes;
+                treeRoots[u] = model.treeRoots[t];
+                uniqueCount++;
+            }
+            slots[slot++] = u;
+        }
+    }
+    offsets[count] = slot;
+}
+
+void ModelRegistry::predictAll(const float* x, uint8_t* out) {
+    for (uint16_t u = 0; u < uniqueCount; u++) {
+        const ModelNode* nodes = treeNodes[u];
+        uint16_t i = treeRoots[u];
+        while (nodes[i].feature != MODEL_LEAF) {
+            i = (x[nodes[i].feature] <= nodes[i].value) ? i + 1 : nodes[i].right;
+        }
+        leaves[u] = nodes[i].value;
+    }
+    for (uint8_t m = 0; m < count; m++) {
+        const ModelTables& model = models[m];
+        float votes[MODEL_CLASS_COUNT] = { 0 };
+        // Cộng theo thứ tự cây của mô hình như TreeEnsemble::votes
+        for (uint16_t t = 0; t < model.treeCount; t++) {
+            votes[model.treeClass[t]] += leaves[slots[offsets[m] + t]];
+        }
+        out[m] = (uint8_t)TreeEnsemble(model).decide(votes);
+    }
+}
+
+int ModelRegistry::predict(uint8_t id, const float* x, uint16_t* treesEvaluated) const {
+    if (id >= count) {
+        if (treesEvaluated) *treesEvaluated = 0;
+        return 0;
+    }
+    return TreeEnsemble(models[id]).predict(x, treesEvaluated);
+}
@@ -0,0 +1,152 @@
+#include "rain_detector.h"
+#include "spsc_ring.h"
+#include <atomic>
+#include <string.h>
+
+#define RAIN_HOUR_MS 3600000ul
+
+// Ngắt timer ghi, loop đọc
+static SpscRing<RainEvent, RAIN_EVENT_RING_SIZE> rainEvents;
+static hw_timer_t* debounceTimer = nullptr;
+
+// Ngắt GPIO và ngắt timer cùng mức ưu tiên trên cùng core nên không chen nhau
+static volatile bool debouncing = false;
+static volatile uint32_t firstEdgeMs = 0;
+static volatile uint32_t edgeCount = 0;
+static std::atomic<bool> stableRaining{false};
+static std::atomic<bool> wetLatch{false};
+
+// Module mưa kéo chân xuống LOW khi ướt
+static bool IRAM_ATTR pinRaining() {
+    return digitalRead(RAIN_PIN) == LOW;
+}
+
+static void IRAM_ATTR onDebounceDone() {
+    debouncing = false;
+    bool raining = pinRaining();
+    if (raining == stableRaining.load(std::memory_order_relaxed)) {
+        return;     // chỉ là rung rồi về mức cũ
+    }
+    stableRaining.store(raining, std::memory_order_relaxed);
+    if (raining) {
+        wetLatch.store(true, std::memory_order_relaxed);
+    }
+    RainEvent event;
+    event.timeMs = firstEdgeMs;
+    event.raining = raining;
+    rainEvents.push(event);
+}
+
+static void IRAM_ATTR onRainEdge() {
+    edgeCount = edgeCount + 1;
+    if (!debouncing) {
+        debouncing = true;
+        firstEdgeMs = millis();
+    }
+    // Mỗi cạnh rung đẩy lùi thời điểm chốt mức
+    timerWrite(debounceTimer, 0);
+    timerAlarmEnable(debounceTimer);
+}
+
+void setupRainDetector() {
+    pinMode(RAIN_PIN, INPUT);
+    bool raining = pinRaining();
+    stableRaining.store(raining);
+    wetLatch.store(raining);
+
+    // Timer 1 MHz, báo một lần sau RAIN_DEBOUNCE_MS kể từ cạnh cuối
+    debounceTimer = timerBegin(RAIN_TIMER_NUM, 80, true);
+    timerAttachInterrupt(debounceTimer, onDebounceDone, true);
+    timerAlarmWrite(debounceTimer, RAIN_DEBOUNCE_MS * 1000ull, false);
+    attachInterrupt(digitalPinToInterrupt(RAIN_PIN), onRainEdge, CHANGE);
+}
+
+bool popRainEvent(RainEvent& event) {
+    return rainEvents.pop(event);
+}
+
+bool rainDetectorRaining() {
+    return stableRaining.load(std::memory_order_relaxed);
+}
+
+bool rainDetectorTakeWet() {
+    bool latched = wetLatch.exchange(false, std::memory_order_relaxed);
+    return latched || stableRaining.load(std::memory_order_relaxed);
+}
+
+uint32_t rainDetectorEdges() {
+    return edgeCount;
+}
+
+uint32_t rainDetectorDropped() {
+    return rainEvents.dropped();
+}
+
+WetTimeTracker::WetTimeTracker() {
+    reset();
+}
+
+void WetTimeTracker::reset() {
+    memset(hourly, 0, sizeof(hourly));
+    pos = 0;
+    hourStartMs = 0;
+    lastMs = 0;
+    raining = false;
+    started = false;
+}
+
+void WetTimeTracker::update(uint32_t nowMs, bool rainingNow) {
+    if (!started) {
+        started = true;
+        hourStartMs = nowMs;
+        lastMs = nowMs;
+        raining = rainingNow;
+        return;
+    }
+    // Sự kiện mang thời điểm cạnh đầu tiên nên có thể sớm hơn lần gọi trước vài ms
+    if ((int32_t)(nowMs - lastMs) < 0) {
+        nowMs = lastMs;
+    }
+    // Đóng các giờ đã qua; hiệu unsigned nên đúng cả khi millis tràn
+    uint32_t hours = (nowMs - hourStartMs) / RAIN_HOUR_MS;
+    if (hours >= RAIN_WET_HOURS) {
+        // Lâu không cập nhật: mọi giờ trong cửa sổ cùng một trạng thái
+        for (int i = 0; i < RAIN_WET_HOURS; i++) {
+            hourly[i] = raining ? RAIN_HOUR_MS : 0;
+        }
+        hourStartMs += hours * RAIN_HOUR_MS;
+        lastMs = hourStartMs;
+        hourly[pos] = 0;
+        hours = 0;
+    }
+    for (; hours > 0; hours--) {
+        uint32_t hourEnd = hourStartMs + RAIN_HOUR_MS;
+        if (raining) {
+            hourly[pos] += hourEnd - lastMs;
+        }
+        lastMs = hourEnd;
+        hourStartMs = hourEnd;
+        pos = (pos + 1) % RAIN_WET_HOURS;
+        hourly[pos] = 0;
+    }
+    if (raining) {
+        hourly[pos] += nowMs - lastMs;
+    }
+    lastMs = nowMs;
+    raining = rainingNow;
+}
+
+uint32_t WetTimeTracker::wetMs(uint8_t hoursAgo) const {
+    if (hoursAgo >= RAIN_WET_HOURS) {
+        return 0;
+    }
+    return hourly[(pos + RAIN_WET_HOURS - hoursAgo) % RAIN_WET_HOURS];
+}
+
+uint32_t WetTimeTracker::totalWetMs() const {
+    uint32_t total = 0;
+    for (int i = 0; i < RAIN_WET_HOURS; i++) {
+        total += hourly[i];
+    }
+    return total;
+}
@@ -0,0 +1,180 @@
+#include "sensor_fault.h"
+#include <string.h>
+
+static const char* const CHANNEL_NAMES[FAULT_CHANNEL_COUNT] = { "temperature", "humidity", "soil_moisture",
+                                                                "light_level" };
+static const char* const FAULT_NAMES[SENSOR_FAULT_KINDS] = { "range", "nan", "spike", "stuck", "flat" };
+
+static const FaultLimits CHANNEL_LIMITS[FAULT_CHANNEL_COUNT] = {
+    FAULT_LIMITS_TEMPERATURE, FAULT_LIMITS_HUMIDITY, FAULT_LIMITS_SOIL, FAULT_LIMITS_LIGHT
+};
+
+// Kênh mà mỗi đặc trưng (FeatureIndex) được tính từ, -1 = không kiểm tra
+static const int8_t FEATURE_CHANNELS[FEATURE_COUNT] = {
+    FAULT_SOIL, FAULT_TEMPERATURE, FAULT_HUMIDITY,
+    FAULT_SOIL, FAULT_SOIL, FAULT_TEMPERATURE, FAULT_TEMPERATURE,
+    FAULT_HUMIDITY, FAULT_LIGHT, -1
+};
+
+uint8_t featureFaultChannels(int featureCount) {
+    uint8_t channels = 0;
+    for (int f = 0; f < featureCount && f < FEATURE_COUNT; f++) {
+        if (FEATURE_CHANNELS[f] >= 0) channels |= 1 << FEATURE_CHANNELS[f];
+    }
+    return channels;
+}
+
+const char* faultChannelName(int index) {
+    return index >= 0 && index < FAULT_CHANNEL_COUNT ? CHANNEL_NAMES[index] : "?";
+}
+
+const char* sensorFaultName(int kind) {
+    return kind >= 0 && kind < SENSOR_FAULT_KINDS ? FAULT_NAMES[kind] : "?";
+}
+
+FaultDetector::FaultDetector(const FaultLimits& limits) : limit(limits) {
+    reset();
+}
+
+void FaultDetector::reset() {
+    faults = 0;
+    accepted = false;
+    total = 0;
+    memset(onsets, 0, sizeof(onsets));
+    nanRun = 0;
+    hasLast = false;
+    lastValue = NAN;
+    lastMs = 0;
+    sameSinceMs = 0;
+    spikeRun = 0;
+    candidate = NAN;
+    candidateMs = 0;
+    mean = NAN;
+    variance = 0.0f;
+    flatSinceMs = 0;
+}
+
+void FaultDetector::set(uint8_t bit, bool on) {
+    if (on && !(faults & bit)) {
+        onsets[__builtin_ctz(bit)]++;
+    }
+    faults = on ? (faults | bit) : (faults & ~bit);
+}
+
+uint8_t FaultDetector::update(uint32_t timeMs, float value) {
+    total++;
+    accepted = false;
+    if (isnan(value)) {
+        if (nanRun < FAULT_NAN_BURST) nanRun++;
+        set(SENSOR_FAULT_NAN, nanRun >= FAULT_NAN_BURST);
+        return faults;
+    }
+    nanRun = 0;
+    set(SENSOR_FAULT_NAN, false);
+
+    bool outside = value < limit.lo || value > limit.hi;
+    set(SENSOR_FAULT_RANGE, outside);
+    if (outside) {
+        return faults;
+    }
+
+    if (hasLast) {
+        float allowed = limit.maxStep + limit.maxRatePerMin * ((timeMs - lastMs) / 60000.0f);
+        if (fabsf(value - lastValue) > allowed) {
+            // Lệch khỏi mốc: xung, trừ khi mức mới giữ được FAULT_SPIKE_CONFIRM lần
+            float step = limit.maxStep + limit.maxRatePerMin * ((timeMs - candidateMs) / 60000.0f);
+            spikeRun = (spikeRun > 0 && fabsf(value - candidate) <= step) ? spikeRun + 1 : 1;
+            candidate = value;
+            candidateMs = timeMs;
+            if (spikeRun < FAULT_SPIKE_CONFIRM) {
+                set(SENSOR_FAULT_SPIKE, true);
+                return faults;
+            }
+        }
+    }
+    spikeRun = 0;
+    set(SENSOR_FAULT_SPIKE, false);
+
+    // Đứng yên: cùng đúng một giá trị, trừ giá trị nghỉ (đêm)
+    if (!hasLast || value != lastValue || value <= limit.quietFloor) {
+        sameSinceMs = timeMs;
+    }
+    set(SENSOR_FAULT_STUCK, limit.stuckMs > 0 && timeMs - sameSinceMs >= limit.stuckMs);
+
+    // Phẳng: phương sai trượt theo từng lần đọc
+    if (isnan(mean)) {
+        mean = value;
+        flatSinceMs = timeMs;
+    } else {
+        float delta = value - mean;
+        mean += FAULT_FLAT_ALPHA * delta;
+        variance = (1.0f - FAULT_FLAT_ALPHA) * (variance + FAULT_FLAT_ALPHA * delta * delta);
+    }
+    if (variance >= limit.flatVariance || value <= limit.quietFloor) {
+        flatSinceMs = timeMs;
+    }
+    set(SENSOR_FAULT_FLAT, limit.flatMs > 0 && timeMs - flatSinceMs >= limit.flatMs);
+
+    hasLast = true;
+    lastValue = value;
+    lastMs = timeMs;
+    accepted = true;
+    return faults;
+}
+
+SensorFaultMonitor::SensorFaultMonitor()
+    : detectors{ FaultDetector(CHANNEL_LIMITS[FAULT_TEMPERATURE]), FaultDetector(CHANNEL_LIMITS[FAULT_HUMIDITY]),
+                 FaultDetector(CHANNEL_LIMITS[FAULT_SOIL]), FaultDetector(CHANNEL_LIMITS[FAULT_LIGHT]) } {
+}
+
+void SensorFaultMonitor::reset() {
+    for (int c = 0; c < FAULT_CHANNEL_COUNT; c++) {
+        detectors[c].reset();
+    }
+}
+
+void SensorFaultMonitor::update(const SensorSample& sample) {
+    uint32_t t = sample.timeMs;
+    if (sample.fresh & (1 << SENSOR_CHANNEL_DHT)) {
+        detectors[FAULT_TEMPERATURE].update(t, sample.temperature);
+        detectors[FAULT_HUMIDITY].update(t, sample.humidity);
+    }
+    if (sample.fresh & (1 << SENSOR_CHANNEL_SOIL)) {
+        detectors[FAULT_SOIL].update(t, sample.soilMoisture < 0 ? NAN : (float)sample.soilMoisture);
+    }
+    if (sample.fresh & (1 << SENSOR_CHANNEL_LIGHT)) {
+        detectors[FAULT_LIGHT].update(t, sample.lightLevel < 0 ? NAN : sample.lightLevel);
+    }
+}
+
+uint8_t SensorFaultMonitor::faultyChannels() const {
+    uint8_t channels = 0;
+    for (int c = 0; c < FAULT_CHANNEL_COUNT; c++) {
+        if (detectors[c].mask() != 0) channels |= 1 << c;
+    }
+    return channels;
+}
+
+uint8_t SensorFaultMonitor::persistentFaultChannels() const {
+    uint8_t channels = 0;
+    for (int c = 0; c < FAULT_CHANNEL_COUNT; c++) {
+        if (detectors[c].mask() & SENSOR_FAULT_PERSISTENT) channels |= 1 << c;
+    }
+    return channels;
+}
+
+void SensorFaultMonitor::exclude(FeatureSample& sample) const {
+    if (!detectors[FAULT_TEMPERATURE].usable()) sample.temperature = NAN;
+    if (!detectors[FAULT_HUMIDITY].usable()) sample.humidity = NAN;
+    if (!detectors[FAULT_SOIL].usable()) sample.soil = NAN;
+    if (!detectors[FAULT_LIGHT].usable()) sample.light = -1.0f;
+}
+
+void SensorFaultMonitor::exclude(float* features) const {
+    uint8_t faulty = faultyChannels();
+    for (int f = 0; f < FEATURE_COUNT; f++) {
+        if (FEATURE_CHANNELS[f] >= 0 && (faulty & (1 << FEATURE_CHANNELS[f]))) {
+            features[f] = NAN;
+        }
+    }
+}
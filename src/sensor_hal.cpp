@@ -0,0 +1,44 @@
+#include "sensor_hal.h"
+#include <math.h>
+#include <string.h>
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+static bool clockMocked = false;
+static uint32_t mockMs = 0;
+
+uint32_t halMillis() {
+#if defined(ARDUINO)
+    if (!clockMocked) {
+        return millis();
+    }
+#endif
+    return mockMs;
+}
+
+void halMockClock(uint32_t nowMs) {
+    clockMocked = true;
+    mockMs = nowMs;
+}
+
+void halAdvanceClock(uint32_t deltaMs) {
+    halMockClock(halMillis() + deltaMs);
+}
+
+void sensorSampleInvalid(SensorSample& sample) {
+    memset(&sample, 0, sizeof(sample));
+    sample.temperature = NAN;
+    sample.humidity = NAN;
+    sample.soilMoisture = -1;
+    sample.soilNoise = NAN;
+    sample.lightLevel = -1;
+}
+
+void sensorSampleFeatures(const SensorSample& sample, FeatureSample& out) {
+    out.soil = static_cast<float>(sample.soilMoisture);
+    out.temperature = sample.temperature;
+    out.humidity = sample.humidity;
+    out.light = sample.lightLevel;
+    out.raining = sample.rainDetected;
+}
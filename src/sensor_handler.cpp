@@ -1,105 +1,441 @@
 #include "config.h"
 #include "sensor_handler.h"
+#include "spsc_ring.h"
+#include "soil_sampler.h"
+#include "rain_detector.h"
+#include "sensor_scheduler.h"
+#include "sensor_hw.h"
+#include "sensor_sim.h"
+#include "sensor_summary.h"
+#include "sensor_fault.h"
+#include "model_profile.h"
+#include <atomic>
+
+FeatureStore featureStore;
+
+// Task cảm biến ghi, loop đọc
+static SpscRing<SensorSample, SENSOR_RING_SIZE> sensorRing;
+static TaskHandle_t sensorTaskHandle = nullptr;
+
+// Chỉ loop ghi (lúc lấy mẫu ra khỏi ring)
+static CycleHistogram samplingJitter;   // us
+static CycleHistogram readTime;         // us
+static CycleHistogram deliveryDelay;    // ms từ lúc đọc tới lúc loop lấy
+static CycleHistogram i2cTime;          // us chiếm bus mỗi lần đo ánh sáng
+static uint64_t i2cTotalUs = 0;
+static WetTimeTracker rainWetTime;
+static uint32_t intervals[SENSOR_CHANNEL_COUNT];    // bản sao từ mẫu cuối
+static uint32_t channelReads[SENSOR_CHANNEL_COUNT];
+static SensorSummary uploadSummary;     // các mẫu từ lần upload trước
+static SensorFaultMonitor faultMonitor;
+static uint8_t reportedFaults[FAULT_CHANNEL_COUNT];    // mask đã in ra Serial
+
+static const char* const CHANNEL_NAMES[SENSOR_CHANNEL_COUNT] = { "dht", "soil", "light" };
+static const char* const SENSOR_ERROR_NAMES[SENSOR_CHANNEL_COUNT] = { "DHT11", "cảm biến đất", "cảm biến ánh sáng" };
+static uint8_t reportedErrors = 0;      // kênh đang lỗi đã in ra Serial
+
+// Nguồn số đọc chọn bằng SENSOR_BACKEND. Chỉ task cảm biến đọc (sau setupSensors)
+static HardwareSensorBackend hardwareBackend;
+#if SENSOR_BACKEND == SENSOR_BACKEND_SIMULATED
+static SimulatedSensorBackend simulatedBackend(SENSOR_SIM_SEED);
+static SensorBackend* const backend = &simulatedBackend;
+#else
+static SensorBackend* const backend = &hardwareBackend;
+#endif
+static SensorScheduler scheduler;
+
+// Bit 0: bơm, bit 1: mái che. Loop ghi, task báo cho backend trước lần đọc kế tiếp
+static std::atomic<uint8_t> actuators{0};
+
+// Mưa của backend không có ngắt: lấy từ mẫu, loop so với sensorData.rainDetected
+static bool polledRain = false;
+static uint32_t polledRainMs = 0;
+
+// Chạy trên core SENSOR_TASK_CORE. Cảm biến chỉ được dùng ở đây sau setupSensors
+static void sensorTask(void* param) {
+    const TickType_t period = pdMS_TO_TICKS(SENSOR_TICK_MS);
+    TickType_t lastWake = xTaskGetTickCount();
+    uint32_t scheduledUs = micros();
+    uint8_t actuated = 0;
+    for (;;) {
+        uint32_t startUs = micros();
+        uint8_t state = actuators.load(std::memory_order_relaxed);
+        if (state != actuated) {
+            actuated = state;
+            backend->actuate(halMillis(), state & 1, state & 2);
+        }
+        SensorSample sample;
+        if (scheduler.poll(halMillis(), *backend, sample)) {
+            // Lịch tính từ lần đầu nên trễ không cộng dồn; sớm hay muộn đều là jitter
+            int32_t lateness = (int32_t)(startUs - scheduledUs);
+            sample.latenessUs = lateness < 0 ? -lateness : lateness;
+            sample.readUs = micros() - startUs;
+            sample.i2cUs = backend->takeBusUs();
+            sensorRing.push(sample);
+        }
+
+        // Đọc quá nhịp thì vTaskDelayUntil trả về ngay để đuổi kịp lịch
+        vTaskDelayUntil(&lastWake, period);
+        scheduledUs += SENSOR_TICK_MS * 1000u;
+    }
+}
 
 void setupSensors() {
     Serial.print("Khởi tạo cảm biến... ");
     
-    // Setup DHT11
-    dht.begin();
-    delay(1000);
-    
-    // Setup BH1750
-    Wire.begin();
-    lightMeter.begin();
-    
     // Setup pins
-    pinMode(SOIL_PIN, INPUT);
-    pinMode(RAIN_PIN, INPUT);
     pinMode(PUMP_PIN, OUTPUT);
     pinMode(CANOPY_PIN, OUTPUT);
     
     // Initialize outputs
     digitalWrite(PUMP_PIN, PUMP_OFF);
     digitalWrite(CANOPY_PIN, CANOPY_OFF);
-    
-    // Test sensors
-    float temp = dht.readTemperature();
-    float hum = dht.readHumidity();
-    float light = lightMeter.readLightLevel();
-    
-    if (isnan(temp) || isnan(hum)) {
-        Serial.println("Lỗi DHT11!");
-        sensorData.error = true;
-        return;
+
+    zoneState.reset();
+    bool ok = backend->begin();
+    if (backend->rainInterrupt()) {
+        sensorData.rainDetected = rainDetectorRaining();
     }
-    
-    if (light < 0) {
-        Serial.println("Lỗi BH1750!");
+    rainWetTime.update(halMillis(), sensorData.rainDetected);
+    if (!ok) {
         sensorData.error = true;
         return;
     }
     
     sensorData.initialized = true;
-    Serial.println("Thành công!");
+    Serial.printf("Thành công! (%s)\n", backend->name());
+
+    // Sau điểm này chỉ task cảm biến dùng cảm biến
+    if (xTaskCreatePinnedToCore(sensorTask, "sensors", SENSOR_TASK_STACK, nullptr, SENSOR_TASK_PRIORITY,
+                                &sensorTaskHandle, SENSOR_TASK_CORE) != pdPASS) {
+        Serial.println("Không tạo được task cảm biến!");
+        sensorData.error = true;
+    }
+}
+
+void sensorActuate(bool pump, bool canopy) {
+    actuators.store((pump ? 1 : 0) | (canopy ? 2 : 0), std::memory_order_relaxed);
+}
+
+static void applySample(const SensorSample& sample) {
+    sensorData.temperature = sample.temperature;
+    sensorData.humidity = sample.humidity;
+    sensorData.soilMoisture = sample.soilMoisture;
+    sensorData.soilNoise = sample.soilNoise;
+    sensorData.lightLevel = sample.lightLevel;
+    sensorData.lastRead = sample.timeMs;
+
+    // Mẫu đến mỗi nhịp 1 s: chỉ in khi một cảm biến bắt đầu lỗi và khi hết lỗi
+    uint8_t errors = 0;
+    if (isnan(sample.temperature) || isnan(sample.humidity)) errors |= 1 << SENSOR_CHANNEL_DHT;
+    if (sample.soilMoisture < 0 || sample.soilMoisture > 1023) errors |= 1 << SENSOR_CHANNEL_SOIL;
+    if (sample.lightLevel < 0) errors |= 1 << SENSOR_CHANNEL_LIGHT;
+    for (int c = 0; c < SENSOR_CHANNEL_COUNT; c++) {
+        uint8_t bit = 1 << c;
+        if ((errors ^ reportedErrors) & bit) {
+            Serial.printf(errors & bit ? "Lỗi %s!\n" : "%s hết lỗi\n", SENSOR_ERROR_NAMES[c]);
+        }
+    }
+    reportedErrors = errors;
+    sensorData.error = errors != 0;
+    // Vùng 0 là đầu dò của SensorData (kênh 0 của mux khi có nhiều vùng)
+    if ((sample.fresh & (1 << SENSOR_CHANNEL_SOIL)) && sample.soilMoisture >= 0 && sample.soilMoisture <= 1023) {
+        zoneState.setSoil(0, (int16_t)sample.soilMoisture, sample.soilNoise, sample.timeMs);
+    }
+
+    samplingJitter.record(sample.latenessUs);
+    readTime.record(sample.readUs);
+    deliveryDelay.record(halMillis() - sample.timeMs);
+    if (sample.fresh & (1 << SENSOR_CHANNEL_LIGHT)) {
+        i2cTime.record(sample.i2cUs);
+    }
+    i2cTotalUs += sample.i2cUs;
+    for (int c = 0; c < SENSOR_CHANNEL_COUNT; c++) {
+        intervals[c] = sample.intervalMs[c];
+        if (sample.fresh & (1 << c)) channelReads[c]++;
+    }
+
+    if (!backend->rainInterrupt()) {
+        polledRain = sample.rainDetected;
+        polledRainMs = sample.timeMs;
+    }
+
+    uploadSummary.add(sample);
+
+    // Kênh lỗi không vào cửa sổ đặc trưng
+    faultMonitor.update(sample);
+    for (int c = 0; c < FAULT_CHANNEL_COUNT; c++) {
+        uint8_t mask = faultMonitor.mask(c);
+        if (mask != reportedFaults[c]) {
+            reportedFaults[c] = mask;
+            Serial.printf("Cảm biến %s: lỗi 0x%02x\n", faultChannelName(c), mask);
+        }
+    }
+    FeatureSample features;
+    sensorSampleFeatures(sample, features);
+    faultMonitor.exclude(features);
+    featureStore.add(sample.timeMs, features);
+
+#ifdef SENSOR_TRACE_SERIAL
+    // Dòng CSV cho TraceReplayBackend (tools/sensor_replay); dòng log khác bị bỏ qua
+    SensorTraceRecord record;
+    char line[160];
+    sensorTraceRecord(sample, weatherData.initialized, weatherData.rainNext1h, record);
+    sensorTraceCsv(record, line, sizeof(line));
+    Serial.println(line);
+#endif
+}
+
+static void applyRainEvent(const RainEvent& event) {
+    rainWetTime.update(event.timeMs, event.raining);
+    sensorData.rainDetected = event.raining;
+    Serial.printf("🌧️ %s (cạnh đầu %lu ms trước)\n", event.raining ? "Bắt đầu mưa" : "Tạnh mưa",
+                  (unsigned long)(halMillis() - event.timeMs));
+}
+
+bool handleRainEvents() {
+    bool changed = false;
+    RainEvent event;
+    if (backend->rainInterrupt()) {
+        while (popRainEvent(event)) {
+            applyRainEvent(event);
+            changed = true;
+        }
+    } else if (polledRain != sensorData.rainDetected) {
+        // Backend không có ngắt: đổi trạng thái theo mẫu, thời điểm là lúc đọc
+        event.timeMs = polledRainMs;
+        event.raining = polledRain;
+        applyRainEvent(event);
+        changed = true;
+    }
+    rainWetTime.update(halMillis(), sensorData.rainDetected);
+    return changed;
+}
+
+void setSensorSummaryJson(FirebaseJson& json) {
+    uint32_t nowMs = halMillis();
+    json.set("window_s", (int)((nowMs - uploadSummary.startMs()) / 1000));
+    for (int i = 0; i < SUMMARY_CHANNEL_COUNT; i++) {
+        const RunningStats& stats = uploadSummary.channel(i);
+        FirebaseJson channel;
+        channel.set("n", (int)stats.count());
+        if (i == SUMMARY_RAIN) {
+            // Tỉ lệ thời gian mưa (theo thời gian, không theo số mẫu) thay cho mean
+            if (stats.count() > 0) {
+                channel.set("wet_fraction", uploadSummary.rainFraction());
+                channel.set("changed_s", (int)((nowMs - stats.lastChangeMs()) / 1000));
+            }
+            json.set(summaryChannelName(i), channel);
+            continue;
+        }
+        if (stats.count() > 0) {
+            channel.set("mean", stats.mean());
+            channel.set("min", stats.min());
+            channel.set("max", stats.max());
+            channel.set("changed_s", (int)((nowMs - stats.lastChangeMs()) / 1000));   // giây trước
+        }
+        if (stats.count() > 1) {
+            channel.set("sd", stats.stddev());
+        }
+        if (stats.errors() > 0) {
+            channel.set("errors", (int)stats.errors());
+        }
+        json.set(summaryChannelName(i), channel);
+    }
+}
+
+const SensorFaultMonitor& sensorFaults() {
+    return faultMonitor;
+}
+
+int sensorFeatureVector(float* out) {
+    featureStore.vector(out);
+    faultMonitor.exclude(out);
+    int valid = 0;
+    for (int i = 0; i < FEATURE_COUNT; i++) {
+        if (!isnan(out[i])) valid++;
+    }
+    return valid;
+}
+
+void setSensorFaultJson(FirebaseJson& json) {
+    for (int c = 0; c < FAULT_CHANNEL_COUNT; c++) {
+        const FaultDetector& detector = faultMonitor.channel(c);
+        FirebaseJson channel;
+        channel.set("mask", (int)detector.mask());
+        channel.set("samples", (int)detector.samples());
+        for (int k = 0; k < SENSOR_FAULT_KINDS; k++) {
+            channel.set(sensorFaultName(k), (int)detector.count(k));
+        }
+        json.set(faultChannelName(c), channel);
+    }
+}
+
+void resetSensorSummary() {
+    uploadSummary.reset(halMillis());
+}
+
+void setRainJson(FirebaseJson& json) {
+    json.set("raining", sensorData.rainDetected);
+    json.set("wet_minutes_hour", rainWetTime.wetMs(0) / 60000.0f);
+    json.set("wet_minutes_24h", rainWetTime.totalWetMs() / 60000.0f);
+    FirebaseJsonArray hourly;
+    for (int h = 0; h < RAIN_WET_HOURS; h++) {
+        hourly.add(rainWetTime.wetMs(h) / 60000.0f);
+    }
+    json.set("wet_minutes_hourly", hourly);   // [0] = giờ hiện tại
+    json.set("edges", (int)rainDetectorEdges());
+    json.set("dropped", (int)rainDetectorDropped());
 }
 
 void readSensors() {
-    unsigned long currentTime = millis();
-    
-    if (currentTime - sensorData.lastRead < SENSOR_READ_INTERVAL) {
-        return;
+    SensorSample sample;
+    while (sensorRing.pop(sample)) {
+        applySample(sample);
     }
-    sensorData.lastRead = currentTime;
-    
-    if (!sensorData.initialized) {
-        return;
+#if MODEL_ZONE_COUNT > 1
+    // Kết quả quét mux: vùng 0 đã đi theo mẫu ở trên
+    ZoneReading reading;
+    while (popZoneReading(reading)) {
+        if (reading.zone == 0) continue;
+        zoneState.setSoil(reading.zone, soilMoistureFromRaw(reading.raw), soilNoiseFromRaw(reading.noise), halMillis());
     }
-    
-    readDHT11();
-    readSoilMoisture();
-    readRainSensor();
-    readLightSensor();
+    setZoneScanPriority(zoneState.valveOpen);
+#endif
 }
 
-void readDHT11() {
-    sensorData.temperature = dht.readTemperature();
-    sensorData.humidity = dht.readHumidity();
-    
-    if (isnan(sensorData.temperature) || isnan(sensorData.humidity)) {
-        Serial.println("Lỗi DHT11!");
-        sensorData.error = true;
-        return;
+void printFeatures() {
+    float features[FEATURE_COUNT];
+    int valid = sensorFeatureVector(features);
+    Serial.printf("\n=== Đặc trưng (bố cục v%d, %d/%d hợp lệ) ===\n", FEATURE_LAYOUT_VERSION, valid, FEATURE_COUNT);
+    for (int i = 0; i < FEATURE_COUNT; i++) {
+        Serial.printf("%-26s %10.2f\n", featureName(i), features[i]);
     }
-    
-    sensorData.error = false;
+    Serial.printf("Cửa sổ 1 giờ: %u/%u phút\n", featureStore.windowSamples(), (unsigned)FEATURE_WINDOW_SLOTS);
+    Serial.printf("Ánh sáng tính từ: %s, %lu phút trước\n", featureStore.sunriseSeen() ? "mặt trời mọc" : "lúc khởi động",
+                  (unsigned long)(featureStore.sinceSunriseMs(millis()) / 60000));
+    Serial.printf("RAM feature store: %u / %u bytes\n", (unsigned)sizeof(FeatureStore), (unsigned)FEATURE_STORE_MAX_BYTES);
+    Serial.println("=============================");
+}
+
+// Tỉ lệ thời gian bus I2C bận từ lúc khởi động
+static float i2cBusyPercent() {
+    uint32_t uptimeMs = millis();
+    return uptimeMs ? (float)(i2cTotalUs / 10.0 / uptimeMs) : 0.0f;
 }
 
-void readSoilMoisture() {
-    // Quy từ thang 12-bit về 10-bit
-    sensorData.soilMoisture = map(analogRead(SOIL_PIN), 4095, 0, 0, 1023); // map(x, in_min, in_max, out_min, out_max)
+static void printHistogram(const char* name, const CycleHistogram& h) {
+    Serial.printf("%-12s %8u %8u %8u %8u %8u\n", name, h.count(), h.min(), h.mean(), h.percentile(0.99f), h.max());
+}
 
-    if (sensorData.soilMoisture < 0 || sensorData.soilMoisture > 1023) {
-        Serial.println("Lỗi cảm biến đất!");
-        sensorData.error = true;
+void printSensorTiming() {
+    Serial.println("\n=== Lấy mẫu cảm biến ===");
+    if (sensorTaskHandle == nullptr) {
+        Serial.println("Task cảm biến chưa chạy");
         return;
     }
-    
-    sensorData.error = false;
+    Serial.printf("Nhịp %u ms trên core %d, ring %u/%u, bỏ %u mẫu, stack còn %u bytes\n",
+                  (unsigned)SENSOR_TICK_MS, SENSOR_TASK_CORE, sensorRing.size(), (unsigned)SENSOR_RING_SIZE,
+                  sensorRing.dropped(), (unsigned)uxTaskGetStackHighWaterMark(sensorTaskHandle));
+    Serial.printf("%-12s %8s %8s %8s %8s %8s\n", "", "count", "min", "mean", "p99", "max");
+    printHistogram("jitter us", samplingJitter);
+    printHistogram("đọc us", readTime);
+    printHistogram("tới loop ms", deliveryDelay);
+    printHistogram("I2C us", i2cTime);
+    Serial.printf("%-12s %10s %10s %8s\n", "kênh", "chu kỳ ms", "lần/phút", "số lần");
+    for (int c = 0; c < SENSOR_CHANNEL_COUNT; c++) {
+        Serial.printf("%-12s %10u %10.2f %8u\n", CHANNEL_NAMES[c], intervals[c],
+                      intervals[c] ? 60000.0f / intervals[c] : 0.0f, channelReads[c]);
+    }
+    if (backend == &hardwareBackend) {
+        const LightSensor& lightSensor = hardwareBackend.lightSensor();
+        Serial.printf("BH1750: dải %u (MTreg %u, tới %.0f lux), đổi dải %u lần, bus I2C bận %.3f%%\n",
+                      lightSensor.range(), lightSensor.mtreg(), lightSensor.fullScaleLux(),
+                      lightSensor.rangeSwitches(), i2cBusyPercent());
+    } else {
+        Serial.printf("Nguồn số đọc: %s\n", backend->name());
+    }
+    if (soilSamplerRunning()) {
+        Serial.printf("Đất (ADC DMA %u Hz): %u mẫu, tràn DMA %u lần, nhiễu %.2f\n", (unsigned)SOIL_ADC_SAMPLE_HZ,
+                      soilSamplerSamples(), soilSamplerOverflows(), sensorData.soilNoise);
+    } else {
+        Serial.println("Đất: analogRead (ADC DMA không chạy)");
+    }
+    Serial.printf("%-14s %5s", "lỗi", "mask");
+    for (int k = 0; k < SENSOR_FAULT_KINDS; k++) {
+        Serial.printf(" %6s", sensorFaultName(k));
+    }
+    Serial.println();
+    for (int c = 0; c < FAULT_CHANNEL_COUNT; c++) {
+        const FaultDetector& detector = faultMonitor.channel(c);
+        Serial.printf("%-14s  0x%02x", faultChannelName(c), detector.mask());
+        for (int k = 0; k < SENSOR_FAULT_KINDS; k++) {
+            Serial.printf(" %6u", detector.count(k));
+        }
+        Serial.println();
+    }
+#if MODEL_ZONE_COUNT > 1
+    ZoneScanStats scan;
+    if (readZoneScanStats(scan)) {
+        Serial.printf("Quét %d vùng: %u lượt, lượt cuối %.1f ms, lâu nhất %.1f ms, bỏ %u kết quả, RAM %u bytes\n",
+                      MODEL_ZONE_COUNT, scan.passes, scan.lastPassUs / 1000.0f, scan.maxPassUs / 1000.0f,
+                      zoneReadingsDropped(), (unsigned)sizeof(ZoneState));
+    }
+    for (int z = 0; z < MODEL_ZONE_COUNT; z++) {
+        Serial.printf("  vùng %2d: đất %4d (nhiễu %5.2f, %lu s trước), van %s\n", z, zoneState.soilMoisture[z],
+                      zoneState.soilNoise[z], (unsigned long)((millis() - zoneState.soilReadMs[z]) / 1000),
+                      zoneState.valve(z) ? "mở" : "đóng");
+    }
+#endif
+    Serial.println("=============================");
 }
 
-void readRainSensor() {
-    int tmp = !digitalRead(RAIN_PIN);
-    sensorData.rainDetected = tmp == 1 ? true : false;
+static void setHistogramJson(FirebaseJson& json, const char* key, const CycleHistogram& h) {
+    FirebaseJson stats;
+    stats.set("mean", (int)h.mean());
+    stats.set("p99", (int)h.percentile(0.99f));
+    stats.set("max", (int)h.max());
+    json.set(key, stats);
 }
 
-void readLightSensor() {
-    sensorData.lightLevel = lightMeter.readLightLevel();
-    
-    if (sensorData.lightLevel < 0) {
-        Serial.println("Lỗi cảm biến ánh sáng!");
-        sensorData.error = true;
-        return;
+void setSensorTimingJson(FirebaseJson& json) {
+    json.set("tick_ms", SENSOR_TICK_MS);
+    json.set("samples", (int)samplingJitter.count());
+    json.set("dropped", (int)sensorRing.dropped());
+    setHistogramJson(json, "jitter_us", samplingJitter);
+    setHistogramJson(json, "read_us", readTime);
+    setHistogramJson(json, "delivery_ms", deliveryDelay);
+    setHistogramJson(json, "i2c_us", i2cTime);
+    json.set("i2c_busy_pct", i2cBusyPercent());
+    json.set("backend", backend->name());
+    if (backend == &hardwareBackend) {
+        json.set("light_mtreg", (int)hardwareBackend.lightSensor().mtreg());
+        json.set("light_range_switches", (int)hardwareBackend.lightSensor().rangeSwitches());
     }
-    
-    sensorData.error = false;
+    FirebaseJson rates;
+    for (int c = 0; c < SENSOR_CHANNEL_COUNT; c++) {
+        FirebaseJson channel;
+        channel.set("interval_ms", (int)intervals[c]);
+        channel.set("per_min", intervals[c] ? 60000.0f / intervals[c] : 0.0f);
+        channel.set("reads", (int)channelReads[c]);
+        rates.set(CHANNEL_NAMES[c], channel);
+    }
+    json.set("rates", rates);
+    if (soilSamplerRunning()) {
+        json.set("soil_adc_samples", (int)soilSamplerSamples());
+        json.set("soil_adc_overflows", (int)soilSamplerOverflows());
+    }
+#if MODEL_ZONE_COUNT > 1
+    ZoneScanStats scan;
+    if (readZoneScanStats(scan)) {
+        FirebaseJson zones;
+        zones.set("count", MODEL_ZONE_COUNT);
+        zones.set("passes", (int)scan.passes);
+        zones.set("pass_ms", scan.lastPassUs / 1000.0f);
+        zones.set("max_pass_ms", scan.maxPassUs / 1000.0f);
+        zones.set("dropped", (int)zoneReadingsDropped());
+        zones.set("ram_bytes", (int)sizeof(ZoneState));
+        json.set("zone_scan", zones);
+    }
+#endif
 }
@@ -0,0 +1,99 @@
+#include "sensor_hw.h"
+#include "soil_sampler.h"
+#include "rain_detector.h"
+
+HardwareSensorBackend::HardwareSensorBackend() : light(lightMeter) {
+}
+
+bool HardwareSensorBackend::begin() {
+    // Setup DHT11
+    dht.begin();
+    delay(1000);
+
+    // Setup BH1750 (one-time, bắt đầu lần đo đầu tiên)
+    Wire.begin();
+    light.begin();
+
+    pinMode(SOIL_PIN, INPUT);
+    setupRainDetector();
+
+    // Đất đọc qua ADC DMA; lỗi thì quay về analogRead mỗi lần lấy mẫu
+    if (!startSoilSampler()) {
+        Serial.print("dùng analogRead cho đất... ");
+    }
+
+    // Test sensors
+    float temp = dht.readTemperature();
+    float hum = dht.readHumidity();
+    delay(light.remainingMs());
+    bool rangeRaised;
+    float lux = light.collect(rangeRaised);
+    light.takeBusUs();
+
+    if (isnan(temp) || isnan(hum)) {
+        Serial.println("Lỗi DHT11!");
+        return false;
+    }
+
+    if (lux < 0) {
+        Serial.println("Lỗi BH1750!");
+        return false;
+    }
+    return true;
+}
+
+void HardwareSensorBackend::readSoil(SensorSample& sample) {
+    if (soilSamplerRunning()) {
+        // Kết quả lọc mới nhất của ADC DMA, quy từ thang 12-bit về 10-bit như map()
+        SoilReading soil;
+        if (readSoilFiltered(soil)) {
+            sample.soilMoisture = soilMoistureFromRaw(soil.raw);
+            sample.soilNoise = soilNoiseFromRaw(soil.noise);
+        } else {
+            sample.soilMoisture = -1;   // chưa đủ một khối
+            sample.soilNoise = NAN;
+        }
+    } else {
+        // Quy từ thang 12-bit về 10-bit
+        sample.soilMoisture = map(analogRead(SOIL_PIN), 4095, 0, 0, 1023); // map(x, in_min, in_max, out_min, out_max)
+        sample.soilNoise = NAN;
+    }
+}
+
+// Nhường CPU tới khi BH1750 chuyển đổi xong rồi đọc. Nếu số đếm chạm trần thì dải
+// đã được nâng: đo lại ngay một lần thay vì báo giá trị bị cắt
+float HardwareSensorBackend::collectLight() {
+    for (int attempt = 0;; attempt++) {
+        uint32_t waitMs = light.remainingMs();
+        if (waitMs > 0) {
+            vTaskDelay(pdMS_TO_TICKS(waitMs) + 1);
+        }
+        bool rangeRaised;
+        float lux = light.collect(rangeRaised);
+        if (!rangeRaised || attempt > 0 || !light.trigger()) {
+            return lux;
+        }
+    }
+}
+
+// BH1750 được kích trước để chuyển đổi song song với DHT11 và đất
+void HardwareSensorBackend::read(SensorSample& sample, uint8_t due) {
+    bool lightStarted = false;
+    if (due & (1 << SENSOR_CHANNEL_LIGHT)) {
+        lightStarted = light.trigger();
+        if (!lightStarted) {
+            sample.lightLevel = -1;
+        }
+    }
+    if (due & (1 << SENSOR_CHANNEL_DHT)) {
+        sample.temperature = dht.readTemperature();
+        sample.humidity = dht.readHumidity();
+    }
+    if (due & (1 << SENSOR_CHANNEL_SOIL)) {
+        readSoil(sample);
+    }
+    sample.rainDetected = rainDetectorTakeWet();
+    if (lightStarted) {
+        sample.lightLevel = collectLight();
+    }
+}
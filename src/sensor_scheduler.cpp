@@ -0,0 +1,56 @@
+#include "sensor_scheduler.h"
+#include <math.h>
+
+// Độ thay đổi chuẩn hóa của kênh so với lần đọc trước (1 = một deadband)
+static float channelChange(int channel, const SensorSample& now, const SensorSample& last) {
+    switch (channel) {
+        case SENSOR_CHANNEL_DHT:
+            return fmaxf(adaptiveChange(now.temperature, last.temperature, DHT_DEADBAND_TEMP),
+                         adaptiveChange(now.humidity, last.humidity, DHT_DEADBAND_HUMIDITY));
+        case SENSOR_CHANNEL_SOIL: {
+            if (now.soilMoisture < 0 || last.soilMoisture < 0) return INFINITY;
+            // Dao động trong nhiễu đo không tính là thay đổi
+            float deadband = isnan(now.soilNoise) ? SOIL_DEADBAND : fmaxf(SOIL_DEADBAND, 2.0f * now.soilNoise);
+            return adaptiveChange(now.soilMoisture, last.soilMoisture, deadband);
+        }
+        case SENSOR_CHANNEL_LIGHT:
+            if (now.lightLevel < 0 || last.lightLevel < 0) return INFINITY;
+            return adaptiveChange(now.lightLevel, last.lightLevel,
+                                  fmaxf(LIGHT_DEADBAND_LUX, LIGHT_DEADBAND_RATIO * last.lightLevel));
+    }
+    return INFINITY;
+}
+
+SensorScheduler::SensorScheduler()
+    : schedules{ AdaptiveInterval(DHT_INTERVAL_MIN_MS, DHT_INTERVAL_MAX_MS),
+                 AdaptiveInterval(SOIL_INTERVAL_MIN_MS, SOIL_INTERVAL_MAX_MS),
+                 AdaptiveInterval(LIGHT_INTERVAL_MIN_MS, LIGHT_INTERVAL_MAX_MS) } {
+    sensorSampleInvalid(previous);
+}
+
+void SensorScheduler::reset() {
+    for (int c = 0; c < SENSOR_CHANNEL_COUNT; c++) {
+        schedules[c].reset();
+    }
+    sensorSampleInvalid(previous);
+}
+
+bool SensorScheduler::poll(uint32_t nowMs, SensorBackend& backend, SensorSample& out) {
+    uint8_t due = 0;
+    for (int c = 0; c < SENSOR_CHANNEL_COUNT; c++) {
+        if (schedules[c].due(nowMs)) due |= 1 << c;
+    }
+    if (!due) {
+        return false;
+    }
+    out = previous;
+    out.timeMs = nowMs;
+    backend.read(out, due);
+    for (int c = 0; c < SENSOR_CHANNEL_COUNT; c++) {
+        if (due & (1 << c)) schedules[c].update(nowMs, channelChange(c, out, previous));
+        out.intervalMs[c] = schedules[c].intervalMs();
+    }
+    out.fresh = due;
+    previous = out;
+    return true;
+}
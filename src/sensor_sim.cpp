@@ -0,0 +1,303 @@
+#include "sensor_sim.h"
+#include <math.h>
+#include <string.h>
+#include <stdlib.h>
+
+#define SIM_HOUR_MS 3600000ul
+#define SIM_SOIL_MIN 150.0f
+#define SIM_SOIL_MAX 900.0f
+#define SIM_SOIL_STEP_MS 60000ul        // bước tích phân độ ẩm đất
+#define SIM_PUMP_RATE 400.0f            // đơn vị đất mỗi giờ bơm chạy
+#define SIM_RAIN_SOAK 25.0f             // đơn vị đất mỗi mm mưa
+
+static const float SIM_PI = 3.14159265f;
+
+// Băm số nguyên (lowbias32): cùng seed và khóa cho cùng giá trị trên mọi nền tảng
+static uint32_t simHash(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x;
+}
+
+SimulatedSensorBackend::SimulatedSensorBackend(uint32_t seed)
+    : seed(seed), soil(600.0f), soilMs(0), pumpOn(false), started(false) {
+}
+
+float SimulatedSensorBackend::noise(uint32_t key, uint32_t salt) const {
+    uint32_t h = simHash(seed ^ simHash(key ^ simHash(salt)));
+    return (h >> 8) * (2.0f / 16777216.0f) - 1.0f;     // [-1, 1)
+}
+
+bool SimulatedSensorBackend::begin() {
+    soil = 600.0f;
+    pumpOn = false;
+    started = false;
+    return true;
+}
+
+float SimulatedSensorBackend::rainRate(uint32_t nowMs) const {
+    // Khoảng 30% số ngày có một cơn mưa 0.5-3 giờ, bắt đầu từ 4 giờ tới 20 giờ
+    uint32_t day = nowMs / SENSOR_SIM_DAY_MS;
+    if (noise(day, 3) <= 0.4f) {
+        return 0.0f;
+    }
+    float hour = (nowMs % SENSOR_SIM_DAY_MS) / (float)SIM_HOUR_MS;
+    float start = 12.0f + 8.0f * noise(day, 4);
+    float duration = 1.75f + 1.25f * noise(day, 5);
+    if (hour < start || hour >= start + duration) {
+        return 0.0f;
+    }
+    return 4.0f + 3.5f * noise(day, 6);
+}
+
+float SimulatedSensorBackend::temperatureAt(uint32_t nowMs) const {
+    // Thấp nhất lúc 3 giờ, cao nhất lúc 15 giờ, mỗi ngày lệch tối đa ±2 °C
+    uint32_t day = nowMs / SENSOR_SIM_DAY_MS;
+    float hour = (nowMs % SENSOR_SIM_DAY_MS) / (float)SIM_HOUR_MS;
+    float t = 26.0f + 2.0f * noise(day, 1) + 6.0f * sinf(2.0f * SIM_PI * (hour - 9.0f) / 24.0f);
+    return rainRate(nowMs) > 0.0f ? t - 3.0f : t;
+}
+
+float SimulatedSensorBackend::clearSkyLux(uint32_t nowMs) const {
+    float hour = (nowMs % SENSOR_SIM_DAY_MS) / (float)SIM_HOUR_MS;
+    if (hour <= 6.0f || hour >= 18.0f) {
+        return 0.0f;
+    }
+    return 90000.0f * sinf(SIM_PI * (hour - 6.0f) / 12.0f);
+}
+
+void SimulatedSensorBackend::advanceSoil(uint32_t nowMs) {
+    if (!started) {
+        started = true;
+        soilMs = nowMs;
+        return;
+    }
+    // Khô dần theo nhiệt và nắng, ướt lên theo mưa và bơm
+    while ((int32_t)(nowMs - soilMs) > 0) {
+        uint32_t step = nowMs - soilMs < SIM_SOIL_STEP_MS ? nowMs - soilMs : SIM_SOIL_STEP_MS;
+        float hours = step / (float)SIM_HOUR_MS;
+        float temp = temperatureAt(soilMs);
+        float dry = 4.0f + 0.6f * fmaxf(0.0f, temp - 20.0f) + clearSkyLux(soilMs) / 20000.0f;
+        float wet = SIM_RAIN_SOAK * rainRate(soilMs) + (pumpOn ? SIM_PUMP_RATE : 0.0f);
+        soil += (wet - dry) * hours;
+        soil = fminf(SIM_SOIL_MAX, fmaxf(SIM_SOIL_MIN, soil));
+        soilMs += step;
+    }
+}
+
+void SimulatedSensorBackend::read(SensorSample& sample, uint8_t due) {
+    uint32_t nowMs = sample.timeMs;
+    uint32_t second = nowMs / 1000;
+    advanceSoil(nowMs);
+    bool raining = rainRate(nowMs) > 0.0f;
+
+    if (due & (1 << SENSOR_CHANNEL_DHT)) {
+        // DHT11 hỏng khoảng 0.25% số lần đọc
+        if (noise(second, 9) > 0.995f) {
+            sample.temperature = NAN;
+            sample.humidity = NAN;
+        } else {
+            float temp = temperatureAt(nowMs) + 0.2f * noise(second, 10);
+            float hum = 60.0f - 2.5f * (temp - 26.0f) + (raining ? 25.0f : 0.0f) + 3.0f * noise(second, 7);
+            sample.temperature = roundf(temp * 10.0f) / 10.0f;
+            sample.humidity = roundf(fminf(99.0f, fmaxf(15.0f, hum)));
+        }
+    }
+    if (due & (1 << SENSOR_CHANNEL_SOIL)) {
+        sample.soilMoisture = (int)lroundf(soil + 2.0f * noise(second, 8));
+        sample.soilNoise = 1.5f;
+    }
+    if (due & (1 << SENSOR_CHANNEL_LIGHT)) {
+        // Mây đổi mỗi 10 phút, mưa còn 20%
+        float cloud = 0.55f + 0.45f * noise(nowMs / 600000, 2);
+        float lux = clearSkyLux(nowMs) * cloud * (raining ? 0.2f : 1.0f);
+        sample.lightLevel = roundf(lux * 1.2f) / 1.2f;      // bước 1 đếm của BH1750
+    }
+    sample.rainDetected = raining;
+}
+
+bool SimulatedSensorBackend::forecast(uint32_t nowMs, float& rainNext1h) {
+    // Tổng mưa của giờ tới, lấy mẫu mỗi 10 phút
+    float mm = 0.0f;
+    for (int i = 0; i < 6; i++) {
+        mm += rainRate(nowMs + i * 600000ul) / 6.0f;
+    }
+    rainNext1h = mm;
+    return true;
+}
+
+void SimulatedSensorBackend::actuate(uint32_t nowMs, bool pump, bool /*canopy*/) {
+    // Tích phân tới thời điểm đổi trạng thái trước khi đổi tốc độ ướt
+    advanceSoil(nowMs);
+    pumpOn = pump;
+}
+
+TraceReplayBackend::TraceReplayBackend()
+    : file(nullptr), binary(false), count(0), originMs(0), hasPending(false) {
+    memset(&current, 0, sizeof(current));
+    memset(&pending, 0, sizeof(pending));
+}
+
+TraceReplayBackend::~TraceReplayBackend() {
+    if (file != nullptr) {
+        fclose(file);
+    }
+}
+
+bool TraceReplayBackend::open(const char* path) {
+    file = fopen(path, "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    uint32_t magic = 0;
+    binary = fread(&magic, sizeof(magic), 1, file) == 1 && magic == SENSOR_TRACE_MAGIC;
+    if (!binary) {
+        rewind(file);
+    }
+    return true;
+}
+
+bool TraceReplayBackend::next(SensorTraceRecord& record) {
+    if (file == nullptr) {
+        return false;
+    }
+    if (binary) {
+        return fread(&record, sizeof(record), 1, file) == 1;
+    }
+    char line[160];
+    while (fgets(line, sizeof(line), file) != nullptr) {
+        if (line[0] < '0' || line[0] > '9') {
+            continue;
+        }
+        unsigned long timeMs;
+        int soil, rain;
+        float forecastMm;
+        int n = sscanf(line, "%lu,%f,%f,%d,%f,%d,%f", &timeMs, &record.temperature, &record.humidity, &soil,
+                       &record.lightLevel, &rain, &forecastMm);
+        if (n < 6) {
+            continue;
+        }
+        record.timeMs = (uint32_t)timeMs;
+        record.soilMoisture = (int16_t)soil;
+        record.rain = rain != 0;
+        record.hasForecast = n == 7;
+        record.rainNext1h = n == 7 ? forecastMm : 0.0f;
+        return true;
+    }
+    return false;
+}
+
+bool TraceReplayBackend::begin() {
+    count = 0;
+    if (!next(current)) {
+        return false;
+    }
+    count = 1;
+    originMs = current.timeMs;
+    hasPending = next(pending);
+    return true;
+}
+
+void TraceReplayBackend::seek(uint32_t nowMs) {
+    // Giữ bản ghi cuối cùng không muộn hơn nowMs (tính từ bản ghi đầu)
+    while (hasPending && pending.timeMs - originMs <= nowMs) {
+        current = pending;
+        count++;
+        hasPending = next(pending);
+    }
+}
+
+void TraceReplayBackend::read(SensorSample& sample, uint8_t due) {
+    seek(sample.timeMs);
+    if (due & (1 << SENSOR_CHANNEL_DHT)) {
+        sample.temperature = current.temperature;
+        sample.humidity = current.humidity;
+    }
+    if (due & (1 << SENSOR_CHANNEL_SOIL)) {
+        sample.soilMoisture = current.soilMoisture;
+        sample.soilNoise = NAN;
+    }
+    if (due & (1 << SENSOR_CHANNEL_LIGHT)) {
+        sample.lightLevel = current.lightLevel;
+    }
+    sample.rainDetected = current.rain != 0;
+}
+
+bool TraceReplayBackend::forecast(uint32_t nowMs, float& rainNext1h) {
+    seek(nowMs);
+    if (!current.hasForecast) {
+        return false;
+    }
+    rainNext1h = current.rainNext1h;
+    return true;
+}
+
+void sensorTraceRecord(const SensorSample& sample, bool hasForecast, float rainNext1h, SensorTraceRecord& out) {
+    memset(&out, 0, sizeof(out));
+    out.timeMs = sample.timeMs;
+    out.temperature = sample.temperature;
+    out.humidity = sample.humidity;
+    out.soilMoisture = (int16_t)sample.soilMoisture;
+    out.rain = sample.rainDetected;
+    out.hasForecast = hasForecast;
+    out.lightLevel = sample.lightLevel;
+    out.rainNext1h = hasForecast ? rainNext1h : 0.0f;
+}
+
+int sensorTraceCsv(const SensorTraceRecord& record, char* buf, size_t size) {
+    int n = snprintf(buf, size, "%lu,%.9g,%.9g,%d,%.9g,%d", (unsigned long)record.timeMs, record.temperature,
+                     record.humidity, record.soilMoisture, record.lightLevel, record.rain);
+    if (record.hasForecast && n >= 0 && (size_t)n < size) {
+        n += snprintf(buf + n, size - n, ",%.9g", record.rainNext1h);
+    }
+    return n;
+}
+
+SensorTraceWriter::SensorTraceWriter() : file(nullptr), binary(false) {
+}
+
+SensorTraceWriter::~SensorTraceWriter() {
+    close();
+}
+
+bool SensorTraceWriter::open(const char* path) {
+    size_t length = strlen(path);
+    binary = length >= 4 && strcmp(path + length - 4, ".bin") == 0;
+    file = fopen(path, binary ? "wb" : "w");
+    if (file == nullptr) {
+        return false;
+    }
+    if (binary) {
+        uint32_t magic = SENSOR_TRACE_MAGIC;
+        fwrite(&magic, sizeof(magic), 1, file);
+    } else {
+        fputs("time_ms,temperature,humidity,soil,light,rain,rain_next_1h\n", file);
+    }
+    return true;
+}
+
+void SensorTraceWriter::write(const SensorSample& sample, bool hasForecast, float rainNext1h) {
+    if (file == nullptr) {
+        return;
+    }
+    SensorTraceRecord record;
+    sensorTraceRecord(sample, hasForecast, rainNext1h, record);
+    if (binary) {
+        fwrite(&record, sizeof(record), 1, file);
+    } else {
+        char line[160];
+        sensorTraceCsv(record, line, sizeof(line));
+        fputs(line, file);
+        fputc('\n', file);
+    }
+}
+
+void SensorTraceWriter::close() {
+    if (file != nullptr) {
+        fclose(file);
+        file = nullptr;
+    }
+}
@@ -0,0 +1,106 @@
+#include "sensor_summary.h"
+#include <math.h>
+
+static const char* const SUMMARY_NAMES[SUMMARY_CHANNEL_COUNT] = { "temperature", "humidity", "soil_moisture",
+                                                                   "light_level", "rain" };
+
+const char* summaryChannelName(int index) {
+    return index >= 0 && index < SUMMARY_CHANNEL_COUNT ? SUMMARY_NAMES[index] : "?";
+}
+
+RunningStats::RunningStats() {
+    reset();
+}
+
+void RunningStats::reset() {
+    n = 0;
+    invalid = 0;
+    average = 0.0f;
+    m2 = 0.0f;
+    lo = INFINITY;
+    hi = -INFINITY;
+    latest = NAN;
+    changeMs = 0;
+}
+
+void RunningStats::add(uint32_t timeMs, float value) {
+    if (isnan(value)) {
+        invalid++;
+        return;
+    }
+    if (n == 0 || value != latest) {
+        changeMs = timeMs;
+    }
+    latest = value;
+    n++;
+    float delta = value - average;
+    average += delta / n;
+    m2 += delta * (value - average);
+    if (value < lo) lo = value;
+    if (value > hi) hi = value;
+}
+
+float RunningStats::mean() const {
+    return n > 0 ? average : NAN;
+}
+
+float RunningStats::variance() const {
+    return n > 1 ? m2 / (n - 1) : NAN;
+}
+
+float RunningStats::stddev() const {
+    return n > 1 ? sqrtf(m2 / (n - 1)) : NAN;
+}
+
+float RunningStats::min() const {
+    return n > 0 ? lo : NAN;
+}
+
+float RunningStats::max() const {
+    return n > 0 ? hi : NAN;
+}
+
+float RunningStats::last() const {
+    return latest;
+}
+
+SensorSummary::SensorSummary() {
+    reset(0);
+}
+
+void SensorSummary::add(const SensorSample& sample) {
+    uint32_t t = sample.timeMs;
+    if (sample.fresh & (1 << SENSOR_CHANNEL_DHT)) {
+        stats[SUMMARY_TEMPERATURE].add(t, sample.temperature);
+        stats[SUMMARY_HUMIDITY].add(t, sample.humidity);
+    }
+    if (sample.fresh & (1 << SENSOR_CHANNEL_SOIL)) {
+        stats[SUMMARY_SOIL].add(t, sample.soilMoisture < 0 ? NAN : (float)sample.soilMoisture);
+    }
+    if (sample.fresh & (1 << SENSOR_CHANNEL_LIGHT)) {
+        stats[SUMMARY_LIGHT].add(t, sample.lightLevel < 0 ? NAN : sample.lightLevel);
+    }
+    // Mưa có trong mọi mẫu; rainDetected phủ khoảng từ mẫu trước tới mẫu này
+    stats[SUMMARY_RAIN].add(t, sample.rainDetected ? 1.0f : 0.0f);
+    uint32_t span = t - rainSinceMs;
+    rainSpanMs += span;
+    if (sample.rainDetected) rainWetMs += span;
+    rainSinceMs = t;
+}
+
+float SensorSummary::rainFraction() const {
+    if (stats[SUMMARY_RAIN].count() == 0) return NAN;
+    // Mọi mẫu cùng thời điểm với đầu cửa sổ: chỉ còn trạng thái của mẫu cuối
+    if (rainSpanMs == 0) return stats[SUMMARY_RAIN].last();
+    return (float)rainWetMs / rainSpanMs;
+}
+
+void SensorSummary::reset(uint32_t startMs) {
+    for (int i = 0; i < SUMMARY_CHANNEL_COUNT; i++) {
+        stats[i].reset();
+    }
+    windowStartMs = startMs;
+    rainSinceMs = startMs;
+    rainWetMs = 0;
+    rainSpanMs = 0;
+}
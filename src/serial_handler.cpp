@@ -4,6 +4,8 @@
 #include "firebase_handler.h" 
 #include "wifi_handler.h"
 #include "auto_control.h"
+#include "model_handler.h"
+#include "sensor_handler.h"
 
 void handleSerialCommands(){
     
@@ -23,6 +25,13 @@ void handleSerialCommands(){
                 Serial.println("r - Kết nối Firebase");
                 Serial.println("z - Test cảm biến");
                 Serial.println("t - Dự báo thời tiết");
+#if defined(MODEL_BENCHMARK)
+                Serial.println("m - Benchmark mô hình");
+#endif
+                Serial.println("c - Thời gian suy luận (chu kỳ CPU)");
+                Serial.println("e - Quét WCET mô hình");
+                Serial.println("v - Vector đặc trưng (cửa sổ trượt)");
+                Serial.println("j - Jitter lấy mẫu cảm biến");
                 Serial.println("=======================");
                 break;
             
@@ -80,7 +89,7 @@ void handleSerialCommands(){
                 Serial.println("\n=== Kiểm tra cảm biến ===");
                 Serial.printf("Temperature: %.2f°C\n", sensorData.temperature);
                 Serial.printf("Humidity: %.2f%%\n", sensorData.humidity);
-                Serial.printf("Soil Moisture: %d\n", sensorData.soilMoisture);
+                Serial.printf("Soil Moisture: %d (nhiễu %.2f)\n", sensorData.soilMoisture, sensorData.soilNoise);
                 Serial.printf("Light: %.2f lux\n", sensorData.lightLevel);
                 Serial.printf("Rain: %s\n", sensorData.rainDetected ? "Detected" : "Not detected");
                 Serial.println("=======================");
@@ -117,8 +126,28 @@ void handleSerialCommands(){
                 }
                 Serial.println("========================");
                 break;
-                
-                
+
+#if defined(MODEL_BENCHMARK)
+            case 'm': // Model benchmark
+                benchmarkModel();
+                break;
+#endif
+
+            case 'c': // Model cycle profile
+                printModelProfile();
+                break;
+
+            case 'e': // Model WCET sweep
+                startModelWcetSweep();
+                break;
+
+            case 'v': // Feature vector
+                printFeatures();
+                break;
+
+            case 'j': // Sensor sampling jitter
+                printSensorTiming();
+                break;
         }
 
         // Clear any remaining characters
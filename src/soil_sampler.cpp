@@ -0,0 +1,225 @@
+#include "soil_sampler.h"
+#include "adc_filter.h"
+#include "spsc_ring.h"
+#include <driver/adc.h>
+#include <atomic>
+
+static const AdcCalibrationPoint SOIL_CALIBRATION_POINTS[] = SOIL_CALIBRATION;
+static const AdcCalibration soilCalibration(SOIL_CALIBRATION_POINTS,
+                                            sizeof(SOIL_CALIBRATION_POINTS) / sizeof(SOIL_CALIBRATION_POINTS[0]));
+
+static LatestValue<SoilReading> soilReading;
+static std::atomic<uint32_t> sampleCount{0};
+static std::atomic<uint32_t> overflowCount{0};
+static bool running = false;
+
+#if MODEL_ZONE_COUNT == 1
+// Chỉ task lọc dùng
+static RobustAdcFilter soilFilter;
+
+static void publish() {
+    SoilReading reading;
+    float raw = soilFilter.value();
+    reading.raw = soilCalibration.apply(raw);
+    reading.noise = soilFilter.noise() * soilCalibration.slope(raw);
+    reading.blocks = soilFilter.blocks();
+    soilReading.store(reading);
+}
+#else
+static const uint8_t MUX_SELECT_PINS[] = ZONE_MUX_SELECT_PINS;
+static const uint8_t MUX_ENABLE_PINS[] = ZONE_MUX_ENABLE_PINS;
+static_assert(sizeof(MUX_SELECT_PINS) == 4, "Mux 16 kênh cần 4 chân chọn");
+static_assert(MODEL_ZONE_COUNT <= 16 * sizeof(MUX_ENABLE_PINS), "Không đủ mux cho MODEL_ZONE_COUNT vùng");
+
+// Chỉ task lọc dùng
+static ZoneScanner zoneScanner(MODEL_ZONE_COUNT);
+
+// Task lọc ghi, loop đọc
+static SpscRing<ZoneReading, ZONE_READING_RING_SIZE> zoneReadings;
+static LatestValue<ZoneScanStats> zoneStats;
+static std::atomic<uint64_t> zonePriority{0};
+
+static void selectZone(uint8_t zone) {
+    // Tắt mọi mux trước khi đổi địa chỉ để hai đầu dò không nối chung SOIL_PIN
+    for (uint8_t m = 0; m < sizeof(MUX_ENABLE_PINS); m++) {
+        digitalWrite(MUX_ENABLE_PINS[m], HIGH);
+    }
+    for (uint8_t b = 0; b < sizeof(MUX_SELECT_PINS); b++) {
+        digitalWrite(MUX_SELECT_PINS[b], (zone >> b) & 1 ? HIGH : LOW);
+    }
+    digitalWrite(MUX_ENABLE_PINS[zone / 16], LOW);
+}
+
+static void setupMux() {
+    for (uint8_t m = 0; m < sizeof(MUX_ENABLE_PINS); m++) {
+        pinMode(MUX_ENABLE_PINS[m], OUTPUT);
+    }
+    for (uint8_t b = 0; b < sizeof(MUX_SELECT_PINS); b++) {
+        pinMode(MUX_SELECT_PINS[b], OUTPUT);
+    }
+    selectZone(zoneScanner.zone());
+}
+
+static void publishZone(ZoneReading reading) {
+    float raw = reading.raw;
+    reading.raw = soilCalibration.apply(raw);
+    reading.noise *= soilCalibration.slope(raw);
+    zoneReadings.push(reading);
+
+    ZoneScanStats stats;
+    stats.visits = zoneScanner.visits();
+    stats.passes = zoneScanner.passes();
+    stats.lastPassUs = (uint32_t)(zoneScanner.lastPassSamples() * 1000000ull / SOIL_ADC_SAMPLE_HZ);
+    stats.maxPassUs = (uint32_t)(zoneScanner.maxPassSamples() * 1000000ull / SOIL_ADC_SAMPLE_HZ);
+    zoneStats.store(stats);
+
+    if (reading.zone == 0) {
+        SoilReading soil;
+        soil.raw = reading.raw;
+        soil.noise = reading.noise;
+        soil.blocks = zoneScanner.visits();
+        soilReading.store(soil);
+    }
+}
+
+// Đổi kênh giữa khung: phần còn lại của khung (và khung DMA đang đầy dần) là của
+// kênh cũ, ZoneScanner bỏ chúng cùng thời gian ổn định
+static void scanFrame(const uint8_t* frame, uint32_t length) {
+    zoneScanner.setPriority(zonePriority.load(std::memory_order_relaxed));
+    for (uint32_t i = 0; i + sizeof(adc_digi_output_data_t) <= length; i += sizeof(adc_digi_output_data_t)) {
+        const adc_digi_output_data_t* sample = reinterpret_cast<const adc_digi_output_data_t*>(&frame[i]);
+        if (sample->type1.channel != SOIL_ADC_CHANNEL) continue;
+        ZoneReading reading;
+        if (zoneScanner.add(sample->type1.data, reading)) {
+            selectZone(zoneScanner.zone());
+            zoneScanner.skip((length - i) / sizeof(adc_digi_output_data_t) - 1);
+            publishZone(reading);
+            return;
+        }
+    }
+}
+#endif
+
+static void soilSamplerTask(void* param) {
+    static uint8_t frame[SOIL_ADC_FRAME_BYTES];
+    for (;;) {
+        uint32_t length = 0;
+        esp_err_t err = adc_digi_read_bytes(frame, sizeof(frame), &length, ADC_MAX_DELAY);
+        if (err == ESP_ERR_INVALID_STATE) {
+            // Bộ đệm DMA đã tràn và mất mẫu cũ; dữ liệu trả về vẫn dùng được
+            overflowCount.fetch_add(1, std::memory_order_relaxed);
+#if MODEL_ZONE_COUNT > 1
+            // Không biết mẫu nào đo trước lần đổi kênh cuối
+            zoneScanner.resettle();
+#endif
+        } else if (err != ESP_OK) {
+            continue;
+        }
+        sampleCount.fetch_add(length / sizeof(adc_digi_output_data_t), std::memory_order_relaxed);
+#if MODEL_ZONE_COUNT > 1
+        scanFrame(frame, length);
+#else
+        bool closed = false;
+        for (uint32_t i = 0; i + sizeof(adc_digi_output_data_t) <= length; i += sizeof(adc_digi_output_data_t)) {
+            const adc_digi_output_data_t* sample = reinterpret_cast<const adc_digi_output_data_t*>(&frame[i]);
+            if (sample->type1.channel != SOIL_ADC_CHANNEL) continue;
+            closed |= soilFilter.add(sample->type1.data);
+        }
+        // Công bố một lần mỗi khung dù khung đóng nhiều khối
+        if (closed) {
+            publish();
+        }
+#endif
+    }
+}
+
+bool startSoilSampler() {
+#if MODEL_ZONE_COUNT > 1
+    setupMux();
+#endif
+    adc_digi_init_config_t init = {};
+    init.max_store_buf_size = SOIL_ADC_BUFFER_BYTES;
+    init.conv_num_each_intr = SOIL_ADC_FRAME_BYTES;
+    init.adc1_chan_mask = BIT(SOIL_ADC_CHANNEL);
+    init.adc2_chan_mask = 0;
+    if (adc_digi_initialize(&init) != ESP_OK) {
+        Serial.println("ADC DMA: không khởi tạo được driver");
+        return false;
+    }
+
+    adc_digi_pattern_config_t pattern = {};
+    pattern.atten = ADC_ATTEN_DB_11;     // như analogRead: cả dải 0-3.3 V
+    pattern.channel = SOIL_ADC_CHANNEL;
+    pattern.unit = 0;                    // ADC1
+    pattern.bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+
+    adc_digi_configuration_t config = {};
+    config.conv_limit_en = true;         // ESP32 cần giới hạn số lần chuyển đổi mỗi chu kỳ pattern
+    config.conv_limit_num = 250;
+    config.pattern_num = 1;
+    config.adc_pattern = &pattern;
+    config.sample_freq_hz = SOIL_ADC_SAMPLE_HZ;
+    config.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+    config.format = ADC_DIGI_OUTPUT_FORMAT_TYPE1;
+    if (adc_digi_controller_configure(&config) != ESP_OK || adc_digi_start() != ESP_OK) {
+        Serial.println("ADC DMA: cấu hình lỗi");
+        adc_digi_deinitialize();
+        return false;
+    }
+
+    if (xTaskCreatePinnedToCore(soilSamplerTask, "soil_adc", SOIL_ADC_TASK_STACK, nullptr, SOIL_ADC_TASK_PRIORITY,
+                                nullptr, SENSOR_TASK_CORE) != pdPASS) {
+        Serial.println("ADC DMA: không tạo được task lọc");
+        adc_digi_stop();
+        adc_digi_deinitialize();
+        return false;
+    }
+    running = true;
+    return true;
+}
+
+bool soilSamplerRunning() {
+    return running;
+}
+
+bool readSoilFiltered(SoilReading& out) {
+    return soilReading.load(out);
+}
+
+uint32_t soilSamplerSamples() {
+    return sampleCount.load(std::memory_order_relaxed);
+}
+
+uint32_t soilSamplerOverflows() {
+    return overflowCount.load(std::memory_order_relaxed);
+}
+
+bool popZoneReading(ZoneReading& reading) {
+#if MODEL_ZONE_COUNT > 1
+    return zoneReadings.pop(reading);
+#else
+    return false;
+#endif
+}
+
+void setZoneScanPriority(uint64_t zones) {
+#if MODEL_ZONE_COUNT > 1
+    zonePriority.store(zones, std::memory_order_relaxed);
+#endif
+}
+
+bool readZoneScanStats(ZoneScanStats& out) {
+#if MODEL_ZONE_COUNT > 1
+    return zoneStats.load(out);
+#else
+    return false;
+#endif
+}
+
+uint32_t zoneReadingsDropped() {
+#if MODEL_ZONE_COUNT > 1
+    return zoneReadings.dropped();
+#else
+    return 0;
+#endif
+}
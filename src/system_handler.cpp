@@ -1,6 +1,11 @@
 #include "config.h" 
 #include "system_handler.h"     
 #include "firebase_handler.h"   
+#include "flash_partition.h"
+
+static PartitionFlash recordFlash;
+static FlashLog recordLog(recordFlash, sizeof(StoredData));
+static bool recordStoreReady = false;
 
 void setupWatchdog() {
     esp_task_wdt_init(WDT_TIMEOUT, true); 
@@ -79,6 +84,16 @@ void printSystemStatus(){
     Serial.printf("  Canopy: %s\n", controlData.canopyState ? "ON" : "OFF");
     Serial.printf("  Auto Mode: %s\n", controlData.autoMode ? "Enabled" : "Disabled");
 
+    Serial.println("\nMô hình:");
+    Serial.printf("  Version: %s\n", modelPredict[0].modelVersion ? String(modelPredict[0].modelVersion).c_str() : "built-in");
+    for (int z = 0; z < MODEL_ZONE_COUNT; z++) {
+        const ModelPredict& zone = modelPredict[z];
+        Serial.printf("  Zone %d (model %u): Need Irrigation: %s\n", z, zone.poolModel, zone.needIrrigation ? "Yes" : "No");
+    }
+    Serial.printf("  Trees Evaluated: %u (TB %.1f)\n", modelPredict[0].treesEvaluated,
+                  modelPredict[0].inferenceCount ? (float)modelPredict[0].treesEvaluatedTotal / modelPredict[0].inferenceCount : 0.0f);
+    Serial.printf("  Leaf Cache: %u hit / %u miss\n", modelPredict[0].cacheHits, modelPredict[0].cacheMisses);
+
     Serial.println("\nKết nối:");
     Serial.printf("  WiFi: %s (RSSI: %ddBm)\n", WiFi.status() == WL_CONNECTED ? "Kết nối" : "Không kết nối", WiFi.RSSI());
     Serial.printf("  Firebase: %s\n", firebaseConnected ? "Kết nối" : "Không kết nối");
@@ -90,7 +105,8 @@ void printSystemStatus(){
     Serial.printf("  Soil Sensor: %s\n", "OK");
     Serial.printf("  Rain Sensor: %s\n", "OK");
     Serial.printf("  Light Sensor: %s\n", sensorData.lightLevel > 0 ? "OK" : "ERROR");
-    Serial.printf("  EEPROM Records: %d\n", getStoredDataCount());
+    Serial.printf("  Offline Records: %d/%u (flash, %u lần xóa, sector xóa nhiều nhất %u lần)\n", getStoredDataCount(),
+                  recordLog.capacity(), recordLog.erases(), recordLog.maxWear());
     Serial.println("================================");
 }
 
@@ -108,7 +124,7 @@ void initEEPROM() {
         Serial.println("EEPROM khởi tạo thành công");
     } else {
         systemState.eepromInitialized = true;
-        Serial.printf("EEPROM đã được khởi tạo trước đó. Số bản ghi: %d\n", getStoredDataCount());
+        Serial.println("EEPROM đã được khởi tạo trước đó");
     }
 }
 
@@ -118,19 +134,49 @@ bool isEEPROMInitialized() {
     return (magic == EEPROM_MAGIC_NUMBER);
 }
 
-void saveDataToEEPROM() {
-    if (!systemState.eepromInitialized) {
-        Serial.println("EEPROM chưa được khởi tạo!");
-        return;
+// Chuyển bản ghi còn trong vùng dữ liệu EEPROM cũ sang log (một lần sau khi cập nhật)
+static void migrateEEPROMRecords() {
+    uint16_t count;
+    EEPROM.get(EEPROM_DATA_COUNT_ADDR, count);
+    if (count == 0 || count > EEPROM_MAX_RECORDS) return;
+
+    for (int i = 0; i < count; i++) {
+        StoredData data;
+        EEPROM.get(EEPROM_DATA_START_ADDR + (i * EEPROM_RECORD_SIZE), data);
+        if (!recordLog.append(&data)) break;
     }
-    
-    uint16_t count = getStoredDataCount();
-    if (count >= EEPROM_MAX_RECORDS) {
-        Serial.println("EEPROM đầy! Ghi đè từ đầu....");
-        count = 0;
+    EEPROM.put(EEPROM_DATA_COUNT_ADDR, (uint16_t)0);
+    EEPROM.commit();
+    Serial.printf("Đã chuyển %d bản ghi từ EEPROM sang flash\n", count);
+}
+
+bool initRecordStore() {
+    unsigned long start = micros();
+    if (!recordFlash.begin()) {
+        Serial.println("Không tìm thấy phân vùng " RECORD_PARTITION_LABEL ", không lưu được bản ghi offline!");
+        return false;
     }
-    
-    StoredData data;
+    if (!recordLog.begin()) {
+        Serial.println("Lỗi đọc phân vùng bản ghi!");
+        return false;
+    }
+    recordStoreReady = true;
+    Serial.printf("Bản ghi offline: %u chưa tải (tối đa %u, %u sector), khôi phục %lu us, %u lần đọc\n",
+                  recordLog.pending(), recordLog.capacity(), recordFlash.sectorCount(), micros() - start,
+                  recordLog.recoveryReads());
+    if (systemState.eepromInitialized) {
+        migrateEEPROMRecords();
+    }
+    return true;
+}
+
+void saveDataOffline() {
+    if (!recordStoreReady) {
+        Serial.println("Bộ lưu bản ghi chưa được khởi tạo!");
+        return;
+    }
+
+    StoredData data = {};
     // Lưu timestamp thực tế từ NTP thay vì millis()
     if (systemState.timeInitialized && getLocalTime(&systemState.timeinfo)) {
         data.timestamp = mktime(&systemState.timeinfo);
@@ -145,51 +191,44 @@ void saveDataToEEPROM() {
     data.pumpState = controlData.pumpState;
     data.canopyState = controlData.canopyState;
     data.autoMode = controlData.autoMode;
-    
-    int addr = EEPROM_DATA_START_ADDR + (count * EEPROM_RECORD_SIZE);
-    EEPROM.put(addr, data);
-    EEPROM.put(EEPROM_DATA_COUNT_ADDR, count + 1);
-    EEPROM.commit();
-    
-    Serial.printf("Dữ liệu được lưu vào EEPROM. Tổng số bản ghi: %d\n", count + 1);
-}
 
-uint16_t getStoredDataCount() {
-    uint16_t count;
-    EEPROM.get(EEPROM_DATA_COUNT_ADDR, count);
-    return count;
+    uint32_t dropped = recordLog.dropped();
+    if (!recordLog.append(&data)) {
+        Serial.println("Lỗi ghi bản ghi vào flash!");
+        return;
+    }
+    if (recordLog.dropped() != dropped) {
+        Serial.printf("Bộ lưu đầy! Đã bỏ %u bản ghi cũ nhất\n", recordLog.dropped() - dropped);
+    }
+    Serial.printf("Dữ liệu được lưu vào flash. Tổng số bản ghi: %d\n", getStoredDataCount());
 }
 
-
-void clearEEPROMData() {
-    Serial.println("Xóa dữ liệu EEPROM...");
-    EEPROM.put(EEPROM_DATA_COUNT_ADDR, 0);
-    EEPROM.commit();
-    Serial.println("Đã reset bộ đếm EEPROM.");
+uint16_t getStoredDataCount() {
+    return recordStoreReady ? (uint16_t)recordLog.pending() : 0;
 }
 
 void uploadStoredDataToFirebase() {
     // Kiểm tra Firebase status trực tiếp
     if (!app.ready() || WiFi.status() != WL_CONNECTED) {
-        Serial.println("Firebase không sẵn sàng hoặc WiFi đã ngắt kết nối, không thể tải dữ liệu EEPROM");
+        Serial.println("Firebase không sẵn sàng hoặc WiFi đã ngắt kết nối, không thể tải bản ghi offline");
         return;
     }
     
     uint16_t count = getStoredDataCount();
     if (count == 0) {
-        Serial.println("Không có dữ liệu để tải từ EEPROM");
+        Serial.println("Không có bản ghi offline để tải");
         return;
     }
     
-    Serial.printf("Tải %d bản ghi từ EEPROM lên Firebase...\n", count);
-    bool allUploaded = true;
+    // Mỗi lần tối đa RECORD_UPLOAD_BATCH bản ghi, phần còn lại ở lần kiểm tra sau
+    uint16_t batch = count < RECORD_UPLOAD_BATCH ? count : RECORD_UPLOAD_BATCH;
+    Serial.printf("Tải %d/%d bản ghi offline lên Firebase...\n", batch, count);
 
-    for (int i = 0; i < count; i++) {
+    for (int i = 0; i < batch; i++) {
         feedWatchdog();
 
         StoredData data;
-        int addr = EEPROM_DATA_START_ADDR + (i * EEPROM_RECORD_SIZE);
-        EEPROM.get(addr, data);
+        if (!recordLog.peek(&data)) break;
         
         // Tạo JSON payload (bỏ source, giữ timestamp từ ESP)
         FirebaseJson jsonPayload;
@@ -219,26 +258,25 @@ void uploadStoredDataToFirebase() {
         path.concat("/sensors/history/");
         path.concat(dateStr);
         
-        Serial.printf("Tải bản ghi %d/%d lên: %s\n", i+1, count, path.c_str());
+        Serial.printf("Tải bản ghi %d/%d lên: %s\n", i+1, batch, path.c_str());
         
-        Database.push<object_t>(aClient, path, object_t(jsonPayload.raw()), processData, "upload EEPROM data");
+        Database.push<object_t>(aClient, path, object_t(jsonPayload.raw()), processData, "upload offline data");
         
         delay(500);
         
-        // Kiểm tra Firebase connection sau mỗi upload
+        // Kiểm tra Firebase connection sau mỗi upload; bản ghi chỉ được đánh dấu đã
+        // lấy khi vẫn còn kết nối, nên lần sau tiếp tục từ bản ghi chưa tải
         if (!app.ready() || WiFi.status() != WL_CONNECTED) {
             Serial.println("Firebase đã ngắt kết nối trong khi tải, dừng...");
-            allUploaded = false;
             return;
         }
+        if (!recordLog.consume()) break;
     }
     
-    // Xóa dữ liệu sau khi upload thành công
-    if (allUploaded) {
-        clearEEPROMData();
-        Serial.println("Tất cả dữ liệu EEPROM đã được tải lên Firebase.");
+    if (getStoredDataCount() == 0) {
+        Serial.println("Tất cả bản ghi offline đã được tải lên Firebase.");
     } else {
-        Serial.println("Một phần dữ liệu chưa được tải (sẽ giữ lại EEPROM).");
+        Serial.printf("Còn %d bản ghi offline chờ tải.\n", getStoredDataCount());
     }
 }
 
@@ -1,5 +1,6 @@
 #include "telegram_handler.h"
 #include "system_handler.h"   
+#include "model_handler.h"
 // Global Telegram Bot object - will be initialized after WiFi connection
 UniversalTelegramBot* telegramBot = nullptr;
 
@@ -190,6 +191,11 @@ void handleTelegramCommand(const String& command, const String& chatId) {
         String action = command.substring(6); // Remove "/auto "
         handleAutoModeCommand(action, chatId);
     }
+    else if (command.startsWith("/model")) {
+        Serial.println("Processing /model command");
+        String action = command.substring(7); // Remove "/model "
+        handleModelCommand(action, chatId);
+    }
     else {
         String unknownCmd = "Unknown command: ";
         unknownCmd.concat(command);
@@ -216,7 +222,11 @@ void handleHelpCommand(const String& chatId) {
     helpMsg.concat("🤖 Chế độ tự động:\n");
     helpMsg.concat("• /auto on - Bật chế độ tự động\n");
     helpMsg.concat("• /auto off - Tắt chế độ tự động\n");
-    helpMsg.concat("• /auto status - Trạng thái chế độ tự động");
+    helpMsg.concat("• /auto status - Trạng thái chế độ tự động\n\n");
+    helpMsg.concat("🧠 Mô hình:\n");
+    helpMsg.concat("• /model status - Phiên bản mô hình\n");
+    helpMsg.concat("• /model update <url> - Tải mô hình mới\n");
+    helpMsg.concat("• /model builtin - Dùng mô hình built-in");
     
     Serial.println("Gửi tin nhắn trợ giúp đến chatId: ");
     Serial.println(chatId);
@@ -312,6 +322,28 @@ void handleAutoModeCommand(const String& action, const String& chatId) {
     }
 }
 
+void handleModelCommand(const String& action, const String& chatId) {
+    if (action == "status") {
+        sendTelegramMessageToChat(chatId, getModelInfoText());
+    }
+    else if (action.startsWith("update ")) {
+        String url = action.substring(7); // Remove "update "
+        url.trim();
+        if (requestModelUpdate(url)) {
+            sendTelegramMessageToChat(chatId, "⏳ Đang tải mô hình mới, sẽ báo khi xong");
+        } else {
+            sendTelegramMessageToChat(chatId, "ℹ️ Mô hình từ url này đang được dùng");
+        }
+    }
+    else if (action == "builtin") {
+        useBuiltinModel();
+        sendTelegramMessageToChat(chatId, "🤖 Đã quay về mô hình built-in");
+    }
+    else {
+        sendTelegramMessageToChat(chatId, "❌ Lệnh mô hình không hợp lệ! Sử dụng: /model status, /model update <url>, hoặc /model builtin");
+    }
+}
+
 String getSystemStatusText() {
     String status = "📊 Trạng thái hệ thống:\n\n";
     
@@ -377,11 +409,19 @@ String getSensorDataText() {
     }
     
     // Model prediction
-    if (modelPredict.initialized) {
+    if (modelPredict[0].initialized) {
         sensorMsg.concat("🤖 Dự đoán AI:\n");
-        sensorMsg.concat("💧 Cần tưới: ");
-        sensorMsg.concat(String(modelPredict.needIrrigation ? "Có" : "Không"));
-        sensorMsg.concat("\n");
+        for (int z = 0; z < MODEL_ZONE_COUNT; z++) {
+            sensorMsg.concat("💧 Cần tưới");
+            if (MODEL_ZONE_COUNT > 1) {
+                sensorMsg.concat(" (vùng ");
+                sensorMsg.concat(String(z));
+                sensorMsg.concat(")");
+            }
+            sensorMsg.concat(": ");
+            sensorMsg.concat(String(modelPredict[z].needIrrigation ? "Có" : "Không"));
+            sensorMsg.concat("\n");
+        }
     }
     
     return sensorMsg;
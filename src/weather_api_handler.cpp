@@ -1,5 +1,10 @@
 #include "config.h"
-#include "model_final.h"
+#include "weather_api_handler.h"
+#include "system_handler.h"
+#include "model_handler.h"
+#include "model_engine.h"
+#include "sensor_handler.h"
+#include "firebase_handler.h"
 #include <HTTPClient.h>
 
 // Cập nhật dữ liệu từ OpenWeatherMap Pro - hourly forecast cnt=1
@@ -67,64 +72,146 @@ void updateWeatherData() {
                   weatherData.rainNext1h, weatherData.popNext1h);
 }
 
+// Kênh đầu vào đang lỗi kéo dài đã báo (bit FaultChannel)
+static uint8_t reportedInputFaults = 0;
+
+// Vector có NaN ở đầu vào mô hình: chưa đủ số đọc hoặc lần đọc vừa bị loại thì giữ
+// quyết định cũ; kênh đầu vào lỗi kéo dài thì mọi vùng về quyết định an toàn (không
+// tưới, auto_control tắt bơm) và cảnh báo một lần khi lỗi bắt đầu
+static bool modelInputsReady(const float* vector) {
+    bool ready = true;
+    for (int f = 0; f < MODEL_FEATURE_COUNT; f++) {
+        if (isnan(vector[f])) ready = false;
+    }
+    uint8_t faulty = ready ? 0 : sensorFaults().persistentFaultChannels() & featureFaultChannels(MODEL_FEATURE_COUNT);
+    if (faulty != reportedInputFaults) {
+        if (faulty != 0) {
+            String message = "Cảm biến lỗi:";
+            for (int c = 0; c < FAULT_CHANNEL_COUNT; c++) {
+                if (faulty & (1 << c)) {
+                    message.concat(' ');
+                    message.concat(faultChannelName(c));
+                }
+            }
+            message.concat(" - dừng tưới tự động");
+            Serial.println(message);
+            uploadAlerts("sensor", message);
+            alertData.alertCountToday++;
+        } else {
+            Serial.println("Cảm biến đầu vào hết lỗi, mô hình quyết định lại");
+        }
+        reportedInputFaults = faulty;
+    }
+    for (int z = 0; z < MODEL_ZONE_COUNT; z++) {
+        ModelPredict& zone = modelPredict[z];
+        zone.sensorFault = faulty != 0;
+        if (faulty != 0) {
+            zone.needIrrigation = false;
+            zone.lastUpdate = millis();
+        }
+    }
+    return ready;
+}
+
 // Hàm sử dụng mô hình XGBoost thật của bạn
 void updateModelPrediction() {
     static unsigned long lastUpdate = 0;
-    if (millis() - lastUpdate < WEATHER_UPDATE_INTERVAL) return; // Update every 10 minutes
+    if (millis() - lastUpdate < MODEL_UPDATE_INTERVAL) return;
     lastUpdate = millis();
     
-    // Tạo instance của mô hình XGBoost
-    Eloquent::ML::Port::XGBClassifier classifier;
-    
     // Chuẩn bị input features cho mô hình
     // Dựa trên phân tích code, mô hình cần 3 features:
-    float features[3];
-    features[0] = static_cast<float>(sensorData.soilMoisture);
-    features[1] = static_cast<float>(sensorData.temperature);
-    features[2] = static_cast<float>(sensorData.humidity);
+    uint16_t treesEvaluated = 0;
+    uint8_t decisions[MODEL_ZONE_COUNT];
+#if defined(MODEL_INFERENCE_FIXED)
+    // Cùng vector với đường float: kênh đang lỗi hoặc lần đọc vừa bị loại (NaN đơn lẻ,
+    // xung) là NaN và không được đổi sang Q20
+    float vector[FEATURE_COUNT];
+    sensorFeatureVector(vector);
+    if (!modelInputsReady(vector)) return;
+    // Độ ẩm đất là số nguyên nên đổi thẳng sang Q20, không qua float
+    int32_t features[3];
+    features[0] = modelFixedInput((int)vector[FEATURE_SOIL]);
+    features[1] = modelFixedInput(vector[FEATURE_TEMPERATURE]);
+    features[2] = modelFixedInput(vector[FEATURE_HUMIDITY]);
+    decisions[0] = (uint8_t)predictIrrigationFixed(features, &treesEvaluated);
+    recordIrrigationDecision(vector);
+#else
+    // Vector theo bố cục feature_store.h, mô hình đọc MODEL_FEATURE_COUNT mục đầu;
+    // đặc trưng của kênh đang lỗi là NaN
+    float features[FEATURE_COUNT];
+    sensorFeatureVector(features);
+    if (!modelInputsReady(features)) return;  // chưa đọc được cảm biến hoặc cảm biến lỗi
     
-    // Chạy inference với mô hình XGBoost
-    int prediction = classifier.predict(features);
+#if MODEL_ZONE_COUNT > 1
+    // Vùng có đầu dò riêng: độ ẩm tức thời lấy từ vùng, đặc trưng cửa sổ và khí hậu
+    // dùng chung. Khi đó vector khác nhau giữa các vùng nên mỗi vùng chỉ chạy mô hình
+    // của nó; chưa vùng nào có số đọc riêng thì mọi vùng chung một lượt predictZones
+    if ((zoneState.soilValid & ~1ull) == 0) {
+        predictZones(features, decisions, &treesEvaluated);
+    } else {
+        float sharedSoil = features[FEATURE_SOIL];
+        for (int z = 0; z < MODEL_ZONE_COUNT; z++) {
+            features[FEATURE_SOIL] = (z > 0 && zoneState.hasSoil(z)) ? zoneState.soilMoisture[z] : sharedSoil;
+            uint16_t trees = 0;
+            decisions[z] = predictZone(z, features, &trees);
+            treesEvaluated += trees;
+        }
+        features[FEATURE_SOIL] = sharedSoil;
+    }
+#else
+    // Chạy inference với mô hình đang dùng (built-in hoặc nạp từ LittleFS)
+    predictZones(features, decisions, &treesEvaluated);
+#endif
+    // Giải thích ghi theo vector của quyết định vùng 0 (độ ẩm chung)
+    recordIrrigationDecision(features);
+#endif
     
     // Convert kết quả: 0 = không tưới, 1 = cần tưới
-    modelPredict.needIrrigation = (prediction == 1);
-    modelPredict.lastUpdate = millis();
-    modelPredict.initialized = true;
-    
-    Serial.printf("🤖 XGBoost prediction: %s (features: soil=%.0f, temp=%.1f, hum=%.1f)\n", 
-                  modelPredict.needIrrigation ? "NEED IRRIGATION" : "NO IRRIGATION",
-                  features[0], features[1], features[2]);
+    for (int z = 0; z < MODEL_ZONE_COUNT; z++) {
+        ModelPredict& zone = modelPredict[z];
+        bool changed = !zone.initialized || zone.needIrrigation != (decisions[z] == 1);
+        zone.needIrrigation = (decisions[z] == 1);
+        zone.lastUpdate = millis();
+        zone.initialized = true;
+        zone.treesEvaluated = treesEvaluated;
+        zone.inferenceCount++;
+        zone.treesEvaluatedTotal += treesEvaluated;
+        
+        // Chạy mỗi 5 giây nên chỉ in khi kết quả đổi
+        if (changed) {
+            Serial.printf("🤖 XGBoost prediction zone %d: %s (features: soil=%.0f, temp=%.1f, hum=%.1f)\n", z,
+                          zone.needIrrigation ? "NEED IRRIGATION" : "NO IRRIGATION",
+                          (float)sensorData.soilMoisture, sensorData.temperature, sensorData.humidity);
+        }
+    }
 }
 
 // Hàm để test với mô hình XGBoost thật
+// Vector tổng hợp không đi qua đường thật (cache lá, profile suy luận)
 void testWeatherScenarios() {
     Serial.println("\n=== Testing XGBoost Model Scenarios ===");
     
-    // Tạo instance của mô hình
-    Eloquent::ML::Port::XGBClassifier classifier;
-    
     // Scenario 1: Đất khô, nhiệt độ cao, độ ẩm thấp
     float features1[3] = {800.0f, 35.0f, 25.0f}; // soil, temp, humidity
-    int pred1 = classifier.predict(features1);
+    int pred1 = predictIrrigationStateless(features1);
     Serial.printf("Scenario 1: Dry soil (%.0f), Hot (%.1f°C), Low humidity (%.1f%%) -> %s\n",
                   features1[0], features1[1], features1[2], 
                   pred1 == 1 ? "IRRIGATE" : "NO IRRIGATION");
     
     // Scenario 2: Đất ẩm, nhiệt độ thấp, độ ẩm cao
     float features2[3] = {300.0f, 20.0f, 80.0f};
-    int pred2 = classifier.predict(features2);
+    int pred2 = predictIrrigationStateless(features2);
     Serial.printf("Scenario 2: Wet soil (%.0f), Cool (%.1f°C), High humidity (%.1f%%) -> %s\n",
                   features2[0], features2[1], features2[2], 
                   pred2 == 1 ? "IRRIGATE" : "NO IRRIGATION");
     
     // Scenario 3: Đất trung bình, nhiệt độ trung bình, độ ẩm trung bình
     float features3[3] = {500.0f, 28.0f, 50.0f};
-    int pred3 = classifier.predict(features3);
+    int pred3 = predictIrrigationStateless(features3);
     Serial.printf("Scenario 3: Medium soil (%.0f), Warm (%.1f°C), Medium humidity (%.1f%%) -> %s\n",
                   features3[0], features3[1], features3[2], 
                   pred3 == 1 ? "IRRIGATE" : "NO IRRIGATION");
     
     Serial.println("=== End Testing ===\n");
 }
-
-
@@ -0,0 +1,63 @@
+#include "zone_scanner.h"
+
+ZoneScanner::ZoneScanner(uint8_t zones, uint16_t settleSamples)
+    : count(zones < 1 ? 1 : (zones > ZONE_MAX ? ZONE_MAX : zones)), current(0), roundRobin(0),
+      priorityPos(0), priorityTurn(false), priority(0), visited(0), settle(settleSamples),
+      settleLeft(settleSamples), fill(0), sampleTotal(0), visitTotal(0), passTotal(0), passStart(0),
+      passLast(0), passMax(0) {}
+
+bool ZoneScanner::add(uint16_t raw, ZoneReading& reading) {
+    sampleTotal++;
+    if (settleLeft > 0) {
+        settleLeft--;
+        return false;
+    }
+    block[fill++] = raw;
+    if (fill < ADC_FILTER_BLOCK) {
+        return false;
+    }
+
+    reading.zone = current;
+    adcBlockStats(block, reading.raw, reading.noise);
+    fill = 0;
+    settleLeft = settle;
+    visitTotal++;
+
+    visited |= 1ull << current;
+    uint64_t all = count == 64 ? ~0ull : (1ull << count) - 1;
+    if (visited == all) {
+        passLast = sampleTotal - passStart;
+        if (passLast > passMax) passMax = passLast;
+        passStart = sampleTotal;
+        passTotal++;
+        visited = 0;
+    }
+    current = nextZone();
+    return true;
+}
+
+void ZoneScanner::resettle() {
+    fill = 0;
+    settleLeft = settle;
+}
+
+void ZoneScanner::setPriority(uint64_t mask) {
+    uint64_t all = count == 64 ? ~0ull : (1ull << count) - 1;
+    priority = mask & all;
+}
+
+uint8_t ZoneScanner::nextZone() {
+    // Xen kẽ: vùng theo vòng, vùng ưu tiên, vùng theo vòng... nên vùng thường vẫn
+    // được đo ít nhất mỗi 2 * count lượt dù mọi van cùng mở
+    if (priorityTurn && priority != 0) {
+        priorityTurn = false;
+        // Bit ưu tiên kế tiếp sau priorityPos, quay vòng
+        uint64_t after = priorityPos + 1 < 64 ? priority & (~0ull << (priorityPos + 1)) : 0;
+        uint64_t pick = after != 0 ? after : priority;
+        priorityPos = (uint8_t)__builtin_ctzll(pick);
+        return priorityPos;
+    }
+    priorityTurn = true;
+    roundRobin = (uint8_t)((roundRobin + 1) % count);
+    return roundRobin;
+}
@@ -0,0 +1,387 @@
+// Host build: so sánh lưu bản ghi offline kiểu EEPROM cũ (EEPROM.commit ghi lại cả
+// ảnh 4 KB) với FlashLog trên flash giả lập bằng file, và thử mất điện giữa chừng.
+//
+//   g++ -O2 -std=gnu++17 -Iinclude tools/flash_bench.cpp src/flash_log.cpp -o flash_bench
+//   ./flash_bench [--records N] [--upload-every M] [--sectors S] [--cuts K] [--seed X] [--file PATH]
+//
+// File giả lập NOR: xóa đặt cả sector về 0xFF, ghi chỉ AND (bit 1 -> 0). Thời gian
+// flash tính theo datasheet SPI NOR 4 MB thường gặp trên ESP32 (xóa sector 4 KB 45 ms,
+// ghi trang 256 B tối đa 0.7 ms, đọc 40 MHz QIO), không phải thời gian CPU host.
+// Đường EEPROM: mỗi bản ghi một commit = xóa một sector + ghi 4 KB (ESP32 Arduino
+// EEPROM giữ cả ảnh trong RAM và ghi lại toàn bộ khi commit), khôi phục = đọc 4 KB.
+// --cuts K: K lần cắt điện ở byte ghi / lần xóa ngẫu nhiên rồi begin() lại và kiểm
+// tra các bản ghi còn lại liên tiếp, đúng thứ tự, chỉ mất bản ghi đang ghi dở.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <unistd.h>
+#include <fcntl.h>
+
+#include "flash_log.h"
+
+static const uint32_t SECTOR_SIZE = 4096;           // RECORD_SECTOR_SIZE
+static const uint32_t RECORD_SIZE = 32;             // sizeof(StoredData)
+static const uint32_t EEPROM_IMAGE = 4096;          // EEPROM_SIZE
+static const uint32_t EEPROM_MAX_RECORDS = 100;
+
+// Thời gian flash (us)
+static const double ERASE_US = 45000.0;
+static const double PAGE_PROGRAM_MAX_US = 700.0;
+static const double BYTE_PROGRAM_FIRST_US = 30.0;
+static const double BYTE_PROGRAM_NEXT_US = 2.5;
+static const double READ_COMMAND_US = 1.0;
+static const double READ_BYTE_US = 0.05;
+
+class FileFlashDevice : public FlashDevice {
+    public:
+        FileFlashDevice(const char* path, uint16_t sectors) : count(sectors), wear(sectors, 0) {
+            fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+            std::vector<uint8_t> blank(SECTOR_SIZE, 0xFF);
+            for (uint16_t s = 0; s < count; s++) {
+                if (pwrite(fd, blank.data(), SECTOR_SIZE, (off_t)s * SECTOR_SIZE) != (ssize_t)SECTOR_SIZE) fd = -1;
+            }
+            resetCounters();
+        }
+        ~FileFlashDevice() override {
+            if (fd >= 0) close(fd);
+        }
+
+        bool ok() const { return fd >= 0; }
+        uint32_t sectorSize() const override { return SECTOR_SIZE; }
+        uint16_t sectorCount() const override { return count; }
+
+        bool read(uint32_t address, void* data, uint32_t length) override {
+            if (address + length > (uint32_t)count * SECTOR_SIZE) return false;
+            busyUs += READ_COMMAND_US + READ_BYTE_US * length;
+            reads++;
+            return pread(fd, data, length, address) == (ssize_t)length;
+        }
+
+        bool write(uint32_t address, const void* data, uint32_t length) override {
+            if (dead || address + length > (uint32_t)count * SECTOR_SIZE) return false;
+            uint8_t old[SECTOR_SIZE];
+            if (pread(fd, old, length, address) != (ssize_t)length) return false;
+            const uint8_t* bytes = (const uint8_t*)data;
+            uint32_t done = length;
+            if (cutBudget >= 0 && (int64_t)length > cutBudget) {
+                // Mất điện: chỉ một phần được ghi, byte đang ghi dở mất ngẫu nhiên vài bit
+                done = (uint32_t)cutBudget;
+                if (done < length) old[done] &= bytes[done] | (uint8_t)partial(rng);
+                dead = true;
+            }
+            for (uint32_t i = 0; i < done; i++) old[i] &= bytes[i];
+            pwrite(fd, old, dead ? done + 1 : length, address);
+            if (cutBudget >= 0) cutBudget -= done;
+            programUs(address, length);
+            programBytes += length;
+            return !dead;
+        }
+
+        bool erase(uint16_t sector) override {
+            if (dead || sector >= count) return false;
+            std::vector<uint8_t> blank(SECTOR_SIZE, 0xFF);
+            uint32_t done = SECTOR_SIZE;
+            if (cutBudget >= 0 && cutBudget < (int64_t)SECTOR_SIZE) {
+                // Mất điện khi đang xóa: chỉ phần đầu sector về 0xFF
+                done = (uint32_t)cutBudget;
+                dead = true;
+            }
+            pwrite(fd, blank.data(), done, (off_t)sector * SECTOR_SIZE);
+            if (cutBudget >= 0) cutBudget -= done;
+            busyUs += ERASE_US;
+            wear[sector]++;
+            erases++;
+            return !dead;
+        }
+
+        // Sau budget byte ghi (một lần xóa tính SECTOR_SIZE byte) thì mất điện; -1 = không
+        void cutAfter(int64_t budget, uint32_t seed) {
+            cutBudget = budget;
+            rng.seed(seed);
+        }
+        void powerOn() {
+            dead = false;
+            cutBudget = -1;
+        }
+        bool powerLost() const { return dead; }
+
+        void resetCounters() {
+            busyUs = 0.0;
+            reads = 0;
+            erases = 0;
+            programBytes = 0;
+        }
+        uint32_t wearOf(uint16_t sector) const { return wear[sector]; }
+
+        double busyUs;
+        uint32_t reads;
+        uint32_t erases;
+        uint64_t programBytes;
+
+    private:
+        void programUs(uint32_t address, uint32_t length) {
+            // Theo từng trang 256 B mà lần ghi chạm tới
+            while (length > 0) {
+                uint32_t chunk = 256 - (address % 256);
+                if (chunk > length) chunk = length;
+                double us = BYTE_PROGRAM_FIRST_US + BYTE_PROGRAM_NEXT_US * (chunk - 1);
+                busyUs += us < PAGE_PROGRAM_MAX_US ? us : PAGE_PROGRAM_MAX_US;
+                address += chunk;
+                length -= chunk;
+            }
+        }
+
+        int fd;
+        uint16_t count;
+        std::vector<uint32_t> wear;
+        bool dead = false;
+        int64_t cutBudget = -1;
+        std::mt19937 rng;
+        std::uniform_int_distribution<int> partial{0, 255};
+};
+
+struct Record {
+    uint32_t id;
+    uint8_t fill[RECORD_SIZE - 4];
+};
+
+static Record makeRecord(uint32_t id) {
+    Record r;
+    r.id = id;
+    for (uint32_t i = 0; i < sizeof(r.fill); i++) r.fill[i] = (uint8_t)(id * 31 + i);
+    return r;
+}
+
+struct PathResult {
+    double meanWriteUs;
+    double maxWriteUs;
+    double recordsPerErase;
+    double recoveryUs;      // thời gian flash khi khởi động
+    double recoveryHostUs;  // CPU host cho begin()
+    uint32_t recoveryReads;
+    uint32_t wearMin, wearMax;
+    uint32_t capacity;
+    uint32_t dropped;
+};
+
+// ESP32 Arduino EEPROM: ảnh EEPROM_IMAGE byte, commit xóa rồi ghi lại cả ảnh
+static PathResult runEeprom(const char* path, uint32_t records, uint32_t uploadEvery, uint16_t sectors) {
+    FileFlashDevice flash(path, sectors);
+    std::vector<uint8_t> image(EEPROM_IMAGE, 0xFF);
+    PathResult r = {};
+    uint32_t stored = 0;
+    uint16_t sector = 0;
+    for (uint32_t n = 0; n < records; n++) {
+        if (stored >= EEPROM_MAX_RECORDS) {
+            stored = 0;     // saveDataToEEPROM cũ ghi đè từ đầu
+            r.dropped += EEPROM_MAX_RECORDS;
+        }
+        Record rec = makeRecord(n);
+        memcpy(&image[16 + stored * RECORD_SIZE], &rec, RECORD_SIZE);
+        stored++;
+        memcpy(&image[2], &stored, 2);
+
+        double before = flash.busyUs;
+        // Trang NVS xoay vòng trong vùng để so sánh mòn cùng diện tích
+        flash.erase(sector);
+        flash.write((uint32_t)sector * SECTOR_SIZE, image.data(), EEPROM_IMAGE);
+        sector = (uint16_t)((sector + 1) % sectors);
+        double us = flash.busyUs - before;
+        r.meanWriteUs += us;
+        if (us > r.maxWriteUs) r.maxWriteUs = us;
+
+        if (uploadEvery && (n + 1) % uploadEvery == 0) {
+            // clearEEPROMData: đặt bộ đếm về 0 là thêm một commit
+            stored = 0;
+            memcpy(&image[2], &stored, 2);
+            flash.erase(sector);
+            flash.write((uint32_t)sector * SECTOR_SIZE, image.data(), EEPROM_IMAGE);
+            sector = (uint16_t)((sector + 1) % sectors);
+        }
+    }
+    r.meanWriteUs /= records;
+    r.recordsPerErase = flash.erases ? (double)records / flash.erases : 0.0;
+    r.wearMin = UINT32_MAX;
+    for (uint16_t s = 0; s < sectors; s++) {
+        if (flash.wearOf(s) < r.wearMin) r.wearMin = flash.wearOf(s);
+        if (flash.wearOf(s) > r.wearMax) r.wearMax = flash.wearOf(s);
+    }
+
+    flash.resetCounters();
+    auto start = std::chrono::steady_clock::now();
+    uint16_t last = (uint16_t)((sector + sectors - 1) % sectors);
+    flash.read((uint32_t)last * SECTOR_SIZE, image.data(), EEPROM_IMAGE);
+    r.recoveryHostUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    r.recoveryUs = flash.busyUs;
+    r.recoveryReads = flash.reads;
+    r.capacity = EEPROM_MAX_RECORDS;
+    return r;
+}
+
+static PathResult runLog(const char* path, uint32_t records, uint32_t uploadEvery, uint16_t sectors) {
+    FileFlashDevice flash(path, sectors);
+    FlashLog log(flash, RECORD_SIZE);
+    PathResult r = {};
+    if (!log.begin()) {
+        fprintf(stderr, "FlashLog begin() lỗi\n");
+        exit(1);
+    }
+    flash.resetCounters();
+    for (uint32_t n = 0; n < records; n++) {
+        Record rec = makeRecord(n);
+        double before = flash.busyUs;
+        log.append(&rec);
+        double us = flash.busyUs - before;
+        r.meanWriteUs += us;
+        if (us > r.maxWriteUs) r.maxWriteUs = us;
+
+        if (uploadEvery && (n + 1) % uploadEvery == 0) {
+            Record out;
+            while (log.peek(&out)) log.consume();
+        }
+    }
+    r.meanWriteUs /= records;
+    r.recordsPerErase = flash.erases ? (double)records / flash.erases : 0.0;
+    r.wearMin = UINT32_MAX;
+    for (uint16_t s = 0; s < sectors; s++) {
+        if (flash.wearOf(s) < r.wearMin) r.wearMin = flash.wearOf(s);
+        if (flash.wearOf(s) > r.wearMax) r.wearMax = flash.wearOf(s);
+    }
+    r.dropped = log.dropped();
+    r.capacity = log.capacity();
+
+    // Khởi động lại: log mới trên cùng file
+    uint32_t pending = log.pending();
+    FlashLog reboot(flash, RECORD_SIZE);
+    flash.resetCounters();
+    auto start = std::chrono::steady_clock::now();
+    reboot.begin();
+    r.recoveryHostUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    r.recoveryUs = flash.busyUs;
+    r.recoveryReads = reboot.recoveryReads();
+    if (reboot.pending() != pending) {
+        fprintf(stderr, "khôi phục sai: %u bản ghi chờ, trước khi khởi động lại %u\n", reboot.pending(), pending);
+        exit(1);
+    }
+    return r;
+}
+
+static void printRow(const char* name, const PathResult& r) {
+    printf("%-8s %10.1f %10.1f %10.1f %9u %10.1f %9.1f %7u %6u-%-6u %8u\n", name, r.meanWriteUs, r.maxWriteUs,
+           r.recordsPerErase, r.capacity, r.recoveryUs, r.recoveryHostUs, r.recoveryReads, r.wearMin, r.wearMax,
+           r.dropped);
+}
+
+// Cắt điện ngẫu nhiên khi đang chạy append/consume, khởi động lại và kiểm tra
+static bool runCuts(const char* path, uint32_t cuts, uint16_t sectors, uint32_t seed) {
+    std::mt19937 rng(seed);
+    FileFlashDevice flash(path, sectors);
+    uint32_t nextId = 0;       // id của lần append kế tiếp
+    uint32_t expectTail = 0;   // id cũ nhất chưa lấy theo lần kiểm tra trước
+    uint32_t failures = 0, corrupt = 0, lostInFlight = 0;
+
+    for (uint32_t c = 0; c < cuts; c++) {
+        FlashLog log(flash, RECORD_SIZE);
+        flash.powerOn();
+        if (!log.begin()) {
+            fprintf(stderr, "cắt %u: begin() lỗi\n", c);
+            return false;
+        }
+        uint32_t before = log.pending();
+        uint32_t first = UINT32_MAX, prev = UINT32_MAX, seen = 0;
+        bool ordered = true;
+        // Tải hết như uploadStoredDataToFirebase: các id phải liên tiếp, không cũ hơn
+        // expectTail (bản ghi bị bỏ khi log đầy chỉ làm id đầu lớn hơn)
+        Record rec;
+        while (log.peek(&rec)) {
+            Record expect = makeRecord(rec.id);
+            if (memcmp(&rec, &expect, sizeof(rec)) != 0) ordered = false;
+            if (first == UINT32_MAX) first = rec.id;
+            if (prev != UINT32_MAX && rec.id != prev + 1) ordered = false;
+            prev = rec.id;
+            seen++;
+            log.consume();
+        }
+        corrupt += log.corrupt();
+        if (seen > 0) {
+            // Chỉ bản ghi đang ghi lúc mất điện (nextId - 1) được phép thiếu ở cuối
+            if (first < expectTail || prev + 2 < nextId || prev >= nextId) ordered = false;
+            if (prev + 2 == nextId) lostInFlight++;
+        } else if (before > 1 + log.corrupt()) {
+            ordered = false;
+        }
+        if (!ordered) {
+            failures++;
+            fprintf(stderr, "cắt %u: sai thứ tự (đầu %u, cuối %u, kỳ vọng tail >= %u, id kế %u)\n", c, first, prev,
+                    expectTail, nextId);
+        }
+        expectTail = nextId;
+
+        // Chạy tiếp tới lần mất điện kế: append phần lớn, thỉnh thoảng tải lên một phần
+        std::uniform_int_distribution<int64_t> budget(0, (int64_t)SECTOR_SIZE * sectors * 3);
+        flash.cutAfter(budget(rng), rng());
+        while (!flash.powerLost()) {
+            if (rng() % 4 == 0) {
+                uint32_t take = rng() % 64;
+                while (take-- > 0 && log.peek(&rec)) {
+                    if (!log.consume()) break;
+                    expectTail = rec.id + 1;
+                }
+            } else {
+                Record out = makeRecord(nextId++);
+                log.append(&out);
+            }
+        }
+    }
+    printf("cắt điện: %u lần, %u lỗi, %u ô ghi dở bị bỏ qua, %u lần mất bản ghi đang ghi\n", cuts, failures, corrupt,
+           lostInFlight);
+    return failures == 0;
+}
+
+int main(int argc, char** argv) {
+    uint32_t records = 20000;
+    uint32_t uploadEvery = 0;
+    uint16_t sectors = 16;
+    uint32_t cuts = 200;
+    uint32_t seed = 1;
+    const char* path = "/tmp/flash_bench.bin";
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--records") == 0 && i + 1 < argc) {
+            records = (uint32_t)strtoul(argv[++i], nullptr, 0);
+        } else if (strcmp(argv[i], "--upload-every") == 0 && i + 1 < argc) {
+            uploadEvery = (uint32_t)strtoul(argv[++i], nullptr, 0);
+        } else if (strcmp(argv[i], "--sectors") == 0 && i + 1 < argc) {
+            sectors = (uint16_t)strtoul(argv[++i], nullptr, 0);
+        } else if (strcmp(argv[i], "--cuts") == 0 && i + 1 < argc) {
+            cuts = (uint32_t)strtoul(argv[++i], nullptr, 0);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = (uint32_t)strtoul(argv[++i], nullptr, 0);
+        } else if (strcmp(argv[i], "--file") == 0 && i + 1 < argc) {
+            path = argv[++i];
+        } else {
+            fprintf(stderr, "usage: flash_bench [--records N] [--upload-every M] [--sectors S] [--cuts K] "
+                            "[--seed X] [--file PATH]\n");
+            return 2;
+        }
+    }
+    if (records == 0 || sectors < 2) {
+        fprintf(stderr, "cần --records >= 1 và --sectors >= 2\n");
+        return 2;
+    }
+
+    printf("%u bản ghi %u B, %u sector %u B, tải lên mỗi %u bản ghi (0 = không)\n", (unsigned)records,
+           (unsigned)RECORD_SIZE, (unsigned)sectors, (unsigned)SECTOR_SIZE, (unsigned)uploadEvery);
+    printf("%-8s %10s %10s %10s %9s %10s %9s %7s %13s %8s\n", "đường", "ghi TB us", "ghi max us", "bản/xóa",
+           "sức chứa", "khởi us", "host us", "đọc", "mòn min-max", "bỏ");
+    printRow("eeprom", runEeprom(path, records, uploadEvery, sectors));
+    printRow("log", runLog(path, records, uploadEvery, sectors));
+
+    bool ok = cuts == 0 || runCuts(path, cuts, sectors, seed);
+    unlink(path);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,568 @@
+// Host build: so sánh và đo các engine suy luận với model_final.h.
+//
+//   g++ -O2 -mavx2 -std=gnu++17 -pthread -Iinclude tools/model_bench.cpp
+//       src/model_engine.cpp src/model_batch.cpp src/model_image.cpp src/model_profile.cpp src/model_registry.cpp src/model_explain.cpp -o model_bench
+//   ./model_bench [--golden model/golden_vectors.csv] [data/model.bin]
+//
+// Bỏ -mavx2 để đo nhánh scalar của predictBatch. Nếu có file mô hình
+// (tools/model_export.py --image), nó được mmap và so với bảng built-in trên cùng lưới.
+// Với --golden chỉ kiểm tra và đo từng định dạng trên các vector mẫu của
+// tools/model_export.py (chạy nhanh, dùng cho model_export.py --bench).
+//
+// Trả về mã lỗi khác 0 nếu có bất kỳ điểm nào mà một engine khác mô hình gốc.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "model_final.h"
+#include "model_table.h"
+#include "model_unrolled.h"
+#include "model_pool.h"
+#include "model_registry.h"
+#include "model_explain.h"
+#include "model_fixed.h"
+#include "model_regions.h"
+#include "model_quantized.h"
+#include "model_compact.h"
+#include "model_batch.h"
+#include "model_image.h"
+#include "model_profile.h"
+
+// Bảng model_table.h trải thành code lúc biên dịch
+typedef UnrolledEnsemble<MODEL_TABLE> UnrolledModel;
+
+// Lưới dày trên miền đầu vào: soil 0..1023 (số nguyên),
+// nhiệt độ -10..60 và độ ẩm 0..100 với bước 0.5
+static const int SOIL_MIN = 0, SOIL_MAX = 1023;
+static const float TEMP_MIN = -10.0f, TEMP_MAX = 60.0f;
+static const float HUM_MIN = 0.0f, HUM_MAX = 100.0f;
+static const float GRID_STEP = 0.5f;
+
+// Số điểm lưới tối đa (phần triệu) mà bản quantized được lật so với model_final.h,
+// như ghi ở MODEL_INFERENCE_QUANTIZED trong config.h (đo được 70 / 29 021 184)
+static const double QUANTIZED_MAX_FLIPS_PPM = 5.0;
+// Bản compact là xấp xỉ (palette lá), không phải bản tương đương: chỉ giới hạn tỉ lệ
+// lật như MODEL_INFERENCE_COMPACT trong config.h (đo được 9782 / 29 021 184)
+static const double COMPACT_MAX_FLIPS_PPM = 400.0;
+
+// Miền số nguyên đầy đủ cho bảng vùng: soil 0..1023, nhiệt độ -40..80, độ ẩm 0..100
+template <typename Fn>
+static void forEachIntegerPoint(Fn fn) {
+    float x[MODEL_FEATURE_COUNT];
+    for (int soil = 0; soil <= 1023; soil++) {
+        x[0] = static_cast<float>(soil);
+        for (int temp = -40; temp <= 80; temp++) {
+            x[1] = static_cast<float>(temp);
+            for (int hum = 0; hum <= 100; hum++) {
+                x[2] = static_cast<float>(hum);
+                fn(x);
+            }
+        }
+    }
+}
+
+template <typename Fn>
+static void forEachGridPoint(Fn fn) {
+    float x[MODEL_FEATURE_COUNT];
+    for (int soil = SOIL_MIN; soil <= SOIL_MAX; soil++) {
+        x[0] = static_cast<float>(soil);
+        for (float temp = TEMP_MIN; temp <= TEMP_MAX; temp += GRID_STEP) {
+            x[1] = temp;
+            for (float hum = HUM_MIN; hum <= HUM_MAX; hum += GRID_STEP) {
+                x[2] = hum;
+                fn(x);
+            }
+        }
+    }
+}
+
+static std::vector<float> sampleInputs() {
+    std::vector<float> samples;
+    forEachGridPoint([&](const float* x) {
+        samples.insert(samples.end(), x, x + MODEL_FEATURE_COUNT);
+    });
+    return samples;
+}
+
+// Quét mọi ô giữa các ngưỡng, đo từng lần gọi bằng TSC
+template <typename Fn>
+static void printWcet(const char* name, const ModelDomainSweep& sweep, Fn fn) {
+    CycleHistogram histogram;
+    uint32_t worst = 0;
+    float worstInput[MODEL_FEATURE_COUNT] = {};
+    float x[MODEL_FEATURE_COUNT];
+    for (uint32_t i = 0; i < sweep.cellCount(); i++) {
+        sweep.point(i, x);
+        uint32_t cycles = measureCycles(fn, x, worst);
+        histogram.record(cycles);
+        if (cycles > worst) {
+            worst = cycles;
+            std::copy_n(x, MODEL_FEATURE_COUNT, worstInput);
+        }
+    }
+    printf("%-12s %8u %8u %8u %8u   soil=%.2f temp=%.2f hum=%.2f\n", name, histogram.min(), histogram.mean(),
+           histogram.percentile(0.99f), histogram.max(), worstInput[0], worstInput[1], worstInput[2]);
+}
+
+// Đổi đầu vào float sang Q20 trước khi đo, để chỉ tính thời gian suy luận fixed-point
+static std::vector<int32_t> toFixedInputs(const std::vector<float>& samples) {
+    std::vector<int32_t> fixed(samples.size());
+    for (size_t i = 0; i < samples.size(); i++) fixed[i] = modelFixedInput(samples[i]);
+    return fixed;
+}
+
+template <typename T, typename Fn>
+static double nsPerCall(const std::vector<T>& samples, Fn fn) {
+    size_t n = samples.size() / MODEL_FEATURE_COUNT;
+    volatile int sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; i++) {
+        sink += fn(&samples[i * MODEL_FEATURE_COUNT]);
+    }
+    auto end = std::chrono::steady_clock::now();
+    (void)sink;
+    return std::chrono::duration<double, std::nano>(end - start).count() / n;
+}
+
+// Đọc golden_vectors.csv: soil,temperature,humidity,margin,decision
+static bool loadGolden(const char* path, std::vector<float>& inputs, std::vector<uint8_t>& expected) {
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    char line[160];
+    while (fgets(line, sizeof(line), f)) {
+        float x[MODEL_FEATURE_COUNT];
+        int decision;
+        if (line[0] == '#' || sscanf(line, "%f,%f,%f,%*f,%d", &x[0], &x[1], &x[2], &decision) != 4) continue;
+        inputs.insert(inputs.end(), x, x + MODEL_FEATURE_COUNT);
+        expected.push_back((uint8_t)decision);
+    }
+    fclose(f);
+    return !expected.empty();
+}
+
+// Lặp lại tập vector cho đủ ~1M lần gọi để thời gian đo ổn định
+template <typename T>
+static std::vector<T> repeatSamples(const std::vector<T>& inputs) {
+    std::vector<T> samples;
+    size_t repeats = 1 + 1000000 / (inputs.size() / MODEL_FEATURE_COUNT);
+    for (size_t r = 0; r < repeats; r++) samples.insert(samples.end(), inputs.begin(), inputs.end());
+    return samples;
+}
+
+template <typename T, typename Fn>
+static size_t goldenRow(const char* name, size_t bytes, const std::vector<T>& inputs,
+                        const std::vector<uint8_t>& expected, Fn fn) {
+    size_t mismatches = 0;
+    for (size_t i = 0; i < expected.size(); i++) {
+        if (fn(&inputs[i * MODEL_FEATURE_COUNT]) != expected[i]) mismatches++;
+    }
+    double ns = nsPerCall(repeatSamples(inputs), fn);
+    if (bytes) {
+        printf("%-12s %10zu %10.1f %10zu\n", name, bytes, ns, mismatches);
+    } else {
+        printf("%-12s %10s %10.1f %10zu\n", name, "(code)", ns, mismatches);
+    }
+    return mismatches;
+}
+
+static int runGolden(const char* path, const char* imagePath) {
+    std::vector<float> inputs;
+    std::vector<uint8_t> expected;
+    if (!loadGolden(path, inputs, expected)) {
+        printf("%s: không có vector\n", path);
+        return 1;
+    }
+    Eloquent::ML::Port::XGBClassifier reference;
+    TreeEnsemble table(MODEL_TABLE);
+    FixedTreeEnsemble fixed(MODEL_FIXED);
+    RegionModel regions(MODEL_REGIONS);
+    QuantizedEnsemble quantized(MODEL_QUANTIZED);
+    CompactEnsemble compact(MODEL_COMPACT);
+    ModelLeafCache cache;
+
+    // Bảng vùng chỉ nhận đầu vào nguyên
+    std::vector<float> integerInputs;
+    std::vector<uint8_t> integerExpected;
+    for (size_t i = 0; i < expected.size(); i++) {
+        const float* x = &inputs[i * MODEL_FEATURE_COUNT];
+        int prediction;
+        if (!regions.lookup(x, prediction)) continue;
+        integerInputs.insert(integerInputs.end(), x, x + MODEL_FEATURE_COUNT);
+        integerExpected.push_back(expected[i]);
+    }
+
+    printf("%s: %zu vectors (%zu integer)\n", path, expected.size(), integerExpected.size());
+    printf("%-12s %10s %10s %10s\n", "format", "bytes", "ns/call", "mismatch");
+    size_t mismatches = 0;
+    mismatches += goldenRow("nested-if", 0, inputs, expected, [&](const float* x) {
+        float input[MODEL_FEATURE_COUNT] = { x[0], x[1], x[2] };
+        return reference.predict(input);
+    });
+    mismatches += goldenRow("unrolled", 0, inputs, expected, [](const float* x) { return UnrolledModel::predict(x); });
+    mismatches += goldenRow("table (full)", table.flashBytes(), inputs, expected,
+                            [&](const float* x) { return table.predictFull(x); });
+    mismatches += goldenRow("table", table.flashBytes(), inputs, expected,
+                            [&](const float* x) { return table.predict(x); });
+    mismatches += goldenRow("incremental", table.flashBytes(), inputs, expected,
+                            [&](const float* x) { return table.predictIncremental(x, cache); });
+    mismatches += goldenRow("fixed", fixed.flashBytes(), toFixedInputs(inputs), expected,
+                            [&](const int32_t* x) { return fixed.predict(x); });
+    mismatches += goldenRow("quantized", quantized.flashBytes(), inputs, expected,
+                            [&](const float* x) { return quantized.predict(x); });
+    // Xấp xỉ (dấu ~): palette lá lệch tới ~0.02 margin, vượt vùng đệm của golden nên không
+    // tính vào lỗi; tỉ lệ lật được giới hạn trên lưới
+    goldenRow("compact~", compact.flashBytes(), inputs, expected, [&](const float* x) { return compact.predict(x); });
+    mismatches += goldenRow("regions", regions.flashBytes(), integerInputs, integerExpected, [&](const float* x) {
+        int prediction = -1;
+        regions.lookup(x, prediction);
+        return prediction;
+    });
+
+    if (imagePath) {
+        ModelImageFile image;
+        ModelImageStatus status = image.open(imagePath);
+        if (status != MODEL_IMAGE_OK) {
+            printf("%s: %s\n", imagePath, modelImageStatusText(status));
+            return 1;
+        }
+        TreeEnsemble loaded(image.tables());
+        size_t bytes = modelImageSize(image.header().treeCount, image.header().nodeCount);
+        mismatches += goldenRow("image", bytes, inputs, expected, [&](const float* x) { return loaded.predict(x); });
+    }
+
+    // Mọi mô hình trong bảng chung một lượt: mô hình 0 so với golden, các mô hình
+    // vùng khác so với TreeEnsemble của chính nó
+    static ModelRegistry registry;
+    for (uint8_t m = 0; m < MODEL_POOL_MODEL_COUNT; m++) {
+        registry.set(m, MODEL_POOL_MODELS[m]);
+    }
+    mismatches += goldenRow("registry", 0, inputs, expected, [&](const float* x) {
+        uint8_t out[MODEL_REGISTRY_MAX_MODELS];
+        registry.predictAll(x, out);
+        return (int)out[0];
+    });
+    size_t poolMismatches = 0;
+    for (size_t i = 0; i < expected.size(); i++) {
+        const float* x = &inputs[i * MODEL_FEATURE_COUNT];
+        uint8_t out[MODEL_REGISTRY_MAX_MODELS];
+        registry.predictAll(x, out);
+        for (uint8_t m = 1; m < MODEL_POOL_MODEL_COUNT; m++) {
+            if (out[m] != TreeEnsemble(MODEL_POOL_MODELS[m]).predictFull(x)) poolMismatches++;
+        }
+        // Đường một vùng (vector riêng) trùng với lượt chung
+        for (uint8_t m = 0; m < MODEL_POOL_MODEL_COUNT; m++) {
+            if (registry.predict(m, x) != out[m]) poolMismatches++;
+        }
+    }
+    printf("%-12s %10u %10u %10zu  (%u models, unique/total trees)\n", "pool", registry.uniqueTrees(),
+           registry.totalTrees(), poolMismatches, (unsigned)registry.modelCount());
+    mismatches += poolMismatches;
+
+    // Giải thích: quyết định trùng golden, bias + đóng góp bằng votes[1] - votes[0], và
+    // bảng tính lúc chạy khớp bảng export (mô hình không có cover)
+    TreeExplainer explainer(MODEL_TABLE, MODEL_TABLE_EXPLAIN);
+    mismatches += goldenRow("explain", MODEL_TABLE_POOL_NODE_COUNT * sizeof(float), inputs, expected,
+                            [&](const float* x) {
+        ModelExplanation e;
+        return explainer.explain(x, e);
+    });
+    std::vector<float> runtimeDeltas(MODEL_TABLE_NODE_COUNT);
+    modelExplainDeltas(MODEL_TABLE, runtimeDeltas.data());
+    float deltaError = 0, marginError = 0;
+    for (int i = 0; i < MODEL_TABLE_NODE_COUNT; i++) {
+        deltaError = std::max(deltaError, fabsf(runtimeDeltas[i] - MODEL_TABLE_EXPLAIN[i]));
+    }
+    for (size_t i = 0; i < expected.size(); i++) {
+        const float* x = &inputs[i * MODEL_FEATURE_COUNT];
+        ModelExplanation e;
+        explainer.explain(x, e);
+        float votes[MODEL_CLASS_COUNT];
+        table.votes(x, votes);
+        marginError = std::max(marginError, fabsf(e.margin - (votes[1] - votes[0])));
+    }
+    printf("%-12s max |bias + contributions - margin| %.2g, max |runtime - export delta| %.2g\n", "",
+           marginError, deltaError);
+    if (marginError > 1e-4f) mismatches++;
+
+    size_t n = expected.size();
+    std::vector<uint8_t> batchOut(n);
+    table.predictBatch(inputs.data(), n, batchOut.data());
+    size_t batchMismatches = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (batchOut[i] != expected[i]) batchMismatches++;
+    }
+    printf("%-12s %10s %10s %10zu\n", "batch", "", "", batchMismatches);
+    mismatches += batchMismatches;
+    return mismatches == 0 ? 0 : 1;
+}
+
+int main(int argc, char** argv) {
+    const char* goldenPath = nullptr;
+    const char* imagePath = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--golden") == 0 && i + 1 < argc) {
+            goldenPath = argv[++i];
+        } else {
+            imagePath = argv[i];
+        }
+    }
+    if (goldenPath) {
+        return runGolden(goldenPath, imagePath);
+    }
+
+    Eloquent::ML::Port::XGBClassifier reference;
+    TreeEnsemble table(MODEL_TABLE);
+    FixedTreeEnsemble fixed(MODEL_FIXED);
+    RegionModel regions(MODEL_REGIONS);
+    QuantizedEnsemble quantized(MODEL_QUANTIZED);
+    CompactEnsemble compact(MODEL_COMPACT);
+
+    // 1. Kiểm tra trùng khớp
+    size_t points = 0, mismatches = 0, positives = 0, quantizedFlips = 0, compactFlips = 0, fixedFlips = 0;
+    size_t unrolledMismatches = 0;
+    uint64_t tableTrees = 0, quantizedTrees = 0, fixedTrees = 0;
+    forEachGridPoint([&](const float* x) {
+        float input[MODEL_FEATURE_COUNT] = { x[0], x[1], x[2] };
+        int expected = reference.predict(input);
+        uint16_t trees = 0, qTrees = 0;
+        int got = table.predictEarlyExit(x, &trees);
+        if (table.predictFull(x) != got || table.predict(x) != got) got = -1;
+        tableTrees += trees;
+        // Cùng bảng, cùng thứ tự cộng: phải trùng bit với table kể cả sát ngưỡng
+        if (UnrolledModel::predict(x) != expected) unrolledMismatches++;
+        points++;
+        positives += expected;
+        // Cộng lá fixed-point chỉ có thể lệch sát ngưỡng quyết định
+        if (quantized.predict(x, &qTrees) != expected) quantizedFlips++;
+        if (compact.predict(x) != expected) compactFlips++;
+        quantizedTrees += qTrees;
+        int32_t xq[MODEL_FEATURE_COUNT] = { modelFixedInput(x[0]), modelFixedInput(x[1]), modelFixedInput(x[2]) };
+        uint16_t fTrees = 0;
+        int fixedGot = fixed.predictEarlyExit(xq, &fTrees);
+        fixedTrees += fTrees;
+        // Dừng sớm của bản fixed là chính xác: phải trùng với cộng đủ cây
+        if (fixedGot != fixed.predictFull(xq) || fixed.predict(xq) != fixedGot) got = -1;
+        if (fixedGot != expected) fixedFlips++;
+        if (got != expected) {
+            if (mismatches < 10) {
+                printf("MISMATCH soil=%.0f temp=%.1f hum=%.1f: nested-if=%d table=%d\n",
+                       x[0], x[1], x[2], expected, got);
+            }
+            mismatches++;
+        }
+    });
+    printf("Agreement (table): %zu points, %zu positive, %zu mismatches\n", points, positives, mismatches);
+    printf("Agreement (unrolled): %zu mismatches\n", unrolledMismatches);
+    mismatches += unrolledMismatches;
+    printf("Agreement (fixed Q%d/Q%d): %zu boundary flips\n", MODEL_FIXED_INPUT_Q_BITS, MODEL_FIXED_LEAF_Q_BITS, fixedFlips);
+    printf("Agreement (quantized Q%d): %zu boundary flips (%.1f ppm, max %.1f)\n", MODEL_QUANTIZED_Q_BITS,
+           quantizedFlips, 1e6 * quantizedFlips / points, QUANTIZED_MAX_FLIPS_PPM);
+    if (quantizedFlips > points * QUANTIZED_MAX_FLIPS_PPM / 1e6) mismatches++;
+    printf("Approximation (compact, palette %d): %zu boundary flips (%.1f ppm, max %.1f)\n",
+           MODEL_COMPACT_PALETTE_SIZE, compactFlips, 1e6 * compactFlips / points, COMPACT_MAX_FLIPS_PPM);
+    if (compactFlips > points * COMPACT_MAX_FLIPS_PPM / 1e6) mismatches++;
+    printf("Early exit: table %.1f, fixed %.1f, quantized %.1f of %d trees per call\n", (double)tableTrees / points,
+           (double)fixedTrees / points, (double)quantizedTrees / points, MODEL_TABLE_TREE_COUNT);
+
+    // Bảng fixed đổi lúc chạy từ MODEL_TABLE (đường nạp ảnh mô hình) phải trùng model_fixed.h
+    std::vector<ModelFixedNode> fixedNodes(MODEL_TABLE_NODE_COUNT);
+    std::vector<int32_t> fixedMargins(2 * (MODEL_TABLE_TREE_COUNT + 1));
+    ModelFixedTables converted = toFixedTables(MODEL_TABLE, fixedNodes.data(), fixedMargins.data());
+    size_t conversionMismatches = converted.logitThreshold != MODEL_FIXED.logitThreshold || !converted.marginMin;
+    for (int i = 0; i < MODEL_TABLE_NODE_COUNT; i++) {
+        const ModelFixedNode& a = converted.nodes[i];
+        const ModelFixedNode& b = MODEL_FIXED.nodes[i];
+        if (a.feature != b.feature || a.right != b.right || a.value != b.value) conversionMismatches++;
+    }
+    for (int t = 0; converted.marginMin && t <= MODEL_TABLE_TREE_COUNT; t++) {
+        if (converted.marginMin[t] != MODEL_FIXED.marginMin[t] || converted.marginMax[t] != MODEL_FIXED.marginMax[t]) {
+            conversionMismatches++;
+        }
+    }
+    printf("Agreement (toFixedTables vs model_fixed.h): %zu mismatches\n", conversionMismatches);
+    mismatches += conversionMismatches;
+
+    size_t regionPoints = 0, regionMismatches = 0;
+    forEachIntegerPoint([&](const float* x) {
+        float input[MODEL_FEATURE_COUNT] = { x[0], x[1], x[2] };
+        int expected = reference.predict(input);
+        int got = -1;
+        regionPoints++;
+        if (!regions.lookup(x, got) || got != expected) {
+            if (regionMismatches < 10) {
+                printf("MISMATCH soil=%.0f temp=%.0f hum=%.0f: nested-if=%d regions=%d\n",
+                       x[0], x[1], x[2], expected, got);
+            }
+            regionMismatches++;
+        }
+    });
+    float fractional[MODEL_FEATURE_COUNT] = { 500.0f, 25.5f, 60.0f };
+    int unused;
+    if (regions.lookup(fractional, unused)) {
+        printf("regions: lookup must reject non-integer input\n");
+        regionMismatches++;
+    }
+    printf("Agreement (regions): %zu points, %zu mismatches\n", regionPoints, regionMismatches);
+    mismatches += regionMismatches;
+
+    // Cảm biến trôi chậm giữa các lần đọc: soil đổi vài đơn vị, nhiệt độ và độ ẩm
+    // DHT11 thỉnh thoảng đổi 1 độ. predictIncremental phải trùng với predictFull
+    std::vector<float> drift;
+    {
+        std::mt19937 rng(7);
+        std::uniform_int_distribution<int> soilStep(-3, 3), tick(0, 19);
+        float x[MODEL_FEATURE_COUNT] = { 500.0f, 28.0f, 60.0f };
+        for (int i = 0; i < 2000000; i++) {
+            x[0] = std::min(1023.0f, std::max(0.0f, x[0] + soilStep(rng)));
+            if (tick(rng) == 0) x[1] = std::min(45.0f, std::max(10.0f, x[1] + (tick(rng) < 10 ? 1 : -1)));
+            if (tick(rng) < 2) x[2] = std::min(100.0f, std::max(20.0f, x[2] + (tick(rng) < 10 ? 1 : -1)));
+            drift.insert(drift.end(), x, x + MODEL_FEATURE_COUNT);
+        }
+    }
+    ModelLeafCache cache;
+    size_t driftMismatches = 0;
+    for (size_t i = 0; i < drift.size(); i += MODEL_FEATURE_COUNT) {
+        if (table.predictIncremental(&drift[i], cache) != table.predictFull(&drift[i])) driftMismatches++;
+    }
+    printf("Agreement (incremental): %zu samples, %zu mismatches, leaf cache %.1f%% hit\n",
+           drift.size() / MODEL_FEATURE_COUNT, driftMismatches, 100.0 * cache.hits / (cache.hits + cache.misses));
+    mismatches += driftMismatches;
+
+    std::vector<int32_t> fixedDrift = toFixedInputs(drift);
+    ModelFixedLeafCache fixedCache;
+    size_t fixedDriftMismatches = 0;
+    for (size_t i = 0; i < fixedDrift.size(); i += MODEL_FEATURE_COUNT) {
+        if (fixed.predictIncremental(&fixedDrift[i], fixedCache) != fixed.predictFull(&fixedDrift[i])) fixedDriftMismatches++;
+    }
+    printf("Agreement (fixed incremental): %zu mismatches\n", fixedDriftMismatches);
+    mismatches += fixedDriftMismatches;
+
+    if (imagePath) {
+        ModelImageFile image;
+        ModelImageStatus status = image.open(imagePath);
+        if (status != MODEL_IMAGE_OK) {
+            printf("%s: %s\n", imagePath, modelImageStatusText(status));
+            return 1;
+        }
+        TreeEnsemble loaded(image.tables());
+        size_t imageMismatches = 0;
+        forEachGridPoint([&](const float* x) {
+            if (loaded.predict(x) != table.predict(x)) imageMismatches++;
+        });
+        printf("Agreement (image v%u, %u nodes): %zu mismatches\n",
+               (unsigned)image.header().modelVersion, (unsigned)image.header().nodeCount, imageMismatches);
+        mismatches += imageMismatches;
+    }
+
+    // 2. Kích thước và thời gian
+    std::vector<float> samples = sampleInputs();
+    double nestedNs = nsPerCall(samples, [&](const float* x) {
+        float input[MODEL_FEATURE_COUNT] = { x[0], x[1], x[2] };
+        return reference.predict(input);
+    });
+    double unrolledNs = nsPerCall(samples, [](const float* x) { return UnrolledModel::predict(x); });
+    double tableFullNs = nsPerCall(samples, [&](const float* x) { return table.predictFull(x); });
+    double tableEarlyNs = nsPerCall(samples, [&](const float* x) { return table.predictEarlyExit(x); });
+    std::vector<int32_t> fixedSamples = toFixedInputs(samples);
+    double fixedFullNs = nsPerCall(fixedSamples, [&](const int32_t* x) { return fixed.predictFull(x); });
+    double fixedEarlyNs = nsPerCall(fixedSamples, [&](const int32_t* x) { return fixed.predictEarlyExit(x); });
+    double quantizedNs = nsPerCall(samples, [&](const float* x) { return quantized.predict(x); });
+    double compactNs = nsPerCall(samples, [&](const float* x) { return compact.predict(x); });
+
+    std::vector<float> integerSamples;
+    forEachIntegerPoint([&](const float* x) {
+        integerSamples.insert(integerSamples.end(), x, x + MODEL_FEATURE_COUNT);
+    });
+    double regionNs = nsPerCall(integerSamples, [&](const float* x) {
+        int prediction = 0;
+        regions.lookup(x, prediction);
+        return prediction;
+    });
+
+    double driftFullNs = nsPerCall(drift, [&](const float* x) { return table.predictFull(x); });
+    ModelLeafCache timingCache;
+    double driftIncrementalNs = nsPerCall(drift, [&](const float* x) { return table.predictIncremental(x, timingCache); });
+
+    // 3. Suy luận theo lô: so với vòng lặp predictFull từng mẫu. Xáo trộn thứ tự mẫu
+    // để vòng lặp scalar không được lợi từ dự đoán rẽ nhánh trên lưới có thứ tự
+    size_t n = samples.size() / MODEL_FEATURE_COUNT;
+    std::vector<size_t> order(n);
+    for (size_t i = 0; i < n; i++) order[i] = i;
+    std::shuffle(order.begin(), order.end(), std::mt19937(42));
+    std::vector<float> shuffled(samples.size());
+    for (size_t i = 0; i < n; i++) {
+        std::copy_n(&samples[order[i] * MODEL_FEATURE_COUNT], MODEL_FEATURE_COUNT, &shuffled[i * MODEL_FEATURE_COUNT]);
+    }
+    samples.swap(shuffled);
+    double scalarLoopNs = nsPerCall(samples, [&](const float* x) { return table.predictFull(x); });
+    std::vector<uint8_t> batchOut(n), parallelOut(n);
+    auto timeBatch = [&](auto fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        return n / std::chrono::duration<double>(end - start).count();
+    };
+    double batchRate = timeBatch([&]() { table.predictBatch(samples.data(), n, batchOut.data()); });
+    double parallelRate = timeBatch([&]() { predictBatchParallel(table, samples.data(), n, parallelOut.data()); });
+    size_t batchMismatches = 0;
+    for (size_t i = 0; i < n; i++) {
+        int expected = table.predictFull(&samples[i * MODEL_FEATURE_COUNT]);
+        if (batchOut[i] != expected || parallelOut[i] != expected) batchMismatches++;
+    }
+    printf("Agreement (batch): %zu samples, %zu mismatches\n", n, batchMismatches);
+    mismatches += batchMismatches;
+
+    printf("%-12s %12s %12s\n", "engine", "table bytes", "ns/call");
+    printf("%-12s %12s %12.1f\n", "nested-if", "(code)", nestedNs);
+    printf("%-12s %12s %12.1f\n", "unrolled", "(code)", unrolledNs);
+    printf("%-12s %12zu %12.1f\n", "table (full)", table.flashBytes(), tableFullNs);
+    printf("%-12s %12zu %12.1f\n", "table (early)", table.flashBytes(), tableEarlyNs);
+    printf("%-12s %12zu %12.1f\n", "fixed (full)", fixed.flashBytes(), fixedFullNs);
+    printf("%-12s %12zu %12.1f\n", "fixed (early)", fixed.flashBytes(), fixedEarlyNs);
+    printf("%-12s %12zu %12.1f\n", "quantized", quantized.flashBytes(), quantizedNs);
+    printf("%-12s %12zu %12.1f\n", "compact", compact.flashBytes(), compactNs);
+    printf("%-12s %12zu %12.1f\n", "regions", regions.flashBytes(), regionNs);
+    printf("%-12s %12s %12.1f  (drift; full walk %.1f)\n", "incremental", "(RAM)", driftIncrementalNs, driftFullNs);
+
+    // 4. WCET: một điểm mỗi ô giữa các ngưỡng là đủ mọi tổ hợp đường đi
+    ModelDomainSweep sweep(MODEL_TABLE);
+    printf("WCET sweep: %u cells%s, TSC ticks per call\n", sweep.cellCount(), sweep.complete() ? "" : " (incomplete)");
+    printf("%-12s %8s %8s %8s %8s   worst input\n", "engine", "min", "mean", "p99", "max");
+    printWcet("nested-if", sweep, [&](const float* x) {
+        float input[MODEL_FEATURE_COUNT] = { x[0], x[1], x[2] };
+        return reference.predict(input);
+    });
+    printWcet("unrolled", sweep, [](const float* x) { return UnrolledModel::predict(x); });
+    printWcet("table (full)", sweep, [&](const float* x) { return table.predictFull(x); });
+    printWcet("table (early)", sweep, [&](const float* x) { return table.predictEarlyExit(x); });
+    // Bản fixed tính cả bước đổi đầu vào sang Q20 (3 phép nhân float)
+    printWcet("fixed", sweep, [&](const float* x) {
+        int32_t xq[MODEL_FEATURE_COUNT] = { modelFixedInput(x[0]), modelFixedInput(x[1]), modelFixedInput(x[2]) };
+        return fixed.predict(xq);
+    });
+    printWcet("quantized", sweep, [&](const float* x) { return quantized.predict(x); });
+    printWcet("compact", sweep, [&](const float* x) { return compact.predict(x); });
+
+#if defined(__AVX2__)
+    const char* batchKind = "AVX2";
+#elif defined(__ARM_NEON)
+    const char* batchKind = "NEON";
+#else
+    const char* batchKind = "scalar";
+#endif
+    printf("%-24s %14.0f samples/s\n", "scalar loop (full)", 1e9 / scalarLoopNs);
+    printf("%-24s %14.0f samples/s (%s)\n", "predictBatch", batchRate, batchKind);
+    printf("%-24s %14.0f samples/s (%u threads)\n", "predictBatchParallel", parallelRate,
+           std::thread::hardware_concurrency());
+
+    return mismatches == 0 ? 0 : 1;
+}
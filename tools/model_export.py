@@ -0,0 +1,1331 @@
+#!/usr/bin/env python3
+"""Export the irrigation XGBoost model into every inference format used by the firmware.
+
+Usage:
+    python3 tools/model_export.py [--model model/irrigation_xgb.json] [--out-dir include]
+                                  [--golden model/golden_vectors.csv] [--bench]
+                                  [--image data/model.bin --model-version N]
+    python3 tools/model_export.py --import-header include/model_final.h --write-json model/irrigation_xgb.json
+
+The input is an XGBoost JSON model: either `Booster.dump_model(path, dump_format="json")`
+or `Booster.save_model("model.json")`. XGBoost sends `x < split_condition` left; the
+firmware formats use `x <= t`, so t is the float32 just below split_condition.
+
+Split features are named f0.. or by the feature store layout (include/feature_store.h,
+FEATURE_LAYOUT_NAMES); the engines read its first three entries, and model_table.h records
+the layout version so firmware built against another layout fails to compile.
+
+This script is the single source of the decision threshold (--threshold, default
+DECISION_THRESHOLD). Outputs:
+    include/model_final.h      nested-if classifier (Eloquent::ML::Port::XGBClassifier)
+    include/model_table.h      constexpr float node array (TreeEnsemble, UnrolledEnsemble) and
+                               per-node path contributions (TreeExplainer)
+    include/model_pool.h       per-zone models (--zone-model) sharing model_table.h's node array (ModelRegistry)
+    include/model_fixed.h      same nodes in Q20/Q24 integers (FixedTreeEnsemble)
+    include/model_quantized.h  integer-bin nodes with fixed-point leaves (QuantizedEnsemble)
+    include/model_compact.h    shared-subtree DAG with a 256-entry leaf palette (CompactEnsemble)
+    include/model_regions.h    integer decision regions, built with tools/model_regions.cpp (RegionModel)
+    model/golden_vectors.csv   inputs with the reference margin and decision
+    --image                    binary image loaded at runtime (include/model_image.h)
+    --bench                    builds tools/model_bench.cpp, times every format on the golden vectors
+                               and compares host code size of nested-if, unrolled and table
+
+--import-header reads a micromlgen-style nested-if header instead, and --write-json
+converts it to the dump format above.
+"""
+
+import argparse
+import bisect
+import json
+import math
+import os
+import random
+import re
+import struct
+import subprocess
+import sys
+import tempfile
+import zlib
+
+# Đầu vào của các engine (MODEL_FEATURE_COUNT): phải là các mục đầu của bố cục
+# vector đặc trưng trong include/feature_store.h
+FEATURE_NAMES = ["soil", "temperature", "humidity"]
+FEATURE_LAYOUT_VERSION = None
+FEATURE_LAYOUT = list(FEATURE_NAMES)
+
+# Ngưỡng xác suất tưới: prob(lớp 1) >= DECISION_THRESHOLD. Mọi định dạng lấy từ đây
+DECISION_THRESHOLD = "0.540"
+
+TOKEN_RE = re.compile(
+    r"//\s*tree #(?P<tree>\d+)"
+    r"|if \(x\[(?P<feat>\d+)\] (?P<op><=?) (?P<thr>[-0-9.eE+]+)(?P<f32>f?)\)"
+    r"|votes\[(?P<cls>\d+)\] \+= (?P<leaf>[-0-9.eE+]+);"
+    r"|(?P<else>else)"
+    r"|(?P<open>\{)"
+    r"|(?P<close>\})"
+)
+
+
+class Node:
+    """A tree node. Leaves have feature None and carry `leaf`."""
+
+    def __init__(self, feature=None, threshold=None, left=None, right=None, leaf=None, klass=None, cover=None):
+        self.feature = feature
+        self.threshold = threshold  # float32 t, x <= t goes left
+        self.left = left
+        self.right = right
+        self.leaf = leaf            # decimal literal as written in the source
+        self.klass = klass
+        self.cover = cover          # tổng hessian của mẫu train qua node, None nếu file không có
+
+    def is_leaf(self):
+        return self.feature is None
+
+
+class Tree:
+    def __init__(self, klass, root):
+        self.klass = klass
+        self.root = root
+
+
+# ---------------------------------------------------------------------------
+# Input: nested-if header
+# ---------------------------------------------------------------------------
+
+def parse_eloquent_header(path):
+    text = open(path, encoding="utf-8").read()
+    start = text.index("float votes[2]")
+    end = text.index("// return argmax")
+    tokens = [m for m in TOKEN_RE.finditer(text[start:end])]
+    pos = 0
+
+    def skip_braces_until_tree():
+        nonlocal pos
+        while pos < len(tokens) and tokens[pos].group("tree") is None:
+            pos += 1
+
+    def expect(kind):
+        nonlocal pos
+        if tokens[pos].group(kind) is None:
+            raise ValueError("expected %s near token %d: %r" % (kind, pos, tokens[pos].group(0)))
+        pos += 1
+
+    def parse_block():
+        """Parse `{ <statement> }`."""
+        expect("open")
+        node = parse_statement()
+        expect("close")
+        return node
+
+    def parse_statement():
+        nonlocal pos
+        tok = tokens[pos]
+        if tok.group("leaf") is not None:
+            pos += 1
+            return Node(leaf=tok.group("leaf"), klass=int(tok.group("cls")))
+        if tok.group("feat") is not None:
+            pos += 1
+            left = parse_block()
+            expect("else")
+            right = parse_block()
+            return Node(feature=int(tok.group("feat")), threshold=header_threshold(tok), left=left, right=right)
+        raise ValueError("unexpected token %r" % tok.group(0))
+
+    trees = []
+    skip_braces_until_tree()
+    while pos < len(tokens):
+        expect("tree")
+        root = parse_statement()
+        klass = first_leaf(root).klass
+        trees.append(Tree(klass, root))
+        skip_braces_until_tree()
+    return trees
+
+
+def header_threshold(tok):
+    """float32 t for a parsed `x <= d` (micromlgen, d is a double literal) or `x < cf`."""
+    if tok.group("op") == "<=":
+        if tok.group("f32"):
+            return f32_nearest(float(tok.group("thr")))
+        return f32_round_down(tok.group("thr"))
+    if not tok.group("f32"):
+        raise ValueError("`x < %s` needs a float literal" % tok.group("thr"))
+    return f32_step(f32_nearest(float(tok.group("thr"))), False)
+
+
+def first_leaf(node):
+    while not node.is_leaf():
+        node = node.left
+    return node
+
+
+# ---------------------------------------------------------------------------
+# Input/output: XGBoost JSON
+# ---------------------------------------------------------------------------
+
+def read_feature_layout(path):
+    """FEATURE_LAYOUT_VERSION and FEATURE_LAYOUT_NAMES from include/feature_store.h."""
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    version = re.search(r"#define FEATURE_LAYOUT_VERSION (\d+)", text)
+    names = re.search(r"#define FEATURE_LAYOUT_NAMES \{(.*?)\}", text, re.S)
+    if not version or not names:
+        raise ValueError("%s: FEATURE_LAYOUT_VERSION / FEATURE_LAYOUT_NAMES not found" % path)
+    layout = re.findall(r'"(\w+)"', names.group(1))
+    if layout[:len(FEATURE_NAMES)] != FEATURE_NAMES:
+        raise ValueError("%s: layout must start with %s" % (path, ", ".join(FEATURE_NAMES)))
+    return int(version.group(1)), layout
+
+
+def feature_index(split):
+    """XGBoost names features f0, f1, ... unless the booster was given feature names."""
+    if split in FEATURE_LAYOUT:
+        index = FEATURE_LAYOUT.index(split)
+        if index >= len(FEATURE_NAMES):
+            raise ValueError("feature %r is entry %d of the feature store layout, the engines read the first %d"
+                             " (MODEL_FEATURE_COUNT)" % (split, index, len(FEATURE_NAMES)))
+        return index
+    match = re.fullmatch(r"f(\d+)", split)
+    if not match or int(match.group(1)) >= len(FEATURE_NAMES):
+        raise ValueError("unknown feature %r (expected f0..f%d or %s)"
+                         % (split, len(FEATURE_NAMES) - 1, ", ".join(FEATURE_NAMES)))
+    return int(match.group(1))
+
+
+def xgboost_threshold(split_condition):
+    """`x < c` in float32 is `x <= t` with t the float32 just below c."""
+    c = f32_nearest(float(split_condition))
+    return f32_step(c, False)
+
+
+def tree_class(index, num_class):
+    # multi:softprob xếp cây theo vòng: cây i thuộc lớp i % num_class. binary:logistic
+    # chỉ có một lớp, và softmax(0, v) = sigmoid(v) nên dồn hết vào votes[1]
+    return index % num_class if num_class > 1 else 1
+
+
+def parse_dump_node(obj, klass):
+    # dump_model(with_stats=True) ghi thêm cover
+    cover = float(obj["cover"]) if "cover" in obj else None
+    if "leaf" in obj:
+        return Node(leaf=str(obj["leaf"]), klass=klass, cover=cover)
+    if "split_condition" not in obj:
+        raise ValueError("node %s has no split_condition (categorical splits are not supported)" % obj.get("nodeid"))
+    children = {child["nodeid"]: child for child in obj["children"]}
+    return Node(feature=feature_index(obj["split"]),
+                threshold=xgboost_threshold(obj["split_condition"]),
+                left=parse_dump_node(children[obj["yes"]], klass),
+                right=parse_dump_node(children[obj["no"]], klass), cover=cover)
+
+
+def parse_saved_tree(tree, klass, names):
+    left, right = tree["left_children"], tree["right_children"]
+    features, conditions = tree["split_indices"], tree["split_conditions"]
+    hessians = tree.get("sum_hessian")
+    if any(int(t) for t in tree.get("split_type", [])):
+        raise ValueError("categorical splits are not supported")
+
+    def visit(i):
+        cover = float(hessians[i]) if hessians else None
+        if int(left[i]) == -1:
+            # Nút lá: split_conditions giữ giá trị lá (đã nhân learning rate)
+            return Node(leaf=str(conditions[i]), klass=klass, cover=cover)
+        # Booster có feature_names thì split_indices đánh số theo danh sách đó
+        index = int(features[i])
+        return Node(feature=feature_index(names[index] if names else "f%d" % index),
+                    threshold=xgboost_threshold(conditions[i]),
+                    left=visit(int(left[i])), right=visit(int(right[i])), cover=cover)
+
+    return visit(0)
+
+
+def parse_xgboost_json(path, num_class):
+    """Trees from dump_model(dump_format="json") or save_model JSON.
+
+    Numbers are kept as the decimal text of the file so leaves reach the headers
+    exactly as XGBoost wrote them."""
+    with open(path, encoding="utf-8") as f:
+        data = json.load(f, parse_float=str)
+
+    if isinstance(data, dict):
+        learner = data["learner"]
+        objective = learner.get("objective", {}).get("name", "")
+        params = learner["learner_model_param"]
+        num_class = int(params.get("num_class", 0))
+        if num_class <= 1 and float(params.get("base_score", 0.5)) != 0.5:
+            # Lớp đơn cộng logit(base_score) vào margin, engine không có hệ số tự do
+            raise ValueError("%s with base_score %s needs a bias term" % (objective, params["base_score"]))
+        if num_class > 2:
+            raise ValueError("%d classes, the firmware engines are binary" % num_class)
+        model = learner["gradient_booster"]["model"]
+        names = learner.get("feature_names") or []
+        trees = []
+        for tree, info in zip(model["trees"], model["tree_info"]):
+            klass = int(info) if num_class > 1 else 1
+            trees.append(Tree(klass, parse_saved_tree(tree, klass, names)))
+        return trees
+
+    trees = []
+    for i, item in enumerate(data):
+        # Booster.get_dump(dump_format="json") trả về list chuỗi JSON
+        if isinstance(item, str):
+            item = json.loads(item, parse_float=str)
+        klass = tree_class(i, num_class)
+        trees.append(Tree(klass, parse_dump_node(item, klass)))
+    return trees
+
+
+def write_xgboost_json(trees, path):
+    """Write trees in the dump_model(dump_format="json") layout, node ids allocated
+    breadth-first like XGBoost."""
+
+    def dump(root):
+        ids = {id(root): 0}
+        queue = [root]
+        while queue:
+            node = queue.pop(0)
+            if not node.is_leaf():
+                for child in (node.left, node.right):
+                    ids[id(child)] = len(ids)
+                    queue.append(child)
+
+        def visit(node, depth):
+            if node.is_leaf():
+                return {"nodeid": ids[id(node)], "leaf": float(node.leaf)}
+            left, right = ids[id(node.left)], ids[id(node.right)]
+            condition = f32_step(node.threshold, True)
+            return {"nodeid": ids[id(node)], "depth": depth, "split": "f%d" % node.feature,
+                    "split_condition": float(f32_literal(condition)), "yes": left, "no": right,
+                    "missing": left, "children": [visit(node.left, depth + 1), visit(node.right, depth + 1)]}
+
+        return visit(root, 0)
+
+    classes = [t.klass for t in trees]
+    if classes != [tree_class(i, 2) for i in range(len(trees))]:
+        raise ValueError("tree classes do not follow the multi:softprob round-robin order")
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        json.dump([dump(t.root) for t in trees], f, indent=1)
+        f.write("\n")
+
+
+# ---------------------------------------------------------------------------
+# float32 helpers
+# ---------------------------------------------------------------------------
+
+def f32_bits(value):
+    return struct.unpack("<I", struct.pack("<f", value))[0]
+
+
+def f32_from_bits(bits):
+    return struct.unpack("<f", struct.pack("<I", bits))[0]
+
+
+def f32_nearest(value):
+    return struct.unpack("<f", struct.pack("<f", float(value)))[0]
+
+
+def f32_round_down(value):
+    """Largest float32 <= value, so `(float)x <= t` matches `(double)x <= value`."""
+    value = float(value)
+    f = f32_nearest(value)
+    if f <= value:
+        return f
+    bits = f32_bits(f)
+    if f > 0:
+        bits -= 1
+    elif f == 0:
+        bits = 0x80000001
+    else:
+        bits += 1
+    return f32_from_bits(bits)
+
+
+def f32_step(f, up):
+    """Neighbouring float32 of float32 f towards +inf (up) or -inf."""
+    if f == 0:
+        return f32_from_bits(1 if up else 0x80000001)
+    bits = f32_bits(f)
+    bits += 1 if (f > 0) == up else -1
+    return f32_from_bits(bits)
+
+
+def f32_literal(f):
+    """Shortest decimal that reads back as float32 f."""
+    for digits in range(1, 10):
+        text = "%.*g" % (digits, f)
+        if f32_nearest(float(text)) == f:
+            return text
+    return "%.9g" % f
+
+
+def c_float(value):
+    text = "%.9g" % value
+    if "e" not in text and "." not in text:
+        text += ".0"
+    return text + "f"
+
+
+# ---------------------------------------------------------------------------
+# Output: nested-if classifier (micromlgen layout)
+# ---------------------------------------------------------------------------
+
+NESTED_INDENT = 24
+
+
+def emit_nested_if(trees, threshold, source, path):
+    """XGBClassifier with one if/else per split. Splits are written as XGBoost
+    evaluates them, `x < c` with c a float literal, so the header is exact for
+    every float input."""
+    out = [header_banner("model_final.h", source)]
+    out.append("#pragma once\n#include <cstdarg>\n#include <math.h>\n")
+    out.append("namespace Eloquent {\n    namespace ML {\n        namespace Port {\n")
+    out.append("            class XGBClassifier {\n                public:\n")
+    out.append("                    /**\n                    * Predict class for features vector\n                    */\n")
+    out.append("                    int predict(float *x) {\n")
+    out.append("                        float votes[2] = { 0.0f };\n")
+
+    def visit(node, depth):
+        pad = " " * (NESTED_INDENT + 4 * depth)
+        if node.is_leaf():
+            out.append("%svotes[%d] += %s;\n" % (pad, node.klass, node.leaf))
+            return
+        out.append("%sif (x[%d] < %sf) {\n" % (pad, node.feature, f32_literal(f32_step(node.threshold, True))))
+        visit(node.left, depth + 1)
+        out.append("%s}\n\n%selse {\n" % (pad, pad))
+        visit(node.right, depth + 1)
+        out.append("%s}\n" % pad)
+
+    for i, tree in enumerate(trees):
+        out.append("%s// tree #%d\n" % (" " * NESTED_INDENT, i + 1))
+        visit(tree.root, 0)
+        out.append("\n")
+
+    pad = " " * NESTED_INDENT
+    out.append("%s// return argmax of votes\n\n" % pad)
+    out.append("%sfloat exp0 = exp(votes[0]);\n" % pad)
+    out.append("%sfloat exp1 = exp(votes[1]);\n" % pad)
+    out.append("%sfloat prob = exp1 / (exp0 + exp1);\n" % pad)
+    out.append("%sif (prob >= %s)\n%s    return 1;\n%selse\n%s    return 0;\n" % (pad, threshold, pad, pad, pad))
+    out.append("                    }\n\n                protected:\n                };\n")
+    out.append("            }\n        }\n    }\n")
+    write_file(path, "".join(out))
+    return sum(1 for t in trees for _ in internal_nodes(t.root))
+
+
+# ---------------------------------------------------------------------------
+# Output: flat node table
+# ---------------------------------------------------------------------------
+
+LEAF_FEATURE = 0xFF
+
+
+def flatten_preorder(trees):
+    """Return (nodes, roots). Left child is always the next node (preorder)."""
+    nodes = []
+    roots = []
+
+    def visit(node):
+        index = len(nodes)
+        if node.is_leaf():
+            nodes.append([LEAF_FEATURE, 0, f32_nearest(node.leaf)])
+            return index
+        nodes.append([node.feature, 0, node.threshold])
+        visit(node.left)
+        nodes[index][1] = visit(node.right)
+        return index
+
+    for tree in trees:
+        roots.append(visit(tree.root))
+    return nodes, roots
+
+
+def leaf_values(node):
+    if node.is_leaf():
+        return [node.leaf]
+    return leaf_values(node.left) + leaf_values(node.right)
+
+
+def margin_suffix_bounds(trees, leaf):
+    """Bounds of votes[1] - votes[0] still reachable from tree i onward.
+
+    `leaf` maps a leaf literal to the number type used by the engine. Returns
+    (lo, hi) lists of length len(trees) + 1; entry i covers trees i..end.
+    """
+    lo = [0] * (len(trees) + 1)
+    hi = [0] * (len(trees) + 1)
+    for i in range(len(trees) - 1, -1, -1):
+        values = [leaf(v) for v in leaf_values(trees[i].root)]
+        sign = 1 if trees[i].klass == 1 else -1
+        contributions = [sign * v for v in values]
+        lo[i] = lo[i + 1] + min(contributions)
+        hi[i] = hi[i + 1] + max(contributions)
+    return lo, hi
+
+
+def explain_deltas(tree):
+    """Saabas path contributions for one tree, aligned with flatten_preorder([tree]).
+
+    E(node) is the cover-weighted mean of the leaves below it (both children weigh
+    the same when the model has no cover). The root entry is E(root), every other
+    entry E(node) - E(parent): walking to a leaf and adding each step to the
+    parent's split feature splits the leaf value into bias + contributions."""
+    def expected(node):
+        if node.is_leaf():
+            return float(node.leaf)
+        left, right = expected(node.left), expected(node.right)
+        if node.left.cover and node.right.cover:
+            return (left * node.left.cover + right * node.right.cover) / (node.left.cover + node.right.cover)
+        return (left + right) / 2
+
+    deltas = []
+
+    def visit(node, parent):
+        value = expected(node)
+        deltas.append(value - parent)
+        if not node.is_leaf():
+            visit(node.left, value)
+            visit(node.right, value)
+
+    visit(tree.root, 0.0)
+    return deltas
+
+
+def f32_outward(value, down):
+    """float32 gần nhất nhưng không làm hẹp khoảng (làm tròn ra ngoài)."""
+    f = f32_nearest(value)
+    if down and f > value:
+        return f32_round_down(value)
+    if not down and f < value:
+        return -f32_round_down(-value)
+    return f
+
+
+def header_banner(name, source):
+    return (
+        "// %s\n"
+        "// Sinh tự động bởi tools/model_export.py từ %s - không sửa tay.\n\n" % (name, source)
+    )
+
+
+def build_pool(models):
+    """Shared node pool for several models: the trees of model 0 in flatten_preorder
+    layout, then each tree of the other models that is not already in the pool.
+    Returns (pool nodes, roots of every model, explain_deltas of the pool)."""
+    pool = []
+    deltas = []
+    known = {}
+    model_roots = []
+    for index, trees in enumerate(models):
+        roots = []
+        for tree in trees:
+            nodes, _ = flatten_preorder([tree])
+            tree_deltas = explain_deltas(tree)
+            # Cây cùng node nhưng khác cover thì giải thích khác nhau: không gộp
+            key = (tuple(tuple(node) for node in nodes), tuple(tree_deltas))
+            # Mô hình 0 giữ nguyên bố cục của model_table.h, kể cả cây trùng
+            if index == 0 or key not in known:
+                offset = len(pool)
+                pool.extend([f, r + offset if f != LEAF_FEATURE else 0, v] for f, r, v in nodes)
+                deltas.extend(tree_deltas)
+                known.setdefault(key, offset)
+                roots.append(offset)
+            else:
+                roots.append(known[key])
+        model_roots.append(roots)
+    return pool, model_roots, deltas
+
+
+def emit_table(trees, threshold, source, path, pool, deltas):
+    nodes, roots = flatten_preorder(trees)
+    out = [header_banner("model_table.h", source)]
+    out.append("#ifndef MODEL_TABLE_H\n#define MODEL_TABLE_H\n\n")
+    out.append('#include "model_engine.h"\n\n')
+    out.append("// Đầu vào: %d mục đầu (%s) của vector đặc trưng feature_store.h\n"
+               % (len(FEATURE_NAMES), ", ".join(FEATURE_NAMES)))
+    out.append("#define MODEL_FEATURE_LAYOUT_VERSION %d\n" % FEATURE_LAYOUT_VERSION)
+    out.append("#define MODEL_TABLE_TREE_COUNT %d\n" % len(trees))
+    out.append("#define MODEL_TABLE_NODE_COUNT %d\n" % len(nodes))
+    out.append("#define MODEL_TABLE_POOL_NODE_COUNT %d   // kể cả cây của các mô hình vùng (model_pool.h)\n"
+               % len(pool))
+    out.append("#define MODEL_THRESHOLD %s\n" % c_float(float(threshold)))
+    out.append("#define MODEL_LOGIT_THRESHOLD %s\n\n" % c_float(logit(threshold)))
+    out.append("// Bảng constexpr: TreeEnsemble đọc lúc chạy, UnrolledEnsemble (model_unrolled.h)\n")
+    out.append("// trải thành code và static_assert kiểm tra lúc build\n")
+    out.append("// Node: { feature, right, value } - con trái luôn là node kế tiếp\n")
+    out.append("constexpr ModelNode MODEL_TABLE_NODES[MODEL_TABLE_POOL_NODE_COUNT] = {\n")
+    for feature, right, value in pool:
+        out.append("    { %d, %d, %s },\n" % (feature, right, c_float(value)))
+    out.append("};\n\n")
+    out.append("constexpr uint16_t MODEL_TABLE_TREE_ROOTS[MODEL_TABLE_TREE_COUNT] = {\n")
+    out.append(wrap_ints(roots))
+    out.append("};\n\n")
+    out.append("constexpr uint8_t MODEL_TABLE_TREE_CLASS[MODEL_TABLE_TREE_COUNT] = {\n")
+    out.append(wrap_ints([t.klass for t in trees]))
+    out.append("};\n\n")
+    lo, hi = margin_suffix_bounds(trees, lambda v: float(v))
+    out.append("// Khoảng votes[1] - votes[0] còn có thể cộng thêm từ cây i đến hết\n")
+    out.append("constexpr float MODEL_TABLE_MARGIN_MIN[MODEL_TABLE_TREE_COUNT + 1] = {\n")
+    out.append(wrap_floats([f32_outward(v, True) for v in lo]))
+    out.append("};\n\n")
+    out.append("constexpr float MODEL_TABLE_MARGIN_MAX[MODEL_TABLE_TREE_COUNT + 1] = {\n")
+    out.append(wrap_floats([f32_outward(v, False) for v in hi]))
+    out.append("};\n\n")
+    out.append("// Giải thích (TreeExplainer, model_explain.h), song song với MODEL_TABLE_NODES:\n")
+    out.append("// gốc cây là giá trị kỳ vọng, node khác là thay đổi kỳ vọng so với node cha\n")
+    out.append("constexpr float MODEL_TABLE_EXPLAIN[MODEL_TABLE_POOL_NODE_COUNT] = {\n")
+    out.append(wrap_floats([f32_nearest(v) for v in deltas]))
+    out.append("};\n\n")
+    out.append("constexpr ModelTables MODEL_TABLE = {\n")
+    out.append("    MODEL_TABLE_NODES,\n")
+    out.append("    MODEL_TABLE_TREE_ROOTS,\n")
+    out.append("    MODEL_TABLE_TREE_CLASS,\n")
+    out.append("    MODEL_TABLE_NODE_COUNT,\n")
+    out.append("    MODEL_TABLE_TREE_COUNT,\n")
+    out.append("    MODEL_THRESHOLD,\n")
+    out.append("    MODEL_LOGIT_THRESHOLD,\n")
+    out.append("    MODEL_TABLE_MARGIN_MIN,\n")
+    out.append("    MODEL_TABLE_MARGIN_MAX,\n")
+    out.append("};\n\n")
+    out.append("#endif\n")
+    write_file(path, "".join(out))
+    return len(nodes)
+
+
+def emit_pool(models, model_roots, pool_size, threshold, path):
+    """Per-zone models sharing the node array of model_table.h (ModelRegistry)."""
+    out = [header_banner("model_pool.h", ", ".join(source for _, source, _ in models))]
+    out.append("#ifndef MODEL_POOL_H\n#define MODEL_POOL_H\n\n")
+    out.append('#include "model_table.h"\n\n')
+    out.append("// Mô hình của các vùng tưới (MODEL_ZONE_MODELS trong config.h). Mô hình 0 là\n")
+    out.append("// MODEL_TABLE; mọi mô hình trỏ vào bảng node chung MODEL_TABLE_NODES, cây\n")
+    out.append("// trùng nhau giữa các mô hình chỉ lưu một lần\n")
+    out.append("#define MODEL_POOL_MODEL_COUNT %d\n\n" % len(models))
+    first = set(model_roots[0])
+    for m in range(1, len(models)):
+        name, source, trees = models[m]
+        roots = model_roots[m]
+        prefix = "MODEL_POOL_%d" % m
+        shared = sum(1 for r in roots if r in first or roots.count(r) > 1)
+        out.append("// Mô hình %d: %s (%s), %d cây, %d cây dùng chung\n" % (m, name, source, len(trees), shared))
+        out.append("constexpr uint16_t %s_TREE_ROOTS[%d] = {\n" % (prefix, len(trees)))
+        out.append(wrap_ints(roots))
+        out.append("};\n\n")
+        out.append("constexpr uint8_t %s_TREE_CLASS[%d] = {\n" % (prefix, len(trees)))
+        out.append(wrap_ints([t.klass for t in trees]))
+        out.append("};\n\n")
+        lo, hi = margin_suffix_bounds(trees, lambda v: float(v))
+        out.append("constexpr float %s_MARGIN_MIN[%d] = {\n" % (prefix, len(trees) + 1))
+        out.append(wrap_floats([f32_outward(v, True) for v in lo]))
+        out.append("};\n\n")
+        out.append("constexpr float %s_MARGIN_MAX[%d] = {\n" % (prefix, len(trees) + 1))
+        out.append(wrap_floats([f32_outward(v, False) for v in hi]))
+        out.append("};\n\n")
+    out.append("constexpr ModelTables MODEL_POOL_MODELS[MODEL_POOL_MODEL_COUNT] = {\n")
+    out.append("    MODEL_TABLE,\n")
+    for m in range(1, len(models)):
+        prefix = "MODEL_POOL_%d" % m
+        out.append("    { MODEL_TABLE_NODES, %s_TREE_ROOTS, %s_TREE_CLASS, MODEL_TABLE_POOL_NODE_COUNT, %d,\n"
+                   % (prefix, prefix, len(models[m][2])))
+        out.append("      MODEL_THRESHOLD, MODEL_LOGIT_THRESHOLD, %s_MARGIN_MIN, %s_MARGIN_MAX },\n" % (prefix, prefix))
+    out.append("};\n\n")
+    out.append("constexpr const char* MODEL_POOL_NAMES[MODEL_POOL_MODEL_COUNT] = { %s };\n\n"
+               % ", ".join('"%s"' % name for name, _, _ in models))
+    out.append("#endif\n")
+    write_file(path, "".join(out))
+    extra = sum(len(trees) * 3 + 2 * (len(trees) + 1) * 4 for _, _, trees in models[1:])
+    return extra
+
+
+# ---------------------------------------------------------------------------
+# Output: fixed-point node table
+# ---------------------------------------------------------------------------
+
+FIXED_INPUT_Q_BITS = 20  # MODEL_FIXED_INPUT_Q_BITS trong model_engine.h
+FIXED_LEAF_Q_BITS = 24   # MODEL_FIXED_LEAF_Q_BITS
+
+
+def q_saturate(value):
+    return max(-(1 << 31), min((1 << 31) - 1, value))
+
+
+def q_round(value, bits):
+    """Round half away from zero, like fixedRound in model_engine.cpp."""
+    scaled = value * (1 << bits)
+    q = math.floor(scaled + 0.5) if scaled >= 0 else -math.floor(0.5 - scaled)
+    return q_saturate(q)
+
+
+def fixed_leaf(literal):
+    return q_round(f32_nearest(literal), FIXED_LEAF_Q_BITS)
+
+
+def emit_fixed(trees, threshold, source, path):
+    """Same preorder layout as model_table.h. Thresholds are floor(t * 2^20) so
+    `x <= t` is exact for inputs on the Q20 grid; leaves are float32 leaves in Q24."""
+    nodes, roots = flatten_preorder(trees)
+    for node in nodes:
+        if node[0] == LEAF_FEATURE:
+            node[2] = q_round(node[2], FIXED_LEAF_Q_BITS)
+        else:
+            node[2] = q_saturate(math.floor(node[2] * (1 << FIXED_INPUT_Q_BITS)))
+    logit_q = q_saturate(math.ceil(f32_nearest(logit(threshold)) * (1 << FIXED_LEAF_Q_BITS)))
+    lo, hi = margin_suffix_bounds(trees, fixed_leaf)
+
+    out = [header_banner("model_fixed.h", source)]
+    out.append("#ifndef MODEL_FIXED_H\n#define MODEL_FIXED_H\n\n")
+    out.append('#include "model_engine.h"\n\n')
+    out.append("#if MODEL_FIXED_INPUT_Q_BITS != %d || MODEL_FIXED_LEAF_Q_BITS != %d\n"
+               % (FIXED_INPUT_Q_BITS, FIXED_LEAF_Q_BITS))
+    out.append("#error \"model_fixed.h sinh với Q khác model_engine.h, chạy lại tools/model_export.py\"\n")
+    out.append("#endif\n\n")
+    out.append("#define MODEL_FIXED_NODE_COUNT %d\n" % len(nodes))
+    out.append("// logit(%s) = %.9f\n" % (threshold, logit(threshold)))
+    out.append("#define MODEL_FIXED_LOGIT_THRESHOLD %d\n\n" % logit_q)
+    out.append("// Node: { feature, right, value } - ngưỡng Q%d hoặc lá Q%d\n" % (FIXED_INPUT_Q_BITS, FIXED_LEAF_Q_BITS))
+    out.append("static const ModelFixedNode MODEL_FIXED_NODES[MODEL_FIXED_NODE_COUNT] = {\n")
+    for feature, right, value in nodes:
+        out.append("    { %d, %d, %d },\n" % (feature, right, value))
+    out.append("};\n\n")
+    out.append("static const uint16_t MODEL_FIXED_TREE_ROOTS[%d] = {\n" % len(trees))
+    out.append(wrap_ints(roots))
+    out.append("};\n\n")
+    out.append("static const uint8_t MODEL_FIXED_TREE_CLASS[%d] = {\n" % len(trees))
+    out.append(wrap_ints([t.klass for t in trees]))
+    out.append("};\n\n")
+    out.append("static const int32_t MODEL_FIXED_MARGIN_MIN[%d] = {\n" % (len(trees) + 1))
+    out.append(wrap_ints(lo))
+    out.append("};\n\n")
+    out.append("static const int32_t MODEL_FIXED_MARGIN_MAX[%d] = {\n" % (len(trees) + 1))
+    out.append(wrap_ints(hi))
+    out.append("};\n\n")
+    out.append("static const ModelFixedTables MODEL_FIXED = {\n")
+    out.append("    MODEL_FIXED_NODES,\n")
+    out.append("    MODEL_FIXED_TREE_ROOTS,\n")
+    out.append("    MODEL_FIXED_TREE_CLASS,\n")
+    out.append("    MODEL_FIXED_NODE_COUNT,\n")
+    out.append("    %d,\n" % len(trees))
+    out.append("    %s,\n" % c_float(float(threshold)))
+    out.append("    MODEL_FIXED_LOGIT_THRESHOLD,\n")
+    out.append("    MODEL_FIXED_MARGIN_MIN,\n")
+    out.append("    MODEL_FIXED_MARGIN_MAX,\n")
+    out.append("};\n\n")
+    out.append("#endif\n")
+    write_file(path, "".join(out))
+    return len(nodes)
+
+
+# ---------------------------------------------------------------------------
+# Output: runtime image (include/model_image.h)
+# ---------------------------------------------------------------------------
+
+IMAGE_MAGIC = 0x444D5249  # "IRMD"
+IMAGE_FORMAT_VERSION = 1
+IMAGE_HEADER = struct.Struct("<IHBBIHHffII")
+
+
+def pad4(data):
+    return data + b"\0" * (-len(data) % 4)
+
+
+def emit_image(trees, threshold, model_version, path):
+    """Same tables as emit_table, laid out so ModelTables can point into the file."""
+    nodes, roots = flatten_preorder(trees)
+    if len(nodes) > 0xFFFF:
+        raise ValueError("%d nodes do not fit uint16 indices" % len(nodes))
+    lo, hi = margin_suffix_bounds(trees, lambda v: float(v))
+    payload = b"".join([
+        pad4(struct.pack("<%dH" % len(roots), *roots)),
+        pad4(struct.pack("<%dB" % len(trees), *[t.klass for t in trees])),
+        struct.pack("<%df" % len(lo), *[f32_outward(v, True) for v in lo]),
+        struct.pack("<%df" % len(hi), *[f32_outward(v, False) for v in hi]),
+        b"".join(struct.pack("<BxHf", feature, right, value) for feature, right, value in nodes),
+    ])
+    header = IMAGE_HEADER.pack(
+        IMAGE_MAGIC, IMAGE_FORMAT_VERSION, len(FEATURE_NAMES), 2, model_version,
+        len(trees), len(nodes), f32_nearest(float(threshold)), f32_nearest(logit(threshold)),
+        len(payload), zlib.crc32(payload) & 0xFFFFFFFF)
+    with open(path, "wb") as f:
+        f.write(header + payload)
+    return len(header) + len(payload)
+
+
+# ---------------------------------------------------------------------------
+# Output: quantized integer-bin nodes
+# ---------------------------------------------------------------------------
+
+LEAF_Q_BITS = 16  # |leaf| < 0.5 nên vừa int16
+
+
+def feature_thresholds(trees):
+    """Sorted unique float32 thresholds per feature."""
+    values = [set() for _ in FEATURE_NAMES]
+
+    def visit(node):
+        if node.is_leaf():
+            return
+        values[node.feature].add(node.threshold)
+        visit(node.left)
+        visit(node.right)
+
+    for tree in trees:
+        visit(tree.root)
+    return [sorted(v) for v in values]
+
+
+def logit(probability):
+    probability = float(probability)
+    return math.log(probability / (1.0 - probability))
+
+
+def emit_quantized(trees, threshold, source, path):
+    thresholds = feature_thresholds(trees)
+    for feature, values in enumerate(thresholds):
+        if len(values) > 254:
+            raise ValueError("feature %d has %d thresholds, bins no longer fit uint8" % (feature, len(values)))
+
+    scale = 1 << LEAF_Q_BITS
+    nodes = []
+    roots = []
+
+    def visit(node):
+        index = len(nodes)
+        if node.is_leaf():
+            q = int(round(float(node.leaf) * scale))
+            if not -32768 <= q <= 32767:
+                raise ValueError("leaf %s does not fit Q%d int16" % (node.leaf, LEAF_Q_BITS))
+            nodes.append([LEAF_FEATURE, 0, q])
+            return index
+        t = node.threshold
+        nodes.append([node.feature, bisect.bisect_left(thresholds[node.feature], t), 0])
+        visit(node.left)
+        nodes[index][2] = visit(node.right)
+        return index
+
+    for tree in trees:
+        roots.append(visit(tree.root))
+
+    # prob >= p  <=>  votes[1] - votes[0] >= logit(p)
+    logit_q = int(math.ceil(logit(threshold) * scale))
+
+    out = [header_banner("model_quantized.h", source)]
+    out.append("#ifndef MODEL_QUANTIZED_H\n#define MODEL_QUANTIZED_H\n\n")
+    out.append('#include "model_engine.h"\n\n')
+    out.append("#define MODEL_QUANTIZED_NODE_COUNT %d\n" % len(nodes))
+    out.append("#define MODEL_QUANTIZED_Q_BITS %d\n" % LEAF_Q_BITS)
+    out.append("// logit(%s) = %.9f\n" % (threshold, logit(threshold)))
+    out.append("#define MODEL_QUANTIZED_LOGIT_THRESHOLD %d\n\n" % logit_q)
+    for feature, values in enumerate(thresholds):
+        out.append("static const float MODEL_QUANTIZED_%s_THRESHOLDS[%d] = {\n"
+                   % (FEATURE_NAMES[feature].upper(), len(values)))
+        out.append(wrap_floats(values))
+        out.append("};\n\n")
+    out.append("// Node: { feature, bin, value } - value là node con phải (split) hoặc lá Q%d\n" % LEAF_Q_BITS)
+    out.append("static const ModelQuantNode MODEL_QUANTIZED_NODES[MODEL_QUANTIZED_NODE_COUNT] = {\n")
+    for feature, bin_index, value in nodes:
+        out.append("    { %d, %d, %d },\n" % (feature, bin_index, value))
+    out.append("};\n\n")
+    out.append("static const uint16_t MODEL_QUANTIZED_TREE_ROOTS[%d] = {\n" % len(trees))
+    out.append(wrap_ints(roots))
+    out.append("};\n\n")
+    out.append("static const uint8_t MODEL_QUANTIZED_TREE_CLASS[%d] = {\n" % len(trees))
+    out.append(wrap_ints([t.klass for t in trees]))
+    out.append("};\n\n")
+    lo, hi = margin_suffix_bounds(trees, lambda v: int(round(float(v) * scale)))
+    out.append("// Khoảng votes[1] - votes[0] còn có thể cộng thêm từ cây i đến hết\n")
+    out.append("static const int32_t MODEL_QUANTIZED_MARGIN_MIN[%d] = {\n" % (len(trees) + 1))
+    out.append(wrap_ints(lo))
+    out.append("};\n\n")
+    out.append("static const int32_t MODEL_QUANTIZED_MARGIN_MAX[%d] = {\n" % (len(trees) + 1))
+    out.append(wrap_ints(hi))
+    out.append("};\n\n")
+    out.append("static const ModelQuantTables MODEL_QUANTIZED = {\n")
+    out.append("    MODEL_QUANTIZED_NODES,\n")
+    out.append("    MODEL_QUANTIZED_TREE_ROOTS,\n")
+    out.append("    MODEL_QUANTIZED_TREE_CLASS,\n")
+    out.append("    MODEL_QUANTIZED_NODE_COUNT,\n")
+    out.append("    %d,\n" % len(trees))
+    out.append("    { %s },\n" % ", ".join("MODEL_QUANTIZED_%s_THRESHOLDS" % n.upper() for n in FEATURE_NAMES))
+    out.append("    { %s },\n" % ", ".join(str(len(v)) for v in thresholds))
+    out.append("    MODEL_QUANTIZED_LOGIT_THRESHOLD,\n")
+    out.append("    MODEL_QUANTIZED_MARGIN_MIN,\n")
+    out.append("    MODEL_QUANTIZED_MARGIN_MAX,\n")
+    out.append("};\n\n")
+    out.append("#endif\n")
+    write_file(path, "".join(out))
+    return len(nodes)
+
+
+# ---------------------------------------------------------------------------
+# Output: compacted DAG with a leaf palette
+# ---------------------------------------------------------------------------
+
+COMPACT_PALETTE_SIZE = 256   # chỉ số lá trái trong node chỉ có 8 bit
+COMPACT_ROOT_LEAF = 0x8000
+COMPACT_LEFT_LEAF = 1 << 9
+COMPACT_RIGHT_LEAF = 1 << 18
+
+
+def leaf_palette(values, size):
+    """Palette of at most `size` Q values minimizing the largest leaf error.
+
+    Binary search on the error bound e; for each e, greedily cover the sorted
+    unique values with intervals of width 2e. Returns (palette, index_of)."""
+    unique = sorted(set(values))
+
+    def cover(e):
+        palette = []
+        i = 0
+        while i < len(unique):
+            j = i
+            while j + 1 < len(unique) and unique[j + 1] - unique[i] <= 2 * e:
+                j += 1
+            palette.append((unique[i] + unique[j]) // 2)
+            i = j + 1
+        return palette
+
+    lo, hi = 0, unique[-1] - unique[0]
+    while lo < hi:
+        mid = (lo + hi) // 2
+        if len(cover(mid)) <= size:
+            hi = mid
+        else:
+            lo = mid + 1
+    palette = cover(lo)
+    index_of = {v: nearest_index(palette, v) for v in unique}
+    return palette, index_of
+
+
+def nearest_index(palette, value):
+    i = bisect.bisect_left(palette, value)
+    if i == len(palette):
+        return i - 1
+    if i > 0 and value - palette[i - 1] <= palette[i] - value:
+        return i - 1
+    return i
+
+
+def compact_key(node, thresholds, leaf_index):
+    """Hashable form of a tree with palette leaves; splits whose children are equal are dropped."""
+    if node.is_leaf():
+        return ("L", leaf_index(node.leaf))
+    left = compact_key(node.left, thresholds, leaf_index)
+    right = compact_key(node.right, thresholds, leaf_index)
+    if left == right:
+        return left
+    bin_index = bisect.bisect_left(thresholds[node.feature], node.threshold)
+    return (node.feature, bin_index, left, right)
+
+
+def compact_words(keys):
+    """Pack split nodes into uint32 words. Left splits follow their parent, right
+    children and roots may point to a subtree emitted earlier (DAG sharing)."""
+    words = []
+    emitted = {}
+
+    def emit(key, shared):
+        if key[0] == "L":
+            return True, key[1]
+        if shared and key in emitted:
+            return False, emitted[key]
+        index = len(words)
+        words.append(0)
+        emitted.setdefault(key, index)
+        feature, bin_index, left, right = key
+        left_leaf, left_value = emit(left, False)
+        right_leaf, right_value = emit(right, True)
+        if feature > 3 or bin_index > 0x7F or right_value > 0x1FFF:
+            raise ValueError("split does not fit the compact node layout")
+        word = feature | (bin_index << 2) | (right_value << 19)
+        if left_leaf:
+            word |= COMPACT_LEFT_LEAF | (left_value << 10)
+        if right_leaf:
+            word |= COMPACT_RIGHT_LEAF
+        words[index] = word
+        return False, index
+
+    roots = []
+    for key in keys:
+        leaf, value = emit(key, True)
+        roots.append(COMPACT_ROOT_LEAF | value if leaf else value)
+    return words, roots
+
+
+def compact_leaf(words, root, bins):
+    """Reference decoder, mirrors CompactEnsemble::leafIndex."""
+    if root & COMPACT_ROOT_LEAF:
+        return root & ~COMPACT_ROOT_LEAF
+    i = root
+    while True:
+        word = words[i]
+        if bins[word & 0x3] <= (word >> 2) & 0x7F:
+            if word & COMPACT_LEFT_LEAF:
+                return (word >> 10) & 0xFF
+            i += 1
+        else:
+            if word & COMPACT_RIGHT_LEAF:
+                return word >> 19
+            i = word >> 19
+
+
+def key_leaf(key, bins):
+    while key[0] != "L":
+        key = key[2] if bins[key[0]] <= key[1] else key[3]
+    return key[1]
+
+
+def emit_compact(trees, threshold, source, path, palette_size=COMPACT_PALETTE_SIZE):
+    thresholds = feature_thresholds(trees)
+    scale = 1 << LEAF_Q_BITS
+    leaves = [int(round(float(v) * scale)) for t in trees for v in leaf_values(t.root)]
+    palette, index_of = leaf_palette(leaves, palette_size)
+    leaf_index = lambda v: index_of[int(round(float(v) * scale))]
+    keys = [compact_key(t.root, thresholds, leaf_index) for t in trees]
+    words, roots = compact_words(keys)
+
+    # Kiểm tra tương đương: bảng nén phải cho cùng lá với cây (đã thay lá bằng palette)
+    import random
+    rng = random.Random(1)
+    for _ in range(20000):
+        bins = [rng.randint(0, len(v)) for v in thresholds]
+        for key, root in zip(keys, roots):
+            if key_leaf(key, bins) != compact_leaf(words, root, bins):
+                raise AssertionError("compact DAG differs from the palette trees at bins %s" % bins)
+
+    logit_q = int(math.ceil(logit(threshold) * scale))
+    lo, hi = margin_suffix_bounds(trees, lambda v: palette[leaf_index(v)])
+    max_error = max(abs(palette[index_of[v]] - v) for v in leaves)
+    splits = sum(1 for t in trees for _ in internal_nodes(t.root))
+
+    out = [header_banner("model_compact.h", source)]
+    out.append("#ifndef MODEL_COMPACT_H\n#define MODEL_COMPACT_H\n\n")
+    out.append('#include "model_engine.h"\n\n')
+    out.append("// %d split -> %d node sau khi gộp cây con trùng, %d lá -> palette %d giá trị\n"
+               % (splits, len(words), len(leaves), len(palette)))
+    out.append("// Sai số lá lớn nhất %d / 2^%d\n" % (max_error, LEAF_Q_BITS))
+    out.append("#define MODEL_COMPACT_NODE_COUNT %d\n" % len(words))
+    out.append("#define MODEL_COMPACT_PALETTE_SIZE %d\n\n" % len(palette))
+    for feature, values in enumerate(thresholds):
+        out.append("static const float MODEL_COMPACT_%s_THRESHOLDS[%d] = {\n"
+                   % (FEATURE_NAMES[feature].upper(), len(values)))
+        out.append(wrap_floats(values))
+        out.append("};\n\n")
+    out.append("static const int16_t MODEL_COMPACT_PALETTE[MODEL_COMPACT_PALETTE_SIZE] = {\n")
+    out.append(wrap_ints(palette))
+    out.append("};\n\n")
+    out.append("static const uint32_t MODEL_COMPACT_NODES[MODEL_COMPACT_NODE_COUNT] = {\n")
+    out.append(wrap_ints(["0x%08x" % w for w in words], 8))
+    out.append("};\n\n")
+    out.append("static const uint16_t MODEL_COMPACT_TREE_ROOTS[%d] = {\n" % len(trees))
+    out.append(wrap_ints(roots))
+    out.append("};\n\n")
+    out.append("static const uint8_t MODEL_COMPACT_TREE_CLASS[%d] = {\n" % len(trees))
+    out.append(wrap_ints([t.klass for t in trees]))
+    out.append("};\n\n")
+    out.append("static const int32_t MODEL_COMPACT_MARGIN_MIN[%d] = {\n" % (len(trees) + 1))
+    out.append(wrap_ints(lo))
+    out.append("};\n\n")
+    out.append("static const int32_t MODEL_COMPACT_MARGIN_MAX[%d] = {\n" % (len(trees) + 1))
+    out.append(wrap_ints(hi))
+    out.append("};\n\n")
+    out.append("static const ModelCompactTables MODEL_COMPACT = {\n")
+    out.append("    MODEL_COMPACT_NODES,\n")
+    out.append("    MODEL_COMPACT_TREE_ROOTS,\n")
+    out.append("    MODEL_COMPACT_TREE_CLASS,\n")
+    out.append("    MODEL_COMPACT_NODE_COUNT,\n")
+    out.append("    %d,\n" % len(trees))
+    out.append("    { %s },\n" % ", ".join("MODEL_COMPACT_%s_THRESHOLDS" % n.upper() for n in FEATURE_NAMES))
+    out.append("    { %s },\n" % ", ".join(str(len(v)) for v in thresholds))
+    out.append("    MODEL_COMPACT_PALETTE,\n")
+    out.append("    MODEL_COMPACT_PALETTE_SIZE,\n")
+    out.append("    %d,\n" % logit_q)
+    out.append("    MODEL_COMPACT_MARGIN_MIN,\n")
+    out.append("    MODEL_COMPACT_MARGIN_MAX,\n")
+    out.append("};\n\n")
+    out.append("#endif\n")
+    write_file(path, "".join(out))
+
+    size = (len(words) * 4 + len(palette) * 2 + len(trees) * 3
+            + sum(len(v) for v in thresholds) * 4 + 2 * (len(trees) + 1) * 4)
+    return len(words), len(palette), max_error, size
+
+
+# ---------------------------------------------------------------------------
+# Output: golden vectors
+# ---------------------------------------------------------------------------
+
+GOLDEN_RANDOM = 1000
+GOLDEN_RETRIES = 20
+# Bỏ điểm có margin cách ngưỡng logit dưới GOLDEN_GUARD: expf/exp và thứ tự làm tròn
+# có thể lệch vài ulp, còn lá Q16 lệch tối đa 41 * 2^-17 < 1e-3
+GOLDEN_GUARD = 1e-3
+# Cùng miền với lưới của tools/model_bench.cpp
+GOLDEN_DOMAIN = [(0, 1023), (-10, 60), (0, 100)]
+
+
+def reference_margin(trees, x):
+    """votes[1] - votes[0] with float32 sums in tree order, like TreeEnsemble::votes."""
+    votes = [0.0, 0.0]
+    for tree in trees:
+        node = tree.root
+        while not node.is_leaf():
+            node = node.left if x[node.feature] <= node.threshold else node.right
+        votes[tree.klass] = f32_nearest(votes[tree.klass] + f32_nearest(node.leaf))
+    return f32_nearest(votes[1] - votes[0])
+
+
+def golden_vectors(trees, threshold, count, seed=1):
+    """Both sides of every split threshold (other features random), then `count`
+    random sensor readings, half of them integers so RegionModel is covered too."""
+    rng = random.Random(seed)
+    cut = logit(threshold)
+    vectors = []
+
+    def draw(integer):
+        # Soil là số ADC nguyên, nhiệt độ và độ ẩm DHT có một chữ số thập phân
+        x = [float(rng.randint(*GOLDEN_DOMAIN[0]))]
+        for lo, hi in GOLDEN_DOMAIN[1:]:
+            x.append(float(rng.randint(lo, hi)) if integer else f32_nearest(rng.randint(lo * 10, hi * 10) / 10))
+        return x
+
+    def add(x):
+        margin = reference_margin(trees, x)
+        if abs(margin - cut) < GOLDEN_GUARD:
+            return False
+        vectors.append((x, margin, 1 if margin >= cut else 0))
+        return True
+
+    for feature, values in enumerate(feature_thresholds(trees)):
+        for t in values:
+            for value in (t, f32_step(t, True)):
+                for _ in range(GOLDEN_RETRIES):
+                    x = draw(False)
+                    x[feature] = value
+                    if add(x):
+                        break
+    for i in range(count):
+        while not add(draw(i % 2 == 0)):
+            pass
+    return vectors
+
+
+def emit_golden(trees, threshold, source, path):
+    vectors = golden_vectors(trees, threshold, GOLDEN_RANDOM)
+    out = ["# %s - sinh tự động bởi tools/model_export.py từ %s - không sửa tay.\n"
+           % (os.path.basename(path), source)]
+    out.append("# %d cây, ngưỡng %s (logit %.9f), bỏ điểm có |margin - logit| < %g\n"
+               % (len(trees), threshold, logit(threshold), GOLDEN_GUARD))
+    out.append("soil,temperature,humidity,margin,decision\n")
+    for x, margin, decision in vectors:
+        out.append("%s,%.6f,%d\n" % (",".join(f32_literal(v) for v in x), margin, decision))
+    write_file(path, "".join(out))
+    return len(vectors), sum(v[2] for v in vectors)
+
+
+# ---------------------------------------------------------------------------
+# Host C++ tools: region compiler and benchmark
+# ---------------------------------------------------------------------------
+
+BENCH_SOURCES = ["tools/model_bench.cpp", "src/model_engine.cpp", "src/model_batch.cpp",
+                 "src/model_image.cpp", "src/model_profile.cpp", "src/model_registry.cpp",
+                 "src/model_explain.cpp"]
+
+
+def build_tool(cxx, root, out_dir, sources, output):
+    # out-dir đứng trước include để tool dùng header vừa sinh
+    command = [cxx, "-O2", "-std=gnu++17", "-pthread", "-I" + out_dir, "-I" + os.path.join(root, "include")]
+    command += [os.path.join(root, source) for source in sources] + ["-o", output]
+    subprocess.run(command, check=True)
+
+
+def emit_regions(cxx, root, out_dir, work_dir):
+    """Build tools/model_regions.cpp against the new model_table.h and run it."""
+    tool = os.path.join(work_dir, "model_regions")
+    build_tool(cxx, root, out_dir, ["tools/model_regions.cpp", "src/model_engine.cpp"], tool)
+    result = subprocess.run([tool, os.path.join(out_dir, "model_regions.h")],
+                            check=True, stdout=subprocess.PIPE, universal_newlines=True)
+    match = re.search(r"(\d+) unique rows, bitmap \d+ -> (\d+) bytes", result.stdout)
+    return int(match.group(1)), int(match.group(2))
+
+
+# Mỗi engine biên dịch thành một object riêng; kích thước code là tổng các hàm
+# (nm -S) khớp mẫu tên, không tính bảng dữ liệu. Bảng dùng chung code duyệt
+# cây của model_engine.cpp nên chỉ tính các hàm predictFull gọi tới
+CODE_SIZE_UNITS = [
+    ("nested-if", '#include "model_final.h"\n'
+                  'int enginePredict(float* x) { static Eloquent::ML::Port::XGBClassifier c; return c.predict(x); }\n',
+     None),
+    ("unrolled", '#include "model_table.h"\n#include "model_unrolled.h"\n'
+                 'int enginePredict(float* x) { return UnrolledEnsemble<MODEL_TABLE>::predict(x); }\n',
+     None),
+    ("table (full)", '#include "model_engine.cpp"\n',
+     r"BasicTreeEnsemble<ModelFloat>::(predictFull|votes|leafValue|decide)\("),
+]
+
+
+def code_sizes(cxx, root, out_dir, work_dir, flags):
+    sizes = []
+    for name, source, pattern in CODE_SIZE_UNITS:
+        unit = os.path.join(work_dir, "code_size.cpp")
+        write_file(unit, source)
+        obj = os.path.join(work_dir, "code_size.o")
+        subprocess.run([cxx, flags, "-std=gnu++17", "-c", "-I" + out_dir, "-I" + os.path.join(root, "include"),
+                        "-I" + os.path.join(root, "src"), unit, "-o", obj], check=True)
+        symbols = subprocess.run(["nm", "-S", "-C", "--defined-only", obj], check=True,
+                                 stdout=subprocess.PIPE, universal_newlines=True).stdout
+        total = 0
+        for line in symbols.splitlines():
+            fields = line.split(None, 3)
+            if len(fields) == 4 and fields[2] in "tTwW" and (pattern is None or re.search(pattern, fields[3])):
+                total += int(fields[1], 16)
+        sizes.append((name, total))
+    return sizes
+
+
+def run_bench(cxx, root, out_dir, work_dir, golden, image):
+    tool = os.path.join(work_dir, "model_bench")
+    build_tool(cxx, root, out_dir, BENCH_SOURCES, tool)
+    command = [tool, "--golden", golden] + ([image] if image else [])
+    result = subprocess.run(command).returncode
+
+    # Kích thước trên host (x86), chỉ để so tương đối giữa các engine
+    print("%-12s %10s %10s" % ("code", "-O2", "-Os"))
+    for (name, o2), (_, os_) in zip(code_sizes(cxx, root, out_dir, work_dir, "-O2"),
+                                    code_sizes(cxx, root, out_dir, work_dir, "-Os")):
+        print("%-12s %10d %10d" % (name, o2, os_))
+    return result
+
+
+def internal_nodes(node):
+    if not node.is_leaf():
+        yield node
+        yield from internal_nodes(node.left)
+        yield from internal_nodes(node.right)
+
+
+def wrap_floats(values, per_line=8):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(c_float(v) for v in values[i:i + per_line]) + ",\n")
+    return "".join(lines)
+
+
+def wrap_ints(values, per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(str(v) for v in values[i:i + per_line]) + ",\n")
+    return "".join(lines)
+
+
+def write_file(path, content):
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(content)
+
+
+def main(argv):
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--model", default=os.path.join(root, "model", "irrigation_xgb.json"),
+                        help="XGBoost dump_model or save_model JSON")
+    parser.add_argument("--num-class", type=int, default=2,
+                        help="classes of a dump_model input (1 = binary:logistic); save_model JSON records its own")
+    parser.add_argument("--import-header", help="read a micromlgen nested-if header instead of --model")
+    parser.add_argument("--write-json", help="write the trees in dump_model JSON layout and stop")
+    parser.add_argument("--threshold", default=DECISION_THRESHOLD, help="probability cut for class 1")
+    parser.add_argument("--out-dir", default=os.path.join(root, "include"))
+    parser.add_argument("--golden", default=os.path.join(root, "model", "golden_vectors.csv"))
+    parser.add_argument("--palette-size", type=int, default=COMPACT_PALETTE_SIZE,
+                        help="leaf palette entries for model_compact.h (<= 256)")
+    parser.add_argument("--zone-model", action="append", default=[], metavar="NAME=PATH",
+                        help="extra per-zone model (XGBoost JSON) sharing the node pool; repeatable")
+    parser.add_argument("--image", help="also write the runtime model image to this path")
+    parser.add_argument("--model-version", type=int, default=1)
+    parser.add_argument("--cxx", default=os.environ.get("CXX", "g++"), help="host compiler for the C++ tools")
+    parser.add_argument("--bench", action="store_true", help="time every format on the golden vectors")
+    args = parser.parse_args(argv)
+
+    if not 0.0 < float(args.threshold) < 1.0:
+        parser.error("--threshold must be a probability in (0, 1)")
+    if not 1 <= args.palette_size <= COMPACT_PALETTE_SIZE:
+        parser.error("--palette-size must be 1..%d" % COMPACT_PALETTE_SIZE)
+
+    global FEATURE_LAYOUT_VERSION, FEATURE_LAYOUT
+    FEATURE_LAYOUT_VERSION, FEATURE_LAYOUT = read_feature_layout(os.path.join(root, "include", "feature_store.h"))
+
+    if args.import_header:
+        trees = parse_eloquent_header(args.import_header)
+        source = os.path.basename(args.import_header)
+    else:
+        trees = parse_xgboost_json(args.model, args.num_class)
+        source = os.path.basename(args.model)
+    if args.write_json:
+        write_xgboost_json(trees, args.write_json)
+        print("%s: %d trees" % (args.write_json, len(trees)))
+        return 0
+
+    threshold = args.threshold
+    out = lambda name: os.path.join(args.out_dir, name)
+    report = []
+    splits = emit_nested_if(trees, threshold, source, out("model_final.h"))
+    report.append(("nested-if", "model_final.h", "(code)", "%d splits" % splits))
+
+    models = [("default", source, trees)]
+    for zone in args.zone_model:
+        name, _, zone_path = zone.partition("=")
+        if not zone_path or not re.fullmatch(r"\w+", name):
+            parser.error("--zone-model expects NAME=PATH")
+        models.append((name, os.path.basename(zone_path), parse_xgboost_json(zone_path, args.num_class)))
+    pool, model_roots, deltas = build_pool([m[2] for m in models])
+
+    node_count = emit_table(trees, threshold, source, out("model_table.h"), pool, deltas)
+    size = node_count * 8 + len(trees) * 3 + 2 * (len(trees) + 1) * 4
+    report.append(("table", "model_table.h", size, "%d nodes" % node_count))
+    covered = all(node.cover for tree in trees for node in [tree.root])
+    report.append(("explain", "model_table.h", len(pool) * 4,
+                   "Saabas deltas, %s" % ("cover-weighted" if covered else "no cover, equal weights")))
+
+    size = emit_pool(models, model_roots, len(pool), threshold, out("model_pool.h"))
+    total_trees = sum(len(m[2]) for m in models)
+    unique_trees = len(set(r for roots in model_roots for r in roots))
+    report.append(("pool", "model_pool.h", (len(pool) - node_count) * 8 + size,
+                   "%d models, %d unique of %d trees" % (len(models), unique_trees, total_trees)))
+
+    node_count = emit_fixed(trees, threshold, source, out("model_fixed.h"))
+    size = node_count * 8 + len(trees) * 3 + 2 * (len(trees) + 1) * 4
+    report.append(("fixed", "model_fixed.h", size, "%d nodes, Q%d inputs, Q%d leaves"
+                   % (node_count, FIXED_INPUT_Q_BITS, FIXED_LEAF_Q_BITS)))
+
+    node_count = emit_quantized(trees, threshold, source, out("model_quantized.h"))
+    cuts = sum(len(v) for v in feature_thresholds(trees))
+    size = node_count * 4 + len(trees) * 3 + cuts * 4 + 2 * (len(trees) + 1) * 4
+    report.append(("quantized", "model_quantized.h", size, "%d nodes, Q%d" % (node_count, LEAF_Q_BITS)))
+
+    words, palette, max_error, size = emit_compact(trees, threshold, source, out("model_compact.h"),
+                                                   args.palette_size)
+    report.append(("compact", "model_compact.h", size,
+                   "%d nodes, palette %d, max leaf error %d/2^%d" % (words, palette, max_error, LEAF_Q_BITS)))
+
+    with tempfile.TemporaryDirectory() as work_dir:
+        rows, size = emit_regions(args.cxx, root, args.out_dir, work_dir)
+        report.append(("regions", "model_regions.h", size, "%d unique rows, integer inputs" % rows))
+
+        if args.image:
+            size = emit_image(trees, threshold, args.model_version, args.image)
+            report.append(("image", os.path.basename(args.image), size, "model version %d" % args.model_version))
+
+        vectors, positives = emit_golden(trees, threshold, source, args.golden)
+        report.append(("golden", os.path.basename(args.golden), "-", "%d vectors, %d positive" % (vectors, positives)))
+
+        print("%s: %d trees, threshold %s (logit %.9f)" % (source, len(trees), threshold, logit(threshold)))
+        print("feature layout v%d: %d of %d entries (%s)" % (FEATURE_LAYOUT_VERSION, len(FEATURE_NAMES),
+                                                           len(FEATURE_LAYOUT), ", ".join(FEATURE_NAMES)))
+        print("%-10s %-20s %10s  %s" % ("format", "file", "data bytes", "detail"))
+        for name, path, size, detail in report:
+            print("%-10s %-20s %10s  %s" % (name, path, size, detail))
+
+        if args.bench:
+            return run_bench(args.cxx, root, args.out_dir, work_dir, args.golden, args.image)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
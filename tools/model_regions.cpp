@@ -0,0 +1,114 @@
+// Bước build: biên dịch ensemble trong model_table.h thành bảng vùng quyết định.
+// tools/model_export.py tự build và chạy tool này sau khi sinh model_table.h; chạy tay:
+//
+//   g++ -O2 -std=gnu++17 -Iinclude tools/model_regions.cpp src/model_engine.cpp -o model_regions
+//   ./model_regions include/model_regions.h
+//
+// Đầu vào của mô hình là số nguyên (soil 0..1023 từ readSoilMoisture, nhiệt độ và độ ẩm
+// DHT11) nên ngưỡng t tương đương floor(t). Mỗi ô giữa các ngưỡng liên tiếp có cùng kết
+// quả, được tính bằng chính TreeEnsemble để trùng bit với engine bảng.
+
+#include <stdio.h>
+#include <math.h>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "model_table.h"
+
+int main(int argc, char** argv) {
+    const char* outPath = argc > 1 ? argv[1] : "include/model_regions.h";
+
+    std::set<int> unique[MODEL_FEATURE_COUNT];
+    for (int i = 0; i < MODEL_TABLE_NODE_COUNT; i++) {
+        const ModelNode& node = MODEL_TABLE_NODES[i];
+        if (node.feature != MODEL_LEAF) {
+            unique[node.feature].insert((int)floorf(node.value));
+        }
+    }
+
+    // Giá trị đại diện cho mỗi bin: chính ngưỡng, bin cuối là ngưỡng lớn nhất + 1
+    std::vector<int> thresholds[MODEL_FEATURE_COUNT];
+    std::vector<float> samples[MODEL_FEATURE_COUNT];
+    for (int f = 0; f < MODEL_FEATURE_COUNT; f++) {
+        thresholds[f].assign(unique[f].begin(), unique[f].end());
+        for (int t : thresholds[f]) samples[f].push_back((float)t);
+        samples[f].push_back((float)(thresholds[f].back() + 1));
+    }
+
+    TreeEnsemble engine(MODEL_TABLE);
+    size_t soilBins = samples[0].size(), tempBins = samples[1].size(), humBins = samples[2].size();
+    size_t rowBytes = (humBins + 7) / 8;
+
+    std::map<std::string, uint16_t> rowIds;
+    std::vector<std::string> rows;
+    std::vector<uint16_t> rowIndex;
+    for (size_t s = 0; s < soilBins; s++) {
+        for (size_t t = 0; t < tempBins; t++) {
+            std::string bits(rowBytes, '\0');
+            for (size_t h = 0; h < humBins; h++) {
+                float x[MODEL_FEATURE_COUNT] = { samples[0][s], samples[1][t], samples[2][h] };
+                if (engine.predict(x)) bits[h >> 3] |= (char)(1 << (h & 7));
+            }
+            auto it = rowIds.find(bits);
+            if (it == rowIds.end()) {
+                it = rowIds.emplace(bits, (uint16_t)rows.size()).first;
+                rows.push_back(bits);
+            }
+            rowIndex.push_back(it->second);
+        }
+    }
+
+    FILE* out = fopen(outPath, "w");
+    if (!out) {
+        perror(outPath);
+        return 1;
+    }
+
+    static const char* names[MODEL_FEATURE_COUNT] = { "SOIL", "TEMP", "HUM" };
+    fprintf(out, "// model_regions.h\n");
+    fprintf(out, "// Sinh tự động bởi tools/model_regions.cpp từ model_table.h - không sửa tay.\n\n");
+    fprintf(out, "#ifndef MODEL_REGIONS_H\n#define MODEL_REGIONS_H\n\n");
+    fprintf(out, "#include \"model_engine.h\"\n\n");
+    fprintf(out, "#define MODEL_REGIONS_ROW_COUNT %zu\n", rows.size());
+    fprintf(out, "#define MODEL_REGIONS_ROW_BYTES %zu\n\n", rowBytes);
+
+    for (int f = 0; f < MODEL_FEATURE_COUNT; f++) {
+        fprintf(out, "static const int16_t MODEL_REGIONS_%s_THRESHOLDS[%zu] = {", names[f], thresholds[f].size());
+        for (size_t i = 0; i < thresholds[f].size(); i++) {
+            fprintf(out, "%s%d,", i % 16 ? " " : "\n    ", thresholds[f][i]);
+        }
+        fprintf(out, "\n};\n\n");
+    }
+
+    fprintf(out, "static const uint16_t MODEL_REGIONS_ROW_INDEX[%zu] = {", rowIndex.size());
+    for (size_t i = 0; i < rowIndex.size(); i++) {
+        fprintf(out, "%s%u,", i % 16 ? " " : "\n    ", rowIndex[i]);
+    }
+    fprintf(out, "\n};\n\n");
+
+    fprintf(out, "static const uint8_t MODEL_REGIONS_ROWS[MODEL_REGIONS_ROW_COUNT * MODEL_REGIONS_ROW_BYTES] = {\n");
+    for (const std::string& row : rows) {
+        fprintf(out, "   ");
+        for (unsigned char b : row) fprintf(out, " 0x%02x,", b);
+        fprintf(out, "\n");
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "static const ModelRegions MODEL_REGIONS = {\n");
+    fprintf(out, "    { MODEL_REGIONS_SOIL_THRESHOLDS, MODEL_REGIONS_TEMP_THRESHOLDS, MODEL_REGIONS_HUM_THRESHOLDS },\n");
+    fprintf(out, "    { %zu, %zu, %zu },\n", thresholds[0].size(), thresholds[1].size(), thresholds[2].size());
+    fprintf(out, "    MODEL_REGIONS_ROW_INDEX,\n");
+    fprintf(out, "    MODEL_REGIONS_ROWS,\n");
+    fprintf(out, "    MODEL_REGIONS_ROW_COUNT,\n");
+    fprintf(out, "    MODEL_REGIONS_ROW_BYTES,\n");
+    fprintf(out, "};\n\n#endif\n");
+    fclose(out);
+
+    size_t raw = (soilBins * tempBins * humBins + 7) / 8;
+    size_t packed = rows.size() * rowBytes + rowIndex.size() * sizeof(uint16_t);
+    printf("%s: bins %zu x %zu x %zu, %zu unique rows, bitmap %zu -> %zu bytes\n",
+           outPath, soilBins, tempBins, humBins, rows.size(), raw, packed);
+    return 0;
+}
@@ -0,0 +1,299 @@
+// Host build: chạy đường cảm biến -> đặc trưng -> mô hình -> luật điều khiển của
+// firmware trên dữ liệu mô phỏng hoặc trace đã ghi, với đồng hồ giả (halMillis).
+//
+//   g++ -O2 -std=gnu++17 -Iinclude tools/sensor_replay.cpp src/sensor_hal.cpp src/sensor_scheduler.cpp
+//       src/sensor_sim.cpp src/adaptive_sampler.cpp src/feature_store.cpp src/control_rules.cpp
+//       src/model_engine.cpp src/sensor_fault.cpp -o sensor_replay
+//   ./sensor_replay [--sim SEED | --trace FILE] [--days N] [--speed X] [--record FILE] [--expect DIGEST]
+//
+// --sim (mặc định seed 1) chạy N ngày (mặc định 30) thời tiết tất định, bơm làm ướt
+// đất mô phỏng. --trace phát lại trace CSV/nhị phân (SENSOR_TRACE_SERIAL hoặc
+// --record) tới hết file. --speed giữ tốc độ tối đa X lần thời gian thực (0 = nhanh
+// nhất có thể). --record ghi mọi mẫu thành trace (.bin nhị phân, còn lại CSV).
+//
+// In thống kê và digest của chuỗi quyết định (bơm, mái che, mô hình). Với --expect
+// trả về mã lỗi khác 0 nếu digest khác: phát lại trace của một lần --sim --record
+// phải cho cùng digest với lần chạy mô phỏng đó.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <thread>
+
+#include "sensor_hal.h"
+#include "sensor_scheduler.h"
+#include "sensor_sim.h"
+#include "feature_store.h"
+#include "sensor_fault.h"
+#include "control_rules.h"
+#include "model_table.h"
+
+// Như config.h của firmware
+static const uint32_t MODEL_UPDATE_MS = 5000;       // MODEL_UPDATE_INTERVAL
+static const uint32_t AUTO_CONTROL_MS = 600000;     // AUTO_CONTROL_INTERVAL
+static const uint32_t PUMP_ON_MS = 300000;          // PUMP_INTERVAL
+static const float LUX_HIGH = 20000.0f;             // LUX_HIGH_THRESHOLD
+
+struct ReplayStats {
+    uint32_t samples = 0;
+    uint32_t reads[SENSOR_CHANNEL_COUNT] = {};
+    uint32_t inferences = 0;
+    uint32_t irrigationNeeded = 0;  // số lần mô hình đổi sang cần tưới
+    uint32_t pumpStarts = 0;
+    uint64_t pumpOnMs = 0;
+    uint32_t canopyCloses = 0;
+    uint32_t rainChanges = 0;
+    uint64_t digest = 1469598103934665603ull;
+};
+
+// FNV-1a trên (thời điểm, sự kiện) để so hai lần chạy
+static void digestEvent(ReplayStats& stats, uint32_t timeMs, uint32_t event) {
+    uint32_t words[2] = { timeMs, event };
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(words);
+    for (size_t i = 0; i < sizeof(words); i++) {
+        stats.digest = (stats.digest ^ bytes[i]) * 1099511628211ull;
+    }
+}
+
+// Trạng thái phía loop() của firmware (sensorData, controlData, weatherData, modelPredict)
+struct ReplayState {
+    SensorSample latest;
+    bool rainDetected = false;
+    float rainNext1h = 0.0f;
+    bool needIrrigation = false;
+    bool sensorFault = false;
+    bool modelReady = false;
+    bool pump = false;
+    bool canopy = false;
+    uint32_t pumpSinceMs = 0;
+};
+
+static ControlInputs controlInputs(const ReplayState& state) {
+    ControlInputs in;
+    in.needIrrigation = state.needIrrigation;
+    in.sensorFault = state.sensorFault;
+    in.rainNext1h = state.rainNext1h;
+    in.rainDetected = state.rainDetected;
+    in.lightLevel = state.latest.lightLevel;
+    return in;
+}
+
+static void setPump(SensorBackend& backend, ReplayState& state, ReplayStats& stats, uint32_t nowMs, bool on) {
+    if (on == state.pump) return;
+    if (on) {
+        stats.pumpStarts++;
+    } else {
+        stats.pumpOnMs += nowMs - state.pumpSinceMs;
+    }
+    state.pump = on;
+    state.pumpSinceMs = nowMs;
+    digestEvent(stats, nowMs, on ? 1 : 2);
+    backend.actuate(nowMs, state.pump, state.canopy);
+}
+
+static void updateCanopy(SensorBackend& backend, ReplayState& state, ReplayStats& stats, uint32_t nowMs) {
+    bool close = decideCanopy(controlInputs(state), LUX_HIGH) != CANOPY_OPEN;
+    if (close == state.canopy) return;
+    if (close) stats.canopyCloses++;
+    state.canopy = close;
+    digestEvent(stats, nowMs, close ? 3 : 4);
+    backend.actuate(nowMs, state.pump, state.canopy);
+}
+
+static void usage() {
+    fprintf(stderr, "usage: sensor_replay [--sim SEED | --trace FILE] [--days N] [--speed X] [--record FILE] "
+                    "[--expect DIGEST]\n");
+}
+
+int main(int argc, char** argv) {
+    uint32_t seed = 1;
+    const char* tracePath = nullptr;
+    const char* recordPath = nullptr;
+    const char* expected = nullptr;
+    double days = 30.0;
+    double speed = 0.0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--sim") == 0 && i + 1 < argc) {
+            seed = (uint32_t)strtoul(argv[++i], nullptr, 0);
+        } else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            tracePath = argv[++i];
+        } else if (strcmp(argv[i], "--days") == 0 && i + 1 < argc) {
+            days = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--speed") == 0 && i + 1 < argc) {
+            speed = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            recordPath = argv[++i];
+        } else if (strcmp(argv[i], "--expect") == 0 && i + 1 < argc) {
+            expected = argv[++i];
+        } else {
+            usage();
+            return 2;
+        }
+    }
+
+    SimulatedSensorBackend simulated(seed);
+    TraceReplayBackend replay;
+    SensorBackend* backend = &simulated;
+    if (tracePath != nullptr) {
+        if (!replay.open(tracePath)) {
+            perror(tracePath);
+            return 2;
+        }
+        backend = &replay;
+    }
+    if (!backend->begin()) {
+        fprintf(stderr, "%s: không có dữ liệu\n", backend->name());
+        return 2;
+    }
+    SensorTraceWriter recorder;
+    if (recordPath != nullptr && !recorder.open(recordPath)) {
+        perror(recordPath);
+        return 2;
+    }
+
+    static FeatureStore featureStore;
+    SensorFaultMonitor faultMonitor;
+    static ModelLeafCache modelCache;
+    const TreeEnsemble engine(MODEL_TABLE);
+    SensorScheduler scheduler;
+    ReplayState state;
+    ReplayStats stats;
+    sensorSampleInvalid(state.latest);
+
+    // Đồng hồ giả bắt đầu từ 0; lịch tĩnh của firmware (static lastCheck = 0) chạy lần
+    // đầu khi millis() đạt chu kỳ
+    halMockClock(0);
+    const uint64_t endMs = tracePath != nullptr ? UINT32_MAX : (uint64_t)(days * SENSOR_SIM_DAY_MS);
+    uint32_t lastModelMs = 0, lastControlMs = 0;
+    uint64_t simulatedMs = 0;
+    auto wallStart = std::chrono::steady_clock::now();
+
+    for (; simulatedMs < endMs; simulatedMs += SENSOR_TICK_MS, halAdvanceClock(SENSOR_TICK_MS)) {
+        uint32_t nowMs = halMillis();
+        if (tracePath != nullptr && replay.finished()) break;
+
+        // readSensors() + handleRainEvents()
+        SensorSample sample;
+        if (scheduler.poll(nowMs, *backend, sample)) {
+            stats.samples++;
+            for (int c = 0; c < SENSOR_CHANNEL_COUNT; c++) {
+                if (sample.fresh & (1 << c)) stats.reads[c]++;
+            }
+            state.latest = sample;
+            faultMonitor.update(sample);
+            FeatureSample features;
+            sensorSampleFeatures(sample, features);
+            faultMonitor.exclude(features);
+            featureStore.add(nowMs, features);
+            // Dự báo đi cùng mẫu nên phát lại trace cho đúng cùng đầu vào
+            float forecast = 0.0f;
+            bool hasForecast = backend->forecast(nowMs, forecast);
+            if (hasForecast) state.rainNext1h = forecast;
+            recorder.write(sample, hasForecast, forecast);
+            if (sample.rainDetected != state.rainDetected) {
+                state.rainDetected = sample.rainDetected;
+                stats.rainChanges++;
+                digestEvent(stats, nowMs, state.rainDetected ? 5 : 6);
+                updateCanopy(*backend, state, stats, nowMs);
+            }
+        }
+
+        // updateModelPrediction()
+        if (nowMs - lastModelMs >= MODEL_UPDATE_MS) {
+            lastModelMs = nowMs;
+            float x[FEATURE_COUNT];
+            featureStore.vector(x);
+            faultMonitor.exclude(x);
+            bool valid = true;
+            for (int f = 0; f < MODEL_FEATURE_COUNT; f++) {
+                if (isnan(x[f])) valid = false;
+            }
+            // Như modelInputsReady: kênh đầu vào lỗi kéo dài thì quyết định an toàn
+            state.sensorFault = !valid && (faultMonitor.persistentFaultChannels() &
+                                           featureFaultChannels(MODEL_FEATURE_COUNT)) != 0;
+            if (state.sensorFault) state.needIrrigation = false;
+            if (valid) {
+                bool need = engine.predictIncremental(x, modelCache) == 1;
+                stats.inferences++;
+                if (!state.modelReady || need != state.needIrrigation) {
+                    if (need) stats.irrigationNeeded++;
+                    digestEvent(stats, nowMs, need ? 7 : 8);
+                }
+                state.needIrrigation = need;
+                state.modelReady = true;
+            }
+        }
+
+        // handleAutoIrrigation() + handleAutoCanopy(), chế độ tự động
+        if (nowMs - lastControlMs >= AUTO_CONTROL_MS) {
+            lastControlMs = nowMs;
+            switch (decideIrrigation(controlInputs(state), state.pump)) {
+                case IRRIGATION_START:
+                    setPump(*backend, state, stats, nowMs, true);
+                    break;
+                case IRRIGATION_STOP_MODEL:
+                case IRRIGATION_STOP_FORECAST:
+                case IRRIGATION_STOP_SENSOR:
+                    setPump(*backend, state, stats, nowMs, false);
+                    break;
+                case IRRIGATION_KEEP:
+                    break;
+            }
+            updateCanopy(*backend, state, stats, nowMs);
+        }
+
+        // checkAutoTurnOff()
+        if (state.pump && nowMs - state.pumpSinceMs > PUMP_ON_MS) {
+            setPump(*backend, state, stats, nowMs, false);
+        }
+
+        if (speed > 0.0) {
+            // Không chạy nhanh hơn speed lần thời gian thực
+            auto due = wallStart + std::chrono::duration<double, std::milli>(simulatedMs / speed);
+            std::this_thread::sleep_until(due);
+        }
+    }
+    if (state.pump) {
+        stats.pumpOnMs += halMillis() - state.pumpSinceMs;
+    }
+    recorder.close();
+
+    double wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wallStart).count();
+    double simDays = simulatedMs / (double)SENSOR_SIM_DAY_MS;
+    printf("Nguồn: %s", backend->name());
+    if (tracePath != nullptr) {
+        printf(" (%s, %u bản ghi)\n", tracePath, replay.records());
+    } else {
+        printf(" (seed %u)\n", seed);
+    }
+    printf("Mô phỏng %.2f ngày trong %.2f s (%.0fx thời gian thực)\n", simDays, wallMs / 1000.0,
+           wallMs > 0 ? simulatedMs / wallMs : 0.0);
+    printf("Mẫu %u, lần đọc dht %u / soil %u / light %u (chu kỳ cố định 5 s: %u mỗi kênh)\n", stats.samples,
+           stats.reads[SENSOR_CHANNEL_DHT], stats.reads[SENSOR_CHANNEL_SOIL], stats.reads[SENSOR_CHANNEL_LIGHT],
+           (unsigned)(simulatedMs / 5000));
+    printf("Suy luận %u, chuyển sang cần tưới %u lần, đổi trạng thái mưa %u lần\n", stats.inferences,
+           stats.irrigationNeeded, stats.rainChanges);
+    printf("Bơm bật %u lần, tổng %.1f phút; mái che đóng %u lần\n", stats.pumpStarts, stats.pumpOnMs / 60000.0,
+           stats.canopyCloses);
+    for (int c = 0; c < FAULT_CHANNEL_COUNT; c++) {
+        const FaultDetector& detector = faultMonitor.channel(c);
+        printf("Lỗi %-14s mask 0x%02x", faultChannelName(c), detector.mask());
+        for (int k = 0; k < SENSOR_FAULT_KINDS; k++) {
+            printf(" %s %u", sensorFaultName(k), detector.count(k));
+        }
+        printf("\n");
+    }
+    printf("Digest %016llx\n", (unsigned long long)stats.digest);
+
+    if (expected != nullptr) {
+        unsigned long long want = strtoull(expected, nullptr, 16);
+        if (want != stats.digest) {
+            fprintf(stderr, "Digest khác: mong đợi %016llx\n", want);
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,192 @@
+// Host build: đo lịch quét nhiều vùng (ZoneScanner) và bộ nhớ trạng thái vùng
+// (ZoneStateT) ở 8, 16 và 64 vùng, với ADC giả thay cho ADC1 DMA + mux.
+//
+//   g++ -O2 -std=gnu++17 -Iinclude tools/zone_bench.cpp src/zone_scanner.cpp src/adc_filter.cpp -o zone_bench
+//   ./zone_bench [--passes N] [--open K] [--seed S]
+//
+// ADC giả chạy theo khung DMA SOIL_ADC_FRAME_BYTES / 2 mẫu như soilSamplerTask: mux
+// đổi sau khi xử lý xong một khung nên khung kế tiếp đã đầy một phần bằng kênh cũ;
+// đầu ra mux ổn định theo RC, mẫu có nhiễu trắng và xung đột biến. --open K mở van
+// (ưu tiên quét) K vùng đầu. In thời gian một lượt quét theo đồng hồ ADC 20 kHz, thời
+// gian CPU host mỗi mẫu, RAM và sai số so với giá trị thật của từng vùng.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <random>
+
+#include "zone_scanner.h"
+#include "zone_state.h"
+
+// Như config.h của firmware
+static const uint32_t ADC_SAMPLE_HZ = 20000;        // SOIL_ADC_SAMPLE_HZ
+static const uint32_t FRAME_SAMPLES = 128;          // SOIL_ADC_FRAME_BYTES / 2
+static const uint32_t READING_RING_SIZE = 128;      // ZONE_READING_RING_SIZE
+
+static const float NOISE_SIGMA = 12.0f;             // nhiễu một mẫu (raw)
+static const float SETTLE_TAU = 6.0f;               // hằng số thời gian RC của mux (mẫu)
+static const float SPIKE_RATE = 0.002f;
+
+// Đầu ra chung của các mux trên SOIL_PIN
+class StubMuxAdc {
+    public:
+        StubMuxAdc(uint8_t zones, uint32_t seed) : count(zones), rng(seed), noise(0.0f, NOISE_SIGMA) {
+            std::uniform_real_distribution<float> level(600.0f, 3500.0f);
+            for (int z = 0; z < count; z++) truth[z] = level(rng);
+            channel = 0;
+            node = truth[0];
+        }
+
+        float level(uint8_t zone) const { return truth[zone]; }
+        void select(uint8_t zone) { channel = zone; }
+
+        uint16_t sample() {
+            node += (truth[channel] - node) * (1.0f - expf(-1.0f / SETTLE_TAU));
+            float raw = node + noise(rng);
+            if (uniform(rng) < SPIKE_RATE) raw += uniform(rng) < 0.5f ? -900.0f : 900.0f;
+            if (raw < 0.0f) raw = 0.0f;
+            if (raw > 4095.0f) raw = 4095.0f;
+            return (uint16_t)raw;
+        }
+
+        // Vị trí trong khung kế tiếp mà DMA đã lấy mẫu lúc task đổi mux
+        uint32_t switchLatency() {
+            return (uint32_t)(uniform(rng) * FRAME_SAMPLES);
+        }
+
+    private:
+        uint8_t count;
+        float truth[ZONE_MAX];
+        uint8_t channel;
+        float node;
+        std::mt19937 rng;
+        std::normal_distribution<float> noise;
+        std::uniform_real_distribution<float> uniform{0.0f, 1.0f};
+};
+
+struct BenchResult {
+    double maxPassMs;
+    double nsPerSample;     // CPU host cho ZoneScanner::add
+    double maxError;        // |trung bình cắt - giá trị thật| lớn nhất
+    double meanNoise;       // nhiễu ước lượng trung bình (so với NOISE_SIGMA)
+    double openVisitRatio;  // số lần đo vùng van mở / vùng thường
+    uint32_t samples;       // mẫu ADC tới khi xong lượt cuối
+};
+
+template <uint8_t N>
+static BenchResult runBench(uint32_t passes, uint8_t open, uint32_t seed) {
+    StubMuxAdc adc(N, seed);
+    ZoneScanner scanner(N);
+    static ZoneStateT<N> state;
+    state.reset();
+    for (uint8_t z = 0; z < open && z < N; z++) state.setValve(z, true, 0);
+    scanner.setPriority(state.valveOpen);
+
+    uint32_t visits[ZONE_MAX] = {};
+    double maxError = 0.0, noiseSum = 0.0;
+    uint32_t readings = 0;
+    uint16_t frame[FRAME_SAMPLES];
+    int32_t pendingZone = -1;   // mux sẽ đổi sang vùng này giữa khung kế tiếp
+    uint32_t pendingAt = 0;
+    double addNs = 0.0;
+    uint32_t added = 0;
+
+    while (scanner.passes() < passes) {
+        // DMA lấy một khung; lần đổi mux trước có hiệu lực từ giữa khung này
+        for (uint32_t i = 0; i < FRAME_SAMPLES; i++) {
+            if (pendingZone >= 0 && i == pendingAt) {
+                adc.select((uint8_t)pendingZone);
+                pendingZone = -1;
+            }
+            frame[i] = adc.sample();
+        }
+        if (pendingZone >= 0) {
+            adc.select((uint8_t)pendingZone);
+            pendingZone = -1;
+        }
+
+        // scanFrame(): dừng khung khi xong một vùng
+        auto start = std::chrono::steady_clock::now();
+        ZoneReading reading;
+        bool done = false;
+        uint32_t i = 0;
+        for (; i < FRAME_SAMPLES && !done; i++) {
+            done = scanner.add(frame[i], reading);
+        }
+        addNs += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        added += i;
+        if (!done) continue;
+
+        // Phần còn lại của khung thuộc kênh cũ nhưng vẫn tốn thời gian ADC
+        scanner.skip(FRAME_SAMPLES - i);
+        pendingZone = scanner.zone();
+        pendingAt = adc.switchLatency();
+        readings++;
+        visits[reading.zone]++;
+        state.setSoil(reading.zone, soilMoistureFromRaw(reading.raw), soilNoiseFromRaw(reading.noise), 0);
+        double error = fabs(reading.raw - adc.level(reading.zone));
+        if (error > maxError) maxError = error;
+        noiseSum += reading.noise;
+    }
+
+    BenchResult result;
+    result.samples = scanner.samples();
+    result.maxPassMs = scanner.maxPassSamples() * 1000.0 / ADC_SAMPLE_HZ;
+    result.nsPerSample = added ? addNs / added : 0.0;
+    result.maxError = maxError;
+    result.meanNoise = readings ? noiseSum / readings : 0.0;
+    uint32_t openVisits = 0, closedVisits = 0;
+    for (int z = 0; z < N; z++) {
+        if (state.valve(z)) {
+            openVisits += visits[z];
+        } else {
+            closedVisits += visits[z];
+        }
+    }
+    uint8_t closedZones = N - state.valvesOpen();
+    result.openVisitRatio = open && closedVisits && closedZones
+        ? (openVisits / (double)state.valvesOpen()) / (closedVisits / (double)closedZones) : 0.0;
+    return result;
+}
+
+template <uint8_t N>
+static void report(uint32_t passes, uint8_t open, uint32_t seed) {
+    BenchResult r = runBench<N>(passes, open, seed);
+    size_t stateBytes = sizeof(ZoneStateT<N>);
+    size_t scannerBytes = sizeof(ZoneScanner);
+    size_t ringBytes = READING_RING_SIZE * sizeof(ZoneReading);
+    printf("%5u %9.1f %9.1f %9.1f %8zu %8zu %8zu %9.1f %9.2f %9.2f %8.2f\n", (unsigned)N,
+           r.samples * 1000.0 / ADC_SAMPLE_HZ / passes, r.maxPassMs, r.nsPerSample, stateBytes, scannerBytes,
+           ringBytes, r.maxError, r.meanNoise, (double)NOISE_SIGMA, r.openVisitRatio);
+}
+
+int main(int argc, char** argv) {
+    uint32_t passes = 50;
+    uint8_t open = 0;
+    uint32_t seed = 1;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--passes") == 0 && i + 1 < argc) {
+            passes = (uint32_t)strtoul(argv[++i], nullptr, 0);
+        } else if (strcmp(argv[i], "--open") == 0 && i + 1 < argc) {
+            open = (uint8_t)strtoul(argv[++i], nullptr, 0);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = (uint32_t)strtoul(argv[++i], nullptr, 0);
+        } else {
+            fprintf(stderr, "usage: zone_bench [--passes N] [--open K] [--seed S]\n");
+            return 2;
+        }
+    }
+
+    printf("ADC %u Hz, khung %u mẫu, khối %d mẫu, bỏ %d mẫu mỗi lần đổi kênh, %u lượt, %u van mở\n",
+           (unsigned)ADC_SAMPLE_HZ, (unsigned)FRAME_SAMPLES, ADC_FILTER_BLOCK, ZONE_SCAN_SETTLE_SAMPLES,
+           (unsigned)passes, (unsigned)open);
+    printf("%5s %9s %9s %9s %8s %8s %8s %9s %9s %9s %8s\n", "vùng", "lượt ms", "max ms", "ns/mẫu", "state B",
+           "scan B", "ring B", "sai số", "nhiễu", "σ thật", "ưu tiên");
+    report<8>(passes, open, seed);
+    report<16>(passes, open, seed);
+    report<64>(passes, open, seed);
+    return 0;
+}